@@ -47,6 +47,18 @@
 #include "core/eeprom/eeprom.h"
 #include "core/pmu/pmu.h"
 
+#ifdef CFG_MEMINFO
+  #include "core/meminfo/meminfo.h"
+#endif
+
+#ifdef CFG_ISRTRACE
+  #include "core/isrtrace/isrtrace.h"
+#endif
+
+#ifdef CFG_PROBE
+  #include "core/probe/probe.h"
+#endif
+
 #ifdef CFG_CHIBI
   #include "messages.h"
   #include "drivers/rf/802.15.4/chibi/chb.h"
@@ -106,6 +118,19 @@ DWORD get_fattime ()
 void boardInit(void)
 {
   SystemCoreClockUpdate();
+
+  #ifdef CFG_MEMINFO
+    meminfoInit();
+  #endif
+
+  #ifdef CFG_ISRTRACE
+    isrtraceInit();
+  #endif
+
+  #ifdef CFG_PROBE
+    probeInit();
+  #endif
+
   delayInit();
   GPIOInit();
 
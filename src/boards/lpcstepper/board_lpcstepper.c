@@ -46,6 +46,18 @@
 #include "core/delay/delay.h"
 #include "core/eeprom/eeprom.h"
 #include "core/pmu/pmu.h"
+
+#ifdef CFG_MEMINFO
+  #include "core/meminfo/meminfo.h"
+#endif
+
+#ifdef CFG_ISRTRACE
+  #include "core/isrtrace/isrtrace.h"
+#endif
+
+#ifdef CFG_PROBE
+  #include "core/probe/probe.h"
+#endif
 #include "drivers/motor/stepper/stepper.h"
 
 #ifdef CFG_USB
@@ -93,6 +105,19 @@ DWORD get_fattime ()
 void boardInit(void)
 {
   SystemCoreClockUpdate();
+
+  #ifdef CFG_MEMINFO
+    meminfoInit();
+  #endif
+
+  #ifdef CFG_ISRTRACE
+    isrtraceInit();
+  #endif
+
+  #ifdef CFG_PROBE
+    probeInit();
+  #endif
+
   delayInit();
   GPIOInit();
 
@@ -277,11 +277,25 @@ extern "C" {
                               redirect to USB Serial
     CFG_PRINTF_NEWLINE        This is typically "\r\n" for Windows or
                               "\n" for *nix
+    CFG_PRINTF_BUFFERSIZE     Size of the stdout buffer in bytes.  Output
+                              is collected here and handed to the UART or
+                              USB CDC driver in blocks.  Set this to 0 to
+                              send each printf/puts call immediately
+    CFG_PRINTF_LINEBUFFERED   If set to 1, the buffer is sent at the end
+                              of every line.  If set to 0, it is only sent
+                              when it is full or printfFlush is called
+    CFG_PRINTF_NONBLOCKING    If set to 1, output that doesn't fit in the
+                              USB CDC transmit buffer is dropped (see
+                              printfGetDropped) rather than waiting for
+                              the host to read it
 
     Note: If no printf redirection definitions are present, all printf
     output will be ignored.
     -----------------------------------------------------------------------*/
     #define CFG_PRINTF_MAXSTRINGSIZE    (255)
+    #define CFG_PRINTF_BUFFERSIZE       (64)
+    #define CFG_PRINTF_LINEBUFFERED     (1)
+    #define CFG_PRINTF_NONBLOCKING      (0)
     // #define CFG_PRINTF_UART
     #define CFG_PRINTF_USBCDC
     // #define CFG_PRINTF_DEBUG
@@ -293,6 +307,94 @@ extern "C" {
     #endif
 /*=========================================================================*/
 
+/*=========================================================================
+    DEFERRED BINARY LOGGING
+    -----------------------------------------------------------------------
+
+    CFG_BINLOG                If this field is defined, LOG (log.h) and
+                              the ASSERT messages (asserts.h) no longer
+                              call printf.  Each call writes a compact
+                              binary record (format string ID, timestamp
+                              and raw arguments) to a RAM buffer instead,
+                              which is decoded on the host with
+                              tools/binlog (see core/binlog/binlog.c)
+    CFG_BINLOG_BUFFERSIZE     Size of the record buffer in bytes (must be
+                              a multiple of 4)
+    CFG_BINLOG_OVERWRITE      If set to 1, the oldest records are dropped
+                              to make room for new ones (flight recorder).
+                              If set to 0, new records are dropped when
+                              the buffer is full
+    -----------------------------------------------------------------------*/
+    // #define CFG_BINLOG
+    #define CFG_BINLOG_BUFFERSIZE       (512)
+    #define CFG_BINLOG_OVERWRITE        (0)
+/*=========================================================================*/
+
+
+/*=========================================================================
+    PROFILING PROBES
+    -----------------------------------------------------------------------
+
+    CFG_PROBE                 If this field is defined, PROBE_BEGIN and
+                              PROBE_END (core/probe/probe.h) record the
+                              min/max/mean and a log2 histogram of the
+                              clock cycles spent between them, which can
+                              be dumped with the 'pr' CLI command or the
+                              PROBE protocol command
+    CFG_PROBE_MAXPROBES       Number of named probes in the table (each
+                              one takes 88 bytes of RAM)
+    CFG_PROBE_TIMER32         32-bit timer used as a free-running cycle
+                              counter on the LPC11U (M0), which has no
+                              DWT cycle counter.  Must not be used by
+                              anything else when CFG_PROBE or
+                              CFG_ISRTRACE is enabled
+    -----------------------------------------------------------------------*/
+    // #define CFG_PROBE
+    #define CFG_PROBE_MAXPROBES         (8)
+    #define CFG_PROBE_TIMER32           (1)
+/*=========================================================================*/
+
+
+/*=========================================================================
+    ISR TRACER
+    -----------------------------------------------------------------------
+
+    CFG_ISRTRACE              If this field is defined, the interrupt
+                              handlers record their entry and exit times
+                              (core/isrtrace/isrtrace.c), and the worst
+                              case duration and nesting of each IRQ can
+                              be displayed with the 'it' CLI command.
+                              'it dump' sends the timeline, which can be
+                              converted to a Chrome trace with
+                              tools/isrtrace.  Uses the same tick counter
+                              as CFG_PROBE
+    CFG_ISRTRACE_EVENTS       Number of entry/exit events kept in RAM (8
+                              bytes each).  The oldest events are dropped
+                              when the buffer is full
+    CFG_ISRTRACE_MAXIRQS      Number of different IRQs with statistics
+                              (24 bytes each)
+    -----------------------------------------------------------------------*/
+    // #define CFG_ISRTRACE
+    #define CFG_ISRTRACE_EVENTS         (128)
+    #define CFG_ISRTRACE_MAXIRQS        (8)
+/*=========================================================================*/
+
+
+/*=========================================================================
+    STACK HIGH-WATER MARK
+    -----------------------------------------------------------------------
+
+    CFG_MEMINFO               If this field is defined, the free RAM is
+                              filled with a known pattern at startup
+                              (core/meminfo/meminfo.c), and 'sysinfo'
+                              and the SYSINFO protocol command report
+                              the deepest stack use since reset, along
+                              with the PN532 memory pool and CC3000
+                              buffer usage when those are enabled
+    -----------------------------------------------------------------------*/
+    #define CFG_MEMINFO
+/*=========================================================================*/
+
 
 /*=========================================================================
     COMMAND LINE INTERFACE
@@ -341,6 +443,15 @@ extern "C" {
                               unknown firmware.  It will also use about
                               0.5KB flash, though, so only enable it is
                               necessary.
+    CFG_INTERFACE_BOOTSCRIPT  If this is set to 1 a CLI script will be
+                              run by cliInit at startup, from the file
+                              CFG_INTERFACE_BOOTSCRIPT_FILE if an SD card
+                              is present (CFG_SDCARD), or otherwise from
+                              EEPROM at CFG_INTERFACE_SCRIPT_EEADDR
+    CFG_INTERFACE_SCRIPT_EEADDR The EEPROM address of the script used by
+                              'run' (with no arguments) and at startup
+    CFG_INTERFACE_SCRIPT_EESIZE The maximum size in bytes of the script
+                              stored at CFG_INTERFACE_SCRIPT_EEADDR
 
     NOTE:                     The command-line interface will use either
                               USB-CDC or UART depending on whether
@@ -358,6 +469,10 @@ extern "C" {
     #define CFG_INTERFACE_SHORTERRORS   (0)
     #define CFG_INTERFACE_CONFIRMREADY  (0)
     #define CFG_INTERFACE_LONGSYSINFO   (1)
+    #define CFG_INTERFACE_BOOTSCRIPT    (0)
+    #define CFG_INTERFACE_BOOTSCRIPT_FILE "/boot.txt"
+    #define CFG_INTERFACE_SCRIPT_EEADDR (0x0100)
+    #define CFG_INTERFACE_SCRIPT_EESIZE (1024)
 /*=========================================================================*/
 
 
@@ -367,14 +482,23 @@ extern "C" {
 
     CFG_PROTOCOL             If this field is defined the binary command
                               parser will be included
+    CFG_PROTOCOL_VIA_HID     Exchange messages via USB HID reports
+    CFG_PROTOCOL_VIA_BULK    Exchange messages via the USB custom class
+    CFG_PROTOCOL_VIA_UART    Exchange COBS/CRC16 framed messages over
+                              UART (CFG_PRINTF_UART must be disabled)
+    CFG_PROTOCOL_VIA_CDC     Exchange COBS/CRC16 framed messages over
+                              USB CDC (CFG_PRINTF_USBCDC must be disabled)
     -----------------------------------------------------------------------*/
     // #define CFG_PROTOCOL
 
     // #define CFG_PROTOCOL_VIA_HID
     #define CFG_PROTOCOL_VIA_BULK
+    // #define CFG_PROTOCOL_VIA_UART
+    // #define CFG_PROTOCOL_VIA_CDC
 
-    #if defined(CFG_PROTOCOL) && !defined(CFG_PROTOCOL_VIA_HID) && !defined(CFG_PROTOCOL_VIA_BULK)
-        #error CFG_PROTOCOL must be enabled with either CFG_PROTOCOL_VIA_HID or CFG_PROTOCOL_VIA_BULK
+    #if defined(CFG_PROTOCOL) && !defined(CFG_PROTOCOL_VIA_HID) && !defined(CFG_PROTOCOL_VIA_BULK) && \
+        !defined(CFG_PROTOCOL_VIA_UART) && !defined(CFG_PROTOCOL_VIA_CDC)
+        #error CFG_PROTOCOL must be enabled with CFG_PROTOCOL_VIA_HID, _BULK, _UART or _CDC
     #endif
 /*=========================================================================*/
 
@@ -401,6 +525,11 @@ extern "C" {
                                 quality text, but the fonts are 2 or 4
                                 times larger than plain bitmap fonts and
                                 take a bit more rendering time to display.
+    CFG_TFTLCD_AAEDGES          If set to a non-zero value, the filled
+                                shapes in drawing.c can blend their edges
+                                with a known background color (see
+                                drawSetAntiAliasing), at the cost of a
+                                few extra pixel writes per row
     CFG_TFTLCD_TS_DEFAULTTHRESHOLD  Default minimum threshold to trigger a
                                 touch event with the touch screen (and exit
                                 from 'tsWaitForEvent' in touchscreen.c).
@@ -410,12 +539,28 @@ extern "C" {
                                 a value stored in EEPROM.
     CFG_TFTLCD_TS_KEYPADDELAY   The delay in milliseconds between key
                                 presses in dialogue boxes
+    CFG_TFTLCD_FRAMEBUFFER      If defined, the lcd.h drawing functions
+                                are implemented by lcdfb.c, which keeps
+                                a region of the screen in RAM (set with
+                                lcdfbSetRegion) and only sends the dirty
+                                rectangles to the LCD when lcdfbFlush is
+                                called, with one window per rectangle
+    CFG_TFTLCD_FRAMEBUFFER_SIZE Size of the framebuffer in pixels (two
+                                bytes each), which limits the width *
+                                height of the region
+    CFG_TFTLCD_FRAMEBUFFER_DIRTYRECTS  Maximum number of dirty rectangles
+                                kept between two flushes.  Rectangles are
+                                merged when the list is full
     ----------------------------------------------------------------------*/
     // #define CFG_TFTLCD
     #define CFG_TFTLCD_INCLUDESMALLFONTS   (1)
     #define CFG_TFTLCD_USEAAFONTS          (0)
+    #define CFG_TFTLCD_AAEDGES             (0)
     #define CFG_TFTLCD_TS_DEFAULTTHRESHOLD (50)
     #define CFG_TFTLCD_TS_KEYPADDELAY      (100)
+    // #define CFG_TFTLCD_FRAMEBUFFER
+    #define CFG_TFTLCD_FRAMEBUFFER_SIZE    (176*8)
+    #define CFG_TFTLCD_FRAMEBUFFER_DIRTYRECTS (8)
 /*=========================================================================*/
 
 
@@ -650,6 +795,18 @@ extern "C" {
       #if defined(CFG_PROTOCOL_VIA_BULK) && !defined(CFG_USB_CUSTOM_CLASS)
         #error "CFG_PROTOCOL_VIA_BULK requires CFG_USB_CUSTOM_CLASS to be defined"
       #endif
+
+      #if defined(CFG_PROTOCOL_VIA_CDC) && !defined(CFG_USB_CDC)
+        #error "CFG_PROTOCOL_VIA_CDC requires CFG_USB_CDC to be defined"
+      #endif
+
+      #if defined(CFG_PROTOCOL_VIA_CDC) && defined(CFG_PRINTF_USBCDC)
+        #error "CFG_PROTOCOL_VIA_CDC can't be used with CFG_PRINTF_USBCDC"
+      #endif
+
+      #if defined(CFG_PROTOCOL_VIA_UART) && defined(CFG_PRINTF_UART)
+        #error "CFG_PROTOCOL_VIA_UART can't be used with CFG_PRINTF_UART"
+      #endif
     #endif
 /*=========================================================================*/
 
@@ -47,13 +47,27 @@
 #include "core/delay/delay.h"
 #include "core/eeprom/eeprom.h"
 #include "core/pmu/pmu.h"
+
+#ifdef CFG_MEMINFO
+  #include "core/meminfo/meminfo.h"
+#endif
+
+#ifdef CFG_ISRTRACE
+  #include "core/isrtrace/isrtrace.h"
+#endif
+
+#ifdef CFG_PROBE
+  #include "core/probe/probe.h"
+#endif
 #include "core/adc/adc.h"
 
 #ifdef CFG_CHIBI
   #include "drivers/rf/802.15.4/chibi/chb.h"
   #include "drivers/rf/802.15.4/chibi/chb_drvr.h"
   #include "drivers/rf/802.15.4/chibi/messages.h"
+  #include "drivers/sensors/sensorpolicy.h"
   static chb_rx_data_t rx_data;
+  static sensorpolicy_t sensor_policy;
 #endif
 
 #ifdef CFG_USB
@@ -78,6 +92,7 @@
 
 #ifdef CFG_PROTOCOL
   #include "protocol/protocol.h"
+  #include "protocol/prot_alert.h"
 #endif
 
 #ifdef CFG_ENABLE_UART
@@ -166,27 +181,79 @@ void sendMessage(void)
 
 /**************************************************************************/
 /*!
-    Sends a test message over the air
+    Sets up the reporting policy used by sendSensorEvent
+*/
+/**************************************************************************/
+void initSensorPolicy(void)
+{
+  sensorpolicy_config_t config =
+  {
+    .deadbandAbs     = 0.2F,                              // 0.2 m/s^2
+    .deadbandRel     = 0.0F,
+    .minInterval     = 100,                               // 10 Hz max
+    .maxInterval     = 60000,                             // 1 min heartbeat
+    .alertEnabled    = true,
+    .alertHigh       = 2.0F * SENSORS_GRAVITY_STANDARD,   // Shock > 2g
+    .alertLow        = 0.2F * SENSORS_GRAVITY_STANDARD,   // Free fall
+    .alertHysteresis = 1.0F
+  };
+
+  sensorpolicyInit(&sensor_policy, &config);
+}
+
+/**************************************************************************/
+/*!
+    Sends the latest sensor event over the air if it passes the
+    reporting policy (plus an alert message if a threshold was crossed)
+
+    This is the only place this board reports sensor data, so the policy
+    applies to everything it sends: RF sensor events and alerts, and the
+    sensor alerts published to the host over the simple binary protocol.
+    The USB CDC sensor log is printed by the rf1ghzusb receiver from the
+    events it gets over the air, so it only contains reported events.
+    Anything else that reads the sensor directly (CLI commands, probes)
+    bypasses the policy.
 */
 /**************************************************************************/
 void sendSensorEvent(void)
 {
   err_t error;
   sensors_event_t event;
+  msg_Alert_t alert;
+  uint8_t result;
 
   // Change this to whatever sensor you want/have!
   error = lsm303accelGetSensorEvent(&event);
 
   if (!error)
   {
-    // Serialize the data before transmitting
-    uint8_t msgbuf[sizeof(event)];
-    sensorsSerializeSensorsEvent(msgbuf, &event);
+    // Drop the event if nothing meaningful changed
+    result = sensorpolicyCheck(&sensor_policy, &event, &alert);
+
+    if (result & SENSORPOLICY_RESULT_ALERT)
+    {
+      if(msgSend(0xFFFF, MSG_MESSAGETYPE_ALERT, (uint8_t*)&alert, sizeof(alert)))
+      {
+        printf("Alert TX failure%s", CFG_PRINTF_NEWLINE);
+      }
+
+      /* Let the host know as well if it subscribed to sensor alerts */
+      #ifdef CFG_PROTOCOL
+        prot_alert_publish(PROT_ALERT_TOPIC_SENSORALERT, (uint8_t const *)&alert, sizeof(alert));
+      #endif
+    }
 
-    // Broadcast the sensor event data over the air
-    if(msgSend(0xFFFF, MSG_MESSAGETYPE_SENSOREVENT, msgbuf, sizeof(event)))
+    if (result & SENSORPOLICY_RESULT_REPORT)
     {
-      printf("Message TX failure%s", CFG_PRINTF_NEWLINE);
+      // Serialize the data before transmitting
+      uint8_t msgbuf[sizeof(event)];
+      sensorsSerializeSensorsEvent(msgbuf, &event);
+
+      // Broadcast the sensor event data over the air
+      if(msgSend(0xFFFF, MSG_MESSAGETYPE_SENSOREVENT, msgbuf, sizeof(event)))
+      {
+        printf("Message TX failure%s", CFG_PRINTF_NEWLINE);
+      }
     }
   }
 }
@@ -241,6 +308,19 @@ void checkForMessages(void)
 void boardInit(void)
 {
   SystemCoreClockUpdate();
+
+  #ifdef CFG_MEMINFO
+    meminfoInit();
+  #endif
+
+  #ifdef CFG_ISRTRACE
+    isrtraceInit();
+  #endif
+
+  #ifdef CFG_PROBE
+    probeInit();
+  #endif
+
   delayInit();
   GPIOInit();
 
@@ -373,6 +453,7 @@ void boardInit(void)
     // writeEEPROM((uint8_t*)CFG_EEPROM_CHIBI_NODEADDR, (uint8_t*)&nodeaddr, sizeof(nodeaddr));
     // writeEEPROM((uint8_t*)CFG_EEPROM_CHIBI_IEEEADDR, (uint8_t*)&ieeeaddr, sizeof(ieeeaddr));
     chb_init();
+    initSensorPolicy();
   #endif
 
   /* Initialise the SD Card? */
@@ -380,6 +461,11 @@ void boardInit(void)
     // DSTATUS stat = disk_initialize(0);
   #endif
 
+  /* Initialise the binary protocol before the transport starts */
+  #ifdef CFG_PROTOCOL
+    prot_init();
+  #endif
+
   /* Initialise USB */
   #ifdef CFG_USB
     delay(500);
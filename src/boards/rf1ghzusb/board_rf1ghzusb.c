@@ -48,6 +48,18 @@
 #include "core/eeprom/eeprom.h"
 #include "core/pmu/pmu.h"
 
+#ifdef CFG_MEMINFO
+  #include "core/meminfo/meminfo.h"
+#endif
+
+#ifdef CFG_ISRTRACE
+  #include "core/isrtrace/isrtrace.h"
+#endif
+
+#ifdef CFG_PROBE
+  #include "core/probe/probe.h"
+#endif
+
 #ifdef CFG_CHIBI
   #include "drivers/rf/802.15.4/chibi/chb.h"
   #include "drivers/rf/802.15.4/chibi/chb_drvr.h"
@@ -143,6 +155,9 @@ void checkForMessages(void)
       switch(msgType)
       {
         case (MSG_MESSAGETYPE_SENSOREVENT):
+          // Nodes only send the events that pass their reporting policy
+          // (see sendSensorEvent in board_rf1ghznode.c), so this log
+          // doesn't need its own deadband
           event = (sensors_event_t*)&rx_data.data[9];
           printf("%04X,%d,", rx_data.src_addr, event->timestamp);
           printf("%f,%f,%f%s", event->acceleration.x, event->acceleration.y, event->acceleration.z, CFG_PRINTF_NEWLINE);
@@ -180,6 +195,19 @@ void checkForMessages(void)
 void boardInit(void)
 {
   SystemCoreClockUpdate();
+
+  #ifdef CFG_MEMINFO
+    meminfoInit();
+  #endif
+
+  #ifdef CFG_ISRTRACE
+    isrtraceInit();
+  #endif
+
+  #ifdef CFG_PROBE
+    probeInit();
+  #endif
+
   delayInit();
   GPIOInit();
 
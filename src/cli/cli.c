@@ -58,6 +58,8 @@
 
 #include "cli.h"
 #include "cli_tbl.h"
+#include "cli_script.h"
+#include "printf-retarget.h"
 
 #ifdef CFG_PRINTF_UART
 #include "core/uart/uart.h"
@@ -78,6 +80,13 @@
 static uint8_t cli_buffer[CFG_INTERFACE_MAXMSGSIZE];
 static uint8_t *cli_buffer_ptr;
 
+/* cli_tbl entries sorted by command name, see cliBuildIndex */
+static uint8_t cli_index[CMD_COUNT];
+static bool    cli_index_ready = false;
+
+/* Error reported by the last command handler, see cliSetError */
+static err_t   cli_error = ERROR_NONE;
+
 /**************************************************************************/
 /*!
     @brief  Polls the relevant incoming message queue to see if anything
@@ -104,6 +113,9 @@ void cliPoll()
     }
   }
   #endif
+
+  // Send any echoed characters or command output in one block
+  printfFlush();
 }
 
 /**************************************************************************/
@@ -119,6 +131,7 @@ void cliReadLine(uint8_t *str, uint16_t *strLen)
 
   /* ToDo: Update this to handle UART, etc., with proper #ifdef blocks! */
 
+  #if defined(CFG_USB) && defined(CFG_PRINTF_USBCDC)
   while (1)
   {
     if (usb_isConfigured())
@@ -129,11 +142,13 @@ void cliReadLine(uint8_t *str, uint16_t *strLen)
       {
         str[idx++] = ch;
         cliRx(ch);
+        printfFlush();
       }
       if (((ch == 8) || (ch == 127)) && idx)
       {
         str[idx--] = 0;
         cliRx(ch);
+        printfFlush();
       }
       if (ch == KEY_CODE_ENTER)
       {
@@ -142,6 +157,11 @@ void cliReadLine(uint8_t *str, uint16_t *strLen)
       }
     }
   }
+  #else
+  /* No input available */
+  (void) ch;
+  *strLen = idx;
+  #endif
 }
 
 /**************************************************************************/
@@ -215,90 +235,348 @@ static void cliMenu()
   #if CFG_INTERFACE_CONFIRMREADY == 1
   printf("%s%s", CFG_INTERFACE_CONFIRMREADY_TEXT, CFG_PRINTF_NEWLINE);
   #endif
+
+  // The prompt has no newline, so make sure it isn't left in the buffer
+  printfFlush();
+}
+
+/**************************************************************************/
+/*!
+    @brief  Builds the sorted command index used by cliFind.  cli_tbl
+            itself is left in the order it was declared (which is the
+            order used by the help menu), and since the entries are
+            grouped by #ifdef blocks the table can't be sorted by hand.
+            The index is only a few bytes, and is built once on the
+            first lookup.
+*/
+/**************************************************************************/
+static void cliBuildIndex(void)
+{
+  uint8_t i, j, tmp;
+
+  // Simple insertion sort, the table is small and this only runs once
+  for (i = 0; i < CMD_COUNT; i++)
+  {
+    tmp = i;
+    for (j = i; (j > 0) && (strcmp(cli_tbl[cli_index[j-1]].command, cli_tbl[tmp].command) > 0); j--)
+    {
+      cli_index[j] = cli_index[j-1];
+    }
+    cli_index[j] = tmp;
+  }
+
+  cli_index_ready = true;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the position in the sorted index of the first command
+            that is >= 'name' (binary search).  Any commands starting
+            with 'name' are located contiguously from this position.
+*/
+/**************************************************************************/
+static uint8_t cliLowerBound(const char *name)
+{
+  uint8_t low  = 0;
+  uint8_t high = CMD_COUNT;
+
+  if (!cli_index_ready)
+  {
+    cliBuildIndex();
+  }
+
+  while (low < high)
+  {
+    uint8_t mid = (low + high) / 2;
+    if (strcmp(cli_tbl[cli_index[mid]].command, name) < 0)
+    {
+      low = mid + 1;
+    }
+    else
+    {
+      high = mid;
+    }
+  }
+
+  return low;
 }
 
 /**************************************************************************/
 /*!
-    @brief  Parse the command line. This function tokenizes the command
-            input, then searches for the command table entry associated
-            with the commmand. Once found, it will jump to the
+    @brief  Looks up a command by name.  An exact match always wins,
+            otherwise 'name' can be any unique abbreviation of a visible
+            (non-hidden) command, ex. 'm' for 'mr'.
+
+    @param[in]  name
+                The command name (or abbreviation) to search for
+    @param[out] matches
+                Set to the number of commands matching 'name' (0 if the
+                command is unknown, >1 if the abbreviation is ambiguous).
+                Can be NULL if this isn't required.
+
+    @returns    A pointer to the matching cli_tbl entry, or NULL if no
+                single command matches
+*/
+/**************************************************************************/
+cli_t const * cliFind(const char *name, uint8_t *matches)
+{
+  cli_t const *found = NULL;
+  uint8_t count = 0;
+  uint8_t pos;
+  size_t  len;
+
+  if ((name == NULL) || (name[0] == '\0'))
+  {
+    if (matches) *matches = 0;
+    return NULL;
+  }
+
+  pos = cliLowerBound(name);
+  len = strlen(name);
+
+  if ((pos < CMD_COUNT) && !strcmp(cli_tbl[cli_index[pos]].command, name))
+  {
+    // Exact match
+    found = &cli_tbl[cli_index[pos]];
+    count = 1;
+  }
+  else
+  {
+    // Check for a unique abbreviation
+    for ( ; (pos < CMD_COUNT) && !strncmp(cli_tbl[cli_index[pos]].command, name, len); pos++)
+    {
+      if (!cli_tbl[cli_index[pos]].hidden)
+      {
+        found = &cli_tbl[cli_index[pos]];
+        count++;
+      }
+    }
+    if (count != 1)
+    {
+      found = NULL;
+    }
+  }
+
+  if (matches) *matches = count;
+  return found;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Splits a command line into tokens in place (no data is
+            copied).  Tokens are separated by one or more spaces, and
+            text enclosed in double quotes is returned as a single token
+            without the quotes (ex. 'wc 3 "My SSID" key').
+
+    @param[in]  line
+                The command line, which will be modified (separators and
+                closing quotes are replaced with '\0')
+    @param[out] argv
+                Receives a pointer to each token
+    @param[in]  maxArgs
+                The number of entries available in 'argv'
+
+    @returns    The number of tokens found on the line.  This can be
+                larger than 'maxArgs', in which case only the first
+                'maxArgs' tokens were stored in argv.
+*/
+/**************************************************************************/
+uint16_t cliTokenise(char *line, char *argv[], uint16_t maxArgs)
+{
+  uint16_t argc = 0;
+  char *p = line;
+  char *token;
+
+  while (1)
+  {
+    // Skip any leading separators
+    while (*p == ' ')
+    {
+      p++;
+    }
+
+    if (*p == '\0')
+    {
+      break;
+    }
+
+    if (*p == '"')
+    {
+      // Quoted string, runs until the closing quote or the end of line
+      token = ++p;
+      while ((*p != '\0') && (*p != '"'))
+      {
+        p++;
+      }
+    }
+    else
+    {
+      token = p;
+      while ((*p != '\0') && (*p != ' '))
+      {
+        p++;
+      }
+    }
+
+    if (argc < maxArgs)
+    {
+      argv[argc] = token;
+    }
+    argc++;
+
+    // Terminate the token and move past the separator
+    if (*p != '\0')
+    {
+      *p++ = '\0';
+    }
+  }
+
+  return argc;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Lets a command handler report that it failed, so that the
+            error is returned by cliExecute (and counted when the command
+            runs from a script).  Handlers that don't call this are
+            assumed to have succeeded.
+
+    @param[in]  error
+                The error code to report
+*/
+/**************************************************************************/
+void cliSetError(err_t error)
+{
+  cli_error = error;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Executes a single command line. This function tokenizes the
+            command input, then searches for the command table entry
+            associated with the commmand. Once found, it will jump to the
             corresponding function.
 
     @param[in]  cmd
-                The entire command string to be parsed
+                The entire command string to be parsed (modified in place)
+
+    @returns    ERROR_NONE if the command ran (or the line was empty), an
+                ERROR_CLI_* code if the CLI rejected the line, or the error
+                passed to cliSetError by the command handler
 */
 /**************************************************************************/
-void cliParse(char *cmd)
+err_t cliExecute(char *cmd)
 {
-  size_t argc, i = 0;
-  char *argv[30];
+  char *argv[CLI_MAXARGS];
+  uint16_t argc;
+  uint8_t maxArgs, matches;
+  cli_t const *p_cmd;
 
-  argv[i] = strtok(cmd, " ");
-  do
+  argc = cliTokenise(cmd, argv, CLI_MAXARGS);
+  if (argc == 0)
   {
-      argv[++i] = strtok(NULL, " ");
-  } while ((i < 30) && (argv[i] != NULL));
+    // Empty line, nothing to do
+    return ERROR_NONE;
+  }
 
-  argc = i;
-  for (i=0; i < CMD_COUNT; i++)
+  p_cmd = cliFind(argv[0], &matches);
+  if (p_cmd == NULL)
   {
-      if (!strcmp(argv[0], cli_tbl[i].command))
+    #if CFG_INTERFACE_SHORTERRORS == 1
+    printf ("%s%s", CFG_INTERFACE_SHORTERRORS_UNKNOWNCOMMAND, CFG_PRINTF_NEWLINE);
+    #else
+    if (matches > 1)
+    {
+      // Ambiguous abbreviation, list the candidates
+      uint8_t pos = cliLowerBound(argv[0]);
+      size_t  len = strlen(argv[0]);
+      printf("%s: '%s' (", STRING(LOCALISATION_TEXT_Ambiguous_Command), argv[0]);
+      for ( ; (pos < CMD_COUNT) && !strncmp(cli_tbl[cli_index[pos]].command, argv[0], len); pos++)
       {
-        if ((argc == 2) && !strcmp (argv [1], "?"))
-        {
-          // Display parameter help menu on 'command ?'
-          printf ("%s%s%s", cli_tbl[i].description, CFG_PRINTF_NEWLINE, CFG_PRINTF_NEWLINE);
-          printf ("%s%s", cli_tbl[i].parameters, CFG_PRINTF_NEWLINE);
-        }
-        else if ((argc - 1) < cli_tbl[i].minArgs)
-        {
-          // Too few arguments supplied
-          #if CFG_INTERFACE_SHORTERRORS == 1
-          printf ("%s%s", CFG_INTERFACE_SHORTERRORS_TOOFEWARGS, CFG_PRINTF_NEWLINE);
-          #else
-          printf ("%s (%s %d)%s", STRING(LOCALISATION_TEXT_Too_few_arguments), STRING(LOCALISATION_TEXT_Expected), cli_tbl[i].minArgs, CFG_PRINTF_NEWLINE);
-          printf ("%s'%s ?' %s%s%s", CFG_PRINTF_NEWLINE, cli_tbl[i].command, STRING(LOCALISATION_TEXT_for_more_information), CFG_PRINTF_NEWLINE, CFG_PRINTF_NEWLINE);
-          #endif
-        }
-        else if ((argc - 1) > cli_tbl[i].maxArgs)
+        if (!cli_tbl[cli_index[pos]].hidden)
         {
-          // Too many arguments supplied
-          #if CFG_INTERFACE_SHORTERRORS == 1
-          printf ("%s%s", CFG_INTERFACE_SHORTERRORS_TOOMANYARGS, CFG_PRINTF_NEWLINE);
-          #else
-          printf ("%s (%s %d)%s", STRING(LOCALISATION_TEXT_Too_many_arguments), STRING(LOCALISATION_TEXT_Maximum), cli_tbl[i].maxArgs, CFG_PRINTF_NEWLINE);
-          printf ("%s'%s ?' %s%s%s", CFG_PRINTF_NEWLINE, cli_tbl[i].command, STRING(LOCALISATION_TEXT_for_more_information), CFG_PRINTF_NEWLINE, CFG_PRINTF_NEWLINE);
-          #endif
+          printf(" %s", cli_tbl[cli_index[pos]].command);
         }
-        else
-        {
-          #if CFG_INTERFACE_ENABLEIRQ != 0
-          // Set the IRQ pin high at start of a command
-          gpioSetValue(CFG_INTERFACE_IRQPORT, CFG_INTERFACE_IRQPIN, 1);
-          #endif
-          // Dispatch command to the appropriate function
-          cli_tbl[i].func(argc - 1, &argv [1]);
-          #if CFG_INTERFACE_ENABLEIRQ  != 0
-          // Set the IRQ pin low to signal the end of a command
-          gpioSetValue(CFG_INTERFACE_IRQPORT, CFG_INTERFACE_IRQPIN, 0);
-          #endif
-        }
-
-        // Refresh the command prompt
-        cliMenu();
-        return;
       }
+      printf(" )%s%s", CFG_PRINTF_NEWLINE, CFG_PRINTF_NEWLINE);
+    }
+    else
+    {
+      // Command not recognized
+      printf("%s: '%s'%s%s", STRING(LOCALISATION_TEXT_Command_Not_Recognized), argv[0], CFG_PRINTF_NEWLINE, CFG_PRINTF_NEWLINE);
+    }
+    #if CFG_INTERFACE_SILENTMODE == 0
+    printf("%s%s", STRING(LOCALISATION_TEXT_Type_QUESTION_for_a_list_of), CFG_PRINTF_NEWLINE);
+    #endif
+    #endif
+
+    return (matches > 1) ? ERROR_CLI_AMBIGUOUSCOMMAND : ERROR_CLI_UNKNOWNCOMMAND;
   }
-  // Command not recognized
-  #if CFG_INTERFACE_SHORTERRORS == 1
-  printf ("%s%s", CFG_INTERFACE_SHORTERRORS_UNKNOWNCOMMAND, CFG_PRINTF_NEWLINE);
-  #else
-  printf("%s: '%s'%s%s", STRING(LOCALISATION_TEXT_Command_Not_Recognized), cmd, CFG_PRINTF_NEWLINE, CFG_PRINTF_NEWLINE);
-  #if CFG_INTERFACE_SILENTMODE == 0
-  printf("%s%s", STRING(LOCALISATION_TEXT_Type_QUESTION_for_a_list_of), CFG_PRINTF_NEWLINE);
+
+  // argv only has room for CLI_MAXARGS tokens, including the command name
+  maxArgs = (p_cmd->maxArgs < CLI_MAXARGS) ? p_cmd->maxArgs : (CLI_MAXARGS - 1);
+
+  if ((argc == 2) && !strcmp (argv [1], "?"))
+  {
+    // Display parameter help menu on 'command ?'
+    printf ("%s%s%s", p_cmd->description, CFG_PRINTF_NEWLINE, CFG_PRINTF_NEWLINE);
+    printf ("%s%s", p_cmd->parameters, CFG_PRINTF_NEWLINE);
+    return ERROR_NONE;
+  }
+
+  if ((argc - 1) < p_cmd->minArgs)
+  {
+    // Too few arguments supplied
+    #if CFG_INTERFACE_SHORTERRORS == 1
+    printf ("%s%s", CFG_INTERFACE_SHORTERRORS_TOOFEWARGS, CFG_PRINTF_NEWLINE);
+    #else
+    printf ("%s (%s %d)%s", STRING(LOCALISATION_TEXT_Too_few_arguments), STRING(LOCALISATION_TEXT_Expected), p_cmd->minArgs, CFG_PRINTF_NEWLINE);
+    printf ("%s'%s ?' %s%s%s", CFG_PRINTF_NEWLINE, p_cmd->command, STRING(LOCALISATION_TEXT_for_more_information), CFG_PRINTF_NEWLINE, CFG_PRINTF_NEWLINE);
+    #endif
+    return ERROR_CLI_TOOFEWARGS;
+  }
+
+  if ((argc - 1) > maxArgs)
+  {
+    // Too many arguments supplied
+    #if CFG_INTERFACE_SHORTERRORS == 1
+    printf ("%s%s", CFG_INTERFACE_SHORTERRORS_TOOMANYARGS, CFG_PRINTF_NEWLINE);
+    #else
+    printf ("%s (%s %d)%s", STRING(LOCALISATION_TEXT_Too_many_arguments), STRING(LOCALISATION_TEXT_Maximum), maxArgs, CFG_PRINTF_NEWLINE);
+    printf ("%s'%s ?' %s%s%s", CFG_PRINTF_NEWLINE, p_cmd->command, STRING(LOCALISATION_TEXT_for_more_information), CFG_PRINTF_NEWLINE, CFG_PRINTF_NEWLINE);
+    #endif
+    return ERROR_CLI_TOOMANYARGS;
+  }
+
+  #if CFG_INTERFACE_ENABLEIRQ != 0
+  // Set the IRQ pin high at start of a command
+  gpioSetValue(CFG_INTERFACE_IRQPORT, CFG_INTERFACE_IRQPIN, 1);
   #endif
+  // Dispatch command to the appropriate function
+  cli_error = ERROR_NONE;
+  p_cmd->func(argc - 1, &argv [1]);
+  #if CFG_INTERFACE_ENABLEIRQ  != 0
+  // Set the IRQ pin low to signal the end of a command
+  gpioSetValue(CFG_INTERFACE_IRQPORT, CFG_INTERFACE_IRQPIN, 0);
   #endif
 
+  return cli_error;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Parse the command line and execute the matching command (see
+            cliExecute), then refresh the command prompt.
+
+    @param[in]  cmd
+                The entire command string to be parsed
+*/
+/**************************************************************************/
+void cliParse(char *cmd)
+{
+  cliExecute(cmd);
+
+  // Refresh the command prompt
   cliMenu();
 }
 
@@ -327,6 +605,14 @@ void cliInit()
   // init the cli_buffer ptr
   cli_buffer_ptr = cli_buffer;
 
+  // Sort the command table now rather than on the first command
+  cliBuildIndex();
+
+  #if CFG_INTERFACE_BOOTSCRIPT == 1
+  // Run the startup script from the SD card or EEPROM
+  cliScriptRunBoot();
+  #endif
+
   // Show the menu
   cliMenu();
 
@@ -56,6 +56,9 @@ extern "C" {
 
 #include "projectconfig.h"
 
+/* Maximum number of tokens (command name + arguments) on a single line */
+#define CLI_MAXARGS   (30)
+
 typedef struct
 {
   char *command;
@@ -70,8 +73,12 @@ typedef struct
 void cliPoll(void);
 void cliRx(uint8_t c);
 void cliParse(char *cmd);
+err_t cliExecute(char *cmd);
+void cliSetError(err_t error);
 void cliInit(void);
 void cliReadLine(uint8_t *str, uint16_t *strLen);
+uint16_t cliTokenise(char *line, char *argv[], uint16_t maxArgs);
+cli_t const * cliFind(const char *name, uint8_t *matches);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,456 @@
+/**************************************************************************/
+/*!
+    @file     cli_script.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Runs a sequence of CLI commands from a script
+
+    @ingroup  CLI
+
+    Scripts are plain text with one command per line, exactly as they
+    would be typed at the command prompt.  Empty lines and lines
+    starting with '#' are ignored.  A script ends at the end of the
+    file/buffer, or at the first '\0' or 0xFF byte (erased EEPROM).
+
+    Every command is executed with cliExecute, and is timed using the
+    delay tick counter.  Failed commands (rejected by the CLI, or
+    reported via cliSetError by the command handler) don't stop the
+    script, but are counted and reported in the summary at the end:
+
+    @code
+    [1] ew 0x0100 0xAA
+    0xAA written at 0x0100
+    [1] OK, 3 ms
+    [3] er 0x2000
+    Address out of range
+    [3] Error 0x0002, 0 ms
+    Script: 2 lines, 1 errors, 3 ms (first error on line 3)
+    @endcode
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include "projectconfig.h"
+
+#ifdef CFG_INTERFACE
+
+#include <stdio.h>
+#include <string.h>
+
+#include "cli.h"
+#include "cli_script.h"
+#include "printf-retarget.h"
+#include "core/delay/delay.h"
+#include "core/eeprom/eeprom.h"
+
+#ifdef CFG_SDCARD
+  #include "drivers/storage/fatfs/diskio.h"
+  #include "drivers/storage/fatfs/ff.h"
+#endif
+
+/* Number of bytes requested from the script source at a time */
+#define CLI_SCRIPT_CHUNKSIZE    (32)
+
+typedef struct
+{
+  uint16_t addr;
+  uint16_t size;
+} cli_script_eeprom_t;
+
+static char cli_script_line[CFG_INTERFACE_MAXMSGSIZE];
+static bool cli_script_running = false;
+
+/**************************************************************************/
+/*!
+    @brief  Executes the line held in cli_script_line and updates the
+            script statistics
+*/
+/**************************************************************************/
+static void cliScriptExecLine(uint16_t lineNum, uint16_t len, bool overflow, cli_script_stats_t *stats)
+{
+  char *cmd = cli_script_line;
+  uint32_t start;
+  err_t error;
+
+  cli_script_line[len] = '\0';
+
+  // Skip leading whitespace, empty lines and comments
+  while ((*cmd == ' ') || (*cmd == '\t'))
+  {
+    cmd++;
+  }
+  if ((*cmd == '\0') || (*cmd == '#'))
+  {
+    return;
+  }
+
+  stats->lines++;
+
+  #if CFG_INTERFACE_SILENTMODE == 0
+  printf("[%u] %s%s", lineNum, cmd, CFG_PRINTF_NEWLINE);
+  #endif
+
+  start = delayGetTicks();
+  if (overflow)
+  {
+    // The line was truncated, don't try to run what's left of it
+    printf("Line longer than %u characters%s", CFG_INTERFACE_MAXMSGSIZE - 1, CFG_PRINTF_NEWLINE);
+    error = ERROR_BUFFEROVERFLOW;
+  }
+  else
+  {
+    error = cliExecute(cmd);
+  }
+
+  if (error)
+  {
+    stats->errors++;
+    if (stats->firstErrorLine == 0)
+    {
+      stats->firstErrorLine = lineNum;
+      stats->firstError     = error;
+    }
+    printf("[%u] Error 0x%04X, %u ms%s", lineNum, error, (unsigned int) (delayGetTicks() - start), CFG_PRINTF_NEWLINE);
+  }
+  #if CFG_INTERFACE_SILENTMODE == 0
+  else
+  {
+    printf("[%u] OK, %u ms%s", lineNum, (unsigned int) (delayGetTicks() - start), CFG_PRINTF_NEWLINE);
+  }
+  #endif
+
+  printfFlush();
+}
+
+/**************************************************************************/
+/*!
+    @brief  Runs a CLI script read from any source
+
+    @param[in]  read
+                Function used to read the script contents in blocks
+    @param[in]  source
+                Passed to 'read' as is (file handle, address, etc.)
+    @param[out] stats
+                Receives the number of lines executed, errors and the
+                total execution time.  Can be NULL if not required.
+
+    @returns    ERROR_NONE if every command succeeded,
+                ERROR_CLI_SCRIPTERRORS if one or more commands failed,
+                ERROR_CLI_SCRIPTNOTFOUND if the script is empty, or
+                ERROR_CLI_SCRIPTRUNNING if called from inside a script
+*/
+/**************************************************************************/
+err_t cliScriptRun(cli_script_read_t read, void *source, cli_script_stats_t *stats)
+{
+  cli_script_stats_t results;
+  char     chunk[CLI_SCRIPT_CHUNKSIZE];
+  uint32_t offset = 0;
+  uint32_t start;
+  uint16_t count, i;
+  uint16_t len = 0;
+  uint16_t lineNum = 0;
+  bool     overflow = false;
+  bool     done = false;
+
+  ASSERT(read, ERROR_INVALIDPARAMETER);
+
+  if (cli_script_running)
+  {
+    return ERROR_CLI_SCRIPTRUNNING;
+  }
+
+  if (stats == NULL)
+  {
+    stats = &results;
+  }
+  memset(stats, 0, sizeof(cli_script_stats_t));
+
+  cli_script_running = true;
+  start = delayGetTicks();
+
+  while (!done)
+  {
+    count = read(source, offset, chunk, sizeof(chunk));
+    if (count == 0)
+    {
+      break;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+      char c = chunk[i];
+
+      if ((c == '\0') || (c == (char) 0xFF))
+      {
+        // End of script
+        done = true;
+        break;
+      }
+
+      offset++;
+      if (c == '\n')
+      {
+        cliScriptExecLine(++lineNum, len, overflow, stats);
+        len = 0;
+        overflow = false;
+      }
+      else if (c != '\r')
+      {
+        if (len < sizeof(cli_script_line) - 1)
+        {
+          cli_script_line[len++] = c;
+        }
+        else
+        {
+          overflow = true;
+        }
+      }
+    }
+  }
+
+  // The last line doesn't need a trailing newline
+  if (len || overflow)
+  {
+    cliScriptExecLine(++lineNum, len, overflow, stats);
+  }
+
+  stats->ms = delayGetTicks() - start;
+  cli_script_running = false;
+
+  if (offset == 0)
+  {
+    return ERROR_CLI_SCRIPTNOTFOUND;
+  }
+
+  printf("Script: %u lines, %u errors, %u ms", stats->lines, stats->errors, (unsigned int) stats->ms);
+  if (stats->errors)
+  {
+    printf(" (first error on line %u)", stats->firstErrorLine);
+  }
+  printf("%s", CFG_PRINTF_NEWLINE);
+  printfFlush();
+
+  return stats->errors ? ERROR_CLI_SCRIPTERRORS : ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  cli_script_read_t for a null-terminated string in memory
+*/
+/**************************************************************************/
+static uint16_t cliScriptReadBuffer(void *source, uint32_t offset, char *buffer, uint16_t len)
+{
+  const char *script = (const char *) source + offset;
+  uint16_t i;
+
+  for (i = 0; i < len; i++)
+  {
+    buffer[i] = script[i];
+    if (buffer[i] == '\0')
+    {
+      return i + 1;
+    }
+  }
+
+  return len;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Runs a CLI script held in memory
+
+    @param[in]  script
+                The null-terminated script
+    @param[out] stats
+                Receives the script statistics (can be NULL)
+*/
+/**************************************************************************/
+err_t cliScriptRunBuffer(const char *script, cli_script_stats_t *stats)
+{
+  ASSERT(script, ERROR_INVALIDPARAMETER);
+
+  return cliScriptRun(cliScriptReadBuffer, (void *) script, stats);
+}
+
+/**************************************************************************/
+/*!
+    @brief  cli_script_read_t for a script stored in EEPROM
+*/
+/**************************************************************************/
+static uint16_t cliScriptReadEEPROM(void *source, uint32_t offset, char *buffer, uint16_t len)
+{
+  cli_script_eeprom_t *ee = (cli_script_eeprom_t *) source;
+
+  if (offset >= ee->size)
+  {
+    return 0;
+  }
+  if (len > ee->size - offset)
+  {
+    len = ee->size - offset;
+  }
+
+  if (readEEPROM((uint8_t *) (uintptr_t) (ee->addr + offset), (uint8_t *) buffer, len))
+  {
+    return 0;
+  }
+
+  return len;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Runs a CLI script stored as text in EEPROM
+
+    @param[in]  addr
+                The EEPROM address where the script starts
+    @param[in]  maxSize
+                The maximum size of the script in bytes.  The script
+                ends before this if a '\0' or 0xFF byte is found.
+    @param[out] stats
+                Receives the script statistics (can be NULL)
+*/
+/**************************************************************************/
+err_t cliScriptRunEEPROM(uint16_t addr, uint16_t maxSize, cli_script_stats_t *stats)
+{
+  cli_script_eeprom_t ee = { .addr = addr, .size = maxSize };
+
+  ASSERT((uint32_t) addr + maxSize <= CFG_EEPROM_SIZE, ERROR_ADDRESSOUTOFRANGE);
+
+  return cliScriptRun(cliScriptReadEEPROM, &ee, stats);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Stores a null-terminated script in EEPROM so that it can be
+            run later with cliScriptRunEEPROM (or at startup)
+
+    @param[in]  addr
+                The EEPROM address where the script should be stored (must
+                be above CFG_EEPROM_RESERVED)
+    @param[in]  maxSize
+                The space available for the script, including the
+                terminating '\0'
+    @param[in]  script
+                The null-terminated script to store
+*/
+/**************************************************************************/
+err_t cliScriptWriteEEPROM(uint16_t addr, uint16_t maxSize, const char *script)
+{
+  uint32_t len;
+
+  ASSERT(script, ERROR_INVALIDPARAMETER);
+  ASSERT(addr > CFG_EEPROM_RESERVED, ERROR_ADDRESSOUTOFRANGE);
+  ASSERT((uint32_t) addr + maxSize <= CFG_EEPROM_SIZE, ERROR_ADDRESSOUTOFRANGE);
+
+  len = strlen(script) + 1;
+  ASSERT(len <= maxSize, ERROR_BUFFEROVERFLOW);
+
+  return writeEEPROM((uint8_t *) (uintptr_t) addr, (uint8_t *) script, len);
+}
+
+#ifdef CFG_SDCARD
+/**************************************************************************/
+/*!
+    @brief  cli_script_read_t for a file on the SD card
+*/
+/**************************************************************************/
+static uint16_t cliScriptReadFile(void *source, uint32_t offset, char *buffer, uint16_t len)
+{
+  UINT count;
+
+  if (f_read((FIL *) source, buffer, len, &count) != FR_OK)
+  {
+    return 0;
+  }
+
+  return count;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Runs a CLI script stored in a file on the SD card
+
+    @param[in]  path
+                Path of the script file (ex. "/boot.txt")
+    @param[out] stats
+                Receives the script statistics (can be NULL)
+*/
+/**************************************************************************/
+err_t cliScriptRunFile(const char *path, cli_script_stats_t *stats)
+{
+  static FATFS fatfs;
+  static FIL   file;
+  err_t error;
+
+  ASSERT(path, ERROR_INVALIDPARAMETER);
+
+  if (disk_initialize(0) & (STA_NOINIT | STA_NODISK))
+  {
+    return ERROR_FATFS_NODISK;
+  }
+  if (f_mount(0, &fatfs) != FR_OK)
+  {
+    return ERROR_FATFS_FAILEDTOMOUNTDRIVE;
+  }
+  if (f_open(&file, path, FA_READ | FA_OPEN_EXISTING) != FR_OK)
+  {
+    return ERROR_CLI_SCRIPTNOTFOUND;
+  }
+
+  error = cliScriptRun(cliScriptReadFile, &file, stats);
+  f_close(&file);
+
+  return error;
+}
+#endif
+
+/**************************************************************************/
+/*!
+    @brief  Runs the startup script.  CFG_INTERFACE_BOOTSCRIPT_FILE is
+            used if an SD card is present (CFG_SDCARD) and the file
+            exists, otherwise the script stored in EEPROM at
+            CFG_INTERFACE_SCRIPT_EEADDR is used.
+*/
+/**************************************************************************/
+err_t cliScriptRunBoot(void)
+{
+  #ifdef CFG_SDCARD
+  err_t error = cliScriptRunFile(CFG_INTERFACE_BOOTSCRIPT_FILE, NULL);
+  if ((error == ERROR_NONE) || (error == ERROR_CLI_SCRIPTERRORS))
+  {
+    return error;
+  }
+  #endif
+
+  return cliScriptRunEEPROM(CFG_INTERFACE_SCRIPT_EEADDR, CFG_INTERFACE_SCRIPT_EESIZE, NULL);
+}
+
+#endif
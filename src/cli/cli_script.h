@@ -0,0 +1,73 @@
+/**************************************************************************/
+/*!
+    @file     cli_script.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+#ifndef __CLI_SCRIPT_H__
+#define __CLI_SCRIPT_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "projectconfig.h"
+
+/* Results of the last script run */
+typedef struct
+{
+  uint16_t lines;           ///< Number of commands executed
+  uint16_t errors;          ///< Number of commands that failed
+  uint16_t firstErrorLine;  ///< Line number of the first failure (0 = none)
+  err_t    firstError;      ///< Error code of the first failure
+  uint32_t ms;              ///< Total execution time in milliseconds
+} cli_script_stats_t;
+
+/* Reads up to 'len' bytes of the script starting at 'offset', and returns
+   the number of bytes read (0 at the end of the script) */
+typedef uint16_t (*cli_script_read_t)(void *source, uint32_t offset, char *buffer, uint16_t len);
+
+err_t cliScriptRun(cli_script_read_t read, void *source, cli_script_stats_t *stats);
+err_t cliScriptRunBuffer(const char *script, cli_script_stats_t *stats);
+err_t cliScriptRunEEPROM(uint16_t addr, uint16_t maxSize, cli_script_stats_t *stats);
+err_t cliScriptWriteEEPROM(uint16_t addr, uint16_t maxSize, const char *script);
+#ifdef CFG_SDCARD
+err_t cliScriptRunFile(const char *path, cli_script_stats_t *stats);
+#endif
+err_t cliScriptRunBoot(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
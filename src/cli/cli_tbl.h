@@ -58,6 +58,19 @@ void cmd_sysinfo(uint8_t argc, char **argv);
 void cmd_dbg_memrd(uint8_t argc, char **argv);
 void cmd_eeprom_read(uint8_t argc, char **argv);
 void cmd_eeprom_write(uint8_t argc, char **argv);
+void cmd_script_run(uint8_t argc, char **argv);
+
+#ifdef CFG_BINLOG
+void cmd_binlog_dump(uint8_t argc, char **argv);
+#endif
+
+#ifdef CFG_PROBE
+void cmd_probe(uint8_t argc, char **argv);
+#endif
+
+#ifdef CFG_ISRTRACE
+void cmd_isrtrace(uint8_t argc, char **argv);
+#endif
 
 #ifdef CFG_ENABLE_I2C
 void cmd_i2c_scan(uint8_t argc, char **argv);
@@ -123,6 +136,16 @@ cli_t cli_tbl[] =
   { "mr",           1,  3,  0, cmd_dbg_memrd                              , "Memory read"                       , "'mr <addr> [<len> <size(1..8)>]'" },
   { "er",           1,  1,  0, cmd_eeprom_read                            , "EEPROM read"                       , "'er <addr>'" },
   { "ew",           2,  2,  0, cmd_eeprom_write                           , "EEPROM write"                      , "'ew <addr> <val>'" },
+  { "run",          0,  1,  0, cmd_script_run                             , "Run CLI script"                    , "'run [<eeaddr>|<file>]'" },
+  #ifdef CFG_BINLOG
+  { "lg",           0,  0,  0, cmd_binlog_dump                            , "Dump binary log"                   , CMD_NOPARAMS },
+  #endif
+  #ifdef CFG_PROBE
+  { "pr",           0,  1,  0, cmd_probe                                  , "Profiling probes"                  , "'pr [reset]'" },
+  #endif
+  #ifdef CFG_ISRTRACE
+  { "it",           0,  1,  0, cmd_isrtrace                               , "ISR tracer"                        , "'it [dump|reset]'" },
+  #endif
   #ifdef CFG_ENABLE_I2C
   { "is",           0,  0,  0, cmd_i2c_scan                               , "I2C bus scan"                      , CMD_NOPARAMS },
   { "ir",           2,  2,  0, cmd_i2c_read                               , "I2C read"                          , "'ir <addr> <len>'" },
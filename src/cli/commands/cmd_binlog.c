@@ -0,0 +1,78 @@
+/**************************************************************************/
+/*!
+    @file     cmd_binlog.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Sends the pending binary log records as hex text
+    @ingroup  CLI
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <stdio.h>
+
+#include "projectconfig.h"
+
+#if defined(CFG_INTERFACE) && defined(CFG_BINLOG)
+
+#include "cli/cli.h"
+#include "cli/commands.h"       // Generic helper functions
+#include "core/binlog/binlog.h"
+
+/**************************************************************************/
+/*!
+    Sends the pending binary log records as lines of hex text starting
+    with '~' (see tools/binlog for the host decoder), and clears them
+    from the log buffer
+*/
+/**************************************************************************/
+void cmd_binlog_dump(uint8_t argc, char **argv)
+{
+  uint8_t  block[4 * (BINLOG_HEADERWORDS + BINLOG_MAXARGS)];
+  uint16_t len, i;
+  uint32_t dropped = binlogGetDropped();
+
+  while ((len = binlogRead(block, sizeof(block))))
+  {
+    printf("~");
+    for (i = 0; i < len; i++)
+    {
+      printf("%02X", block[i]);
+    }
+    printf("%s", CFG_PRINTF_NEWLINE);
+  }
+
+  if (dropped)
+  {
+    printf("%u records dropped%s", (unsigned int) dropped, CFG_PRINTF_NEWLINE);
+  }
+}
+
+#endif
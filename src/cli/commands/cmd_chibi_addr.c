@@ -66,11 +66,13 @@ void cmd_chibi_addr(uint8_t argc, char **argv)
     if (addr <= 0 || addr > 0xFFFF)
     {
       printf("Invalid Address: 1-65534 or 0x0001-0xFFFE required.%s", CFG_PRINTF_NEWLINE);
+      cliSetError(ERROR_INVALIDPARAMETER);
       return;
     }
     if (addr == 0xFFFF)
     {
       printf("Invalid Address: 0xFFFF  reserved for broadcast.%s", CFG_PRINTF_NEWLINE);
+      cliSetError(ERROR_INVALIDPARAMETER);
       return;
     }
 
@@ -67,6 +67,7 @@ void cmd_chibi_tx(uint8_t argc, char **argv)
   if (addr32 <= 0 || addr32 > 0xFFFF)
   {
     printf("Invalid Address: 1-65534 or 0x0001-0xFFFE required.%s", CFG_PRINTF_NEWLINE);
+    cliSetError(ERROR_INVALIDPARAMETER);
     return;
   }
 
@@ -93,11 +94,14 @@ void cmd_chibi_tx(uint8_t argc, char **argv)
     {
       case CHB_NO_ACK:
         printf("ERROR: No ACK received%s", CFG_PRINTF_NEWLINE);
+        cliSetError(ERROR_CHIBI_NOACK);
         break;
       case CHB_CHANNEL_ACCESS_FAILURE:
         printf("ERROR: Channel access failure%s", CFG_PRINTF_NEWLINE);
+        cliSetError(ERROR_CHIBI_CHANACCESSFAILURE);
         break;
       default:
+        cliSetError(ERROR_CLI_COMMANDFAILED);
         break;
     }
   }
@@ -57,6 +57,7 @@ void cmd_eeprom_read(uint8_t argc, char **argv)
   if (addr32 < 0 || addr32 > CFG_EEPROM_SIZE)
   {
     printf("Address out of range%s", CFG_PRINTF_NEWLINE);
+    cliSetError(ERROR_ADDRESSOUTOFRANGE);
     return;
   }
 
@@ -70,5 +71,6 @@ void cmd_eeprom_read(uint8_t argc, char **argv)
   else
   {
     printf("Error reading EEPROM: %d%s", error, CFG_PRINTF_NEWLINE);
+    cliSetError(error);
   }
 }
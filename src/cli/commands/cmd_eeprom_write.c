@@ -59,6 +59,7 @@ void cmd_eeprom_write(uint8_t argc, char **argv)
   if (addr32 < 0 || addr32 > CFG_EEPROM_SIZE)
   {
     printf("Address out of range %s", CFG_PRINTF_NEWLINE);
+    cliSetError(ERROR_ADDRESSOUTOFRANGE);
     return;
   }
 
@@ -66,6 +67,7 @@ void cmd_eeprom_write(uint8_t argc, char **argv)
   if (addr32 <= CFG_EEPROM_RESERVED)
   {
     printf("ERROR: Reserved address (0x%04X-0x%04X)%s", 0, CFG_EEPROM_RESERVED, CFG_PRINTF_NEWLINE);
+    cliSetError(ERROR_ADDRESSOUTOFRANGE);
     return;
   }
 
@@ -77,6 +79,7 @@ void cmd_eeprom_write(uint8_t argc, char **argv)
   if (val32 < 0 || val32 > 0xFF)
   {
     printf("Invalid Data: 0-255 or 0x00-0xFF required.%s", CFG_PRINTF_NEWLINE);
+    cliSetError(ERROR_INVALIDPARAMETER);
     return;
   }
 
@@ -88,6 +91,7 @@ void cmd_eeprom_write(uint8_t argc, char **argv)
   if (error)
   {
     printf("Error reading EEPROM: %d%s", error, CFG_PRINTF_NEWLINE);
+    cliSetError(error);
   }
   else
   {
@@ -0,0 +1,103 @@
+/**************************************************************************/
+/*!
+    @file     cmd_isrtrace.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Displays the ISR tracer statistics and timeline
+    @ingroup  CLI
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <stdio.h>
+#include <string.h>
+
+#include "projectconfig.h"
+
+#if defined(CFG_INTERFACE) && defined(CFG_ISRTRACE)
+
+#include "cli/cli.h"
+#include "cli/commands.h"       // Generic helper functions
+#include "core/isrtrace/isrtrace.h"
+
+/**************************************************************************/
+/*!
+    Displays the run count, worst and mean duration (in ticks, without
+    nested handlers) and deepest nesting level of each traced IRQ.
+    'it dump' prints the event ring for tools/isrtrace, and 'it reset'
+    clears the trace
+*/
+/**************************************************************************/
+void cmd_isrtrace(uint8_t argc, char **argv)
+{
+  const isrtraceStats_t *stats;
+  isrtraceEvent_t event;
+  uint16_t i;
+
+  if (argc == 1)
+  {
+    if (!strcmp(argv[0], "reset"))
+    {
+      isrtraceReset();
+      return;
+    }
+    if (strcmp(argv[0], "dump"))
+    {
+      printf("%s%s", STRING(LOCALISATION_TEXT_Invalid_argument), CFG_PRINTF_NEWLINE);
+      cliSetError(ERROR_INVALIDPARAMETER);
+      return;
+    }
+
+    // Freeze the ring so that it isn't overwritten by the UART/USB IRQs
+    isrtraceStop();
+    printf("T clock %u%s", (unsigned int) SystemCoreClock, CFG_PRINTF_NEWLINE);
+    for (i = 0; isrtraceGetEvent(i, &event); i++)
+    {
+      printf("T %u %c %u%s", (unsigned int) event.timestamp,
+             (event.flags & ISRTRACE_FLAG_ENTER) ? 'E' : 'X',
+             event.exception, CFG_PRINTF_NEWLINE);
+    }
+    isrtraceStart();
+    return;
+  }
+
+  printf("%5s %10s %10s %10s %5s %9s%s", "IRQn", "Count", "Worst", "Mean", "Depth", "Preempted", CFG_PRINTF_NEWLINE);
+  for (i = 0; (stats = isrtraceGetStats(i)) != NULL; i++)
+  {
+    printf("%5d %10u %10u %10u %5u %9u%s", stats->exception - 16,
+           (unsigned int) stats->count, (unsigned int) stats->worst,
+           (unsigned int) (stats->count ? stats->total / stats->count : 0),
+           stats->maxDepth, stats->preempted, CFG_PRINTF_NEWLINE);
+  }
+  printf("Max depth: %u, Overwritten: %u%s", isrtraceGetMaxDepth(),
+         (unsigned int) isrtraceGetOverwritten(), CFG_PRINTF_NEWLINE);
+}
+
+#endif
@@ -0,0 +1,98 @@
+/**************************************************************************/
+/*!
+    @file     cmd_probe.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Displays the profiling probe statistics
+    @ingroup  CLI
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <stdio.h>
+#include <string.h>
+
+#include "projectconfig.h"
+
+#if defined(CFG_INTERFACE) && defined(CFG_PROBE)
+
+#include "cli/cli.h"
+#include "cli/commands.h"       // Generic helper functions
+#include "core/probe/probe.h"
+
+/**************************************************************************/
+/*!
+    Displays the count, min, mean and max tick count of each probe,
+    followed by the non-empty histogram bins ('2^n' counts the
+    measurements of 2^n to 2^(n+1)-1 ticks), or clears the statistics
+    with 'pr reset'
+*/
+/**************************************************************************/
+void cmd_probe(uint8_t argc, char **argv)
+{
+  const probe_t *probe;
+  uint8_t i, bin;
+
+  if (argc == 1)
+  {
+    if (strcmp(argv[0], "reset"))
+    {
+      printf("%s%s", STRING(LOCALISATION_TEXT_Invalid_argument), CFG_PRINTF_NEWLINE);
+      cliSetError(ERROR_INVALIDPARAMETER);
+      return;
+    }
+    probeReset();
+    return;
+  }
+
+  printf("%-16s %10s %10s %10s %10s%s", "Probe", "Count", "Min", "Mean", "Max", CFG_PRINTF_NEWLINE);
+  for (i = 0; (probe = probeGet(i)) != NULL; i++)
+  {
+    if (!probe->count)
+    {
+      printf("%-16s %10u%s", probe->name, 0, CFG_PRINTF_NEWLINE);
+      continue;
+    }
+    printf("%-16s %10u %10u %10u %10u%s", probe->name,
+           (unsigned int) probe->count, (unsigned int) probe->min,
+           (unsigned int) probeGetMean(probe), (unsigned int) probe->max,
+           CFG_PRINTF_NEWLINE);
+    for (bin = 0; bin < PROBE_HISTOGRAM_BINS; bin++)
+    {
+      if (probe->histogram[bin])
+      {
+        printf("  2^%-2u %5u", bin, probe->histogram[bin]);
+      }
+    }
+    printf("%s", CFG_PRINTF_NEWLINE);
+  }
+}
+
+#endif
@@ -42,6 +42,7 @@
 
 #if defined(CFG_RTC)
 
+#include "cli/cli.h"
 #include "cli/commands.h"
 #include "drivers/rtc/rtc.h"
 #include "drivers/rtc/pcf2129/pcf2129.h"
@@ -68,31 +69,37 @@ void cmd_rtc_write(uint8_t argc, char **argv)
   if ((year < 2000) || (year > 2038))
   {
     printf("%s%s", "Year must be between 2000 and 2023", CFG_PRINTF_NEWLINE);
+    cliSetError(ERROR_INVALIDPARAMETER);
     return;
   }
   if ((month < RTC_MONTHS_JANUARY) || (month > RTC_MONTHS_DECEMBER))
   {
     printf("%s%s", "Month must be between 1 and 12", CFG_PRINTF_NEWLINE);
+    cliSetError(ERROR_INVALIDPARAMETER);
     return;
   }
   if ((day < 1) || (day > 31))
   {
     printf("%s%s", "Day must be between 1 and 31", CFG_PRINTF_NEWLINE);
+    cliSetError(ERROR_INVALIDPARAMETER);
     return;
   }
   if ((hour < 0) || (hour > 23))
   {
     printf("%s%s", "Hour must be between 0 and 23", CFG_PRINTF_NEWLINE);
+    cliSetError(ERROR_INVALIDPARAMETER);
     return;
   }
   if ((minute < 0) || (minute > 59))
   {
     printf("%s%s", "Minute must be between 0 and 59", CFG_PRINTF_NEWLINE);
+    cliSetError(ERROR_INVALIDPARAMETER);
     return;
   }
   if ((second < 0) || (second > 59))
   {
     printf("%s%s", "Second must be between 0 and 59", CFG_PRINTF_NEWLINE);
+    cliSetError(ERROR_INVALIDPARAMETER);
     return;
   }
 
@@ -101,6 +108,7 @@ void cmd_rtc_write(uint8_t argc, char **argv)
   if (error)
   {
     printf("%s%s", "Invalid timestamp", CFG_PRINTF_NEWLINE);
+    cliSetError(error);
     return;
   }
 
@@ -109,6 +117,7 @@ void cmd_rtc_write(uint8_t argc, char **argv)
   if (error)
   {
     printf("%s%s", STRING(LOCALISATION_TEXT_No_response_on_the_I2C_bus), CFG_PRINTF_NEWLINE);
+    cliSetError(error);
     return;
   }
 }
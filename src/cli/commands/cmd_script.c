@@ -0,0 +1,137 @@
+/**************************************************************************/
+/*!
+    @file     cmd_script.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <stdio.h>
+#include <ctype.h>
+
+#include "projectconfig.h"
+
+#ifdef CFG_INTERFACE
+
+#include "cli/cli.h"
+#include "cli/cli_script.h"
+#include "cli/commands.h"       // Generic helper functions
+
+/**************************************************************************/
+/*!
+    Checks if the argument is an EEPROM address (a decimal number or a
+    hex value preceded by '0x'), rather than a file name like '1.txt'
+*/
+/**************************************************************************/
+static bool cmd_script_isAddress(const char *s)
+{
+  bool hex = false;
+
+  if ((s[0] == '0') && ((s[1] == 'x') || (s[1] == 'X')))
+  {
+    hex = true;
+    s += 2;
+  }
+
+  if (*s == '\0')
+  {
+    return false;
+  }
+
+  for ( ; *s; s++)
+  {
+    if (hex ? !isxdigit((uint8_t) *s) : !isdigit((uint8_t) *s))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    Runs a CLI script from EEPROM (default location or the supplied
+    address) or from a file on the SD card (any argument that isn't
+    entirely a number)
+*/
+/**************************************************************************/
+void cmd_script_run(uint8_t argc, char **argv)
+{
+  err_t error;
+
+  if (argc == 0)
+  {
+    // Default script location in EEPROM
+    error = cliScriptRunEEPROM(CFG_INTERFACE_SCRIPT_EEADDR, CFG_INTERFACE_SCRIPT_EESIZE, NULL);
+  }
+  else if (cmd_script_isAddress(argv[0]))
+  {
+    // Try to convert supplied address to an integer
+    int32_t addr32 = -1;
+    getNumber (argv[0], &addr32);
+
+    if (addr32 < 0 || addr32 >= CFG_EEPROM_SIZE)
+    {
+      printf("Address out of range%s", CFG_PRINTF_NEWLINE);
+      cliSetError(ERROR_ADDRESSOUTOFRANGE);
+      return;
+    }
+
+    // Scripts can run up to the end of the EEPROM
+    uint16_t size = CFG_EEPROM_SIZE - addr32;
+    error = cliScriptRunEEPROM((uint16_t) addr32, size, NULL);
+  }
+  else
+  {
+    #ifdef CFG_SDCARD
+    error = cliScriptRunFile(argv[0], NULL);
+    #else
+    printf("SD card support not enabled (CFG_SDCARD)%s", CFG_PRINTF_NEWLINE);
+    error = ERROR_INVALIDPARAMETER;
+    #endif
+  }
+
+  if (error == ERROR_CLI_SCRIPTNOTFOUND)
+  {
+    printf("No script found%s", CFG_PRINTF_NEWLINE);
+  }
+  else if (error == ERROR_CLI_SCRIPTRUNNING)
+  {
+    printf("Scripts can't be nested%s", CFG_PRINTF_NEWLINE);
+  }
+
+  if (error)
+  {
+    cliSetError(error);
+  }
+}
+
+#endif
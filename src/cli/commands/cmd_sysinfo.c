@@ -58,6 +58,20 @@
   #include "drivers/rf/802.15.4/chibi/chb_drvr.h"
 #endif
 
+#ifdef CFG_MEMINFO
+  #include "core/meminfo/meminfo.h"
+#endif
+
+#ifdef CFG_PN532
+  #include "drivers/rf/nfc/pn532/pn532.h"
+  #include "drivers/rf/nfc/pn532/mem_allocator/pn532_mem.h"
+#endif
+
+#ifdef CFG_CC3000
+  #include "drivers/rf/wifi/cc3000/spi.h"
+  #include "drivers/rf/wifi/cc3000/hostdriver/cc3000_common.h"
+#endif
+
 /**************************************************************************/
 /*!
     'sysinfo' command handler
@@ -107,6 +121,44 @@ void cmd_sysinfo(uint8_t argc, char **argv)
   /* System Uptime (based on delay timer) */
   printf("%-25s : %u %s %s", STRING(LOCALISATION_TEXT_System_Uptime), (unsigned int)delayGetSecondsActive(), STRING(LOCALISATION_SYMBOL_SECONDS), CFG_PRINTF_NEWLINE);
 
+  // RAM Usage
+  #ifdef CFG_MEMINFO
+    do
+    {
+      uint32_t stackSize = meminfoGetStackSize();
+      uint32_t stackUsed = meminfoGetStackUsed();
+      /* RAM left for the stack after .data and .bss */
+      printf("%-25s : %u %s %s", STRING(LOCALISATION_TEXT_Stack_Size), (unsigned int)stackSize, STRING(LOCALISATION_TEXT_bytes), CFG_PRINTF_NEWLINE);
+      /* Deepest stack use since reset */
+      printf("%-25s : %u %s (%u%%) %s", STRING(LOCALISATION_TEXT_Stack_Used), (unsigned int)stackUsed, STRING(LOCALISATION_TEXT_bytes),
+             stackSize ? (unsigned int)((stackUsed * 100) / stackSize) : 0, CFG_PRINTF_NEWLINE);
+    } while(0);
+  #endif
+
+  #ifdef CFG_PN532
+    do
+    {
+      pn532_mem_stats_t pool;
+      pn532_mem_getStats(&pool);
+      /* Used/size, peak use, largest free block and fragmentation of the bget pool */
+      printf("%-25s : %u/%u %s (max %u, largest free %u, %u%% fragmented) %s", STRING(LOCALISATION_TEXT_PN532_Memory_Pool),
+             (unsigned int)pool.used, (unsigned int)pool.size, STRING(LOCALISATION_TEXT_bytes),
+             (unsigned int)pool.peak, (unsigned int)pool.largestFree,
+             pool.fragmentation, CFG_PRINTF_NEWLINE);
+    } while(0);
+  #endif
+
+  #ifdef CFG_CC3000
+    do
+    {
+      unsigned short txPeak, rxPeak;
+      SpiGetBufferUsage(&txPeak, &rxPeak);
+      /* Largest packet/buffer size */
+      printf("%-25s : %u/%u %s %s", STRING(LOCALISATION_TEXT_CC3000_TX_Buffer), txPeak, CC3000_TX_BUFFER_SIZE, STRING(LOCALISATION_TEXT_bytes), CFG_PRINTF_NEWLINE);
+      printf("%-25s : %u/%u %s %s", STRING(LOCALISATION_TEXT_CC3000_RX_Buffer), rxPeak, CC3000_RX_BUFFER_SIZE, STRING(LOCALISATION_TEXT_bytes), CFG_PRINTF_NEWLINE);
+    } while(0);
+  #endif
+
   /* Wireless Settings (if CFG_CHIBI enabled) */
   #ifdef CFG_CHIBI
     do
@@ -0,0 +1,295 @@
+/**************************************************************************/
+/*!
+    @file     binlog.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Deferred binary logging
+
+    @ingroup  Errors
+
+    With CFG_BINLOG defined, LOG (log.h), the ASSERT messages
+    (asserts.h) and BINLOG don't format anything on the device.  Each
+    call writes a record to a RAM buffer instead:
+
+    @code
+    word 0    0xB | arg count (4 bits) | format string ID (24 bits)
+    word 1    Timestamp (delayGetTicks, in ms)
+    word 2..  Arguments, one 32-bit word each
+    @endcode
+
+    The format strings are placed in the .logstr section, which is only
+    stored in the ELF file, and the ID of a string is its offset in that
+    section.  The records are taken out of the buffer with binlogRead
+    (or the 'lg' CLI command), and tools/binlog/binlog.py decodes them on
+    the host using the ELF file of the firmware.
+
+    A typical LOG call takes 12-20 bytes instead of 40-80 bytes of text,
+    and the call site only copies a few words, so logging can be left on
+    in timing sensitive code.
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include "projectconfig.h"
+
+#ifdef CFG_BINLOG
+
+#include <string.h>
+#include "binlog.h"
+#include "core/delay/delay.h"
+
+#define BINLOG_WORDS (CFG_BINLOG_BUFFERSIZE / 4)
+
+STATIC_ASSERT((CFG_BINLOG_BUFFERSIZE % 4) == 0);
+STATIC_ASSERT(BINLOG_WORDS >= BINLOG_HEADERWORDS + BINLOG_MAXARGS);
+STATIC_ASSERT(BINLOG_WORDS <= 0xFFFF);
+
+/* Global, so that the buffer can also be found in a RAM dump */
+volatile uint32_t binlog_buffer[BINLOG_WORDS];
+
+static volatile uint16_t binlog_head;     // Next word to write
+static volatile uint16_t binlog_tail;     // Next word to read
+static volatile uint16_t binlog_used;     // Number of words in use
+static volatile uint32_t binlog_dropped;  // Number of records lost
+
+/**************************************************************************/
+/*!
+    @brief  Disables interrupts (records can be written from interrupt
+            handlers) and returns the previous state
+*/
+/**************************************************************************/
+static inline uint32_t binlogLock(void)
+{
+  #ifndef _TEST_
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  return primask;
+  #else
+  return 0;
+  #endif
+}
+
+/**************************************************************************/
+/*!
+    @brief  Restores the interrupt state saved by binlogLock
+*/
+/**************************************************************************/
+static inline void binlogUnlock(uint32_t primask)
+{
+  #ifndef _TEST_
+  __set_PRIMASK(primask);
+  #else
+  (void) primask;
+  #endif
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the number of words in the record starting at the
+            specified position in the buffer
+*/
+/**************************************************************************/
+static inline uint16_t binlogRecordWords(uint16_t idx)
+{
+  return BINLOG_HEADERWORDS + ((binlog_buffer[idx] >> BINLOG_COUNT_SHIFT) & BINLOG_COUNT_MASK);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Clears the log buffer and the dropped record count
+*/
+/**************************************************************************/
+void binlogInit(void)
+{
+  uint32_t primask = binlogLock();
+
+  binlog_head = binlog_tail = binlog_used = 0;
+  binlog_dropped = 0;
+
+  binlogUnlock(primask);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Writes a record to the log buffer (normally called via the
+            BINLOG macro)
+
+    @param[in]  id
+                Address of the format string in the .logstr section
+    @param[in]  count
+                Number of arguments (up to BINLOG_MAXARGS)
+    @param[in]  args
+                Arguments, already converted to 32-bit words
+
+    If the buffer is full, the record is dropped (or the oldest records
+    are dropped with CFG_BINLOG_OVERWRITE), and binlogGetDropped is
+    incremented.
+*/
+/**************************************************************************/
+void binlogWrite(uint32_t id, uint32_t count, const uint32_t *args)
+{
+  uint32_t timestamp = delayGetTicks();
+  uint32_t primask;
+  uint16_t words, idx;
+
+  if (count > BINLOG_MAXARGS)
+  {
+    count = BINLOG_MAXARGS;
+  }
+  words = BINLOG_HEADERWORDS + count;
+
+  primask = binlogLock();
+
+  if (BINLOG_WORDS - binlog_used < words)
+  {
+    #if CFG_BINLOG_OVERWRITE == 1
+    // Drop whole records from the start of the buffer
+    while (BINLOG_WORDS - binlog_used < words)
+    {
+      uint16_t skip = binlogRecordWords(binlog_tail);
+      binlog_tail = (binlog_tail + skip) % BINLOG_WORDS;
+      binlog_used -= skip;
+      binlog_dropped++;
+    }
+    #else
+    binlog_dropped++;
+    binlogUnlock(primask);
+    return;
+    #endif
+  }
+
+  idx = binlog_head;
+  binlog_buffer[idx] = BINLOG_MARKER | (count << BINLOG_COUNT_SHIFT) | (id & BINLOG_ID_MASK);
+  if (++idx == BINLOG_WORDS) idx = 0;
+  binlog_buffer[idx] = timestamp;
+  if (++idx == BINLOG_WORDS) idx = 0;
+  while (count--)
+  {
+    binlog_buffer[idx] = *args++;
+    if (++idx == BINLOG_WORDS) idx = 0;
+  }
+
+  binlog_head = idx;
+  binlog_used += words;
+
+  binlogUnlock(primask);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Moves as many whole records as will fit from the log buffer
+            into the supplied buffer (32-bit little-endian words)
+
+    @param[out] buffer
+                Destination buffer
+    @param[in]  len
+                Size of the destination buffer in bytes (at least
+                4 * (BINLOG_HEADERWORDS + BINLOG_MAXARGS) bytes to be sure
+                that any record fits)
+
+    @returns    The number of bytes copied
+
+    @code
+    uint8_t  block[64];
+    uint16_t len;
+
+    // Send the pending records to the host
+    while ((len = binlogRead(block, sizeof(block))))
+    {
+      usb_cdc_send(block, len);
+    }
+    @endcode
+*/
+/**************************************************************************/
+uint16_t binlogRead(uint8_t *buffer, uint16_t len)
+{
+  uint16_t copied = 0;
+  uint16_t words, idx;
+  uint32_t primask, word;
+
+  while (1)
+  {
+    // Interrupts are only disabled while one record is copied
+    primask = binlogLock();
+
+    if (binlog_used == 0)
+    {
+      binlogUnlock(primask);
+      break;
+    }
+
+    idx = binlog_tail;
+    words = binlogRecordWords(idx);
+    if (copied + words * 4 > len)
+    {
+      binlogUnlock(primask);
+      break;
+    }
+
+    binlog_used -= words;
+    while (words--)
+    {
+      word = binlog_buffer[idx];
+      if (++idx == BINLOG_WORDS) idx = 0;
+      buffer[copied++] = (uint8_t) word;
+      buffer[copied++] = (uint8_t) (word >> 8);
+      buffer[copied++] = (uint8_t) (word >> 16);
+      buffer[copied++] = (uint8_t) (word >> 24);
+    }
+    binlog_tail = idx;
+
+    binlogUnlock(primask);
+  }
+
+  return copied;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the number of bytes waiting in the log buffer
+*/
+/**************************************************************************/
+uint16_t binlogPending(void)
+{
+  return binlog_used * 4;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the number of records that were dropped because the
+            log buffer was full
+*/
+/**************************************************************************/
+uint32_t binlogGetDropped(void)
+{
+  return binlog_dropped;
+}
+
+#endif
@@ -0,0 +1,153 @@
+/**************************************************************************/
+/*!
+    @file     binlog.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Deferred binary logging (see binlog.c)
+    @ingroup  Errors
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef _BINLOG_H_
+#define _BINLOG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* A record is made of 32-bit words: a header (format ID, number of
+   arguments and a sync marker), a timestamp, then one word per argument */
+#define BINLOG_MARKER           (0xB0000000)
+#define BINLOG_MARKER_MASK      (0xF0000000)
+#define BINLOG_ID_MASK          (0x00FFFFFF)
+#define BINLOG_COUNT_SHIFT      (24)
+#define BINLOG_COUNT_MASK       (0x0F)
+#define BINLOG_MAXARGS          (12)
+#define BINLOG_HEADERWORDS      (2)
+
+/* Section holding the format strings.  It isn't loaded into flash (see the
+   INFO section in the linker scripts), so the address of a string is its
+   offset in the section, and is used as its ID */
+#define BINLOG_SECTION          ".logstr"
+
+/**************************************************************************/
+/*!
+    @brief  Writes a log record with the specified format string and
+            arguments, without formatting anything on the device
+
+    @details
+    The format string must be a literal, and is only stored in the ELF
+    file.  Each argument is stored as a raw 32-bit word: integers and
+    pointers as they are, floats and doubles as single-precision floats.
+    '%s' arguments are stored as a pointer, and the host tool reads the
+    string from the ELF file, so they must point to constant strings (ex.
+    __func__ or a literal).  64-bit integers and bit-fields aren't
+    supported.  Up to BINLOG_MAXARGS arguments can be logged.
+
+    @code
+    BINLOG("ADC%d = %d (%f V)", channel, raw, raw * 3.3F / 1023);
+    @endcode
+*/
+/**************************************************************************/
+#define BINLOG(format, ...) \
+        do{\
+          static const char _binlogFormat[] __attribute__ ((section(BINLOG_SECTION), used)) = format;\
+          const uint32_t _binlogArgs[] = { BINLOG_ARGS(__VA_ARGS__) };\
+          binlogWrite((uint32_t)(uintptr_t) _binlogFormat, sizeof(_binlogArgs) / sizeof(uint32_t), _binlogArgs);\
+        } while(0)
+
+/* Converts one argument to a 32-bit word.  Both branches of
+   __builtin_choose_expr must compile, so the argument is replaced by a
+   constant in the branch that isn't used */
+#define BINLOG_ISFLOAT(x) \
+        (__builtin_types_compatible_p(__typeof__(x), float) || \
+         __builtin_types_compatible_p(__typeof__(x), double))
+#define BINLOG_ARG(x) \
+        __builtin_choose_expr(BINLOG_ISFLOAT(x), \
+          binlogFloat(__builtin_choose_expr(BINLOG_ISFLOAT(x), (x), 0.0F)), \
+          (uint32_t)(uintptr_t) __builtin_choose_expr(BINLOG_ISFLOAT(x), 0, (x)))
+
+/* Applies BINLOG_ARG to each of up to BINLOG_MAXARGS arguments */
+#define BINLOG_CONCAT(a, b)     a##b
+#define BINLOG_XCONCAT(a, b)    BINLOG_CONCAT(a, b)
+#define BINLOG_NARGS(...)       BINLOG_NARGS_(0, ##__VA_ARGS__, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define BINLOG_NARGS_(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, n, ...) n
+#define BINLOG_ARGS(...)        BINLOG_XCONCAT(BINLOG_ARGS_, BINLOG_NARGS(__VA_ARGS__))(__VA_ARGS__)
+#define BINLOG_ARGS_0()
+#define BINLOG_ARGS_1(a)        BINLOG_ARG(a)
+#define BINLOG_ARGS_2(a, ...)   BINLOG_ARG(a), BINLOG_ARGS_1(__VA_ARGS__)
+#define BINLOG_ARGS_3(a, ...)   BINLOG_ARG(a), BINLOG_ARGS_2(__VA_ARGS__)
+#define BINLOG_ARGS_4(a, ...)   BINLOG_ARG(a), BINLOG_ARGS_3(__VA_ARGS__)
+#define BINLOG_ARGS_5(a, ...)   BINLOG_ARG(a), BINLOG_ARGS_4(__VA_ARGS__)
+#define BINLOG_ARGS_6(a, ...)   BINLOG_ARG(a), BINLOG_ARGS_5(__VA_ARGS__)
+#define BINLOG_ARGS_7(a, ...)   BINLOG_ARG(a), BINLOG_ARGS_6(__VA_ARGS__)
+#define BINLOG_ARGS_8(a, ...)   BINLOG_ARG(a), BINLOG_ARGS_7(__VA_ARGS__)
+#define BINLOG_ARGS_9(a, ...)   BINLOG_ARG(a), BINLOG_ARGS_8(__VA_ARGS__)
+#define BINLOG_ARGS_10(a, ...)  BINLOG_ARG(a), BINLOG_ARGS_9(__VA_ARGS__)
+#define BINLOG_ARGS_11(a, ...)  BINLOG_ARG(a), BINLOG_ARGS_10(__VA_ARGS__)
+#define BINLOG_ARGS_12(a, ...)  BINLOG_ARG(a), BINLOG_ARGS_11(__VA_ARGS__)
+
+/* ASSERT messages (asserts.h) are logged as binary records as well */
+#if defined DEBUG
+  #undef  _PRINTF
+  #define _PRINTF(...)          BINLOG(__VA_ARGS__)
+#endif
+
+/**************************************************************************/
+/*!
+    @brief  Returns the bits of a float as a 32-bit word
+*/
+/**************************************************************************/
+static inline uint32_t binlogFloat(float value)
+{
+  union
+  {
+    float    f;
+    uint32_t u;
+  } bits;
+
+  bits.f = value;
+  return bits.u;
+}
+
+void     binlogInit(void);
+void     binlogWrite(uint32_t id, uint32_t count, const uint32_t *args);
+uint16_t binlogRead(uint8_t *buffer, uint16_t len);
+uint16_t binlogPending(void);
+uint32_t binlogGetDropped(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -36,6 +36,7 @@
 #include "projectconfig.h"
 
 #include "delay.h"
+#include "core/isrtrace/isrtrace.h"
 
 /* RTX claims systick so we need to use TIMER16[0] instead */
 #define DELAY_USE_TIMER16_0      (1)
@@ -62,6 +63,8 @@ void CT16B0_IRQHandler(void)
   #error "timer16.c: No MCU defined"
 #endif
 {
+  ISRTRACE_ENTER();
+
   LPC_CT16B0->IR = 0x1 << 0;  /* Clear MAT0 */
 
   delayTicks++;
@@ -76,6 +79,7 @@ void CT16B0_IRQHandler(void)
   }
   #endif
 
+  ISRTRACE_EXIT();
   return;
 }
 #else
@@ -86,6 +90,8 @@ void CT16B0_IRQHandler(void)
 /**************************************************************************/
 void SysTick_Handler (void)
 {
+  ISRTRACE_ENTER();
+
   delayTicks++;
   if (delayTicks == 0) delayRollovers++;
 
@@ -98,6 +104,7 @@ void SysTick_Handler (void)
   }
   #endif
 
+  ISRTRACE_EXIT();
   return;
 }
 #endif
@@ -67,6 +67,18 @@ extern "C" {
                                        DWT->CYCCNT = 0;                                   \
                                        DWT->CTRL = DWT->CTRL | 1 ; } while(0)
 
+// Macro to enable the cycle counter without resetting it, so that it
+// can be shared (the profiling probes in core/probe, for example).
+// Timings are then taken as the difference between two readings:
+//
+//    DWT_ENABLE_CYCLECOUNTER;
+//    uint32_t start = DWT->CYCCNT;
+//    ... do something
+//    uint32_t count = DWT->CYCCNT - start;
+
+#define DWT_ENABLE_CYCLECOUNTER   do { CoreDebug->DEMCR = CoreDebug->DEMCR | 0x01000000;  \
+                                       DWT->CTRL = DWT->CTRL | 1 ; } while(0)
+
 /* Inline Functions */
 static INLINE void dwtDelay(uint32_t ticks) INLINE_POST;
 
@@ -88,8 +100,9 @@ static INLINE void dwtDelay(uint32_t ticks) INLINE_POST;
     // Test DWT delay
     uint32_t usec = 3;
     uint32_t ticks = (SystemCoreClock / 1000000) * usec;
-    dwtDelay(ticks);                      // Delay (stays low)
-    uint32_t oh = DWT->CYCCNT - ticks;    // Calculate function overhead
+    uint32_t start = DWT->CYCCNT;
+    dwtDelay(ticks);                              // Delay (stays low)
+    uint32_t oh = DWT->CYCCNT - start - ticks;    // Calculate function overhead
 
     @endcode
 */
@@ -102,9 +115,11 @@ static INLINE void dwtDelay(uint32_t ticks)
   // and LPC1347 ... but a less chip-dependent solution should be
   // implemented that also works with the LPC11U37 and LPC11U24.
 
-  // Reset the cycle counter to 0 (good for up to 59 seconds @ 72MHz)
-  DWT_RESET_CYCLECOUNTER;
-  while (DWT->CYCCNT < ticks)
+  // The cycle counter isn't reset, so that it can also be used by the
+  // profiling probes (good for up to 59 seconds @ 72MHz)
+  DWT_ENABLE_CYCLECOUNTER;
+  uint32_t start = DWT->CYCCNT;
+  while (DWT->CYCCNT - start < ticks)
   {
     __asm volatile ("NOP");
   }
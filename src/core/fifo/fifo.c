@@ -208,6 +208,70 @@ bool fifo_write(fifo_t* f, void const * p_data)
   return true;
 }
 
+/**************************************************************************/
+/*!
+    @brief Write an array of items into the FIFO
+
+    All items that fit are copied in at most two blocks while the FIFO
+    is locked, rather than locking and copying once per item as with
+    fifo_write.
+
+    @param[in]  f
+                Pointer to the FIFO buffer to manipulate
+    @param[in]  p_data
+                Pointer to the items to add to the FIFO
+    @param[in]  len
+                The number of items to write
+
+    @returns The actual number of items written to the FIFO.  This can be
+             less than 'len' if a non-overwritable FIFO is full
+*/
+/**************************************************************************/
+uint16_t fifo_writeArray(fifo_t* f, void const * p_data, uint16_t len)
+{
+  uint16_t count, first;
+
+  if ( !is_fifo_initalized(f) || (len == 0) )
+  {
+    return 0;
+  }
+
+  if (f->overwritable)
+  {
+    // Overwriting moves the read pointer as well, keep this simple
+    for (count = 0; count < len; count++)
+    {
+      fifo_write(f, p_data + (count * f->item_size));
+    }
+    return len;
+  }
+
+  mutex_lock(f);
+
+  count = f->depth - f->count;
+  if (len < count)
+  {
+    count = len;
+  }
+
+  // Copy up to the end of the buffer, then wrap around to the start
+  first = f->depth - f->wr_idx;
+  if (first > count)
+  {
+    first = count;
+  }
+
+  memcpy(f->buffer + (f->wr_idx * f->item_size), p_data, first * f->item_size);
+  memcpy(f->buffer, p_data + (first * f->item_size), (count - first) * f->item_size);
+
+  f->wr_idx = (f->wr_idx + count) % f->depth;
+  f->count += count;
+
+  mutex_unlock(f);
+
+  return count;
+}
+
 /**************************************************************************/
 /*!
     @brief Clear the fifo read and write pointers and set length to zero
@@ -69,6 +69,7 @@ bool fifo_write(fifo_t* f, void const * p_data);
 bool fifo_read(fifo_t* f, void * p_buffer);
 bool fifo_peek(fifo_t* f, uint16_t position, void * p_buffer);
 uint16_t fifo_readArray(fifo_t* f, void * p_buffer, uint16_t maxlen);
+uint16_t fifo_writeArray(fifo_t* f, void const * p_data, uint16_t len);
 void fifo_clear(fifo_t *f);
 
 static inline bool fifo_isEmpty(fifo_t* f) INLINE_POST;
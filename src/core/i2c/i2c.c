@@ -18,6 +18,7 @@
 #ifdef CFG_ENABLE_I2C
 
 #include "i2c.h"
+#include "core/isrtrace/isrtrace.h"
 
 volatile uint32_t I2CMasterState = I2CSTATE_IDLE;
 volatile uint32_t I2CSlaveState = I2CSTATE_IDLE;
@@ -46,6 +47,8 @@ void I2C_IRQHandler(void)
 {
         uint8_t StatValue;
 
+        ISRTRACE_ENTER();
+
         /* this handler deals with master read and master write only */
         StatValue = LPC_I2C->STAT;
         switch ( StatValue )
@@ -214,6 +217,7 @@ void I2C_IRQHandler(void)
                 LPC_I2C->CONCLR = I2CONCLR_SIC;
                 break;
   }
+  ISRTRACE_EXIT();
   return;
 }
 
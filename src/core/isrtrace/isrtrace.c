@@ -0,0 +1,440 @@
+/**************************************************************************/
+/*!
+    @file     isrtrace.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Records the entry and exit time of the interrupt handlers
+              in a ring buffer, and keeps the worst-case duration and
+              nesting level of each one
+
+    Each instrumented handler starts with ISRTRACE_ENTER() and calls
+    ISRTRACE_EXIT() before it returns.  The exception number is read from
+    IPSR, so the same two macros are used everywhere.  Timestamps come
+    from the tick counter shared with core/probe (the DWT cycle counter
+    on the LPC13U, a 32-bit timer on the LPC11U).
+
+    Durations are exclusive: the time spent in nested (higher priority)
+    handlers is subtracted from the handler that was preempted, so the
+    worst case of each handler can be compared directly.
+
+    The ring keeps the last CFG_ISRTRACE_EVENTS entries/exits and
+    overwrites the oldest ones when full.  The 'it dump' CLI command
+    prints them, and tools/isrtrace converts the output to a timeline
+    that can be opened in chrome://tracing.
+
+    @code
+    void TIMER32_0_IRQHandler(void)
+    {
+      ISRTRACE_ENTER();
+      ...
+      ISRTRACE_EXIT();
+    }
+    @endcode
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include "projectconfig.h"
+
+#ifdef CFG_ISRTRACE
+
+#include <string.h>
+#include "isrtrace.h"
+#include "core/probe/probe.h"
+
+typedef struct
+{
+  uint8_t  exception;
+  bool     preempted;
+  uint32_t start;
+  uint32_t nested;          /* Ticks spent in nested handlers */
+} isrtraceFrame_t;
+
+static isrtraceEvent_t isrtrace_events[CFG_ISRTRACE_EVENTS];
+static uint16_t        isrtrace_head;
+static uint16_t        isrtrace_count;
+static uint32_t        isrtrace_overwritten;
+static bool            isrtrace_running;
+
+static isrtraceStats_t isrtrace_stats[CFG_ISRTRACE_MAXIRQS];
+static uint8_t         isrtrace_irqcount;
+
+static isrtraceFrame_t isrtrace_stack[ISRTRACE_MAXDEPTH];
+static uint8_t         isrtrace_depth;
+static uint8_t         isrtrace_maxdepth;
+
+/**************************************************************************/
+/*!
+    @brief  Disables interrupts and returns the previous state
+*/
+/**************************************************************************/
+static inline uint32_t isrtraceLock(void)
+{
+  #ifndef _TEST_
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  return primask;
+  #else
+  return 0;
+  #endif
+}
+
+/**************************************************************************/
+/*!
+    @brief  Restores the interrupt state saved by isrtraceLock
+*/
+/**************************************************************************/
+static inline void isrtraceUnlock(uint32_t primask)
+{
+  #ifndef _TEST_
+  __set_PRIMASK(primask);
+  #else
+  (void) primask;
+  #endif
+}
+
+/**************************************************************************/
+/*!
+    @brief  Adds an event to the ring, overwriting the oldest one if it
+            is full (interrupts must be disabled)
+*/
+/**************************************************************************/
+static void isrtraceLog(uint32_t timestamp, uint8_t exception, uint8_t flags)
+{
+  isrtraceEvent_t *event;
+
+  if (!isrtrace_running)
+  {
+    return;
+  }
+
+  event = &isrtrace_events[isrtrace_head];
+  event->timestamp = timestamp;
+  event->exception = exception;
+  event->flags     = flags;
+
+  isrtrace_head = (isrtrace_head + 1) % CFG_ISRTRACE_EVENTS;
+  if (isrtrace_count < CFG_ISRTRACE_EVENTS)
+  {
+    isrtrace_count++;
+  }
+  else
+  {
+    isrtrace_overwritten++;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the statistics slot of an exception number, and
+            assigns a new one the first time it is seen
+
+    @returns    The slot, or NULL if all CFG_ISRTRACE_MAXIRQS slots are
+                in use
+*/
+/**************************************************************************/
+static isrtraceStats_t *isrtraceFindStats(uint8_t exception)
+{
+  isrtraceStats_t *stats;
+  uint8_t i;
+
+  for (i = 0; i < isrtrace_irqcount; i++)
+  {
+    if (isrtrace_stats[i].exception == exception)
+    {
+      return &isrtrace_stats[i];
+    }
+  }
+
+  if (isrtrace_irqcount == CFG_ISRTRACE_MAXIRQS)
+  {
+    return NULL;
+  }
+
+  stats = &isrtrace_stats[isrtrace_irqcount++];
+  memset(stats, 0, sizeof(isrtraceStats_t));
+  stats->exception = exception;
+
+  return stats;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Starts the tick counter, clears the trace and starts
+            recording
+*/
+/**************************************************************************/
+void isrtraceInit(void)
+{
+  probeTicksInit();
+
+  isrtrace_depth = 0;
+  isrtraceReset();
+  isrtraceStart();
+}
+
+/**************************************************************************/
+/*!
+    @brief  Starts (or resumes) adding events to the ring
+*/
+/**************************************************************************/
+void isrtraceStart(void)
+{
+  isrtrace_running = true;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Freezes the ring so that it can be read out.  The per-IRQ
+            statistics are still updated
+*/
+/**************************************************************************/
+void isrtraceStop(void)
+{
+  isrtrace_running = false;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Clears the ring and the statistics.  Handlers that are
+            currently running are still tracked
+*/
+/**************************************************************************/
+void isrtraceReset(void)
+{
+  uint32_t primask = isrtraceLock();
+
+  isrtrace_head        = 0;
+  isrtrace_count       = 0;
+  isrtrace_overwritten = 0;
+  isrtrace_irqcount    = 0;
+  isrtrace_maxdepth    = 0;
+
+  isrtraceUnlock(primask);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Records the start of an interrupt handler (normally called
+            by ISRTRACE_ENTER)
+
+    @param[in]  exception
+                Exception number of the handler (16 + IRQn)
+*/
+/**************************************************************************/
+void isrtraceEnter(uint8_t exception)
+{
+  uint32_t primask = isrtraceLock();
+  uint32_t now = probeGetTicks();
+  isrtraceFrame_t *frame;
+
+  if (isrtrace_depth > 0 && isrtrace_depth <= ISRTRACE_MAXDEPTH)
+  {
+    isrtrace_stack[isrtrace_depth - 1].preempted = true;
+  }
+
+  if (isrtrace_depth < ISRTRACE_MAXDEPTH)
+  {
+    frame = &isrtrace_stack[isrtrace_depth];
+    frame->exception = exception;
+    frame->preempted = false;
+    frame->start     = now;
+    frame->nested    = 0;
+  }
+
+  if (isrtrace_depth < ISRTRACE_DEPTH_MASK)
+  {
+    isrtrace_depth++;
+  }
+  if (isrtrace_depth > isrtrace_maxdepth)
+  {
+    isrtrace_maxdepth = isrtrace_depth;
+  }
+
+  isrtraceLog(now, exception, ISRTRACE_FLAG_ENTER | isrtrace_depth);
+
+  isrtraceUnlock(primask);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Records the end of an interrupt handler (normally called by
+            ISRTRACE_EXIT), and updates its statistics.  Exits without
+            a matching entry are ignored, and nested handlers that never
+            called ISRTRACE_EXIT are dropped
+
+    @param[in]  exception
+                Exception number of the handler (16 + IRQn)
+*/
+/**************************************************************************/
+void isrtraceExit(uint8_t exception)
+{
+  uint32_t primask = isrtraceLock();
+  uint32_t now = probeGetTicks();
+  uint32_t elapsed, self;
+  isrtraceFrame_t *frame;
+  isrtraceStats_t *stats;
+  uint8_t match;
+
+  if (isrtrace_depth == 0)
+  {
+    isrtraceUnlock(primask);
+    return;
+  }
+
+  // Deeper than the stack: only the timeline is recorded
+  if (isrtrace_depth <= ISRTRACE_MAXDEPTH)
+  {
+    // Find the matching entry.  Handlers above it returned without
+    // calling ISRTRACE_EXIT, so their frames are dropped
+    match = isrtrace_depth;
+    while (match > 0 && isrtrace_stack[match - 1].exception != exception)
+    {
+      match--;
+    }
+    if (match == 0)
+    {
+      // Entry wasn't traced (ex. the tracer was started in a handler)
+      isrtraceUnlock(primask);
+      return;
+    }
+    isrtrace_depth = match;
+
+    frame = &isrtrace_stack[isrtrace_depth - 1];
+
+    elapsed = now - frame->start;
+    self    = elapsed - frame->nested;
+
+    stats = isrtraceFindStats(exception);
+    if (stats)
+    {
+      stats->count++;
+      stats->total += self;
+      if (self > stats->worst) stats->worst = self;
+      if (isrtrace_depth > stats->maxDepth) stats->maxDepth = isrtrace_depth;
+      if (frame->preempted && stats->preempted != 0xFFFF) stats->preempted++;
+    }
+
+    if (isrtrace_depth > 1)
+    {
+      isrtrace_stack[isrtrace_depth - 2].nested += elapsed;
+    }
+  }
+
+  isrtraceLog(now, exception, isrtrace_depth);
+  isrtrace_depth--;
+
+  isrtraceUnlock(primask);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the number of events in the ring
+*/
+/**************************************************************************/
+uint16_t isrtraceGetEventCount(void)
+{
+  return isrtrace_count;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Copies an event from the ring
+
+    @param[in]  index
+                Position in the ring, 0 being the oldest event
+    @param[out] event
+                Copy of the event
+
+    @returns    false if the index is out of range
+*/
+/**************************************************************************/
+bool isrtraceGetEvent(uint16_t index, isrtraceEvent_t *event)
+{
+  uint32_t primask;
+  bool     found = false;
+
+  primask = isrtraceLock();
+
+  if (index < isrtrace_count)
+  {
+    index = (isrtrace_head + CFG_ISRTRACE_EVENTS - isrtrace_count + index) % CFG_ISRTRACE_EVENTS;
+    *event = isrtrace_events[index];
+    found = true;
+  }
+
+  isrtraceUnlock(primask);
+
+  return found;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the number of events lost because the ring was full
+*/
+/**************************************************************************/
+uint32_t isrtraceGetOverwritten(void)
+{
+  return isrtrace_overwritten;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the deepest handler nesting level seen since the last
+            reset (1 = no nesting)
+*/
+/**************************************************************************/
+uint8_t isrtraceGetMaxDepth(void)
+{
+  return isrtrace_maxdepth;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the number of exception numbers with statistics
+*/
+/**************************************************************************/
+uint8_t isrtraceGetIrqCount(void)
+{
+  return isrtrace_irqcount;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the statistics at the specified position, or NULL if
+            the index is out of range
+*/
+/**************************************************************************/
+const isrtraceStats_t *isrtraceGetStats(uint8_t index)
+{
+  return (index < isrtrace_irqcount) ? &isrtrace_stats[index] : NULL;
+}
+
+#endif
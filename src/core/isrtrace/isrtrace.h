@@ -0,0 +1,123 @@
+/**************************************************************************/
+/*!
+    @file     isrtrace.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Interrupt handler tracer (see isrtrace.c)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef _ISRTRACE_H_
+#define _ISRTRACE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "projectconfig.h"
+
+/* Max nesting level that is tracked (the LPC13U has 8 priority levels) */
+#define ISRTRACE_MAXDEPTH       (8)
+
+/* isrtraceEvent_t.flags: bit 7 set for the handler entry, bits 0..6 hold
+   the nesting level (1 = not nested) */
+#define ISRTRACE_FLAG_ENTER     (0x80)
+#define ISRTRACE_DEPTH_MASK     (0x7F)
+
+/**************************************************************************/
+/*!
+    @brief  One handler entry or exit in the timeline
+*/
+/**************************************************************************/
+typedef struct
+{
+  uint32_t timestamp;       /**< Ticks, see probeGetTicks */
+  uint8_t  exception;       /**< Exception number (16 + IRQn) */
+  uint8_t  flags;           /**< ISRTRACE_FLAG_ENTER and nesting level */
+} isrtraceEvent_t;
+
+/**************************************************************************/
+/*!
+    @brief  Statistics for one exception number
+*/
+/**************************************************************************/
+typedef struct
+{
+  uint8_t  exception;       /**< Exception number (16 + IRQn) */
+  uint8_t  maxDepth;        /**< Deepest nesting level the handler ran at */
+  uint16_t preempted;       /**< Runs interrupted by a nested handler (saturates) */
+  uint32_t count;           /**< Number of completed runs */
+  uint32_t worst;           /**< Longest run, in ticks, without nested handlers */
+  uint64_t total;           /**< Sum of all runs, for the mean */
+} isrtraceStats_t;
+
+#ifdef CFG_ISRTRACE
+
+/**************************************************************************/
+/*!
+    @brief  Records the entry/exit of the current interrupt handler.
+            ISRTRACE_ENTER must be the first statement of the handler,
+            and ISRTRACE_EXIT must run before every return
+*/
+/**************************************************************************/
+#ifdef _TEST_
+  #define ISRTRACE_ENTER()
+  #define ISRTRACE_EXIT()
+#else
+  #define ISRTRACE_ENTER()      isrtraceEnter(__get_IPSR())
+  #define ISRTRACE_EXIT()       isrtraceExit(__get_IPSR())
+#endif
+
+void                   isrtraceInit(void);
+void                   isrtraceStart(void);
+void                   isrtraceStop(void);
+void                   isrtraceReset(void);
+void                   isrtraceEnter(uint8_t exception);
+void                   isrtraceExit(uint8_t exception);
+uint16_t               isrtraceGetEventCount(void);
+bool                   isrtraceGetEvent(uint16_t index, isrtraceEvent_t *event);
+uint32_t               isrtraceGetOverwritten(void);
+uint8_t                isrtraceGetMaxDepth(void);
+uint8_t                isrtraceGetIrqCount(void);
+const isrtraceStats_t *isrtraceGetStats(uint8_t index);
+
+#else
+
+#define ISRTRACE_ENTER()
+#define ISRTRACE_EXIT()
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
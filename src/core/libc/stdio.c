@@ -39,9 +39,13 @@
 #include <stdio.h>
 #include <stdarg.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "projectconfig.h" // For CFG_PRINTF_MAXSTRINGSIZE
 
+// Maximum number of digits after the decimal point for %f, %e and %E
+#define STDIO_FLOAT_MAXPRECISION (9)
+
 //------------------------------------------------------------------------------
 //         Global Variables
 //------------------------------------------------------------------------------
@@ -59,7 +63,7 @@
 // \param pStr  Storage string.
 // \param c  Character to write.
 //------------------------------------------------------------------------------
-signed int append_char(char *pStr, char c)
+static signed int append_char(char *pStr, char c)
 {
     *pStr = c;
     return 1;
@@ -72,7 +76,7 @@ signed int append_char(char *pStr, char c)
 // \param pStr  Storage string.
 // \param pSource  Source string.
 //------------------------------------------------------------------------------
-signed int PutString(char *pStr, char fill, signed int width, const char *pSource)
+static signed int PutString(char *pStr, char fill, signed int width, const char *pSource)
 {
     signed int num = 0;
 
@@ -94,120 +98,291 @@ signed int PutString(char *pStr, char fill, signed int width, const char *pSourc
 }
 
 //------------------------------------------------------------------------------
-// Writes an unsigned int inside the given string, using the provided fill &
-// width parameters.
-// Returns the size in characters of the written integer.
-// \param pStr  Storage string.
-// \param fill  Fill character.
-// \param width  Minimum integer width.
+// Two decimal digits per entry, so that integers are converted two digits
+// (and one division by 100) at a time.
+//------------------------------------------------------------------------------
+static const char digitPairs[200] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const char hexDigits[2][16] =
+{
+    { '0','1','2','3','4','5','6','7','8','9','a','b','c','d','e','f' },
+    { '0','1','2','3','4','5','6','7','8','9','A','B','C','D','E','F' }
+};
+
+//------------------------------------------------------------------------------
+// Powers of ten used by the float formatters (the fraction of %f is scaled by
+// pow10[precision], and %E can need up to 10^(precision+3)).
+//------------------------------------------------------------------------------
+static const uint64_t pow10[STDIO_FLOAT_MAXPRECISION + 4] =
+{
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+    10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+    100000000000ULL, 1000000000000ULL
+};
+
+//------------------------------------------------------------------------------
+// Powers of ten as a normalised 64-bit mantissa and a binary exponent
+// (10^x = mantissa * 2^exponent). Any power needed by %e and %E is split into
+// 10^(x mod 16), which is exact, and 10^(16 * (x div 16)), built by
+// multiplying at most five of the large powers (rounded to the nearest).
+// Sensor values only need the first factor, and so a single multiply.
+//------------------------------------------------------------------------------
+typedef struct
+{
+    uint64_t mantissa;
+    int16_t  exponent;
+} pow10Binary_t;
+
+static const pow10Binary_t pow10Small[16] =
+{
+    { 0x8000000000000000ULL,   -63 },  // 1e0
+    { 0xA000000000000000ULL,   -60 },  // 1e1
+    { 0xC800000000000000ULL,   -57 },  // 1e2
+    { 0xFA00000000000000ULL,   -54 },  // 1e3
+    { 0x9C40000000000000ULL,   -50 },  // 1e4
+    { 0xC350000000000000ULL,   -47 },  // 1e5
+    { 0xF424000000000000ULL,   -44 },  // 1e6
+    { 0x9896800000000000ULL,   -40 },  // 1e7
+    { 0xBEBC200000000000ULL,   -37 },  // 1e8
+    { 0xEE6B280000000000ULL,   -34 },  // 1e9
+    { 0x9502F90000000000ULL,   -30 },  // 1e10
+    { 0xBA43B74000000000ULL,   -27 },  // 1e11
+    { 0xE8D4A51000000000ULL,   -24 },  // 1e12
+    { 0x9184E72A00000000ULL,   -20 },  // 1e13
+    { 0xB5E620F480000000ULL,   -17 },  // 1e14
+    { 0xE35FA931A0000000ULL,   -14 }   // 1e15
+};
+
+static const pow10Binary_t pow10Large[2][5] =
+{
+    {
+        { 0x8E1BC9BF04000000ULL,   -10 },  // 1e16
+        { 0x9DC5ADA82B70B59EULL,    43 },  // 1e32
+        { 0xC2781F49FFCFA6D5ULL,   149 },  // 1e64
+        { 0x93BA47C980E98CE0ULL,   362 },  // 1e128
+        { 0xAA7EEBFB9DF9DE8EULL,   787 }   // 1e256
+    },
+    {
+        { 0xE69594BEC44DE15BULL,  -117 },  // 1e-16
+        { 0xCFB11EAD453994BAULL,  -170 },  // 1e-32
+        { 0xA87FEA27A539E9A5ULL,  -276 },  // 1e-64
+        { 0xDDD0467C64BCE4A1ULL,  -489 },  // 1e-128
+        { 0xC0314325637A193AULL,  -914 }   // 1e-256
+    }
+};
+
+//------------------------------------------------------------------------------
+// Converts an unsigned int to decimal, writing the digits backwards from pEnd.
+// Returns a pointer to the first digit.
+// Values above 43698 are divided by 100 with a 32x32->64-bit multiply, and
+// smaller values with a 32-bit multiply, so no division is needed.
+// \param pEnd  End of the storage buffer (10 chars are needed).
 // \param value  Integer value.
 //------------------------------------------------------------------------------
-signed int PutUnsignedInt(
-    char *pStr,
-    char fill,
-    signed int width,
-    unsigned int value)
+static char * FormatDecimal(char *pEnd, unsigned int value)
 {
-    signed int num = 0;
+    unsigned int q, r;
 
-    // Take current digit into account when calculating width
-    width--;
+    while (value >= 43699) {
 
-    // Recursively write upper digits
-    if ((value / 10) > 0) {
+        q = (unsigned int)(((uint64_t) value * 0x51EB851FULL) >> 37);
+        r = (value - q*100) * 2;
+        pEnd -= 2;
+        pEnd[0] = digitPairs[r];
+        pEnd[1] = digitPairs[r+1];
+        value = q;
+    }
 
-        num = PutUnsignedInt(pStr, fill, width, value / 10);
-        pStr += num;
+    while (value >= 100) {
+
+        q = (value * 5243) >> 19;
+        r = (value - q*100) * 2;
+        pEnd -= 2;
+        pEnd[0] = digitPairs[r];
+        pEnd[1] = digitPairs[r+1];
+        value = q;
+    }
+
+    if (value >= 10) {
+
+        pEnd -= 2;
+        pEnd[0] = digitPairs[value*2];
+        pEnd[1] = digitPairs[value*2+1];
     }
-    // Write filler characters
     else {
 
-        while (width > 0) {
+        *--pEnd = value + '0';
+    }
 
-            append_char(pStr, fill);
-            pStr++;
-            num++;
-            width--;
+    return pEnd;
+}
+
+//------------------------------------------------------------------------------
+// Converts a 64-bit unsigned value to decimal, writing the digits backwards
+// from pEnd. Returns a pointer to the first digit.
+// Only large floats need this, so values above 32 bits are split into groups
+// of nine digits with a (slow) 64-bit division.
+// \param pEnd  End of the storage buffer (20 chars are needed).
+// \param value  Integer value.
+//------------------------------------------------------------------------------
+static char * FormatDecimal64(char *pEnd, uint64_t value)
+{
+    uint64_t q;
+    char *pStart;
+
+    while (value > 0xFFFFFFFFULL) {
+
+        q = value / 1000000000ULL;
+        pStart = FormatDecimal(pEnd, (unsigned int)(value - q*1000000000ULL));
+        while (pEnd - pStart < 9) {
+
+            *--pStart = '0';
         }
+        pEnd = pStart;
+        value = q;
     }
 
-    // Write lower digit
-    num += append_char(pStr, (value % 10) + '0');
+    return FormatDecimal(pEnd, (unsigned int) value);
+}
 
-    return num;
+//------------------------------------------------------------------------------
+// Returns the number of decimal digits in an unsigned int.
+//------------------------------------------------------------------------------
+static signed int CountDigits(unsigned int value)
+{
+    signed int len = 1;
+
+    while ((len < 10) && (value >= pow10[len])) {
+
+        len++;
+    }
+
+    return len;
 }
 
 //------------------------------------------------------------------------------
-// Writes a signed int inside the given string, using the provided fill & width
-// parameters.
-// Returns the size of the written integer.
+// Writes the fill characters and the optional sign that go before a number of
+// len chars, so that the number can then be written straight after them.
+// Zeros are inserted between the sign and the digits, other fill characters
+// before the sign.
+// Returns the number of chars written.
 // \param pStr  Storage string.
 // \param fill  Fill character.
-// \param width  Minimum integer width.
-// \param value  Signed integer value.
+// \param width  Minimum width.
+// \param sign  Sign character, or 0 for none.
+// \param len  Number of chars in the number (without the sign).
 //------------------------------------------------------------------------------
-signed int PutSignedInt(
+static signed int PutPadding(
     char *pStr,
     char fill,
     signed int width,
-    signed int value)
+    char sign,
+    signed int len)
 {
     signed int num = 0;
-    unsigned int absolute;
 
-    // Compute absolute value
-    if (value < 0) {
+    width -= len + (sign != 0);
 
-        absolute = -value;
-    }
-    else {
+    if (sign && (fill == '0')) {
 
-        absolute = value;
+        pStr[num++] = sign;
     }
 
-    // Take current digit into account when calculating width
-    width--;
+    while (width > 0) {
 
-    // Recursively write upper digits
-    if ((absolute / 10) > 0) {
-
-        if (value < 0) {
+        pStr[num++] = fill;
+        width--;
+    }
 
-            num = PutSignedInt(pStr, fill, width, -(absolute / 10));
-        }
-        else {
+    if (sign && (fill != '0')) {
 
-            num = PutSignedInt(pStr, fill, width, absolute / 10);
-        }
-        pStr += num;
+        pStr[num++] = sign;
     }
-    else {
 
-        // Reserve space for sign
-        if (value < 0) {
+    return num;
+}
 
-            width--;
-        }
+//------------------------------------------------------------------------------
+// Writes a number that has already been converted to text inside the given
+// string, with an optional sign, padded to the given width.
+// Returns the number of chars written.
+// \param pStr  Storage string.
+// \param fill  Fill character.
+// \param width  Minimum width.
+// \param sign  Sign character, or 0 for none.
+// \param pDigits  Text to write.
+// \param len  Number of chars.
+//------------------------------------------------------------------------------
+static signed int PutNumber(
+    char *pStr,
+    char fill,
+    signed int width,
+    char sign,
+    const char *pDigits,
+    signed int len)
+{
+    signed int num = PutPadding(pStr, fill, width, sign, len);
 
-        // Write filler characters
-        while (width > 0) {
+    memcpy(pStr + num, pDigits, len);
 
-            append_char(pStr, fill);
-            pStr++;
-            num++;
-            width--;
-        }
+    return num + len;
+}
 
-        // Write sign
-        if (value < 0) {
+//------------------------------------------------------------------------------
+// Writes an unsigned int inside the given string, using the provided fill &
+// width parameters.
+// Returns the size in characters of the written integer.
+// \param pStr  Storage string.
+// \param fill  Fill character.
+// \param width  Minimum integer width.
+// \param value  Integer value.
+//------------------------------------------------------------------------------
+static signed int PutUnsignedInt(
+    char *pStr,
+    char fill,
+    signed int width,
+    unsigned int value)
+{
+    signed int len = CountDigits(value);
+    signed int num = PutPadding(pStr, fill, width, 0, len) + len;
 
-            num += append_char(pStr, '-');
-            pStr++;
-        }
-    }
+    // Digits are written backwards, straight into the string
+    FormatDecimal(pStr + num, value);
 
-    // Write lower digit
-    num += append_char(pStr, (absolute % 10) + '0');
+    return num;
+}
+
+//------------------------------------------------------------------------------
+// Writes a signed int inside the given string, using the provided fill & width
+// parameters.
+// Returns the size of the written integer.
+// \param pStr  Storage string.
+// \param fill  Fill character.
+// \param width  Minimum integer width.
+// \param value  Signed integer value.
+//------------------------------------------------------------------------------
+static signed int PutSignedInt(
+    char *pStr,
+    char fill,
+    signed int width,
+    signed int value)
+{
+    // Compute absolute value (works for INT_MIN as well)
+    unsigned int absolute = (value < 0) ? 0u - (unsigned int) value : (unsigned int) value;
+    signed int len = CountDigits(absolute);
+    signed int num = PutPadding(pStr, fill, width, (value < 0) ? '-' : 0, len) + len;
+
+    FormatDecimal(pStr + num, absolute);
 
     return num;
 }
@@ -222,161 +397,466 @@ signed int PutSignedInt(
 // \param maj  Indicates if the letters must be printed in lower- or upper-case.
 // \param value  Hexadecimal value.
 //------------------------------------------------------------------------------
-signed int PutHexa(
+static signed int PutHexa(
     char *pStr,
     char fill,
     signed int width,
     unsigned char maj,
     unsigned int value)
 {
-    signed int num = 0;
+    const char *pHex = hexDigits[maj ? 1 : 0];
+    signed int len = 1;
+    signed int num;
+
+    while ((len < 8) && (value >> (len * 4))) {
+
+        len++;
+    }
+
+    num = PutPadding(pStr, fill, width, 0, len) + len;
+
+    pStr += num;
+    do {
+
+        *--pStr = pHex[value & 0xF];
+        value >>= 4;
+    } while (value);
+
+    return num;
+}
+
+//------------------------------------------------------------------------------
+// Splits a double into a sign, a mantissa and a binary exponent
+// (value = mantissa * 2^exponent) using integer operations only, since the
+// M0 has no FPU and every double operation is a library call.
+// Returns 0 for a finite value, 1 for infinity and 2 for NaN.
+// \param value  Float value.
+// \param pNegative  Set to 1 if the sign bit is set (including -0.0).
+// \param pMantissa  Mantissa (53 bits for normal values).
+// \param pExponent  Binary exponent.
+//------------------------------------------------------------------------------
+static int FloatSplit(
+    double value,
+    unsigned char *pNegative,
+    uint64_t *pMantissa,
+    int *pExponent)
+{
+    union
+    {
+        double   d;
+        uint64_t u;
+    } bits;
+    int exponent;
 
-    // Decrement width
-    width--;
+    bits.d = value;
+    *pNegative = (unsigned char)(bits.u >> 63);
+    *pMantissa = bits.u & 0x000FFFFFFFFFFFFFULL;
+    exponent = (int)(bits.u >> 52) & 0x7FF;
 
-    // Recursively output upper digits
-    if ((value >> 4) > 0) {
+    if (exponent == 0x7FF) {
 
-        num += PutHexa(pStr, fill, width, maj, value >> 4);
-        pStr += num;
+        return *pMantissa ? 2 : 1;
+    }
+
+    // Subnormal values have no implicit leading 1
+    if (exponent == 0) {
+
+        exponent = 1;
     }
-    // Write filler chars
     else {
 
-        while (width > 0) {
+        *pMantissa |= 1ULL << 52;
+    }
+
+    *pExponent = exponent - 1075;
+    return 0;
+}
 
-            append_char(pStr, fill);
-            pStr++;
-            num++;
-            width--;
+//------------------------------------------------------------------------------
+// Writes 'inf' or 'nan' inside the given string.
+// Returns the number of chars written.
+//------------------------------------------------------------------------------
+static signed int PutFloatSpecial(
+    char *pStr,
+    signed int width,
+    unsigned char negative,
+    int special)
+{
+    return PutNumber(pStr, ' ', width, (negative && (special == 1)) ? '-' : 0,
+                     (special == 1) ? "inf" : "nan", 3);
+}
+
+//------------------------------------------------------------------------------
+// Returns the high 64 bits of a 64x64-bit product, rounded to the nearest.
+//------------------------------------------------------------------------------
+static uint64_t MulHigh64(uint64_t a, uint64_t b)
+{
+    uint64_t aLo = (uint32_t) a, aHi = a >> 32;
+    uint64_t bLo = (uint32_t) b, bHi = b >> 32;
+    uint64_t loHi = aLo * bHi;
+    uint64_t hiLo = aHi * bLo;
+    uint64_t mid  = ((aLo * bLo) >> 32) + (uint32_t) loHi + (uint32_t) hiLo;
+
+    return aHi * bHi + (loHi >> 32) + (hiLo >> 32) + (mid >> 32) + ((mid >> 31) & 1);
+}
+
+//------------------------------------------------------------------------------
+// Shifts a non-zero mantissa left until its top bit is set, adjusting the
+// binary exponent to match. Normal values always have bit 52 set, so only
+// subnormal values need the search.
+//------------------------------------------------------------------------------
+static void FloatNormalise(uint64_t *pMantissa, int *pExponent)
+{
+    int shift;
+
+    if (*pMantissa >> 52) {
+
+        *pMantissa <<= 11;
+        *pExponent -= 11;
+        return;
+    }
+
+    for (shift = 32; shift > 0; shift >>= 1) {
+
+        if ((*pMantissa >> (64 - shift)) == 0) {
+
+            *pMantissa <<= shift;
+            *pExponent -= shift;
         }
     }
+}
 
-    // Write current digit
-    if ((value & 0xF) < 10) {
+//------------------------------------------------------------------------------
+// Multiplies a normalised mantissa and binary exponent by a power of ten,
+// keeping the result normalised.
+//------------------------------------------------------------------------------
+static void FloatMulPow10(uint64_t *pMantissa, int *pExponent, const pow10Binary_t *pPow)
+{
+    *pMantissa = MulHigh64(*pMantissa, pPow->mantissa);
+    *pExponent += pPow->exponent + 64;
+    if (!(*pMantissa >> 63)) {
 
-        append_char(pStr, (value & 0xF) + '0');
+        *pMantissa <<= 1;
+        (*pExponent)--;
     }
-    else if (maj) {
+}
 
-        append_char(pStr, (value & 0xF) - 10 + 'A');
+//------------------------------------------------------------------------------
+// Returns mantissa * 2^exponent * 10^power rounded to the nearest integer,
+// where the mantissa is normalised and the result fits in 63 bits. This keeps
+// about 18 significant digits (plenty for STDIO_FLOAT_MAXPRECISION).
+//------------------------------------------------------------------------------
+static uint64_t FloatScale(uint64_t mantissa, int exponent, int power)
+{
+    const pow10Binary_t *pPow;
+    unsigned int bits;
+    int shift;
+
+    // power = 16 * bits + (power & 15), rounded down for negative powers
+    if (power & 15) {
+
+        FloatMulPow10(&mantissa, &exponent, &pow10Small[power & 15]);
     }
-    else {
 
-        append_char(pStr, (value & 0xF) - 10 + 'a');
+    pPow = pow10Large[power < 0 ? 1 : 0];
+    bits = (power < 0) ? (15 - power) >> 4 : power >> 4;
+    for ( ; bits; bits >>= 1, pPow++) {
+
+        if (bits & 1) {
+
+            FloatMulPow10(&mantissa, &exponent, pPow);
+        }
+    }
+
+    shift = -exponent;
+    if ((shift <= 0) || (shift > 64)) {
+
+        return 0;
     }
-    num++;
 
-    return num;
+    return ((shift == 64) ? 0 : (mantissa >> shift)) + ((mantissa >> (shift - 1)) & 1);
 }
 
+//------------------------------------------------------------------------------
+// Finds the decimal exponent and the rounded digits of a float for %e and %E,
+// so that digits = value * 10^(precision - exponent10) lies in
+// [10^precision, 10^(precision+step)), with exponent10 a multiple of step.
+// \param mantissa  Normalised mantissa (non-zero).
+// \param exponent  Binary exponent.
+// \param precision  Number of digits after the decimal point.
+// \param step  1 for scientific notation, 3 for engineering notation.
+// \param pExponent10  Decimal exponent.
+//------------------------------------------------------------------------------
+static uint64_t FloatDigits(
+    uint64_t mantissa,
+    int exponent,
+    signed int precision,
+    int step,
+    int *pExponent10)
+{
+    uint64_t digits = 0;
+    int exponent10;
+    int tries;
+
+    // log2 of the value in 24.8 fixed point (using the top mantissa bits as
+    // a linear approximation of the fraction), times log10(2) ~= 1233/4096.
+    // This can be out by one near a power of ten, which is fixed below.
+    exponent10 = ((((exponent + 63) << 8) + (int)((mantissa >> 55) & 0xFF)) * 1233) >> 20;
+
+    // Round down to a multiple of 3 for engineering notation, without a
+    // division (the offset keeps the value positive, and x * 43691 >> 17
+    // is x / 3 for the range needed here)
+    if (step == 3) {
+
+        exponent10 = (int)((((unsigned int)(exponent10 + 330) * 43691) >> 17) * 3) - 330;
+    }
+
+    for (tries = 0; tries < 4; tries++) {
+
+        digits = FloatScale(mantissa, exponent, precision - exponent10);
+        if ((digits >= pow10[precision + step]) && (tries < 3)) {
+
+            exponent10 += step;
+        }
+        else if ((digits < pow10[precision]) && (tries < 3)) {
+
+            exponent10 -= step;
+        }
+        else {
+
+            break;
+        }
+    }
+
+    *pExponent10 = exponent10;
+    return digits;
+}
+
+static signed int PutFloatE(char *pStr, char fill, signed int width,
+                            signed int precision, double value);
 
 //------------------------------------------------------------------------------
 // Writes a float inside the given string, using the provided fill & width
 // parameters.
 // Returns the size of the written integer.
+// The integer part and the fraction are taken straight from the mantissa with
+// shifts, and the fraction is scaled by 10^precision in 32.32 fixed point, so
+// no double operations are used. Values above 2^64 are written as %e.
 // \param pStr Storage string.
 // \param fill Fill character.
 // \param width Minimum width.
+// \param precision Digits after the decimal point (up to
+//                  STDIO_FLOAT_MAXPRECISION).
 // \param value Float value.
 // Pito 6/2013
 // +nnnnnnn.nnnnnnn, -nnnnnnn.nnnnnnn
 //------------------------------------------------------------------------------
-signed int PutFloat(
+static signed int PutFloat(
     char *pStr,
     char fill,
     signed int width,
+    signed int precision,
     double value)
 {
+    char buffer[22 + STDIO_FLOAT_MAXPRECISION];
+    char *pEnd = buffer + sizeof(buffer);
+    char *pDigits;
+    unsigned char negative;
+    uint64_t mantissa, intpart, fraction, scaled, low;
+    uint32_t scale, digits;
+    int exponent, special;
+    signed int len, num;
+
+    special = FloatSplit(value, &negative, &mantissa, &exponent);
+    if (special) {
+
+        return PutFloatSpecial(pStr, width, negative, special);
+    }
 
-    int num = 0;
-    int intpart;
-    int fraction;
+    if (exponent > 11) {
 
-    if (value < 0.0f)
-    {
-      num+=append_char(pStr+num, '-');
-      value = -value;
+        return PutFloatE(pStr, fill, width, precision, value);
+    }
+
+    // Integer part, and the fraction in 0.64 fixed point
+    if (exponent >= 0) {
+
+        intpart = mantissa << exponent;
+        fraction = 0;
+    }
+    else if (exponent > -64) {
+
+        intpart = mantissa >> -exponent;
+        fraction = mantissa << (64 + exponent);
+    }
+    else {
+
+        intpart = 0;
+        fraction = (exponent > -128) ? (mantissa >> (-64 - exponent)) : 0;
+    }
+
+    // fraction * 10^precision in 32.32 fixed point, rounded to the nearest
+    // (exact ties, common for large values, are rounded to even like the C
+    // library does)
+    scale = (uint32_t) pow10[precision];
+    low = (fraction & 0xFFFFFFFFULL) * scale;
+    scaled = (low >> 32) + (fraction >> 32) * scale;
+    digits = (uint32_t)(scaled >> 32);
+    if ((uint32_t) scaled & 0x80000000) {
+
+        if (((uint32_t) scaled != 0x80000000) || (uint32_t) low ||
+            ((precision ? digits : (uint32_t) intpart) & 1)) {
+
+            digits++;
+        }
+    }
+    if (digits >= scale) {
+
+        digits -= scale;
+        intpart++;
     }
 
-    intpart = (int)value;
-    fraction = (int)((value - intpart) * 1000000.0f + 0.5f );
+    // Values above 32 bits are rare, and are converted in a buffer first
+    if (intpart > 0xFFFFFFFFULL) {
+
+        if (precision > 0) {
+
+            pDigits = pEnd - precision;
+            FormatDecimal(pEnd, digits + scale);
+            *--pDigits = '.';
+            pEnd = pDigits;
+        }
+
+        pDigits = FormatDecimal64(pEnd, intpart);
 
-    num+=PutUnsignedInt(pStr+num,fill,1,(int)(intpart));
+        return PutNumber(pStr, fill, width, negative ? '-' : 0, pDigits,
+                         buffer + sizeof(buffer) - pDigits);
+    }
+
+    // Otherwise the digits are written straight into the string, from the
+    // last digit of the fraction backwards
+    len = CountDigits((uint32_t) intpart) + (precision ? precision + 1 : 0);
+    num = PutPadding(pStr, fill, width, negative ? '-' : 0, len) + len;
 
-    num+=append_char(pStr+num, '.');
+    pDigits = pStr + num;
+    if (precision > 0) {
 
-    num+=PutUnsignedInt(pStr+num,'0',6,(int)(fraction));
+        // The extra leading '1' (scale) gives the zeros after the decimal
+        // point, and is then overwritten by the '.'
+        pDigits = FormatDecimal(pDigits, digits + scale);
+        *pDigits = '.';
+    }
+    FormatDecimal(pDigits, (uint32_t) intpart);
 
     return num;
 }
 
-
 //------------------------------------------------------------------------------
-// Writes a SCI notation float inside the given string, using the provided fill & width
-// parameters.
-// Returns the size of the written integer.
-// \param pStr Storage string.
-// \param fill Fill character.
-// \param width Minimum width.
-// \param value Float value.
-// Pito 6/2013
-// n.nnnnnnE+nnn, -n.nnnnnnE-nnn
+// Writes the digits and exponent of a float in scientific (step = 1) or
+// engineering (step = 3) notation inside the given string.
+// Returns the number of chars written.
+// The length is known once the digits are, so everything is written straight
+// into the string, backwards from the last digit of the exponent.
 //------------------------------------------------------------------------------
-signed int PutFloatE(
+static signed int PutFloatExp(
     char *pStr,
     char fill,
     signed int width,
+    signed int precision,
+    int step,
     double value)
 {
-    int num = 0;
-    int exponent = 0;
-    int intpart;
-    int fraction;
-
-    if (value < 0.0f)
-    {
-      num+=append_char(pStr+num, '-');
-      value = -value;
+    char *pEnd;
+    char *pDigits;
+    unsigned char negative;
+    uint64_t mantissa, digits = 0;
+    int exponent, exponent10 = 0, special;
+    unsigned int exponentAbs;
+    signed int intLen, len, num;
+
+    special = FloatSplit(value, &negative, &mantissa, &exponent);
+    if (special) {
+
+        return PutFloatSpecial(pStr, width, negative, special);
     }
 
-    while (value >= 10.0f)
-    {
-      value /= 10.0f;
-      exponent++;
-    }
-    if (value != 0.0f)
-    {
-      while (value < 1.0f)
-      {
-        value *= 10.0f;
-        exponent--;
-      }
+    if (mantissa) {
+
+        FloatNormalise(&mantissa, &exponent);
+        digits = FloatDigits(mantissa, exponent, precision, step, &exponent10);
     }
 
-    intpart = (int)value;
-    fraction = (int)((value-intpart) * 1000000.0f + 0.5f);
+    // Digits before the decimal point (1 for %e, 1 to 3 for %E), and an
+    // exponent of at least two digits
+    intLen = 1;
+    while ((intLen < 3) && (digits >= pow10[precision + intLen])) {
 
-    num+=PutUnsignedInt(pStr+num,fill,1,(int)(intpart));
-    num+=append_char(pStr+num, '.');
-    num+=PutUnsignedInt(pStr+num,'0',6,(int)(fraction));
-    num+=append_char(pStr+num, 'E');
+        intLen++;
+    }
+    exponentAbs = (exponent10 < 0) ? -exponent10 : exponent10;
+    len = intLen + (precision ? precision + 1 : 0) + ((exponentAbs >= 100) ? 5 : 4);
+    num = PutPadding(pStr, fill, width, negative ? '-' : 0, len) + len;
 
-    if (exponent >= 0)
-    {
-      num+=append_char(pStr+num, '+');
+    pEnd = pStr + num;
+    pDigits = FormatDecimal(pEnd, exponentAbs);
+    if (pEnd - pDigits < 2) {
+
+        *--pDigits = '0';
     }
-    else
-    {
-      num+=append_char(pStr+num, '-');
-      exponent = -exponent;
+    *--pDigits = (exponent10 < 0) ? '-' : '+';
+    *--pDigits = 'E';
+
+    // Mantissa digits (zero only needs the padding)
+    pEnd = pDigits;
+    pDigits = (digits > 0xFFFFFFFFULL) ? FormatDecimal64(pEnd, digits)
+                                       : FormatDecimal(pEnd, (unsigned int) digits);
+    while (pEnd - pDigits < intLen + precision) {
+
+        *--pDigits = '0';
     }
 
-    num+=PutSignedInt(pStr+num,'0',2,(int)(exponent));
+    // The digits were written one char to the right of the integer part, to
+    // leave room for the decimal point (at most three chars are moved, which
+    // is cheaper than a call to memmove)
+    if (precision > 0) {
+
+        pDigits--;
+        pDigits[0] = pDigits[1];
+        if (intLen > 1) {
+
+            pDigits[1] = pDigits[2];
+        }
+        if (intLen > 2) {
+
+            pDigits[2] = pDigits[3];
+        }
+        pDigits[intLen] = '.';
+    }
 
     return num;
 }
 
+//------------------------------------------------------------------------------
+// Writes a SCI notation float inside the given string, using the provided fill & width
+// parameters.
+// Returns the size of the written integer.
+// \param pStr Storage string.
+// \param fill Fill character.
+// \param width Minimum width.
+// \param precision Digits after the decimal point.
+// \param value Float value.
+// Pito 6/2013
+// n.nnnnnnE+nnn, -n.nnnnnnE-nnn
+//------------------------------------------------------------------------------
+static signed int PutFloatE(
+    char *pStr,
+    char fill,
+    signed int width,
+    signed int precision,
+    double value)
+{
+    return PutFloatExp(pStr, fill, width, precision, 1, value);
+}
 
 //------------------------------------------------------------------------------
 // Writes an Engineering notation float inside the given string, using the provided fill & width
@@ -385,63 +865,19 @@ signed int PutFloatE(
 // \param pStr Storage string.
 // \param fill Fill character.
 // \param width Minimum width.
+// \param precision Digits after the decimal point.
 // \param value Float value.
 // Pito 6/2013
 // nnn.nnnE+mmm, -nnn.nnnE-mmm, mmm is multiply of 3
 //------------------------------------------------------------------------------
-signed int PutFloatEE(
+static signed int PutFloatEE(
     char *pStr,
     char fill,
     signed int width,
+    signed int precision,
     double value)
 {
-
-    int num = 0;
-        int exponent = 0;
-    int intpart;
-    int fraction;
-
-    if (value < 0.0f) 
-    {
-      num+=append_char(pStr+num, '-');
-      value = -value;
-    }
-
-    while (value >= 1000.0f)
-    {
-      value /= 1000.0f;
-      exponent += 3;
-    }
-    if (value != 0.0f)
-    {
-      while (value < 1.0f)
-      {
-        value *= 1000.0f;
-        exponent -= 3;
-      }
-    }
-
-    intpart = (int)value;
-    fraction = (int)((value - intpart) * 1000.0f + 0.5f);
-
-    num+=PutUnsignedInt(pStr+num,fill,1,(int)(intpart));
-    num+=append_char(pStr+num, '.');
-    num+=PutUnsignedInt(pStr+num,'0',3,(int)(fraction));
-    num+=append_char(pStr+num, 'E');
-
-    if (exponent >= 0) 
-    {
-      num+=append_char(pStr+num, '+');
-    }
-    else 
-    {
-      num+=append_char(pStr+num, '-');
-      exponent = -exponent;
-    }
-
-    num+=PutSignedInt(pStr+num,'0',2,(int)(exponent));
-
-    return num;
+    return PutFloatExp(pStr, fill, width, precision, 3, value);
 }
 
 
@@ -462,6 +898,7 @@ signed int vsnprintf(char *pStr, size_t length, const char *pFormat, va_list ap)
 {
     char          fill;
     unsigned char width;
+    signed int    precision;
     signed int    num = 0;
     signed int    size = 0;
 
@@ -513,6 +950,23 @@ signed int vsnprintf(char *pStr, size_t length, const char *pFormat, va_list ap)
                 pFormat++;
             }
 
+            // Parse precision (only used by floats)
+            precision = -1;
+            if (*pFormat == '.') {
+
+                precision = 0;
+                pFormat++;
+                while ((*pFormat >= '0') && (*pFormat <= '9')) {
+
+                    precision = (precision*10) + *pFormat-'0';
+                    pFormat++;
+                }
+                if (precision > STDIO_FLOAT_MAXPRECISION) {
+
+                    precision = STDIO_FLOAT_MAXPRECISION;
+                }
+            }
+
             // Check if there is enough space
             if (size + width > length) {
 
@@ -525,9 +979,9 @@ signed int vsnprintf(char *pStr, size_t length, const char *pFormat, va_list ap)
             case 'd':
             case 'i': num = PutSignedInt(pStr, fill, width, va_arg(ap, signed int)); break;
             case 'u': num = PutUnsignedInt(pStr, fill, width, va_arg(ap, unsigned int)); break;
-            case 'f': num = PutFloat(pStr, fill, width, va_arg(ap, double)); break;
-            case 'e': num = PutFloatE(pStr, fill, width, va_arg(ap, double)); break;
-            case 'E': num = PutFloatEE(pStr, fill, width, va_arg(ap, double)); break;
+            case 'f': num = PutFloat(pStr, fill, width, precision < 0 ? 6 : precision, va_arg(ap, double)); break;
+            case 'e': num = PutFloatE(pStr, fill, width, precision < 0 ? 6 : precision, va_arg(ap, double)); break;
+            case 'E': num = PutFloatEE(pStr, fill, width, precision < 0 ? 3 : precision, va_arg(ap, double)); break;
             case 'x': num = PutHexa(pStr, fill, width, 0, va_arg(ap, unsigned int)); break;
             case 'X': num = PutHexa(pStr, fill, width, 1, va_arg(ap, unsigned int)); break;
             case 's': num = PutString(pStr, fill, width, va_arg(ap, char *)); break;
@@ -0,0 +1,153 @@
+/**************************************************************************/
+/*!
+    @file     meminfo.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Measures how much of the RAM left for the stack is actually
+              used
+
+    There is no fixed stack size with the GNU and Code Red linker
+    scripts: the main stack grows down from the top of the internal SRAM
+    towards the end of .data/.bss (_pvHeapStart).  meminfoInit fills that
+    region with MEMINFO_STACK_PATTERN at startup, and meminfoGetStackUsed
+    looks for the lowest word that was overwritten since then.  This is
+    the worst case since reset, including the interrupt handlers (with
+    RTX, only the handlers use the main stack, the task stacks are in
+    .bss).
+
+    The result is a lower bound: a function that reserves stack space
+    without writing to all of it isn't seen.  Keep a margin of a few
+    hundred bytes when sizing RAM.
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include "projectconfig.h"
+
+#ifdef CFG_MEMINFO
+
+#include "meminfo.h"
+
+#ifndef _TEST_
+/* Symbols defined by the linker script */
+extern uint32_t _pvHeapStart;
+#ifdef __CODE_RED
+extern uint32_t _vStackTop;
+#define MEMINFO_STACKTOP  (&_vStackTop)
+#else
+extern uint32_t __StackTop;
+#define MEMINFO_STACKTOP  (&__StackTop)
+#endif
+#endif
+
+static uint32_t *meminfo_bottom;
+static uint32_t *meminfo_top;
+
+/**************************************************************************/
+/*!
+    @brief  Paints the free RAM between the end of the static data and
+            the current stack pointer.  Must be called as early as
+            possible (boardInit does it when CFG_MEMINFO is enabled)
+*/
+/**************************************************************************/
+void meminfoInit(void)
+{
+  #ifndef _TEST_
+  meminfoInitRegion(&_pvHeapStart, MEMINFO_STACKTOP);
+  #endif
+}
+
+/**************************************************************************/
+/*!
+    @brief  Sets the stack region (between bottom and top, top excluded),
+            and paints the part that isn't in use yet
+
+    @note   On the device, nothing at or above the current stack pointer
+            (less MEMINFO_STACK_GUARD words) is painted
+*/
+/**************************************************************************/
+void meminfoInitRegion(uint32_t *bottom, uint32_t *top)
+{
+  uint32_t *limit = top;
+  uint32_t *p;
+
+  #ifndef _TEST_
+  /* An interrupt handler could push its frame below the limit while
+     the RAM is being painted (ex. with RTX, where the tasks don't run
+     on the main stack) */
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  uint32_t *sp = (uint32_t *) __get_MSP() - MEMINFO_STACK_GUARD;
+  if (sp < limit) limit = sp;
+  #endif
+
+  meminfo_bottom = bottom;
+  meminfo_top    = top;
+
+  for (p = bottom; p < limit; p++)
+  {
+    *p = MEMINFO_STACK_PATTERN;
+  }
+
+  #ifndef _TEST_
+  __set_PRIMASK(primask);
+  #endif
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the size in bytes of the stack region (all the RAM
+            that isn't used by static data)
+*/
+/**************************************************************************/
+uint32_t meminfoGetStackSize(void)
+{
+  return (uint32_t) (meminfo_top - meminfo_bottom) * sizeof(uint32_t);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the deepest stack use since meminfoInit, in bytes
+            (the high-water mark)
+*/
+/**************************************************************************/
+uint32_t meminfoGetStackUsed(void)
+{
+  const uint32_t *p = meminfo_bottom;
+
+  while (p < meminfo_top && *p == MEMINFO_STACK_PATTERN)
+  {
+    p++;
+  }
+
+  return (uint32_t) (meminfo_top - p) * sizeof(uint32_t);
+}
+
+#endif
@@ -0,0 +1,315 @@
+/**************************************************************************/
+/*!
+    @file     probe.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Named cycle-count profiling probes
+
+    Each probe keeps the number of measurements, the min, max and mean
+    tick count, and a log2 histogram, which shows outliers and bimodal
+    timings (cache misses, I2C retries, preemption by an ISR, etc.) that
+    the mean alone hides.  The probes are stored in a static table
+    (CFG_PROBE_MAXPROBES entries), and added the first time a PROBE_END
+    with a new name runs.
+
+    The tick counter is:
+
+    - LPC13U (M3): the DWT cycle counter.  Probes measure the difference
+      between two readings, so anything that resets CYCCNT between
+      PROBE_BEGIN and PROBE_END will corrupt the measurement
+    - LPC11U (M0): a free-running 32-bit timer (CFG_PROBE_TIMER32) at the
+      core clock, since the M0 has no DWT cycle counter
+    - Host builds: clock_gettime, in nanoseconds
+
+    With 32-bit ticks, a single measurement can be up to ~59s at 72MHz.
+    PROBE_BEGIN/PROBE_END take ~20 cycles on the M3 once the probe has
+    been registered, and can be used in interrupt handlers.
+
+    @code
+    probeInit();
+
+    while(1)
+    {
+      PROBE_BEGIN(i2c_read);
+      error = lsm303accelGetSensorEvent(&event);
+      PROBE_END(i2c_read);
+    }
+
+    // ... and dump the results with the 'pr' CLI command
+    @endcode
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include "projectconfig.h"
+
+#if defined CFG_PROBE || defined CFG_ISRTRACE
+
+#include <string.h>
+#include "probe.h"
+
+#if defined CFG_MCU_FAMILY_LPC13UXX
+#include "core/dwt/dwt.h"
+#endif
+
+#ifdef _TEST_
+#include <time.h>
+#endif
+
+#ifdef _TEST_
+/**************************************************************************/
+/*!
+    @brief  Host builds use a monotonic clock in nanoseconds as the tick
+            counter
+*/
+/**************************************************************************/
+uint32_t probeGetTicks(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t) (ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
+#endif
+
+/**************************************************************************/
+/*!
+    @brief  Starts the free-running tick counter (called by probeInit and
+            isrtraceInit)
+*/
+/**************************************************************************/
+void probeTicksInit(void)
+{
+  #if defined _TEST_
+  // Nothing to start
+  #elif defined CFG_MCU_FAMILY_LPC13UXX
+  DWT_ENABLE_CYCLECOUNTER;
+  #else
+  // Free-running timer at the core clock, without any match events
+  LPC_SYSCON->SYSAHBCLKCTRL |= (CFG_PROBE_TIMER32 == 0) ? (1<<9) : (1<<10);
+  PROBE_TIMER->PR  = 0;
+  PROBE_TIMER->MCR = 0;
+  PROBE_TIMER->TCR = 1;
+  #endif
+}
+
+#ifdef CFG_PROBE
+
+static probe_t  probe_table[CFG_PROBE_MAXPROBES];
+static uint8_t  probe_count;
+
+/**************************************************************************/
+/*!
+    @brief  Disables interrupts (probes can be used in interrupt
+            handlers) and returns the previous state
+*/
+/**************************************************************************/
+static inline uint32_t probeLock(void)
+{
+  #ifndef _TEST_
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  return primask;
+  #else
+  return 0;
+  #endif
+}
+
+/**************************************************************************/
+/*!
+    @brief  Restores the interrupt state saved by probeLock
+*/
+/**************************************************************************/
+static inline void probeUnlock(uint32_t primask)
+{
+  #ifndef _TEST_
+  __set_PRIMASK(primask);
+  #else
+  (void) primask;
+  #endif
+}
+
+/**************************************************************************/
+/*!
+    @brief  Clears the statistics of a single probe
+*/
+/**************************************************************************/
+static void probeClear(probe_t *probe)
+{
+  const char *name = probe->name;
+
+  memset(probe, 0, sizeof(probe_t));
+  probe->name = name;
+  probe->min = 0xFFFFFFFF;
+}
+
+
+/**************************************************************************/
+/*!
+    @brief  Starts the tick counter, and clears the probe table
+
+    @note   PROBE_END keeps a pointer to its table entry, so this must be
+            called once at startup, before any probe runs.  Use
+            probeReset to clear the statistics later on
+*/
+/**************************************************************************/
+void probeInit(void)
+{
+  probeTicksInit();
+
+  memset(probe_table, 0, sizeof(probe_table));
+  probe_count = 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Clears the statistics of every probe (the names are kept)
+*/
+/**************************************************************************/
+void probeReset(void)
+{
+  uint32_t primask = probeLock();
+  uint8_t  i;
+
+  for (i = 0; i < probe_count; i++)
+  {
+    probeClear(&probe_table[i]);
+  }
+
+  probeUnlock(primask);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the probe with the specified name, and adds it to the
+            table if it isn't there yet (normally called by PROBE_END)
+
+    @returns    The probe, or NULL if the table is full
+*/
+/**************************************************************************/
+probe_t *probeRegister(const char *name)
+{
+  uint32_t primask;
+  probe_t *probe = NULL;
+  uint8_t  i;
+
+  primask = probeLock();
+
+  for (i = 0; i < probe_count; i++)
+  {
+    if (!strcmp(probe_table[i].name, name))
+    {
+      probe = &probe_table[i];
+      break;
+    }
+  }
+
+  if (!probe && probe_count < CFG_PROBE_MAXPROBES)
+  {
+    probe = &probe_table[probe_count++];
+    probe->name = name;
+    probeClear(probe);
+  }
+
+  probeUnlock(primask);
+
+  return probe;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Adds a measurement to the statistics of a probe (normally
+            called by PROBE_END)
+
+    @param[in]  probe
+                The probe returned by probeRegister (NULL is ignored)
+    @param[in]  ticks
+                Measured tick count
+*/
+/**************************************************************************/
+void probeRecord(probe_t *probe, uint32_t ticks)
+{
+  uint32_t primask;
+  uint8_t  bin;
+
+  if (!probe)
+  {
+    return;
+  }
+
+  // Index of the highest bit set
+  bin = ticks ? 31 - __builtin_clz(ticks) : 0;
+
+  primask = probeLock();
+
+  probe->count++;
+  probe->total += ticks;
+  if (ticks < probe->min) probe->min = ticks;
+  if (ticks > probe->max) probe->max = ticks;
+  if (probe->histogram[bin] != 0xFFFF) probe->histogram[bin]++;
+
+  probeUnlock(primask);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the number of probes in the table
+*/
+/**************************************************************************/
+uint8_t probeCount(void)
+{
+  return probe_count;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the probe at the specified position in the table, or
+            NULL if the index is out of range
+*/
+/**************************************************************************/
+const probe_t *probeGet(uint8_t index)
+{
+  return (index < probe_count) ? &probe_table[index] : NULL;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the mean tick count of a probe (0 if the probe has no
+            measurements)
+*/
+/**************************************************************************/
+uint32_t probeGetMean(const probe_t *probe)
+{
+  return probe->count ? (uint32_t) (probe->total / probe->count) : 0;
+}
+
+#endif
+
+#endif
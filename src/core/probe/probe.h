@@ -0,0 +1,144 @@
+/**************************************************************************/
+/*!
+    @file     probe.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Named cycle-count profiling probes (see probe.c)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef _PROBE_H_
+#define _PROBE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "projectconfig.h"
+
+/* Bin n of the histogram counts the measurements of 2^n to 2^(n+1)-1
+   ticks (bin 0 also counts 0 ticks) */
+#define PROBE_HISTOGRAM_BINS    (32)
+
+/**************************************************************************/
+/*!
+    @brief  Statistics for one named probe.  Ticks are core clock cycles
+            on the device and nanoseconds in host builds
+*/
+/**************************************************************************/
+typedef struct
+{
+  const char *name;
+  uint32_t    count;                              /**< Number of measurements */
+  uint32_t    min;
+  uint32_t    max;
+  uint64_t    total;                              /**< Sum of all measurements, for the mean */
+  uint16_t    histogram[PROBE_HISTOGRAM_BINS];    /**< Saturates at 0xFFFF */
+} probe_t;
+
+#if defined CFG_PROBE || defined CFG_ISRTRACE
+
+/**************************************************************************/
+/*!
+    @brief  Returns the current value of the free-running tick counter
+            used by the probes and the ISR tracer (core/isrtrace)
+*/
+/**************************************************************************/
+#if defined _TEST_
+  uint32_t probeGetTicks(void);
+#elif defined CFG_MCU_FAMILY_LPC13UXX
+  #define probeGetTicks()   (DWT->CYCCNT)
+#else
+  #if CFG_PROBE_TIMER32 == 0
+    #define PROBE_TIMER     LPC_CT32B0
+  #else
+    #define PROBE_TIMER     LPC_CT32B1
+  #endif
+  #define probeGetTicks()   (PROBE_TIMER->TC)
+#endif
+
+void probeTicksInit(void);
+
+#endif
+
+#ifdef CFG_PROBE
+
+/**************************************************************************/
+/*!
+    @brief  Starts measuring a section of code.  'name' is a plain
+            identifier (not a string), and the matching PROBE_END must be
+            in the same scope
+
+    @code
+    PROBE_BEGIN(accel);
+    error = lsm303accelGetSensorEvent(&event);
+    PROBE_END(accel);
+    @endcode
+*/
+/**************************************************************************/
+#define PROBE_BEGIN(name)   uint32_t _probeStart_##name = probeGetTicks()
+
+/**************************************************************************/
+/*!
+    @brief  Ends the measurement started by PROBE_BEGIN, and adds it to
+            the statistics of the probe.  The probe is added to the table
+            the first time this runs, and PROBE_ENDs with the same name
+            share the same statistics
+*/
+/**************************************************************************/
+#define PROBE_END(name) \
+        do{\
+          static probe_t *_probe;\
+          uint32_t _probeTicks = probeGetTicks() - _probeStart_##name;\
+          if (!_probe) _probe = probeRegister(#name);\
+          probeRecord(_probe, _probeTicks);\
+        } while(0)
+
+void           probeInit(void);
+void           probeReset(void);
+probe_t       *probeRegister(const char *name);
+void           probeRecord(probe_t *probe, uint32_t ticks);
+uint8_t        probeCount(void);
+const probe_t *probeGet(uint8_t index);
+uint32_t       probeGetMean(const probe_t *probe);
+
+#else
+
+#define PROBE_BEGIN(name)
+#define PROBE_END(name)
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -38,6 +38,7 @@
 #ifdef CFG_ENABLE_TIMER32
 
 #include "timer32.h"
+#include "core/isrtrace/isrtrace.h"
 
 /**************************************************************************/
 /*!
@@ -52,6 +53,8 @@ void CT32B0_IRQHandler(void)
   #error "timer32.c: No MCU defined"
 #endif
 {
+  ISRTRACE_ENTER();
+
   /* Handle match events */
   if (LPC_CT32B0->IR & (0x01 << 0))
   {
@@ -88,6 +91,7 @@ void CT32B0_IRQHandler(void)
     LPC_CT32B0->IR = 0x1 << 7;
   }
 
+  ISRTRACE_EXIT();
   return;
 }
 
@@ -104,6 +108,8 @@ void CT32B1_IRQHandler(void)
   #error "timer32.c: No MCU defined"
 #endif
 {
+  ISRTRACE_ENTER();
+
   /* Handle match events */
   if (LPC_CT32B1->IR & (0x01 << 0))
   {
@@ -140,6 +146,7 @@ void CT32B1_IRQHandler(void)
     LPC_CT32B1->IR = 0x1 << 7;
   }
 
+  ISRTRACE_EXIT();
   return;
 }
 
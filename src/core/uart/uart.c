@@ -45,6 +45,7 @@
 #include <string.h>
 
 #include "uart.h"
+#include "core/isrtrace/isrtrace.h"
 
 /**************************************************************************/
 /*!
@@ -71,6 +72,8 @@ void USART_IRQHandler(void)
   uint8_t IIRValue, LSRValue;
   uint8_t Dummy = Dummy;
 
+  ISRTRACE_ENTER();
+
   IIRValue = LPC_USART->IIR;
   IIRValue &= ~(USART_IIR_IntStatus_MASK); /* skip pending bit in IIR */
   IIRValue &= USART_IIR_IntId_MASK;        /* check bit 1~3, interrupt identification */
@@ -86,6 +89,7 @@ void USART_IRQHandler(void)
       /* Read LSR will clear the interrupt */
       uart_pcb.status = LSRValue;
       Dummy = LPC_USART->RBR;  /* Dummy read on RX to clear interrupt, then bail out */
+      ISRTRACE_EXIT();
       return;
     }
     // No error and receive data is ready
@@ -125,6 +129,7 @@ void USART_IRQHandler(void)
       uart_pcb.pending_tx_data= 1;
     }
   }
+  ISRTRACE_EXIT();
   return;
 }
 
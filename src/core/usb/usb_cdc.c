@@ -187,17 +187,52 @@ bool usb_cdc_getc(uint8_t *c)
 uint16_t usb_cdc_send(uint8_t* buffer, uint16_t count)
 {
   uint16_t i=0;
+  uint32_t start_time = delayGetSecondsActive();
 
   ASSERT(buffer && count, 0);
 
-  while (i < count && usb_cdc_putc(buffer[i]) )
+  // Copy as much as fits in one go, blocking until the rest is sent
+  while (i < count)
   {
-    i++;
+    uint16_t written = fifo_writeArray(&ff_cdc_tx, buffer+i, count-i);
+    if (written)
+    {
+      i += written;
+      start_time = delayGetSecondsActive();
+    }
+    else if (delayGetSecondsActive() - start_time > 2)
+    {
+      isConnected = false;
+      fifo_clear(&ff_cdc_tx);
+      break;
+    }
   }
 
   return i;
 }
 
+/**************************************************************************/
+/*!
+    @brief Writes as much of the supplied buffer as currently fits in the
+           USB CDC transmit buffer, without waiting for any space to be
+           freed up
+
+    @param[in]  buffer
+                Pointer to the buffer that should be written via USB CDC
+    @param[in]  count
+                The number of bytes to write
+
+    @returns  The number of bytes added to the TX buffer (any remaining
+              bytes were not sent)
+*/
+/**************************************************************************/
+uint16_t usb_cdc_trySend(uint8_t* buffer, uint16_t count)
+{
+  ASSERT(buffer && count, 0);
+
+  return fifo_writeArray(&ff_cdc_tx, buffer, count);
+}
+
 /**************************************************************************/
 /*!
     @brief Reads the incoming CDC buffer up to a maximum number of bytes
@@ -51,6 +51,7 @@ bool usb_cdc_getc(uint8_t *c);
 bool usb_cdc_isConnected();
 
 uint16_t usb_cdc_send(uint8_t* buffer, uint16_t count);
+uint16_t usb_cdc_trySend(uint8_t* buffer, uint16_t count);
 uint16_t usb_cdc_recv(uint8_t* buffer, uint16_t max);
 
 ErrorCode_t usb_cdc_init(USBD_HANDLE_T hUsb, USB_INTERFACE_DESCRIPTOR const *const pControlIntfDesc, USB_INTERFACE_DESCRIPTOR const *const pDataIntfDesc, uint32_t* mem_base, uint32_t* mem_size);
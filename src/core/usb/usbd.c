@@ -47,6 +47,7 @@
 
 #include "usbd.h"
 #include "core/iap/iap.h"
+#include "core/isrtrace/isrtrace.h"
 
 #ifdef CFG_USB
 
@@ -250,7 +251,9 @@ ErrorCode_t usb_init(void)
 /**************************************************************************/
 void USB_IRQHandler(void)
 {
+  ISRTRACE_ENTER();
   USBD_API->hw->ISR(g_hUsb);
+  ISRTRACE_EXIT();
 }
 
 #endif
@@ -51,6 +51,11 @@
 
 uint8_t _ssd1306buffer[SSD1306_LCDWIDTH * SSD1306_LCDHEIGHT / 8];
 
+/* Columns of each page that changed since the last refresh, from
+   _ssd1306dirtyStart to _ssd1306dirtyEnd - 1 (clean if the end is 0) */
+static uint8_t _ssd1306dirtyStart[SSD1306_PAGES];
+static uint8_t _ssd1306dirtyEnd[SSD1306_PAGES];
+
 extern volatile uint8_t   I2CMasterBuffer[I2C_BUFSIZE];
 extern volatile uint8_t   I2CSlaveBuffer[I2C_BUFSIZE];
 extern volatile uint32_t  I2CReadLength, I2CWriteLength;
@@ -107,6 +112,104 @@ err_t ssd1306SendData(uint8_t data)
   return ERROR_NONE;
 }
 
+/**************************************************************************/
+/*!
+    @brief Sends several commands in a single I2C transaction
+
+    @param[in]  cmds
+                The command bytes (and their parameters) to send
+    @param[in]  len
+                The number of bytes in cmds (max I2C_BUFSIZE - 2)
+*/
+/**************************************************************************/
+static err_t ssd1306SendCommands(const uint8_t *cmds, uint8_t len)
+{
+  uint8_t i;
+
+  ASSERT(len <= I2C_BUFSIZE - 2, ERROR_INVALIDPARAMETER);
+
+  I2CWriteLength = len + 2;
+  I2CReadLength = 0;
+  I2CMasterBuffer[0] = SSD1306_I2C_ADDRESS;
+  I2CMasterBuffer[1] = 0x00;   /* Co = 0, D/C = 0: every following byte is a command */
+  for (i = 0; i < len; i++)
+  {
+    I2CMasterBuffer[i + 2] = cmds[i];
+  }
+  ASSERT_I2C_STATUS(i2cEngine());
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief Sends a block of display data, in as few I2C transactions as
+           the I2C buffer allows
+
+    @param[in]  data
+                The bytes to write to the display RAM
+    @param[in]  len
+                The number of bytes in data
+*/
+/**************************************************************************/
+static err_t ssd1306SendDataBlock(const uint8_t *data, uint16_t len)
+{
+  uint8_t i, count;
+
+  while (len)
+  {
+    count = (len > I2C_BUFSIZE - 2) ? I2C_BUFSIZE - 2 : len;
+
+    I2CWriteLength = count + 2;
+    I2CReadLength = 0;
+    I2CMasterBuffer[0] = SSD1306_I2C_ADDRESS;
+    I2CMasterBuffer[1] = 0x40;   /* Co = 0, D/C = 1: every following byte is data */
+    for (i = 0; i < count; i++)
+    {
+      I2CMasterBuffer[i + 2] = *data++;
+    }
+    ASSERT_I2C_STATUS(i2cEngine());
+
+    len -= count;
+  }
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief Marks columns x0..x1 of a page as changed since the last refresh
+*/
+/**************************************************************************/
+static void ssd1306MarkDirty(uint8_t page, uint8_t x0, uint8_t x1)
+{
+  if (_ssd1306dirtyEnd[page] == 0)
+  {
+    _ssd1306dirtyStart[page] = x0;
+    _ssd1306dirtyEnd[page] = x1 + 1;
+    return;
+  }
+  if (x0 < _ssd1306dirtyStart[page]) _ssd1306dirtyStart[page] = x0;
+  if (x1 >= _ssd1306dirtyEnd[page]) _ssd1306dirtyEnd[page] = x1 + 1;
+}
+
+/**************************************************************************/
+/*!
+    @brief Marks the whole display as changed, so that the next refresh
+           sends the entire buffer
+*/
+/**************************************************************************/
+static void ssd1306MarkAllDirty(void)
+{
+  uint8_t page;
+
+  for (page = 0; page < SSD1306_PAGES; page++)
+  {
+    _ssd1306dirtyStart[page] = 0;
+    _ssd1306dirtyEnd[page] = SSD1306_LCDWIDTH;
+  }
+}
+
 /**************************************************************************/
 /*!
     @brief  Draws a single graphic character using the supplied font
@@ -114,14 +217,12 @@ err_t ssd1306SendData(uint8_t data)
 /**************************************************************************/
 void ssd1306DrawChar(uint16_t x, uint16_t y, uint8_t c, struct FONT_DEF font)
 {
-  uint8_t col;
+  uint8_t col, bits, mask, page, shift;
   uint8_t column[font.u8Width];
-  uint16_t xoffset, yoffset;
+  uint16_t xoffset, width;
 
-  /* Make sure we are not exceeding the display limits
-     This also gets checked in ssd1306DrawPixel, but if we start
-     outside the limits we can avoid some unecessary work at the outset */
-  if ((x > SSD1306_LCDWIDTH) || (y > SSD1306_LCDHEIGHT))
+  /* Make sure we are not exceeding the display limits */
+  if ((x >= SSD1306_LCDWIDTH) || (y >= SSD1306_LCDHEIGHT))
     return;
 
   /* Check if the requested character is available */
@@ -142,20 +243,32 @@ void ssd1306DrawChar(uint16_t x, uint16_t y, uint8_t c, struct FONT_DEF font)
     }
   }
 
-  /* Render each column */
-  for (xoffset = 0; xoffset < font.u8Width; xoffset++)
+  /* Only the first u8Height + 1 rows of each column are drawn */
+  mask = (font.u8Height >= 7) ? 0xFF : (1 << (font.u8Height + 1)) - 1;
+  page = y / 8;
+  shift = y % 8;
+  width = (x + font.u8Width > SSD1306_LCDWIDTH) ? SSD1306_LCDWIDTH - x : font.u8Width;
+  if (width == 0)
+    return;
+
+  /* Render each column, OR'ing it into one or two pages of the buffer */
+  for (xoffset = 0; xoffset < width; xoffset++)
   {
-    for (yoffset = 0; yoffset < (font.u8Height + 1); yoffset++)
+    bits = column[xoffset] & mask;
+    if (page < SSD1306_PAGES)
     {
-      uint8_t bit = 0x00;
-      bit = (column[xoffset] << (8 - (yoffset + 1)));   /* Shift current row bit left */
-      bit = (bit >> 7);                                 /* Shift current row but right (results in 0x01 for black, and 0x00 for white) */
-      if (bit)
-      {
-        ssd1306DrawPixel(x + xoffset, y + yoffset);
-      }
+      _ssd1306buffer[x + xoffset + page * SSD1306_LCDWIDTH] |= bits << shift;
+    }
+    if (shift && (page + 1 < SSD1306_PAGES))
+    {
+      _ssd1306buffer[x + xoffset + (page + 1) * SSD1306_LCDWIDTH] |= bits >> (8 - shift);
     }
   }
+
+  if (page < SSD1306_PAGES)
+    ssd1306MarkDirty(page, x, x + width - 1);
+  if (shift && (page + 1 < SSD1306_PAGES))
+    ssd1306MarkDirty(page + 1, x, x + width - 1);
 }
 
 /**************************************************************************/
@@ -213,6 +326,10 @@ err_t ssd1306Init(uint8_t vccstate)
   /* Enable the OLED panel */
   ASSERT_STATUS(ssd1306SendCommand(SSD1306_DISPLAYON));
 
+  /* The display RAM contents are unknown, so the first refresh sends
+     the whole buffer */
+  ssd1306MarkAllDirty();
+
   return ERROR_NONE;
 }
 
@@ -228,10 +345,17 @@ err_t ssd1306Init(uint8_t vccstate)
 /**************************************************************************/
 void ssd1306DrawPixel(uint8_t x, uint8_t y)
 {
+  uint8_t *b;
+
   if ((x >= SSD1306_LCDWIDTH) || (y >= SSD1306_LCDHEIGHT))
     return;
 
-  _ssd1306buffer[x+ (y/8)*SSD1306_LCDWIDTH] |= (1 << y%8);
+  b = &_ssd1306buffer[x+ (y/8)*SSD1306_LCDWIDTH];
+  if (!(*b & (1 << y%8)))
+  {
+    *b |= (1 << y%8);
+    ssd1306MarkDirty(y/8, x, x);
+  }
 }
 
 /**************************************************************************/
@@ -246,10 +370,17 @@ void ssd1306DrawPixel(uint8_t x, uint8_t y)
 /**************************************************************************/
 void ssd1306ClearPixel(uint8_t x, uint8_t y)
 {
+  uint8_t *b;
+
   if ((x >= SSD1306_LCDWIDTH) || (y >= SSD1306_LCDHEIGHT))
     return;
 
-  _ssd1306buffer[x+ (y/8)*SSD1306_LCDWIDTH] &= ~(1 << y%8);
+  b = &_ssd1306buffer[x+ (y/8)*SSD1306_LCDWIDTH];
+  if (*b & (1 << y%8))
+  {
+    *b &= ~(1 << y%8);
+    ssd1306MarkDirty(y/8, x, x);
+  }
 }
 
 /**************************************************************************/
@@ -278,25 +409,44 @@ uint8_t ssd1306GetPixel(uint8_t x, uint8_t y)
 void ssd1306ClearScreen()
 {
   memset(_ssd1306buffer, 0x00, sizeof(_ssd1306buffer));
+  ssd1306MarkAllDirty();
 }
 
 /**************************************************************************/
 /*!
     @brief Renders the contents of the pixel buffer on the LCD
+
+    Only the columns that changed since the last refresh are sent: for
+    each page with changes, a single command transaction selects the
+    changed column range (horizontal addressing mode), followed by the
+    data in blocks of up to I2C_BUFSIZE - 2 bytes per transaction.  A
+    page that can't be sent stays dirty for the next refresh.
 */
 /**************************************************************************/
-void ssd1306Refresh(void)
+err_t ssd1306Refresh(void)
 {
-  uint16_t i;
-
-  ssd1306SendCommand(SSD1306_SETLOWCOLUMN | 0x0);  // low col = 0
-  ssd1306SendCommand(SSD1306_SETHIGHCOLUMN | 0x0);  // hi col = 0
-  ssd1306SendCommand(SSD1306_SETSTARTLINE | 0x0); // line #0
+  uint8_t page;
+  uint8_t cmds[6];
 
-  for (i=0; i < sizeof(_ssd1306buffer); i++)
+  for (page = 0; page < SSD1306_PAGES; page++)
   {
-    ssd1306SendData(_ssd1306buffer[i]);
+    if (_ssd1306dirtyEnd[page] == 0)
+      continue;
+
+    cmds[0] = SSD1306_COLUMNADDR;
+    cmds[1] = _ssd1306dirtyStart[page];
+    cmds[2] = _ssd1306dirtyEnd[page] - 1;
+    cmds[3] = SSD1306_PAGEADDR;
+    cmds[4] = page;
+    cmds[5] = page;
+    ASSERT_STATUS(ssd1306SendCommands(cmds, sizeof(cmds)));
+    ASSERT_STATUS(ssd1306SendDataBlock(&_ssd1306buffer[page * SSD1306_LCDWIDTH + _ssd1306dirtyStart[page]],
+                                       _ssd1306dirtyEnd[page] - _ssd1306dirtyStart[page]));
+
+    _ssd1306dirtyEnd[page] = 0;
   }
+
+  return ERROR_NONE;
 }
 
 /**************************************************************************/
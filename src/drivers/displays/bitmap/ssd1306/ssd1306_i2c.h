@@ -77,6 +77,8 @@ extern "C" {
       #define SSD1306_LCDWIDTH            (128)
       #define SSD1306_LCDHEIGHT           (32)
     #endif
+
+    #define SSD1306_PAGES                 (SSD1306_LCDHEIGHT / 8)
 /*=========================================================================*/
 
 
@@ -108,6 +110,8 @@ extern "C" {
     #define SSD1306_SETHIGHCOLUMN         0x10
     #define SSD1306_SETSTARTLINE          0x40
     #define SSD1306_MEMORYMODE            0x20
+    #define SSD1306_COLUMNADDR            0x21
+    #define SSD1306_PAGEADDR              0x22
     #define SSD1306_COMSCANINC            0xC0
     #define SSD1306_COMSCANDEC            0xC8
     #define SSD1306_SEGREMAP              0xA0
@@ -122,7 +126,7 @@ void    ssd1306DrawPixel ( uint8_t x, uint8_t y );
 void    ssd1306ClearPixel ( uint8_t x, uint8_t y );
 uint8_t ssd1306GetPixel ( uint8_t x, uint8_t y );
 void    ssd1306ClearScreen ( void );
-void    ssd1306Refresh ( void );
+err_t   ssd1306Refresh ( void );
 void    ssd1306DrawString( uint16_t x, uint16_t y, char* text, struct FONT_DEF font );
 void    ssd1306ShiftFrameBuffer( uint8_t height );
 
@@ -52,64 +52,201 @@ const uint16_t COLORTABLE_AA4_BLACKONWHITE[16] = { 0xFFFF, 0xE71C, 0xD69A, 0xC61
 /*                                                                        */
 /**************************************************************************/
 
+// Pixels decoded per lcdStreamPixels/lcdBlit call (wider glyph rows are
+// sent in several chunks)
+#define AAFONTS_ROWBUFFER_SIZE  (32)
+
+// Decodes glyphs into pixel values rather than colors, so that transparent
+// text can skip the value 0 pixels
+static const uint16_t aafontsPixelValues[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+typedef struct
+{
+  uint16_t bgColor;
+  uint16_t foreColor;
+  uint8_t  tableSize;                   /* 4 or 16, 0 if the entry is unused */
+  uint32_t lastUsed;                    /* aafontsColorCacheTick when last returned */
+  uint16_t colorTable[16];
+} aafontsColorCacheEntry_t;
+
+// Decoder state for an AAFONTS_ENCODING_RLE glyph
+typedef struct
+{
+  const uint8_t  *data;                 /* Next byte of the glyph data */
+  const uint16_t *colorTable;
+  uint8_t  bitsPerPixel;                /* 2 or 4 */
+  uint8_t  mask;                        /* Maximum pixel value */
+  uint8_t  count;                       /* Pixels left in the current run or literal */
+  bool     literal;
+  uint16_t color;                       /* Run color */
+  uint8_t  bits;                        /* Literal byte being unpacked */
+  uint8_t  bitsLeft;                    /* Bits of 'bits' not used yet */
+} aafontsRleState_t;
+
+static aafontsColorCacheEntry_t aafontsColorCache[AAFONTS_COLORCACHE_SIZE];
+static uint32_t aafontsColorCacheTick = 0;
+
 /**************************************************************************/
 /*!
-    @brief Renders a single AA2 character on the screen
+    @brief Decodes part of a glyph row into RGB565 pixels
+
+    @param[in]  rowData
+                Pointer to the first byte of the glyph row
+    @param[in]  first
+                Column of the first pixel to decode
+    @param[in]  count
+                Number of pixels to decode
+    @param[in]  fontType
+                AAFONTS_FONTTYPE_AA2 or AAFONTS_FONTTYPE_AA4
+    @param[in]  colorTable
+                Pointer to the 4 or 16 element color lookup table
+    @param[out] buffer
+                Receives the count decoded pixels
+*/
+/**************************************************************************/
+static void aafontsDecodeRow(const uint8_t *rowData, uint16_t first, uint16_t count, aafontsFontType_t fontType, const uint16_t *colorTable, uint16_t *buffer)
+{
+  uint16_t w, last;
 
-    This text rendering method used a lookup table of pre-calculated
-    colors, and doesn't require any reads from the LCD (not all displays
-    support reading pixels back).  This offers the best performance and
-    high-quality text, but can only be used on solid backgrounds where
-    the bgcolor is known.
+  last = first + count;
+
+  if (fontType == AAFONTS_FONTTYPE_AA2)
+  {
+    // Four pixels per byte, left-most pixel in the two MSBs
+    for (w = first; w < last; w++)
+    {
+      *buffer++ = colorTable[(rowData[w >> 2] >> (6 - ((w & 3) << 1))) & 0x03];
+    }
+  }
+  else
+  {
+    // Two pixels per byte, left-most pixel in the upper nibble
+    for (w = first; w < last; w++)
+    {
+      *buffer++ = colorTable[(rowData[w >> 1] >> ((w & 1) ? 0 : 4)) & 0x0F];
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief Decodes the next pixels of an RLE glyph into RGB565 pixels
+
+    RLE glyphs (AAFONTS_ENCODING_RLE) are a single stream covering every
+    row of the glyph, left to right and top to bottom, without padding
+    at the end of the rows.  Each token is one byte:
+
+    0nnnnnnn    A literal of n+1 pixels (1..128), packed in the following
+                bytes like the raw format (2 or 4 bits per pixel, MSBs
+                first), and padded to a whole byte
+    10nnnnnn    A run of n+1 pixels (1..64) with value 0 (bg color)
+    11nnnnnn    A run of n+1 pixels (1..64) with the maximum value
+                (fore color)
+
+    Runs and literals can continue onto the next row.  tools/fontpack
+    generates the RLE fonts from the raw ones.
+
+    @param[in]  rle
+                Decoder state, which starts at the glyph's charData
+    @param[in]  count
+                Number of pixels to decode
+    @param[out] buffer
+                Receives the count decoded pixels
+*/
+/**************************************************************************/
+static void aafontsDecodeRle(aafontsRleState_t *rle, uint16_t count, uint16_t *buffer)
+{
+  uint8_t token, n;
+
+  while (count)
+  {
+    if (rle->count == 0)
+    {
+      token = *rle->data++;
+      if (token & 0x80)
+      {
+        rle->count = (token & 0x3F) + 1;
+        rle->color = rle->colorTable[(token & 0x40) ? rle->mask : 0];
+        rle->literal = false;
+      }
+      else
+      {
+        rle->count = token + 1;
+        rle->bitsLeft = 0;
+        rle->literal = true;
+      }
+    }
+
+    n = (count < rle->count) ? count : rle->count;
+    count -= n;
+    rle->count -= n;
+
+    if (rle->literal)
+    {
+      while (n--)
+      {
+        if (rle->bitsLeft == 0)
+        {
+          rle->bits = *rle->data++;
+          rle->bitsLeft = 8;
+        }
+        rle->bitsLeft -= rle->bitsPerPixel;
+        *buffer++ = rle->colorTable[(rle->bits >> rle->bitsLeft) & rle->mask];
+      }
+    }
+    else
+    {
+      while (n--)
+      {
+        *buffer++ = rle->color;
+      }
+    }
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief Draws the non-zero pixel values of part of a glyph row, one
+           lcdBlit per run of visible pixels (for transparent text)
 
     @param[in]  x
-                Top-left x position
+                x position of the first pixel
     @param[in]  y
-                Top-left y position
-    @param[in]  height
-                Font height in pixels
-    @param[in]  character
-                Pointer to the aafontsCharInfo_t array with the char data
+                y position of the row
+    @param[in]  buffer
+                The pixel values, which are replaced by their colors
+    @param[in]  count
+                Number of pixels in buffer
     @param[in]  colorTable
-                Pointer to the 4 element color lookup table
+                Pointer to the 4 or 16 element color lookup table
 */
 /**************************************************************************/
-void aafontsDrawCharAA2( uint16_t x, uint16_t y, uint16_t height, aafontsCharInfo_t character, const uint16_t * colorTable)
+static void aafontsDrawRuns(uint16_t x, uint16_t y, uint16_t *buffer, uint16_t count, const uint16_t *colorTable)
 {
-  uint16_t w, h, pos;
-  uint8_t color;
+  uint16_t i = 0, start;
 
-  for (h = 0; h < height; h++)
+  while (i < count)
   {
-    pos = 0;
-    for (w = 0; w < character.width; w++)
+    // Skip the background
+    while ((i < count) && (buffer[i] == 0)) i++;
+
+    start = i;
+    while ((i < count) && (buffer[i] != 0))
     {
-      color = character.charData[h*character.bytesPerRow + w/4];
-      switch (pos)
-      {
-        case 0:
-          color = (color >> 6) & 0x03;
-          break;
-        case 1:
-          color = (color >> 4) & 0x03;
-          break;
-        case 2:
-          color = (color >> 2) & 0x03;
-          break;
-        case 3:
-          color = color & 0x03;
-          break;
-      }
-      if (color) lcdDrawPixel(x+w, y+h, colorTable[color & 0xF]);
-      pos++;
-      if (pos == 4) pos = 0;
+      buffer[i] = colorTable[buffer[i]];
+      i++;
+    }
+
+    if (i > start)
+    {
+      lcdBlit(x + start, y, i - start, 1, &buffer[start]);
     }
   }
-} 
+}
 
 /**************************************************************************/
 /*!
-    @brief Renders a single AA4 character on the screen
+    @brief Renders a single AA2 or AA4 character on the screen
 
     This text rendering method used a lookup table of pre-calculated
     colors, and doesn't require any reads from the LCD (not all displays
@@ -117,31 +254,148 @@ void aafontsDrawCharAA2( uint16_t x, uint16_t y, uint16_t height, aafontsCharInf
     high-quality text, but can only be used on solid backgrounds where
     the bgcolor is known.
 
+    Each glyph row is decoded into a small RGB565 buffer and streamed
+    into a single window covering the whole glyph, rather than setting
+    the GRAM address for every pixel.  The whole character cell is
+    written, with pixel value 0 drawn as colorTable[0] (the bg color).
+    Anything past the right or bottom edge of the screen is clipped.
+
+    Transparent characters leave the value 0 pixels alone instead, and
+    send each run of other pixels with lcdBlit, so they can be drawn
+    over gradients or images (the anti-aliased pixels are still blended
+    with colorTable[0], so it should be close to the background).
+
     @param[in]  x
                 Top-left x position
     @param[in]  y
                 Top-left y position
-    @param[in]  height
-                Font height in pixels
+    @param[in]  font
+                Pointer to the aafontsFont_t the character belongs to
     @param[in]  character
-                Pointer to the aafontsCharInfo_t array with the char data
+                Pointer to the aafontsCharInfo_t with the char data
     @param[in]  colorTable
-                Pointer to the 16 element color lookup table
+                Pointer to the 4 or 16 element color lookup table
+    @param[in]  transparent
+                Skip the value 0 pixels rather than drawing the bg color
 */
 /**************************************************************************/
-void aafontsDrawCharAA4( uint16_t x, uint16_t y, uint16_t height, aafontsCharInfo_t character, const uint16_t * colorTable)
+static void aafontsDrawChar(uint16_t x, uint16_t y, const aafontsFont_t *font, const aafontsCharInfo_t *character, const uint16_t *colorTable, bool transparent)
 {
-  uint16_t w, h;
-  uint8_t color;
+  const uint16_t *decodeTable = transparent ? aafontsPixelValues : colorTable;
+  uint16_t buffer[AAFONTS_ROWBUFFER_SIZE];
+  uint16_t width, height, h, w, count, visible;
+  uint16_t lcdWidth, lcdHeight;
+  const uint8_t *rowData;
+  aafontsRleState_t rle = { 0 };
+
+  lcdWidth = lcdGetWidth();
+  lcdHeight = lcdGetHeight();
+  height = font->fontHeight;
+
+  if ((x >= lcdWidth) || (y >= lcdHeight) || (character->width == 0) || (height == 0))
+    return;
+
+  // Clip the glyph to the screen
+  width = character->width;
+  if (x + width > lcdWidth) width = lcdWidth - x;
+  if (y + height > lcdHeight) height = lcdHeight - y;
+
+  #ifndef CFG_TFTLCD_FRAMEBUFFER
+  if (!transparent)
+  {
+    lcdSetWindow(x, y, x + width - 1, y + height - 1);
+  }
+  #endif
+
+  rowData = character->charData;
+  if (font->encoding == AAFONTS_ENCODING_RLE)
+  {
+    rle.data = character->charData;
+    rle.colorTable = decodeTable;
+    rle.bitsPerPixel = font->fontType;
+    rle.mask = (1 << font->fontType) - 1;
+    rle.count = 0;
+  }
 
   for (h = 0; h < height; h++)
   {
-    for (w = 0; w < character.width; w++)
+    // RLE rows are decoded to the end, even when clipped, since the
+    // next row starts where this one stops
+    for (w = 0; w < character->width; w += count)
+    {
+      count = character->width - w;
+      if (count > AAFONTS_ROWBUFFER_SIZE) count = AAFONTS_ROWBUFFER_SIZE;
+      if (font->encoding == AAFONTS_ENCODING_RLE)
+      {
+        aafontsDecodeRle(&rle, count, buffer);
+      }
+      else
+      {
+        if (w >= width) break;
+        aafontsDecodeRow(rowData, w, count, font->fontType, decodeTable, buffer);
+      }
+
+      visible = (w >= width) ? 0 : ((w + count > width) ? width - w : count);
+      if (visible && transparent)
+      {
+        aafontsDrawRuns(x + w, y + h, buffer, visible, colorTable);
+      }
+      else if (visible)
+      {
+        #ifdef CFG_TFTLCD_FRAMEBUFFER
+        // lcdfb.c buffers lcdBlit, but not the raw window functions
+        lcdBlit(x + w, y + h, visible, 1, buffer);
+        #else
+        lcdStreamPixels(buffer, visible);
+        #endif
+      }
+    }
+    rowData += character->bytesPerRow;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a string one character at a time, leaving the value 0
+            pixels alone if transparent is true
+*/
+/**************************************************************************/
+static void aafontsDrawStringInternal(uint16_t x, uint16_t y, const uint16_t * colorTable, const aafontsFont_t *font, char *str, bool transparent)
+{
+  uint16_t currentX, charWidth, characterToOutput;
+  const aafontsCharInfo_t *charInfo;
+
+  // set current x, y to that of requested
+  currentX = x;
+
+  // while not NULL
+  while (*str != '\0')
+  {
+    // get character to output
+    characterToOutput = *str;
+
+    // Check if the character is within the font boundaries
+    if ((characterToOutput > font->lastChar) || (characterToOutput < font->firstChar))
+    {
+      // Character is out of bounds
+      // Insert space instead
+      charWidth = font->unknownCharWidth;
+    }
+    else
     {
-      color = character.charData[h*character.bytesPerRow + w/2];
-      if (!(w % 2)) color = (color >> 4);
-      if (color) lcdDrawPixel(x+w, y+h, colorTable[color & 0xF]);
+      // get char info
+      charInfo = &(font->charTable[characterToOutput - font->firstChar]);    
+      // get width from char info
+      charWidth = charInfo->width;
+      // Render the character, one window per glyph
+      aafontsDrawChar(currentX, y, font, charInfo, &colorTable[0], transparent);
     }
+    
+    // Adjust x for the next character
+    currentX += charWidth;
+    
+    // next char in string
+    str++;
   }
 }
 
@@ -155,6 +409,10 @@ void aafontsDrawCharAA4( uint16_t x, uint16_t y, uint16_t height, aafontsCharInf
 /*!
     @brief  Draws a string using the supplied anti-aliased font
 
+    The whole character cells are written, with their background in
+    colorTable[0].  Use aafontsDrawStringTransparent to draw text over
+    a gradient or an image.
+
     @param[in]  x
                 Starting x co-ordinate
     @param[in]  y
@@ -194,49 +452,34 @@ void aafontsDrawCharAA4( uint16_t x, uint16_t y, uint16_t height, aafontsCharInf
 /**************************************************************************/
 void aafontsDrawString(uint16_t x, uint16_t y, const uint16_t * colorTable, const aafontsFont_t *font, char *str)
 {
-  uint16_t currentX, charWidth, characterToOutput;
-  const aafontsCharInfo_t *charInfo;
+  aafontsDrawStringInternal(x, y, colorTable, font, str, false);
+}
 
-  // set current x, y to that of requested
-  currentX = x;
+/**************************************************************************/
+/*!
+    @brief  Draws a string using the supplied anti-aliased font, without
+            drawing its background (pixel value 0)
 
-  // while not NULL
-  while (*str != '\0')
-  {
-    // get character to output
-    characterToOutput = *str;
+    This is slower than aafontsDrawString since each run of visible
+    pixels is a separate lcdBlit, but the text can be drawn over a
+    gradient or an image.  colorTable[0] should still be close to the
+    background, since the anti-aliased pixels are blended with it.
 
-    // Check if the character is within the font boundaries
-    if ((characterToOutput > font->lastChar) || (characterToOutput < font->firstChar))
-    {
-      // Character is out of bounds
-      // Insert space instead
-      charWidth = font->unknownCharWidth;
-    }
-    else
-    {
-      // get char info
-      charInfo = &(font->charTable[characterToOutput - font->firstChar]);    
-      // get width from char info
-      charWidth = charInfo->width;
-      // Send individual characters
-      switch (font->fontType)
-      {
-        case AAFONTS_FONTTYPE_AA2:
-          aafontsDrawCharAA2(currentX, y, font->fontHeight, *charInfo, &colorTable[0]);
-          break;
-        case AAFONTS_FONTTYPE_AA4:
-          aafontsDrawCharAA4(currentX, y, font->fontHeight, *charInfo, &colorTable[0]);
-          break;
-      }
-    }
-    
-    // Adjust x for the next character
-    currentX += charWidth;
-    
-    // next char in string
-    str++;
-  }
+    @param[in]  x
+                Starting x co-ordinate
+    @param[in]  y
+                Starting y co-ordinate
+    @param[in]  colorTable
+                The color lookup table to use for the antialiased pixels
+    @param[in]  font
+                Pointer to the aafontsFont_t to use when drawing the string
+    @param[in]  str
+                The string to render
+*/
+/**************************************************************************/
+void aafontsDrawStringTransparent(uint16_t x, uint16_t y, const uint16_t * colorTable, const aafontsFont_t *font, char *str)
+{
+  aafontsDrawStringInternal(x, y, colorTable, font, str, true);
 }
 
 /**************************************************************************/
@@ -380,3 +623,100 @@ void aafontsCalculateColorTable(uint16_t bgColor, uint16_t foreColor, uint16_t *
     colorTable[i] = colorsAlphaBlend(bgColor, foreColor, 100-i*stepsize);
   }
 }
+
+/**************************************************************************/
+/*!
+    @brief  Returns a 4 or 16 color lookup table between the specified
+            bg and fore colors, from a small cache of recently used tables
+
+    Calculating a color table takes one alpha-blend per entry, so rather
+    than calling aafontsCalculateColorTable before every string, the last
+    AAFONTS_COLORCACHE_SIZE tables are kept and the least recently used
+    one is replaced when a new bg/fore/type combination is requested.
+
+    @note   The returned table stays valid until AAFONTS_COLORCACHE_SIZE
+            other combinations have been requested, so it should be used
+            straight away rather than stored.
+
+    @param[in]  bgColor
+                The RGB565 color of the background
+    @param[in]  foreColor
+                The RGB565 fore color for the anti-aliased text
+    @param[in]  fontType
+                AAFONTS_FONTTYPE_AA2 for a 4 color table, or
+                AAFONTS_FONTTYPE_AA4 for a 16 color table
+
+    @return     Pointer to the cached color table
+
+    @section Example
+
+    @code
+
+    #include "drivers/displays/graphic/aafonts.h"
+    #include "drivers/displays/graphic/aafonts/aa2/DejaVuSansCondensed14_AA2.h"
+
+    drawRectangleFilled(10, 10, 200, 50, COLOR_RED);
+    aafontsDrawString(10, 13, aafontsGetColorTable(COLOR_RED, COLOR_YELLOW, AAFONTS_FONTTYPE_AA2),
+                      &DejaVuSansCondensed14_AA2, "ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+
+    @endcode
+*/
+/**************************************************************************/
+const uint16_t *aafontsGetColorTable(uint16_t bgColor, uint16_t foreColor, aafontsFontType_t fontType)
+{
+  aafontsColorCacheEntry_t *entry;
+  uint8_t i, tableSize;
+
+  tableSize = (fontType == AAFONTS_FONTTYPE_AA4) ? 16 : 4;
+
+  // Look for a match, keeping track of the least recently used entry
+  entry = &aafontsColorCache[0];
+  for (i = 0; i < AAFONTS_COLORCACHE_SIZE; i++)
+  {
+    if ((aafontsColorCache[i].tableSize == tableSize) &&
+        (aafontsColorCache[i].bgColor == bgColor) &&
+        (aafontsColorCache[i].foreColor == foreColor))
+    {
+      entry = &aafontsColorCache[i];
+      entry->lastUsed = ++aafontsColorCacheTick;
+      return entry->colorTable;
+    }
+    if (aafontsColorCache[i].lastUsed < entry->lastUsed)
+    {
+      entry = &aafontsColorCache[i];
+    }
+  }
+
+  // Not cached, replace the least recently used (or an unused) entry
+  aafontsCalculateColorTable(bgColor, foreColor, entry->colorTable, tableSize);
+  entry->bgColor = bgColor;
+  entry->foreColor = foreColor;
+  entry->tableSize = tableSize;
+  entry->lastUsed = ++aafontsColorCacheTick;
+
+  return entry->colorTable;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a string using the supplied anti-aliased font, with a
+            cached color table for the specified bg and fore colors
+
+    @param[in]  x
+                Starting x co-ordinate
+    @param[in]  y
+                Starting y co-ordinate
+    @param[in]  bgColor
+                The RGB565 color of the background
+    @param[in]  foreColor
+                The RGB565 fore color for the anti-aliased text
+    @param[in]  font
+                Pointer to the aafontsFont_t to use when drawing the string
+    @param[in]  str
+                The string to render
+*/
+/**************************************************************************/
+void aafontsDrawStringColor(uint16_t x, uint16_t y, uint16_t bgColor, uint16_t foreColor, const aafontsFont_t *font, char *str)
+{
+  aafontsDrawString(x, y, aafontsGetColorTable(bgColor, foreColor, font->fontType), font, str);
+}
@@ -42,12 +42,23 @@ extern "C" {
 
 #include "projectconfig.h"
 
+// Number of color tables kept by aafontsGetColorTable (44 bytes of RAM each)
+#ifndef AAFONTS_COLORCACHE_SIZE
+  #define AAFONTS_COLORCACHE_SIZE (4)
+#endif
+
 typedef enum
 {
   AAFONTS_FONTTYPE_AA2 = 2,             /* AA2 Fonts (4 shades of gray) */
   AAFONTS_FONTTYPE_AA4 = 4              /* AA4 Fonts (16 shades of gray) */
 } aafontsFontType_t;
 
+typedef enum
+{
+  AAFONTS_ENCODING_RAW = 0,             /* Packed pixels, bytesPerRow bytes per row */
+  AAFONTS_ENCODING_RLE = 1              /* Run-length encoded (see aafonts.c) */
+} aafontsEncoding_t;
+
 typedef struct 
 {
   uint8_t width;                        /* Character width in pixels */
@@ -66,6 +77,7 @@ typedef struct aafontsFont_s
   uint16_t firstChar;                   /* Unicode address of the first character in the char map */
   uint16_t lastChar;                    /* Unicode address of the last character in the char map */
   const aafontsCharInfo_t *charTable;   /* Pointer to the aafontsCharInfo_t array containing the char data */
+  aafontsEncoding_t encoding;           /* Glyph data encoding (RAW if omitted) */
 } aafontsFont_t;
 
 extern const uint16_t COLORTABLE_AA2_WHITEONBLACK[4];
@@ -74,9 +86,12 @@ extern const uint16_t COLORTABLE_AA4_WHITEONBLACK[16];
 extern const uint16_t COLORTABLE_AA4_BLACKONWHITE[16];
 
 void      aafontsDrawString ( uint16_t x, uint16_t y, const uint16_t * colorTable, const aafontsFont_t *font, char *str );
+void      aafontsDrawStringTransparent ( uint16_t x, uint16_t y, const uint16_t * colorTable, const aafontsFont_t *font, char *str );
 void      aafontsCenterString ( uint16_t x, uint16_t y, const uint16_t * colorTable, const aafontsFont_t *font, char *str );
 uint16_t  aafontsGetStringWidth ( const aafontsFont_t *font, char *str );
 void      aafontsCalculateColorTable ( uint16_t bgColor, uint16_t foreColor, uint16_t *colorTable, size_t tableSize );
+const uint16_t *aafontsGetColorTable ( uint16_t bgColor, uint16_t foreColor, aafontsFontType_t fontType );
+void      aafontsDrawStringColor ( uint16_t x, uint16_t y, uint16_t bgColor, uint16_t foreColor, const aafontsFont_t *font, char *str );
 
 #ifdef __cplusplus
 }
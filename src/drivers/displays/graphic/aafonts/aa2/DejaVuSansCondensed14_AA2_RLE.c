@@ -0,0 +1,420 @@
+/**************************************************************************/
+/*!
+    @file     DejaVuSansCondensed14_AA2_RLE.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Run-length encoded copy of DejaVuSansCondensed14_AA2, generated
+              by tools/fontpack (do not edit)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include "DejaVuSansCondensed14_AA2_RLE.h"
+
+/* 1513 bytes of glyph data, against 2548 for DejaVuSansCondensed14_AA2 */
+const uint8_t FontDejaVuSansCondensed14_AA2_RLE[1513] = {
+  /* code 0020 */
+  0xA9,
+  /* code 0021 */
+  0x88, 0x15, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x89, 0x01, 0x60, 0x8C,
+  /* code 0022 */
+  0x8A, 0x11, 0x88, 0x22, 0x08, 0x82, 0x20, 0xA8,
+  /* code 0023 */
+  0x95, 0x49, 0x88, 0x00, 0x52, 0x00, 0x24, 0x80, 0x7F, 0xFC, 0x02, 0x20,
+  0x01, 0x88, 0x03, 0xFF, 0xE0, 0x21, 0x40, 0x08, 0x50, 0x9D,
+  /* code 0024 */
+  0x90, 0x46, 0x40, 0x0F, 0xC0, 0xC4, 0x02, 0x10, 0x0B, 0x80, 0x02, 0xD0,
+  0x04, 0x80, 0x12, 0x0F, 0xF0, 0x01, 0x00, 0x04, 0x89,
+  /* code 0025 */
+  0x94, 0x57, 0xB4, 0x08, 0x18, 0x82, 0x41, 0x48, 0x20, 0x18, 0x88, 0x00,
+  0xB4, 0x89, 0x00, 0x22, 0x54, 0x05, 0x20, 0x80, 0x82, 0x08, 0x24, 0x1F,
+  0x9E,
+  /* code 0026 */
+  0x91, 0x45, 0xBD, 0x01, 0x80, 0x01, 0x80, 0x00, 0xD0, 0x02, 0xB0, 0x62,
+  0x1C, 0x56, 0x07, 0x83, 0x02, 0x81, 0xFD, 0xB0, 0x97,
+  /* code 0027 */
+  0x86, 0x09, 0x82, 0x08, 0x20, 0x98,
+  /* code 0028 */
+  0x89, 0x29, 0x81, 0x82, 0x42, 0x02, 0x02, 0x02, 0x02, 0x01, 0x40, 0x80,
+  0x50, 0x83,
+  /* code 0029 */
+  0x88, 0x28, 0x80, 0x50, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x60, 0x90,
+  0x80, 0x85,
+  /* code 002A */
+  0x8B, 0x19, 0x41, 0x12, 0x2F, 0x0B, 0xD4, 0x44, 0x10, 0x9F,
+  /* code 002B */
+  0x9E, 0x00, 0x80, 0x87, 0x00, 0x80, 0x87, 0x00, 0x80, 0x87, 0x12, 0x80,
+  0x0B, 0xFF, 0x80, 0x08, 0x87, 0x00, 0x80, 0x87, 0x00, 0x80, 0x9E,
+  /* code 002C */
+  0x9E, 0x03, 0x92, 0x86,
+  /* code 002D */
+  0x9B, 0x03, 0x7D, 0x97,
+  /* code 002E */
+  0x9E, 0x01, 0x90, 0x88,
+  /* code 002F */
+  0x89, 0x22, 0x50, 0x90, 0x80, 0x81, 0x42, 0x02, 0x06, 0x05, 0x08, 0x8A,
+  /* code 0030 */
+  0x8F, 0x3A, 0xB8, 0x09, 0x18, 0x20, 0x30, 0x80, 0xC6, 0x02, 0x18, 0x0C,
+  0x30, 0x20, 0x91, 0x80, 0xFC, 0x96,
+  /* code 0031 */
+  0x8F, 0x3B, 0xF0, 0x09, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0,
+  0x03, 0x00, 0x0C, 0x02, 0xFE, 0x95,
+  /* code 0032 */
+  0x8E, 0x3C, 0xBE, 0x01, 0x09, 0x00, 0x18, 0x00, 0x60, 0x03, 0x00, 0x34,
+  0x02, 0x40, 0x24, 0x00, 0xFF, 0x80, 0x95,
+  /* code 0033 */
+  0x8E, 0x3B, 0xFE, 0x00, 0x0A, 0x00, 0x08, 0x00, 0x90, 0x2F, 0x00, 0x06,
+  0x00, 0x08, 0x00, 0x60, 0xFF, 0x96,
+  /* code 0034 */
+  0x90, 0x39, 0x70, 0x03, 0xC0, 0x17, 0x00, 0x8C, 0x08, 0x30, 0x60, 0xC1,
+  0xFF, 0xD0, 0x0C, 0x00, 0x30, 0x96,
+  /* code 0035 */
+  0x8E, 0x3B, 0xBF, 0x42, 0x00, 0x08, 0x00, 0x2F, 0x40, 0x03, 0x40, 0x02,
+  0x00, 0x0C, 0x00, 0x60, 0xFF, 0x96,
+  /* code 0036 */
+  0x8F, 0x3B, 0x7E, 0x06, 0x00, 0x30, 0x00, 0x9E, 0x03, 0x86, 0x0C, 0x0C,
+  0x30, 0x20, 0x90, 0xC0, 0xFD, 0x95,
+  /* code 0037 */
+  0x8E, 0x3A, 0xFF, 0xC0, 0x06, 0x00, 0x24, 0x00, 0xC0, 0x06, 0x00, 0x24,
+  0x00, 0xC0, 0x06, 0x00, 0x24, 0x97,
+  /* code 0038 */
+  0x8F, 0x3B, 0xFC, 0x0D, 0x18, 0x20, 0x30, 0x91, 0x80, 0xFC, 0x08, 0x0C,
+  0x60, 0x30, 0xC0, 0xC1, 0xFD, 0x95,
+  /* code 0039 */
+  0x8F, 0x3A, 0xF8, 0x0C, 0x24, 0x60, 0x21, 0x80, 0xC3, 0x07, 0x07, 0xE8,
+  0x00, 0x20, 0x02, 0x42, 0xF8, 0x96,
+  /* code 003A */
+  0x94, 0x01, 0x90, 0x91, 0x01, 0x90, 0x8C,
+  /* code 003B */
+  0x94, 0x01, 0x90, 0x91, 0x04, 0x90, 0x80, 0x89,
+  /* code 003C */
+  0xA9, 0x17, 0x60, 0x02, 0xE0, 0x0F, 0x40, 0x0B, 0x88, 0x02, 0xF8, 0x87,
+  0x02, 0x78, 0xA4,
+  /* code 003D */
+  0xB6, 0x06, 0xBF, 0xF8, 0x8A, 0x06, 0xBF, 0xF8, 0xAD,
+  /* code 003E */
+  0xA4, 0x01, 0x90, 0x87, 0x02, 0xB8, 0x87, 0x03, 0x7D, 0x86, 0x0F, 0xE0,
+  0x0B, 0xC0, 0x2D, 0xA8,
+  /* code 003F */
+  0x8C, 0x25, 0xBC, 0x00, 0x60, 0x03, 0x00, 0x90, 0x28, 0x02, 0x00, 0x20,
+  0x8A, 0x00, 0xC0, 0x94,
+  /* code 0040 */
+  0xA2, 0x58, 0x7F, 0xF4, 0x03, 0x00, 0x20, 0x20, 0xB6, 0x20, 0x85, 0x28,
+  0x82, 0x20, 0x21, 0x08, 0x81, 0x88, 0x21, 0x8E, 0x90, 0x82, 0x80, 0x00,
+  0xC0, 0x8A, 0x04, 0xAF, 0x80, 0x8D,
+  /* code 0041 */
+  0x90, 0x3B, 0xD0, 0x07, 0x80, 0x26, 0x00, 0x89, 0x06, 0x18, 0x24, 0x30,
+  0xFF, 0xD6, 0x01, 0xA4, 0x03, 0x94,
+  /* code 0042 */
+  0x8E, 0x3C, 0xFF, 0x03, 0x03, 0x0C, 0x09, 0x30, 0x30, 0xFF, 0x43, 0x02,
+  0x4C, 0x06, 0x30, 0x24, 0xFF, 0x80, 0x95,
+  /* code 0043 */
+  0x91, 0x44, 0x7F, 0x41, 0xC0, 0x83, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06,
+  0x00, 0x03, 0x00, 0x02, 0x80, 0x40, 0xBF, 0x80, 0x98,
+  /* code 0044 */
+  0x90, 0x44, 0xFF, 0x00, 0xC0, 0xE0, 0xC0, 0x24, 0xC0, 0x18, 0xC0, 0x18,
+  0xC0, 0x18, 0xC0, 0x24, 0xC0, 0x70, 0xFF, 0x80, 0x99,
+  /* code 0045 */
+  0x8E, 0x3C, 0xFF, 0xC3, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xFF, 0x83, 0x00,
+  0x0C, 0x00, 0x30, 0x00, 0xFF, 0xC0, 0x95,
+  /* code 0046 */
+  0x8C, 0x30, 0xFF, 0x4C, 0x00, 0xC0, 0x0C, 0x00, 0xFF, 0x4C, 0x00, 0xC0,
+  0x0C, 0x00, 0xC0, 0x95,
+  /* code 0047 */
+  0x91, 0x44, 0x7F, 0x41, 0xC0, 0x93, 0x00, 0x06, 0x00, 0x06, 0x07, 0xD6,
+  0x00, 0x53, 0x00, 0x52, 0x80, 0x50, 0xBF, 0xC0, 0x98,
+  /* code 0048 */
+  0x90, 0x1F, 0xC0, 0x20, 0xC0, 0x20, 0xC0, 0x20, 0xC0, 0x20, 0xC5, 0x1F,
+  0x0C, 0x02, 0x0C, 0x02, 0x0C, 0x02, 0x0C, 0x02, 0x98,
+  /* code 0049 */
+  0x86, 0x18, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC0, 0x89,
+  /* code 004A */
+  0x86, 0x1E, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC2, 0x38, 0x83,
+  /* code 004B */
+  0x8E, 0x3D, 0xC0, 0x63, 0x06, 0x0C, 0x60, 0x3B, 0x00, 0xF4, 0x03, 0x70,
+  0x0C, 0x70, 0x30, 0x70, 0xC0, 0x70, 0x94,
+  /* code 004C */
+  0x8C, 0x34, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0,
+  0x0C, 0x00, 0xFF, 0xC0, 0x91,
+  /* code 004D */
+  0x92, 0x4F, 0xE0, 0x1D, 0x3C, 0x0B, 0x4E, 0x42, 0xD3, 0x61, 0x64, 0xC8,
+  0x89, 0x31, 0xA2, 0x4C, 0x34, 0x93, 0x00, 0x24, 0xC0, 0x09, 0x9A,
+  /* code 004E */
+  0x90, 0x45, 0xE0, 0x20, 0xF0, 0x20, 0xE4, 0x20, 0xD8, 0x20, 0xC5, 0x20,
+  0xC3, 0x20, 0xC2, 0xA0, 0xC0, 0xF0, 0xC0, 0xB0, 0x98,
+  /* code 004F */
+  0x93, 0x23, 0x7F, 0x00, 0x60, 0x70, 0x30, 0x09, 0x18, 0x01, 0x86, 0x84,
+  0x23, 0x86, 0x00, 0x60, 0xC0, 0x18, 0x28, 0x0C, 0x02, 0xFD, 0x9C,
+  /* code 0050 */
+  0x8E, 0x38, 0xFE, 0x03, 0x06, 0x0C, 0x0C, 0x30, 0x30, 0xC1, 0x83, 0xF8,
+  0x0C, 0x00, 0x30, 0x00, 0xC0, 0x99,
+  /* code 0051 */
+  0x93, 0x55, 0x7F, 0x00, 0x60, 0x70, 0x30, 0x09, 0x18, 0x01, 0x86, 0x00,
+  0x21, 0x80, 0x18, 0x30, 0x06, 0x0A, 0x03, 0x00, 0xBF, 0x40, 0x00, 0xD0,
+  0x87, 0x00, 0xC0, 0x8A,
+  /* code 0052 */
+  0x90, 0x45, 0xFE, 0x00, 0xC1, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x40,
+  0xC2, 0x40, 0xC0, 0x80, 0xC0, 0x90, 0xC0, 0x30, 0x98,
+  /* code 0053 */
+  0x8F, 0x3B, 0xFE, 0x0C, 0x04, 0x60, 0x00, 0xD0, 0x01, 0xFC, 0x00, 0x1C,
+  0x00, 0x20, 0x00, 0xC7, 0xFD, 0x95,
+  /* code 0054 */
+  0x8D, 0x3B, 0xFF, 0xF8, 0x08, 0x00, 0x20, 0x00, 0x80, 0x02, 0x00, 0x08,
+  0x00, 0x20, 0x00, 0x80, 0x02, 0x97,
+  /* code 0055 */
+  0x90, 0x44, 0x80, 0x30, 0x80, 0x30, 0x80, 0x30, 0x80, 0x30, 0x80, 0x30,
+  0x80, 0x30, 0x80, 0x30, 0x90, 0x60, 0x3F, 0xC0, 0x99,
+  /* code 0056 */
+  0x8D, 0x3C, 0x90, 0x09, 0x80, 0x23, 0x01, 0x49, 0x08, 0x18, 0x60, 0x32,
+  0x40, 0x9C, 0x01, 0xE0, 0x03, 0x40, 0x96,
+  /* code 0057 */
+  0x95, 0x60, 0x90, 0x70, 0x25, 0x81, 0xC0, 0x83, 0x09, 0x46, 0x08, 0x22,
+  0x18, 0x24, 0x88, 0x90, 0x65, 0x27, 0x00, 0xA0, 0x58, 0x03, 0x81, 0xE0,
+  0x0A, 0x03, 0x40, 0xA2,
+  /* code 0058 */
+  0x8E, 0x3D, 0xC0, 0x61, 0x43, 0x03, 0x24, 0x07, 0xC0, 0x0D, 0x00, 0x6C,
+  0x03, 0x14, 0x24, 0x31, 0x80, 0x60, 0x94,
+  /* code 0059 */
+  0x8D, 0x3B, 0x90, 0x25, 0x81, 0x82, 0x49, 0x03, 0xA0, 0x07, 0x00, 0x08,
+  0x00, 0x20, 0x00, 0x80, 0x02, 0x97,
+  /* code 005A */
+  0x8D, 0x38, 0x7F, 0xF8, 0x00, 0x90, 0x06, 0x00, 0x30, 0x02, 0x40, 0x28,
+  0x01, 0x80, 0x0C, 0x00, 0x40, 0xC5, 0x94,
+  /* code 005B */
+  0x88, 0x29, 0xF0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xF0, 0x84,
+  /* code 005C */
+  0x87, 0x27, 0x80, 0x80, 0x50, 0x20, 0x20, 0x14, 0x18, 0x08, 0x08, 0x05,
+  0x87,
+  /* code 005D */
+  0x88, 0x2A, 0xF4, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+  0xF4, 0x83,
+  /* code 005E */
+  0x95, 0x1E, 0xD0, 0x00, 0xDC, 0x00, 0xC0, 0xC0, 0x80, 0x08, 0xBF, 0x88,
+  /* code 005F */
+  0xBF, 0x80, 0xC4,
+  /* code 0060 */
+  0x85, 0x0C, 0x80, 0x18, 0x01, 0x40, 0xB2,
+  /* code 0061 */
+  0x9C, 0x2E, 0x7D, 0x01, 0x09, 0x00, 0x18, 0x2F, 0xE1, 0x81, 0x86, 0x0A,
+  0x0B, 0xE8, 0x95,
+  /* code 0062 */
+  0x8E, 0x3C, 0x80, 0x02, 0x00, 0x09, 0xE0, 0x38, 0x60, 0xC0, 0x82, 0x02,
+  0x48, 0x08, 0x34, 0x30, 0xAF, 0x40, 0x95,
+  /* code 0063 */
+  0x99, 0x27, 0xB8, 0x24, 0x06, 0x00, 0x60, 0x06, 0x00, 0x20, 0x01, 0xFD,
+  0x91,
+  /* code 0064 */
+  0x92, 0x38, 0x80, 0x02, 0x03, 0xD8, 0x24, 0xE1, 0x80, 0x86, 0x02, 0x18,
+  0x08, 0x30, 0x60, 0x7E, 0x80, 0x95,
+  /* code 0065 */
+  0x9D, 0x2D, 0xB4, 0x09, 0x18, 0x60, 0x21, 0xFF, 0xC6, 0x00, 0x08, 0x00,
+  0x1F, 0xE0, 0x95,
+  /* code 0066 */
+  0x88, 0x20, 0x7C, 0x82, 0xF8, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8D,
+  /* code 0067 */
+  0x9D, 0x43, 0xF6, 0x0D, 0x38, 0x60, 0x21, 0x80, 0x86, 0x02, 0x08, 0x18,
+  0x1F, 0xA0, 0x01, 0x82, 0x1D, 0x02, 0x80,
+  /* code 0068 */
+  0x8E, 0x3C, 0x80, 0x02, 0x00, 0x09, 0xE0, 0x38, 0x60, 0x80, 0x82, 0x02,
+  0x08, 0x08, 0x20, 0x20, 0x80, 0x80, 0x95,
+  /* code 0069 */
+  0x86, 0x18, 0x80, 0x08, 0x20, 0x82, 0x08, 0x20, 0x80, 0x89,
+  /* code 006A */
+  0x86, 0x22, 0x80, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x18, 0x40,
+  /* code 006B */
+  0x8C, 0x34, 0x80, 0x08, 0x00, 0x80, 0xC8, 0x30, 0x9C, 0x0F, 0x00, 0x98,
+  0x08, 0x60, 0x81, 0xC0, 0x91,
+  /* code 006C */
+  0x86, 0x18, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x80, 0x89,
+  /* code 006D */
+  0xAC, 0x4A, 0x9E, 0x1D, 0x03, 0x8B, 0x89, 0x08, 0x08, 0x18, 0x20, 0x20,
+  0x60, 0x80, 0x81, 0x82, 0x02, 0x06, 0x08, 0x08, 0x18, 0xA1,
+  /* code 006E */
+  0x9C, 0x2E, 0x9E, 0x03, 0x86, 0x08, 0x08, 0x20, 0x20, 0x80, 0x82, 0x02,
+  0x08, 0x08, 0x95,
+  /* code 006F */
+  0x9D, 0x2C, 0xB4, 0x09, 0x24, 0x60, 0x21, 0x80, 0x86, 0x02, 0x0C, 0x18,
+  0x1F, 0xC0, 0x96,
+  /* code 0070 */
+  0x9C, 0x44, 0x9E, 0x03, 0x86, 0x0C, 0x08, 0x20, 0x24, 0x80, 0x83, 0x43,
+  0x0A, 0xF4, 0x20, 0x00, 0x80, 0x02, 0x00, 0x00,
+  /* code 0071 */
+  0x9D, 0x43, 0xF6, 0x09, 0x38, 0x60, 0x21, 0x80, 0x86, 0x02, 0x0C, 0x18,
+  0x1F, 0xA0, 0x00, 0x80, 0x02, 0x00, 0x08,
+  /* code 0072 */
+  0x90, 0x18, 0x9C, 0xE0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8D,
+  /* code 0073 */
+  0x98, 0x27, 0x7D, 0x18, 0x01, 0x80, 0x0B, 0xC0, 0x07, 0x00, 0x21, 0xFE,
+  0x92,
+  /* code 0074 */
+  0x8C, 0x1E, 0x82, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0xBC, 0x8B,
+  /* code 0075 */
+  0x9C, 0x2E, 0x80, 0x82, 0x02, 0x08, 0x08, 0x20, 0x20, 0x80, 0x82, 0x06,
+  0x07, 0xE8, 0x95,
+  /* code 0076 */
+  0x97, 0x27, 0x90, 0x26, 0x06, 0x20, 0x92, 0x48, 0x19, 0x80, 0xA4, 0x0B,
+  0x93,
+  /* code 0077 */
+  0xA3, 0x3C, 0x50, 0xC2, 0x58, 0x70, 0x82, 0x25, 0x20, 0x89, 0x98, 0x26,
+  0x29, 0x07, 0x4B, 0x00, 0xD1, 0xC0, 0x9C,
+  /* code 0078 */
+  0x97, 0x29, 0x60, 0x62, 0x4C, 0x0E, 0x40, 0x60, 0x0F, 0x42, 0x4C, 0x60,
+  0x60, 0x91,
+  /* code 0079 */
+  0x97, 0x3B, 0x90, 0x26, 0x06, 0x20, 0x91, 0x48, 0x09, 0x80, 0xB0, 0x06,
+  0x00, 0x50, 0x0C, 0x02, 0x00,
+  /* code 007A */
+  0x97, 0x28, 0x7F, 0xC0, 0x0C, 0x02, 0x40, 0xA0, 0x18, 0x03, 0x00, 0x7F,
+  0xC0, 0x92,
+  /* code 007B */
+  0x90, 0x22, 0xB4, 0x02, 0x00, 0x08, 0x00, 0x20, 0x00, 0x80, 0x2C, 0x86,
+  0x1E, 0x80, 0x02, 0x00, 0x08, 0x00, 0x20, 0x00, 0xB4, 0x87,
+  /* code 007C */
+  0x88, 0x2E, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+  0x90, 0x90,
+  /* code 007D */
+  0x8E, 0x48, 0xB4, 0x00, 0x20, 0x00, 0x80, 0x02, 0x00, 0x08, 0x00, 0x1D,
+  0x00, 0x80, 0x02, 0x00, 0x08, 0x00, 0x20, 0x0B, 0x40, 0x89,
+  /* code 007E */
+  0xB7, 0x0D, 0xB0, 0x70, 0x93, 0xE0, 0xB7
+};
+
+const aafontsCharInfo_t charTable_DejaVuSansCondensed14_AA2_RLE[95] = {
+  {   3,   0, &FontDejaVuSansCondensed14_AA2_RLE[    0] }, /* code 0020 */
+  {   4,   0, &FontDejaVuSansCondensed14_AA2_RLE[    1] }, /* code 0021 */
+  {   5,   0, &FontDejaVuSansCondensed14_AA2_RLE[   13] }, /* code 0022 */
+  {   9,   0, &FontDejaVuSansCondensed14_AA2_RLE[   21] }, /* code 0023 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[   43] }, /* code 0024 */
+  {  10,   0, &FontDejaVuSansCondensed14_AA2_RLE[   64] }, /* code 0025 */
+  {   8,   0, &FontDejaVuSansCondensed14_AA2_RLE[   89] }, /* code 0026 */
+  {   3,   0, &FontDejaVuSansCondensed14_AA2_RLE[  110] }, /* code 0027 */
+  {   4,   0, &FontDejaVuSansCondensed14_AA2_RLE[  116] }, /* code 0028 */
+  {   4,   0, &FontDejaVuSansCondensed14_AA2_RLE[  130] }, /* code 0029 */
+  {   5,   0, &FontDejaVuSansCondensed14_AA2_RLE[  144] }, /* code 002A */
+  {   9,   0, &FontDejaVuSansCondensed14_AA2_RLE[  154] }, /* code 002B */
+  {   3,   0, &FontDejaVuSansCondensed14_AA2_RLE[  177] }, /* code 002C */
+  {   4,   0, &FontDejaVuSansCondensed14_AA2_RLE[  181] }, /* code 002D */
+  {   3,   0, &FontDejaVuSansCondensed14_AA2_RLE[  185] }, /* code 002E */
+  {   4,   0, &FontDejaVuSansCondensed14_AA2_RLE[  189] }, /* code 002F */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[  201] }, /* code 0030 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[  219] }, /* code 0031 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[  237] }, /* code 0032 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[  256] }, /* code 0033 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[  274] }, /* code 0034 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[  292] }, /* code 0035 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[  310] }, /* code 0036 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[  328] }, /* code 0037 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[  346] }, /* code 0038 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[  364] }, /* code 0039 */
+  {   4,   0, &FontDejaVuSansCondensed14_AA2_RLE[  382] }, /* code 003A */
+  {   4,   0, &FontDejaVuSansCondensed14_AA2_RLE[  389] }, /* code 003B */
+  {   9,   0, &FontDejaVuSansCondensed14_AA2_RLE[  397] }, /* code 003C */
+  {   9,   0, &FontDejaVuSansCondensed14_AA2_RLE[  412] }, /* code 003D */
+  {   9,   0, &FontDejaVuSansCondensed14_AA2_RLE[  421] }, /* code 003E */
+  {   6,   0, &FontDejaVuSansCondensed14_AA2_RLE[  437] }, /* code 003F */
+  {  11,   0, &FontDejaVuSansCondensed14_AA2_RLE[  453] }, /* code 0040 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[  483] }, /* code 0041 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[  501] }, /* code 0042 */
+  {   8,   0, &FontDejaVuSansCondensed14_AA2_RLE[  520] }, /* code 0043 */
+  {   8,   0, &FontDejaVuSansCondensed14_AA2_RLE[  541] }, /* code 0044 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[  562] }, /* code 0045 */
+  {   6,   0, &FontDejaVuSansCondensed14_AA2_RLE[  581] }, /* code 0046 */
+  {   8,   0, &FontDejaVuSansCondensed14_AA2_RLE[  597] }, /* code 0047 */
+  {   8,   0, &FontDejaVuSansCondensed14_AA2_RLE[  618] }, /* code 0048 */
+  {   3,   0, &FontDejaVuSansCondensed14_AA2_RLE[  639] }, /* code 0049 */
+  {   3,   0, &FontDejaVuSansCondensed14_AA2_RLE[  649] }, /* code 004A */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[  660] }, /* code 004B */
+  {   6,   0, &FontDejaVuSansCondensed14_AA2_RLE[  679] }, /* code 004C */
+  {   9,   0, &FontDejaVuSansCondensed14_AA2_RLE[  696] }, /* code 004D */
+  {   8,   0, &FontDejaVuSansCondensed14_AA2_RLE[  719] }, /* code 004E */
+  {   9,   0, &FontDejaVuSansCondensed14_AA2_RLE[  740] }, /* code 004F */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[  763] }, /* code 0050 */
+  {   9,   0, &FontDejaVuSansCondensed14_AA2_RLE[  781] }, /* code 0051 */
+  {   8,   0, &FontDejaVuSansCondensed14_AA2_RLE[  809] }, /* code 0052 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[  830] }, /* code 0053 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[  848] }, /* code 0054 */
+  {   8,   0, &FontDejaVuSansCondensed14_AA2_RLE[  866] }, /* code 0055 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[  887] }, /* code 0056 */
+  {  11,   0, &FontDejaVuSansCondensed14_AA2_RLE[  906] }, /* code 0057 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[  934] }, /* code 0058 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[  953] }, /* code 0059 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[  971] }, /* code 005A */
+  {   4,   0, &FontDejaVuSansCondensed14_AA2_RLE[  990] }, /* code 005B */
+  {   4,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1004] }, /* code 005C */
+  {   4,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1017] }, /* code 005D */
+  {   9,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1031] }, /* code 005E */
+  {   5,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1043] }, /* code 005F */
+  {   5,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1046] }, /* code 0060 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1053] }, /* code 0061 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1068] }, /* code 0062 */
+  {   6,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1087] }, /* code 0063 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1100] }, /* code 0064 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1118] }, /* code 0065 */
+  {   4,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1133] }, /* code 0066 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1145] }, /* code 0067 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1164] }, /* code 0068 */
+  {   3,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1183] }, /* code 0069 */
+  {   3,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1193] }, /* code 006A */
+  {   6,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1204] }, /* code 006B */
+  {   3,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1221] }, /* code 006C */
+  {  11,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1231] }, /* code 006D */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1253] }, /* code 006E */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1268] }, /* code 006F */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1283] }, /* code 0070 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1303] }, /* code 0071 */
+  {   4,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1322] }, /* code 0072 */
+  {   6,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1332] }, /* code 0073 */
+  {   4,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1345] }, /* code 0074 */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1356] }, /* code 0075 */
+  {   6,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1371] }, /* code 0076 */
+  {   9,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1384] }, /* code 0077 */
+  {   6,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1403] }, /* code 0078 */
+  {   6,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1417] }, /* code 0079 */
+  {   6,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1434] }, /* code 007A */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1448] }, /* code 007B */
+  {   4,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1470] }, /* code 007C */
+  {   7,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1484] }, /* code 007D */
+  {   9,   0, &FontDejaVuSansCondensed14_AA2_RLE[ 1506] }  /* code 007E */
+};
+
+aafontsFont_t DejaVuSansCondensed14_AA2_RLE = 
+{
+  AAFONTS_FONTTYPE_AA2,                 /* Font type (anti-aliasing level) */
+  14,                                   /* Font height in pixels */
+  3,                                    /* Width to insert for unknown characters */
+  9,                                    /* Height of upper-case characters */
+  7,                                    /* Height of lower-case characters */
+  11,                                   /* Font baseline */
+  0x0020,                               /* Unicode address of first character */
+  0x007E,                               /* Unicode address of last character */
+  &charTable_DejaVuSansCondensed14_AA2_RLE[0], /* Font char data */
+  AAFONTS_ENCODING_RLE                  /* Glyph data encoding */
+};
@@ -0,0 +1,426 @@
+/**************************************************************************/
+/*!
+    @file     DejaVuSansCondensedBold14_AA2_RLE.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Run-length encoded copy of DejaVuSansCondensedBold14_AA2, generated
+              by tools/fontpack (do not edit)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include "DejaVuSansCondensedBold14_AA2_RLE.h"
+
+/* 1656 bytes of glyph data, against 2744 for DejaVuSansCondensedBold14_AA2 */
+const uint8_t FontDejaVuSansCondensedBold14_AA2_RLE[1656] = {
+  /* code 0020 */
+  0xB7,
+  /* code 0021 */
+  0x8A, 0x1A, 0x74, 0x1D, 0x07, 0x41, 0xD0, 0x74, 0x1C, 0x87, 0x07, 0x74,
+  0x1D, 0x8F,
+  /* code 0022 */
+  0x8C, 0x15, 0xDA, 0x0D, 0xA0, 0xDA, 0x0D, 0xA0, 0xB0,
+  /* code 0023 */
+  0x94, 0x4A, 0x62, 0x40, 0x24, 0xC0, 0x09, 0x60, 0x2F, 0xFF, 0x41, 0x89,
+  0x07, 0xFF, 0xF1, 0x79, 0x94, 0x0C, 0x60, 0x03, 0x24, 0x9D,
+  /* code 0024 */
+  0x92, 0x50, 0x80, 0x03, 0xF8, 0x0E, 0xAD, 0x0D, 0x80, 0x0F, 0xF4, 0x02,
+  0xBD, 0x00, 0x9E, 0x0C, 0x9E, 0x0F, 0xFC, 0x00, 0x80, 0x00, 0x80, 0x8B,
+  /* code 0025 */
+  0x96, 0x33, 0xB8, 0x0D, 0x06, 0x34, 0x60, 0x28, 0x93, 0x00, 0x63, 0x58,
+  0x00, 0xB8, 0xC7, 0x85, 0x26, 0x97, 0x70, 0x03, 0x28, 0x90, 0x24, 0xA3,
+  0x41, 0x80, 0xFC, 0xA1,
+  /* code 0026 */
+  0x93, 0x13, 0x7F, 0x40, 0x3F, 0xD0, 0x0E, 0x86, 0x33, 0xB4, 0x00, 0xBF,
+  0x4D, 0x74, 0xFB, 0x5D, 0x1F, 0x83, 0xD7, 0xE0, 0x7F, 0xEE, 0x9A,
+  /* code 0027 */
+  0x86, 0x0A, 0xD3, 0x4D, 0x34, 0x97,
+  /* code 0028 */
+  0x8B, 0x33, 0xA0, 0x74, 0x2C, 0x0A, 0x03, 0x80, 0xE0, 0x38, 0x0B, 0x01,
+  0xC0, 0x38, 0x07, 0x85,
+  /* code 0029 */
+  0x8A, 0x33, 0xE0, 0x1C, 0x03, 0x40, 0xE0, 0x2C, 0x0B, 0x02, 0xC0, 0xE0,
+  0x74, 0x2C, 0x0D, 0x86,
+  /* code 002A */
+  0x8D, 0x1F, 0x90, 0x99, 0x92, 0xF4, 0x3F, 0x84, 0x95, 0x09, 0xA5,
+  /* code 002B */
+  0x9E, 0xC0, 0x87, 0xC0, 0x87, 0xC0, 0x87, 0xC0, 0x84, 0x00, 0x80, 0xC4,
+  0x00, 0x80, 0x84, 0xC0, 0x87, 0xC0, 0x87, 0xC0, 0x9E,
+  /* code 002C */
+  0xA4, 0x0C, 0xB0, 0xB0, 0xD1, 0x80, 0x85,
+  /* code 002D */
+  0x9B, 0x03, 0x7E, 0x97,
+  /* code 002E */
+  0xA4, 0x05, 0xB0, 0xB0, 0x8C,
+  /* code 002F */
+  0x89, 0x23, 0x60, 0xA0, 0x90, 0xC1, 0x82, 0x43, 0x06, 0x06, 0x09, 0x89,
+  /* code 0030 */
+  0x91, 0x43, 0xBD, 0x02, 0xFF, 0x43, 0x83, 0x87, 0x83, 0xC7, 0x43, 0xC7,
+  0x43, 0xC7, 0x83, 0x83, 0xCB, 0x40, 0xFE, 0x99,
+  /* code 0031 */
+  0x91, 0x44, 0xFC, 0x02, 0xFC, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00,
+  0x3C, 0x00, 0x3C, 0x02, 0xFF, 0x82, 0xFF, 0x80, 0x98,
+  /* code 0032 */
+  0x90, 0x45, 0xBF, 0x40, 0xFF, 0xD0, 0x02, 0xD0, 0x02, 0xD0, 0x07, 0x80,
+  0x1F, 0x00, 0x7C, 0x00, 0xFF, 0xD0, 0xFF, 0xD0, 0x98,
+  /* code 0033 */
+  0x90, 0x44, 0xFF, 0x40, 0xAA, 0xD0, 0x01, 0xD0, 0x03, 0xC0, 0x3F, 0x40,
+  0x02, 0xD0, 0x01, 0xE1, 0xEB, 0xD0, 0xBF, 0x80, 0x99,
+  /* code 0034 */
+  0x92, 0x42, 0x78, 0x00, 0xF8, 0x02, 0xB8, 0x07, 0x78, 0x0D, 0x38, 0x18,
+  0x38, 0x1F, 0xFF, 0x00, 0x38, 0x00, 0x38, 0x99,
+  /* code 0035 */
+  0x90, 0x44, 0xBF, 0xC0, 0xBF, 0xC0, 0xA0, 0x00, 0xBF, 0x40, 0xBF, 0xD0,
+  0x01, 0xE0, 0x01, 0xE0, 0xEB, 0xD0, 0xFF, 0x80, 0x99,
+  /* code 0036 */
+  0x91, 0x43, 0x7F, 0x41, 0xFA, 0x43, 0xC0, 0x03, 0xBD, 0x07, 0xFF, 0x47,
+  0xC3, 0x83, 0x83, 0x82, 0xF7, 0x80, 0xFE, 0x99,
+  /* code 0037 */
+  0x8F, 0x43, 0x7F, 0xF8, 0x7F, 0xF8, 0x00, 0xB4, 0x00, 0xE0, 0x01, 0xD0,
+  0x03, 0xC0, 0x07, 0x80, 0x0B, 0x00, 0x0E, 0x9B,
+  /* code 0038 */
+  0x91, 0x43, 0xFE, 0x03, 0xFF, 0x43, 0x87, 0x82, 0xCB, 0x40, 0xFE, 0x03,
+  0x87, 0x87, 0x43, 0x83, 0xC7, 0x81, 0xFF, 0x99,
+  /* code 0039 */
+  0x91, 0x43, 0xFC, 0x03, 0xFF, 0x07, 0x47, 0x47, 0x47, 0x83, 0xDF, 0x81,
+  0xFF, 0x80, 0x07, 0x42, 0x0F, 0x03, 0xFD, 0x99,
+  /* code 003A */
+  0x90, 0x05, 0xB0, 0xB0, 0x8D, 0x05, 0xB0, 0xB0, 0x8C,
+  /* code 003B */
+  0x90, 0x09, 0xB0, 0xB0, 0xB0, 0x89, 0x0C, 0xB0, 0xB0, 0xD1, 0xC0, 0x85,
+  /* code 003C */
+  0xA9, 0x23, 0xA0, 0x07, 0xF4, 0x2F, 0x80, 0x0B, 0x40, 0x00, 0x7F, 0x87,
+  0x02, 0xF8, 0xA4,
+  /* code 003D */
+  0xB6, 0x06, 0xBF, 0xF8, 0x8A, 0x06, 0xBF, 0xF8, 0xAD,
+  /* code 003E */
+  0xA4, 0x2F, 0xA0, 0x00, 0x1F, 0xD0, 0x00, 0x2F, 0x80, 0x01, 0xE0, 0x0F,
+  0xD0, 0x2F, 0xA8,
+  /* code 003F */
+  0x8C, 0x20, 0xFE, 0x1F, 0xF4, 0x07, 0x40, 0xB4, 0x2D, 0x03, 0x80, 0x89,
+  0x07, 0xE0, 0x0E, 0x93,
+  /* code 0040 */
+  0xA2, 0x4D, 0x7F, 0xF4, 0x03, 0x00, 0x30, 0x24, 0xBA, 0x60, 0x86, 0x38,
+  0x86, 0x24, 0x62, 0x08, 0x92, 0x88, 0x21, 0xFF, 0xD0, 0x90, 0x89, 0x10,
+  0xE0, 0x20, 0x00, 0xBF, 0x80, 0x8D,
+  /* code 0041 */
+  0x92, 0x44, 0xF4, 0x01, 0xF8, 0x02, 0xFC, 0x03, 0x9D, 0x07, 0x4E, 0x0B,
+  0x0B, 0x0F, 0xFF, 0x5D, 0x03, 0xAD, 0x02, 0xC0, 0x97,
+  /* code 0042 */
+  0x90, 0x45, 0xFF, 0x80, 0xFF, 0xF0, 0xF0, 0xB0, 0xF0, 0xF0, 0xFF, 0xD0,
+  0xF0, 0xB4, 0xF0, 0x74, 0xFF, 0xF4, 0xFF, 0xD0, 0x98,
+  /* code 0043 */
+  0x92, 0x43, 0xFE, 0x07, 0xFF, 0x0F, 0x40, 0x1E, 0x00, 0x1E, 0x00, 0x1E,
+  0x00, 0x0F, 0x00, 0x0B, 0xD7, 0x02, 0xFF, 0x98,
+  /* code 0044 */
+  0x92, 0x4D, 0xFF, 0x80, 0x3F, 0xFD, 0x0F, 0x07, 0xC3, 0xC0, 0xB4, 0xF0,
+  0x2D, 0x3C, 0x0B, 0x4F, 0x03, 0xC3, 0xFF, 0xD0, 0xFF, 0xD0, 0x9C,
+  /* code 0045 */
+  0x8E, 0x3D, 0xFF, 0xD3, 0xFF, 0x4F, 0x00, 0x3C, 0x00, 0xFF, 0xD3, 0xC0,
+  0x0F, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x94,
+  /* code 0046 */
+  0x8E, 0x39, 0xFF, 0xD3, 0xFF, 0x4F, 0x00, 0x3C, 0x00, 0xFF, 0xD3, 0xC0,
+  0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x98,
+  /* code 0047 */
+  0x94, 0x1A, 0xFF, 0x01, 0xFF, 0xE0, 0xF4, 0x00, 0x78, 0x85, 0x2B, 0x78,
+  0x3F, 0x1E, 0x0F, 0xC3, 0xC0, 0xB0, 0xBE, 0x7C, 0x0B, 0xFE, 0x9B,
+  /* code 0048 */
+  0x92, 0x23, 0xF0, 0x3C, 0x3C, 0x0F, 0x0F, 0x03, 0xC3, 0xC0, 0xF0, 0xC6,
+  0x23, 0x0F, 0x03, 0xC3, 0xC0, 0xF0, 0xF0, 0x3C, 0x3C, 0x0F, 0x9B,
+  /* code 0049 */
+  0x88, 0x21, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x8C,
+  /* code 004A */
+  0x88, 0x29, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF1, 0xE3,
+  0xD0, 0x84,
+  /* code 004B */
+  0x90, 0x46, 0xF0, 0x7C, 0xF0, 0xF0, 0xF7, 0xC0, 0xFF, 0x40, 0xFE, 0x00,
+  0xFF, 0x40, 0xF7, 0xD0, 0xF0, 0xF4, 0xF0, 0x7C, 0x97,
+  /* code 004C */
+  0x8E, 0x3D, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x03, 0xC0,
+  0x0F, 0x00, 0x3F, 0xF8, 0xFF, 0xE0, 0x94,
+  /* code 004D */
+  0x96, 0x60, 0xF8, 0x0F, 0x83, 0xF0, 0x7E, 0x0F, 0xD2, 0xF8, 0x3E, 0x8E,
+  0xE0, 0xF7, 0xB7, 0x83, 0xCF, 0x8E, 0x0F, 0x1D, 0x38, 0x3C, 0x00, 0xE0,
+  0xF0, 0x03, 0x80, 0xA1,
+  /* code 004E */
+  0x92, 0x4E, 0xF4, 0x2C, 0x3E, 0x0B, 0x0F, 0xD2, 0xC3, 0xF8, 0xB0, 0xF7,
+  0x6C, 0x3C, 0xBF, 0x0F, 0x1F, 0xC3, 0xC3, 0xF0, 0xF0, 0x7C, 0x9B,
+  /* code 004F */
+  0x93, 0x4C, 0x7F, 0x40, 0x7F, 0xF8, 0x3C, 0x0F, 0x5E, 0x01, 0xD7, 0x80,
+  0x79, 0xE0, 0x1E, 0x3C, 0x0B, 0x4B, 0xDF, 0x80, 0xBF, 0xC0, 0x9C,
+  /* code 0050 */
+  0x90, 0x41, 0xFF, 0x80, 0xFF, 0xF0, 0xF0, 0xB4, 0xF0, 0xB4, 0xFF, 0xF0,
+  0xFF, 0xD0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x9C,
+  /* code 0051 */
+  0x93, 0x55, 0x7F, 0x40, 0x7F, 0xF8, 0x3C, 0x0F, 0x5E, 0x01, 0xD7, 0x80,
+  0x79, 0xE0, 0x1E, 0x3C, 0x0B, 0x4B, 0xDF, 0x80, 0xBF, 0x80, 0x00, 0xB0,
+  0x87, 0x01, 0xE0, 0x89,
+  /* code 0052 */
+  0x90, 0x46, 0xFF, 0x80, 0xFF, 0xE0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFF, 0xD0,
+  0xFF, 0xD0, 0xF0, 0xF0, 0xF0, 0xB4, 0xF0, 0x7C, 0x97,
+  /* code 0053 */
+  0x91, 0x43, 0xFF, 0x43, 0xFF, 0x43, 0x80, 0x03, 0xD0, 0x02, 0xFF, 0x40,
+  0x1B, 0x80, 0x03, 0xC3, 0xFF, 0x83, 0xFE, 0x99,
+  /* code 0054 */
+  0x8D, 0xCD, 0x2E, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80,
+  0x1E, 0x00, 0x78, 0x96,
+  /* code 0055 */
+  0x92, 0x4D, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0,
+  0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x82, 0xF7, 0xD0, 0x3F, 0xE0, 0x9C,
+  /* code 0056 */
+  0x8F, 0x45, 0xB0, 0x0B, 0x74, 0x0E, 0x38, 0x1D, 0x2C, 0x2C, 0x1D, 0x38,
+  0x0E, 0x74, 0x0B, 0xF0, 0x07, 0xE0, 0x03, 0xD0, 0x99,
+  /* code 0057 */
+  0x97, 0x69, 0xB4, 0x3C, 0x1D, 0x74, 0x7C, 0x2D, 0x38, 0x7D, 0x2C, 0x3C,
+  0xAA, 0x38, 0x2D, 0xDA, 0x78, 0x1D, 0xD7, 0xB4, 0x1F, 0xC3, 0xF4, 0x0F,
+  0x83, 0xF0, 0x0F, 0x82, 0xE0, 0xA5,
+  /* code 0058 */
+  0x8F, 0x47, 0x78, 0x1E, 0x3C, 0x2C, 0x1E, 0x78, 0x0B, 0xF0, 0x03, 0xD0,
+  0x0B, 0xF0, 0x1E, 0x74, 0x2C, 0x3C, 0xB8, 0x1F, 0x97,
+  /* code 0059 */
+  0x8F, 0x44, 0xF4, 0x1E, 0x78, 0x3C, 0x2D, 0xB8, 0x0F, 0xF0, 0x0B, 0xD0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x9A,
+  /* code 005A */
+  0x8F, 0x47, 0x7F, 0xFC, 0x7F, 0xFC, 0x00, 0xB4, 0x01, 0xE0, 0x03, 0xC0,
+  0x0F, 0x40, 0x2E, 0x00, 0x7F, 0xFD, 0x7F, 0xFD, 0x97,
+  /* code 005B */
+  0x8A, 0x34, 0xFC, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80,
+  0xE0, 0x3F, 0x0F, 0xC0, 0x85,
+  /* code 005C */
+  0x87, 0x27, 0xC0, 0x90, 0x60, 0x30, 0x24, 0x18, 0x0C, 0x0C, 0x09, 0x06,
+  0x87,
+  /* code 005D */
+  0x89, 0x35, 0x7F, 0x02, 0xC0, 0xB0, 0x2C, 0x0B, 0x02, 0xC0, 0xB0, 0x2C,
+  0x0B, 0x1F, 0xC7, 0xF0, 0x85,
+  /* code 005E */
+  0x94, 0x1F, 0x74, 0x00, 0x3F, 0x00, 0x38, 0x70, 0x24, 0x07, 0xBF, 0x88,
+  /* code 005F */
+  0xBF, 0x80, 0xC4,
+  /* code 0060 */
+  0x84, 0x0D, 0x70, 0x06, 0x00, 0x90, 0xB2,
+  /* code 0061 */
+  0x9C, 0x2F, 0x7F, 0x03, 0xAB, 0x00, 0x1D, 0x3F, 0xF5, 0xD1, 0xD7, 0x4F,
+  0x4F, 0xED, 0x94,
+  /* code 0062 */
+  0x90, 0x45, 0xE0, 0x00, 0xE0, 0x00, 0xEF, 0x80, 0xFF, 0xE0, 0xF0, 0xB0,
+  0xE0, 0xB0, 0xE0, 0xB0, 0xF5, 0xF0, 0xFF, 0xD0, 0x98,
+  /* code 0063 */
+  0x99, 0x27, 0x7D, 0x2F, 0xE7, 0x80, 0x74, 0x07, 0x40, 0x3D, 0x11, 0xFE,
+  0x91,
+  /* code 0064 */
+  0x94, 0x41, 0xE0, 0x00, 0xE0, 0x3C, 0xE0, 0xFF, 0xE1, 0xE1, 0xE1, 0xD0,
+  0xE1, 0xD0, 0xE0, 0xF2, 0xE0, 0x7E, 0xE0, 0x98,
+  /* code 0065 */
+  0x9D, 0x2E, 0xBC, 0x0B, 0xAC, 0x74, 0x39, 0xFF, 0xE7, 0x40, 0x0F, 0x05,
+  0x1F, 0xF4, 0x94,
+  /* code 0066 */
+  0x8A, 0x29, 0x7E, 0x2C, 0x2F, 0xE6, 0xE4, 0xB0, 0x2C, 0x0B, 0x02, 0xC0,
+  0xB0, 0x90,
+  /* code 0067 */
+  0xA1, 0x4D, 0xF3, 0x83, 0xFF, 0x87, 0x87, 0x87, 0x43, 0x87, 0x43, 0x83,
+  0xFF, 0x81, 0xF7, 0x80, 0x07, 0x82, 0xFF, 0x00, 0x54, 0x00,
+  /* code 0068 */
+  0x90, 0x45, 0xE0, 0x00, 0xE0, 0x00, 0xE3, 0x80, 0xFF, 0xE0, 0xF0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x98,
+  /* code 0069 */
+  0x88, 0x21, 0xE0, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x8C,
+  /* code 006A */
+  0x88, 0x2E, 0xE0, 0x00, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE3,
+  0xD3, 0x40,
+  /* code 006B */
+  0x8E, 0x3D, 0xE0, 0x03, 0x80, 0x0E, 0x0F, 0x38, 0xF0, 0xFF, 0x03, 0xF4,
+  0x0F, 0xF0, 0x38, 0xF0, 0xE1, 0xF0, 0x94,
+  /* code 006C */
+  0x88, 0x21, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x8C,
+  /* code 006D */
+  0xAC, 0x0A, 0xE7, 0x4B, 0x40, 0xC8, 0x37, 0x0F, 0x1E, 0x1D, 0x38, 0x78,
+  0x74, 0xE1, 0xE1, 0xD3, 0x87, 0x87, 0x4E, 0x1E, 0x1D, 0xA0,
+  /* code 006E */
+  0xA0, 0x35, 0xE3, 0x80, 0xFF, 0xE0, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0x98,
+  /* code 006F */
+  0x9D, 0x2D, 0xBC, 0x0F, 0xFD, 0x78, 0x39, 0xD0, 0xF7, 0x43, 0x8F, 0x2E,
+  0x1F, 0xE0, 0x95,
+  /* code 0070 */
+  0xA0, 0x4E, 0xE3, 0x80, 0xFF, 0xE0, 0xF0, 0xB0, 0xE0, 0xB0, 0xE0, 0xB0,
+  0xF5, 0xF0, 0xFF, 0xD0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+  /* code 0071 */
+  0xA1, 0x4D, 0xF3, 0x83, 0xFF, 0x87, 0x87, 0x87, 0x43, 0x87, 0x43, 0x83,
+  0xCB, 0x81, 0xFB, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
+  /* code 0072 */
+  0x94, 0x1F, 0xE3, 0x3F, 0xCF, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x90,
+  /* code 0073 */
+  0x98, 0x2C, 0xBF, 0x1E, 0xA5, 0xD0, 0x0F, 0xE4, 0x0B, 0x9D, 0x38, 0xFF,
+  0x41, 0x40, 0x8D,
+  /* code 0074 */
+  0x8F, 0x26, 0xF0, 0xBF, 0xEF, 0xF3, 0xC0, 0xF0, 0x3C, 0x0B, 0xE1, 0xF8,
+  0x8E,
+  /* code 0075 */
+  0xA0, 0x35, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+  0xF6, 0xE0, 0x7E, 0xE0, 0x98,
+  /* code 0076 */
+  0x9B, 0x2E, 0xB0, 0x39, 0xD1, 0xD3, 0x8B, 0x0B, 0x38, 0x1E, 0xD0, 0x3F,
+  0x00, 0xB8, 0x96,
+  /* code 0077 */
+  0xA7, 0x43, 0xB0, 0xA0, 0xE7, 0x4F, 0x1D, 0x39, 0xF2, 0xC2, 0x9F, 0x68,
+  0x2F, 0x5F, 0x81, 0xF5, 0xF4, 0x0F, 0x0F, 0x9F,
+  /* code 0078 */
+  0x9B, 0x30, 0xB4, 0x78, 0xF3, 0xC1, 0xFD, 0x02, 0xE0, 0x0F, 0xC0, 0xB7,
+  0x8B, 0x47, 0x80, 0x94,
+  /* code 0079 */
+  0x9B, 0x45, 0xB0, 0x39, 0xD1, 0xD3, 0x8B, 0x0B, 0x78, 0x1F, 0xD0, 0x2F,
+  0x00, 0x78, 0x01, 0xD0, 0x3F, 0x00, 0xE0, 0x00,
+  /* code 007A */
+  0x97, 0x29, 0x7F, 0xE6, 0xAE, 0x02, 0xD0, 0xB4, 0x2D, 0x07, 0xAA, 0x7F,
+  0xE0, 0x91,
+  /* code 007B */
+  0x92, 0x53, 0xBD, 0x00, 0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x01, 0xE0, 0x0B,
+  0xC0, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0x7D, 0x88,
+  /* code 007C */
+  0x88, 0x2E, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90,
+  0x90, 0x90,
+  /* code 007D */
+  0x90, 0x52, 0xBD, 0x00, 0x1E, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x0F, 0x00,
+  0x07, 0xD0, 0x0F, 0x00, 0x0E, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0xBC, 0x8B,
+  /* code 007E */
+  0xB7, 0x16, 0xF4, 0x30, 0x97, 0xF8, 0x00, 0x14, 0xAE
+};
+
+const aafontsCharInfo_t charTable_DejaVuSansCondensedBold14_AA2_RLE[95] = {
+  {   4,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[    0] }, /* code 0020 */
+  {   5,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[    1] }, /* code 0021 */
+  {   6,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[   15] }, /* code 0022 */
+  {   9,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[   24] }, /* code 0023 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[   46] }, /* code 0024 */
+  {  11,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[   70] }, /* code 0025 */
+  {   9,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[   98] }, /* code 0026 */
+  {   3,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  121] }, /* code 0027 */
+  {   5,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  127] }, /* code 0028 */
+  {   5,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  143] }, /* code 0029 */
+  {   6,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  159] }, /* code 002A */
+  {   9,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  170] }, /* code 002B */
+  {   4,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  191] }, /* code 002C */
+  {   4,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  198] }, /* code 002D */
+  {   4,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  202] }, /* code 002E */
+  {   4,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  207] }, /* code 002F */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  219] }, /* code 0030 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  239] }, /* code 0031 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  260] }, /* code 0032 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  281] }, /* code 0033 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  302] }, /* code 0034 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  322] }, /* code 0035 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  343] }, /* code 0036 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  363] }, /* code 0037 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  383] }, /* code 0038 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  403] }, /* code 0039 */
+  {   4,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  423] }, /* code 003A */
+  {   4,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  432] }, /* code 003B */
+  {   9,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  444] }, /* code 003C */
+  {   9,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  459] }, /* code 003D */
+  {   9,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  468] }, /* code 003E */
+  {   6,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  483] }, /* code 003F */
+  {  11,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  499] }, /* code 0040 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  529] }, /* code 0041 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  550] }, /* code 0042 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  571] }, /* code 0043 */
+  {   9,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  591] }, /* code 0044 */
+  {   7,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  614] }, /* code 0045 */
+  {   7,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  633] }, /* code 0046 */
+  {   9,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  651] }, /* code 0047 */
+  {   9,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  674] }, /* code 0048 */
+  {   4,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  697] }, /* code 0049 */
+  {   4,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  709] }, /* code 004A */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  723] }, /* code 004B */
+  {   7,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  744] }, /* code 004C */
+  {  11,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  763] }, /* code 004D */
+  {   9,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  791] }, /* code 004E */
+  {   9,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  814] }, /* code 004F */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  837] }, /* code 0050 */
+  {   9,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  857] }, /* code 0051 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  885] }, /* code 0052 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  906] }, /* code 0053 */
+  {   7,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  926] }, /* code 0054 */
+  {   9,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  942] }, /* code 0055 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  965] }, /* code 0056 */
+  {  12,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[  986] }, /* code 0057 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1016] }, /* code 0058 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1037] }, /* code 0059 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1058] }, /* code 005A */
+  {   5,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1079] }, /* code 005B */
+  {   4,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1096] }, /* code 005C */
+  {   5,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1109] }, /* code 005D */
+  {   9,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1126] }, /* code 005E */
+  {   5,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1138] }, /* code 005F */
+  {   5,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1141] }, /* code 0060 */
+  {   7,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1148] }, /* code 0061 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1163] }, /* code 0062 */
+  {   6,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1184] }, /* code 0063 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1197] }, /* code 0064 */
+  {   7,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1217] }, /* code 0065 */
+  {   5,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1232] }, /* code 0066 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1246] }, /* code 0067 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1268] }, /* code 0068 */
+  {   4,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1289] }, /* code 0069 */
+  {   4,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1301] }, /* code 006A */
+  {   7,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1315] }, /* code 006B */
+  {   4,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1334] }, /* code 006C */
+  {  11,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1346] }, /* code 006D */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1368] }, /* code 006E */
+  {   7,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1385] }, /* code 006F */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1400] }, /* code 0070 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1422] }, /* code 0071 */
+  {   5,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1444] }, /* code 0072 */
+  {   6,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1455] }, /* code 0073 */
+  {   5,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1470] }, /* code 0074 */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1483] }, /* code 0075 */
+  {   7,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1500] }, /* code 0076 */
+  {  10,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1515] }, /* code 0077 */
+  {   7,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1535] }, /* code 0078 */
+  {   7,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1551] }, /* code 0079 */
+  {   6,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1571] }, /* code 007A */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1585] }, /* code 007B */
+  {   4,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1609] }, /* code 007C */
+  {   8,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1623] }, /* code 007D */
+  {   9,   0, &FontDejaVuSansCondensedBold14_AA2_RLE[ 1647] }  /* code 007E */
+};
+
+aafontsFont_t DejaVuSansCondensedBold14_AA2_RLE = 
+{
+  AAFONTS_FONTTYPE_AA2,                 /* Font type (anti-aliasing level) */
+  14,                                   /* Font height in pixels */
+  3,                                    /* Width to insert for unknown characters */
+  9,                                    /* Height of upper-case characters */
+  7,                                    /* Height of lower-case characters */
+  11,                                   /* Font baseline */
+  0x0020,                               /* Unicode address of first character */
+  0x007E,                               /* Unicode address of last character */
+  &charTable_DejaVuSansCondensedBold14_AA2_RLE[0], /* Font char data */
+  AAFONTS_ENCODING_RLE                  /* Glyph data encoding */
+};
@@ -0,0 +1,348 @@
+/**************************************************************************/
+/*!
+    @file     DejaVuSansMono10_AA2_RLE.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Run-length encoded copy of DejaVuSansMono10_AA2, generated
+              by tools/fontpack (do not edit)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include "DejaVuSansMono10_AA2_RLE.h"
+
+/* 988 bytes of glyph data, against 1900 for DejaVuSansMono10_AA2 */
+const uint8_t FontDejaVuSansMono10_AA2_RLE[988] = {
+  /* code 0020 */
+  0xB1,
+  /* code 0021 */
+  0x86, 0x14, 0x80, 0x20, 0x08, 0x02, 0x00, 0x40, 0x88, 0x00, 0x80, 0x8B,
+  /* code 0022 */
+  0x85, 0x07, 0x88, 0x22, 0xA3,
+  /* code 0023 */
+  0x86, 0x1F, 0x44, 0x15, 0x7F, 0xC4, 0x4F, 0xF8, 0x44, 0x15, 0x8A,
+  /* code 0024 */
+  0x86, 0x23, 0x80, 0xBE, 0x20, 0x0E, 0x00, 0xB8, 0x06, 0x3F, 0x42, 0x86,
+  /* code 0025 */
+  0x84, 0x22, 0x78, 0x22, 0x07, 0x8C, 0x28, 0x77, 0xC1, 0x50, 0x3C, 0x89,
+  /* code 0026 */
+  0x85, 0x21, 0x7C, 0x20, 0x05, 0x02, 0xC1, 0x49, 0x51, 0xCB, 0xA0, 0x89,
+  /* code 0027 */
+  0x86, 0x05, 0x80, 0x20, 0xA4,
+  /* code 0028 */
+  0x26, 0x02, 0x02, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x08, 0x8A,
+  /* code 0029 */
+  0x25, 0x14, 0x02, 0x00, 0x50, 0x14, 0x05, 0x01, 0x40, 0x80, 0x50, 0x8B,
+  /* code 002A */
+  0x85, 0x12, 0x56, 0x1E, 0x07, 0x82, 0x58, 0x98,
+  /* code 002B */
+  0x90, 0x14, 0x80, 0x20, 0x7F, 0xC2, 0x00, 0x80, 0x8B,
+  /* code 002C */
+  0xA4, 0x0C, 0xC0, 0x20, 0x14, 0x00,
+  /* code 002D */
+  0x99, 0x02, 0x78, 0x94,
+  /* code 002E */
+  0xA4, 0xC0, 0x8B,
+  /* code 002F */
+  0x87, 0x1C, 0x80, 0x20, 0x20, 0x08, 0x05, 0x02, 0x01, 0x40, 0x8C,
+  /* code 0030 */
+  0x85, 0x20, 0xB8, 0x22, 0x54, 0x55, 0x95, 0x45, 0x22, 0x4B, 0x80, 0x8A,
+  /* code 0031 */
+  0x85, 0x21, 0xF4, 0x05, 0x01, 0x40, 0x50, 0x14, 0x05, 0x0B, 0xE0, 0x89,
+  /* code 0032 */
+  0x85, 0x21, 0xBC, 0x01, 0x40, 0x50, 0x20, 0x20, 0x30, 0x1F, 0xE0, 0x89,
+  /* code 0033 */
+  0x85, 0x20, 0xB8, 0x51, 0x40, 0x51, 0xD0, 0x05, 0x41, 0x4F, 0xC0, 0x8A,
+  /* code 0034 */
+  0x86, 0x1F, 0x60, 0x28, 0x16, 0x09, 0x81, 0x21, 0xFD, 0x02, 0x8A,
+  /* code 0035 */
+  0x85, 0x20, 0xFC, 0x20, 0x08, 0x03, 0xF0, 0x05, 0x01, 0x5F, 0x80, 0x8A,
+  /* code 0036 */
+  0x85, 0x20, 0x7D, 0x30, 0x14, 0x06, 0xF1, 0x85, 0x11, 0x4B, 0xC0, 0x8A,
+  /* code 0037 */
+  0x84, 0x20, 0xBF, 0x40, 0x80, 0x20, 0x14, 0x08, 0x02, 0x02, 0x40, 0x8B,
+  /* code 0038 */
+  0x85, 0x1D, 0xB8, 0x21, 0x48, 0x51, 0xD1, 0x85, 0x51, 0x40, 0xC2, 0x8A,
+  /* code 0039 */
+  0x85, 0x20, 0xF8, 0x51, 0x54, 0x53, 0xF4, 0x05, 0x03, 0x1F, 0x40, 0x8A,
+  /* code 003A */
+  0x90, 0xC0, 0x92, 0xC0, 0x8B,
+  /* code 003B */
+  0x90, 0x00, 0xC0, 0x92, 0x0C, 0xC0, 0x20, 0x14, 0x00,
+  /* code 003C */
+  0x91, 0x10, 0x73, 0xE1, 0xE0, 0x03, 0xC0, 0x8E,
+  /* code 003D */
+  0x93, 0x0E, 0xBF, 0xC0, 0x0B, 0xFC, 0x8E,
+  /* code 003E */
+  0x8E, 0x11, 0x60, 0x03, 0xE0, 0x7D, 0xE0, 0x90,
+  /* code 003F */
+  0x85, 0x15, 0xFC, 0x01, 0x40, 0xC0, 0x80, 0x20, 0x88, 0x00, 0x40, 0x8B,
+  /* code 0040 */
+  0x8A, 0x26, 0x7D, 0x30, 0x95, 0xF5, 0x89, 0x5F, 0x30, 0x03, 0xD0, 0x00,
+  /* code 0041 */
+  0x86, 0x20, 0xA0, 0x28, 0x09, 0x45, 0x22, 0x08, 0xFF, 0x50, 0x40, 0x89,
+  /* code 0042 */
+  0x84, 0x1E, 0x7E, 0x14, 0x85, 0x21, 0xF4, 0x52, 0x54, 0x54, 0xC2, 0x8A,
+  /* code 0043 */
+  0x85, 0x21, 0x7D, 0x20, 0x14, 0x05, 0x01, 0x40, 0x20, 0x07, 0xD0, 0x89,
+  /* code 0044 */
+  0x84, 0x21, 0x7D, 0x14, 0x85, 0x15, 0x45, 0x51, 0x54, 0x87, 0xD0, 0x8A,
+  /* code 0045 */
+  0x84, 0x22, 0x7F, 0x54, 0x05, 0x01, 0xFD, 0x50, 0x14, 0x07, 0xF4, 0x89,
+  /* code 0046 */
+  0x84, 0x1E, 0xBF, 0x60, 0x08, 0x02, 0xFC, 0x80, 0x20, 0x08, 0x8D,
+  /* code 0047 */
+  0x85, 0x20, 0x7D, 0x20, 0x14, 0x05, 0x75, 0x45, 0x21, 0x47, 0xC0, 0x8A,
+  /* code 0048 */
+  0x84, 0x22, 0x41, 0x50, 0x54, 0x15, 0xFD, 0x41, 0x50, 0x54, 0x14, 0x89,
+  /* code 0049 */
+  0x85, 0x21, 0xFD, 0x08, 0x02, 0x00, 0x80, 0x20, 0x08, 0x0F, 0xD0, 0x89,
+  /* code 004A */
+  0x85, 0x20, 0x7D, 0x01, 0x40, 0x50, 0x14, 0x05, 0x02, 0x1F, 0x80, 0x8A,
+  /* code 004B */
+  0x84, 0x22, 0x41, 0x91, 0x85, 0x81, 0xE0, 0x45, 0x10, 0x84, 0x1C, 0x89,
+  /* code 004C */
+  0x84, 0x22, 0x40, 0x10, 0x04, 0x01, 0x00, 0x40, 0x10, 0x07, 0xF4, 0x89,
+  /* code 004D */
+  0x84, 0x22, 0x60, 0xD8, 0x75, 0x59, 0x56, 0x59, 0x94, 0x25, 0x08, 0x89,
+  /* code 004E */
+  0x84, 0x22, 0x61, 0x5C, 0x55, 0x55, 0x55, 0x55, 0x54, 0xD5, 0x24, 0x89,
+  /* code 004F */
+  0x85, 0x20, 0xB8, 0x62, 0x54, 0x55, 0x15, 0x45, 0x62, 0x4B, 0x80, 0x8A,
+  /* code 0050 */
+  0x84, 0x1F, 0x7F, 0x14, 0x55, 0x15, 0xFC, 0x50, 0x14, 0x05, 0x8C,
+  /* code 0051 */
+  0x85, 0x25, 0xB8, 0x62, 0x54, 0x55, 0x15, 0x45, 0x62, 0x4B, 0x80, 0x20,
+  0x85,
+  /* code 0052 */
+  0x84, 0x22, 0x7F, 0x14, 0x55, 0x15, 0xF4, 0x52, 0x14, 0x55, 0x08, 0x89,
+  /* code 0053 */
+  0x85, 0x20, 0xBC, 0x50, 0x54, 0x01, 0xF0, 0x05, 0x41, 0x4B, 0xC0, 0x8A,
+  /* code 0054 */
+  0x84, 0x20, 0xBF, 0xC2, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x8B,
+  /* code 0055 */
+  0x84, 0x21, 0x51, 0x54, 0x55, 0x15, 0x45, 0x51, 0x54, 0x52, 0xE0, 0x8A,
+  /* code 0056 */
+  0x84, 0x21, 0x50, 0x88, 0x22, 0x08, 0x55, 0x16, 0x02, 0x80, 0xA0, 0x8A,
+  /* code 0057 */
+  0x84, 0x22, 0x80, 0x60, 0x28, 0x99, 0x66, 0x66, 0x8C, 0x63, 0x14, 0x89,
+  /* code 0058 */
+  0x85, 0x21, 0x82, 0x14, 0x82, 0x80, 0x60, 0x29, 0x20, 0x98, 0x10, 0x89,
+  /* code 0059 */
+  0x84, 0x20, 0x90, 0x88, 0x51, 0x60, 0x34, 0x08, 0x02, 0x00, 0x80, 0x8B,
+  /* code 005A */
+  0x84, 0x22, 0x7F, 0x40, 0x80, 0x50, 0x20, 0x14, 0x08, 0x07, 0xF4, 0x89,
+  /* code 005B */
+  0x26, 0x0F, 0x02, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x3C, 0x8A,
+  /* code 005C */
+  0x26, 0x00, 0x14, 0x02, 0x00, 0x50, 0x08, 0x02, 0x00, 0x20, 0x08, 0x8A,
+  /* code 005D */
+  0x26, 0x1D, 0x01, 0x40, 0x50, 0x14, 0x05, 0x01, 0x40, 0x50, 0x74, 0x8A,
+  /* code 005E */
+  0x86, 0x07, 0xE1, 0x87, 0xA2,
+  /* code 005F */
+  0xAC, 0xC4,
+  /* code 0060 */
+  0x07, 0x24, 0x02, 0xA9,
+  /* code 0061 */
+  0x8F, 0x17, 0xFC, 0x00, 0x4F, 0xE5, 0x18, 0xFE, 0x89,
+  /* code 0062 */
+  0x26, 0x50, 0x14, 0x05, 0x01, 0xFC, 0x61, 0x54, 0x26, 0x15, 0xFC, 0x8A,
+  /* code 0063 */
+  0x8F, 0x17, 0x7D, 0x20, 0x14, 0x02, 0x00, 0x7D, 0x89,
+  /* code 0064 */
+  0x27, 0x00, 0x80, 0x20, 0x08, 0xBA, 0x61, 0x94, 0x26, 0x18, 0xBE, 0x89,
+  /* code 0065 */
+  0x8F, 0x17, 0xBC, 0x21, 0x5F, 0xE2, 0x00, 0xBD, 0x89,
+  /* code 0066 */
+  0x25, 0x07, 0x81, 0x00, 0x80, 0xFE, 0x08, 0x02, 0x00, 0x80, 0x20, 0x8B,
+  /* code 0067 */
+  0x8F, 0x21, 0xBA, 0x61, 0x94, 0x26, 0x18, 0xBE, 0x01, 0x4B, 0xC0,
+  /* code 0068 */
+  0x27, 0x50, 0x14, 0x05, 0x01, 0xBC, 0x61, 0x54, 0x25, 0x09, 0x42, 0x89,
+  /* code 0069 */
+  0x02, 0x08, 0x8C, 0x17, 0xB0, 0x08, 0x02, 0x00, 0x81, 0xFE, 0x89,
+  /* code 006A */
+  0x03, 0x05, 0x8B, 0x21, 0xB4, 0x05, 0x01, 0x40, 0x50, 0x14, 0x05, 0x0F,
+  0x00,
+  /* code 006B */
+  0x27, 0x50, 0x14, 0x05, 0x01, 0x4C, 0x5C, 0x1E, 0x05, 0x51, 0x49, 0x89,
+  /* code 006C */
+  0x27, 0xB8, 0x02, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x80, 0x1D, 0x89,
+  /* code 006D */
+  0x8E, 0x18, 0x7E, 0xD5, 0x65, 0x59, 0x56, 0x55, 0x80, 0x89,
+  /* code 006E */
+  0x8E, 0x18, 0x6F, 0x18, 0x55, 0x09, 0x42, 0x50, 0x80, 0x89,
+  /* code 006F */
+  0x8F, 0x16, 0xBC, 0x61, 0x54, 0x26, 0x14, 0xBC, 0x8A,
+  /* code 0070 */
+  0x8E, 0x22, 0x7F, 0x18, 0x55, 0x09, 0x85, 0x7F, 0x14, 0x05, 0x00,
+  /* code 0071 */
+  0x8F, 0x21, 0xBA, 0x61, 0x94, 0x26, 0x18, 0xBE, 0x00, 0x80, 0x20,
+  /* code 0072 */
+  0x8F, 0x15, 0x6F, 0x18, 0x05, 0x01, 0x40, 0x50, 0x8B,
+  /* code 0073 */
+  0x8F, 0x16, 0xFE, 0x50, 0x0B, 0xC0, 0x09, 0xFC, 0x8A,
+  /* code 0074 */
+  0x8B, 0x1B, 0x81, 0xFD, 0x08, 0x02, 0x00, 0x80, 0x2D, 0x89,
+  /* code 0075 */
+  0x8E, 0x18, 0x50, 0x94, 0x25, 0x09, 0x46, 0x3E, 0x80, 0x89,
+  /* code 0076 */
+  0x8F, 0x15, 0x85, 0x12, 0x09, 0x81, 0xD0, 0x30, 0x8B,
+  /* code 0077 */
+  0x8E, 0x18, 0x80, 0x62, 0x25, 0x94, 0x9A, 0x22, 0x40, 0x89,
+  /* code 0078 */
+  0x8F, 0x17, 0x83, 0x0A, 0x01, 0x41, 0xA4, 0x83, 0x89,
+  /* code 0079 */
+  0x8F, 0x21, 0x85, 0x22, 0x05, 0x80, 0xD0, 0x20, 0x08, 0x0D, 0x00,
+  /* code 007A */
+  0x8E, 0x18, 0x7F, 0x80, 0x80, 0x80, 0x90, 0x7F, 0x80, 0x89,
+  /* code 007B */
+  0x27, 0x07, 0x42, 0x00, 0x80, 0xD0, 0x08, 0x02, 0x00, 0x80, 0x1D, 0x89,
+  /* code 007C */
+  0x2A, 0x04, 0x01, 0x00, 0x40, 0x10, 0x04, 0x01, 0x00, 0x40, 0x10, 0x04,
+  0x86,
+  /* code 007D */
+  0x25, 0x38, 0x02, 0x00, 0x40, 0x0D, 0x09, 0x02, 0x00, 0x80, 0xE0, 0x8B,
+  /* code 007E */
+  0x94, 0xC1, 0x84, 0x01, 0xE0, 0x93
+};
+
+const aafontsCharInfo_t charTable_DejaVuSansMono10_AA2_RLE[95] = {
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[    0] }, /* code 0020 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[    1] }, /* code 0021 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[   13] }, /* code 0022 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[   18] }, /* code 0023 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[   29] }, /* code 0024 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[   41] }, /* code 0025 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[   53] }, /* code 0026 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[   65] }, /* code 0027 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[   70] }, /* code 0028 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[   82] }, /* code 0029 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[   94] }, /* code 002A */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  102] }, /* code 002B */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  111] }, /* code 002C */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  117] }, /* code 002D */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  121] }, /* code 002E */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  124] }, /* code 002F */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  135] }, /* code 0030 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  147] }, /* code 0031 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  159] }, /* code 0032 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  171] }, /* code 0033 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  183] }, /* code 0034 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  194] }, /* code 0035 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  206] }, /* code 0036 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  218] }, /* code 0037 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  230] }, /* code 0038 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  242] }, /* code 0039 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  254] }, /* code 003A */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  259] }, /* code 003B */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  268] }, /* code 003C */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  276] }, /* code 003D */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  283] }, /* code 003E */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  291] }, /* code 003F */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  303] }, /* code 0040 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  315] }, /* code 0041 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  327] }, /* code 0042 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  339] }, /* code 0043 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  351] }, /* code 0044 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  363] }, /* code 0045 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  375] }, /* code 0046 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  386] }, /* code 0047 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  398] }, /* code 0048 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  410] }, /* code 0049 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  422] }, /* code 004A */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  434] }, /* code 004B */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  446] }, /* code 004C */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  458] }, /* code 004D */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  470] }, /* code 004E */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  482] }, /* code 004F */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  494] }, /* code 0050 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  505] }, /* code 0051 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  518] }, /* code 0052 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  530] }, /* code 0053 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  542] }, /* code 0054 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  554] }, /* code 0055 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  566] }, /* code 0056 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  578] }, /* code 0057 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  590] }, /* code 0058 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  602] }, /* code 0059 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  614] }, /* code 005A */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  626] }, /* code 005B */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  638] }, /* code 005C */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  650] }, /* code 005D */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  662] }, /* code 005E */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  667] }, /* code 005F */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  669] }, /* code 0060 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  673] }, /* code 0061 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  682] }, /* code 0062 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  694] }, /* code 0063 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  703] }, /* code 0064 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  715] }, /* code 0065 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  724] }, /* code 0066 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  736] }, /* code 0067 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  747] }, /* code 0068 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  759] }, /* code 0069 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  770] }, /* code 006A */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  783] }, /* code 006B */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  795] }, /* code 006C */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  807] }, /* code 006D */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  817] }, /* code 006E */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  827] }, /* code 006F */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  836] }, /* code 0070 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  847] }, /* code 0071 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  858] }, /* code 0072 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  867] }, /* code 0073 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  876] }, /* code 0074 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  886] }, /* code 0075 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  896] }, /* code 0076 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  905] }, /* code 0077 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  915] }, /* code 0078 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  924] }, /* code 0079 */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  935] }, /* code 007A */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  945] }, /* code 007B */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  957] }, /* code 007C */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  970] }, /* code 007D */
+  {   5,   0, &FontDejaVuSansMono10_AA2_RLE[  982] }  /* code 007E */
+};
+
+aafontsFont_t DejaVuSansMono10_AA2_RLE = 
+{
+  AAFONTS_FONTTYPE_AA2,                 /* Font type (anti-aliasing level) */
+  10,                                   /* Font height in pixels */
+  5,                                    /* Width to insert for unknown characters */
+  7,                                    /* Height of upper-case characters */
+  5,                                    /* Height of lower-case characters */
+  8,                                    /* Font baseline */
+  0x0020,                               /* Unicode address of first character */
+  0x007E,                               /* Unicode address of last character */
+  &charTable_DejaVuSansMono10_AA2_RLE[0], /* Font char data */
+  AAFONTS_ENCODING_RLE                  /* Glyph data encoding */
+};
@@ -0,0 +1,422 @@
+/**************************************************************************/
+/*!
+    @file     DejaVuSansMono13_AA2_RLE.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Run-length encoded copy of DejaVuSansMono13_AA2, generated
+              by tools/fontpack (do not edit)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include "DejaVuSansMono13_AA2_RLE.h"
+
+/* 1438 bytes of glyph data, against 2470 for DejaVuSansMono13_AA2 */
+const uint8_t FontDejaVuSansMono13_AA2_RLE[1438] = {
+  /* code 0020 */
+  0xBF, 0x9A,
+  /* code 0021 */
+  0x90, 0x23, 0x80, 0x02, 0x00, 0x08, 0x00, 0x20, 0x00, 0x80, 0x02, 0x8C,
+  0x00, 0x80, 0x97,
+  /* code 0022 */
+  0x8F, 0x10, 0x88, 0x02, 0x20, 0x08, 0x80, 0xB9,
+  /* code 0023 */
+  0x8F, 0x32, 0x52, 0x02, 0x54, 0x7F, 0xF8, 0x22, 0x01, 0x48, 0x3F, 0xFC,
+  0x21, 0x40, 0x88, 0x97,
+  /* code 0024 */
+  0x90, 0x3F, 0x40, 0x1F, 0xF0, 0xC4, 0x03, 0x10, 0x03, 0xF0, 0x01, 0x20,
+  0x04, 0x83, 0xFC, 0x00, 0x40, 0x01, 0x89,
+  /* code 0025 */
+  0x8D, 0x36, 0x7C, 0x02, 0x18, 0x07, 0xC2, 0x00, 0x70, 0x09, 0x01, 0xC7,
+  0xC0, 0x21, 0x40, 0x7C, 0x95,
+  /* code 0026 */
+  0x8F, 0x35, 0xFC, 0x05, 0x00, 0x18, 0x00, 0x74, 0x06, 0x32, 0x54, 0x68,
+  0x70, 0x90, 0x7E, 0xD0, 0x94,
+  /* code 0027 */
+  0x90, 0x0E, 0x80, 0x02, 0x00, 0x08, 0xBA,
+  /* code 0028 */
+  0x89, 0x40, 0x60, 0x02, 0x00, 0x18, 0x00, 0x50, 0x02, 0x40, 0x09, 0x00,
+  0x14, 0x00, 0x60, 0x00, 0x80, 0x01, 0x80, 0x8F,
+  /* code 0029 */
+  0x88, 0x3F, 0x80, 0x01, 0x40, 0x02, 0x00, 0x08, 0x00, 0x24, 0x00, 0x90,
+  0x02, 0x00, 0x08, 0x00, 0x50, 0x02, 0x91,
+  /* code 002A */
+  0x90, 0x23, 0x40, 0x21, 0x20, 0x3E, 0x00, 0xF4, 0x08, 0x58, 0x01, 0xA5,
+  /* code 002B */
+  0x9E, 0x1C, 0x80, 0x02, 0x01, 0xFF, 0xD0, 0x20, 0x00, 0x80, 0x9E,
+  /* code 002C */
+  0xBA, 0x0E, 0xD0, 0x07, 0x00, 0x14, 0x90,
+  /* code 002D */
+  0xAB, 0x02, 0xF8, 0xAB,
+  /* code 002E */
+  0xBA, 0xC0, 0x85, 0xC0, 0x97,
+  /* code 002F */
+  0x92, 0x34, 0xC0, 0x09, 0x00, 0x20, 0x02, 0x40, 0x08, 0x00, 0x90, 0x02,
+  0x00, 0x24, 0x00, 0x80, 0x92,
+  /* code 0030 */
+  0x8F, 0x33, 0xF8, 0x08, 0x24, 0x24, 0x60, 0xA5, 0x82, 0x26, 0x08, 0x28,
+  0x20, 0x90, 0x3E, 0x96,
+  /* code 0031 */
+  0x8E, 0x35, 0xBC, 0x00, 0x20, 0x00, 0x80, 0x02, 0x00, 0x08, 0x00, 0x20,
+  0x00, 0x80, 0x1F, 0xE0, 0x95,
+  /* code 0032 */
+  0x8E, 0x35, 0xBE, 0x05, 0x09, 0x00, 0x14, 0x00, 0x80, 0x09, 0x00, 0x90,
+  0x09, 0x00, 0x7F, 0xD0, 0x95,
+  /* code 0033 */
+  0x8E, 0x34, 0x7E, 0x01, 0x09, 0x00, 0x24, 0x0F, 0x40, 0x02, 0x40, 0x06,
+  0x14, 0x28, 0x2F, 0x80, 0x96,
+  /* code 0034 */
+  0x91, 0x32, 0xE0, 0x09, 0x80, 0x56, 0x06, 0x18, 0x20, 0x61, 0xFF, 0xE0,
+  0x06, 0x00, 0x18, 0x95,
+  /* code 0035 */
+  0x8E, 0x34, 0xFF, 0x02, 0x00, 0x08, 0x00, 0x3F, 0x80, 0x02, 0x40, 0x06,
+  0x00, 0x24, 0x7F, 0x80, 0x96,
+  /* code 0036 */
+  0x8F, 0x33, 0xBE, 0x0A, 0x00, 0x30, 0x01, 0xAF, 0x07, 0x06, 0x08, 0x08,
+  0x20, 0x60, 0x3F, 0x96,
+  /* code 0037 */
+  0x8E, 0x33, 0xFF, 0xC0, 0x05, 0x00, 0x20, 0x01, 0x80, 0x09, 0x00, 0x30,
+  0x01, 0x80, 0x09, 0x97,
+  /* code 0038 */
+  0x8E, 0x34, 0x7F, 0x03, 0x06, 0x08, 0x18, 0x0F, 0x80, 0x81, 0x86, 0x02,
+  0x0C, 0x18, 0x1F, 0xC0, 0x96,
+  /* code 0039 */
+  0x8E, 0x34, 0x7E, 0x03, 0x05, 0x18, 0x08, 0x30, 0x60, 0x7E, 0x80, 0x06,
+  0x00, 0x34, 0x7F, 0x40, 0x96,
+  /* code 003A */
+  0x9E, 0xC0, 0x85, 0xC0, 0x93, 0xC0, 0x85, 0xC0, 0x97,
+  /* code 003B */
+  0x9E, 0x07, 0xC0, 0x03, 0x93, 0x0E, 0xD0, 0x07, 0x00, 0x14, 0x90,
+  /* code 003C */
+  0xA0, 0x0A, 0xC0, 0xF8, 0x1C, 0x86, 0x0A, 0xF4, 0x00, 0x1C, 0x9C,
+  /* code 003D */
+  0xA2, 0x00, 0x40, 0xC4, 0x87, 0x00, 0x40, 0xC4, 0xA3,
+  /* code 003E */
+  0x9B, 0x1D, 0x60, 0x00, 0x3E, 0x00, 0x07, 0x02, 0xE0, 0x70, 0xA0,
+  /* code 003F */
+  0x8E, 0x25, 0x7F, 0x40, 0x02, 0x00, 0x24, 0x02, 0x80, 0x0C, 0x00, 0x20,
+  0x8C, 0x00, 0x80, 0x97,
+  /* code 0040 */
+  0x8F, 0x42, 0x7E, 0x06, 0x09, 0x30, 0x19, 0x8B, 0xE5, 0x21, 0x94, 0x86,
+  0x62, 0xF8, 0x80, 0x01, 0xC0, 0x01, 0xF8, 0x87,
+  /* code 0041 */
+  0x8F, 0x35, 0x74, 0x01, 0x90, 0x09, 0x80, 0x22, 0x01, 0x89, 0x0B, 0xF8,
+  0x20, 0x21, 0x80, 0x90, 0x94,
+  /* code 0042 */
+  0x8D, 0x35, 0x7F, 0xC1, 0x81, 0x46, 0x05, 0x1F, 0xD0, 0x60, 0x61, 0x80,
+  0x86, 0x06, 0x1F, 0xF0, 0x96,
+  /* code 0043 */
+  0x8F, 0x33, 0xFC, 0x09, 0x04, 0x20, 0x01, 0x80, 0x06, 0x00, 0x08, 0x00,
+  0x24, 0x10, 0x3F, 0x96,
+  /* code 0044 */
+  0x8D, 0x35, 0x7F, 0x41, 0x82, 0x46, 0x06, 0x18, 0x08, 0x60, 0x21, 0x81,
+  0x86, 0x0D, 0x1F, 0xD0, 0x96,
+  /* code 0045 */
+  0x8D, 0x36, 0x7F, 0xD1, 0x80, 0x06, 0x00, 0x1F, 0xF4, 0x60, 0x01, 0x80,
+  0x06, 0x00, 0x1F, 0xF4, 0x95,
+  /* code 0046 */
+  0x8E, 0x31, 0xFF, 0x42, 0x00, 0x08, 0x00, 0x3F, 0xC0, 0x80, 0x02, 0x00,
+  0x08, 0x00, 0x20, 0x99,
+  /* code 0047 */
+  0x8F, 0x34, 0xBE, 0x09, 0x05, 0x20, 0x01, 0x80, 0x06, 0x07, 0x88, 0x06,
+  0x24, 0x18, 0x2F, 0xC0, 0x95,
+  /* code 0048 */
+  0x8E, 0x35, 0x80, 0x82, 0x02, 0x08, 0x08, 0x3F, 0xE0, 0x80, 0x82, 0x02,
+  0x08, 0x08, 0x20, 0x20, 0x95,
+  /* code 0049 */
+  0x8E, 0x35, 0xFF, 0x40, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60,
+  0x01, 0x80, 0x3F, 0xD0, 0x95,
+  /* code 004A */
+  0x8F, 0x33, 0xBC, 0x00, 0x20, 0x00, 0x80, 0x02, 0x00, 0x08, 0x00, 0x20,
+  0x00, 0x80, 0xBD, 0x96,
+  /* code 004B */
+  0x8D, 0x37, 0x60, 0x71, 0x86, 0x06, 0x70, 0x1F, 0x40, 0x77, 0x01, 0x86,
+  0x06, 0x09, 0x18, 0x0D, 0x94,
+  /* code 004C */
+  0x8D, 0x36, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80,
+  0x06, 0x00, 0x1F, 0xF8, 0x95,
+  /* code 004D */
+  0x8D, 0x37, 0x74, 0x39, 0xE1, 0xA6, 0x49, 0x99, 0xA6, 0x63, 0x19, 0x80,
+  0x66, 0x01, 0x98, 0x06, 0x94,
+  /* code 004E */
+  0x8D, 0x36, 0x70, 0x61, 0xE1, 0x86, 0x86, 0x19, 0x58, 0x62, 0x61, 0x8A,
+  0x86, 0x0E, 0x18, 0x28, 0x95,
+  /* code 004F */
+  0x8E, 0x34, 0x7E, 0x03, 0x06, 0x18, 0x08, 0x60, 0x21, 0x80, 0x86, 0x02,
+  0x0C, 0x18, 0x1F, 0x80, 0x96,
+  /* code 0050 */
+  0x8D, 0x32, 0x7F, 0x81, 0x82, 0x46, 0x06, 0x18, 0x24, 0x7F, 0x81, 0x80,
+  0x06, 0x00, 0x18, 0x99,
+  /* code 0051 */
+  0x8E, 0x3C, 0x7E, 0x03, 0x06, 0x18, 0x08, 0x60, 0x21, 0x80, 0x86, 0x02,
+  0x0C, 0x18, 0x1F, 0xC0, 0x02, 0x40, 0x8E,
+  /* code 0052 */
+  0x8D, 0x37, 0x7F, 0x81, 0x82, 0x46, 0x06, 0x18, 0x24, 0x7F, 0x41, 0x83,
+  0x06, 0x06, 0x18, 0x0D, 0x94,
+  /* code 0053 */
+  0x8E, 0x34, 0x7F, 0x03, 0x02, 0x18, 0x00, 0x3F, 0x00, 0x07, 0x40, 0x06,
+  0x14, 0x18, 0x2F, 0xC0, 0x96,
+  /* code 0054 */
+  0x8D, 0x34, 0xBF, 0xF4, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18,
+  0x00, 0x60, 0x01, 0x80, 0x97,
+  /* code 0055 */
+  0x8D, 0x35, 0x60, 0x61, 0x81, 0x86, 0x06, 0x18, 0x18, 0x60, 0x61, 0x81,
+  0x82, 0x05, 0x07, 0xE0, 0x96,
+  /* code 0056 */
+  0x8E, 0x34, 0x80, 0x93, 0x02, 0x09, 0x08, 0x18, 0x60, 0x22, 0x40, 0x98,
+  0x01, 0xA0, 0x03, 0x40, 0x96,
+  /* code 0057 */
+  0x8D, 0x36, 0xC0, 0x16, 0x40, 0x99, 0x72, 0x15, 0xC8, 0x69, 0x60, 0xA3,
+  0x83, 0x4E, 0x09, 0x24, 0x95,
+  /* code 0058 */
+  0x8E, 0x36, 0xD0, 0xD1, 0x85, 0x02, 0x60, 0x03, 0x40, 0x1D, 0x00, 0xC8,
+  0x06, 0x18, 0x30, 0x24, 0x94,
+  /* code 0059 */
+  0x8D, 0x34, 0xA0, 0x30, 0xC2, 0x41, 0x88, 0x02, 0xD0, 0x06, 0x00, 0x18,
+  0x00, 0x60, 0x01, 0x80, 0x97,
+  /* code 005A */
+  0x8D, 0x37, 0x7F, 0xF4, 0x00, 0xC0, 0x0C, 0x00, 0x90, 0x06, 0x00, 0x30,
+  0x02, 0x00, 0x1F, 0xFE, 0x94,
+  /* code 005B */
+  0x88, 0x41, 0x78, 0x01, 0x40, 0x05, 0x00, 0x14, 0x00, 0x50, 0x01, 0x40,
+  0x05, 0x00, 0x14, 0x00, 0x50, 0x01, 0xE0, 0x8F,
+  /* code 005C */
+  0x8E, 0x3C, 0x80, 0x02, 0x40, 0x02, 0x00, 0x09, 0x00, 0x08, 0x00, 0x24,
+  0x00, 0x20, 0x00, 0x90, 0x00, 0xC0, 0x8E,
+  /* code 005D */
+  0x88, 0x40, 0xF0, 0x00, 0x80, 0x02, 0x00, 0x08, 0x00, 0x20, 0x00, 0x80,
+  0x02, 0x00, 0x08, 0x00, 0x20, 0x03, 0xC0, 0x90,
+  /* code 005E */
+  0x8F, 0x11, 0x70, 0x06, 0x30, 0x60, 0x30, 0xB8,
+  /* code 005F */
+  0xBF, 0x93, 0xC5, 0x00, 0x80,
+  /* code 0060 */
+  0x87, 0x09, 0x70, 0x00, 0x20, 0xBF, 0x88,
+  /* code 0061 */
+  0x9C, 0x27, 0xBF, 0x00, 0x06, 0x07, 0xF8, 0x20, 0x60, 0x82, 0x82, 0xFA,
+  0x95,
+  /* code 0062 */
+  0x86, 0x3C, 0x60, 0x01, 0x80, 0x06, 0x00, 0x1F, 0xE0, 0x70, 0x91, 0x81,
+  0x86, 0x06, 0x1C, 0x24, 0x7F, 0x80, 0x96,
+  /* code 0063 */
+  0x9D, 0x26, 0xFD, 0x0D, 0x00, 0x20, 0x00, 0x80, 0x03, 0x40, 0x03, 0xF4,
+  0x95,
+  /* code 0064 */
+  0x8A, 0x39, 0x60, 0x01, 0x80, 0x06, 0x07, 0xE8, 0x30, 0xA0, 0x81, 0x82,
+  0x06, 0x0C, 0x28, 0x1F, 0xA0, 0x95,
+  /* code 0065 */
+  0x9D, 0x1B, 0xFC, 0x08, 0x18, 0x3F, 0xE0, 0x80, 0x03, 0x86, 0x03, 0xFD,
+  0x95,
+  /* code 0066 */
+  0x89, 0x38, 0xB8, 0x02, 0x00, 0x18, 0x03, 0xFE, 0x01, 0x80, 0x06, 0x00,
+  0x18, 0x00, 0x60, 0x01, 0x80, 0x97,
+  /* code 0067 */
+  0x9C, 0x27, 0x7E, 0x83, 0x0A, 0x08, 0x18, 0x20, 0x60, 0xC2, 0x81, 0xFA,
+  0x84, 0x07, 0x60, 0x7F, 0x88,
+  /* code 0068 */
+  0x86, 0x3D, 0x60, 0x01, 0x80, 0x06, 0x00, 0x1A, 0xF0, 0x74, 0x61, 0x81,
+  0x86, 0x06, 0x18, 0x18, 0x60, 0x60, 0x95,
+  /* code 0069 */
+  0x89, 0x00, 0x80, 0x91, 0x27, 0xBC, 0x00, 0x20, 0x00, 0x80, 0x02, 0x00,
+  0x08, 0x03, 0xFE, 0x95,
+  /* code 006A */
+  0x89, 0x01, 0x90, 0x90, 0x33, 0x7D, 0x00, 0x24, 0x00, 0x90, 0x02, 0x40,
+  0x09, 0x00, 0x24, 0x00, 0x80, 0x3E, 0x89,
+  /* code 006B */
+  0x87, 0x3C, 0x80, 0x02, 0x00, 0x08, 0x00, 0x20, 0xD0, 0x8C, 0x03, 0xD0,
+  0x0D, 0xC0, 0x21, 0x80, 0x82, 0x80, 0x95,
+  /* code 006C */
+  0x86, 0x3D, 0x7D, 0x00, 0x14, 0x00, 0x50, 0x01, 0x40, 0x05, 0x00, 0x14,
+  0x00, 0x50, 0x01, 0x80, 0x03, 0xD0, 0x95,
+  /* code 006D */
+  0x9B, 0x29, 0x7E, 0xB1, 0x8C, 0x96, 0x22, 0x58, 0x89, 0x62, 0x25, 0x88,
+  0x90, 0x94,
+  /* code 006E */
+  0x9B, 0x28, 0x6B, 0xC1, 0xD1, 0x86, 0x06, 0x18, 0x18, 0x60, 0x61, 0x81,
+  0x80, 0x95,
+  /* code 006F */
+  0x9C, 0x26, 0x7E, 0x03, 0x09, 0x08, 0x18, 0x20, 0x60, 0xC2, 0x41, 0xF8,
+  0x96,
+  /* code 0070 */
+  0x9B, 0x32, 0x7F, 0x81, 0xC2, 0x46, 0x06, 0x18, 0x18, 0x70, 0x91, 0xFE,
+  0x06, 0x00, 0x18, 0x8B,
+  /* code 0071 */
+  0x9C, 0x35, 0x7E, 0x83, 0x0A, 0x08, 0x18, 0x20, 0x60, 0xC2, 0x81, 0xFA,
+  0x00, 0x18, 0x00, 0x60, 0x87,
+  /* code 0072 */
+  0x9D, 0x23, 0xAF, 0x03, 0x40, 0x08, 0x00, 0x20, 0x00, 0x80, 0x02, 0x98,
+  /* code 0073 */
+  0x9C, 0x0F, 0xBF, 0x02, 0x00, 0x0E, 0x86, 0x0F, 0xF0, 0x00, 0xC1, 0xFD,
+  0x96,
+  /* code 0074 */
+  0x8F, 0x34, 0x90, 0x02, 0x40, 0x7F, 0xD0, 0x24, 0x00, 0x90, 0x02, 0x40,
+  0x09, 0x00, 0x1F, 0x40, 0x95,
+  /* code 0075 */
+  0x9B, 0x28, 0x60, 0x61, 0x81, 0x86, 0x06, 0x18, 0x18, 0x30, 0xA0, 0xBE,
+  0x80, 0x95,
+  /* code 0076 */
+  0x9C, 0x25, 0xC1, 0x82, 0x49, 0x05, 0x20, 0x09, 0x80, 0x2D, 0x00, 0x70,
+  0x97,
+  /* code 0077 */
+  0x9B, 0x28, 0x80, 0x16, 0x40, 0x95, 0x62, 0x09, 0x98, 0x38, 0x90, 0x93,
+  0x40, 0x95,
+  /* code 0078 */
+  0x9C, 0x28, 0x90, 0xC0, 0xC8, 0x00, 0xD0, 0x07, 0x80, 0x32, 0x43, 0x43,
+  0x40, 0x94,
+  /* code 0079 */
+  0x9C, 0x32, 0xC1, 0x82, 0x48, 0x06, 0x20, 0x0E, 0x40, 0x1C, 0x00, 0x60,
+  0x02, 0x40, 0x2C, 0x8A,
+  /* code 007A */
+  0x9C, 0x27, 0xFF, 0x80, 0x0C, 0x00, 0x80, 0x09, 0x00, 0x90, 0x07, 0xFE,
+  0x95,
+  /* code 007B */
+  0x89, 0x41, 0xB4, 0x03, 0x00, 0x08, 0x00, 0x20, 0x0A, 0x00, 0x06, 0x00,
+  0x08, 0x00, 0x20, 0x00, 0xC0, 0x02, 0xD0, 0x8E,
+  /* code 007C */
+  0x89, 0x46, 0x80, 0x02, 0x00, 0x08, 0x00, 0x20, 0x00, 0x80, 0x02, 0x00,
+  0x08, 0x00, 0x20, 0x00, 0x80, 0x02, 0x00, 0x08, 0x89,
+  /* code 007D */
+  0x87, 0x17, 0xB4, 0x00, 0x60, 0x01, 0x80, 0x02, 0x86, 0x22, 0xD0, 0x0C,
+  0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0xB4, 0x90,
+  /* code 007E */
+  0xAA, 0x0B, 0xF4, 0x04, 0x2E, 0xA3
+};
+
+const aafontsCharInfo_t charTable_DejaVuSansMono13_AA2_RLE[95] = {
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[    0] }, /* code 0020 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[    2] }, /* code 0021 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[   17] }, /* code 0022 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[   25] }, /* code 0023 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[   41] }, /* code 0024 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[   60] }, /* code 0025 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[   77] }, /* code 0026 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[   94] }, /* code 0027 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  101] }, /* code 0028 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  121] }, /* code 0029 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  140] }, /* code 002A */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  152] }, /* code 002B */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  163] }, /* code 002C */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  170] }, /* code 002D */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  174] }, /* code 002E */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  179] }, /* code 002F */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  196] }, /* code 0030 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  212] }, /* code 0031 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  229] }, /* code 0032 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  246] }, /* code 0033 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  263] }, /* code 0034 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  279] }, /* code 0035 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  296] }, /* code 0036 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  312] }, /* code 0037 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  328] }, /* code 0038 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  345] }, /* code 0039 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  362] }, /* code 003A */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  371] }, /* code 003B */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  382] }, /* code 003C */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  393] }, /* code 003D */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  402] }, /* code 003E */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  413] }, /* code 003F */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  429] }, /* code 0040 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  449] }, /* code 0041 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  466] }, /* code 0042 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  483] }, /* code 0043 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  499] }, /* code 0044 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  516] }, /* code 0045 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  533] }, /* code 0046 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  549] }, /* code 0047 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  566] }, /* code 0048 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  583] }, /* code 0049 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  600] }, /* code 004A */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  616] }, /* code 004B */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  633] }, /* code 004C */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  650] }, /* code 004D */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  667] }, /* code 004E */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  684] }, /* code 004F */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  701] }, /* code 0050 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  717] }, /* code 0051 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  736] }, /* code 0052 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  753] }, /* code 0053 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  770] }, /* code 0054 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  787] }, /* code 0055 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  804] }, /* code 0056 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  821] }, /* code 0057 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  838] }, /* code 0058 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  855] }, /* code 0059 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  872] }, /* code 005A */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  889] }, /* code 005B */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  909] }, /* code 005C */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  928] }, /* code 005D */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  948] }, /* code 005E */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  956] }, /* code 005F */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  961] }, /* code 0060 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  968] }, /* code 0061 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[  981] }, /* code 0062 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1000] }, /* code 0063 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1013] }, /* code 0064 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1031] }, /* code 0065 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1044] }, /* code 0066 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1062] }, /* code 0067 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1079] }, /* code 0068 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1098] }, /* code 0069 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1114] }, /* code 006A */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1133] }, /* code 006B */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1152] }, /* code 006C */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1171] }, /* code 006D */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1185] }, /* code 006E */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1199] }, /* code 006F */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1212] }, /* code 0070 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1228] }, /* code 0071 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1245] }, /* code 0072 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1257] }, /* code 0073 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1270] }, /* code 0074 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1287] }, /* code 0075 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1301] }, /* code 0076 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1314] }, /* code 0077 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1328] }, /* code 0078 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1342] }, /* code 0079 */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1358] }, /* code 007A */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1371] }, /* code 007B */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1391] }, /* code 007C */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1412] }, /* code 007D */
+  {   7,   0, &FontDejaVuSansMono13_AA2_RLE[ 1432] }  /* code 007E */
+};
+
+aafontsFont_t DejaVuSansMono13_AA2_RLE = 
+{
+  AAFONTS_FONTTYPE_AA2,                 /* Font type (anti-aliasing level) */
+  13,                                   /* Font height in pixels */
+  7,                                    /* Width to insert for unknown characters */
+  8,                                    /* Height of upper-case characters */
+  6,                                    /* Height of lower-case characters */
+  10,                                   /* Font baseline */
+  0x0020,                               /* Unicode address of first character */
+  0x007E,                               /* Unicode address of last character */
+  &charTable_DejaVuSansMono13_AA2_RLE[0], /* Font char data */
+  AAFONTS_ENCODING_RLE                  /* Glyph data encoding */
+};
@@ -0,0 +1,426 @@
+/**************************************************************************/
+/*!
+    @file     DejaVuSansMono14_AA2_RLE.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Run-length encoded copy of DejaVuSansMono14_AA2, generated
+              by tools/fontpack (do not edit)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include "DejaVuSansMono14_AA2_RLE.h"
+
+/* 1585 bytes of glyph data, against 2660 for DejaVuSansMono14_AA2 */
+const uint8_t FontDejaVuSansMono14_AA2_RLE[1585] = {
+  /* code 0020 */
+  0xBF, 0xA1,
+  /* code 0021 */
+  0x90, 0x23, 0x80, 0x02, 0x00, 0x08, 0x00, 0x20, 0x00, 0x80, 0x02, 0x8C,
+  0x07, 0x80, 0x02, 0x97,
+  /* code 0022 */
+  0x8F, 0x11, 0x89, 0x02, 0x24, 0x08, 0x90, 0xBF,
+  /* code 0023 */
+  0x97, 0x32, 0x88, 0x05, 0x21, 0xFF, 0xF0, 0x85, 0x02, 0x20, 0xFF, 0xF4,
+  0x96, 0x02, 0x14, 0x96,
+  /* code 0024 */
+  0x90, 0x46, 0x40, 0x0F, 0xE0, 0x94, 0x52, 0x10, 0x07, 0x80, 0x02, 0xF0,
+  0x04, 0x51, 0x12, 0x43, 0xF8, 0x01, 0x00, 0x04, 0x89,
+  /* code 0025 */
+  0x8E, 0x3D, 0xF4, 0x09, 0x20, 0x24, 0x80, 0x3D, 0x38, 0x0E, 0x03, 0x8F,
+  0x40, 0x93, 0x02, 0x4C, 0x03, 0xD0, 0x94,
+  /* code 0026 */
+  0x8F, 0x0E, 0xBD, 0x06, 0x00, 0x18, 0x85, 0x27, 0xC0, 0x0B, 0x80, 0x62,
+  0x89, 0x42, 0x67, 0x03, 0x07, 0xF7, 0x94,
+  /* code 0027 */
+  0x90, 0x0E, 0x80, 0x02, 0x00, 0x08, 0xBF, 0x01, 0x00,
+  /* code 0028 */
+  0x8A, 0x46, 0xC0, 0x09, 0x00, 0x20, 0x01, 0x80, 0x06, 0x00, 0x14, 0x00,
+  0x60, 0x01, 0x80, 0x02, 0x00, 0x09, 0x00, 0x0C, 0x8F,
+  /* code 0029 */
+  0x88, 0x47, 0x90, 0x00, 0x80, 0x02, 0x00, 0x09, 0x00, 0x18, 0x00, 0x60,
+  0x01, 0x80, 0x09, 0x00, 0x20, 0x00, 0x80, 0x09, 0x90,
+  /* code 002A */
+  0x90, 0x23, 0x40, 0x21, 0x20, 0x3F, 0x40, 0xBC, 0x09, 0x4C, 0x01, 0xAC,
+  /* code 002B */
+  0x9E, 0x2A, 0x80, 0x02, 0x00, 0x08, 0x07, 0xFF, 0x80, 0x80, 0x02, 0x00,
+  0x08, 0x97,
+  /* code 002C */
+  0xBF, 0x10, 0x0D, 0x00, 0x70, 0x02, 0x40, 0x90,
+  /* code 002D */
+  0xB2, 0x02, 0xBC, 0xAB,
+  /* code 002E */
+  0xBF, 0x0A, 0x0D, 0x00, 0x34, 0x96,
+  /* code 002F */
+  0x92, 0x3B, 0xC0, 0x09, 0x00, 0x20, 0x01, 0x40, 0x0C, 0x00, 0x60, 0x02,
+  0x00, 0x18, 0x00, 0x90, 0x02, 0x92,
+  /* code 0030 */
+  0x8F, 0x3B, 0xBD, 0x09, 0x0C, 0x20, 0x14, 0x80, 0x66, 0x35, 0x88, 0x06,
+  0x20, 0x14, 0x90, 0xC0, 0xBD, 0x95,
+  /* code 0031 */
+  0x8E, 0x3D, 0x7D, 0x00, 0x14, 0x00, 0x50, 0x01, 0x40, 0x05, 0x00, 0x14,
+  0x00, 0x50, 0x01, 0x40, 0x7F, 0xD0, 0x94,
+  /* code 0032 */
+  0x8E, 0x0B, 0x7F, 0x02, 0x06, 0x85, 0x2A, 0x80, 0x06, 0x00, 0x34, 0x02,
+  0x40, 0x24, 0x02, 0x40, 0x1F, 0xFC, 0x95,
+  /* code 0033 */
+  0x8F, 0x3B, 0xFD, 0x08, 0x09, 0x00, 0x14, 0x00, 0xD0, 0xBC, 0x00, 0x0D,
+  0x00, 0x19, 0x40, 0x91, 0xFE, 0x95,
+  /* code 0034 */
+  0x91, 0x39, 0xD0, 0x0A, 0x40, 0x65, 0x02, 0x14, 0x14, 0x50, 0x81, 0x47,
+  0xFF, 0x80, 0x14, 0x00, 0x50, 0x95,
+  /* code 0035 */
+  0x8E, 0x3C, 0xBF, 0xC2, 0x00, 0x08, 0x00, 0x2F, 0xD0, 0x00, 0xD0, 0x01,
+  0x80, 0x06, 0x50, 0x34, 0xBF, 0x40, 0x95,
+  /* code 0036 */
+  0x8F, 0x3B, 0xBE, 0x06, 0x00, 0x20, 0x00, 0xAF, 0x87, 0x42, 0x48, 0x06,
+  0x20, 0x18, 0x90, 0x90, 0xFE, 0x95,
+  /* code 0037 */
+  0x8D, 0x3A, 0x7F, 0xF8, 0x00, 0x80, 0x06, 0x00, 0x24, 0x00, 0xC0, 0x09,
+  0x00, 0x30, 0x01, 0x80, 0x0C, 0x98,
+  /* code 0038 */
+  0x8F, 0x3B, 0xFE, 0x09, 0x09, 0x20, 0x14, 0x90, 0x90, 0xBC, 0x0D, 0x09,
+  0x20, 0x18, 0xC0, 0xA1, 0xFE, 0x95,
+  /* code 0039 */
+  0x8F, 0x3A, 0xFD, 0x0D, 0x08, 0x20, 0x14, 0x80, 0x63, 0x42, 0x83, 0xF6,
+  0x00, 0x14, 0x41, 0xC0, 0xFC, 0x96,
+  /* code 003A */
+  0xA5, 0x08, 0xD0, 0x03, 0x40, 0x92, 0x08, 0xD0, 0x03, 0x40, 0x96,
+  /* code 003B */
+  0xA5, 0x08, 0xD0, 0x03, 0x40, 0x92, 0x0E, 0xD0, 0x07, 0x00, 0x24, 0x90,
+  /* code 003C */
+  0xA0, 0x12, 0x60, 0x3E, 0x1F, 0x00, 0x7C, 0x86, 0x0A, 0xF8, 0x00, 0x18,
+  0x9B,
+  /* code 003D */
+  0xA9, 0x06, 0x7F, 0xF8, 0x86, 0x06, 0x7F, 0xF8, 0xA2,
+  /* code 003E */
+  0x9B, 0x0A, 0x60, 0x00, 0x7C, 0x86, 0x12, 0xB8, 0x02, 0xE1, 0xF0, 0x18,
+  0xA0,
+  /* code 003F */
+  0x8F, 0x24, 0xFD, 0x04, 0x0C, 0x00, 0x30, 0x03, 0x40, 0x30, 0x00, 0x80,
+  0x8C, 0x07, 0x80, 0x02, 0x97,
+  /* code 0040 */
+  0x96, 0x42, 0x7F, 0x06, 0x0A, 0x30, 0x0D, 0x87, 0xF5, 0x30, 0xD4, 0xC2,
+  0x61, 0xFC, 0xC0, 0x01, 0xC0, 0x01, 0xFC, 0x87,
+  /* code 0041 */
+  0x90, 0x3B, 0xE0, 0x07, 0xC0, 0x16, 0x40, 0x96, 0x03, 0x0C, 0x18, 0x24,
+  0xBF, 0xD3, 0x01, 0x98, 0x03, 0x94,
+  /* code 0042 */
+  0x8D, 0x3D, 0x7F, 0xD1, 0x80, 0xC6, 0x02, 0x58, 0x0C, 0x7F, 0xC1, 0x80,
+  0xD6, 0x01, 0x98, 0x09, 0x7F, 0xE0, 0x95,
+  /* code 0043 */
+  0x8F, 0x3B, 0x7F, 0x06, 0x01, 0x20, 0x00, 0x80, 0x06, 0x00, 0x18, 0x00,
+  0x20, 0x00, 0x60, 0x10, 0x7F, 0x95,
+  /* code 0044 */
+  0x8D, 0x3C, 0x7F, 0x81, 0x81, 0xC6, 0x02, 0x58, 0x06, 0x60, 0x19, 0x80,
+  0x66, 0x02, 0x58, 0x1C, 0x7F, 0x80, 0x96,
+  /* code 0045 */
+  0x8D, 0x3D, 0x7F, 0xE1, 0x80, 0x06, 0x00, 0x18, 0x00, 0x7F, 0xE1, 0x80,
+  0x06, 0x00, 0x18, 0x00, 0x7F, 0xF0, 0x95,
+  /* code 0046 */
+  0x8E, 0x39, 0xBF, 0xD2, 0x40, 0x09, 0x00, 0x24, 0x00, 0xBF, 0xC2, 0x40,
+  0x09, 0x00, 0x24, 0x00, 0x90, 0x98,
+  /* code 0047 */
+  0x8F, 0x3B, 0xBE, 0x0A, 0x00, 0x20, 0x01, 0x80, 0x06, 0x0B, 0x98, 0x06,
+  0x20, 0x18, 0xA0, 0x60, 0xBF, 0x95,
+  /* code 0048 */
+  0x8D, 0x3E, 0x60, 0x19, 0x80, 0x66, 0x01, 0x98, 0x06, 0x7F, 0xF9, 0x80,
+  0x66, 0x01, 0x98, 0x06, 0x60, 0x18, 0x94,
+  /* code 0049 */
+  0x8E, 0x3C, 0xBF, 0x80, 0x20, 0x00, 0x80, 0x02, 0x00, 0x08, 0x00, 0x20,
+  0x00, 0x80, 0x02, 0x00, 0xBF, 0x80, 0x95,
+  /* code 004A */
+  0x8F, 0x3A, 0xBE, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18,
+  0x00, 0x61, 0x42, 0x42, 0xF8, 0x96,
+  /* code 004B */
+  0x8D, 0x3E, 0x60, 0x39, 0x83, 0x46, 0x24, 0x1A, 0x40, 0x7F, 0x01, 0x8A,
+  0x06, 0x0D, 0x18, 0x1C, 0x60, 0x28, 0x94,
+  /* code 004C */
+  0x8D, 0x3E, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80,
+  0x06, 0x00, 0x18, 0x00, 0x7F, 0xF8, 0x94,
+  /* code 004D */
+  0x8D, 0x3E, 0x74, 0x39, 0xE1, 0xE7, 0x89, 0x99, 0x66, 0x63, 0x59, 0x89,
+  0x66, 0x01, 0x98, 0x06, 0x60, 0x18, 0x94,
+  /* code 004E */
+  0x8D, 0x3E, 0x74, 0x19, 0xE0, 0x67, 0xD1, 0x99, 0x86, 0x62, 0x19, 0x86,
+  0x66, 0x0D, 0x98, 0x1E, 0x60, 0x38, 0x94,
+  /* code 004F */
+  0x8F, 0x3B, 0xFD, 0x09, 0x0C, 0x30, 0x15, 0x80, 0x66, 0x01, 0x98, 0x06,
+  0x30, 0x14, 0x90, 0xC0, 0xFD, 0x95,
+  /* code 0050 */
+  0x8D, 0x39, 0x7F, 0xE1, 0x80, 0x96, 0x01, 0x98, 0x09, 0x7F, 0xE1, 0x80,
+  0x06, 0x00, 0x18, 0x00, 0x60, 0x99,
+  /* code 0051 */
+  0x8F, 0x49, 0xFD, 0x09, 0x0C, 0x30, 0x15, 0x80, 0x66, 0x01, 0x98, 0x06,
+  0x30, 0x14, 0x90, 0xC0, 0xFD, 0x00, 0x28, 0x00, 0x20, 0x87,
+  /* code 0052 */
+  0x8D, 0x3E, 0x7F, 0xE1, 0x80, 0x96, 0x01, 0x98, 0x09, 0x7F, 0xC1, 0x81,
+  0xC6, 0x02, 0x58, 0x07, 0x60, 0x08, 0x94,
+  /* code 0053 */
+  0x8F, 0x3B, 0xFE, 0x0C, 0x02, 0x60, 0x00, 0xD0, 0x00, 0xFE, 0x00, 0x09,
+  0x00, 0x18, 0x80, 0x91, 0xFE, 0x95,
+  /* code 0054 */
+  0x8D, 0x3B, 0xBF, 0xF8, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C,
+  0x00, 0x30, 0x00, 0xC0, 0x03, 0x97,
+  /* code 0055 */
+  0x8D, 0x3D, 0x60, 0x19, 0x80, 0x66, 0x01, 0x98, 0x06, 0x60, 0x19, 0x80,
+  0x66, 0x01, 0x8C, 0x09, 0x0F, 0xE0, 0x95,
+  /* code 0056 */
+  0x8E, 0x3B, 0xC0, 0x93, 0x02, 0x49, 0x0C, 0x18, 0x60, 0x31, 0x40, 0x89,
+  0x02, 0x60, 0x07, 0x80, 0x0D, 0x96,
+  /* code 0057 */
+  0x8D, 0x3D, 0xC0, 0x0E, 0x40, 0x29, 0x34, 0x95, 0xD6, 0x65, 0x98, 0xA2,
+  0x62, 0x86, 0x4A, 0x1C, 0x24, 0x70, 0x95,
+  /* code 0058 */
+  0x8E, 0x3D, 0xD0, 0x30, 0xC2, 0x42, 0x88, 0x03, 0xD0, 0x0B, 0x00, 0x69,
+  0x02, 0x4C, 0x18, 0x18, 0xD0, 0x20, 0x94,
+  /* code 0059 */
+  0x8D, 0x3B, 0xA0, 0x28, 0xD0, 0xC1, 0x89, 0x02, 0xA0, 0x07, 0x40, 0x08,
+  0x00, 0x20, 0x00, 0x80, 0x02, 0x97,
+  /* code 005A */
+  0x8E, 0x3D, 0xFF, 0xD0, 0x03, 0x00, 0x24, 0x01, 0x80, 0x0C, 0x00, 0x90,
+  0x06, 0x00, 0x34, 0x01, 0xFF, 0xE0, 0x94,
+  /* code 005B */
+  0x88, 0x49, 0x7D, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80,
+  0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x07, 0xD0, 0x8E,
+  /* code 005C */
+  0x8E, 0x43, 0x80, 0x02, 0x40, 0x06, 0x00, 0x08, 0x00, 0x18, 0x00, 0x30,
+  0x00, 0x50, 0x00, 0x80, 0x02, 0x40, 0x03, 0x8E,
+  /* code 005D */
+  0x88, 0x48, 0xF4, 0x00, 0x50, 0x01, 0x40, 0x05, 0x00, 0x14, 0x00, 0x50,
+  0x01, 0x40, 0x05, 0x00, 0x14, 0x00, 0x50, 0x0F, 0x40, 0x8F,
+  /* code 005E */
+  0x8F, 0x12, 0x78, 0x03, 0x24, 0x70, 0x28, 0xBE,
+  /* code 005F */
+  0xBF, 0x9A, 0xC6,
+  /* code 0060 */
+  0x88, 0x09, 0xC0, 0x00, 0xD0, 0xBF, 0x8E,
+  /* code 0061 */
+  0x9C, 0x2E, 0xBE, 0x00, 0x06, 0x00, 0x18, 0x1F, 0xE0, 0xC1, 0x83, 0x0A,
+  0x0B, 0xE8, 0x95,
+  /* code 0062 */
+  0x87, 0x42, 0x80, 0x02, 0x00, 0x08, 0x00, 0x2B, 0x80, 0xD2, 0x43, 0x06,
+  0x08, 0x18, 0x30, 0x60, 0xD2, 0x42, 0xB8, 0x96,
+  /* code 0063 */
+  0x9D, 0x2D, 0xBD, 0x09, 0x04, 0x30, 0x00, 0x80, 0x03, 0x00, 0x09, 0x04,
+  0x0B, 0xD0, 0x95,
+  /* code 0064 */
+  0x8A, 0x40, 0x60, 0x01, 0x80, 0x06, 0x03, 0xE8, 0x24, 0xA0, 0xC1, 0x82,
+  0x06, 0x0C, 0x18, 0x24, 0xA0, 0x3E, 0x80, 0x95,
+  /* code 0065 */
+  0x9D, 0x1B, 0xBD, 0x09, 0x09, 0x30, 0x14, 0xFF, 0xE2, 0x85, 0x0B, 0x90,
+  0x50, 0xBE, 0x95,
+  /* code 0066 */
+  0x89, 0x3F, 0x7C, 0x02, 0x00, 0x0C, 0x02, 0xFF, 0x00, 0xC0, 0x03, 0x00,
+  0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x97,
+  /* code 0067 */
+  0x9D, 0x43, 0xFA, 0x09, 0x28, 0x30, 0x60, 0x81, 0x83, 0x06, 0x09, 0x28,
+  0x0F, 0xA0, 0x01, 0x81, 0x09, 0x02, 0xE0,
+  /* code 0068 */
+  0x87, 0x43, 0x80, 0x02, 0x00, 0x08, 0x00, 0x2B, 0xC0, 0xD1, 0x83, 0x06,
+  0x08, 0x18, 0x20, 0x60, 0x81, 0x82, 0x06, 0x95,
+  /* code 0069 */
+  0x89, 0x01, 0x90, 0x90, 0x2F, 0x7D, 0x00, 0x24, 0x00, 0x90, 0x02, 0x40,
+  0x09, 0x00, 0x24, 0x0F, 0xFD, 0x94,
+  /* code 006A */
+  0x89, 0x01, 0x50, 0x90, 0x44, 0x7D, 0x00, 0x14, 0x00, 0x50, 0x01, 0x40,
+  0x05, 0x00, 0x14, 0x00, 0x50, 0x01, 0x40, 0x09, 0x03, 0xE0, 0x00,
+  /* code 006B */
+  0x87, 0x44, 0x80, 0x02, 0x00, 0x08, 0x00, 0x20, 0xA0, 0x89, 0x02, 0xD0,
+  0x0F, 0xC0, 0x22, 0x80, 0x83, 0x42, 0x07, 0x40, 0x94,
+  /* code 006C */
+  0x86, 0x44, 0x7E, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18,
+  0x00, 0x60, 0x01, 0x80, 0x03, 0x00, 0x0B, 0xC0, 0x95,
+  /* code 006D */
+  0x9B, 0x2F, 0xFE, 0xD3, 0x25, 0x88, 0x92, 0x22, 0x48, 0x89, 0x22, 0x24,
+  0x88, 0x92, 0x95,
+  /* code 006E */
+  0x9C, 0x2E, 0xAF, 0x03, 0x46, 0x0C, 0x18, 0x20, 0x60, 0x81, 0x82, 0x06,
+  0x08, 0x18, 0x95,
+  /* code 006F */
+  0x9D, 0x2C, 0xF8, 0x09, 0x24, 0x30, 0x60, 0x81, 0x83, 0x06, 0x09, 0x24,
+  0x0F, 0x80, 0x96,
+  /* code 0070 */
+  0x9C, 0x44, 0xAE, 0x03, 0x49, 0x0C, 0x18, 0x20, 0x60, 0xC1, 0x83, 0x49,
+  0x0A, 0xE0, 0x20, 0x00, 0x80, 0x02, 0x00, 0x00,
+  /* code 0071 */
+  0x9D, 0x43, 0xFA, 0x09, 0x28, 0x30, 0x60, 0x81, 0x83, 0x06, 0x09, 0x28,
+  0x0F, 0xA0, 0x01, 0x80, 0x06, 0x00, 0x18,
+  /* code 0072 */
+  0x9D, 0x2A, 0x9F, 0x82, 0x80, 0x09, 0x00, 0x20, 0x00, 0x80, 0x02, 0x00,
+  0x08, 0x98,
+  /* code 0073 */
+  0x9C, 0x0E, 0x7F, 0x03, 0x01, 0x0C, 0x86, 0x17, 0xFC, 0x00, 0x18, 0x10,
+  0x60, 0x7F, 0x96,
+  /* code 0074 */
+  0x8F, 0x3B, 0x50, 0x01, 0x40, 0x7F, 0xF0, 0x14, 0x00, 0x50, 0x01, 0x40,
+  0x05, 0x00, 0x18, 0x00, 0x3F, 0x95,
+  /* code 0075 */
+  0x9C, 0x2E, 0x81, 0x82, 0x06, 0x08, 0x18, 0x20, 0x60, 0x81, 0x83, 0x0A,
+  0x07, 0xE8, 0x95,
+  /* code 0076 */
+  0x9C, 0x2D, 0xC0, 0x62, 0x42, 0x46, 0x08, 0x08, 0x60, 0x26, 0x40, 0x68,
+  0x00, 0xE0, 0x96,
+  /* code 0077 */
+  0x9B, 0x2F, 0x80, 0x0E, 0x40, 0x35, 0x31, 0x88, 0x95, 0x25, 0x64, 0xB2,
+  0xC1, 0x86, 0x95,
+  /* code 0078 */
+  0x9C, 0x2F, 0xA0, 0xA0, 0x96, 0x00, 0xF0, 0x02, 0x80, 0x1A, 0x40, 0xC3,
+  0x0D, 0x07, 0x94,
+  /* code 0079 */
+  0x9C, 0x44, 0xC0, 0x62, 0x42, 0x46, 0x08, 0x0C, 0x60, 0x16, 0x40, 0x3C,
+  0x00, 0xA0, 0x02, 0x40, 0x0C, 0x02, 0xD0, 0x00,
+  /* code 007A */
+  0x9C, 0x2E, 0xFF, 0x80, 0x09, 0x00, 0x60, 0x07, 0x00, 0x30, 0x02, 0x40,
+  0x0F, 0xF8, 0x95,
+  /* code 007B */
+  0x89, 0x22, 0x7C, 0x02, 0x40, 0x08, 0x00, 0x20, 0x00, 0xC0, 0x2C, 0x86,
+  0x1E, 0xC0, 0x02, 0x00, 0x08, 0x00, 0x24, 0x00, 0x7C, 0x8E,
+  /* code 007C */
+  0x89, 0x4D, 0x80, 0x02, 0x00, 0x08, 0x00, 0x20, 0x00, 0x80, 0x02, 0x00,
+  0x08, 0x00, 0x20, 0x00, 0x80, 0x02, 0x00, 0x08, 0x00, 0x20, 0x89,
+  /* code 007D */
+  0x87, 0x48, 0xB8, 0x00, 0x20, 0x00, 0xC0, 0x03, 0x00, 0x09, 0x00, 0x0B,
+  0x00, 0x90, 0x03, 0x00, 0x0C, 0x00, 0x20, 0x0B, 0x80, 0x90,
+  /* code 007E */
+  0xAA, 0x0B, 0xF8, 0x14, 0x1F, 0xAA
+};
+
+const aafontsCharInfo_t charTable_DejaVuSansMono14_AA2_RLE[95] = {
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[    0] }, /* code 0020 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[    2] }, /* code 0021 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[   18] }, /* code 0022 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[   26] }, /* code 0023 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[   42] }, /* code 0024 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[   63] }, /* code 0025 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[   82] }, /* code 0026 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  101] }, /* code 0027 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  110] }, /* code 0028 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  131] }, /* code 0029 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  152] }, /* code 002A */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  164] }, /* code 002B */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  178] }, /* code 002C */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  186] }, /* code 002D */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  190] }, /* code 002E */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  196] }, /* code 002F */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  214] }, /* code 0030 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  232] }, /* code 0031 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  251] }, /* code 0032 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  270] }, /* code 0033 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  288] }, /* code 0034 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  306] }, /* code 0035 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  325] }, /* code 0036 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  343] }, /* code 0037 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  361] }, /* code 0038 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  379] }, /* code 0039 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  397] }, /* code 003A */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  408] }, /* code 003B */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  420] }, /* code 003C */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  433] }, /* code 003D */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  442] }, /* code 003E */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  455] }, /* code 003F */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  472] }, /* code 0040 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  492] }, /* code 0041 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  510] }, /* code 0042 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  529] }, /* code 0043 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  547] }, /* code 0044 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  566] }, /* code 0045 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  585] }, /* code 0046 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  603] }, /* code 0047 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  621] }, /* code 0048 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  640] }, /* code 0049 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  659] }, /* code 004A */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  677] }, /* code 004B */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  696] }, /* code 004C */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  715] }, /* code 004D */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  734] }, /* code 004E */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  753] }, /* code 004F */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  771] }, /* code 0050 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  789] }, /* code 0051 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  811] }, /* code 0052 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  830] }, /* code 0053 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  848] }, /* code 0054 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  866] }, /* code 0055 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  885] }, /* code 0056 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  903] }, /* code 0057 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  922] }, /* code 0058 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  941] }, /* code 0059 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  959] }, /* code 005A */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[  978] }, /* code 005B */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1000] }, /* code 005C */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1020] }, /* code 005D */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1042] }, /* code 005E */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1050] }, /* code 005F */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1053] }, /* code 0060 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1060] }, /* code 0061 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1075] }, /* code 0062 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1095] }, /* code 0063 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1110] }, /* code 0064 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1130] }, /* code 0065 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1145] }, /* code 0066 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1164] }, /* code 0067 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1183] }, /* code 0068 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1203] }, /* code 0069 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1221] }, /* code 006A */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1244] }, /* code 006B */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1265] }, /* code 006C */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1286] }, /* code 006D */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1301] }, /* code 006E */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1316] }, /* code 006F */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1331] }, /* code 0070 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1351] }, /* code 0071 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1370] }, /* code 0072 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1384] }, /* code 0073 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1399] }, /* code 0074 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1417] }, /* code 0075 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1432] }, /* code 0076 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1447] }, /* code 0077 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1462] }, /* code 0078 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1477] }, /* code 0079 */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1497] }, /* code 007A */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1512] }, /* code 007B */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1534] }, /* code 007C */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1557] }, /* code 007D */
+  {   7,   0, &FontDejaVuSansMono14_AA2_RLE[ 1579] }  /* code 007E */
+};
+
+aafontsFont_t DejaVuSansMono14_AA2_RLE = 
+{
+  AAFONTS_FONTTYPE_AA2,                 /* Font type (anti-aliasing level) */
+  14,                                   /* Font height in pixels */
+  7,                                    /* Width to insert for unknown characters */
+  9,                                    /* Height of upper-case characters */
+  7,                                    /* Height of lower-case characters */
+  11,                                   /* Font baseline */
+  0x0020,                               /* Unicode address of first character */
+  0x007E,                               /* Unicode address of last character */
+  &charTable_DejaVuSansMono14_AA2_RLE[0], /* Font char data */
+  AAFONTS_ENCODING_RLE                  /* Glyph data encoding */
+};
@@ -0,0 +1,434 @@
+/**************************************************************************/
+/*!
+    @file     FontCalibri18_AA2_RLE.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Run-length encoded copy of FontCalibri18_AA2, generated
+              by tools/fontpack (do not edit)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include "FontCalibri18_AA2_RLE.h"
+
+/* 1689 bytes of glyph data, against 3546 for FontCalibri18_AA2 */
+const uint8_t FontFontCalibri18_AA2_RLE[1689] = {
+  /* code 0020 */
+  0xB5,
+  /* code 0021 */
+  0x95, 0x1F, 0xD0, 0x34, 0x09, 0x02, 0x40, 0x90, 0x24, 0x09, 0x87, 0x06,
+  0xD0, 0x34, 0x94,
+  /* code 0022 */
+  0x98, 0x15, 0xD6, 0x0C, 0x60, 0x86, 0x08, 0x20, 0xBC,
+  /* code 0023 */
+  0xA4, 0x3B, 0x82, 0x42, 0x08, 0x7F, 0xFC, 0x60, 0x81, 0x86, 0x2F, 0xFE,
+  0x24, 0x50, 0x92, 0x42, 0x09, 0x9C,
+  /* code 0024 */
+  0x98, 0x53, 0x80, 0x06, 0x00, 0xFF, 0x0D, 0x09, 0x30, 0x00, 0xB0, 0x00,
+  0x7E, 0x00, 0x0E, 0x00, 0x19, 0x80, 0xA2, 0xFE, 0x01, 0x80, 0x05, 0x90,
+  /* code 0025 */
+  0xAC, 0x31, 0xBC, 0x03, 0x06, 0x14, 0x24, 0x18, 0x61, 0x80, 0x61, 0x4C,
+  0x00, 0xBC, 0x90, 0x87, 0x31, 0x63, 0xD0, 0x02, 0x24, 0xC0, 0x30, 0x82,
+  0x02, 0x42, 0x48, 0x18, 0x07, 0xD0, 0xAC,
+  /* code 0026 */
+  0xA9, 0x61, 0x7F, 0x40, 0x0C, 0x1C, 0x01, 0xC1, 0xC0, 0x0D, 0x34, 0x00,
+  0x7C, 0x00, 0x1E, 0xC1, 0x83, 0x4B, 0x28, 0x30, 0x2F, 0x03, 0x81, 0xF4,
+  0x0F, 0xF0, 0xE0, 0xA7,
+  /* code 0027 */
+  0x8C, 0x09, 0xD3, 0x08, 0x20, 0x9E,
+  /* code 0028 */
+  0x95, 0x3D, 0x50, 0x30, 0x18, 0x0A, 0x02, 0x40, 0xD0, 0x34, 0x0D, 0x02,
+  0x40, 0xA0, 0x18, 0x03, 0x00, 0x50, 0x85,
+  /* code 0029 */
+  0x94, 0x3C, 0xC0, 0x14, 0x06, 0x00, 0xC0, 0x24, 0x09, 0x02, 0x40, 0x90,
+  0x24, 0x0C, 0x07, 0x02, 0x80, 0xC0, 0x87,
+  /* code 002A */
+  0x9E, 0x1C, 0x80, 0x2A, 0x70, 0x0E, 0x02, 0xA7, 0x00, 0x80, 0xBF, 0x01,
+  0x00,
+  /* code 002B */
+  0xAC, 0x2B, 0x90, 0x02, 0x40, 0x09, 0x07, 0xFF, 0xC0, 0x90, 0x02, 0x40,
+  0x09, 0xA4,
+  /* code 002C */
+  0xB0, 0x0C, 0xA0, 0xA0, 0xC1, 0x40, 0x89,
+  /* code 002D */
+  0xB1, 0x03, 0x7F, 0xA3,
+  /* code 002E */
+  0xB0, 0x05, 0xA0, 0xA0, 0x90,
+  /* code 002F */
+  0x95, 0x45, 0xA0, 0x0D, 0x01, 0x80, 0x24, 0x03, 0x00, 0x60, 0x09, 0x00,
+  0xC0, 0x18, 0x02, 0x40, 0x30, 0x06, 0x00, 0x90, 0x8F,
+  /* code 0030 */
+  0xA4, 0x3A, 0xFD, 0x0D, 0x1C, 0x70, 0x25, 0x80, 0x96, 0x02, 0x58, 0x09,
+  0x70, 0x24, 0xD1, 0xC0, 0xFC, 0x9D,
+  /* code 0031 */
+  0xA4, 0x3C, 0x74, 0x0D, 0x90, 0x02, 0x40, 0x09, 0x00, 0x24, 0x00, 0x90,
+  0x02, 0x40, 0x09, 0x03, 0xFF, 0x40, 0x9B,
+  /* code 0032 */
+  0xA3, 0x0B, 0x7F, 0x42, 0x07, 0x85, 0x2B, 0xC0, 0x07, 0x00, 0x24, 0x02,
+  0x80, 0x28, 0x02, 0x80, 0x1F, 0xFE, 0x9B,
+  /* code 0033 */
+  0xA3, 0x3B, 0x7F, 0x02, 0x0A, 0x00, 0x18, 0x00, 0xD0, 0x7E, 0x00, 0x07,
+  0x00, 0x0C, 0x20, 0x70, 0xBF, 0x9D,
+  /* code 0034 */
+  0xA5, 0x3A, 0xB4, 0x07, 0xD0, 0x26, 0x41, 0x89, 0x0C, 0x24, 0x90, 0x93,
+  0xFF, 0xE0, 0x09, 0x00, 0x24, 0x9C,
+  /* code 0035 */
+  0xA3, 0x3B, 0xBF, 0x82, 0x40, 0x09, 0x00, 0x2F, 0xC0, 0x01, 0xC0, 0x03,
+  0x40, 0x0C, 0x80, 0xA1, 0xFE, 0x9D,
+  /* code 0036 */
+  0xA4, 0x3B, 0x7F, 0x06, 0x00, 0x30, 0x00, 0xFF, 0x87, 0x03, 0x5C, 0x09,
+  0x30, 0x24, 0x91, 0xC0, 0xFD, 0x9C,
+  /* code 0037 */
+  0xA2, 0x3B, 0x7F, 0xFC, 0x00, 0xA0, 0x03, 0x00, 0x28, 0x00, 0xD0, 0x06,
+  0x00, 0x34, 0x01, 0xC0, 0x0D, 0x9E,
+  /* code 0038 */
+  0xA3, 0x3C, 0x7F, 0x43, 0x03, 0x0C, 0x0C, 0x2C, 0x90, 0x2E, 0x03, 0x47,
+  0x18, 0x09, 0x70, 0x34, 0xBF, 0x40, 0x9C,
+  /* code 0039 */
+  0xA3, 0x3B, 0x7F, 0x07, 0x07, 0x18, 0x0C, 0x70, 0x34, 0xBF, 0xD0, 0x03,
+  0x40, 0x1C, 0x00, 0xD0, 0xFD, 0x9D,
+  /* code 003A */
+  0x9C, 0x05, 0xA0, 0xA0, 0x8D, 0x05, 0xA0, 0xA0, 0x90,
+  /* code 003B */
+  0x9C, 0x05, 0xA0, 0xA0, 0x8D, 0x0C, 0x60, 0x60, 0x91, 0x80, 0x89,
+  /* code 003C */
+  0xAE, 0x2B, 0x60, 0x1D, 0x07, 0x80, 0x60, 0x00, 0x78, 0x00, 0x1D, 0x00,
+  0x06, 0xA2,
+  /* code 003D */
+  0xB7, 0x06, 0x7F, 0xF8, 0x8D, 0x06, 0x7F, 0xF8, 0xA9,
+  /* code 003E */
+  0xA9, 0x2B, 0x70, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x07, 0x00, 0xF0, 0x3C,
+  0x07, 0xA7,
+  /* code 003F */
+  0x9C, 0x0B, 0x7F, 0x02, 0x07, 0x85, 0x1A, 0xD0, 0x07, 0x01, 0xF4, 0x06,
+  0x00, 0x18, 0x8B, 0x08, 0x60, 0x01, 0x80, 0x9E,
+  /* code 0040 */
+  0xBF, 0x6B, 0x00, 0x1F, 0xFC, 0x00, 0x2C, 0x01, 0xD0, 0x28, 0x00, 0x1C,
+  0x0C, 0x3E, 0x83, 0x06, 0x24, 0x60, 0xC2, 0x4C, 0x14, 0x30, 0x93, 0x0D,
+  0x24, 0x24, 0xBD, 0xF8, 0x06, 0x8B, 0x01, 0xA0, 0x8B, 0x05, 0xBF, 0xF0,
+  0x9D,
+  /* code 0041 */
+  0xAF, 0x4D, 0xB4, 0x00, 0x3A, 0x00, 0x18, 0xC0, 0x09, 0x24, 0x03, 0x06,
+  0x01, 0x80, 0xC0, 0xBF, 0xF4, 0x70, 0x07, 0x28, 0x00, 0xD0, 0xA3,
+  /* code 0042 */
+  0xA8, 0x45, 0xBF, 0xC0, 0x90, 0xA0, 0x90, 0x60, 0x90, 0x90, 0xBF, 0xC0,
+  0x90, 0x70, 0x90, 0x34, 0x90, 0x70, 0xBF, 0xD0, 0xA0,
+  /* code 0043 */
+  0xAA, 0x43, 0xFE, 0x07, 0x01, 0x4D, 0x00, 0x0C, 0x00, 0x1C, 0x00, 0x1C,
+  0x00, 0x0D, 0x00, 0x07, 0x01, 0x41, 0xFE, 0xA0,
+  /* code 0044 */
+  0xAD, 0x4C, 0xBF, 0xD0, 0x24, 0x1D, 0x09, 0x01, 0xC2, 0x40, 0x34, 0x90,
+  0x0D, 0x24, 0x03, 0x49, 0x01, 0xC2, 0x40, 0xD0, 0xBF, 0xC0, 0xA6,
+  /* code 0045 */
+  0xA3, 0x3D, 0xBF, 0xD2, 0x40, 0x09, 0x00, 0x24, 0x00, 0xBF, 0xC2, 0x40,
+  0x09, 0x00, 0x24, 0x00, 0xBF, 0xD0, 0x9B,
+  /* code 0046 */
+  0xA3, 0x39, 0xBF, 0xD2, 0x40, 0x09, 0x00, 0x24, 0x00, 0xBF, 0xC2, 0x40,
+  0x09, 0x00, 0x24, 0x00, 0x90, 0x9F,
+  /* code 0047 */
+  0xAF, 0x19, 0xFF, 0x41, 0xD0, 0x20, 0xD0, 0x00, 0x70, 0x86, 0x2B, 0x70,
+  0x7F, 0x1C, 0x01, 0xC3, 0x40, 0x70, 0x74, 0x1C, 0x03, 0xFD, 0xA4,
+  /* code 0048 */
+  0xAD, 0x4E, 0x90, 0x18, 0x24, 0x06, 0x09, 0x01, 0x82, 0x40, 0x60, 0xBF,
+  0xF8, 0x24, 0x06, 0x09, 0x01, 0x82, 0x40, 0x60, 0x90, 0x18, 0xA4,
+  /* code 0049 */
+  0x94, 0x21, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x90,
+  /* code 004A */
+  0x9A, 0x28, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x02, 0x8F,
+  0xC0, 0x95,
+  /* code 004B */
+  0xA8, 0x46, 0x90, 0x70, 0x90, 0xD0, 0x93, 0x40, 0x99, 0x00, 0xBC, 0x00,
+  0x97, 0x00, 0x92, 0x80, 0x90, 0xD0, 0x90, 0x34, 0x9F,
+  /* code 004C */
+  0x9E, 0x34, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90, 0x09, 0x00, 0x90,
+  0x09, 0x00, 0xBF, 0xC0, 0x97,
+  /* code 004D */
+  0xBC, 0x69, 0xB4, 0x01, 0xE0, 0xB8, 0x02, 0xA0, 0x9C, 0x03, 0x60, 0x99,
+  0x06, 0x60, 0x97, 0x0C, 0x60, 0x93, 0x58, 0x60, 0x91, 0xA4, 0x60, 0x90,
+  0xF0, 0x60, 0x90, 0xA0, 0x60, 0xB0,
+  /* code 004E */
+  0xB2, 0x57, 0xB4, 0x06, 0x0B, 0xC0, 0x60, 0x9A, 0x06, 0x09, 0x30, 0x60,
+  0x92, 0x86, 0x09, 0x0D, 0x60, 0x90, 0x7A, 0x09, 0x02, 0xE0, 0x90, 0x0E,
+  0xA8,
+  /* code 004F */
+  0xB4, 0x53, 0xFF, 0x40, 0x74, 0x0D, 0x09, 0x00, 0x70, 0xC0, 0x03, 0x0C,
+  0x00, 0x34, 0xC0, 0x03, 0x0D, 0x00, 0x70, 0x70, 0x0D, 0x01, 0xFF, 0xAA,
+  /* code 0050 */
+  0xA8, 0x41, 0xBF, 0xC0, 0x90, 0x70, 0x90, 0x34, 0x90, 0x30, 0x90, 0xA0,
+  0xBF, 0x80, 0x90, 0x00, 0x90, 0x00, 0x90, 0xA4,
+  /* code 0051 */
+  0xB4, 0x55, 0xFF, 0x40, 0x70, 0x0D, 0x0D, 0x00, 0x60, 0xC0, 0x03, 0x1C,
+  0x00, 0x30, 0xC0, 0x03, 0x0D, 0x00, 0x60, 0x70, 0x1D, 0x01, 0xFF, 0xF0,
+  0x88, 0x01, 0x70, 0x9D,
+  /* code 0052 */
+  0xA8, 0x46, 0xBF, 0xC0, 0x90, 0xA0, 0x90, 0x60, 0x90, 0xA0, 0xBF, 0x40,
+  0x91, 0xC0, 0x90, 0x90, 0x90, 0x70, 0x90, 0x34, 0x9F,
+  /* code 0053 */
+  0xA3, 0x3B, 0x7F, 0x43, 0x42, 0x0C, 0x00, 0x2C, 0x00, 0x2F, 0x00, 0x07,
+  0x00, 0x09, 0x50, 0x70, 0xBF, 0x9D,
+  /* code 0054 */
+  0xA2, 0xC6, 0x34, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00,
+  0x0C, 0x00, 0x30, 0x00, 0xC0, 0x9E,
+  /* code 0055 */
+  0xAD, 0x4D, 0x90, 0x18, 0x24, 0x06, 0x09, 0x01, 0x82, 0x40, 0x60, 0x90,
+  0x18, 0x24, 0x06, 0x09, 0x01, 0x81, 0xC0, 0xD0, 0x1F, 0xD0, 0xA5,
+  /* code 0056 */
+  0xAC, 0x4D, 0x70, 0x02, 0x4D, 0x01, 0xC2, 0x80, 0xA0, 0x70, 0x34, 0x0D,
+  0x18, 0x01, 0x89, 0x00, 0x37, 0x00, 0x0B, 0x80, 0x01, 0xD0, 0xA6,
+  /* code 0057 */
+  0xBF, 0x73, 0x18, 0x03, 0x40, 0x63, 0x01, 0xE0, 0x24, 0x90, 0xAC, 0x0C,
+  0x18, 0x37, 0x47, 0x07, 0x08, 0x91, 0x80, 0xD6, 0x18, 0x90, 0x26, 0x43,
+  0x70, 0x07, 0xC0, 0xB8, 0x00, 0xE0, 0x1D, 0xB5,
+  /* code 0058 */
+  0xA7, 0x47, 0x70, 0x0C, 0x28, 0x24, 0x0D, 0x70, 0x07, 0xD0, 0x03, 0x80,
+  0x0A, 0xD0, 0x0C, 0x70, 0x24, 0x28, 0x70, 0x0D, 0x9F,
+  /* code 0059 */
+  0xA2, 0x3B, 0xA0, 0x29, 0xC0, 0xC2, 0x8A, 0x03, 0x70, 0x0B, 0x80, 0x0C,
+  0x00, 0x30, 0x00, 0xC0, 0x03, 0x9E,
+  /* code 005A */
+  0xA2, 0x3E, 0x7F, 0xF4, 0x00, 0xC0, 0x09, 0x00, 0x60, 0x03, 0x00, 0x24,
+  0x01, 0x80, 0x0C, 0x00, 0x7F, 0xF8, 0x9B,
+  /* code 005B */
+  0x94, 0x39, 0xBC, 0x24, 0x09, 0x02, 0x40, 0x90, 0x24, 0x09, 0x02, 0x40,
+  0x90, 0x24, 0x09, 0x02, 0xF0, 0x8A,
+  /* code 005C */
+  0x91, 0x4D, 0x90, 0x06, 0x00, 0x30, 0x02, 0x40, 0x18, 0x00, 0xC0, 0x09,
+  0x00, 0x60, 0x03, 0x40, 0x28, 0x01, 0xC0, 0x09, 0x00, 0x60, 0x8B,
+  /* code 005D */
+  0x93, 0x39, 0x7C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30,
+  0x0C, 0x03, 0x00, 0xC1, 0xF0, 0x8B,
+  /* code 005E */
+  0xA5, 0x1F, 0xD0, 0x0A, 0xC0, 0x32, 0x42, 0x83, 0x0C, 0x09, 0xB7,
+  /* code 005F */
+  0xBF, 0xAF, 0xC6, 0x86,
+  /* code 0060 */
+  0x90, 0x06, 0x90, 0x24, 0xAF,
+  /* code 0061 */
+  0xB2, 0x2D, 0xFD, 0x08, 0x18, 0x00, 0x30, 0x7F, 0xC7, 0x03, 0x1C, 0x2C,
+  0x2F, 0xA0, 0x9C,
+  /* code 0062 */
+  0xA0, 0x4C, 0x90, 0x00, 0x90, 0x00, 0x90, 0x00, 0x9F, 0xC0, 0xB0, 0x70,
+  0x90, 0x30, 0x90, 0x34, 0x90, 0x30, 0xB0, 0x60, 0x9F, 0xC0, 0xA1,
+  /* code 0063 */
+  0xAB, 0x26, 0xFD, 0x34, 0x27, 0x00, 0x60, 0x07, 0x00, 0x34, 0x20, 0xFC,
+  0x98,
+  /* code 0064 */
+  0xA4, 0x49, 0x60, 0x00, 0x60, 0x00, 0x60, 0x3F, 0x60, 0x90, 0xE0, 0xC0,
+  0x61, 0xC0, 0x60, 0xC0, 0x60, 0xD0, 0xE0, 0x3F, 0x60, 0xA0,
+  /* code 0065 */
+  0xB9, 0x34, 0xBF, 0x02, 0x81, 0x83, 0x00, 0xC3, 0xFF, 0xC3, 0x00, 0x02,
+  0x40, 0x00, 0xBF, 0x80, 0xA0,
+  /* code 0066 */
+  0x95, 0x2D, 0xB8, 0x70, 0x18, 0x1F, 0xE1, 0x80, 0x60, 0x18, 0x06, 0x01,
+  0x80, 0x60, 0x95,
+  /* code 0067 */
+  0xB1, 0x43, 0x7F, 0xE3, 0x06, 0x0C, 0x18, 0x30, 0xA0, 0xFF, 0x06, 0x00,
+  0x0B, 0xF8, 0x60, 0x26, 0x80, 0x92, 0xFD, 0x87,
+  /* code 0068 */
+  0xA0, 0x4D, 0x90, 0x00, 0x90, 0x00, 0x90, 0x00, 0x9F, 0xC0, 0xB0, 0xA0,
+  0x90, 0x60, 0x90, 0x60, 0x90, 0x60, 0x90, 0x60, 0x90, 0x60, 0xA0,
+  /* code 0069 */
+  0x94, 0x21, 0xA0, 0x00, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x90,
+  /* code 006A */
+  0x94, 0x32, 0xA0, 0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x93, 0xC0, 0x00,
+  /* code 006B */
+  0x9C, 0x44, 0x90, 0x02, 0x40, 0x09, 0x00, 0x24, 0x70, 0x97, 0x02, 0x70,
+  0x0B, 0xC0, 0x25, 0x80, 0x92, 0x82, 0x43, 0x40, 0x9B,
+  /* code 006C */
+  0x90, 0x25, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0,
+  0x90,
+  /* code 006D */
+  0xBF, 0x94, 0x51, 0x9F, 0xCB, 0xC0, 0xB0, 0xB4, 0x60, 0x90, 0x60, 0x70,
+  0x90, 0x60, 0x70, 0x90, 0x60, 0x70, 0x90, 0x60, 0x70, 0x90, 0x60, 0x70,
+  0xB0,
+  /* code 006E */
+  0xB8, 0x35, 0x9F, 0xC0, 0xB0, 0xA0, 0x90, 0x60, 0x90, 0x60, 0x90, 0x60,
+  0x90, 0x60, 0x90, 0x60, 0xA0,
+  /* code 006F */
+  0xB9, 0x33, 0xBF, 0x02, 0x81, 0xC3, 0x00, 0xC7, 0x00, 0x93, 0x00, 0xC2,
+  0x81, 0x80, 0xFE, 0xA1,
+  /* code 0070 */
+  0xB8, 0x49, 0x9F, 0xC0, 0xB0, 0x70, 0x90, 0x30, 0x90, 0x34, 0x90, 0x30,
+  0xB0, 0x60, 0x9F, 0xC0, 0x90, 0x00, 0x90, 0x00, 0x90, 0x8C,
+  /* code 0071 */
+  0xB9, 0x4C, 0xFD, 0x82, 0x43, 0x83, 0x01, 0x87, 0x01, 0x83, 0x01, 0x83,
+  0x43, 0x80, 0xFD, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x88,
+  /* code 0072 */
+  0xA3, 0x1F, 0xDF, 0x3C, 0x0D, 0x03, 0x40, 0xD0, 0x34, 0x0D, 0x95,
+  /* code 0073 */
+  0xAA, 0x27, 0x7F, 0x0C, 0x00, 0xD0, 0x03, 0xD0, 0x03, 0x40, 0x25, 0xFE,
+  0x98,
+  /* code 0074 */
+  0x99, 0x2B, 0x60, 0x18, 0x2F, 0xD1, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x3D, 0x93,
+  /* code 0075 */
+  0xB8, 0x35, 0x90, 0x60, 0x90, 0x60, 0x90, 0x60, 0x90, 0x60, 0x90, 0x60,
+  0xA0, 0xE0, 0x3F, 0x60, 0xA0,
+  /* code 0076 */
+  0xB0, 0x2E, 0xA0, 0x25, 0xC0, 0xC3, 0x46, 0x0A, 0x24, 0x0D, 0xC0, 0x2E,
+  0x00, 0x74, 0x9D,
+  /* code 0077 */
+  0xBF, 0x8C, 0x4A, 0x60, 0x70, 0x34, 0xC1, 0xD0, 0xC3, 0x49, 0x46, 0x09,
+  0x12, 0x24, 0x19, 0x49, 0x80, 0x39, 0x2A, 0x00, 0xB0, 0x74, 0xAD,
+  /* code 0078 */
+  0xB1, 0x2E, 0xC0, 0xC1, 0x89, 0x03, 0xE0, 0x07, 0x40, 0x37, 0x02, 0x8A,
+  0x1C, 0x0C, 0x9C,
+  /* code 0079 */
+  0xB0, 0x42, 0xA0, 0x25, 0xC0, 0xC3, 0x46, 0x06, 0x24, 0x0D, 0xC0, 0x2E,
+  0x00, 0x74, 0x01, 0xC0, 0x0A, 0x00, 0x34, 0x89,
+  /* code 007A */
+  0xAA, 0x28, 0xFF, 0x00, 0x60, 0x0C, 0x02, 0x80, 0x70, 0x0D, 0x01, 0xFF,
+  0x40, 0x97,
+  /* code 007B */
+  0x95, 0x38, 0xB4, 0x30, 0x08, 0x02, 0x01, 0x81, 0x80, 0x18, 0x02, 0x00,
+  0x80, 0x20, 0x0C, 0x02, 0xC0, 0x8A,
+  /* code 007C */
+  0x97, 0x5B, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00,
+  0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0,
+  0x03, 0x89,
+  /* code 007D */
+  0x94, 0x38, 0xE0, 0x0C, 0x03, 0x00, 0xC0, 0x24, 0x02, 0x42, 0x40, 0x80,
+  0x30, 0x0C, 0x03, 0x03, 0x80, 0x8B,
+  /* code 007E */
+  0xA3, 0x12, 0xF4, 0x65, 0x21, 0x64, 0x7C, 0xBF, 0x86
+};
+
+const aafontsCharInfo_t charTable_FontCalibri18_AA2_RLE[95] = {
+  {   3,   0, &FontFontCalibri18_AA2_RLE[    0] }, /* code 0020 */
+  {   5,   0, &FontFontCalibri18_AA2_RLE[    1] }, /* code 0021 */
+  {   6,   0, &FontFontCalibri18_AA2_RLE[   16] }, /* code 0022 */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[   25] }, /* code 0023 */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[   43] }, /* code 0024 */
+  {  11,   0, &FontFontCalibri18_AA2_RLE[   67] }, /* code 0025 */
+  {  10,   0, &FontFontCalibri18_AA2_RLE[   98] }, /* code 0026 */
+  {   3,   0, &FontFontCalibri18_AA2_RLE[  126] }, /* code 0027 */
+  {   5,   0, &FontFontCalibri18_AA2_RLE[  132] }, /* code 0028 */
+  {   5,   0, &FontFontCalibri18_AA2_RLE[  151] }, /* code 0029 */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[  170] }, /* code 002A */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[  183] }, /* code 002B */
+  {   4,   0, &FontFontCalibri18_AA2_RLE[  197] }, /* code 002C */
+  {   5,   0, &FontFontCalibri18_AA2_RLE[  204] }, /* code 002D */
+  {   4,   0, &FontFontCalibri18_AA2_RLE[  208] }, /* code 002E */
+  {   6,   0, &FontFontCalibri18_AA2_RLE[  213] }, /* code 002F */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[  234] }, /* code 0030 */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[  252] }, /* code 0031 */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[  271] }, /* code 0032 */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[  290] }, /* code 0033 */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[  308] }, /* code 0034 */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[  326] }, /* code 0035 */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[  344] }, /* code 0036 */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[  362] }, /* code 0037 */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[  380] }, /* code 0038 */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[  399] }, /* code 0039 */
+  {   4,   0, &FontFontCalibri18_AA2_RLE[  417] }, /* code 003A */
+  {   4,   0, &FontFontCalibri18_AA2_RLE[  426] }, /* code 003B */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[  437] }, /* code 003C */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[  451] }, /* code 003D */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[  460] }, /* code 003E */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[  474] }, /* code 003F */
+  {  13,   0, &FontFontCalibri18_AA2_RLE[  494] }, /* code 0040 */
+  {   9,   0, &FontFontCalibri18_AA2_RLE[  531] }, /* code 0041 */
+  {   8,   0, &FontFontCalibri18_AA2_RLE[  554] }, /* code 0042 */
+  {   8,   0, &FontFontCalibri18_AA2_RLE[  575] }, /* code 0043 */
+  {   9,   0, &FontFontCalibri18_AA2_RLE[  595] }, /* code 0044 */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[  618] }, /* code 0045 */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[  637] }, /* code 0046 */
+  {   9,   0, &FontFontCalibri18_AA2_RLE[  655] }, /* code 0047 */
+  {   9,   0, &FontFontCalibri18_AA2_RLE[  678] }, /* code 0048 */
+  {   4,   0, &FontFontCalibri18_AA2_RLE[  701] }, /* code 0049 */
+  {   5,   0, &FontFontCalibri18_AA2_RLE[  713] }, /* code 004A */
+  {   8,   0, &FontFontCalibri18_AA2_RLE[  727] }, /* code 004B */
+  {   6,   0, &FontFontCalibri18_AA2_RLE[  748] }, /* code 004C */
+  {  12,   0, &FontFontCalibri18_AA2_RLE[  765] }, /* code 004D */
+  {  10,   0, &FontFontCalibri18_AA2_RLE[  795] }, /* code 004E */
+  {  10,   0, &FontFontCalibri18_AA2_RLE[  820] }, /* code 004F */
+  {   8,   0, &FontFontCalibri18_AA2_RLE[  844] }, /* code 0050 */
+  {  10,   0, &FontFontCalibri18_AA2_RLE[  864] }, /* code 0051 */
+  {   8,   0, &FontFontCalibri18_AA2_RLE[  892] }, /* code 0052 */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[  913] }, /* code 0053 */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[  931] }, /* code 0054 */
+  {   9,   0, &FontFontCalibri18_AA2_RLE[  949] }, /* code 0055 */
+  {   9,   0, &FontFontCalibri18_AA2_RLE[  972] }, /* code 0056 */
+  {  13,   0, &FontFontCalibri18_AA2_RLE[  995] }, /* code 0057 */
+  {   8,   0, &FontFontCalibri18_AA2_RLE[ 1027] }, /* code 0058 */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[ 1048] }, /* code 0059 */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[ 1066] }, /* code 005A */
+  {   5,   0, &FontFontCalibri18_AA2_RLE[ 1085] }, /* code 005B */
+  {   6,   0, &FontFontCalibri18_AA2_RLE[ 1103] }, /* code 005C */
+  {   5,   0, &FontFontCalibri18_AA2_RLE[ 1126] }, /* code 005D */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[ 1144] }, /* code 005E */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[ 1155] }, /* code 005F */
+  {   4,   0, &FontFontCalibri18_AA2_RLE[ 1159] }, /* code 0060 */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[ 1164] }, /* code 0061 */
+  {   8,   0, &FontFontCalibri18_AA2_RLE[ 1179] }, /* code 0062 */
+  {   6,   0, &FontFontCalibri18_AA2_RLE[ 1202] }, /* code 0063 */
+  {   8,   0, &FontFontCalibri18_AA2_RLE[ 1215] }, /* code 0064 */
+  {   8,   0, &FontFontCalibri18_AA2_RLE[ 1237] }, /* code 0065 */
+  {   5,   0, &FontFontCalibri18_AA2_RLE[ 1254] }, /* code 0066 */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[ 1269] }, /* code 0067 */
+  {   8,   0, &FontFontCalibri18_AA2_RLE[ 1289] }, /* code 0068 */
+  {   4,   0, &FontFontCalibri18_AA2_RLE[ 1312] }, /* code 0069 */
+  {   4,   0, &FontFontCalibri18_AA2_RLE[ 1324] }, /* code 006A */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[ 1339] }, /* code 006B */
+  {   4,   0, &FontFontCalibri18_AA2_RLE[ 1360] }, /* code 006C */
+  {  12,   0, &FontFontCalibri18_AA2_RLE[ 1373] }, /* code 006D */
+  {   8,   0, &FontFontCalibri18_AA2_RLE[ 1398] }, /* code 006E */
+  {   8,   0, &FontFontCalibri18_AA2_RLE[ 1415] }, /* code 006F */
+  {   8,   0, &FontFontCalibri18_AA2_RLE[ 1431] }, /* code 0070 */
+  {   8,   0, &FontFontCalibri18_AA2_RLE[ 1453] }, /* code 0071 */
+  {   5,   0, &FontFontCalibri18_AA2_RLE[ 1476] }, /* code 0072 */
+  {   6,   0, &FontFontCalibri18_AA2_RLE[ 1487] }, /* code 0073 */
+  {   5,   0, &FontFontCalibri18_AA2_RLE[ 1500] }, /* code 0074 */
+  {   8,   0, &FontFontCalibri18_AA2_RLE[ 1514] }, /* code 0075 */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[ 1531] }, /* code 0076 */
+  {  11,   0, &FontFontCalibri18_AA2_RLE[ 1546] }, /* code 0077 */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[ 1569] }, /* code 0078 */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[ 1584] }, /* code 0079 */
+  {   6,   0, &FontFontCalibri18_AA2_RLE[ 1604] }, /* code 007A */
+  {   5,   0, &FontFontCalibri18_AA2_RLE[ 1618] }, /* code 007B */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[ 1636] }, /* code 007C */
+  {   5,   0, &FontFontCalibri18_AA2_RLE[ 1662] }, /* code 007D */
+  {   7,   0, &FontFontCalibri18_AA2_RLE[ 1680] }  /* code 007E */
+};
+
+aafontsFont_t FontCalibri18_AA2_RLE = 
+{
+  AAFONTS_FONTTYPE_AA2,                 /* Font type (anti-aliasing level) */
+  18,                                   /* Font height in pixels */
+  3,                                    /* Width to insert for unknown characters */
+  9,                                    /* Height of upper-case characters */
+  7,                                    /* Height of lower-case characters */
+  14,                                   /* Font baseline */
+  0x0020,                               /* Unicode address of first character */
+  0x007E,                               /* Unicode address of last character */
+  &charTable_FontCalibri18_AA2_RLE[0],  /* Font char data */
+  AAFONTS_ENCODING_RLE                  /* Glyph data encoding */
+};
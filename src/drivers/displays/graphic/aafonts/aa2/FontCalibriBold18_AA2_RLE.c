@@ -0,0 +1,440 @@
+/**************************************************************************/
+/*!
+    @file     FontCalibriBold18_AA2_RLE.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Run-length encoded copy of FontCalibriBold18_AA2, generated
+              by tools/fontpack (do not edit)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include "FontCalibriBold18_AA2_RLE.h"
+
+/* 1716 bytes of glyph data, against 3582 for FontCalibriBold18_AA2 */
+const uint8_t FontFontCalibriBold18_AA2_RLE[1716] = {
+  /* code 0020 */
+  0xB5,
+  /* code 0021 */
+  0x95, 0x1F, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0D, 0x87, 0x06,
+  0xE0, 0x38, 0x94,
+  /* code 0022 */
+  0x9C, 0x19, 0xE3, 0x83, 0x8E, 0x09, 0x24, 0x24, 0x90, 0xBF, 0x86,
+  /* code 0023 */
+  0xA4, 0x3B, 0xD3, 0x43, 0x0D, 0x7F, 0xFC, 0x71, 0xC1, 0x87, 0x0A, 0x1C,
+  0xBF, 0xF8, 0x92, 0x83, 0x4D, 0x9C,
+  /* code 0024 */
+  0x97, 0x54, 0xA0, 0x02, 0x40, 0x7F, 0x43, 0xC2, 0x0E, 0x00, 0x3E, 0x00,
+  0x3F, 0x80, 0x0F, 0x40, 0x1D, 0x50, 0xB4, 0xBF, 0x40, 0xA0, 0x02, 0x80,
+  0x90,
+  /* code 0025 */
+  0xAC, 0x31, 0xBC, 0x03, 0x47, 0x28, 0x28, 0x18, 0xA1, 0xC0, 0x72, 0x8D,
+  0x00, 0xFD, 0xE0, 0x87, 0x31, 0xA3, 0xF0, 0x07, 0x28, 0xD0, 0x34, 0xA2,
+  0x42, 0x82, 0x8D, 0x1C, 0x03, 0xE0, 0xAC,
+  /* code 0026 */
+  0xB8, 0x5F, 0x7F, 0xC0, 0x07, 0x87, 0x80, 0x1E, 0x1D, 0x00, 0x3F, 0xE0,
+  0x00, 0xFD, 0x1D, 0x0F, 0x7D, 0x74, 0x78, 0x2F, 0xC0, 0xF0, 0x7F, 0x00,
+  0xFF, 0x8B, 0xAC,
+  /* code 0027 */
+  0x90, 0x0D, 0xA0, 0xA0, 0xA0, 0xA0, 0xA8,
+  /* code 0028 */
+  0x95, 0x3D, 0xB0, 0x38, 0x1D, 0x0B, 0x03, 0xC0, 0xE0, 0x38, 0x0E, 0x03,
+  0xC0, 0xB0, 0x1D, 0x03, 0x80, 0xB0, 0x85,
+  /* code 0029 */
+  0x94, 0x3D, 0xE0, 0x2C, 0x07, 0x40, 0xE0, 0x3C, 0x0B, 0x02, 0xC0, 0xB0,
+  0x3C, 0x0E, 0x07, 0x42, 0xC0, 0xE0, 0x86,
+  /* code 002A */
+  0x9E, 0x1C, 0xC0, 0x3A, 0xB0, 0x1D, 0x03, 0xAB, 0x00, 0xC0, 0xBF, 0x01,
+  0x00,
+  /* code 002B */
+  0xB3, 0x2B, 0xD0, 0x03, 0x40, 0x0D, 0x0B, 0xFF, 0xC0, 0xD0, 0x03, 0x40,
+  0x0D, 0x9D,
+  /* code 002C */
+  0xB0, 0x0C, 0xB0, 0xB0, 0xD2, 0x80, 0x89,
+  /* code 002D */
+  0xB1, 0x03, 0x7F, 0xA3,
+  /* code 002E */
+  0xB0, 0xC1, 0x81, 0xC1, 0x90,
+  /* code 002F */
+  0x95, 0x45, 0xE0, 0x1D, 0x02, 0xC0, 0x38, 0x07, 0x40, 0xB0, 0x0E, 0x01,
+  0xD0, 0x2C, 0x03, 0x80, 0x74, 0x0B, 0x00, 0xE0, 0x8F,
+  /* code 0030 */
+  0xA4, 0x3B, 0xFD, 0x0E, 0x2D, 0x74, 0x7A, 0xD0, 0xEB, 0x43, 0xAD, 0x0E,
+  0x74, 0x74, 0xE2, 0xC1, 0xFD, 0x9C,
+  /* code 0031 */
+  0xA4, 0x3C, 0x78, 0x0B, 0xE0, 0x37, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xE0,
+  0x03, 0x80, 0x0E, 0x03, 0xFF, 0x80, 0x9B,
+  /* code 0032 */
+  0xA3, 0x3D, 0x7F, 0x46, 0x0B, 0x40, 0x1D, 0x00, 0xB4, 0x07, 0x80, 0x3C,
+  0x03, 0xC0, 0x3C, 0x01, 0xFF, 0xE0, 0x9B,
+  /* code 0033 */
+  0xA3, 0x3B, 0x7F, 0x42, 0x0F, 0x00, 0x3C, 0x01, 0xE0, 0x7F, 0x00, 0x0F,
+  0x40, 0x2D, 0x50, 0xB0, 0x7F, 0x9D,
+  /* code 0034 */
+  0xA5, 0x3A, 0xBC, 0x07, 0xF0, 0x36, 0xC1, 0xCB, 0x0D, 0x2C, 0xB0, 0xB2,
+  0xFF, 0xF0, 0x0B, 0x00, 0x2C, 0x9C,
+  /* code 0035 */
+  0xA3, 0x3B, 0xFF, 0xC3, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xFF, 0x80, 0x0B,
+  0x40, 0x2D, 0x50, 0xF0, 0x7F, 0x9D,
+  /* code 0036 */
+  0xA4, 0x3B, 0xBF, 0x0B, 0x00, 0x34, 0x01, 0xFF, 0x87, 0x47, 0x5D, 0x0E,
+  0x74, 0x38, 0xE1, 0xD1, 0xFD, 0x9C,
+  /* code 0037 */
+  0xA2, 0x3B, 0x7F, 0xF4, 0x02, 0xD0, 0x0E, 0x00, 0x74, 0x03, 0xC0, 0x1E,
+  0x00, 0xB4, 0x03, 0xC0, 0x1D, 0x9E,
+  /* code 0038 */
+  0xA3, 0x3C, 0x7F, 0x87, 0x4B, 0x5D, 0x1D, 0x3D, 0xE0, 0x3F, 0x47, 0x8F,
+  0x6C, 0x1E, 0x74, 0x74, 0xBF, 0x40, 0x9C,
+  /* code 0039 */
+  0xA3, 0x3B, 0x7F, 0x43, 0x4B, 0x1D, 0x1D, 0xB4, 0x75, 0xD1, 0xD2, 0xFF,
+  0x40, 0x1D, 0x00, 0xE0, 0xFE, 0x9D,
+  /* code 003A */
+  0x9C, 0x05, 0xB0, 0xB0, 0x8D, 0x05, 0xB0, 0xB0, 0x90,
+  /* code 003B */
+  0x9C, 0x05, 0xB0, 0xB0, 0x8D, 0x0C, 0xB0, 0xB0, 0xE1, 0x80, 0x89,
+  /* code 003C */
+  0xAE, 0x2B, 0xA0, 0x2F, 0x4F, 0xF0, 0xB0, 0x00, 0xFE, 0x00, 0x2F, 0x40,
+  0x0A, 0xA2,
+  /* code 003D */
+  0xB7, 0x06, 0x7F, 0xF8, 0x8D, 0x06, 0x7F, 0xF8, 0xA9,
+  /* code 003E */
+  0xAA, 0x2A, 0xC0, 0x03, 0xF0, 0x02, 0xFC, 0x00, 0x38, 0x2F, 0xC3, 0xF0,
+  0x0C, 0xA7,
+  /* code 003F */
+  0x9C, 0x2C, 0xFF, 0x40, 0x0B, 0x00, 0x1D, 0x00, 0xB0, 0x2F, 0x40, 0xB0,
+  0x02, 0xC0, 0x8B, 0x08, 0xB0, 0x02, 0xC0, 0x9E,
+  /* code 0040 */
+  0xBF, 0x6B, 0x00, 0x1F, 0xFC, 0x00, 0x38, 0x02, 0xD0, 0x38, 0x00, 0x2C,
+  0x1C, 0x7E, 0xC7, 0x0A, 0x38, 0xF1, 0xC3, 0x5C, 0x38, 0xB0, 0xD7, 0x1D,
+  0x34, 0x34, 0xF9, 0xF8, 0x0A, 0x8A, 0x02, 0x78, 0x8B, 0x05, 0xFF, 0xE0,
+  0x9D,
+  /* code 0041 */
+  0xAF, 0x33, 0xBC, 0x00, 0x3F, 0x40, 0x1D, 0xE0, 0x0E, 0x2C, 0x07, 0x47,
+  0x42, 0xC0, 0xE0, 0xC6, 0x12, 0x1D, 0x01, 0xDB, 0x00, 0x3C, 0xA3,
+  /* code 0042 */
+  0xA8, 0x45, 0xFF, 0xC0, 0xE0, 0xE0, 0xE0, 0xF0, 0xE0, 0xE0, 0xFF, 0xD0,
+  0xE0, 0xB4, 0xE0, 0x74, 0xE0, 0xB0, 0xFF, 0xD0, 0xA0,
+  /* code 0043 */
+  0xA9, 0x44, 0x7F, 0x81, 0xE0, 0x53, 0xC0, 0x07, 0x80, 0x07, 0x80, 0x07,
+  0x80, 0x03, 0xC0, 0x02, 0xE0, 0x50, 0x7F, 0x80, 0xA0,
+  /* code 0044 */
+  0xAD, 0x4D, 0xFF, 0xD0, 0x38, 0x1E, 0x0E, 0x02, 0xD3, 0x80, 0x74, 0xE0,
+  0x1D, 0x38, 0x07, 0x4E, 0x02, 0xC3, 0x81, 0xE0, 0xFF, 0xD0, 0xA5,
+  /* code 0045 */
+  0xA3, 0x3D, 0xFF, 0xE3, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xFF, 0xC3, 0x80,
+  0x0E, 0x00, 0x38, 0x00, 0xFF, 0xE0, 0x9B,
+  /* code 0046 */
+  0xA3, 0x39, 0xBF, 0xD2, 0xC0, 0x0B, 0x00, 0x2C, 0x00, 0xBF, 0xC2, 0xC0,
+  0x0B, 0x00, 0x2C, 0x00, 0xB0, 0x9F,
+  /* code 0047 */
+  0xB4, 0x55, 0xBF, 0xC0, 0x7C, 0x03, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x1D,
+  0x0F, 0xF1, 0xE0, 0x0F, 0x0F, 0x00, 0xF0, 0x78, 0x0F, 0x00, 0xFF, 0xE0,
+  0xA8,
+  /* code 0048 */
+  0xAD, 0x23, 0xE0, 0x2C, 0x38, 0x0B, 0x0E, 0x02, 0xC3, 0x80, 0xB0, 0xC6,
+  0x23, 0x0E, 0x02, 0xC3, 0x80, 0xB0, 0xE0, 0x2C, 0x38, 0x0B, 0xA4,
+  /* code 0049 */
+  0x94, 0x21, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0x90,
+  /* code 004A */
+  0x9A, 0x28, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x8F,
+  0xC0, 0x95,
+  /* code 004B */
+  0xA8, 0x46, 0xF0, 0x78, 0xF0, 0xF0, 0xF2, 0xC0, 0xFB, 0x40, 0xFF, 0x00,
+  0xF7, 0x80, 0xF2, 0xD0, 0xF0, 0xF0, 0xF0, 0x78, 0x9F,
+  /* code 004C */
+  0x9E, 0x2F, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0,
+  0x0E, 0x00, 0xC4, 0x97,
+  /* code 004D */
+  0xBF, 0x74, 0x0F, 0xD0, 0x0F, 0xC3, 0xF8, 0x07, 0xF0, 0xFB, 0x03, 0xAC,
+  0x3D, 0xD1, 0xDB, 0x0F, 0x28, 0xB2, 0xC3, 0xC7, 0x78, 0xB0, 0xF0, 0xFC,
+  0x2C, 0x3C, 0x2E, 0x0B, 0x0F, 0x07, 0x42, 0xC0, 0xB4,
+  /* code 004E */
+  0xB2, 0x57, 0xBC, 0x0B, 0x0B, 0xD0, 0xB0, 0xBF, 0x0B, 0x0A, 0x74, 0xB0,
+  0xA3, 0xCB, 0x0A, 0x1D, 0xB0, 0xA0, 0xBB, 0x0A, 0x03, 0xF0, 0xA0, 0x2F,
+  0xA8,
+  /* code 004F */
+  0xB4, 0x54, 0xFF, 0x80, 0x78, 0x1E, 0x0F, 0x00, 0xB1, 0xE0, 0x0B, 0x5E,
+  0x00, 0x75, 0xE0, 0x0B, 0x4F, 0x00, 0xB0, 0xB4, 0x1E, 0x01, 0xFF, 0x40,
+  0xA9,
+  /* code 0050 */
+  0xA8, 0x41, 0xFF, 0xD0, 0xF0, 0xB4, 0xF0, 0x74, 0xF0, 0x74, 0xF0, 0xF0,
+  0xFF, 0xC0, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0xA4,
+  /* code 0051 */
+  0xB3, 0x50, 0x7F, 0xD0, 0x1D, 0x07, 0x83, 0xC0, 0x3C, 0x78, 0x02, 0xD7,
+  0x80, 0x2D, 0x78, 0x02, 0xD3, 0x80, 0x3C, 0x2D, 0x0B, 0x40, 0x40, 0xC5,
+  0x87, 0x02, 0x7C, 0x87, 0x01, 0x70, 0x93,
+  /* code 0052 */
+  0xA8, 0xC4, 0x41, 0x43, 0x82, 0xC3, 0x82, 0xD3, 0x83, 0xC3, 0xFE, 0x03,
+  0x87, 0x43, 0x83, 0x83, 0x82, 0xD3, 0x81, 0xE0, 0x9F,
+  /* code 0053 */
+  0xA4, 0x3B, 0xFD, 0x0E, 0x08, 0x78, 0x00, 0xF8, 0x00, 0xFE, 0x00, 0x3D,
+  0x00, 0x79, 0x42, 0xD2, 0xFD, 0x9C,
+  /* code 0054 */
+  0xA2, 0xC6, 0x35, 0x07, 0x40, 0x1D, 0x00, 0x74, 0x01, 0xD0, 0x07, 0x40,
+  0x1D, 0x00, 0x74, 0x01, 0xD0, 0x9D,
+  /* code 0055 */
+  0xB2, 0x56, 0xB0, 0x0F, 0x0B, 0x00, 0xF0, 0xB0, 0x0F, 0x0B, 0x00, 0xF0,
+  0xB0, 0x0F, 0x0B, 0x00, 0xF0, 0xB0, 0x0E, 0x07, 0x81, 0xD0, 0x1F, 0xF4,
+  0xA9,
+  /* code 0056 */
+  0xAC, 0x4D, 0xB4, 0x03, 0x9E, 0x01, 0xD3, 0xC0, 0xB0, 0xB4, 0x38, 0x1E,
+  0x1D, 0x03, 0xCB, 0x00, 0xB7, 0x40, 0x1F, 0xC0, 0x03, 0xE0, 0xA6,
+  /* code 0057 */
+  0xBF, 0x85, 0x7A, 0xB4, 0x1F, 0x01, 0xD7, 0x81, 0xF4, 0x1D, 0x38, 0x2F,
+  0x42, 0xC2, 0xC3, 0xB8, 0x38, 0x1D, 0x76, 0xC7, 0x40, 0xE7, 0x1D, 0xB0,
+  0x0F, 0xE0, 0xEE, 0x00, 0xBD, 0x0F, 0xD0, 0x07, 0xD0, 0xBC, 0xBA,
+  /* code 0058 */
+  0xA7, 0x47, 0x78, 0x1E, 0x3C, 0x2C, 0x1E, 0x74, 0x0B, 0xE0, 0x07, 0xD0,
+  0x0F, 0xF0, 0x1D, 0x78, 0x3C, 0x2C, 0xB4, 0x1E, 0x9F,
+  /* code 0059 */
+  0xA7, 0x44, 0xB4, 0x1E, 0x38, 0x2C, 0x2D, 0x78, 0x0E, 0xB0, 0x07, 0xD0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0xA2,
+  /* code 005A */
+  0xA2, 0x3E, 0x7F, 0xF8, 0x02, 0xD0, 0x1E, 0x00, 0xB0, 0x07, 0x40, 0x3C,
+  0x02, 0xD0, 0x1E, 0x00, 0xBF, 0xF8, 0x9B,
+  /* code 005B */
+  0x94, 0x3A, 0xBD, 0x2C, 0x0B, 0x02, 0xC0, 0xB0, 0x2C, 0x0B, 0x02, 0xC0,
+  0xB0, 0x2C, 0x0B, 0x02, 0xF4, 0x89,
+  /* code 005C */
+  0x91, 0x4D, 0xB0, 0x07, 0x40, 0x38, 0x02, 0xC0, 0x1D, 0x00, 0xE0, 0x0B,
+  0x00, 0x74, 0x03, 0x80, 0x2C, 0x01, 0xD0, 0x0E, 0x00, 0xB0, 0x8B,
+  /* code 005D */
+  0x93, 0x3A, 0x7E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38,
+  0x0E, 0x03, 0x80, 0xE1, 0xF8, 0x8A,
+  /* code 005E */
+  0xA4, 0x27, 0xB8, 0x03, 0xF0, 0x1D, 0xE0, 0xE2, 0xC7, 0x47, 0x6C, 0x0E,
+  0xB0,
+  /* code 005F */
+  0xBF, 0xAF, 0xC6, 0x86,
+  /* code 0060 */
+  0x94, 0x07, 0xE0, 0x0E, 0xBC,
+  /* code 0061 */
+  0xB1, 0x2E, 0x7F, 0x42, 0x0B, 0x00, 0x2C, 0x2F, 0xF1, 0xD2, 0xC7, 0x0F,
+  0x0F, 0xEC, 0x9C,
+  /* code 0062 */
+  0xA0, 0x4D, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xEB, 0xD0, 0xF4, 0xB0,
+  0xE0, 0x74, 0xE0, 0x74, 0xE0, 0x74, 0xF4, 0xF0, 0xDB, 0xD0, 0xA0,
+  /* code 0063 */
+  0xAB, 0x26, 0xFD, 0x38, 0x27, 0x40, 0x74, 0x07, 0x40, 0x38, 0x20, 0xFC,
+  0x98,
+  /* code 0064 */
+  0xA4, 0x49, 0xB0, 0x00, 0xB0, 0x00, 0xB0, 0x7F, 0xF0, 0xE1, 0xF1, 0xD0,
+  0xB1, 0xD0, 0xB1, 0xD0, 0xB0, 0xE1, 0xF0, 0x7E, 0x70, 0xA0,
+  /* code 0065 */
+  0xB9, 0x16, 0xBF, 0x02, 0xC2, 0xC3, 0x81, 0xD4, 0xC5, 0x03, 0x5D, 0x85,
+  0x01, 0xF0, 0x86, 0xC4, 0xA0,
+  /* code 0066 */
+  0x95, 0x2E, 0xBC, 0x74, 0x1D, 0x2F, 0xE1, 0xD0, 0x74, 0x1D, 0x07, 0x41,
+  0xD0, 0x74, 0x94,
+  /* code 0067 */
+  0xB1, 0x43, 0x7F, 0xE3, 0x4B, 0x1C, 0x1C, 0x34, 0xA0, 0xFF, 0x07, 0x00,
+  0x0F, 0xFC, 0xB0, 0x3A, 0xC1, 0xE3, 0xFE, 0x87,
+  /* code 0068 */
+  0xA0, 0x4D, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0xEB, 0xD0, 0xF4, 0xF0,
+  0xE0, 0xB0, 0xE0, 0xB0, 0xE0, 0xB0, 0xE0, 0xB0, 0xE0, 0xB0, 0xA0,
+  /* code 0069 */
+  0x90, 0x25, 0xF0, 0xF0, 0x00, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+  0x90,
+  /* code 006A */
+  0x90, 0x36, 0xB0, 0xB0, 0x00, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+  0xB0, 0xE3, 0xD0, 0x00,
+  /* code 006B */
+  0x9C, 0x44, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0xB4, 0xE7, 0x83, 0xFC,
+  0x0F, 0xF0, 0x39, 0xE0, 0xE3, 0xC3, 0x87, 0x80, 0x9B,
+  /* code 006C */
+  0x90, 0x25, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0, 0xB0,
+  0x90,
+  /* code 006D */
+  0xBF, 0x94, 0x51, 0xDB, 0xDB, 0xD0, 0xF0, 0xF4, 0xF0, 0xE0, 0xB0, 0xB0,
+  0xE0, 0xB0, 0xB0, 0xE0, 0xB0, 0xB0, 0xE0, 0xB0, 0xB0, 0xE0, 0xB0, 0xB0,
+  0xB0,
+  /* code 006E */
+  0xB8, 0x35, 0xDB, 0xD0, 0xF4, 0xF0, 0xE0, 0xB0, 0xE0, 0xB0, 0xE0, 0xB0,
+  0xE0, 0xB0, 0xE0, 0xB0, 0xA0,
+  /* code 006F */
+  0xB9, 0xC3, 0x2B, 0x03, 0xC2, 0xC7, 0x41, 0xD7, 0x41, 0xD7, 0x41, 0xD3,
+  0x82, 0xC0, 0xC3, 0xA1,
+  /* code 0070 */
+  0xB8, 0x49, 0xDB, 0xD0, 0xF4, 0xB0, 0xE0, 0x74, 0xE0, 0x74, 0xE0, 0x74,
+  0xF4, 0xF0, 0xFF, 0xD0, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x8C,
+  /* code 0071 */
+  0xB9, 0x4C, 0xF9, 0xC3, 0x87, 0xC7, 0x42, 0xC7, 0x42, 0xC7, 0x42, 0xC3,
+  0x87, 0xC1, 0xFA, 0xC0, 0x02, 0xC0, 0x02, 0xC0, 0x02, 0xC0, 0x88,
+  /* code 0072 */
+  0xA3, 0x1F, 0xEF, 0x3D, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x95,
+  /* code 0073 */
+  0xAA, 0x27, 0xBE, 0x1D, 0x11, 0xE0, 0x0B, 0xF0, 0x07, 0x54, 0x74, 0xBE,
+  0x98,
+  /* code 0074 */
+  0x99, 0x2B, 0xB0, 0x2C, 0x2F, 0xE2, 0xC0, 0xB0, 0x2C, 0x0B, 0x02, 0xC0,
+  0x3E, 0x93,
+  /* code 0075 */
+  0xB8, 0x35, 0xE0, 0xB0, 0xE0, 0xB0, 0xE0, 0xB0, 0xE0, 0xB0, 0xE0, 0xB0,
+  0xF1, 0xF0, 0x7E, 0x70, 0xA0,
+  /* code 0076 */
+  0xB0, 0x2E, 0xB0, 0x39, 0xD1, 0xD3, 0x8B, 0x0B, 0x38, 0x1D, 0xD0, 0x3F,
+  0x00, 0xB8, 0x9D,
+  /* code 0077 */
+  0xBF, 0x8C, 0x4A, 0xB0, 0x74, 0x39, 0xD1, 0xE1, 0xD3, 0x8A, 0xC7, 0x0A,
+  0x37, 0x28, 0x1D, 0xCA, 0xE0, 0x3E, 0x2F, 0x40, 0xF4, 0x7C, 0xAD,
+  /* code 0078 */
+  0xB0, 0x30, 0x74, 0x74, 0xF3, 0x81, 0xFD, 0x03, 0xE0, 0x1F, 0xD0, 0xE3,
+  0xCB, 0x47, 0x80, 0x9B,
+  /* code 0079 */
+  0xB0, 0x42, 0xB0, 0x39, 0xD1, 0xD3, 0x8B, 0x0B, 0x28, 0x1F, 0xD0, 0x2F,
+  0x00, 0x78, 0x01, 0xD0, 0x0B, 0x40, 0x3C, 0x89,
+  /* code 007A */
+  0xA9, 0x29, 0x7F, 0xD0, 0x3C, 0x07, 0x40, 0xE0, 0x1D, 0x03, 0x80, 0x7F,
+  0xD0, 0x97,
+  /* code 007B */
+  0x90, 0x3E, 0xB8, 0x34, 0x1D, 0x07, 0x41, 0xD0, 0xB0, 0xA0, 0x07, 0x01,
+  0xD0, 0x74, 0x1D, 0x03, 0x40, 0xB8, 0x89,
+  /* code 007C */
+  0x96, 0x5D, 0x74, 0x01, 0xD0, 0x07, 0x40, 0x1D, 0x00, 0x74, 0x01, 0xD0,
+  0x07, 0x40, 0x1D, 0x00, 0x74, 0x01, 0xD0, 0x07, 0x40, 0x1D, 0x00, 0x74,
+  0x01, 0xD0, 0x88,
+  /* code 007D */
+  0x8E, 0x3E, 0x7C, 0x03, 0x40, 0xE0, 0x38, 0x0E, 0x02, 0x80, 0x1C, 0x2C,
+  0x0E, 0x03, 0x80, 0xE0, 0x34, 0x7C, 0x8B,
+  /* code 007E */
+  0xAA, 0x0C, 0xF8, 0xAA, 0x2F, 0x40, 0xBF, 0x85
+};
+
+const aafontsCharInfo_t charTable_FontCalibriBold18_AA2_RLE[95] = {
+  {   3,   0, &FontFontCalibriBold18_AA2_RLE[    0] }, /* code 0020 */
+  {   5,   0, &FontFontCalibriBold18_AA2_RLE[    1] }, /* code 0021 */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[   16] }, /* code 0022 */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[   27] }, /* code 0023 */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[   45] }, /* code 0024 */
+  {  11,   0, &FontFontCalibriBold18_AA2_RLE[   70] }, /* code 0025 */
+  {  11,   0, &FontFontCalibriBold18_AA2_RLE[  101] }, /* code 0026 */
+  {   4,   0, &FontFontCalibriBold18_AA2_RLE[  128] }, /* code 0027 */
+  {   5,   0, &FontFontCalibriBold18_AA2_RLE[  135] }, /* code 0028 */
+  {   5,   0, &FontFontCalibriBold18_AA2_RLE[  154] }, /* code 0029 */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[  173] }, /* code 002A */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[  186] }, /* code 002B */
+  {   4,   0, &FontFontCalibriBold18_AA2_RLE[  200] }, /* code 002C */
+  {   5,   0, &FontFontCalibriBold18_AA2_RLE[  207] }, /* code 002D */
+  {   4,   0, &FontFontCalibriBold18_AA2_RLE[  211] }, /* code 002E */
+  {   6,   0, &FontFontCalibriBold18_AA2_RLE[  216] }, /* code 002F */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[  237] }, /* code 0030 */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[  255] }, /* code 0031 */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[  274] }, /* code 0032 */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[  293] }, /* code 0033 */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[  311] }, /* code 0034 */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[  329] }, /* code 0035 */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[  347] }, /* code 0036 */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[  365] }, /* code 0037 */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[  383] }, /* code 0038 */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[  402] }, /* code 0039 */
+  {   4,   0, &FontFontCalibriBold18_AA2_RLE[  420] }, /* code 003A */
+  {   4,   0, &FontFontCalibriBold18_AA2_RLE[  429] }, /* code 003B */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[  440] }, /* code 003C */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[  454] }, /* code 003D */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[  463] }, /* code 003E */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[  477] }, /* code 003F */
+  {  13,   0, &FontFontCalibriBold18_AA2_RLE[  497] }, /* code 0040 */
+  {   9,   0, &FontFontCalibriBold18_AA2_RLE[  534] }, /* code 0041 */
+  {   8,   0, &FontFontCalibriBold18_AA2_RLE[  557] }, /* code 0042 */
+  {   8,   0, &FontFontCalibriBold18_AA2_RLE[  578] }, /* code 0043 */
+  {   9,   0, &FontFontCalibriBold18_AA2_RLE[  599] }, /* code 0044 */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[  622] }, /* code 0045 */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[  641] }, /* code 0046 */
+  {  10,   0, &FontFontCalibriBold18_AA2_RLE[  659] }, /* code 0047 */
+  {   9,   0, &FontFontCalibriBold18_AA2_RLE[  684] }, /* code 0048 */
+  {   4,   0, &FontFontCalibriBold18_AA2_RLE[  707] }, /* code 0049 */
+  {   5,   0, &FontFontCalibriBold18_AA2_RLE[  719] }, /* code 004A */
+  {   8,   0, &FontFontCalibriBold18_AA2_RLE[  733] }, /* code 004B */
+  {   6,   0, &FontFontCalibriBold18_AA2_RLE[  754] }, /* code 004C */
+  {  13,   0, &FontFontCalibriBold18_AA2_RLE[  770] }, /* code 004D */
+  {  10,   0, &FontFontCalibriBold18_AA2_RLE[  803] }, /* code 004E */
+  {  10,   0, &FontFontCalibriBold18_AA2_RLE[  828] }, /* code 004F */
+  {   8,   0, &FontFontCalibriBold18_AA2_RLE[  853] }, /* code 0050 */
+  {  10,   0, &FontFontCalibriBold18_AA2_RLE[  873] }, /* code 0051 */
+  {   8,   0, &FontFontCalibriBold18_AA2_RLE[  904] }, /* code 0052 */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[  925] }, /* code 0053 */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[  943] }, /* code 0054 */
+  {  10,   0, &FontFontCalibriBold18_AA2_RLE[  961] }, /* code 0055 */
+  {   9,   0, &FontFontCalibriBold18_AA2_RLE[  986] }, /* code 0056 */
+  {  14,   0, &FontFontCalibriBold18_AA2_RLE[ 1009] }, /* code 0057 */
+  {   8,   0, &FontFontCalibriBold18_AA2_RLE[ 1044] }, /* code 0058 */
+  {   8,   0, &FontFontCalibriBold18_AA2_RLE[ 1065] }, /* code 0059 */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[ 1086] }, /* code 005A */
+  {   5,   0, &FontFontCalibriBold18_AA2_RLE[ 1105] }, /* code 005B */
+  {   6,   0, &FontFontCalibriBold18_AA2_RLE[ 1123] }, /* code 005C */
+  {   5,   0, &FontFontCalibriBold18_AA2_RLE[ 1146] }, /* code 005D */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[ 1164] }, /* code 005E */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[ 1177] }, /* code 005F */
+  {   5,   0, &FontFontCalibriBold18_AA2_RLE[ 1181] }, /* code 0060 */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[ 1186] }, /* code 0061 */
+  {   8,   0, &FontFontCalibriBold18_AA2_RLE[ 1201] }, /* code 0062 */
+  {   6,   0, &FontFontCalibriBold18_AA2_RLE[ 1224] }, /* code 0063 */
+  {   8,   0, &FontFontCalibriBold18_AA2_RLE[ 1237] }, /* code 0064 */
+  {   8,   0, &FontFontCalibriBold18_AA2_RLE[ 1259] }, /* code 0065 */
+  {   5,   0, &FontFontCalibriBold18_AA2_RLE[ 1276] }, /* code 0066 */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[ 1291] }, /* code 0067 */
+  {   8,   0, &FontFontCalibriBold18_AA2_RLE[ 1311] }, /* code 0068 */
+  {   4,   0, &FontFontCalibriBold18_AA2_RLE[ 1334] }, /* code 0069 */
+  {   4,   0, &FontFontCalibriBold18_AA2_RLE[ 1347] }, /* code 006A */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[ 1363] }, /* code 006B */
+  {   4,   0, &FontFontCalibriBold18_AA2_RLE[ 1384] }, /* code 006C */
+  {  12,   0, &FontFontCalibriBold18_AA2_RLE[ 1397] }, /* code 006D */
+  {   8,   0, &FontFontCalibriBold18_AA2_RLE[ 1422] }, /* code 006E */
+  {   8,   0, &FontFontCalibriBold18_AA2_RLE[ 1439] }, /* code 006F */
+  {   8,   0, &FontFontCalibriBold18_AA2_RLE[ 1455] }, /* code 0070 */
+  {   8,   0, &FontFontCalibriBold18_AA2_RLE[ 1477] }, /* code 0071 */
+  {   5,   0, &FontFontCalibriBold18_AA2_RLE[ 1500] }, /* code 0072 */
+  {   6,   0, &FontFontCalibriBold18_AA2_RLE[ 1511] }, /* code 0073 */
+  {   5,   0, &FontFontCalibriBold18_AA2_RLE[ 1524] }, /* code 0074 */
+  {   8,   0, &FontFontCalibriBold18_AA2_RLE[ 1538] }, /* code 0075 */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[ 1555] }, /* code 0076 */
+  {  11,   0, &FontFontCalibriBold18_AA2_RLE[ 1570] }, /* code 0077 */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[ 1593] }, /* code 0078 */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[ 1609] }, /* code 0079 */
+  {   6,   0, &FontFontCalibriBold18_AA2_RLE[ 1629] }, /* code 007A */
+  {   5,   0, &FontFontCalibriBold18_AA2_RLE[ 1643] }, /* code 007B */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[ 1662] }, /* code 007C */
+  {   5,   0, &FontFontCalibriBold18_AA2_RLE[ 1689] }, /* code 007D */
+  {   7,   0, &FontFontCalibriBold18_AA2_RLE[ 1708] }  /* code 007E */
+};
+
+aafontsFont_t FontCalibriBold18_AA2_RLE = 
+{
+  AAFONTS_FONTTYPE_AA2,                 /* Font type (anti-aliasing level) */
+  18,                                   /* Font height in pixels */
+  3,                                    /* Width to insert for unknown characters */
+  9,                                    /* Height of upper-case characters */
+  7,                                    /* Height of lower-case characters */
+  14,                                   /* Font baseline */
+  0x0020,                               /* Unicode address of first character */
+  0x007E,                               /* Unicode address of last character */
+  &charTable_FontCalibriBold18_AA2_RLE[0], /* Font char data */
+  AAFONTS_ENCODING_RLE                  /* Glyph data encoding */
+};
@@ -0,0 +1,432 @@
+/**************************************************************************/
+/*!
+    @file     FontCalibriItalic18_AA2_RLE.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Run-length encoded copy of FontCalibriItalic18_AA2, generated
+              by tools/fontpack (do not edit)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include "FontCalibriItalic18_AA2_RLE.h"
+
+/* 1656 bytes of glyph data, against 3564 for FontCalibriItalic18_AA2 */
+const uint8_t FontFontCalibriItalic18_AA2_RLE[1656] = {
+  /* code 0020 */
+  0xB5,
+  /* code 0021 */
+  0x96, 0x1E, 0xA0, 0x24, 0x0C, 0x07, 0x01, 0x80, 0x90, 0x24, 0x86, 0x06,
+  0x70, 0x18, 0x95,
+  /* code 0022 */
+  0x99, 0x15, 0x93, 0x09, 0x30, 0x86, 0x08, 0x50, 0xBB,
+  /* code 0023 */
+  0xA5, 0x39, 0xC2, 0x06, 0x18, 0xBF, 0xF0, 0x83, 0x06, 0x18, 0xBF, 0xF8,
+  0x82, 0x06, 0x0C, 0x14, 0x60, 0x9D,
+  /* code 0024 */
+  0x99, 0x51, 0x80, 0x02, 0x00, 0xFE, 0x0D, 0x08, 0x70, 0x00, 0xE0, 0x00,
+  0xF8, 0x00, 0x28, 0x00, 0xA9, 0x03, 0x5F, 0xF0, 0x08, 0x00, 0x50, 0x91,
+  /* code 0025 */
+  0xAD, 0x30, 0xBC, 0x02, 0x46, 0x14, 0x24, 0x24, 0x91, 0x40, 0x93, 0x18,
+  0x01, 0xF5, 0x80, 0x87, 0x30, 0x63, 0xE0, 0x06, 0x24, 0xC0, 0x20, 0xC2,
+  0x03, 0x02, 0x18, 0x30, 0x0B, 0xC0, 0xAD,
+  /* code 0026 */
+  0xB4, 0x55, 0xBF, 0x40, 0x1C, 0x18, 0x01, 0x82, 0x80, 0x0E, 0xD0, 0x02,
+  0xE0, 0x60, 0xA2, 0x8A, 0x18, 0x0F, 0xC1, 0xC0, 0x78, 0x0B, 0xF8, 0xB0,
+  0xA8,
+  /* code 0027 */
+  0x8D, 0x09, 0xC3, 0x08, 0x60, 0x9D,
+  /* code 0028 */
+  0x97, 0x3A, 0x80, 0xA0, 0x30, 0x24, 0x0C, 0x06, 0x02, 0x40, 0xD0, 0x30,
+  0x0C, 0x03, 0x40, 0x90, 0x18, 0x86,
+  /* code 0029 */
+  0x95, 0x3A, 0x50, 0x08, 0x03, 0x00, 0xD0, 0x34, 0x0C, 0x07, 0x02, 0x80,
+  0xD0, 0x70, 0x24, 0x18, 0x0C, 0x88,
+  /* code 002A */
+  0x9F, 0x1C, 0x50, 0x2A, 0x70, 0x1E, 0x03, 0x9A, 0x01, 0x80, 0xBF, 0x00,
+  0x00,
+  /* code 002B */
+  0xAC, 0x2A, 0x60, 0x01, 0x80, 0x06, 0x07, 0xFF, 0x80, 0x90, 0x03, 0x00,
+  0x18, 0xA5,
+  /* code 002C */
+  0xB0, 0x0B, 0xD0, 0xC2, 0x41, 0x8A,
+  /* code 002D */
+  0xB1, 0x03, 0x7F, 0xA3,
+  /* code 002E */
+  0xB0, 0x04, 0xC1, 0xC0, 0x91,
+  /* code 002F */
+  0x9C, 0x3D, 0x80, 0x0C, 0x02, 0x40, 0x70, 0x0D, 0x01, 0x80, 0x30, 0x0A,
+  0x00, 0xC0, 0x24, 0x03, 0x00, 0x10, 0x90,
+  /* code 0030 */
+  0xA5, 0x39, 0xFD, 0x0D, 0x1C, 0xA0, 0x73, 0x41, 0xDC, 0x06, 0x60, 0x29,
+  0x80, 0xD7, 0x06, 0x0B, 0xE0, 0x9D,
+  /* code 0031 */
+  0xA5, 0x3A, 0x78, 0x0A, 0xA0, 0x02, 0x40, 0x0C, 0x00, 0x30, 0x01, 0x80,
+  0x0A, 0x00, 0x24, 0x1F, 0xFC, 0x9C,
+  /* code 0032 */
+  0xA5, 0x3A, 0xFC, 0x08, 0x34, 0x00, 0x90, 0x03, 0x40, 0x28, 0x02, 0x80,
+  0x28, 0x03, 0x80, 0x2F, 0xF8, 0x9C,
+  /* code 0033 */
+  0xA5, 0x39, 0xFC, 0x08, 0x34, 0x00, 0xD0, 0x07, 0x03, 0xE0, 0x00, 0x70,
+  0x01, 0xC9, 0x0A, 0x0B, 0xE0, 0x9D,
+  /* code 0034 */
+  0xA6, 0x38, 0x74, 0x07, 0xC0, 0x36, 0x02, 0x58, 0x28, 0x51, 0x82, 0x4B,
+  0xFF, 0x40, 0x30, 0x01, 0x80, 0x9D,
+  /* code 0035 */
+  0xA4, 0x3A, 0xBF, 0xC2, 0x00, 0x0C, 0x00, 0x7F, 0x80, 0x02, 0x80, 0x06,
+  0x00, 0x26, 0x42, 0xC2, 0xF8, 0x9D,
+  /* code 0036 */
+  0xA5, 0x39, 0x7F, 0x0A, 0x00, 0x60, 0x02, 0xFF, 0x4D, 0x06, 0x30, 0x1D,
+  0xC0, 0xA3, 0x07, 0x07, 0xF0, 0x9D,
+  /* code 0037 */
+  0xA4, 0x38, 0xFF, 0xC0, 0x02, 0x00, 0x18, 0x00, 0xC0, 0x09, 0x00, 0x60,
+  0x03, 0x00, 0x24, 0x02, 0x80, 0x9F,
+  /* code 0038 */
+  0xA5, 0x35, 0xFD, 0x0C, 0x1C, 0x60, 0x60, 0xD7, 0x01, 0xF0, 0x34, 0x72,
+  0x80, 0xDA, 0x07, 0x00, 0xC3, 0x9D,
+  /* code 0039 */
+  0xA4, 0x39, 0x7F, 0x07, 0x06, 0x24, 0x18, 0x90, 0x61, 0xFF, 0x80, 0x0D,
+  0x00, 0x70, 0x03, 0x4B, 0xF0, 0x9E,
+  /* code 003A */
+  0x9D, 0x05, 0xD0, 0xD0, 0x8C, 0x05, 0xD0, 0xD0, 0x90,
+  /* code 003B */
+  0x9D, 0x05, 0xD0, 0xD0, 0x8C, 0x0B, 0x90, 0xC2, 0x42, 0x8A,
+  /* code 003C */
+  0xAE, 0x24, 0x70, 0x1D, 0x07, 0x80, 0x60, 0x00, 0x3C, 0x00, 0x0F, 0x40,
+  0xA9,
+  /* code 003D */
+  0xB8, 0x05, 0xBF, 0xF0, 0x8D, 0x06, 0x7F, 0xF8, 0xA9,
+  /* code 003E */
+  0xB1, 0x24, 0x78, 0x00, 0x1F, 0x00, 0x07, 0x00, 0xF4, 0x2D, 0x07, 0x40,
+  0xA6,
+  /* code 003F */
+  0x9D, 0x2B, 0x7F, 0x40, 0x07, 0x00, 0x0C, 0x00, 0xA0, 0x3E, 0x00, 0xC0,
+  0x06, 0x8B, 0x08, 0xD0, 0x03, 0x40, 0x9E,
+  /* code 0040 */
+  0xB8, 0x72, 0x7F, 0xD0, 0x00, 0xE0, 0x0E, 0x00, 0xD0, 0x00, 0xC0, 0x92,
+  0xF5, 0x30, 0x31, 0x87, 0x0C, 0x18, 0xD0, 0xC3, 0x09, 0x30, 0x61, 0x82,
+  0x4C, 0x74, 0xC0, 0x92, 0xE7, 0xD0, 0x24, 0x8B, 0x01, 0xD0, 0x8B, 0x05,
+  0xFF, 0xD0, 0x9D,
+  /* code 0041 */
+  0xB0, 0x4B, 0x74, 0x00, 0x3D, 0x00, 0x2A, 0x80, 0x1C, 0x60, 0x09, 0x1C,
+  0x06, 0x03, 0x03, 0xFF, 0xD2, 0x80, 0x24, 0xC0, 0x0A, 0xA4,
+  /* code 0042 */
+  0xA9, 0x43, 0xBF, 0xC0, 0x90, 0x90, 0xC0, 0x91, 0xC1, 0xC1, 0xFF, 0x42,
+  0x41, 0xC2, 0x40, 0xC3, 0x02, 0x87, 0xFE, 0xA1,
+  /* code 0043 */
+  0xAB, 0x42, 0xFE, 0x07, 0x02, 0x0D, 0x00, 0x28, 0x00, 0x34, 0x00, 0x34,
+  0x00, 0x34, 0x00, 0x2C, 0x08, 0x0B, 0xF4, 0xA0,
+  /* code 0044 */
+  0xAE, 0x4B, 0xBF, 0xD0, 0x24, 0x1D, 0x0C, 0x02, 0x87, 0x00, 0x61, 0x80,
+  0x28, 0x90, 0x0D, 0x24, 0x06, 0x0C, 0x0B, 0x07, 0xFE, 0xA6,
+  /* code 0045 */
+  0xA4, 0x3B, 0xBF, 0xC2, 0x40, 0x0C, 0x00, 0x60, 0x01, 0xFF, 0x49, 0x00,
+  0x24, 0x00, 0xC0, 0x07, 0xFF, 0x9C,
+  /* code 0046 */
+  0xA4, 0x37, 0xBF, 0xC2, 0x40, 0x0C, 0x00, 0x70, 0x01, 0xFF, 0x49, 0x00,
+  0x24, 0x00, 0xC0, 0x07, 0xA0,
+  /* code 0047 */
+  0xB0, 0x4A, 0xFF, 0x81, 0xD0, 0x21, 0xC0, 0x00, 0x90, 0x00, 0x30, 0x3F,
+  0x5C, 0x00, 0xC3, 0x00, 0x60, 0xB0, 0x28, 0x0B, 0xFC, 0xA5,
+  /* code 0048 */
+  0xAE, 0x23, 0x90, 0x0C, 0x24, 0x06, 0x0C, 0x01, 0x87, 0x00, 0x91, 0xC5,
+  0x23, 0x49, 0x00, 0xC2, 0x40, 0x60, 0xC0, 0x18, 0x70, 0x09, 0xA4,
+  /* code 0049 */
+  0x95, 0x1F, 0x90, 0x90, 0xC1, 0xC1, 0x82, 0x42, 0x43, 0x07, 0x91,
+  /* code 004A */
+  0x9B, 0x27, 0x90, 0x24, 0x0C, 0x07, 0x01, 0x80, 0x90, 0x24, 0x0C, 0x3D,
+  0x95,
+  /* code 004B */
+  0xA9, 0x44, 0x90, 0x70, 0x91, 0xC0, 0xC7, 0x01, 0xEC, 0x01, 0xF0, 0x02,
+  0x58, 0x02, 0x4D, 0x03, 0x07, 0x07, 0x02, 0x80, 0xA0,
+  /* code 004C */
+  0x9F, 0x33, 0x90, 0x09, 0x00, 0xC0, 0x1C, 0x01, 0x80, 0x24, 0x02, 0x40,
+  0x30, 0x07, 0xFD, 0x97,
+  /* code 004D */
+  0xBF, 0x73, 0x02, 0xD0, 0x02, 0xD0, 0xF8, 0x01, 0xF4, 0x36, 0x00, 0xDC,
+  0x18, 0xC0, 0xA3, 0x06, 0x24, 0x71, 0x82, 0x49, 0x34, 0x90, 0xD1, 0x98,
+  0x24, 0x30, 0x3C, 0x0C, 0x18, 0x0D, 0x03, 0xB5,
+  /* code 004E */
+  0xB3, 0x55, 0xB0, 0x09, 0x0A, 0x40, 0xD0, 0x98, 0x0C, 0x18, 0x81, 0x81,
+  0x86, 0x18, 0x24, 0x32, 0x42, 0x42, 0xB4, 0x30, 0x1F, 0x06, 0x00, 0xE0,
+  0xA9,
+  /* code 004F */
+  0xB4, 0x53, 0x7F, 0xD0, 0x1C, 0x07, 0x47, 0x00, 0x24, 0xA0, 0x02, 0x8D,
+  0x00, 0x24, 0xC0, 0x03, 0x0C, 0x00, 0xA0, 0xA0, 0x2C, 0x03, 0xFE, 0xAA,
+  /* code 0050 */
+  0xA9, 0x3F, 0xBF, 0xC0, 0x90, 0x70, 0xC0, 0x71, 0xC0, 0x61, 0x81, 0xD2,
+  0xFF, 0x02, 0x40, 0x03, 0x00, 0x07, 0xA5,
+  /* code 0051 */
+  0xB4, 0x55, 0x7F, 0xC0, 0x2C, 0x07, 0x07, 0x00, 0x24, 0x90, 0x02, 0x4D,
+  0x00, 0x34, 0xC0, 0x07, 0x0C, 0x00, 0x90, 0xA0, 0x28, 0x03, 0xFD, 0xE0,
+  0x88, 0x01, 0xD0, 0x9D,
+  /* code 0052 */
+  0xA9, 0x44, 0xBF, 0xC0, 0x90, 0xA0, 0xC0, 0xA1, 0xC1, 0xD1, 0xFF, 0x02,
+  0x47, 0x02, 0x43, 0x43, 0x02, 0x87, 0x01, 0x80, 0xA0,
+  /* code 0053 */
+  0xA4, 0x3A, 0x7F, 0x03, 0x06, 0x18, 0x00, 0x74, 0x00, 0x3C, 0x00, 0x1C,
+  0x00, 0x32, 0x02, 0x87, 0xF8, 0x9D,
+  /* code 0054 */
+  0xA3, 0x3A, 0xBF, 0xF0, 0x0C, 0x00, 0x60, 0x01, 0x80, 0x09, 0x00, 0x34,
+  0x00, 0xC0, 0x06, 0x00, 0x18, 0x9E,
+  /* code 0055 */
+  0xB3, 0x54, 0x90, 0x09, 0x09, 0x00, 0xC0, 0xC0, 0x0C, 0x18, 0x01, 0x81,
+  0x80, 0x24, 0x24, 0x02, 0x42, 0x40, 0x30, 0x28, 0x0D, 0x00, 0xBF, 0x40,
+  0xAA,
+  /* code 0056 */
+  0xAD, 0x4B, 0x90, 0x03, 0x18, 0x02, 0x46, 0x01, 0x80, 0xC0, 0x90, 0x30,
+  0x60, 0x09, 0x30, 0x02, 0x68, 0x00, 0x7C, 0x00, 0x1D, 0xA7,
+  /* code 0057 */
+  0xBF, 0x72, 0x06, 0x01, 0xC0, 0x21, 0x80, 0xB0, 0x0C, 0x60, 0x3D, 0x0A,
+  0x1C, 0x26, 0x43, 0x03, 0x0C, 0x91, 0x80, 0xC9, 0x18, 0xC0, 0x37, 0x06,
+  0x60, 0x0F, 0x41, 0xF0, 0x02, 0xC0, 0x78, 0xB6,
+  /* code 0058 */
+  0xA8, 0x45, 0x70, 0x0C, 0x24, 0x28, 0x1C, 0xA0, 0x0F, 0x80, 0x0B, 0x00,
+  0x1F, 0x40, 0x71, 0xC1, 0xC0, 0xD3, 0x40, 0x60, 0xA0,
+  /* code 0059 */
+  0xA3, 0x3A, 0xA0, 0x21, 0xC1, 0xC3, 0x4D, 0x0A, 0xA0, 0x1E, 0x00, 0x30,
+  0x00, 0xC0, 0x06, 0x00, 0x28, 0x9E,
+  /* code 005A */
+  0xA3, 0x36, 0x7F, 0xF0, 0x01, 0xC0, 0x1C, 0x00, 0xD0, 0x0D, 0x00, 0xA0,
+  0x0A, 0x00, 0xA0, 0x00, 0xC5, 0x9C,
+  /* code 005B */
+  0x95, 0x3C, 0x7C, 0x14, 0x09, 0x03, 0x00, 0x80, 0x60, 0x14, 0x09, 0x02,
+  0x00, 0x80, 0x60, 0x14, 0x0B, 0x80, 0x86,
+  /* code 005C */
+  0x92, 0x4B, 0x60, 0x03, 0x00, 0x30, 0x02, 0x40, 0x24, 0x01, 0x80, 0x18,
+  0x00, 0xC0, 0x0C, 0x00, 0x90, 0x09, 0x00, 0x60, 0x06, 0x8C,
+  /* code 005D */
+  0x95, 0x3B, 0xF4, 0x08, 0x03, 0x01, 0x80, 0x50, 0x24, 0x08, 0x03, 0x01,
+  0x80, 0x50, 0x24, 0x08, 0x0F, 0x87,
+  /* code 005E */
+  0xA6, 0x1E, 0xD0, 0x0A, 0x80, 0xA2, 0x07, 0x0C, 0x34, 0x34, 0xB7,
+  /* code 005F */
+  0xBF, 0xAF, 0xC5, 0x00, 0x40, 0x86,
+  /* code 0060 */
+  0x91, 0x05, 0xD0, 0x20, 0xAF,
+  /* code 0061 */
+  0xB9, 0x34, 0x7E, 0x51, 0xC1, 0xD2, 0x40, 0xC3, 0x01, 0x87, 0x02, 0x83,
+  0x0B, 0x42, 0xF6, 0x40, 0xA0,
+  /* code 0062 */
+  0xA1, 0x4B, 0x90, 0x00, 0x90, 0x00, 0xC0, 0x01, 0xDF, 0x81, 0xE0, 0xD2,
+  0x80, 0x92, 0x40, 0xD3, 0x01, 0xC3, 0x43, 0x46, 0xBD, 0xA1,
+  /* code 0063 */
+  0xAB, 0x26, 0x7E, 0x1C, 0x23, 0x40, 0x70, 0x06, 0x00, 0x70, 0x52, 0xF8,
+  0x98,
+  /* code 0064 */
+  0xA5, 0x47, 0x60, 0x00, 0x60, 0x00, 0x90, 0x7E, 0x91, 0xC2, 0xC3, 0x41,
+  0x83, 0x01, 0x87, 0x03, 0x43, 0x0B, 0x42, 0xF6, 0xA1,
+  /* code 0065 */
+  0xB2, 0x2D, 0x7F, 0x07, 0x0A, 0x34, 0x25, 0xFF, 0x46, 0x00, 0x1C, 0x00,
+  0x2F, 0xD0, 0x9C,
+  /* code 0066 */
+  0x96, 0x39, 0xB0, 0x60, 0x24, 0x3F, 0xC3, 0x01, 0x80, 0x60, 0x24, 0x0D,
+  0x03, 0x01, 0xC0, 0xA0, 0x30, 0x88,
+  /* code 0067 */
+  0xB9, 0x4A, 0x7E, 0x91, 0xC2, 0xC3, 0x41, 0x83, 0x01, 0x87, 0x03, 0x47,
+  0x0B, 0x02, 0xF7, 0x00, 0x06, 0x05, 0x09, 0x03, 0xF4, 0x8A,
+  /* code 0068 */
+  0xA1, 0x4B, 0x90, 0x00, 0x90, 0x00, 0xC0, 0x00, 0xDF, 0x41, 0xE1, 0x82,
+  0x81, 0x82, 0x41, 0x83, 0x02, 0x43, 0x03, 0x46, 0x03, 0xA1,
+  /* code 0069 */
+  0x90, 0x17, 0xC0, 0x0C, 0x62, 0x49, 0x30, 0xC6, 0x8C,
+  /* code 006A */
+  0x95, 0x2A, 0x70, 0x00, 0xC1, 0x81, 0x82, 0x43, 0x43, 0x06, 0x06, 0x09,
+  0x08, 0x86,
+  /* code 006B */
+  0x9D, 0x42, 0x90, 0x02, 0x40, 0x0C, 0x00, 0x30, 0xA1, 0x8A, 0x0A, 0xD0,
+  0x2F, 0x00, 0xCA, 0x03, 0x0D, 0x18, 0x28, 0x9C,
+  /* code 006C */
+  0x8D, 0x1A, 0x82, 0x0C, 0x31, 0x89, 0x24, 0xC3, 0x18, 0x8C,
+  /* code 006D */
+  0xBF, 0x95, 0x4F, 0x9F, 0x4F, 0x81, 0xE1, 0xE0, 0xC2, 0x81, 0xC0, 0xC2,
+  0x42, 0x41, 0x83, 0x02, 0x42, 0x83, 0x03, 0x02, 0x46, 0x03, 0x03, 0xB1,
+  /* code 006E */
+  0xB9, 0x33, 0x9F, 0x41, 0xE1, 0xC2, 0x81, 0x82, 0x41, 0x83, 0x02, 0x43,
+  0x03, 0x46, 0x03, 0xA1,
+  /* code 006F */
+  0xB9, 0x33, 0x7F, 0x41, 0xC0, 0xD3, 0x40, 0x97, 0x00, 0xD7, 0x01, 0xC7,
+  0x03, 0x42, 0xFD, 0xA1,
+  /* code 0070 */
+  0xB9, 0x46, 0x9F, 0x81, 0xE0, 0xD2, 0x80, 0xD2, 0x40, 0xC3, 0x01, 0x87,
+  0x43, 0x46, 0xBD, 0x09, 0x00, 0x09, 0x00, 0x08, 0x8E,
+  /* code 0071 */
+  0xB9, 0x4B, 0x7E, 0x91, 0xC2, 0xC2, 0x41, 0x83, 0x01, 0x87, 0x03, 0x47,
+  0x0B, 0x42, 0xF7, 0x00, 0x06, 0x00, 0x06, 0x00, 0x09, 0x89,
+  /* code 0072 */
+  0xA4, 0x1D, 0x9C, 0x74, 0x28, 0x09, 0x03, 0x00, 0xC0, 0x60, 0x96,
+  /* code 0073 */
+  0xAB, 0x25, 0xF8, 0x24, 0x52, 0x80, 0x0F, 0x40, 0x1C, 0x81, 0x87, 0xF0,
+  0x99,
+  /* code 0074 */
+  0x9A, 0x29, 0xA0, 0x24, 0x3F, 0xC3, 0x01, 0x80, 0xA0, 0x24, 0x0D, 0x02,
+  0xE0, 0x94,
+  /* code 0075 */
+  0xB8, 0x34, 0x60, 0x30, 0x60, 0x30, 0x90, 0x60, 0x90, 0xA0, 0xC0, 0xD0,
+  0xC2, 0xC0, 0xBD, 0x80, 0xA1,
+  /* code 0076 */
+  0xB1, 0x2C, 0xD0, 0x32, 0x42, 0x89, 0x0C, 0x18, 0xA0, 0x63, 0x00, 0xF4,
+  0x03, 0x80, 0x9E,
+  /* code 0077 */
+  0xBF, 0x8D, 0x48, 0x90, 0xA0, 0x72, 0x43, 0x82, 0x89, 0x2A, 0x0C, 0x18,
+  0xDC, 0xA0, 0x69, 0x37, 0x01, 0xF0, 0xB4, 0x03, 0x42, 0x80, 0xAE,
+  /* code 0078 */
+  0xB1, 0x2E, 0xA0, 0x70, 0xC7, 0x02, 0xF0, 0x07, 0x40, 0x7B, 0x03, 0x0D,
+  0x34, 0x18, 0x9C,
+  /* code 0079 */
+  0xB1, 0x3F, 0xD0, 0x32, 0x42, 0x8A, 0x0C, 0x18, 0x60, 0x73, 0x00, 0xF4,
+  0x03, 0x80, 0x0C, 0x00, 0xD0, 0x0A, 0x8B,
+  /* code 007A */
+  0xAA, 0x27, 0xBF, 0x80, 0x30, 0x0D, 0x02, 0x80, 0xA0, 0x1C, 0x02, 0xFE,
+  0x98,
+  /* code 007B */
+  0x96, 0x3B, 0x70, 0x20, 0x18, 0x05, 0x02, 0x40, 0xC1, 0x80, 0x18, 0x05,
+  0x02, 0x40, 0x80, 0x30, 0x0B, 0x86,
+  /* code 007C */
+  0x9F, 0x52, 0xC0, 0x02, 0x00, 0x18, 0x00, 0x50, 0x02, 0x40, 0x08, 0x00,
+  0x30, 0x01, 0x80, 0x05, 0x00, 0x24, 0x00, 0x80, 0x02, 0x00, 0x18, 0x8A,
+  /* code 007D */
+  0x95, 0x3B, 0xE0, 0x08, 0x03, 0x01, 0x80, 0x60, 0x18, 0x03, 0x42, 0x01,
+  0x80, 0x50, 0x24, 0x08, 0x0D, 0x87,
+  /* code 007E */
+  0xA4, 0x12, 0xF4, 0x49, 0x32, 0x20, 0x78, 0xBF, 0x85
+};
+
+const aafontsCharInfo_t charTable_FontCalibriItalic18_AA2_RLE[95] = {
+  {   3,   0, &FontFontCalibriItalic18_AA2_RLE[    0] }, /* code 0020 */
+  {   5,   0, &FontFontCalibriItalic18_AA2_RLE[    1] }, /* code 0021 */
+  {   6,   0, &FontFontCalibriItalic18_AA2_RLE[   16] }, /* code 0022 */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[   25] }, /* code 0023 */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[   43] }, /* code 0024 */
+  {  11,   0, &FontFontCalibriItalic18_AA2_RLE[   67] }, /* code 0025 */
+  {  10,   0, &FontFontCalibriItalic18_AA2_RLE[   98] }, /* code 0026 */
+  {   3,   0, &FontFontCalibriItalic18_AA2_RLE[  123] }, /* code 0027 */
+  {   5,   0, &FontFontCalibriItalic18_AA2_RLE[  129] }, /* code 0028 */
+  {   5,   0, &FontFontCalibriItalic18_AA2_RLE[  147] }, /* code 0029 */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[  165] }, /* code 002A */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[  178] }, /* code 002B */
+  {   4,   0, &FontFontCalibriItalic18_AA2_RLE[  192] }, /* code 002C */
+  {   5,   0, &FontFontCalibriItalic18_AA2_RLE[  198] }, /* code 002D */
+  {   4,   0, &FontFontCalibriItalic18_AA2_RLE[  202] }, /* code 002E */
+  {   6,   0, &FontFontCalibriItalic18_AA2_RLE[  207] }, /* code 002F */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[  226] }, /* code 0030 */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[  244] }, /* code 0031 */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[  262] }, /* code 0032 */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[  280] }, /* code 0033 */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[  298] }, /* code 0034 */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[  316] }, /* code 0035 */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[  334] }, /* code 0036 */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[  352] }, /* code 0037 */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[  370] }, /* code 0038 */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[  388] }, /* code 0039 */
+  {   4,   0, &FontFontCalibriItalic18_AA2_RLE[  406] }, /* code 003A */
+  {   4,   0, &FontFontCalibriItalic18_AA2_RLE[  415] }, /* code 003B */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[  425] }, /* code 003C */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[  438] }, /* code 003D */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[  447] }, /* code 003E */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[  460] }, /* code 003F */
+  {  13,   0, &FontFontCalibriItalic18_AA2_RLE[  479] }, /* code 0040 */
+  {   9,   0, &FontFontCalibriItalic18_AA2_RLE[  518] }, /* code 0041 */
+  {   8,   0, &FontFontCalibriItalic18_AA2_RLE[  540] }, /* code 0042 */
+  {   8,   0, &FontFontCalibriItalic18_AA2_RLE[  560] }, /* code 0043 */
+  {   9,   0, &FontFontCalibriItalic18_AA2_RLE[  580] }, /* code 0044 */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[  602] }, /* code 0045 */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[  620] }, /* code 0046 */
+  {   9,   0, &FontFontCalibriItalic18_AA2_RLE[  637] }, /* code 0047 */
+  {   9,   0, &FontFontCalibriItalic18_AA2_RLE[  659] }, /* code 0048 */
+  {   4,   0, &FontFontCalibriItalic18_AA2_RLE[  682] }, /* code 0049 */
+  {   5,   0, &FontFontCalibriItalic18_AA2_RLE[  693] }, /* code 004A */
+  {   8,   0, &FontFontCalibriItalic18_AA2_RLE[  706] }, /* code 004B */
+  {   6,   0, &FontFontCalibriItalic18_AA2_RLE[  727] }, /* code 004C */
+  {  13,   0, &FontFontCalibriItalic18_AA2_RLE[  743] }, /* code 004D */
+  {  10,   0, &FontFontCalibriItalic18_AA2_RLE[  775] }, /* code 004E */
+  {  10,   0, &FontFontCalibriItalic18_AA2_RLE[  800] }, /* code 004F */
+  {   8,   0, &FontFontCalibriItalic18_AA2_RLE[  824] }, /* code 0050 */
+  {  10,   0, &FontFontCalibriItalic18_AA2_RLE[  843] }, /* code 0051 */
+  {   8,   0, &FontFontCalibriItalic18_AA2_RLE[  871] }, /* code 0052 */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[  892] }, /* code 0053 */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[  910] }, /* code 0054 */
+  {  10,   0, &FontFontCalibriItalic18_AA2_RLE[  928] }, /* code 0055 */
+  {   9,   0, &FontFontCalibriItalic18_AA2_RLE[  953] }, /* code 0056 */
+  {  13,   0, &FontFontCalibriItalic18_AA2_RLE[  975] }, /* code 0057 */
+  {   8,   0, &FontFontCalibriItalic18_AA2_RLE[ 1007] }, /* code 0058 */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[ 1028] }, /* code 0059 */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[ 1046] }, /* code 005A */
+  {   5,   0, &FontFontCalibriItalic18_AA2_RLE[ 1064] }, /* code 005B */
+  {   6,   0, &FontFontCalibriItalic18_AA2_RLE[ 1083] }, /* code 005C */
+  {   5,   0, &FontFontCalibriItalic18_AA2_RLE[ 1105] }, /* code 005D */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[ 1123] }, /* code 005E */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[ 1134] }, /* code 005F */
+  {   4,   0, &FontFontCalibriItalic18_AA2_RLE[ 1140] }, /* code 0060 */
+  {   8,   0, &FontFontCalibriItalic18_AA2_RLE[ 1145] }, /* code 0061 */
+  {   8,   0, &FontFontCalibriItalic18_AA2_RLE[ 1162] }, /* code 0062 */
+  {   6,   0, &FontFontCalibriItalic18_AA2_RLE[ 1184] }, /* code 0063 */
+  {   8,   0, &FontFontCalibriItalic18_AA2_RLE[ 1197] }, /* code 0064 */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[ 1218] }, /* code 0065 */
+  {   5,   0, &FontFontCalibriItalic18_AA2_RLE[ 1233] }, /* code 0066 */
+  {   8,   0, &FontFontCalibriItalic18_AA2_RLE[ 1251] }, /* code 0067 */
+  {   8,   0, &FontFontCalibriItalic18_AA2_RLE[ 1273] }, /* code 0068 */
+  {   3,   0, &FontFontCalibriItalic18_AA2_RLE[ 1295] }, /* code 0069 */
+  {   4,   0, &FontFontCalibriItalic18_AA2_RLE[ 1304] }, /* code 006A */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[ 1318] }, /* code 006B */
+  {   3,   0, &FontFontCalibriItalic18_AA2_RLE[ 1338] }, /* code 006C */
+  {  12,   0, &FontFontCalibriItalic18_AA2_RLE[ 1348] }, /* code 006D */
+  {   8,   0, &FontFontCalibriItalic18_AA2_RLE[ 1372] }, /* code 006E */
+  {   8,   0, &FontFontCalibriItalic18_AA2_RLE[ 1388] }, /* code 006F */
+  {   8,   0, &FontFontCalibriItalic18_AA2_RLE[ 1404] }, /* code 0070 */
+  {   8,   0, &FontFontCalibriItalic18_AA2_RLE[ 1425] }, /* code 0071 */
+  {   5,   0, &FontFontCalibriItalic18_AA2_RLE[ 1447] }, /* code 0072 */
+  {   6,   0, &FontFontCalibriItalic18_AA2_RLE[ 1458] }, /* code 0073 */
+  {   5,   0, &FontFontCalibriItalic18_AA2_RLE[ 1471] }, /* code 0074 */
+  {   8,   0, &FontFontCalibriItalic18_AA2_RLE[ 1485] }, /* code 0075 */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[ 1502] }, /* code 0076 */
+  {  11,   0, &FontFontCalibriItalic18_AA2_RLE[ 1517] }, /* code 0077 */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[ 1540] }, /* code 0078 */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[ 1555] }, /* code 0079 */
+  {   6,   0, &FontFontCalibriItalic18_AA2_RLE[ 1574] }, /* code 007A */
+  {   5,   0, &FontFontCalibriItalic18_AA2_RLE[ 1587] }, /* code 007B */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[ 1605] }, /* code 007C */
+  {   5,   0, &FontFontCalibriItalic18_AA2_RLE[ 1629] }, /* code 007D */
+  {   7,   0, &FontFontCalibriItalic18_AA2_RLE[ 1647] }  /* code 007E */
+};
+
+aafontsFont_t FontCalibriItalic18_AA2_RLE = 
+{
+  AAFONTS_FONTTYPE_AA2,                 /* Font type (anti-aliasing level) */
+  18,                                   /* Font height in pixels */
+  3,                                    /* Width to insert for unknown characters */
+  9,                                    /* Height of upper-case characters */
+  7,                                    /* Height of lower-case characters */
+  14,                                   /* Font baseline */
+  0x0020,                               /* Unicode address of first character */
+  0x007E,                               /* Unicode address of last character */
+  &charTable_FontCalibriItalic18_AA2_RLE[0], /* Font char data */
+  AAFONTS_ENCODING_RLE                  /* Glyph data encoding */
+};
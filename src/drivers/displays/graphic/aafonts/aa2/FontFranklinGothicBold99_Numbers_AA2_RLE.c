@@ -0,0 +1,392 @@
+/**************************************************************************/
+/*!
+    @file     FontFranklinGothicBold99_Numbers_AA2_RLE.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Run-length encoded copy of FontFranklinGothicBold99_Numbers_AA2, generated
+              by tools/fontpack (do not edit)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include "FontFranklinGothicBold99_Numbers_AA2_RLE.h"
+
+/* 3655 bytes of glyph data, against 12375 for FontFranklinGothicBold99_Numbers_AA2 */
+const uint8_t FontFontFranklinGothicBold99_Numbers_AA2_RLE[3655] = {
+  /* code 0030 */
+  0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+  0xBF, 0xBF, 0xBF, 0xAC, 0x00, 0x80, 0xC9, 0x00, 0x40, 0x9F, 0x00, 0x80,
+  0xCF, 0x00, 0x40, 0x9A, 0x00, 0x40, 0xD3, 0x00, 0x40, 0x97, 0xD6, 0x00,
+  0x80, 0x95, 0xD9, 0x93, 0xDB, 0x91, 0xDC, 0x00, 0x80, 0x8F, 0x00, 0x80,
+  0xDD, 0x00, 0x40, 0x8D, 0x00, 0x40, 0xCC, 0x04, 0x80, 0x00, 0xCD, 0x8D,
+  0xCB, 0x00, 0x80, 0x87, 0xCB, 0x00, 0x80, 0x8B, 0x00, 0x40, 0xCA, 0x00,
+  0x80, 0x89, 0xCB, 0x00, 0x40, 0x8A, 0xCA, 0x00, 0x80, 0x8B, 0xCA, 0x00,
+  0x80, 0x89, 0x00, 0x40, 0xCA, 0x8C, 0x00, 0x80, 0xCA, 0x89, 0x00, 0x80,
+  0xC9, 0x00, 0x80, 0x8D, 0xCA, 0x00, 0x80, 0x87, 0x00, 0x40, 0xCA, 0x00,
+  0x40, 0x8D, 0x00, 0x80, 0xCA, 0x87, 0x00, 0x80, 0xC9, 0x00, 0x80, 0x8E,
+  0x00, 0x40, 0xCA, 0x87, 0x00, 0x80, 0xC9, 0x00, 0x80, 0x8F, 0xCA, 0x07,
+  0x40, 0x00, 0xCA, 0x00, 0x40, 0x8F, 0xCA, 0x07, 0x80, 0x01, 0xCA, 0x90,
+  0x00, 0x80, 0xCA, 0x06, 0x00, 0x04, 0xCA, 0x90, 0x00, 0x40, 0xCA, 0x06,
+  0x00, 0x08, 0xC9, 0x00, 0x80, 0x90, 0x00, 0x40, 0xCA, 0x06, 0x40, 0x08,
+  0xC9, 0x00, 0x80, 0x91, 0xCA, 0x05, 0x40, 0x00, 0xCA, 0x00, 0x40, 0x91,
+  0xCA, 0x05, 0x80, 0x00, 0xCA, 0x00, 0x40, 0x91, 0xCA, 0x05, 0x80, 0x00,
+  0xCA, 0x00, 0x40, 0x91, 0xCA, 0x05, 0x80, 0x00, 0xCA, 0x00, 0x40, 0x91,
+  0x00, 0x80, 0xC9, 0x05, 0x80, 0x00, 0xCA, 0x00, 0x40, 0x91, 0x00, 0x80,
+  0xC9, 0x05, 0x80, 0x00, 0xCA, 0x00, 0x40, 0x91, 0xCA, 0x05, 0x80, 0x00,
+  0xCA, 0x00, 0x40, 0x91, 0xCA, 0x05, 0x80, 0x00, 0xCA, 0x00, 0x40, 0x91,
+  0xCA, 0x05, 0x80, 0x00, 0xCA, 0x00, 0x40, 0x91, 0xCA, 0x05, 0x80, 0x00,
+  0xCA, 0x00, 0x40, 0x91, 0xCA, 0x05, 0x80, 0x00, 0xCA, 0x00, 0x40, 0x91,
+  0xCA, 0x06, 0x40, 0x08, 0xC9, 0x00, 0x80, 0x91, 0xCA, 0x06, 0x40, 0x08,
+  0xC9, 0x00, 0x80, 0x90, 0x00, 0x40, 0xCA, 0x06, 0x40, 0x08, 0xCA, 0x90,
+  0x00, 0x40, 0xCA, 0x06, 0x00, 0x04, 0xCA, 0x90, 0x00, 0x80, 0xCA, 0x06,
+  0x00, 0x04, 0xCA, 0x00, 0x40, 0x8F, 0x00, 0x80, 0xC9, 0x07, 0x80, 0x00,
+  0xCA, 0x00, 0x40, 0x8F, 0xCA, 0x08, 0x40, 0x00, 0x80, 0xC9, 0x00, 0x80,
+  0x8E, 0x00, 0x40, 0xCA, 0x08, 0x40, 0x00, 0x40, 0xCA, 0x8E, 0x00, 0x80,
+  0xCA, 0x88, 0xCA, 0x00, 0x40, 0x8D, 0xCA, 0x00, 0x80, 0x88, 0x00, 0x80,
+  0xCA, 0x8C, 0x00, 0x40, 0xCA, 0x00, 0x40, 0x88, 0x00, 0x40, 0xCA, 0x00,
+  0x80, 0x8B, 0xCA, 0x00, 0x80, 0x8A, 0x00, 0x80, 0xCA, 0x00, 0x40, 0x89,
+  0xCB, 0x00, 0x40, 0x8A, 0x00, 0x40, 0xCB, 0x00, 0x40, 0x87, 0xCB, 0x00,
+  0x80, 0x8C, 0x00, 0x80, 0xCC, 0x04, 0x40, 0x00, 0xCD, 0x8E, 0xDE, 0x00,
+  0x40, 0x8E, 0x00, 0x40, 0xDC, 0x00, 0x80, 0x90, 0x00, 0x40, 0xDA, 0x00,
+  0x80, 0x92, 0x00, 0x40, 0xD8, 0x00, 0x80, 0x94, 0x00, 0x40, 0xD6, 0x00,
+  0x80, 0x97, 0xD4, 0x9B, 0xD0, 0x00, 0x40, 0x9F, 0xCA, 0x00, 0x40, 0xBF,
+  0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+  0xBF, 0xBF, 0xBF, 0xBF, 0x89,
+  /* code 0031 */
+  0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+  0xBF, 0xBF, 0xBF, 0xB2, 0xC7, 0x00, 0x40, 0xA4, 0x00, 0x80, 0xC7, 0x00,
+  0x40, 0xA3, 0x00, 0x40, 0xC8, 0x00, 0x40, 0xA2, 0x00, 0x40, 0xC9, 0x00,
+  0x40, 0xA1, 0x00, 0x40, 0xCA, 0x00, 0x40, 0xA0, 0x00, 0x40, 0xCB, 0x00,
+  0x40, 0x9F, 0x00, 0x40, 0xCC, 0x00, 0x40, 0x9E, 0x00, 0x80, 0xCD, 0x00,
+  0x40, 0x9D, 0x00, 0x80, 0xCE, 0x00, 0x40, 0x9C, 0xD0, 0x00, 0x40, 0x9A,
+  0xD2, 0x00, 0x40, 0x97, 0x00, 0x40, 0xD4, 0x00, 0x40, 0x95, 0x00, 0x80,
+  0xD6, 0x00, 0x40, 0x94, 0xD8, 0x00, 0x40, 0x94, 0xD8, 0x00, 0x40, 0x94,
+  0xD8, 0x00, 0x40, 0x94, 0xCB, 0x01, 0x40, 0xCA, 0x00, 0x40, 0x94, 0xCA,
+  0x02, 0x40, 0xCA, 0x00, 0x40, 0x94, 0xC8, 0x04, 0x80, 0x00, 0xCA, 0x00,
+  0x40, 0x94, 0xC7, 0x05, 0x40, 0x00, 0xCA, 0x00, 0x40, 0x94, 0xC5, 0x00,
+  0x80, 0x86, 0xCA, 0x00, 0x40, 0x94, 0x04, 0xFF, 0xC0, 0x88, 0xCA, 0x00,
+  0x40, 0x94, 0x02, 0xFC, 0x8A, 0xCA, 0x00, 0x40, 0xA2, 0xCA, 0x00, 0x40,
+  0xA2, 0xCA, 0x00, 0x40, 0xA2, 0xCA, 0x00, 0x40, 0xA2, 0xCA, 0x00, 0x40,
+  0xA2, 0xCA, 0x00, 0x40, 0xA2, 0xCA, 0x00, 0x40, 0xA2, 0xCA, 0x00, 0x40,
+  0xA2, 0xCA, 0x00, 0x40, 0xA2, 0xCA, 0x00, 0x40, 0xA2, 0xCA, 0x00, 0x40,
+  0xA2, 0xCA, 0x00, 0x40, 0xA2, 0xCA, 0x00, 0x40, 0xA2, 0xCA, 0x00, 0x40,
+  0xA2, 0xCA, 0x00, 0x40, 0xA2, 0xCA, 0x00, 0x40, 0xA2, 0xCA, 0x00, 0x40,
+  0xA2, 0xCA, 0x00, 0x40, 0xA2, 0xCA, 0x00, 0x40, 0xA2, 0xCA, 0x00, 0x40,
+  0xA2, 0xCA, 0x00, 0x40, 0xA2, 0xCA, 0x00, 0x40, 0xA2, 0xCA, 0x00, 0x40,
+  0x92, 0x00, 0x80, 0xE7, 0x06, 0x80, 0x08, 0xE7, 0x06, 0x80, 0x08, 0xE7,
+  0x06, 0x80, 0x08, 0xE7, 0x06, 0x80, 0x08, 0xE7, 0x06, 0x80, 0x08, 0xE7,
+  0x06, 0x80, 0x08, 0xE7, 0x06, 0x80, 0x08, 0xE7, 0x06, 0x80, 0x08, 0xE7,
+  0x00, 0x80, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+  0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xA7,
+  /* code 0032 */
+  0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+  0xBF, 0xBF, 0xBF, 0xAB, 0x00, 0x40, 0xCA, 0x00, 0x80, 0x9E, 0x00, 0x80,
+  0xD1, 0x99, 0x00, 0x80, 0xD5, 0x96, 0xD8, 0x00, 0x80, 0x92, 0x00, 0x40,
+  0xDB, 0x90, 0x00, 0x40, 0xDD, 0x8E, 0x00, 0x40, 0xDF, 0x8D, 0xE0, 0x00,
+  0x80, 0x8B, 0x00, 0x80, 0xCD, 0x04, 0x00, 0x40, 0xCE, 0x00, 0x40, 0x89,
+  0x00, 0x40, 0xCC, 0x87, 0x00, 0x40, 0xCC, 0x00, 0x80, 0x89, 0xCB, 0x00,
+  0x80, 0x89, 0x00, 0x40, 0xCC, 0x00, 0x40, 0x87, 0x00, 0x40, 0xCA, 0x00,
+  0x80, 0x8B, 0x00, 0x40, 0xCB, 0x00, 0x80, 0x87, 0x00, 0x80, 0xCA, 0x8D,
+  0x00, 0x80, 0xCB, 0x87, 0xCA, 0x00, 0x80, 0x8E, 0xCB, 0x86, 0x00, 0x40,
+  0xCA, 0x00, 0x40, 0x8E, 0x00, 0x80, 0xCA, 0x07, 0x40, 0x02, 0xCA, 0x8F,
+  0x00, 0x80, 0xCA, 0x07, 0x40, 0x02, 0xC9, 0x00, 0x80, 0x8F, 0x00, 0x40,
+  0xCA, 0x00, 0x40, 0x87, 0x00, 0x40, 0xC7, 0x00, 0x40, 0x8F, 0x00, 0x40,
+  0xCA, 0x00, 0x40, 0x8C, 0x04, 0xFF, 0x40, 0x8F, 0x00, 0x80, 0xCA, 0x00,
+  0x40, 0xA1, 0xCB, 0x00, 0x40, 0xA0, 0x00, 0x40, 0xCB, 0x00, 0x40, 0xA0,
+  0x00, 0x80, 0xCB, 0x00, 0x40, 0xA0, 0xCC, 0xA0, 0x00, 0x80, 0xCB, 0x00,
+  0x80, 0x9F, 0x00, 0x40, 0xCC, 0x00, 0x40, 0x9E, 0x00, 0x40, 0xCD, 0x9F,
+  0xCD, 0x00, 0x80, 0x9E, 0xCE, 0x9E, 0xCE, 0x00, 0x40, 0x9C, 0x00, 0x40,
+  0xCE, 0x00, 0x80, 0x9C, 0x00, 0x40, 0xCF, 0x9C, 0x00, 0x80, 0xCF, 0x9B,
+  0x00, 0x40, 0xD0, 0x9B, 0x00, 0x80, 0xCF, 0x00, 0x80, 0x9B, 0xD0, 0x00,
+  0x40, 0x9A, 0x00, 0x40, 0xD0, 0x9B, 0xD0, 0x00, 0x80, 0x9A, 0x00, 0x40,
+  0xD0, 0x00, 0x40, 0x9A, 0x00, 0x80, 0xCF, 0x00, 0x80, 0x9A, 0x00, 0x40,
+  0xD0, 0x00, 0x40, 0x9A, 0x00, 0x80, 0xCF, 0x00, 0x80, 0x9B, 0xD0, 0x9B,
+  0x00, 0x80, 0xCF, 0x00, 0x40, 0x9B, 0xCF, 0x00, 0x80, 0x9C, 0x00, 0x80,
+  0xCE, 0x9E, 0x00, 0x80, 0xE6, 0x07, 0x40, 0x02, 0xE6, 0x07, 0x40, 0x02,
+  0xE6, 0x07, 0x40, 0x02, 0xE6, 0x07, 0x40, 0x02, 0xE6, 0x07, 0x40, 0x02,
+  0xE6, 0x07, 0x40, 0x02, 0xE6, 0x07, 0x40, 0x02, 0xE6, 0x07, 0x40, 0x02,
+  0xE6, 0x00, 0x40, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+  0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xAA,
+  /* code 0033 */
+  0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+  0xBF, 0xBF, 0xBF, 0xAB, 0x00, 0x40, 0xCA, 0x00, 0x40, 0x9E, 0xD2, 0x99,
+  0xD6, 0x95, 0x00, 0x80, 0xD8, 0x00, 0x80, 0x92, 0xDC, 0x90, 0xDE, 0x8E,
+  0xE0, 0x8C, 0xE1, 0x00, 0x80, 0x8A, 0x00, 0x80, 0xCD, 0x05, 0x40, 0x00,
+  0xCE, 0x89, 0x00, 0x40, 0xCC, 0x00, 0x40, 0x88, 0xCC, 0x00, 0x80, 0x88,
+  0x00, 0x80, 0xCB, 0x8B, 0x00, 0x80, 0xCB, 0x87, 0x00, 0x40, 0xCB, 0x8D,
+  0xCB, 0x87, 0x00, 0x80, 0xCA, 0x8E, 0x00, 0x40, 0xCA, 0x00, 0x40, 0x86,
+  0xCA, 0x00, 0x80, 0x8F, 0xCA, 0x00, 0x40, 0x86, 0xCA, 0x90, 0xCA, 0x00,
+  0x40, 0x8A, 0x06, 0xBF, 0xF8, 0x90, 0xCA, 0x00, 0x40, 0xA1, 0x00, 0x40,
+  0xCA, 0x00, 0x40, 0xA1, 0x00, 0x80, 0xCA, 0xA2, 0xCA, 0x00, 0x80, 0xA1,
+  0xCB, 0x00, 0x40, 0x9F, 0x00, 0x80, 0xCC, 0x9E, 0xCE, 0x00, 0x40, 0x95,
+  0xD6, 0x00, 0x80, 0x96, 0xD6, 0x97, 0xD4, 0x00, 0x80, 0x98, 0xD3, 0x00,
+  0x40, 0x99, 0xD3, 0x9A, 0xD5, 0x98, 0xD6, 0x00, 0x40, 0x96, 0xD7, 0x00,
+  0x40, 0x95, 0xD8, 0x00, 0x40, 0x9E, 0x00, 0x80, 0xCE, 0xA0, 0x00, 0x40,
+  0xCC, 0x00, 0x80, 0xA0, 0x00, 0x40, 0xCC, 0xA1, 0x00, 0x40, 0xCB, 0x00,
+  0x40, 0xA1, 0x00, 0x80, 0xCA, 0x00, 0x80, 0xA1, 0x00, 0x40, 0xCA, 0x00,
+  0x80, 0xA2, 0xCA, 0x00, 0x80, 0x8A, 0x04, 0xBF, 0x80, 0x92, 0x00, 0x80,
+  0xCA, 0x86, 0xC8, 0x92, 0x00, 0x80, 0xCA, 0x04, 0x00, 0x00, 0xCA, 0x00,
+  0x40, 0x91, 0x00, 0x80, 0xC9, 0x05, 0x80, 0x00, 0xCB, 0x91, 0xCA, 0x06,
+  0x80, 0x08, 0xCA, 0x00, 0x80, 0x8F, 0x00, 0x80, 0xCA, 0x06, 0x80, 0x04,
+  0xCB, 0x00, 0x40, 0x8D, 0x00, 0x40, 0xCB, 0x00, 0x40, 0x85, 0xCC, 0x00,
+  0x40, 0x8B, 0x00, 0x40, 0xCC, 0x86, 0x00, 0x40, 0xCC, 0x00, 0x80, 0x89,
+  0x00, 0x80, 0xCC, 0x00, 0x80, 0x87, 0x00, 0x80, 0xCE, 0x85, 0xCF, 0x89,
+  0xE3, 0x00, 0x40, 0x8A, 0xE1, 0x00, 0x80, 0x8C, 0xDF, 0x00, 0x80, 0x8E,
+  0x00, 0x80, 0xDC, 0x00, 0x80, 0x90, 0x00, 0x40, 0xDA, 0x00, 0x40, 0x93,
+  0x00, 0x80, 0xD6, 0x00, 0x80, 0x97, 0x00, 0x80, 0xD2, 0x00, 0x40, 0x9D,
+  0xCB, 0x00, 0x80, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+  0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x89,
+  /* code 0034 */
+  0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+  0xBF, 0xBF, 0xBF, 0xBF, 0xA2, 0x00, 0x80, 0xCA, 0xA1, 0x00, 0x40, 0xCB,
+  0xA1, 0xCC, 0xA0, 0x00, 0x80, 0xCC, 0x9F, 0x00, 0x40, 0xCD, 0x9F, 0xCE,
+  0x9E, 0xCF, 0x9D, 0x00, 0x80, 0xCF, 0x9C, 0x00, 0x40, 0xD0, 0x9C, 0xD1,
+  0x9B, 0x00, 0x80, 0xD1, 0x9A, 0x00, 0x40, 0xD2, 0x9A, 0xD3, 0x99, 0x00,
+  0x80, 0xD3, 0x98, 0x00, 0x40, 0xD4, 0x98, 0xC8, 0x01, 0x90, 0xCA, 0x97,
+  0x00, 0x80, 0xC8, 0x01, 0x10, 0xCA, 0x96, 0x00, 0x40, 0xC8, 0x02, 0x44,
+  0xCA, 0x96, 0xC8, 0x03, 0x81, 0xCA, 0x95, 0xC9, 0x03, 0x01, 0xCA, 0x94,
+  0x00, 0x80, 0xC8, 0x04, 0x40, 0x40, 0xCA, 0x93, 0x00, 0x40, 0xC8, 0x05,
+  0x80, 0x10, 0xCA, 0x93, 0xC9, 0x05, 0x00, 0x10, 0xCA, 0x92, 0x00, 0x80,
+  0xC8, 0x06, 0x80, 0x04, 0xCA, 0x91, 0x00, 0x40, 0xC9, 0x06, 0x00, 0x04,
+  0xCA, 0x91, 0xC9, 0x07, 0x40, 0x01, 0xCA, 0x90, 0x00, 0x80, 0xC8, 0x08,
+  0x80, 0x00, 0x40, 0xCA, 0x8F, 0x00, 0x40, 0xC9, 0x87, 0x00, 0x40, 0xCA,
+  0x8F, 0xC9, 0x00, 0x40, 0x87, 0x00, 0x40, 0xCA, 0x8E, 0x00, 0x80, 0xC8,
+  0x00, 0x80, 0x88, 0x00, 0x40, 0xCA, 0x8D, 0x00, 0x40, 0xC9, 0x89, 0x00,
+  0x40, 0xCA, 0x8D, 0xC9, 0x00, 0x80, 0x89, 0x00, 0x40, 0xCA, 0x8C, 0xE9,
+  0x04, 0x00, 0x40, 0xE9, 0x04, 0x00, 0x40, 0xE9, 0x04, 0x00, 0x40, 0xE9,
+  0x04, 0x00, 0x40, 0xE9, 0x04, 0x00, 0x40, 0xE9, 0x04, 0x00, 0x40, 0xE9,
+  0x04, 0x00, 0x40, 0xE9, 0x04, 0x00, 0x40, 0xE9, 0x9A, 0x00, 0x40, 0xCA,
+  0xA2, 0x00, 0x40, 0xCA, 0xA2, 0x00, 0x40, 0xCA, 0xA2, 0x00, 0x40, 0xCA,
+  0xA2, 0x00, 0x40, 0xCA, 0xA2, 0x00, 0x40, 0xCA, 0xA2, 0x00, 0x40, 0xCA,
+  0xA2, 0x00, 0x40, 0xCA, 0xA2, 0x00, 0x40, 0xCA, 0xA2, 0x00, 0x40, 0xCA,
+  0xA2, 0x00, 0x40, 0xCA, 0xA2, 0x00, 0x40, 0xCA, 0xBF, 0xBF, 0xBF, 0xBF,
+  0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+  0xBF, 0xB1,
+  /* code 0035 */
+  0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+  0xBF, 0xBF, 0xBF, 0xBF, 0x90, 0x00, 0x40, 0xE1, 0x00, 0x40, 0x8A, 0x00,
+  0x80, 0xE1, 0x00, 0x40, 0x8A, 0x00, 0x80, 0xE1, 0x00, 0x40, 0x8A, 0x00,
+  0x80, 0xE1, 0x8B, 0x00, 0x80, 0xE1, 0x8B, 0xE2, 0x8B, 0xE1, 0x00, 0x80,
+  0x8B, 0xE1, 0x00, 0x80, 0x8B, 0xE1, 0x00, 0x80, 0x8A, 0x00, 0x40, 0xC8,
+  0x00, 0x40, 0xA3, 0x00, 0x40, 0xC8, 0x00, 0x40, 0xA3, 0x00, 0x40, 0xC8,
+  0x00, 0x40, 0xA3, 0x00, 0x80, 0xC8, 0xA4, 0x00, 0x80, 0xC8, 0xA4, 0x00,
+  0x80, 0xC8, 0xA4, 0x00, 0x80, 0xC8, 0xA4, 0xC8, 0x00, 0x80, 0xA4, 0xC8,
+  0x06, 0x80, 0x08, 0xC9, 0x94, 0xC8, 0x03, 0x81, 0xCF, 0x91, 0xC8, 0x01,
+  0x80, 0xD3, 0x8E, 0x00, 0x40, 0xDF, 0x00, 0x40, 0x8C, 0x00, 0x40, 0xE0,
+  0x00, 0x80, 0x8B, 0x00, 0x40, 0xE1, 0x00, 0x80, 0x8A, 0x00, 0x40, 0xE2,
+  0x00, 0x80, 0x89, 0x00, 0x80, 0xE3, 0x00, 0x40, 0x88, 0x00, 0x80, 0xCE,
+  0x05, 0x80, 0x00, 0xCF, 0x88, 0x00, 0x80, 0xCC, 0x00, 0x40, 0x88, 0xCD,
+  0x00, 0x80, 0x87, 0xCC, 0x8B, 0x00, 0x80, 0xCC, 0x87, 0xCB, 0x8D, 0xCC,
+  0x00, 0x40, 0x88, 0x00, 0x80, 0xC7, 0x00, 0x40, 0x8E, 0xCB, 0x00, 0x80,
+  0x8C, 0x04, 0xBF, 0x80, 0x8F, 0x00, 0x80, 0xCB, 0xA2, 0xCB, 0x00, 0x40,
+  0xA1, 0xCB, 0x00, 0x40, 0xA1, 0x00, 0x80, 0xCA, 0x00, 0x40, 0xA1, 0x00,
+  0x80, 0xCA, 0x00, 0x40, 0xA1, 0x00, 0x80, 0xCA, 0x00, 0x40, 0xA1, 0x00,
+  0x80, 0xCA, 0x00, 0x40, 0x87, 0x06, 0xBF, 0xFC, 0x92, 0xCB, 0x04, 0x40,
+  0x00, 0xCA, 0x00, 0x40, 0x90, 0x00, 0x40, 0xCB, 0x04, 0x00, 0x00, 0xCA,
+  0x00, 0x80, 0x90, 0x00, 0x80, 0xCB, 0x05, 0x00, 0x20, 0xCA, 0x00, 0x40,
+  0x8E, 0x00, 0x40, 0xCB, 0x06, 0x80, 0x04, 0xCB, 0x8E, 0xCC, 0x06, 0x40,
+  0x00, 0xCC, 0x8C, 0xCC, 0x08, 0x80, 0x00, 0x80, 0xCC, 0x00, 0x80, 0x88,
+  0x00, 0x40, 0xCD, 0x00, 0x40, 0x87, 0xCF, 0x05, 0x00, 0x10, 0xCE, 0x00,
+  0x80, 0x88, 0x00, 0x40, 0xE3, 0x8A, 0x00, 0x80, 0xE1, 0x8C, 0x00, 0x80,
+  0xDF, 0x00, 0x40, 0x8D, 0x00, 0x40, 0xDD, 0x00, 0x40, 0x90, 0xDB, 0x93,
+  0x00, 0x40, 0xD7, 0x00, 0x40, 0x97, 0xD3, 0x9D, 0x00, 0x40, 0xCB, 0x00,
+  0x80, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+  0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xB7,
+  /* code 0036 */
+  0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+  0xBF, 0xBF, 0xBF, 0xAD, 0x00, 0x80, 0xCA, 0x9F, 0x00, 0x80, 0xD0, 0x9A,
+  0x00, 0x80, 0xD4, 0x96, 0x00, 0x40, 0xD7, 0x00, 0x80, 0x93, 0x00, 0x40,
+  0xD9, 0x00, 0x80, 0x91, 0x00, 0x80, 0xDB, 0x00, 0x80, 0x8F, 0x00, 0x40,
+  0xDD, 0x00, 0x40, 0x8D, 0x00, 0x40, 0xDF, 0x8D, 0xCD, 0x05, 0x80, 0x10,
+  0xCC, 0x00, 0x80, 0x8B, 0x00, 0x80, 0xCB, 0x00, 0x80, 0x88, 0xCB, 0x8B,
+  0xCB, 0x00, 0x40, 0x8A, 0xCA, 0x00, 0x80, 0x89, 0x00, 0x80, 0xCA, 0x00,
+  0x40, 0x8C, 0xCA, 0x89, 0xCA, 0x00, 0x80, 0x8D, 0x00, 0x40, 0xC9, 0x00,
+  0x40, 0x87, 0x00, 0x80, 0xCA, 0x8F, 0xC9, 0x00, 0x40, 0x87, 0xCA, 0x00,
+  0x80, 0x8F, 0x06, 0xBF, 0xF4, 0x8A, 0x00, 0x40, 0xCA, 0x00, 0x40, 0xA1,
+  0x00, 0x80, 0xCA, 0xA2, 0x00, 0x80, 0xC9, 0x00, 0x80, 0xA2, 0xCA, 0x00,
+  0x40, 0xA1, 0x00, 0x40, 0xCA, 0xA2, 0x00, 0x40, 0xCA, 0x85, 0x00, 0x80,
+  0xC9, 0x00, 0x40, 0x90, 0x00, 0x80, 0xC9, 0x04, 0x80, 0x40, 0xCF, 0x00,
+  0x40, 0x8D, 0x00, 0x80, 0xC9, 0x02, 0x80, 0xD3, 0x8C, 0x00, 0x80, 0xC9,
+  0x01, 0x50, 0xD5, 0x00, 0x80, 0x8A, 0x00, 0x80, 0xE2, 0x00, 0x80, 0x89,
+  0xE4, 0x00, 0x80, 0x88, 0xE5, 0x00, 0x80, 0x87, 0xE6, 0x00, 0x40, 0x86,
+  0xD2, 0x05, 0x40, 0x20, 0xCE, 0x86, 0xD0, 0x00, 0x40, 0x87, 0x00, 0x80,
+  0xCC, 0x00, 0x40, 0x85, 0xCF, 0x8A, 0x00, 0x40, 0xCC, 0x85, 0x00, 0x80,
+  0xCD, 0x8C, 0x00, 0x40, 0xCB, 0x06, 0x40, 0x08, 0xCC, 0x00, 0x40, 0x8D,
+  0x00, 0x80, 0xCA, 0x06, 0x40, 0x08, 0xCB, 0x00, 0x80, 0x8F, 0xCA, 0x06,
+  0x80, 0x08, 0xCB, 0x00, 0x40, 0x8F, 0x00, 0x80, 0xC9, 0x06, 0x80, 0x04,
+  0xCB, 0x90, 0x00, 0x40, 0xCA, 0x05, 0x00, 0x10, 0xCB, 0x91, 0xCA, 0x85,
+  0xCB, 0x91, 0xCA, 0x85, 0x00, 0x80, 0xCA, 0x91, 0xCA, 0x85, 0x00, 0x40,
+  0xCA, 0x90, 0x00, 0x40, 0xC9, 0x00, 0x80, 0x86, 0xCA, 0x00, 0x40, 0x8F,
+  0x00, 0x40, 0xC9, 0x00, 0x80, 0x86, 0x00, 0x80, 0xC9, 0x00, 0x80, 0x8F,
+  0x00, 0x80, 0xC9, 0x00, 0x40, 0x86, 0x00, 0x40, 0xCA, 0x00, 0x40, 0x8D,
+  0x00, 0x40, 0xCA, 0x00, 0x40, 0x87, 0xCB, 0x8D, 0xCB, 0x88, 0x00, 0x40,
+  0xCB, 0x8B, 0xCB, 0x00, 0x40, 0x89, 0xCC, 0x00, 0x40, 0x87, 0x00, 0x40,
+  0xCC, 0x8A, 0x00, 0x40, 0xCD, 0x05, 0x40, 0x10, 0xCD, 0x00, 0x40, 0x8B,
+  0x00, 0x40, 0xDF, 0x00, 0x80, 0x8D, 0x00, 0x80, 0xDE, 0x8F, 0x00, 0x80,
+  0xDC, 0x91, 0x00, 0x80, 0xDA, 0x93, 0x00, 0x40, 0xD7, 0x00, 0x80, 0x96,
+  0x00, 0x80, 0xD4, 0x00, 0x40, 0x99, 0x00, 0x80, 0xD0, 0x00, 0x40, 0x9E,
+  0x00, 0x80, 0xCA, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+  0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0x88,
+  /* code 0037 */
+  0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+  0xBF, 0xBF, 0xBF, 0xBF, 0x8E, 0xE5, 0x08, 0x40, 0x00, 0x40, 0xE5, 0x08,
+  0x40, 0x00, 0x40, 0xE5, 0x08, 0x40, 0x00, 0x40, 0xE5, 0x08, 0x40, 0x00,
+  0x80, 0xE5, 0x08, 0x40, 0x00, 0x80, 0xE5, 0x08, 0x40, 0x00, 0x80, 0xE5,
+  0x07, 0x40, 0x00, 0xE6, 0x07, 0x40, 0x00, 0xE5, 0x00, 0x80, 0xA3, 0x00,
+  0x80, 0xC8, 0xA3, 0x00, 0x80, 0xC8, 0x00, 0x40, 0xA2, 0x00, 0x80, 0xC8,
+  0x00, 0x40, 0xA2, 0x00, 0x40, 0xC8, 0x00, 0x80, 0xA3, 0xC9, 0xA3, 0xC9,
+  0x00, 0x40, 0xA2, 0x00, 0x80, 0xC8, 0x00, 0x80, 0xA2, 0x00, 0x40, 0xC9,
+  0xA3, 0xC9, 0x00, 0x80, 0xA2, 0x00, 0x80, 0xC9, 0xA2, 0x00, 0x40, 0xC9,
+  0x00, 0x40, 0xA2, 0xC9, 0x00, 0x80, 0xA2, 0x00, 0x80, 0xC9, 0x00, 0x40,
+  0xA2, 0xC9, 0x00, 0x80, 0xA2, 0x00, 0x80, 0xC9, 0x00, 0x40, 0xA1, 0x00,
+  0x40, 0xC9, 0x00, 0x80, 0xA2, 0x00, 0x80, 0xC9, 0x00, 0x40, 0xA1, 0x00,
+  0x40, 0xC9, 0x00, 0x80, 0xA2, 0x00, 0x80, 0xC9, 0x00, 0x40, 0xA2, 0xCA,
+  0xA2, 0x00, 0x80, 0xC9, 0x00, 0x80, 0xA2, 0xCA, 0x00, 0x40, 0xA1, 0x00,
+  0x40, 0xCA, 0xA2, 0x00, 0x80, 0xC9, 0x00, 0x80, 0xA2, 0xCA, 0x00, 0x80,
+  0xA1, 0x00, 0x40, 0xCA, 0x00, 0x40, 0xA1, 0x00, 0x80, 0xCA, 0xA2, 0xCB,
+  0xA1, 0x00, 0x40, 0xCA, 0x00, 0x80, 0xA1, 0x00, 0x40, 0xCA, 0x00, 0x40,
+  0xA1, 0x00, 0x80, 0xCA, 0x00, 0x40, 0xA1, 0xCB, 0x00, 0x40, 0xA1, 0xCB,
+  0xA1, 0x00, 0x40, 0xCB, 0xA1, 0x00, 0x80, 0xCA, 0x00, 0x80, 0xA1, 0x00,
+  0x80, 0xCA, 0x00, 0x80, 0xA1, 0xCB, 0x00, 0x80, 0xA1, 0xCB, 0x00, 0x40,
+  0xA1, 0xCB, 0x00, 0x40, 0xA0, 0x00, 0x40, 0xCB, 0x00, 0x40, 0xA0, 0x00,
+  0x40, 0xCB, 0x00, 0x40, 0xA0, 0x00, 0x40, 0xCB, 0x00, 0x40, 0xA0, 0x00,
+  0x40, 0xCB, 0xA1, 0x00, 0x40, 0xCB, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+  0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBB,
+  /* code 0038 */
+  0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+  0xBF, 0xBF, 0xBF, 0xAB, 0x00, 0x80, 0xCB, 0x00, 0x80, 0x9D, 0xD3, 0x00,
+  0x40, 0x96, 0x00, 0x40, 0xD7, 0x00, 0x40, 0x93, 0xDB, 0x90, 0x00, 0x40,
+  0xDD, 0x00, 0x40, 0x8D, 0x00, 0x40, 0xDF, 0x00, 0x40, 0x8C, 0xE1, 0x8B,
+  0xE2, 0x00, 0x80, 0x89, 0x00, 0x40, 0xCE, 0x05, 0x00, 0x00, 0xCE, 0x00,
+  0x40, 0x88, 0xCC, 0x00, 0x80, 0x89, 0x00, 0x80, 0xCB, 0x00, 0x80, 0x87,
+  0x00, 0x40, 0xCB, 0x8C, 0x00, 0x40, 0xCB, 0x87, 0x00, 0x80, 0xCA, 0x8E,
+  0x00, 0x40, 0xCA, 0x87, 0x00, 0x80, 0xC9, 0x00, 0x80, 0x8F, 0x00, 0x80,
+  0xC9, 0x07, 0x40, 0x00, 0xCA, 0x00, 0x40, 0x8F, 0x00, 0x40, 0xC9, 0x07,
+  0x40, 0x00, 0xCA, 0x00, 0x40, 0x90, 0xC9, 0x07, 0x40, 0x00, 0xCA, 0x00,
+  0x80, 0x8F, 0x00, 0x40, 0xC9, 0x07, 0x40, 0x00, 0xCB, 0x8F, 0x00, 0x80,
+  0xC9, 0x87, 0x00, 0x80, 0xCB, 0x8E, 0xCA, 0x87, 0x00, 0x80, 0xCC, 0x00,
+  0x40, 0x8B, 0x00, 0x80, 0xC9, 0x00, 0x80, 0x87, 0x00, 0x40, 0xCE, 0x89,
+  0x00, 0x80, 0xCA, 0x89, 0xD0, 0x07, 0x40, 0x02, 0xCA, 0x00, 0x80, 0x89,
+  0x00, 0x80, 0xD2, 0x02, 0x04, 0xCB, 0x00, 0x80, 0x8B, 0xE0, 0x00, 0x80,
+  0x8C, 0x00, 0x40, 0xDE, 0x00, 0x80, 0x8E, 0x00, 0x40, 0xDC, 0x91, 0x00,
+  0x40, 0xD9, 0x95, 0xDA, 0x94, 0x00, 0x80, 0xD9, 0x00, 0x80, 0x91, 0x00,
+  0x40, 0xDC, 0x8E, 0x00, 0x40, 0xDF, 0x00, 0x40, 0x8B, 0xE2, 0x00, 0x40,
+  0x89, 0xE4, 0x88, 0xCD, 0x03, 0x00, 0xD3, 0x08, 0x80, 0x00, 0x80, 0xCB,
+  0x08, 0x40, 0x00, 0x40, 0xD1, 0x06, 0x40, 0x04, 0xCB, 0x8B, 0xCF, 0x05,
+  0x80, 0x00, 0xCB, 0x8E, 0xCE, 0x04, 0x00, 0x40, 0xCA, 0x00, 0x40, 0x8F,
+  0x00, 0x40, 0xCC, 0x04, 0x00, 0x80, 0xC9, 0x00, 0x80, 0x91, 0x00, 0x40,
+  0xCB, 0x04, 0x40, 0x80, 0xC9, 0x00, 0x40, 0x92, 0x00, 0x80, 0xCA, 0x04,
+  0x40, 0x80, 0xC9, 0x93, 0x00, 0x40, 0xCA, 0x04, 0x40, 0x80, 0xC9, 0x00,
+  0x40, 0x93, 0xCA, 0x04, 0x40, 0x80, 0xC9, 0x00, 0x80, 0x92, 0x00, 0x40,
+  0xCA, 0x04, 0x40, 0x80, 0xCA, 0x92, 0x00, 0x80, 0xCA, 0x04, 0x00, 0x80,
+  0xCA, 0x00, 0x80, 0x90, 0x00, 0x40, 0xCA, 0x05, 0x80, 0x10, 0xCC, 0x8E,
+  0x00, 0x40, 0xCB, 0x05, 0x40, 0x00, 0xCD, 0x00, 0x40, 0x8B, 0x00, 0x80,
+  0xCC, 0x06, 0x00, 0x04, 0xCF, 0x07, 0x00, 0x01, 0xCE, 0x07, 0x80, 0x00,
+  0xE6, 0x87, 0x00, 0x40, 0xE4, 0x89, 0x00, 0x40, 0xE2, 0x8B, 0x00, 0x40,
+  0xE0, 0x8E, 0xDD, 0x00, 0x40, 0x90, 0x00, 0x40, 0xD9, 0x00, 0x80, 0x95,
+  0xD5, 0x00, 0x40, 0x9B, 0xCD, 0x00, 0x80, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+  0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+  0x88,
+  /* code 0039 */
+  0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+  0xBF, 0xBF, 0xBF, 0xAA, 0x00, 0x80, 0xCA, 0x9F, 0xD1, 0x00, 0x40, 0x99,
+  0xD5, 0x00, 0x40, 0x95, 0x00, 0x40, 0xD8, 0x93, 0x00, 0x80, 0xDA, 0x00,
+  0x40, 0x90, 0x00, 0x80, 0xDC, 0x00, 0x40, 0x8E, 0x00, 0x80, 0xDE, 0x00,
+  0x40, 0x8C, 0x00, 0x40, 0xE0, 0x00, 0x40, 0x8B, 0xCE, 0x05, 0x40, 0x20,
+  0xCD, 0x8A, 0x00, 0x40, 0xCC, 0x88, 0x00, 0x40, 0xCB, 0x00, 0x80, 0x89,
+  0xCB, 0x00, 0x80, 0x8A, 0x00, 0x40, 0xCB, 0x88, 0x00, 0x40, 0xCB, 0x8C,
+  0x00, 0x40, 0xCA, 0x00, 0x80, 0x87, 0x00, 0x80, 0xCA, 0x8E, 0x00, 0x80,
+  0xCA, 0x87, 0x00, 0x80, 0xC9, 0x00, 0x80, 0x8F, 0xCA, 0x00, 0x40, 0x86,
+  0xCA, 0x00, 0x40, 0x8F, 0x00, 0x80, 0xC9, 0x00, 0x80, 0x86, 0xCA, 0x90,
+  0x00, 0x40, 0xCA, 0x86, 0xC9, 0x00, 0x80, 0x90, 0x00, 0x40, 0xCA, 0x00,
+  0x40, 0x85, 0xC9, 0x00, 0x80, 0x90, 0x00, 0x40, 0xCA, 0x00, 0x80, 0x85,
+  0xC9, 0x00, 0x80, 0x90, 0x00, 0x40, 0xCA, 0x00, 0x80, 0x85, 0xCA, 0x90,
+  0x00, 0x40, 0xCB, 0x85, 0xCA, 0x00, 0x40, 0x8F, 0x00, 0x80, 0xCB, 0x85,
+  0xCA, 0x00, 0x80, 0x8F, 0xCC, 0x85, 0x00, 0x80, 0xCA, 0x00, 0x40, 0x8D,
+  0x00, 0x80, 0xCC, 0x06, 0x40, 0x04, 0xCB, 0x8C, 0x00, 0x40, 0xCD, 0x06,
+  0x40, 0x04, 0xCB, 0x00, 0x80, 0x8A, 0x00, 0x80, 0xCE, 0x00, 0x40, 0x85,
+  0x00, 0x80, 0xCC, 0x88, 0xD0, 0x00, 0x40, 0x85, 0x00, 0x40, 0xCE, 0x04,
+  0x00, 0x00, 0xD2, 0x00, 0x40, 0x86, 0x00, 0x80, 0xE5, 0x00, 0x40, 0x87,
+  0xE5, 0x00, 0x40, 0x87, 0x00, 0x40, 0xE4, 0x00, 0x40, 0x88, 0x00, 0x40,
+  0xE3, 0x00, 0x40, 0x8A, 0xD5, 0x01, 0x80, 0xCA, 0x8C, 0x00, 0x80, 0xD2,
+  0x02, 0x80, 0xCA, 0x8E, 0x00, 0x80, 0xCF, 0x03, 0x01, 0xCA, 0x91, 0x00,
+  0x80, 0xC9, 0x85, 0x00, 0x40, 0xC9, 0x00, 0x80, 0xA2, 0x00, 0x80, 0xC9,
+  0x00, 0x80, 0xA2, 0xCA, 0x00, 0x40, 0xA2, 0xCA, 0xA2, 0x00, 0x40, 0xC9,
+  0x00, 0x80, 0xA2, 0xCA, 0x00, 0x40, 0xA1, 0x00, 0x40, 0xCA, 0xA2, 0xCA,
+  0x00, 0x80, 0x8E, 0x04, 0x7F, 0x80, 0x8D, 0x00, 0x40, 0xCA, 0x00, 0x40,
+  0x8A, 0x00, 0x40, 0xC7, 0x00, 0x40, 0x8B, 0x00, 0x40, 0xCA, 0x00, 0x80,
+  0x89, 0x00, 0x40, 0xCA, 0x00, 0x40, 0x89, 0x00, 0x40, 0xCB, 0x00, 0x40,
+  0x89, 0x00, 0x40, 0xCB, 0x00, 0x80, 0x87, 0x00, 0x40, 0xCB, 0x00, 0x80,
+  0x8B, 0x00, 0x80, 0xCC, 0x05, 0x80, 0x20, 0xCD, 0x8D, 0xDF, 0x00, 0x40,
+  0x8D, 0x00, 0x40, 0xDD, 0x00, 0x80, 0x8F, 0x00, 0x80, 0xDB, 0x00, 0x80,
+  0x91, 0x00, 0x80, 0xD9, 0x00, 0x80, 0x93, 0x00, 0x40, 0xD7, 0x00, 0x40,
+  0x96, 0xD5, 0x9A, 0xD1, 0x9F, 0xCA, 0x00, 0x80, 0xBF, 0xBF, 0xBF, 0xBF,
+  0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+  0xBF, 0x8B,
+  /* code 003A */
+  0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF, 0xBB,
+  0x00, 0x40, 0xCA, 0x87, 0x00, 0x40, 0xCA, 0x87, 0x00, 0x40, 0xCA, 0x87,
+  0x00, 0x40, 0xCA, 0x87, 0x00, 0x40, 0xCA, 0x87, 0x00, 0x40, 0xCA, 0x87,
+  0x00, 0x40, 0xCA, 0x87, 0x00, 0x40, 0xCA, 0x87, 0x00, 0x40, 0xCA, 0x87,
+  0x00, 0x40, 0xCA, 0x87, 0x00, 0x40, 0xCA, 0xBF, 0xBF, 0xBF, 0xBF, 0xB3,
+  0x00, 0x40, 0xCA, 0x87, 0x00, 0x40, 0xCA, 0x87, 0x00, 0x40, 0xCA, 0x87,
+  0x00, 0x40, 0xCA, 0x87, 0x00, 0x40, 0xCA, 0x87, 0x00, 0x40, 0xCA, 0x87,
+  0x00, 0x40, 0xCA, 0x87, 0x00, 0x40, 0xCA, 0x87, 0x00, 0x40, 0xCA, 0x87,
+  0x00, 0x40, 0xCA, 0x87, 0x00, 0x40, 0xCA, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+  0xBF, 0xBF, 0xA3
+};
+
+const aafontsCharInfo_t charTable_FontFranklinGothicBold99_Numbers_AA2_RLE[11] = {
+  {  47,   0, &FontFontFranklinGothicBold99_Numbers_AA2_RLE[    0] }, /* code 0030 */
+  {  47,   0, &FontFontFranklinGothicBold99_Numbers_AA2_RLE[  449] }, /* code 0031 */
+  {  47,   0, &FontFontFranklinGothicBold99_Numbers_AA2_RLE[  745] }, /* code 0032 */
+  {  47,   0, &FontFontFranklinGothicBold99_Numbers_AA2_RLE[ 1078] }, /* code 0033 */
+  {  47,   0, &FontFontFranklinGothicBold99_Numbers_AA2_RLE[ 1411] }, /* code 0034 */
+  {  47,   0, &FontFontFranklinGothicBold99_Numbers_AA2_RLE[ 1701] }, /* code 0035 */
+  {  47,   0, &FontFontFranklinGothicBold99_Numbers_AA2_RLE[ 2044] }, /* code 0036 */
+  {  47,   0, &FontFontFranklinGothicBold99_Numbers_AA2_RLE[ 2449] }, /* code 0037 */
+  {  47,   0, &FontFontFranklinGothicBold99_Numbers_AA2_RLE[ 2737] }, /* code 0038 */
+  {  47,   0, &FontFontFranklinGothicBold99_Numbers_AA2_RLE[ 3134] }, /* code 0039 */
+  {  20,   0, &FontFontFranklinGothicBold99_Numbers_AA2_RLE[ 3544] }  /* code 003A */
+};
+
+aafontsFont_t FontFranklinGothicBold99_Numbers_AA2_RLE = 
+{
+  AAFONTS_FONTTYPE_AA2,                 /* Font type (anti-aliasing level) */
+  99,                                   /* Font height in pixels */
+  20,                                   /* Width to insert for unknown characters */
+  54,                                   /* Height of upper-case characters */
+  42,                                   /* Height of lower-case characters */
+  76,                                   /* Font baseline */
+  0x0030,                               /* Unicode address of first character */
+  0x003A,                               /* Unicode address of last character */
+  &charTable_FontFranklinGothicBold99_Numbers_AA2_RLE[0], /* Font char data */
+  AAFONTS_ENCODING_RLE                  /* Glyph data encoding */
+};
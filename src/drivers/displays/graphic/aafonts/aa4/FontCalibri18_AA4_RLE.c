@@ -0,0 +1,546 @@
+/**************************************************************************/
+/*!
+    @file     FontCalibri18_AA4_RLE.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Run-length encoded copy of FontCalibri18_AA4, generated
+              by tools/fontpack (do not edit)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include "FontCalibri18_AA4_RLE.h"
+
+/* 3047 bytes of glyph data, against 6534 for FontCalibri18_AA4 */
+const uint8_t FontFontCalibri18_AA4_RLE[3047] = {
+  /* code 0020 */
+  0xB5,
+  /* code 0021 */
+  0x94, 0x20, 0x2D, 0x50, 0x02, 0xD5, 0x00, 0x1C, 0x50, 0x01, 0xC5, 0x00,
+  0x1C, 0x50, 0x01, 0xC5, 0x00, 0x1C, 0x50, 0x86, 0x07, 0x2D, 0x70, 0x02,
+  0xD7, 0x94,
+  /* code 0022 */
+  0x97, 0x16, 0x2D, 0x55, 0xC1, 0x2C, 0x35, 0xC1, 0x1A, 0x35, 0xC1, 0x1A,
+  0x33, 0x90, 0xBC,
+  /* code 0023 */
+  0xA3, 0x0D, 0x1A, 0x30, 0xA5, 0x02, 0xB2, 0x1A, 0x35, 0xC4, 0x0F, 0xE0,
+  0x5C, 0x13, 0xA1, 0x07, 0xA0, 0x5C, 0x1A, 0xC4, 0x14, 0xC0, 0xA5, 0x07,
+  0x70, 0x1C, 0x50, 0xA5, 0x01, 0xA3, 0x1C, 0x50, 0x9C,
+  /* code 0024 */
+  0x97, 0x01, 0x39, 0x84, 0x14, 0x5A, 0x00, 0x03, 0xEF, 0xFD, 0x22, 0xD5,
+  0x00, 0xA5, 0x3D, 0x30, 0x83, 0x03, 0x1C, 0xE3, 0x84, 0x03, 0x7F, 0xFA,
+  0x84, 0x02, 0x2D, 0xA0, 0x84, 0x13, 0x7C, 0x5A, 0x00, 0x1C, 0xA1, 0xCF,
+  0xFF, 0xA0, 0x00, 0x5A, 0x84, 0x01, 0x77, 0x90,
+  /* code 0025 */
+  0xAB, 0x32, 0x1C, 0xFD, 0x20, 0x02, 0xC3, 0x05, 0xA0, 0x77, 0x00, 0xA5,
+  0x00, 0x7A, 0x05, 0xA0, 0x7A, 0x00, 0x05, 0xC1, 0x77, 0x3C, 0x20, 0x00,
+  0x1C, 0xFD, 0x3C, 0x50, 0x87, 0x05, 0x7A, 0x3E, 0xF7, 0x83, 0x27, 0x3A,
+  0x2C, 0x52, 0xC3, 0x00, 0x2C, 0x31, 0xA3, 0x1A, 0x30, 0x0A, 0x70, 0x1C,
+  0x52, 0xB2, 0x05, 0xC1, 0x00, 0x5F, 0xF7, 0xAC,
+  /* code 0026 */
+  0xA9, 0x04, 0x7F, 0xFF, 0x50, 0x83, 0x19, 0x3D, 0x30, 0x5D, 0x20, 0x00,
+  0x5D, 0x20, 0x5D, 0x20, 0x00, 0x2D, 0x73, 0xE5, 0x84, 0x03, 0x5F, 0xD2,
+  0x84, 0x30, 0x5E, 0xAE, 0x30, 0x5C, 0x12, 0xD5, 0x0A, 0xD2, 0xAA, 0x03,
+  0xD3, 0x00, 0xAF, 0xE3, 0x02, 0xDA, 0x00, 0x5F, 0xF5, 0x00, 0x2D, 0xFF,
+  0xD2, 0x3E, 0xA0, 0xA7,
+  /* code 0027 */
+  0x8B, 0x0B, 0x2D, 0x52, 0xC3, 0x1A, 0x31, 0xA3, 0x9D,
+  /* code 0028 */
+  0x95, 0x3D, 0x77, 0x00, 0x2C, 0x30, 0x05, 0xC1, 0x00, 0xAA, 0x00, 0x1C,
+  0x70, 0x02, 0xD5, 0x00, 0x2D, 0x50, 0x02, 0xD5, 0x00, 0x1C, 0x70, 0x00,
+  0xAA, 0x00, 0x05, 0xC1, 0x00, 0x2C, 0x30, 0x00, 0x77, 0x85,
+  /* code 0029 */
+  0x93, 0x3E, 0x2C, 0x30, 0x00, 0x77, 0x00, 0x05, 0xC1, 0x00, 0x2C, 0x30,
+  0x01, 0xC5, 0x00, 0x0A, 0x70, 0x00, 0xA7, 0x00, 0x0A, 0x70, 0x01, 0xC5,
+  0x00, 0x2C, 0x30, 0x05, 0xD2, 0x00, 0xAA, 0x00, 0x2C, 0x30, 0x86,
+  /* code 002A */
+  0x9D, 0x1E, 0x1A, 0x30, 0x01, 0xCC, 0xA8, 0xE3, 0x00, 0x3E, 0xA0, 0x01,
+  0xCC, 0xA8, 0xE3, 0x00, 0x1A, 0x30, 0xBF, 0x00, 0x00,
+  /* code 002B */
+  0xAB, 0x13, 0x1C, 0x50, 0x00, 0x01, 0xC5, 0x00, 0x00, 0x1C, 0x50, 0x07,
+  0xC4, 0x13, 0xD0, 0x01, 0xC5, 0x00, 0x00, 0x1C, 0x50, 0x00, 0x01, 0xC5,
+  0xA4,
+  /* code 002C */
+  0xB0, 0x0C, 0xAA, 0x00, 0xAA, 0x03, 0xC2, 0x07, 0x70, 0x89,
+  /* code 002D */
+  0xB1, 0x04, 0x7F, 0xFD, 0x20, 0xA2,
+  /* code 002E */
+  0xAF, 0x06, 0x1C, 0xA0, 0x1C, 0xA0, 0x90,
+  /* code 002F */
+  0x95, 0x3F, 0xAA, 0x00, 0x02, 0xD5, 0x00, 0x05, 0xC1, 0x00, 0x0A, 0x70,
+  0x00, 0x2C, 0x30, 0x00, 0x5C, 0x10, 0x01, 0xC7, 0x00, 0x03, 0xD3, 0x00,
+  0x07, 0xA0, 0x00, 0x1C, 0x50, 0x00, 0x3C, 0x20, 0x00, 0x7A, 0x83, 0x01,
+  0xC5, 0x8F,
+  /* code 0030 */
+  0xA3, 0x3C, 0x3E, 0xFF, 0x50, 0x2D, 0x70, 0x5E, 0x35, 0xD2, 0x01, 0xC5,
+  0x7C, 0x10, 0x1C, 0x77, 0xC1, 0x00, 0xA7, 0x7C, 0x10, 0x1C, 0x75, 0xD2,
+  0x01, 0xC5, 0x2D, 0x50, 0x5D, 0x20, 0x3E, 0xFE, 0x30, 0x9C,
+  /* code 0031 */
+  0xA4, 0x3C, 0x7F, 0x70, 0x02, 0xD8, 0xC7, 0x00, 0x00, 0x1C, 0x70, 0x00,
+  0x01, 0xC7, 0x00, 0x00, 0x1C, 0x70, 0x00, 0x01, 0xC7, 0x00, 0x00, 0x1C,
+  0x70, 0x00, 0x01, 0xC7, 0x00, 0x2D, 0xFF, 0xFF, 0x70, 0x9B,
+  /* code 0032 */
+  0xA3, 0x37, 0x7F, 0xFF, 0x50, 0x3A, 0x10, 0x7D, 0x20, 0x00, 0x03, 0xD3,
+  0x00, 0x00, 0x5D, 0x20, 0x00, 0x1C, 0x70, 0x00, 0x0A, 0xC1, 0x00, 0x0A,
+  0xC1, 0x00, 0x1C, 0xC1, 0x00, 0x05, 0xC4, 0x00, 0xA0, 0x9B,
+  /* code 0033 */
+  0xA3, 0x0B, 0x7F, 0xFD, 0x20, 0x2A, 0x10, 0xAA, 0x84, 0x0E, 0x7C, 0x10,
+  0x00, 0x2D, 0x70, 0x05, 0xFF, 0xA0, 0x85, 0x02, 0x7D, 0x20, 0x83, 0x0F,
+  0x3D, 0x33, 0x90, 0x07, 0xD2, 0x1C, 0xFF, 0xE3, 0x9C,
+  /* code 0034 */
+  0xA5, 0x27, 0xAF, 0x70, 0x00, 0x5C, 0xC7, 0x00, 0x1C, 0x6C, 0x70, 0x07,
+  0xA1, 0xC7, 0x03, 0xC2, 0x1C, 0x70, 0xC5, 0x01, 0xC7, 0x0D, 0xC4, 0x0D,
+  0xC0, 0x00, 0x1C, 0x70, 0x00, 0x01, 0xC7, 0x9C,
+  /* code 0035 */
+  0xA2, 0x1A, 0x1C, 0xFF, 0xFA, 0x01, 0xC5, 0x00, 0x00, 0x1C, 0x50, 0x00,
+  0x01, 0xCF, 0xFE, 0x30, 0x84, 0x1D, 0x7D, 0x20, 0x00, 0x02, 0xD5, 0x00,
+  0x00, 0x3D, 0x39, 0x30, 0x0A, 0xC1, 0x5F, 0xFF, 0xC1, 0x9C,
+  /* code 0036 */
+  0xA4, 0x3B, 0x7F, 0xFE, 0x30, 0x7C, 0x10, 0x00, 0x2C, 0x30, 0x00, 0x03,
+  0xDD, 0xFF, 0xA0, 0x5E, 0x30, 0x3E, 0x55, 0xD2, 0x01, 0xC7, 0x3D, 0x30,
+  0x1C, 0x71, 0xC7, 0x05, 0xE3, 0x03, 0xEF, 0xF5, 0x9C,
+  /* code 0037 */
+  0xA2, 0x00, 0x50, 0xC4, 0x00, 0xD0, 0x84, 0x2F, 0xAA, 0x00, 0x00, 0x3D,
+  0x30, 0x00, 0x0A, 0xA0, 0x00, 0x02, 0xD5, 0x00, 0x00, 0x7C, 0x10, 0x00,
+  0x2D, 0x50, 0x00, 0x07, 0xD2, 0x00, 0x02, 0xD7, 0x9E,
+  /* code 0038 */
+  0xA3, 0x3C, 0x5F, 0xFF, 0x70, 0x2C, 0x30, 0x3D, 0x33, 0xC2, 0x02, 0xC3,
+  0x0A, 0xD3, 0xC7, 0x00, 0x0A, 0xFC, 0x10, 0x2D, 0x50, 0x7E, 0x37, 0xC1,
+  0x01, 0xC7, 0x5D, 0x20, 0x3E, 0x50, 0xAF, 0xFF, 0x70, 0x9C,
+  /* code 0039 */
+  0xA3, 0x3B, 0x5F, 0xFE, 0x30, 0x5E, 0x30, 0x5D, 0x27, 0xC1, 0x02, 0xC3,
+  0x5D, 0x20, 0x2D, 0x50, 0xAF, 0xFE, 0xD5, 0x00, 0x00, 0x2D, 0x50, 0x00,
+  0x05, 0xD2, 0x00, 0x02, 0xD7, 0x03, 0xEF, 0xF7, 0x9D,
+  /* code 003A */
+  0x9C, 0x06, 0xAC, 0x10, 0xAC, 0x10, 0x8C, 0x06, 0xAC, 0x10, 0xAC, 0x10,
+  0x8F,
+  /* code 003B */
+  0x9C, 0x06, 0xAC, 0x10, 0xAC, 0x10, 0x8C, 0x0C, 0x7C, 0x10, 0x7C, 0x11,
+  0xC5, 0x05, 0xA0, 0x89,
+  /* code 003C */
+  0xAE, 0x12, 0x7A, 0x00, 0x07, 0xF7, 0x00, 0x7F, 0xA0, 0x00, 0x7C, 0x10,
+  0x84, 0x02, 0x7F, 0xA0, 0x85, 0x02, 0x7F, 0x70, 0x85, 0x01, 0x7A, 0xA2,
+  /* code 003D */
+  0xB7, 0x00, 0x50, 0xC4, 0x00, 0xC0, 0x8D, 0x00, 0x50, 0xC4, 0x00, 0xC0,
+  0xA9,
+  /* code 003E */
+  0xA9, 0x02, 0x5D, 0x20, 0x84, 0x03, 0x2D, 0xD2, 0x84, 0x03, 0x3E, 0xD2,
+  0x84, 0x01, 0x5D, 0x82, 0x0D, 0x3E, 0xD2, 0x02, 0xDD, 0x20, 0x05, 0xD2,
+  0xA6,
+  /* code 003F */
+  0x9C, 0x25, 0x7F, 0xFE, 0x30, 0x2A, 0x10, 0x5D, 0x20, 0x00, 0x02, 0xD5,
+  0x00, 0x00, 0x5E, 0x30, 0x07, 0xFF, 0x50, 0x00, 0x7A, 0x84, 0x01, 0x5A,
+  0x8B, 0x09, 0x7C, 0x10, 0x00, 0x07, 0xC1, 0x9D,
+  /* code 0040 */
+  0xBF, 0x84, 0x19, 0x5F, 0xFF, 0xFE, 0x30, 0x00, 0x01, 0xCD, 0x20, 0x00,
+  0x5F, 0x70, 0x00, 0xAA, 0x85, 0x47, 0x5D, 0x20, 0x3C, 0x22, 0xDF, 0xBB,
+  0x22, 0xC3, 0x07, 0xA0, 0xA7, 0x07, 0xC1, 0x2C, 0x30, 0xA7, 0x2C, 0x30,
+  0x77, 0x03, 0xC2, 0x0A, 0x53, 0xC2, 0x2D, 0x51, 0xC7, 0x00, 0xA7, 0x1C,
+  0xFD, 0x6F, 0xFA, 0x00, 0x07, 0xC1, 0x89, 0x03, 0x1C, 0xC1, 0x8A, 0x06,
+  0xAF, 0xFF, 0xFD, 0x20, 0x9C,
+  /* code 0041 */
+  0xAF, 0x02, 0xAF, 0x50, 0x84, 0x03, 0x2C, 0xAA, 0x84, 0x23, 0x5C, 0x4C,
+  0x20, 0x00, 0x0A, 0x71, 0xC7, 0x00, 0x03, 0xD3, 0x07, 0xC1, 0x00, 0x7C,
+  0x10, 0x3D, 0x30, 0x1C, 0xC4, 0x13, 0x70, 0x5E, 0x30, 0x00, 0x7D, 0x2A,
+  0xA0, 0x00, 0x02, 0xD5, 0xA3,
+  /* code 0042 */
+  0xA7, 0x41, 0x1C, 0xFF, 0xFD, 0x20, 0x1C, 0x70, 0x1C, 0xA0, 0x1C, 0x70,
+  0x07, 0xC1, 0x1C, 0x70, 0x1C, 0x70, 0x1C, 0xFF, 0xFE, 0x30, 0x1C, 0x70,
+  0x05, 0xE3, 0x1C, 0x70, 0x02, 0xD5, 0x1C, 0x70, 0x05, 0xE3, 0x1C, 0xC3,
+  0x00, 0x50, 0xA0,
+  /* code 0043 */
+  0xA9, 0x10, 0x3E, 0xFF, 0xC1, 0x05, 0xE3, 0x00, 0x77, 0x2D, 0x50, 0x84,
+  0x02, 0x3C, 0x20, 0x84, 0x02, 0x5D, 0x20, 0x84, 0x02, 0x5D, 0x20, 0x84,
+  0x02, 0x2D, 0x50, 0x85, 0x09, 0x7E, 0x30, 0x07, 0x70, 0x07, 0xC2, 0x01,
+  0xC1, 0x9F,
+  /* code 0044 */
+  0xAC, 0x01, 0x1C, 0xC3, 0x48, 0x50, 0x01, 0xC7, 0x00, 0x5F, 0x70, 0x1C,
+  0x70, 0x00, 0x5D, 0x21, 0xC7, 0x00, 0x02, 0xD5, 0x1C, 0x70, 0x00, 0x2D,
+  0x51, 0xC7, 0x00, 0x02, 0xD5, 0x1C, 0x70, 0x00, 0x5D, 0x21, 0xC7, 0x00,
+  0x3E, 0x70, 0x1C, 0xFF, 0xFE, 0x30, 0xA5,
+  /* code 0045 */
+  0xA2, 0x3E, 0x1C, 0xFF, 0xFF, 0x71, 0xC5, 0x00, 0x00, 0x1C, 0x50, 0x00,
+  0x01, 0xC5, 0x00, 0x00, 0x1C, 0xFF, 0xFD, 0x21, 0xC5, 0x00, 0x00, 0x1C,
+  0x50, 0x00, 0x01, 0xC5, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0x70, 0x9B,
+  /* code 0046 */
+  0xA3, 0x00, 0xA0, 0xC3, 0x03, 0x50, 0xA7, 0x84, 0x01, 0xA7, 0x84, 0x01,
+  0xA7, 0x84, 0x08, 0xAF, 0xFF, 0xD2, 0x0A, 0x70, 0x84, 0x01, 0xA7, 0x84,
+  0x01, 0xA7, 0x84, 0x01, 0xA7, 0x9F,
+  /* code 0047 */
+  0xAE, 0x12, 0x3E, 0xFF, 0xF5, 0x00, 0x5F, 0x50, 0x02, 0xB2, 0x2D, 0x50,
+  0x85, 0x02, 0x5D, 0x20, 0x85, 0x2B, 0x5D, 0x20, 0x7F, 0xFD, 0x25, 0xD2,
+  0x00, 0x05, 0xD2, 0x2D, 0x50, 0x00, 0x5D, 0x20, 0x7F, 0x50, 0x05, 0xD2,
+  0x00, 0x3E, 0xFF, 0xF7, 0xA4,
+  /* code 0048 */
+  0xAC, 0x25, 0x1C, 0x70, 0x00, 0x7C, 0x11, 0xC7, 0x00, 0x07, 0xC1, 0x1C,
+  0x70, 0x00, 0x7C, 0x11, 0xC7, 0x00, 0x07, 0xC1, 0x1C, 0xC4, 0x25, 0xC1,
+  0x1C, 0x70, 0x00, 0x7C, 0x11, 0xC7, 0x00, 0x07, 0xC1, 0x1C, 0x70, 0x00,
+  0x7C, 0x11, 0xC7, 0x00, 0x07, 0xC1, 0xA3,
+  /* code 0049 */
+  0x94, 0x21, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00,
+  0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x90,
+  /* code 004A */
+  0x9A, 0x29, 0x7A, 0x00, 0x07, 0xA0, 0x00, 0x7A, 0x00, 0x07, 0xA0, 0x00,
+  0x7A, 0x00, 0x07, 0xA0, 0x00, 0x7A, 0x00, 0x0A, 0xA0, 0xDF, 0xD2, 0x94,
+  /* code 004B */
+  0xA8, 0x1B, 0xA7, 0x00, 0x5E, 0x30, 0xA7, 0x03, 0xE5, 0x00, 0xA7, 0x2D,
+  0x50, 0x00, 0xA8, 0xC7, 0x83, 0x03, 0xAF, 0xE3, 0x83, 0x1E, 0xA7, 0x7D,
+  0x20, 0x00, 0xA7, 0x1C, 0xA0, 0x00, 0xA7, 0x02, 0xD7, 0x00, 0xA7, 0x00,
+  0x3E, 0x50, 0x9F,
+  /* code 004C */
+  0x9D, 0x35, 0x1C, 0x50, 0x00, 0x1C, 0x50, 0x00, 0x1C, 0x50, 0x00, 0x1C,
+  0x50, 0x00, 0x1C, 0x50, 0x00, 0x1C, 0x50, 0x00, 0x1C, 0x50, 0x00, 0x1C,
+  0x50, 0x00, 0x1C, 0xFF, 0xFE, 0x97,
+  /* code 004D */
+  0xBB, 0x03, 0x1C, 0xF5, 0x83, 0x63, 0x5F, 0xC1, 0x1C, 0xCC, 0x10, 0x00,
+  0xA9, 0xC1, 0x1C, 0x6C, 0x30, 0x03, 0xC6, 0xC1, 0x1C, 0x5A, 0x70, 0x07,
+  0xA5, 0xC1, 0x1C, 0x55, 0xD2, 0x2C, 0x35, 0xC1, 0x1C, 0x52, 0xD5, 0x5C,
+  0x15, 0xC1, 0x1C, 0x50, 0x7A, 0xA7, 0x05, 0xC1, 0x1C, 0x50, 0x3E, 0xD2,
+  0x05, 0xC1, 0x1C, 0x50, 0x1C, 0xA0, 0x05, 0xC1, 0xAF,
+  /* code 004E */
+  0xB2, 0x57, 0xAF, 0x70, 0x00, 0x7A, 0x00, 0xAC, 0xD2, 0x00, 0x7A, 0x00,
+  0xA8, 0xCA, 0x00, 0x7A, 0x00, 0xA7, 0x3D, 0x30, 0x7A, 0x00, 0xA7, 0x0A,
+  0xC1, 0x7A, 0x00, 0xA7, 0x02, 0xD7, 0x7A, 0x00, 0xA7, 0x00, 0x5D, 0x9A,
+  0x00, 0xA7, 0x00, 0x1C, 0xFA, 0x00, 0xA7, 0x00, 0x03, 0xEA, 0xA8,
+  /* code 004F */
+  0xB3, 0x55, 0x3E, 0xFF, 0xF7, 0x00, 0x05, 0xF5, 0x00, 0x3E, 0x70, 0x1C,
+  0x70, 0x00, 0x05, 0xD2, 0x3D, 0x30, 0x00, 0x02, 0xC3, 0x3C, 0x20, 0x00,
+  0x02, 0xD5, 0x3D, 0x30, 0x00, 0x02, 0xC3, 0x2D, 0x50, 0x00, 0x05, 0xD2,
+  0x07, 0xE3, 0x00, 0x3E, 0x70, 0x00, 0x5F, 0xFF, 0xE3, 0xA9,
+  /* code 0050 */
+  0xA8, 0x31, 0xAF, 0xFF, 0xD2, 0x00, 0xA7, 0x00, 0x7D, 0x20, 0xA7, 0x00,
+  0x2D, 0x50, 0xA7, 0x00, 0x3D, 0x30, 0xA7, 0x00, 0xAC, 0x10, 0xAF, 0xFF,
+  0xC1, 0x00, 0xA7, 0x85, 0x01, 0xA7, 0x85, 0x01, 0xA7, 0xA4,
+  /* code 0051 */
+  0xB3, 0x14, 0x3E, 0xFF, 0xF5, 0x00, 0x05, 0xE3, 0x00, 0x3E, 0x50, 0x2D,
+  0x50, 0x83, 0x05, 0x7C, 0x13, 0xD3, 0x83, 0x05, 0x3D, 0x35, 0xD2, 0x83,
+  0x05, 0x3D, 0x33, 0xD3, 0x83, 0x05, 0x3D, 0x32, 0xD5, 0x83, 0x0F, 0x7C,
+  0x10, 0x7E, 0x30, 0x05, 0xF5, 0x00, 0x07, 0xC4, 0x01, 0xD2, 0x87, 0x01,
+  0x5F, 0x9D,
+  /* code 0052 */
+  0xA7, 0x47, 0x1C, 0xFF, 0xFD, 0x20, 0x1C, 0x70, 0x0A, 0xA0, 0x1C, 0x70,
+  0x05, 0xC1, 0x1C, 0x70, 0x1C, 0xA0, 0x1C, 0xFF, 0xF7, 0x00, 0x1C, 0x70,
+  0x5D, 0x20, 0x1C, 0x70, 0x1C, 0x70, 0x1C, 0x70, 0x05, 0xD2, 0x1C, 0x70,
+  0x02, 0xD5, 0x9F,
+  /* code 0053 */
+  0xA3, 0x0F, 0x5F, 0xFF, 0x50, 0x3E, 0x50, 0x2A, 0x13, 0xD3, 0x83, 0x03,
+  0x1C, 0xE3, 0x84, 0x03, 0xAF, 0xE3, 0x84, 0x02, 0x7E, 0x30, 0x83, 0x0F,
+  0x1C, 0x57, 0x70, 0x05, 0xE3, 0x1C, 0xFF, 0xE3, 0x9C,
+  /* code 0054 */
+  0xA2, 0x00, 0xD0, 0xC4, 0x36, 0xD0, 0x03, 0xD3, 0x00, 0x00, 0x3D, 0x30,
+  0x00, 0x03, 0xD3, 0x00, 0x00, 0x3D, 0x30, 0x00, 0x03, 0xD3, 0x00, 0x00,
+  0x3D, 0x30, 0x00, 0x03, 0xD3, 0x00, 0x00, 0x3D, 0x30, 0x9D,
+  /* code 0055 */
+  0xAC, 0x4E, 0x1C, 0x50, 0x00, 0x5C, 0x11, 0xC5, 0x00, 0x05, 0xC1, 0x1C,
+  0x50, 0x00, 0x5C, 0x11, 0xC5, 0x00, 0x05, 0xC1, 0x1C, 0x50, 0x00, 0x5C,
+  0x11, 0xC5, 0x00, 0x05, 0xC1, 0x1C, 0x70, 0x00, 0x7C, 0x10, 0x7D, 0x20,
+  0x2D, 0x50, 0x00, 0x7F, 0xFF, 0x70, 0xA5,
+  /* code 0056 */
+  0xAC, 0x45, 0x7D, 0x20, 0x00, 0x1C, 0x52, 0xD5, 0x00, 0x05, 0xD2, 0x0A,
+  0xA0, 0x00, 0xAA, 0x00, 0x5D, 0x20, 0x2D, 0x50, 0x02, 0xD5, 0x05, 0xC1,
+  0x00, 0x07, 0xA0, 0xA7, 0x00, 0x00, 0x3D, 0x5C, 0x30, 0x00, 0x01, 0xCC,
+  0xC1, 0x84, 0x02, 0x7F, 0x50, 0xA6,
+  /* code 0057 */
+  0xBF, 0x73, 0x07, 0xC1, 0x00, 0x3E, 0x50, 0x00, 0x7C, 0x3D, 0x30, 0x05,
+  0xFA, 0x00, 0x0A, 0x71, 0xC7, 0x00, 0xAA, 0xC2, 0x02, 0xC3, 0x07, 0xA0,
+  0x2C, 0x5D, 0x50, 0x5D, 0x20, 0x5D, 0x23, 0xA1, 0xA7, 0x07, 0xA0, 0x02,
+  0xD5, 0x7A, 0x05, 0xC2, 0xC5, 0x00, 0x0A, 0x7A, 0x50, 0x2C, 0x6C, 0x20,
+  0x00, 0x5D, 0xC2, 0x01, 0xCC, 0xA0, 0x00, 0x02, 0xDC, 0x10, 0x07, 0xF5,
+  0xB5,
+  /* code 0058 */
+  0xA7, 0x1D, 0x5D, 0x20, 0x03, 0xD3, 0x1C, 0xA0, 0x1C, 0x70, 0x03, 0xE5,
+  0x7D, 0x20, 0x00, 0x7D, 0xE5, 0x83, 0x03, 0x2D, 0xC1, 0x83, 0x1D, 0xAB,
+  0xD5, 0x00, 0x03, 0xD3, 0x5D, 0x20, 0x1C, 0x70, 0x1C, 0xA0, 0x7D, 0x20,
+  0x03, 0xE5, 0x9F,
+  /* code 0059 */
+  0xA2, 0x3C, 0xCA, 0x00, 0x0A, 0xA5, 0xE3, 0x03, 0xD3, 0x0A, 0xA0, 0xAA,
+  0x00, 0x3C, 0x5D, 0x30, 0x00, 0xAF, 0xA0, 0x00, 0x03, 0xC2, 0x00, 0x00,
+  0x3C, 0x20, 0x00, 0x03, 0xC2, 0x00, 0x00, 0x3C, 0x20, 0x9D,
+  /* code 005A */
+  0xA2, 0x00, 0x70, 0xC4, 0x32, 0x70, 0x00, 0x03, 0xD3, 0x00, 0x01, 0xC7,
+  0x00, 0x00, 0x7C, 0x10, 0x00, 0x3D, 0x30, 0x00, 0x1C, 0x70, 0x00, 0x07,
+  0xC1, 0x00, 0x03, 0xD3, 0x00, 0x00, 0x70, 0xC4, 0x00, 0xA0, 0x9B,
+  /* code 005B */
+  0x94, 0x3A, 0xAF, 0xD2, 0x0A, 0x70, 0x00, 0xA7, 0x00, 0x0A, 0x70, 0x00,
+  0xA7, 0x00, 0x0A, 0x70, 0x00, 0xA7, 0x00, 0x0A, 0x70, 0x00, 0xA7, 0x00,
+  0x0A, 0x70, 0x00, 0xA7, 0x00, 0x0A, 0xFD, 0x20, 0x89,
+  /* code 005C */
+  0x91, 0x4D, 0xC5, 0x00, 0x00, 0x7C, 0x10, 0x00, 0x3D, 0x30, 0x00, 0x1C,
+  0x70, 0x00, 0x05, 0xC1, 0x00, 0x02, 0xC3, 0x00, 0x00, 0xA7, 0x00, 0x00,
+  0x5C, 0x10, 0x00, 0x2D, 0x50, 0x00, 0x0A, 0xA0, 0x00, 0x05, 0xD2, 0x00,
+  0x01, 0xC5, 0x00, 0x00, 0x7A, 0x8B,
+  /* code 005D */
+  0x93, 0x3A, 0x5F, 0xE3, 0x00, 0x2C, 0x30, 0x02, 0xC3, 0x00, 0x2C, 0x30,
+  0x02, 0xC3, 0x00, 0x2C, 0x30, 0x02, 0xC3, 0x00, 0x2C, 0x30, 0x02, 0xC3,
+  0x00, 0x2C, 0x30, 0x02, 0xC3, 0x05, 0xFE, 0x30, 0x8A,
+  /* code 005E */
+  0xA4, 0x02, 0x3E, 0x70, 0x83, 0x19, 0xAA, 0xC2, 0x00, 0x3C, 0x2A, 0x70,
+  0x0A, 0xA0, 0x3C, 0x23, 0xD3, 0x01, 0xC7, 0xB7,
+  /* code 005F */
+  0xBF, 0xAF, 0x00, 0xD0, 0xC5, 0x86,
+  /* code 0060 */
+  0x8F, 0x07, 0x1C, 0x70, 0x01, 0xC5, 0xAF,
+  /* code 0061 */
+  0xB1, 0x2F, 0x3E, 0xFF, 0x50, 0x2A, 0x10, 0x7C, 0x10, 0x00, 0x03, 0xC2,
+  0x07, 0xFF, 0xFD, 0x25, 0xD2, 0x03, 0xC2, 0x5D, 0x20, 0xAD, 0x20, 0xAF,
+  0xF9, 0xB2, 0x9B,
+  /* code 0062 */
+  0x9F, 0x02, 0x1C, 0x50, 0x84, 0x02, 0x1C, 0x50, 0x84, 0x02, 0x1C, 0x50,
+  0x84, 0x36, 0x1C, 0x6D, 0xFE, 0x30, 0x1C, 0xE3, 0x07, 0xD2, 0x1C, 0x50,
+  0x02, 0xC3, 0x1C, 0x50, 0x02, 0xD5, 0x1C, 0x50, 0x02, 0xC3, 0x1C, 0xE3,
+  0x07, 0xC1, 0x1A, 0x6E, 0xFD, 0x20, 0xA0,
+  /* code 0063 */
+  0xAA, 0x28, 0x3E, 0xFF, 0x52, 0xD7, 0x02, 0xA5, 0xD2, 0x00, 0x05, 0xC1,
+  0x00, 0x05, 0xD2, 0x00, 0x02, 0xD7, 0x02, 0xA0, 0x3E, 0xFE, 0x30, 0x97,
+  /* code 0064 */
+  0xA4, 0x02, 0x5C, 0x10, 0x84, 0x02, 0x5C, 0x10, 0x84, 0x3A, 0x5C, 0x10,
+  0x3E, 0xFE, 0x8C, 0x11, 0xC7, 0x02, 0xDC, 0x13, 0xC2, 0x00, 0x5C, 0x15,
+  0xD2, 0x00, 0x5C, 0x13, 0xC2, 0x00, 0x5C, 0x12, 0xD7, 0x03, 0xEC, 0x10,
+  0x3E, 0xFD, 0x5A, 0x10, 0x9F,
+  /* code 0065 */
+  0xB8, 0x21, 0x1C, 0xFF, 0xD2, 0x00, 0xAA, 0x00, 0x7C, 0x13, 0xD3, 0x00,
+  0x2C, 0x33, 0xEF, 0xFF, 0xFE, 0x33, 0xC2, 0x84, 0x02, 0x1C, 0x70, 0x85,
+  0x06, 0x1C, 0xFF, 0xFC, 0x10, 0x9F,
+  /* code 0066 */
+  0x94, 0x2F, 0x1C, 0xFC, 0x05, 0xD2, 0x00, 0x5C, 0x10, 0x7F, 0xFF, 0xA0,
+  0x5C, 0x10, 0x05, 0xC1, 0x00, 0x5C, 0x10, 0x05, 0xC1, 0x00, 0x5C, 0x10,
+  0x05, 0xC1, 0x94,
+  /* code 0067 */
+  0xB1, 0x23, 0x5F, 0xFF, 0xFA, 0x2C, 0x30, 0x7A, 0x03, 0xC2, 0x05, 0xC1,
+  0x2C, 0x30, 0xAA, 0x03, 0xEF, 0xFD, 0x20, 0x5A, 0x85, 0x19, 0xAF, 0xFF,
+  0xC1, 0x7C, 0x10, 0x0A, 0x7A, 0xA0, 0x01, 0xC7, 0x1C, 0xFF, 0xF7, 0x87,
+  /* code 0068 */
+  0x9F, 0x02, 0x1C, 0x50, 0x84, 0x02, 0x1C, 0x50, 0x84, 0x02, 0x1C, 0x50,
+  0x84, 0x37, 0x1C, 0x6D, 0xFE, 0x30, 0x1C, 0xE3, 0x0A, 0xA0, 0x1C, 0x50,
+  0x05, 0xC1, 0x1C, 0x50, 0x05, 0xC1, 0x1C, 0x50, 0x05, 0xC1, 0x1C, 0x50,
+  0x05, 0xC1, 0x1C, 0x50, 0x05, 0xC1, 0x9F,
+  /* code 0069 */
+  0x94, 0x02, 0xAC, 0x10, 0x84, 0x19, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00,
+  0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x90,
+  /* code 006A */
+  0x94, 0x02, 0xAC, 0x10, 0x84, 0x25, 0x7A, 0x00, 0x7A, 0x00, 0x7A, 0x00,
+  0x7A, 0x00, 0x7A, 0x00, 0x7A, 0x00, 0x7A, 0x00, 0x7A, 0x00, 0xA7, 0x0E,
+  0xD2, 0x84,
+  /* code 006B */
+  0x9B, 0x45, 0x1C, 0x50, 0x00, 0x01, 0xC5, 0x00, 0x00, 0x1C, 0x50, 0x00,
+  0x01, 0xC5, 0x05, 0xE3, 0x1C, 0x55, 0xE3, 0x01, 0xC8, 0xD3, 0x00, 0x1C,
+  0xFE, 0x30, 0x01, 0xC5, 0x7C, 0x10, 0x1C, 0x51, 0xCA, 0x01, 0xC5, 0x02,
+  0xD7, 0x9B,
+  /* code 006C */
+  0x90, 0x25, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00,
+  0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x90,
+  /* code 006D */
+  0xBF, 0x93, 0x53, 0x1A, 0x5D, 0xFD, 0x3C, 0xFE, 0x30, 0x1C, 0xD2, 0x1C,
+  0xF5, 0x07, 0xC1, 0x1C, 0x50, 0x07, 0xA0, 0x05, 0xD2, 0x1C, 0x50, 0x07,
+  0xA0, 0x05, 0xD2, 0x1C, 0x50, 0x07, 0xA0, 0x05, 0xD2, 0x1C, 0x50, 0x07,
+  0xA0, 0x05, 0xD2, 0x1C, 0x50, 0x07, 0xA0, 0x05, 0xD2, 0xAF,
+  /* code 006E */
+  0xB7, 0x37, 0x1C, 0x6D, 0xFE, 0x30, 0x1C, 0xE3, 0x0A, 0xA0, 0x1C, 0x50,
+  0x05, 0xC1, 0x1C, 0x50, 0x05, 0xC1, 0x1C, 0x50, 0x05, 0xC1, 0x1C, 0x50,
+  0x05, 0xC1, 0x1C, 0x50, 0x05, 0xC1, 0x9F,
+  /* code 006F */
+  0xB8, 0x35, 0x1C, 0xFF, 0xD2, 0x01, 0xCA, 0x00, 0x7D, 0x23, 0xC2, 0x00,
+  0x2C, 0x35, 0xD2, 0x00, 0x1C, 0x53, 0xC2, 0x00, 0x2C, 0x31, 0xCA, 0x00,
+  0x7C, 0x10, 0x2D, 0xFF, 0xC1, 0xA0,
+  /* code 0070 */
+  0xB7, 0x3A, 0x1A, 0x5D, 0xFE, 0x30, 0x1C, 0xE3, 0x07, 0xD2, 0x1C, 0x50,
+  0x02, 0xC3, 0x1C, 0x50, 0x02, 0xD5, 0x1C, 0x50, 0x02, 0xC3, 0x1C, 0xE3,
+  0x07, 0xC1, 0x1C, 0x6D, 0xFD, 0x20, 0x1C, 0x50, 0x84, 0x02, 0x1C, 0x50,
+  0x84, 0x02, 0x1C, 0x50, 0x8C,
+  /* code 0071 */
+  0xB8, 0x36, 0x2D, 0xFD, 0x5A, 0x11, 0xC7, 0x02, 0xDC, 0x13, 0xC2, 0x00,
+  0x5C, 0x15, 0xD2, 0x00, 0x5C, 0x13, 0xC2, 0x00, 0x5C, 0x12, 0xD7, 0x03,
+  0xEC, 0x10, 0x3E, 0xFD, 0x6C, 0x10, 0x84, 0x02, 0x5C, 0x10, 0x84, 0x02,
+  0x5C, 0x10, 0x84, 0x02, 0x5C, 0x10, 0x87,
+  /* code 0072 */
+  0xA2, 0x20, 0x2C, 0x8F, 0xD2, 0xDD, 0x20, 0x2D, 0x50, 0x02, 0xD5, 0x00,
+  0x2D, 0x50, 0x02, 0xD5, 0x00, 0x2D, 0x50, 0x95,
+  /* code 0073 */
+  0xAA, 0x0D, 0x7F, 0xFE, 0x33, 0xC2, 0x00, 0x03, 0xE5, 0x83, 0x03, 0x3E,
+  0xF7, 0x83, 0x0D, 0x2D, 0x50, 0x00, 0x1C, 0x55, 0xFF, 0xFA, 0x98,
+  /* code 0074 */
+  0x99, 0x2B, 0x7A, 0x00, 0x07, 0xA0, 0x0C, 0xFF, 0xF7, 0x07, 0xA0, 0x00,
+  0x7A, 0x00, 0x07, 0xA0, 0x00, 0x7A, 0x00, 0x07, 0xC1, 0x00, 0x3E, 0xF7,
+  0x93,
+  /* code 0075 */
+  0xB7, 0x37, 0x1C, 0x50, 0x05, 0xC1, 0x1C, 0x50, 0x05, 0xC1, 0x1C, 0x50,
+  0x05, 0xC1, 0x1C, 0x50, 0x05, 0xC1, 0x1C, 0x50, 0x05, 0xC1, 0x0A, 0xA0,
+  0x3E, 0xC1, 0x02, 0xDF, 0xD6, 0xC1, 0x9F,
+  /* code 0076 */
+  0xB0, 0x27, 0xAA, 0x00, 0x1C, 0x75, 0xD2, 0x03, 0xD3, 0x2D, 0x50, 0x7C,
+  0x10, 0xAA, 0x1C, 0x50, 0x03, 0xC5, 0xC2, 0x00, 0x1C, 0xCA, 0x83, 0x02,
+  0x7F, 0x50, 0x9D,
+  /* code 0077 */
+  0xBF, 0x8C, 0x3F, 0x7A, 0x00, 0x5D, 0x20, 0x2D, 0x53, 0xC2, 0x06, 0xD5,
+  0x03, 0xC2, 0x2D, 0x51, 0xA6, 0x70, 0x7A, 0x00, 0xA7, 0x28, 0x3A, 0x2C,
+  0x50, 0x05, 0xC6, 0x71, 0xA5, 0xB2, 0x00, 0x2C, 0xA5, 0x0A, 0x9A, 0x83,
+  0x06, 0xAD, 0x20, 0x5F, 0x50, 0xAD,
+  /* code 0078 */
+  0xB0, 0x30, 0x3D, 0x30, 0x3D, 0x30, 0x7C, 0x2C, 0x70, 0x02, 0xDC, 0xC1,
+  0x00, 0x05, 0xF5, 0x00, 0x02, 0xC8, 0xD2, 0x00, 0xAA, 0x1C, 0xA0, 0x5D,
+  0x20, 0x3D, 0x30, 0x9B,
+  /* code 0079 */
+  0xB0, 0x42, 0xAA, 0x00, 0x1C, 0x75, 0xD2, 0x03, 0xD3, 0x2D, 0x50, 0x7A,
+  0x00, 0x7A, 0x1C, 0x50, 0x03, 0xC5, 0xC2, 0x00, 0x1C, 0xFA, 0x00, 0x00,
+  0x7F, 0x50, 0x00, 0x05, 0xD2, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x2D, 0x50,
+  0x89,
+  /* code 007A */
+  0xA9, 0x29, 0x3E, 0xFF, 0xE3, 0x00, 0x07, 0xC1, 0x00, 0x2C, 0x30, 0x00,
+  0xAA, 0x00, 0x05, 0xD2, 0x00, 0x2D, 0x50, 0x00, 0x5F, 0xFF, 0xF5, 0x97,
+  /* code 007B */
+  0x95, 0x39, 0xAF, 0x50, 0x2C, 0x30, 0x02, 0xB2, 0x00, 0x2B, 0x20, 0x05,
+  0xC1, 0x05, 0xC1, 0x00, 0x05, 0xC1, 0x00, 0x2B, 0x20, 0x02, 0xB2, 0x00,
+  0x2B, 0x20, 0x02, 0xC3, 0x00, 0x0A, 0xE3, 0x89,
+  /* code 007C */
+  0x96, 0x5D, 0x3C, 0x20, 0x00, 0x03, 0xC2, 0x00, 0x00, 0x3C, 0x20, 0x00,
+  0x03, 0xC2, 0x00, 0x00, 0x3C, 0x20, 0x00, 0x03, 0xC2, 0x00, 0x00, 0x3C,
+  0x20, 0x00, 0x03, 0xC2, 0x00, 0x00, 0x3C, 0x20, 0x00, 0x03, 0xC2, 0x00,
+  0x00, 0x3C, 0x20, 0x00, 0x03, 0xC2, 0x00, 0x00, 0x3C, 0x20, 0x00, 0x03,
+  0xC2, 0x88,
+  /* code 007D */
+  0x93, 0x17, 0x3E, 0xC1, 0x00, 0x2C, 0x30, 0x02, 0xC3, 0x00, 0x2C, 0x30,
+  0x01, 0xC5, 0x83, 0x1E, 0xA7, 0x00, 0xA7, 0x00, 0x1A, 0x30, 0x02, 0xC3,
+  0x00, 0x2C, 0x30, 0x02, 0xC3, 0x03, 0xEC, 0x10, 0x8A,
+  /* code 007E */
+  0xA2, 0x14, 0x2D, 0xF5, 0x05, 0xA7, 0x72, 0xB2, 0x77, 0xA5, 0x05, 0xFD,
+  0x20, 0xBF, 0x85
+};
+
+const aafontsCharInfo_t charTable_FontCalibri18_AA4_RLE[95] = {
+  {   3,   0, &FontFontCalibri18_AA4_RLE[    0] }, /* code 0020 */
+  {   5,   0, &FontFontCalibri18_AA4_RLE[    1] }, /* code 0021 */
+  {   6,   0, &FontFontCalibri18_AA4_RLE[   27] }, /* code 0022 */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[   42] }, /* code 0023 */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[   75] }, /* code 0024 */
+  {  11,   0, &FontFontCalibri18_AA4_RLE[  119] }, /* code 0025 */
+  {  10,   0, &FontFontCalibri18_AA4_RLE[  175] }, /* code 0026 */
+  {   3,   0, &FontFontCalibri18_AA4_RLE[  227] }, /* code 0027 */
+  {   5,   0, &FontFontCalibri18_AA4_RLE[  236] }, /* code 0028 */
+  {   5,   0, &FontFontCalibri18_AA4_RLE[  270] }, /* code 0029 */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[  305] }, /* code 002A */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[  326] }, /* code 002B */
+  {   4,   0, &FontFontCalibri18_AA4_RLE[  351] }, /* code 002C */
+  {   5,   0, &FontFontCalibri18_AA4_RLE[  361] }, /* code 002D */
+  {   4,   0, &FontFontCalibri18_AA4_RLE[  367] }, /* code 002E */
+  {   6,   0, &FontFontCalibri18_AA4_RLE[  374] }, /* code 002F */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[  412] }, /* code 0030 */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[  446] }, /* code 0031 */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[  480] }, /* code 0032 */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[  514] }, /* code 0033 */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[  547] }, /* code 0034 */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[  579] }, /* code 0035 */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[  613] }, /* code 0036 */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[  646] }, /* code 0037 */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[  679] }, /* code 0038 */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[  713] }, /* code 0039 */
+  {   4,   0, &FontFontCalibri18_AA4_RLE[  746] }, /* code 003A */
+  {   4,   0, &FontFontCalibri18_AA4_RLE[  759] }, /* code 003B */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[  775] }, /* code 003C */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[  799] }, /* code 003D */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[  812] }, /* code 003E */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[  837] }, /* code 003F */
+  {  13,   0, &FontFontCalibri18_AA4_RLE[  869] }, /* code 0040 */
+  {   9,   0, &FontFontCalibri18_AA4_RLE[  934] }, /* code 0041 */
+  {   8,   0, &FontFontCalibri18_AA4_RLE[  975] }, /* code 0042 */
+  {   8,   0, &FontFontCalibri18_AA4_RLE[ 1014] }, /* code 0043 */
+  {   9,   0, &FontFontCalibri18_AA4_RLE[ 1052] }, /* code 0044 */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[ 1095] }, /* code 0045 */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[ 1130] }, /* code 0046 */
+  {   9,   0, &FontFontCalibri18_AA4_RLE[ 1160] }, /* code 0047 */
+  {   9,   0, &FontFontCalibri18_AA4_RLE[ 1201] }, /* code 0048 */
+  {   4,   0, &FontFontCalibri18_AA4_RLE[ 1244] }, /* code 0049 */
+  {   5,   0, &FontFontCalibri18_AA4_RLE[ 1264] }, /* code 004A */
+  {   8,   0, &FontFontCalibri18_AA4_RLE[ 1288] }, /* code 004B */
+  {   6,   0, &FontFontCalibri18_AA4_RLE[ 1327] }, /* code 004C */
+  {  12,   0, &FontFontCalibri18_AA4_RLE[ 1357] }, /* code 004D */
+  {  10,   0, &FontFontCalibri18_AA4_RLE[ 1414] }, /* code 004E */
+  {  10,   0, &FontFontCalibri18_AA4_RLE[ 1461] }, /* code 004F */
+  {   8,   0, &FontFontCalibri18_AA4_RLE[ 1507] }, /* code 0050 */
+  {  10,   0, &FontFontCalibri18_AA4_RLE[ 1541] }, /* code 0051 */
+  {   8,   0, &FontFontCalibri18_AA4_RLE[ 1591] }, /* code 0052 */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[ 1630] }, /* code 0053 */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[ 1663] }, /* code 0054 */
+  {   9,   0, &FontFontCalibri18_AA4_RLE[ 1697] }, /* code 0055 */
+  {   9,   0, &FontFontCalibri18_AA4_RLE[ 1740] }, /* code 0056 */
+  {  13,   0, &FontFontCalibri18_AA4_RLE[ 1782] }, /* code 0057 */
+  {   8,   0, &FontFontCalibri18_AA4_RLE[ 1843] }, /* code 0058 */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[ 1882] }, /* code 0059 */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[ 1916] }, /* code 005A */
+  {   5,   0, &FontFontCalibri18_AA4_RLE[ 1951] }, /* code 005B */
+  {   6,   0, &FontFontCalibri18_AA4_RLE[ 1984] }, /* code 005C */
+  {   5,   0, &FontFontCalibri18_AA4_RLE[ 2026] }, /* code 005D */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[ 2059] }, /* code 005E */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[ 2079] }, /* code 005F */
+  {   4,   0, &FontFontCalibri18_AA4_RLE[ 2085] }, /* code 0060 */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[ 2092] }, /* code 0061 */
+  {   8,   0, &FontFontCalibri18_AA4_RLE[ 2119] }, /* code 0062 */
+  {   6,   0, &FontFontCalibri18_AA4_RLE[ 2162] }, /* code 0063 */
+  {   8,   0, &FontFontCalibri18_AA4_RLE[ 2186] }, /* code 0064 */
+  {   8,   0, &FontFontCalibri18_AA4_RLE[ 2227] }, /* code 0065 */
+  {   5,   0, &FontFontCalibri18_AA4_RLE[ 2257] }, /* code 0066 */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[ 2284] }, /* code 0067 */
+  {   8,   0, &FontFontCalibri18_AA4_RLE[ 2320] }, /* code 0068 */
+  {   4,   0, &FontFontCalibri18_AA4_RLE[ 2363] }, /* code 0069 */
+  {   4,   0, &FontFontCalibri18_AA4_RLE[ 2383] }, /* code 006A */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[ 2409] }, /* code 006B */
+  {   4,   0, &FontFontCalibri18_AA4_RLE[ 2447] }, /* code 006C */
+  {  12,   0, &FontFontCalibri18_AA4_RLE[ 2469] }, /* code 006D */
+  {   8,   0, &FontFontCalibri18_AA4_RLE[ 2515] }, /* code 006E */
+  {   8,   0, &FontFontCalibri18_AA4_RLE[ 2546] }, /* code 006F */
+  {   8,   0, &FontFontCalibri18_AA4_RLE[ 2576] }, /* code 0070 */
+  {   8,   0, &FontFontCalibri18_AA4_RLE[ 2617] }, /* code 0071 */
+  {   5,   0, &FontFontCalibri18_AA4_RLE[ 2660] }, /* code 0072 */
+  {   6,   0, &FontFontCalibri18_AA4_RLE[ 2680] }, /* code 0073 */
+  {   5,   0, &FontFontCalibri18_AA4_RLE[ 2703] }, /* code 0074 */
+  {   8,   0, &FontFontCalibri18_AA4_RLE[ 2728] }, /* code 0075 */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[ 2759] }, /* code 0076 */
+  {  11,   0, &FontFontCalibri18_AA4_RLE[ 2786] }, /* code 0077 */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[ 2828] }, /* code 0078 */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[ 2856] }, /* code 0079 */
+  {   6,   0, &FontFontCalibri18_AA4_RLE[ 2893] }, /* code 007A */
+  {   5,   0, &FontFontCalibri18_AA4_RLE[ 2917] }, /* code 007B */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[ 2949] }, /* code 007C */
+  {   5,   0, &FontFontCalibri18_AA4_RLE[ 2999] }, /* code 007D */
+  {   7,   0, &FontFontCalibri18_AA4_RLE[ 3032] }  /* code 007E */
+};
+
+aafontsFont_t FontCalibri18_AA4_RLE = 
+{
+  AAFONTS_FONTTYPE_AA4,                 /* Font type (anti-aliasing level) */
+  18,                                   /* Font height in pixels */
+  3,                                    /* Width to insert for unknown characters */
+  9,                                    /* Height of upper-case characters */
+  7,                                    /* Height of lower-case characters */
+  14,                                   /* Font baseline */
+  0x0020,                               /* Unicode address of first character */
+  0x007E,                               /* Unicode address of last character */
+  &charTable_FontCalibri18_AA4_RLE[0],  /* Font char data */
+  AAFONTS_ENCODING_RLE                  /* Glyph data encoding */
+};
@@ -59,6 +59,146 @@ void drawSwap(uint32_t a, uint32_t b)
   b = t;
 }
 
+/**************************************************************************/
+/*
+    Span engine used by the filled primitives
+
+    Every filled shape is broken down into horizontal spans, and each
+    pixel is written once: a span that covers a single row goes to
+    lcdDrawHLine (when the driver has a fast implementation), and a block
+    of identical rows to lcdDrawRect, both with a single address window.
+    Coordinates are signed so that shapes can extend past the edges of
+    the screen, and are clipped here.
+
+    With CFG_TFTLCD_AAEDGES, drawSetAntiAliasing can also blend the
+    curved and sloped edges with a known background color: the partly
+    covered pixel at each end of a span is drawn with colorsAlphaBlend.
+*/
+/**************************************************************************/
+
+#if CFG_TFTLCD_AAEDGES
+static bool     drawAAEnabled = false;
+static uint16_t drawAABackground;
+#endif
+
+/**************************************************************************/
+/*!
+    @brief  Fills rows y0..y1 from x0 to x1 (inclusive), clipped to the
+            screen
+*/
+/**************************************************************************/
+static void drawSpans(int32_t x0, int32_t x1, int32_t y0, int32_t y1, uint16_t color)
+{
+  int32_t width = lcdGetWidth();
+  int32_t height = lcdGetHeight();
+
+  if (x0 < 0) x0 = 0;
+  if (y0 < 0) y0 = 0;
+  if (x1 >= width) x1 = width - 1;
+  if (y1 >= height) y1 = height - 1;
+  if ((x0 > x1) || (y0 > y1)) return;
+
+  if ((y0 == y1) && lcdGetProperties().fastHLine)
+  {
+    lcdDrawHLine(x0, x1, y0, color);
+  }
+  else
+  {
+    lcdDrawRect(x0, y0, x1, y1, color);
+  }
+}
+
+#if CFG_TFTLCD_AAEDGES
+/**************************************************************************/
+/*!
+    @brief  Draws a partly covered edge pixel (coverage 0..255) blended
+            with the background color
+*/
+/**************************************************************************/
+static void drawEdgePixel(int32_t x, int32_t y, uint16_t color, uint32_t coverage)
+{
+  if ((x < 0) || (y < 0) || (coverage == 0)) return;
+  drawPixel(x, y, colorsAlphaBlend(drawAABackground, color, 100 - (coverage * 100) / 256));
+}
+#endif
+
+/**************************************************************************/
+/*!
+    @brief  Fills a rectangle with rounded (or square) corners, one span
+            per row
+
+    The corners are quarter circles of radius r centered on (xl, yt),
+    (xr, yt), (xl, yb) and (xr, yb), and the straight part in between
+    is a single block.  Corners in 'fill' but not in 'round' are square,
+    and corners in neither are left empty (the span stops at xl or xr),
+    which is what drawCornerFilled needs.
+
+    The half width w of the row at a distance d from the center of a
+    corner is the largest value with w*w + d*d <= r*r + r, the same
+    pixels as the midpoint circle algorithm, and is updated as d goes
+    down so that no square roots or divisions are needed.
+*/
+/**************************************************************************/
+static void drawRoundedSpans(int32_t xl, int32_t yt, int32_t xr, int32_t yb, int32_t r,
+                             drawCorners_t round, drawCorners_t fill, uint16_t color)
+{
+  int32_t d, w, limit, left, right;
+  bool top, bottom;
+
+  if (fill == DRAW_CORNERS_NONE) return;
+
+  // Only the corners that are drawn can be rounded
+  round &= fill;
+
+  top    = (fill & DRAW_CORNERS_TOP) != 0;
+  bottom = (fill & DRAW_CORNERS_BOTTOM) != 0;
+  limit  = r * r + r;
+  w      = 0;
+
+  for (d = r; d > 0; d--)
+  {
+    while ((w + 1) * (w + 1) + d * d <= limit)
+    {
+      w++;
+    }
+
+    if (top)
+    {
+      left  = (fill & DRAW_CORNERS_TOPLEFT)  ? ((round & DRAW_CORNERS_TOPLEFT)  ? w : r) : 0;
+      right = (fill & DRAW_CORNERS_TOPRIGHT) ? ((round & DRAW_CORNERS_TOPRIGHT) ? w : r) : 0;
+      drawSpans(xl - left, xr + right, yt - d, yt - d, color);
+      #if CFG_TFTLCD_AAEDGES
+      if (drawAAEnabled)
+      {
+        uint32_t coverage = ((limit - w * w - d * d) * 256) / (2 * w + 1);
+        if (round & DRAW_CORNERS_TOPLEFT)  drawEdgePixel(xl - w - 1, yt - d, color, coverage);
+        if (round & DRAW_CORNERS_TOPRIGHT) drawEdgePixel(xr + w + 1, yt - d, color, coverage);
+      }
+      #endif
+    }
+
+    if (bottom)
+    {
+      left  = (fill & DRAW_CORNERS_BOTTOMLEFT)  ? ((round & DRAW_CORNERS_BOTTOMLEFT)  ? w : r) : 0;
+      right = (fill & DRAW_CORNERS_BOTTOMRIGHT) ? ((round & DRAW_CORNERS_BOTTOMRIGHT) ? w : r) : 0;
+      drawSpans(xl - left, xr + right, yb + d, yb + d, color);
+      #if CFG_TFTLCD_AAEDGES
+      if (drawAAEnabled)
+      {
+        uint32_t coverage = ((limit - w * w - d * d) * 256) / (2 * w + 1);
+        if (round & DRAW_CORNERS_BOTTOMLEFT)  drawEdgePixel(xl - w - 1, yb + d, color, coverage);
+        if (round & DRAW_CORNERS_BOTTOMRIGHT) drawEdgePixel(xr + w + 1, yb + d, color, coverage);
+      }
+      #endif
+    }
+  }
+
+  // The straight part between the corners, as a single block
+  left  = (fill & DRAW_CORNERS_LEFT)  ? r : 0;
+  right = (fill & DRAW_CORNERS_RIGHT) ? r : 0;
+  drawSpans(xl - left, xr + right, yt, yb, color);
+}
+
 #if defined CFG_TFTLCD_INCLUDESMALLFONTS & CFG_TFTLCD_INCLUDESMALLFONTS == 1
 /**************************************************************************/
 /*!
@@ -144,6 +284,38 @@ void drawFill(uint16_t color)
   lcdFillRGB(color);
 }
 
+#if CFG_TFTLCD_AAEDGES
+/**************************************************************************/
+/*!
+    @brief  Enables or disables anti-aliased edges for drawCircleFilled,
+            drawCornerFilled, drawRoundedRectangleFilled and
+            drawTriangleFilled
+
+    @param[in]  enable
+                True to blend the edge pixels with bgColor
+    @param[in]  bgColor
+                The color behind the shapes that will be drawn
+
+    @section EXAMPLE
+
+    @code
+
+    drawFill(COLOR_WHITE);
+    drawSetAntiAliasing(true, COLOR_WHITE);
+    drawCircleFilled(80, 80, 40, COLOR_BLUE);
+    drawSetAntiAliasing(false, 0);
+
+    @endcode
+*/
+/**************************************************************************/
+void drawSetAntiAliasing(bool enable, uint16_t bgColor)
+{
+  drawAAEnabled = enable;
+  drawAABackground = bgColor;
+}
+
+#endif
+
 /**************************************************************************/
 /*!
     @brief  Draws a simple color test pattern
@@ -408,42 +580,9 @@ void drawCircle (uint16_t xCenter, uint16_t yCenter, uint16_t radius, uint16_t c
 /**************************************************************************/
 void drawCircleFilled (uint16_t xCenter, uint16_t yCenter, uint16_t radius, uint16_t color)
 {
-  int16_t f = 1 - radius;
-  int16_t ddF_x = 1;
-  int16_t ddF_y = -2 * radius;
-  int16_t x = 0;
-  int16_t y = radius;
-  int16_t xc_px, yc_my, xc_mx, xc_py, yc_mx, xc_my;
-  int16_t lcdWidth = lcdGetWidth();
-
-  if (xCenter < lcdWidth) drawLine(xCenter, yCenter-radius < 0 ? 0 : yCenter-radius, xCenter, (yCenter-radius) + (2*radius), color);
-
-  while (x<y)
-  {
-    if (f >= 0)
-    {
-      y--;
-      ddF_y += 2;
-      f += ddF_y;
-    }
-    x++;
-    ddF_x += 2;
-    f += ddF_x;
-
-    xc_px = xCenter+x;
-    xc_mx = xCenter-x;
-    xc_py = xCenter+y;
-    xc_my = xCenter-y;
-    yc_mx = yCenter-x;
-    yc_my = yCenter-y;
-
-    // Make sure X positions are not negative or too large or the pixels will
-    // overflow.  Y overflow is handled in drawLine().
-    if ((xc_px < lcdWidth) && (xc_px >= 0)) drawLine(xc_px, yc_my, xc_px, yc_my + 2*y, color);
-    if ((xc_mx < lcdWidth) && (xc_mx >= 0)) drawLine(xc_mx, yc_my, xc_mx, yc_my + 2*y, color);
-    if ((xc_py < lcdWidth) && (xc_py >= 0)) drawLine(xc_py, yc_mx, xc_py, yc_mx + 2*x, color);
-    if ((xc_my < lcdWidth) && (xc_my >= 0)) drawLine(xc_my, yc_mx, xc_my, yc_mx + 2*x, color);
-  }
+  // One span per row, with the same pixels as the midpoint circle
+  drawRoundedSpans(xCenter, yCenter, xCenter, yCenter, radius,
+                   DRAW_CORNERS_ALL, DRAW_CORNERS_ALL, color);
 }
 
 /**************************************************************************/
@@ -535,65 +674,8 @@ void drawCorner (uint16_t xCenter, uint16_t yCenter, uint16_t r, drawCorners_t c
 /**************************************************************************/
 void drawCornerFilled (uint16_t xCenter, uint16_t yCenter, uint16_t radius, drawCorners_t position, uint16_t color)
 {
-  int16_t f = 1 - radius;
-  int16_t ddF_x = 1;
-  int16_t ddF_y = -2 * radius;
-  int16_t x = 0;
-  int16_t y = radius;
-  int16_t xc_px, yc_my, xc_mx, xc_py, yc_mx, xc_my;
-  int16_t lcdWidth = lcdGetWidth();
-
-
-  if ((position & DRAW_CORNERS_TOPRIGHT) || (position & DRAW_CORNERS_TOPLEFT))
-  {
-    if (xCenter < lcdWidth) drawLine(xCenter, yCenter-radius < 0 ? 0 : yCenter-radius, xCenter, yCenter, color);
-  }
-  if ((position & DRAW_CORNERS_BOTTOMRIGHT) || (position & DRAW_CORNERS_BOTTOMLEFT))
-  {
-    if (xCenter < lcdWidth) drawLine(xCenter, yCenter-radius < 0 ? 0 : yCenter, xCenter, (yCenter-radius) + (2*radius), color);
-  }
-
-  while (x<y)
-  {
-    if (f >= 0)
-    {
-      y--;
-      ddF_y += 2;
-      f += ddF_y;
-    }
-    x++;
-    ddF_x += 2;
-    f += ddF_x;
-
-    xc_px = xCenter+x;
-    xc_mx = xCenter-x;
-    xc_py = xCenter+y;
-    xc_my = xCenter-y;
-    yc_mx = yCenter-x;
-    yc_my = yCenter-y;
-
-
-    if (position & DRAW_CORNERS_TOPRIGHT)
-    {
-        if ((xc_px < lcdWidth) && (xc_px >= 0)) drawLine(xc_px, yc_my, xc_px, yCenter, color);
-        if ((xc_py < lcdWidth) && (xc_py >= 0)) drawLine(xc_py, yc_mx, xc_py, yCenter, color);
-    }
-    if (position & DRAW_CORNERS_BOTTOMRIGHT)
-    {
-        if ((xc_px < lcdWidth) && (xc_px >= 0)) drawLine(xc_px, yCenter, xc_px, yc_my + 2*y, color);
-        if ((xc_py < lcdWidth) && (xc_py >= 0)) drawLine(xc_py, yCenter, xc_py, yc_mx + 2*x, color);
-    }
-    if (position & DRAW_CORNERS_TOPLEFT)
-    {
-        if ((xc_mx < lcdWidth) && (xc_mx >= 0)) drawLine(xc_mx, yc_my, xc_mx, yCenter, color);
-        if ((xc_my < lcdWidth) && (xc_my >= 0)) drawLine(xc_my, yc_mx, xc_my, yCenter, color);
-    }
-    if (position & DRAW_CORNERS_BOTTOMLEFT)
-    {
-        if ((xc_mx < lcdWidth) && (xc_mx >= 0)) drawLine(xc_mx, yCenter, xc_mx, yc_my + 2*y, color);
-        if ((xc_my < lcdWidth) && (xc_my >= 0)) drawLine(xc_my, yCenter, xc_my, yc_mx + 2*x, color);
-    }
-  }
+  drawRoundedSpans(xCenter, yCenter, xCenter, yCenter, radius,
+                   position, position, color);
 }
 
 /**************************************************************************/
@@ -713,30 +795,8 @@ void drawRectangle ( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_
 /**************************************************************************/
 void drawRectangleFilled ( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
 {
-  int height;
-  uint16_t x, y;
-
-  if (y1 < y0)
-  {
-    // Switch y1 and y0
-    y = y1;
-    y1 = y0;
-    y0 = y;
-  }
-
-  if (x1 < x0)
-  {
-    // Switch x1 and x0
-    x = x1;
-    x1 = x0;
-    x0 = x;
-  }
-
-  height = y1 - y0;
-  for (height = y0; y1 > height - 1; ++height)
-  {
-    drawLine(x0, height, x1, height, color);
-  }
+  // The LCD driver fills the whole rectangle with a single window
+  lcdDrawRect(x0, y0, x1, y1, color);
 }
 
 /**************************************************************************/
@@ -874,80 +934,48 @@ void drawRoundedRectangle ( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
 /**************************************************************************/
 void drawRoundedRectangleFilled ( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color, uint16_t radius, drawCorners_t corners )
 {
-  int height;
-  uint16_t y;
+  uint16_t t, height, width;
 
-  if (corners == DRAW_CORNERS_NONE)
+  if ((corners == DRAW_CORNERS_NONE) || (radius == 0))
   {
     drawRectangleFilled(x0, y0, x1, y1, color);
     return;
   }
 
-  // Calculate height
   if (y1 < y0)
   {
-    y = y1;
+    t = y1;
     y1 = y0;
-    y0 = y;
+    y0 = t;
+  }
+  if (x1 < x0)
+  {
+    t = x1;
+    x1 = x0;
+    x0 = t;
   }
   height = y1 - y0;
+  width = x1 - x0;
 
   // Check radius
   if (radius > height / 2)
   {
     radius = height / 2;
   }
-  radius -= 1;
-
-  // Draw body
-  drawRectangleFilled(x0 + radius, y0, x1 - radius, y1, color);
-
-  switch (corners)
+  if (radius > width / 2)
   {
-    case DRAW_CORNERS_ALL:
-      drawCornerFilled(x0 + radius, y0 + radius, radius, DRAW_CORNERS_TOPLEFT, color);
-      drawCornerFilled(x1 - radius, y0 + radius, radius, DRAW_CORNERS_TOPRIGHT, color);
-      drawCornerFilled(x0 + radius, y1 - radius, radius, DRAW_CORNERS_BOTTOMLEFT, color);
-      drawCornerFilled(x1 - radius, y1 - radius, radius, DRAW_CORNERS_BOTTOMRIGHT, color);
-      if (radius*2+1 < height)
-      {
-        drawRectangleFilled(x0, y0 + radius, x0 + radius, y1 - radius, color);
-        drawRectangleFilled(x1 - radius, y0 + radius, x1, y1 - radius, color);
-      }
-      break;
-    case DRAW_CORNERS_TOP:
-      drawCornerFilled(x0 + radius, y0 + radius, radius, DRAW_CORNERS_TOPLEFT, color);
-      drawCornerFilled(x1 - radius, y0 + radius, radius, DRAW_CORNERS_TOPRIGHT, color);
-      drawRectangleFilled(x0, y0 + radius, x0 + radius, y1, color);
-      drawRectangleFilled(x1 - radius, y0 + radius, x1, y1, color);
-      break;
-    case DRAW_CORNERS_BOTTOM:
-      drawCornerFilled(x0 + radius, y1 - radius, radius, DRAW_CORNERS_BOTTOMLEFT, color);
-      drawCornerFilled(x1 - radius, y1 - radius, radius, DRAW_CORNERS_BOTTOMRIGHT, color);
-      drawRectangleFilled(x0, y0, x0 + radius, y1 - radius, color);
-      drawRectangleFilled(x1 - radius, y0, x1, y1 - radius, color);
-      break;
-    case DRAW_CORNERS_LEFT:
-      drawCornerFilled(x0 + radius, y0 + radius, radius, DRAW_CORNERS_TOPLEFT, color);
-      drawCornerFilled(x0 + radius, y1 - radius, radius, DRAW_CORNERS_BOTTOMLEFT, color);
-      if (radius*2+1 < height)
-      {
-        drawRectangleFilled(x0, y0 + radius, x0 + radius, y1 - radius, color);
-      }
-      drawRectangleFilled(x1 - radius, y0, x1, y1, color);
-      break;
-    case DRAW_CORNERS_RIGHT:
-      drawCornerFilled(x1 - radius, y0 + radius, radius, DRAW_CORNERS_TOPRIGHT, color);
-      drawCornerFilled(x1 - radius, y1 - radius, radius, DRAW_CORNERS_BOTTOMRIGHT, color);
-      if (radius*2+1 < height)
-      {
-        drawRectangleFilled(x1 - radius, y0 + radius, x1, y1 - radius, color);
-      }
-      drawRectangleFilled(x0, y0, x0 + radius, y1, color);
-      break;
-    default:
-      break;
+    radius = width / 2;
+  }
+  if (radius == 0)
+  {
+    drawRectangleFilled(x0, y0, x1, y1, color);
+    return;
   }
+  radius -= 1;
+
+  // The corners that aren't rounded are square
+  drawRoundedSpans(x0 + radius, y0 + radius, x1 - radius, y1 - radius, radius,
+                   corners, DRAW_CORNERS_ALL, color);
 }
 
 /**************************************************************************/
@@ -993,7 +1021,7 @@ void drawRoundedRectangleFilled ( uint16_t x0, uint16_t y0, uint16_t x1, uint16_
     // Center text vertically and horizontally
     fntY = btnY + ((btnHeight - DejaVuSansCondensed14_AA2.fontHeight) / 2);
     fntX = btnX + ((btnWidth - aafontsGetStringWidth(&DejaVuSansCondensed14_AA2, "Click to continue"))/2);
-    aafontsDrawString(fntX, fntY, COLORTABLE_AA2_BLACKONWHITE, &DejaVuSansCondensed14_AA2, "Click to continue");
+    aafontsDrawStringTransparent(fntX, fntY, COLORTABLE_AA2_BLACKONWHITE, &DejaVuSansCondensed14_AA2, "Click to continue");
 
     @endcode
 */
@@ -1110,57 +1138,61 @@ void drawTriangle ( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t
 /**************************************************************************/
 void drawTriangleFilled ( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color)
 {
-  // Re-order vertices by ascending Y values (smallest first)
-  if (y0 > y1) {
-    drawSwap(y0, y1); drawSwap(x0, x1);
-  }
-  if (y1 > y2) {
-    drawSwap(y2, y1); drawSwap(x2, x1);
-  }
-  if (y0 > y1) {
-    drawSwap(y0, y1); drawSwap(x0, x1);
-  }
+  int32_t xa, xb, dxa, dxb, y, t;
+  int32_t xmin, xmax;
 
-  int32_t dx1, dx2, dx3;    // Interpolation deltas
-  int32_t sx1, sx2, sy;     // Scanline co-ordinates
+  // Sort the vertices by ascending Y values (smallest first)
+  if (y0 > y1) { t = y0; y0 = y1; y1 = t; t = x0; x0 = x1; x1 = t; }
+  if (y1 > y2) { t = y1; y1 = y2; y2 = t; t = x1; x1 = x2; x2 = t; }
+  if (y0 > y1) { t = y0; y0 = y1; y1 = t; t = x0; x0 = x1; x1 = t; }
 
-  sx1=sx2=x0 * 1000;        // Use fixed point math for x axis values
-  sy=y0;
+  // Flat triangle: a single span
+  if (y0 == y2)
+  {
+    xmin = x0 < x1 ? (x0 < x2 ? x0 : x2) : (x1 < x2 ? x1 : x2);
+    xmax = x0 > x1 ? (x0 > x2 ? x0 : x2) : (x1 > x2 ? x1 : x2);
+    drawSpans(xmin, xmax, y0, y0, color);
+    return;
+  }
 
-  // Calculate interpolation deltas
-  if (y1-y0 > 0) dx1=((x1-x0)*1000)/(y1-y0);
-    else dx1=0;
-  if (y2-y0 > 0) dx2=((x2-x0)*1000)/(y2-y0);
-    else dx2=0;
-  if (y2-y1 > 0) dx3=((x2-x1)*1000)/(y2-y1);
-    else dx3=0;
+  // Edge positions in 16.16 fixed point: xa follows the long edge (0 to
+  // 2) and xb the two short edges (0 to 1, then 1 to 2), so every row is
+  // a single span between them
+  dxa = ((int32_t)(x2 - x0) << 16) / (y2 - y0);
+  dxb = (y1 > y0) ? ((int32_t)(x1 - x0) << 16) / (y1 - y0) : 0;
+  xa = (int32_t) x0 << 16;
+  xb = (y1 > y0) ? (int32_t) x0 << 16 : (int32_t) x1 << 16;
 
-  // Render scanlines (horizontal lines are the fastest rendering method)
-  if (dx1 > dx2)
+  for (y = y0; y <= y2; y++)
   {
-    for(; sy<=y1; sy++, sx1+=dx2, sx2+=dx1)
-    {
-      drawLine(sx1/1000, sy, sx2/1000, sy, color);
-    }
-    sx2 = x1*1000;
-    sy = y1;
-    for(; sy<=y2; sy++, sx1+=dx2, sx2+=dx3)
+    if (y == y1)
     {
-      drawLine(sx1/1000, sy, sx2/1000, sy, color);
+      // Second short edge
+      xb = (int32_t) x1 << 16;
+      dxb = (y2 > y1) ? ((int32_t)(x2 - x1) << 16) / (y2 - y1) : 0;
     }
-  }
-  else
-  {
-    for(; sy<=y1; sy++, sx1+=dx1, sx2+=dx2)
+
+    xmin = xa < xb ? xa : xb;
+    xmax = xa < xb ? xb : xa;
+
+    #if CFG_TFTLCD_AAEDGES
+    if (drawAAEnabled)
     {
-      drawLine(sx1/1000, sy, sx2/1000, sy, color);
+      // Solid pixels between the edges, and the partly covered pixel at
+      // each end blended with the background
+      drawSpans((xmin + 0xFFFF) >> 16, xmax >> 16, y, y, color);
+      if (xmin & 0xFFFF) drawEdgePixel(xmin >> 16, y, color, (0x10000 - (xmin & 0xFFFF)) >> 8);
+      if (xmax & 0xFFFF) drawEdgePixel((xmax >> 16) + 1, y, color, (xmax & 0xFFFF) >> 8);
     }
-    sx1 = x1*1000;
-    sy = y1;
-    for(; sy<=y2; sy++, sx1+=dx3, sx2+=dx2)
+    else
+    #endif
     {
-      drawLine(sx1/1000, sy, sx2/1000, sy, color);
+      // Round to the nearest pixel
+      drawSpans((xmin + 0x8000) >> 16, (xmax + 0x8000) >> 16, y, y, color);
     }
+
+    xa += dxa;
+    xb += dxb;
   }
 }
 
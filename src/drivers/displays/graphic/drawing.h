@@ -96,6 +96,10 @@ void      drawTriangle         ( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t
 void      drawTriangleFilled   ( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color );
 void      drawIcon16           ( uint16_t x, uint16_t y, uint16_t color, uint16_t icon[] );
 
+#if CFG_TFTLCD_AAEDGES
+void      drawSetAntiAliasing  ( bool enable, uint16_t bgColor );
+#endif
+
 #if CFG_TFTLCD_INCLUDESMALLFONTS
 void      drawStringSmall      ( uint16_t x, uint16_t y, uint16_t color, char* text, struct FONT_DEF font );
 #endif
@@ -51,6 +51,10 @@ static lcdProperties_t hx8340bProperties = { 176, 220, false, false, false, true
 /* Private Methods                               */
 /*************************************************/
 
+// The host builds (tests_host/bench/lcdmock.c) provide their own
+// hx8340bWriteCmd and hx8340bWriteData, which decode the commands instead
+// of driving the GPIO pins
+#ifndef _TEST_
 /*************************************************/
 void hx8340bWriteCmd(uint8_t command)
 {
@@ -110,6 +114,10 @@ void hx8340bWriteData(uint8_t data)
   }
   SET_CS;
 }
+#else
+void hx8340bWriteCmd(uint8_t command);
+void hx8340bWriteData(uint8_t data);
+#endif
 
 /*************************************************/
 void hx8340bWriteData16(uint16_t data)
@@ -307,10 +315,12 @@ void lcdTest(void)
   lcdFillRGB(COLOR_GREEN);
 }
 
+#ifndef CFG_TFTLCD_FRAMEBUFFER
 /*************************************************/
 void lcdFillRGB(uint16_t color)
 {
   uint8_t i,j;
+  hx8340bSetPosition(0, 0, 175, 219);
   for (i=0;i<220;i++)
   {
     for (j=0;j<176;j++)
@@ -335,13 +345,15 @@ void lcdDrawPixel(uint16_t x, uint16_t y, uint16_t color)
 /**************************************************************************/
 void lcdDrawPixels(uint16_t x, uint16_t y, uint16_t *data, uint32_t len)
 {
-  // ToDo: Optimise this function ... currently only a placeholder
-  uint32_t i = 0;
-  do
+  if ((x >= lcdGetWidth()) || (y >= lcdGetHeight()) || (len == 0)) return;
+  if (x + len > lcdGetWidth())
   {
-    lcdDrawPixel(x+i, y, data[i]);
-    i++;
-  } while (i<len);
+    len = lcdGetWidth() - x;
+  }
+
+  // One window for the whole row, then a burst of pixel data
+  hx8340bSetPosition(x, y, x + len - 1, y);
+  lcdStreamPixels(data, len);
 }
 
 /*************************************************/
@@ -378,8 +390,7 @@ void lcdDrawHLine(uint16_t x0, uint16_t x1, uint16_t y, uint16_t color)
 /*************************************************/
 void lcdDrawVLine(uint16_t x, uint16_t y0, uint16_t y1, uint16_t color)
 {
-  // Allows for slightly better performance than setting individual pixels
-  uint16_t y, pixels;
+  uint16_t y;
 
   if (y1 < y0)
   {
@@ -390,19 +401,73 @@ void lcdDrawVLine(uint16_t x, uint16_t y0, uint16_t y1, uint16_t color)
   }
 
   // Check limits
+  if ((x >= lcdGetWidth()) || (y0 >= lcdGetHeight())) return;
   if (y1 >= lcdGetHeight())
   {
     y1 = lcdGetHeight() - 1;
   }
-  if (y0 >= lcdGetHeight())
+
+  // A one column window, so the controller moves down after each pixel
+  hx8340bSetPosition(x, y0, x, y1);
+  lcdStreamColor(color, y1 - y0 + 1);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Fills a rectangle (inclusive coordinates) with a single window
+*/
+/**************************************************************************/
+void lcdDrawRect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+{
+  uint16_t t;
+
+  if (x1 < x0)
+  {
+    t = x1;
+    x1 = x0;
+    x0 = t;
+  }
+  if (y1 < y0)
   {
-    y0 = lcdGetHeight() - 1;
+    t = y1;
+    y1 = y0;
+    y0 = t;
   }
 
-  for (pixels = 0; pixels < y1 - y0 + 1; pixels++)
+  // Check limits
+  if ((x0 >= lcdGetWidth()) || (y0 >= lcdGetHeight())) return;
+  if (x1 >= lcdGetWidth())
   {
-    hx8340bSetPosition(x, y0+pixels, x+1, y0+pixels+1);
-    hx8340bWriteData16(color);
+    x1 = lcdGetWidth() - 1;
+  }
+  if (y1 >= lcdGetHeight())
+  {
+    y1 = lcdGetHeight() - 1;
+  }
+
+  hx8340bSetPosition(x0, y0, x1, y1);
+  lcdStreamColor(color, (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1));
+}
+
+/**************************************************************************/
+/*!
+    @brief  Copies a width x height block of RGB565 pixels (row by row)
+            to the LCD, clipped to the screen
+*/
+/**************************************************************************/
+void lcdBlit(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t *data)
+{
+  uint16_t w, h, row;
+
+  if ((x >= lcdGetWidth()) || (y >= lcdGetHeight()) || (width == 0) || (height == 0)) return;
+
+  w = (x + width > lcdGetWidth()) ? lcdGetWidth() - x : width;
+  h = (y + height > lcdGetHeight()) ? lcdGetHeight() - y : height;
+
+  hx8340bSetPosition(x, y, x + w - 1, y + h - 1);
+  for (row = 0; row < h; row++)
+  {
+    lcdStreamPixels(data + (uint32_t) row * width, w);
   }
 }
 
@@ -412,6 +477,31 @@ uint16_t lcdGetPixel(uint16_t x, uint16_t y)
   // ToDo
   return 0;
 }
+#endif
+
+/*************************************************/
+void lcdSetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+  hx8340bSetPosition(x0, y0, x1, y1);
+}
+
+/*************************************************/
+void lcdStreamPixels(const uint16_t *data, uint32_t len)
+{
+  while (len--)
+  {
+    hx8340bWriteData16(*data++);
+  }
+}
+
+/*************************************************/
+void lcdStreamColor(uint16_t color, uint32_t len)
+{
+  while (len--)
+  {
+    hx8340bWriteData16(color);
+  }
+}
 
 /*************************************************/
 void lcdSetOrientation(lcdOrientation_t orientation)
@@ -46,6 +46,9 @@
 
 static volatile lcdOrientation_t lcdOrientation = LCD_ORIENTATION_PORTRAIT;
 
+// Set when the GRAM window is smaller than the screen (see hx8347gSetWindow)
+static bool hx8347gWindowed = false;
+
 // Screen/Driver Properties
 static lcdProperties_t hx8347gProperties = {  240,      // Screen width
                                               320,      // Screen height
@@ -53,7 +56,7 @@ static lcdProperties_t hx8347gProperties = {  240,      // Screen width
                                               false,    // Allows orientation changes?
                                               false,    // Supports HW scrolling?
                                               true,     // Driver includes fast horizontal line function?
-                                              false };  // Driver includes fast vertical line function?
+                                              true };   // Driver includes fast vertical line function?
 
 // Initialisation sequence (Ugly here but saves a bit of code space handled like this)
 static const uint8_t HX8347G_InitSequence[] = {
@@ -117,6 +120,10 @@ void hx8347gDelay(unsigned int t)
   }
 }
 
+// The host builds (tests_host/bench/lcdmock.c) provide their own bus
+// functions, which decode the register writes instead of driving the
+// GPIO pins
+#ifndef _TEST_
 /**************************************************************************/
 /*! 
     @brief  Sends an 8-bit command + 8-bits data
@@ -241,6 +248,13 @@ uint16_t hx8347gReadData(void)
 
   return (uint16_t)((high << 8) | (low));
 }
+#else
+void     hx8347gWriteRegister(uint8_t command, uint8_t data);
+void     hx8347gWriteCommand(const uint8_t command);
+void     hx8347gWriteData(const uint16_t data);
+uint16_t hx8347gReadRegister(uint8_t command);
+uint16_t hx8347gReadData(void);
+#endif
 
 /**************************************************************************/
 /*! 
@@ -249,6 +263,16 @@ uint16_t hx8347gReadData(void)
 /**************************************************************************/
 void hx8347gSetCursor(const uint16_t x, const uint16_t y)
 {
+  // The drawing functions below expect the window to cover the screen
+  if (hx8347gWindowed)
+  {
+    hx8347gWriteRegister(HX8347G_CMD_COLADDREND2, (hx8347gProperties.width - 1) >> 8);
+    hx8347gWriteRegister(HX8347G_CMD_COLADDREND1, hx8347gProperties.width - 1);
+    hx8347gWriteRegister(HX8347G_CMD_ROWADDREND2, (hx8347gProperties.height - 1) >> 8);
+    hx8347gWriteRegister(HX8347G_CMD_ROWADDREND1, hx8347gProperties.height - 1);
+    hx8347gWindowed = false;
+  }
+
   hx8347gWriteRegister(HX8347G_CMD_COLADDRSTART2, x>>8);
   hx8347gWriteRegister(HX8347G_CMD_COLADDRSTART1, x);
   hx8347gWriteRegister(HX8347G_CMD_ROWADDRSTART2, y>>8);
@@ -302,7 +326,16 @@ void hx8347gInitDisplay(void)
 /**************************************************************************/
 void hx8347gSetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
 {
-  // ToDo
+  hx8347gWriteRegister(HX8347G_CMD_COLADDRSTART2, x0>>8);
+  hx8347gWriteRegister(HX8347G_CMD_COLADDRSTART1, x0);
+  hx8347gWriteRegister(HX8347G_CMD_COLADDREND2, x1>>8);
+  hx8347gWriteRegister(HX8347G_CMD_COLADDREND1, x1);
+  hx8347gWriteRegister(HX8347G_CMD_ROWADDRSTART2, y0>>8);
+  hx8347gWriteRegister(HX8347G_CMD_ROWADDRSTART1, y0);
+  hx8347gWriteRegister(HX8347G_CMD_ROWADDREND2, y1>>8);
+  hx8347gWriteRegister(HX8347G_CMD_ROWADDREND1, y1);
+
+  hx8347gWindowed = true;
 }
 
 /*************************************************/
@@ -323,7 +356,7 @@ void lcdInit(void)
   LPC_GPIO->DIR[HX8347G_CONTROL_PORT] |=  (1 << HX8347G_RD_PIN);
   
   // Set data port pins to output
-  LPC_GPIO->DIR[HX8347G_DATA_PORT] |=  (1 << HX8347G_DATA_MASK);
+  LPC_GPIO->DIR[HX8347G_DATA_PORT] |=  HX8347G_DATA_MASK;
 
   // Set backlight pin to output and turn it on
   LPC_GPIO->DIR[HX8347G_BL_PORT] |=  (1 << HX8347G_BL_PIN);
@@ -378,6 +411,7 @@ void lcdTest(void)
 {
 }
 
+#ifndef CFG_TFTLCD_FRAMEBUFFER
 /**************************************************************************/
 /*! 
     @brief  Fills the LCD with the specified 16-bit color
@@ -420,6 +454,15 @@ void lcdDrawPixel(uint16_t x, uint16_t y, uint16_t color)
 /**************************************************************************/
 void lcdDrawPixels(uint16_t x, uint16_t y, uint16_t *data, uint32_t len)
 {
+  if ((x >= lcdGetWidth()) || (y >= lcdGetHeight()) || (len == 0)) return;
+  if (x + len > lcdGetWidth())
+  {
+    len = lcdGetWidth() - x;
+  }
+
+  // One window for the whole row, then a burst of pixel data
+  lcdSetWindow(x, y, x + len - 1, y);
+  lcdStreamPixels(data, len);
 }
 
 /**************************************************************************/
@@ -468,6 +511,85 @@ void lcdDrawHLine(uint16_t x0, uint16_t x1, uint16_t y, uint16_t color)
 /**************************************************************************/
 void lcdDrawVLine(uint16_t x, uint16_t y0, uint16_t y1, uint16_t color)
 {
+  uint16_t y;
+
+  if (y1 < y0)
+  {
+    // Switch y1 and y0
+    y = y1;
+    y1 = y0;
+    y0 = y;
+  }
+
+  // Check limits
+  if ((x >= lcdGetWidth()) || (y0 >= lcdGetHeight())) return;
+  if (y1 >= lcdGetHeight())
+  {
+    y1 = lcdGetHeight() - 1;
+  }
+
+  // A one column window, so the controller moves down after each pixel
+  lcdSetWindow(x, y0, x, y1);
+  lcdStreamColor(color, y1 - y0 + 1);
+}
+
+/**************************************************************************/
+/*! 
+    @brief  Fills a rectangle (inclusive coordinates) with a single window
+*/
+/**************************************************************************/
+void lcdDrawRect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+{
+  uint16_t t;
+
+  if (x1 < x0)
+  {
+    t = x1;
+    x1 = x0;
+    x0 = t;
+  }
+  if (y1 < y0)
+  {
+    t = y1;
+    y1 = y0;
+    y0 = t;
+  }
+
+  // Check limits
+  if ((x0 >= lcdGetWidth()) || (y0 >= lcdGetHeight())) return;
+  if (x1 >= lcdGetWidth())
+  {
+    x1 = lcdGetWidth() - 1;
+  }
+  if (y1 >= lcdGetHeight())
+  {
+    y1 = lcdGetHeight() - 1;
+  }
+
+  lcdSetWindow(x0, y0, x1, y1);
+  lcdStreamColor(color, (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1));
+}
+
+/**************************************************************************/
+/*! 
+    @brief  Copies a width x height block of RGB565 pixels (row by row)
+            to the LCD, clipped to the screen
+*/
+/**************************************************************************/
+void lcdBlit(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t *data)
+{
+  uint16_t w, h, row;
+
+  if ((x >= lcdGetWidth()) || (y >= lcdGetHeight()) || (width == 0) || (height == 0)) return;
+
+  w = (x + width > lcdGetWidth()) ? lcdGetWidth() - x : width;
+  h = (y + height > lcdGetHeight()) ? lcdGetHeight() - y : height;
+
+  lcdSetWindow(x, y, x + w - 1, y + h - 1);
+  for (row = 0; row < h; row++)
+  {
+    lcdStreamPixels(data + (uint32_t) row * width, w);
+  }
 }
 
 /**************************************************************************/
@@ -492,6 +614,45 @@ uint16_t lcdGetPixel(uint16_t x, uint16_t y)
   return hx8347gReadData();
 }
 
+#endif
+
+/**************************************************************************/
+/*! 
+    @brief  Selects a window in GRAM and starts writing to it
+*/
+/**************************************************************************/
+void lcdSetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+  hx8347gSetWindow(x0, y0, x1, y1);
+  hx8347gWriteCommand(HX8347G_CMD_SRAMWRITECONTROL);
+}
+
+/**************************************************************************/
+/*! 
+    @brief  Writes pixels into the current window
+*/
+/**************************************************************************/
+void lcdStreamPixels(const uint16_t *data, uint32_t len)
+{
+  while (len--)
+  {
+    hx8347gWriteData(*data++);
+  }
+}
+
+/**************************************************************************/
+/*! 
+    @brief  Writes the same color len times into the current window
+*/
+/**************************************************************************/
+void lcdStreamColor(uint16_t color, uint32_t len)
+{
+  while (len--)
+  {
+    hx8347gWriteData(color);
+  }
+}
+
 /**************************************************************************/
 /*! 
     @brief  Sets the LCD orientation to horizontal and vertical
@@ -508,6 +669,7 @@ void lcdSetOrientation(lcdOrientation_t orientation)
 /**************************************************************************/
 lcdOrientation_t lcdGetOrientation(void)
 {
+  return lcdOrientation;
 }
 
 /**************************************************************************/
@@ -0,0 +1,535 @@
+/**************************************************************************/
+/*!
+    @file     simlcd.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section  DESCRIPTION
+
+    Memory-backed LCD driver for the host builds (tests_host).
+
+    This driver implements the lcd.h API on an RGB565 array in RAM that
+    behaves like the GRAM of a real controller: every primitive sets one
+    window and streams its pixels into it, exactly as the HW drivers do,
+    so the pixels and windows counted here are what a panel would have
+    received.  simlcdFlush marks the end of a frame, and can write every
+    frame to a PPM file, which lets the rendering code be checked (and
+    its cost measured) without the hardware.
+
+    When CFG_TFTLCD_FRAMEBUFFER is defined the drawing functions come
+    from lcdfb.c, as with the HW drivers, and only reach this driver
+    through lcdSetWindow and the stream functions.
+
+    This file uses stdio and is never part of the firmware build.
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <stdio.h>
+#include <string.h>
+
+#include "simlcd.h"
+
+static lcdOrientation_t lcdOrientation = LCD_ORIENTATION_PORTRAIT;
+static lcdProperties_t simlcdProperties = { SIMLCD_WIDTH, SIMLCD_HEIGHT, false, true, true, true, true };
+
+// The GRAM, always in the portrait orientation
+static uint16_t simlcdGRAM[SIMLCD_WIDTH * SIMLCD_HEIGHT];
+
+// Window set by lcdSetWindow or a primitive, and the next pixel to write
+static uint16_t windowX0, windowY0, windowX1, windowY1;
+static uint16_t windowX, windowY;
+
+static simlcdStats_t simlcdStats;
+
+// printf-style pattern for the frames written by simlcdFlush, or NULL
+static const char *simlcdFramePattern = NULL;
+
+/*************************************************/
+/* Private Methods                               */
+/*************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Returns the GRAM index of a pixel in the current orientation
+            (landscape is the portrait panel rotated 90 degrees clockwise)
+*/
+/**************************************************************************/
+static uint32_t simlcdIndex(uint16_t x, uint16_t y)
+{
+  if (lcdOrientation == LCD_ORIENTATION_LANDSCAPE)
+  {
+    return (uint32_t) x * SIMLCD_WIDTH + (SIMLCD_WIDTH - 1 - y);
+  }
+
+  return (uint32_t) y * SIMLCD_WIDTH + x;
+}
+
+/*************************************************/
+static void simlcdSetPosition(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+  windowX0 = windowX = x0;
+  windowY0 = windowY = y0;
+  windowX1 = x1;
+  windowY1 = y1;
+  simlcdStats.windows++;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Writes one pixel at the current address, then moves to the
+            next column, wrapping to the next row and back to the top of
+            the window as the controller's address counter does
+*/
+/**************************************************************************/
+static void simlcdWriteData16(uint16_t color)
+{
+  // Like the GRAM, pixels outside the panel are dropped
+  if ((windowX < lcdGetWidth()) && (windowY < lcdGetHeight()))
+  {
+    simlcdGRAM[simlcdIndex(windowX, windowY)] = color;
+  }
+
+  if (windowX++ == windowX1)
+  {
+    windowX = windowX0;
+    windowY = (windowY == windowY1) ? windowY0 : windowY + 1;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Streams len pixels into the window, from data or (if data is
+            NULL) all set to color
+
+    Windows that are inside the panel in the portrait orientation, which
+    is nearly all of them, are written a row at a time so that the
+    benchmarks measure the rendering code rather than this driver.
+*/
+/**************************************************************************/
+static void simlcdStream(const uint16_t *data, uint16_t color, uint32_t len)
+{
+  uint16_t *p;
+  uint32_t n, i;
+
+  simlcdStats.pixels += len;
+
+  if ((lcdOrientation != LCD_ORIENTATION_PORTRAIT) ||
+      (windowX0 > windowX1) || (windowY0 > windowY1) ||
+      (windowX1 >= SIMLCD_WIDTH) || (windowY1 >= SIMLCD_HEIGHT))
+  {
+    while (len--)
+    {
+      simlcdWriteData16(data ? *data++ : color);
+    }
+    return;
+  }
+
+  while (len)
+  {
+    p = &simlcdGRAM[(uint32_t) windowY * SIMLCD_WIDTH + windowX];
+    n = windowX1 - windowX + 1;
+    if (n > len) n = len;
+    len -= n;
+
+    if (data)
+    {
+      memcpy(p, data, n * sizeof(uint16_t));
+      data += n;
+    }
+    else
+    {
+      for (i = 0; i < n; i++)
+      {
+        p[i] = color;
+      }
+    }
+
+    windowX += n;
+    if (windowX > windowX1)
+    {
+      windowX = windowX0;
+      windowY = (windowY == windowY1) ? windowY0 : windowY + 1;
+    }
+  }
+}
+
+/*************************************************/
+/* Public Methods                                */
+/*************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Reads a pixel straight from the GRAM, which also works when
+            CFG_TFTLCD_FRAMEBUFFER replaces lcdGetPixel
+*/
+/**************************************************************************/
+uint16_t simlcdReadPixel(uint16_t x, uint16_t y)
+{
+  if ((x >= lcdGetWidth()) || (y >= lcdGetHeight())) return 0;
+  return simlcdGRAM[simlcdIndex(x, y)];
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the GRAM (SIMLCD_WIDTH x SIMLCD_HEIGHT pixels, in the
+            portrait orientation)
+*/
+/**************************************************************************/
+const uint16_t *simlcdGetFramebuffer(void)
+{
+  return simlcdGRAM;
+}
+
+/**************************************************************************/
+/*!
+    @brief  FNV-1a hash of the GRAM, to check that the rendering code
+            still draws the same pixels
+*/
+/**************************************************************************/
+uint32_t simlcdChecksum(void)
+{
+  uint32_t hash = 2166136261u;
+  uint32_t i;
+
+  for (i = 0; i < SIMLCD_WIDTH * SIMLCD_HEIGHT; i++)
+  {
+    hash = (hash ^ simlcdGRAM[i]) * 16777619u;
+  }
+
+  return hash;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the traffic counters since lcdInit or simlcdResetStats
+*/
+/**************************************************************************/
+void simlcdGetStats(simlcdStats_t *stats)
+{
+  *stats = simlcdStats;
+}
+
+/*************************************************/
+void simlcdResetStats(void)
+{
+  memset(&simlcdStats, 0, sizeof(simlcdStats));
+}
+
+/**************************************************************************/
+/*!
+    @brief  Writes the screen, as it is seen in the current orientation,
+            to a binary (P6) PPM file with 8 bits per channel
+
+    @param[in]  filename
+                Name of the file, which is overwritten if it exists
+*/
+/**************************************************************************/
+err_t simlcdWritePPM(const char *filename)
+{
+  FILE *f;
+  uint16_t x, y, color;
+  uint8_t rgb[3];
+
+  ASSERT(filename != NULL, ERROR_INVALIDPARAMETER);
+
+  f = fopen(filename, "wb");
+  ASSERT(f != NULL, ERROR_INVALIDPARAMETER);
+
+  fprintf(f, "P6\n%u %u\n255\n", lcdGetWidth(), lcdGetHeight());
+  for (y = 0; y < lcdGetHeight(); y++)
+  {
+    for (x = 0; x < lcdGetWidth(); x++)
+    {
+      // Replicate the top bits so that white stays 255
+      color = simlcdGRAM[simlcdIndex(x, y)];
+      rgb[0] = ((color >> 8) & 0xF8) | (color >> 13);
+      rgb[1] = ((color >> 3) & 0xFC) | ((color >> 9) & 0x03);
+      rgb[2] = ((color << 3) & 0xF8) | ((color >> 2) & 0x07);
+      fwrite(rgb, 1, 3, f);
+    }
+  }
+
+  return (fclose(f) == 0) ? ERROR_NONE : ERROR_UNEXPECTEDVALUE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Sets where simlcdFlush writes the frames
+
+    @param[in]  pattern
+                printf-style file name with a %u for the frame number,
+                starting at 0 (for example "frames/frame%04u.ppm"), or
+                NULL to only count the frames.  The string isn't copied.
+*/
+/**************************************************************************/
+void simlcdSetFrameDump(const char *pattern)
+{
+  simlcdFramePattern = pattern;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Marks the end of a frame, which is counted in the stats and
+            written to a PPM file if simlcdSetFrameDump gave a pattern
+
+    The equivalent of lcdfbFlush (or a vsync) for the rendering code being
+    tested: call it once the frame is complete.
+*/
+/**************************************************************************/
+err_t simlcdFlush(void)
+{
+  char filename[256];
+  uint32_t frame = simlcdStats.flushes++;
+
+  if (simlcdFramePattern == NULL) return ERROR_NONE;
+
+  snprintf(filename, sizeof(filename), simlcdFramePattern, (unsigned int) frame);
+  return simlcdWritePPM(filename);
+}
+
+/*************************************************/
+void lcdInit(void)
+{
+  lcdOrientation = LCD_ORIENTATION_PORTRAIT;
+  memset(simlcdGRAM, 0, sizeof(simlcdGRAM));
+  simlcdResetStats();
+}
+
+/*************************************************/
+void lcdBacklight(bool state)
+{
+}
+
+/*************************************************/
+void lcdTest(void)
+{
+  lcdFillRGB(COLOR_GREEN);
+}
+
+#ifndef CFG_TFTLCD_FRAMEBUFFER
+/*************************************************/
+void lcdFillRGB(uint16_t color)
+{
+  simlcdSetPosition(0, 0, lcdGetWidth() - 1, lcdGetHeight() - 1);
+  lcdStreamColor(color, (uint32_t) lcdGetWidth() * lcdGetHeight());
+}
+
+/*************************************************/
+void lcdDrawPixel(uint16_t x, uint16_t y, uint16_t color)
+{
+  if ((x >= lcdGetWidth()) || (y >= lcdGetHeight())) return;
+
+  simlcdSetPosition(x, y, x, y);
+  simlcdStream(NULL, color, 1);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws an array of consecutive RGB565 pixels, clipped to the
+            end of the row as in the HW drivers
+*/
+/**************************************************************************/
+void lcdDrawPixels(uint16_t x, uint16_t y, uint16_t *data, uint32_t len)
+{
+  if ((x >= lcdGetWidth()) || (y >= lcdGetHeight()) || (len == 0)) return;
+  if (x + len > lcdGetWidth())
+  {
+    len = lcdGetWidth() - x;
+  }
+
+  simlcdSetPosition(x, y, x + len - 1, y);
+  lcdStreamPixels(data, len);
+}
+
+/*************************************************/
+void lcdDrawHLine(uint16_t x0, uint16_t x1, uint16_t y, uint16_t color)
+{
+  lcdDrawRect(x0, y, x1, y, color);
+}
+
+/*************************************************/
+void lcdDrawVLine(uint16_t x, uint16_t y0, uint16_t y1, uint16_t color)
+{
+  lcdDrawRect(x, y0, x, y1, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Fills a rectangle (inclusive coordinates) with a single window
+*/
+/**************************************************************************/
+void lcdDrawRect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+{
+  uint16_t t;
+
+  if (x1 < x0)
+  {
+    t = x1;
+    x1 = x0;
+    x0 = t;
+  }
+  if (y1 < y0)
+  {
+    t = y1;
+    y1 = y0;
+    y0 = t;
+  }
+
+  // Check limits
+  if ((x0 >= lcdGetWidth()) || (y0 >= lcdGetHeight())) return;
+  if (x1 >= lcdGetWidth())
+  {
+    x1 = lcdGetWidth() - 1;
+  }
+  if (y1 >= lcdGetHeight())
+  {
+    y1 = lcdGetHeight() - 1;
+  }
+
+  simlcdSetPosition(x0, y0, x1, y1);
+  lcdStreamColor(color, (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1));
+}
+
+/**************************************************************************/
+/*!
+    @brief  Copies a width x height block of RGB565 pixels (row by row)
+            to the LCD, clipped to the screen
+*/
+/**************************************************************************/
+void lcdBlit(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t *data)
+{
+  uint16_t w, h, row;
+
+  if ((x >= lcdGetWidth()) || (y >= lcdGetHeight()) || (width == 0) || (height == 0)) return;
+
+  w = (x + width > lcdGetWidth()) ? lcdGetWidth() - x : width;
+  h = (y + height > lcdGetHeight()) ? lcdGetHeight() - y : height;
+
+  simlcdSetPosition(x, y, x + w - 1, y + h - 1);
+  for (row = 0; row < h; row++)
+  {
+    lcdStreamPixels(data + (uint32_t) row * width, w);
+  }
+}
+
+/*************************************************/
+uint16_t lcdGetPixel(uint16_t x, uint16_t y)
+{
+  return simlcdReadPixel(x, y);
+}
+#endif
+
+/*************************************************/
+void lcdSetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+  simlcdSetPosition(x0, y0, x1, y1);
+}
+
+/*************************************************/
+void lcdStreamPixels(const uint16_t *data, uint32_t len)
+{
+  simlcdStream(data, 0, len);
+}
+
+/*************************************************/
+void lcdStreamColor(uint16_t color, uint32_t len)
+{
+  simlcdStream(NULL, color, len);
+}
+
+/*************************************************/
+void lcdSetOrientation(lcdOrientation_t orientation)
+{
+  // The GRAM is kept, so the old contents appear rotated as on a panel
+  lcdOrientation = orientation;
+}
+
+/*************************************************/
+lcdOrientation_t lcdGetOrientation(void)
+{
+  return lcdOrientation;
+}
+
+/*************************************************/
+uint16_t lcdGetWidth(void)
+{
+  return (lcdOrientation == LCD_ORIENTATION_LANDSCAPE) ?
+    simlcdProperties.height : simlcdProperties.width;
+}
+
+/*************************************************/
+uint16_t lcdGetHeight(void)
+{
+  return (lcdOrientation == LCD_ORIENTATION_LANDSCAPE) ?
+    simlcdProperties.width : simlcdProperties.height;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Moves the screen contents up (or down, if pixels is negative)
+            and fills the rows that are uncovered with fillColor
+
+    This is done inside the GRAM, like a controller's scroll command, so
+    it doesn't count as pixel or window traffic.
+*/
+/**************************************************************************/
+void lcdScroll(int16_t pixels, uint16_t fillColor)
+{
+  uint16_t width = lcdGetWidth();
+  uint16_t height = lcdGetHeight();
+  uint16_t x, y, src;
+  uint16_t shift = (pixels < 0) ? -pixels : pixels;
+
+  if (shift > height) shift = height;
+
+  for (y = 0; y < height; y++)
+  {
+    // Walk away from the rows that are being overwritten
+    uint16_t row = (pixels < 0) ? height - 1 - y : y;
+    bool fill = (pixels < 0) ? (row < shift) : (row >= height - shift);
+    src = (pixels < 0) ? row - shift : row + shift;
+    for (x = 0; x < width; x++)
+    {
+      simlcdGRAM[simlcdIndex(x, row)] = fill ? fillColor : simlcdGRAM[simlcdIndex(x, src)];
+    }
+  }
+}
+
+/*************************************************/
+uint16_t lcdGetControllerID(void)
+{
+  return SIMLCD_CONTROLLERID;
+}
+
+/*************************************************/
+lcdProperties_t lcdGetProperties(void)
+{
+  return simlcdProperties;
+}
@@ -0,0 +1,83 @@
+/**************************************************************************/
+/*!
+    @file     simlcd.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+#ifndef __SIMLCD_H__
+#define __SIMLCD_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "projectconfig.h"
+#include "drivers/displays/graphic/lcd.h"
+
+// Panel size in the portrait orientation, which can be changed on the
+// compiler command line to match the display being simulated
+#ifndef SIMLCD_WIDTH
+  #define SIMLCD_WIDTH          (240)
+#endif
+#ifndef SIMLCD_HEIGHT
+  #define SIMLCD_HEIGHT         (320)
+#endif
+
+#define SIMLCD_CONTROLLERID     (0x5157)
+
+/**************************************************************************/
+/*!
+    @brief  Traffic counters, in the same units as a real controller
+*/
+/**************************************************************************/
+typedef struct
+{
+  uint32_t pixels;        /**< Pixels written to the GRAM */
+  uint32_t windows;       /**< Windows set, by lcdSetWindow or a primitive */
+  uint32_t flushes;       /**< Frames completed with simlcdFlush */
+} simlcdStats_t;
+
+uint16_t        simlcdReadPixel     ( uint16_t x, uint16_t y );
+const uint16_t *simlcdGetFramebuffer( void );
+uint32_t        simlcdChecksum      ( void );
+void            simlcdGetStats      ( simlcdStats_t *stats );
+void            simlcdResetStats    ( void );
+err_t           simlcdWritePPM      ( const char *filename );
+void            simlcdSetFrameDump  ( const char *pattern );
+err_t           simlcdFlush         ( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
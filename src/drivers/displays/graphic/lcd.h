@@ -75,6 +75,8 @@ extern void     lcdDrawPixel(uint16_t x, uint16_t y, uint16_t color);
 extern void     lcdDrawPixels(uint16_t x, uint16_t y, uint16_t *data, uint32_t len);
 extern void     lcdDrawHLine(uint16_t x0, uint16_t x1, uint16_t y, uint16_t color);
 extern void     lcdDrawVLine(uint16_t x, uint16_t y0, uint16_t y1, uint16_t color);
+extern void     lcdDrawRect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color);
+extern void     lcdBlit(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t *data);
 extern void     lcdBacklight(bool state);
 extern void     lcdScroll(int16_t pixels, uint16_t fillColor);
 extern uint16_t lcdGetWidth(void);
@@ -84,6 +86,16 @@ extern uint16_t lcdGetControllerID(void);
 extern lcdOrientation_t lcdGetOrientation(void);
 extern lcdProperties_t lcdGetProperties(void);
 
+// Windowed access to the controller's GRAM.  lcdSetWindow selects an area
+// (inclusive coordinates) and starts a write, then lcdStreamPixels and
+// lcdStreamColor fill it left to right and top to bottom, which avoids one
+// address setup per pixel or line.  These are always implemented by the
+// HW driver, including when CFG_TFTLCD_FRAMEBUFFER redirects the drawing
+// functions above to the framebuffer (lcdfb.c).
+extern void     lcdSetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+extern void     lcdStreamPixels(const uint16_t *data, uint32_t len);
+extern void     lcdStreamColor(uint16_t color, uint32_t len);
+
 #ifdef __cplusplus
 }
 #endif 
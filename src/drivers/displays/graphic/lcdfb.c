@@ -0,0 +1,673 @@
+/**************************************************************************/
+/*!
+    @file     lcdfb.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    RAM framebuffer with dirty rectangles for the lcd.h API
+
+    When CFG_TFTLCD_FRAMEBUFFER is defined, this file implements the
+    drawing functions of lcd.h (lcdDrawPixel, lcdDrawHLine, etc.) instead
+    of the HW driver.  Pixels inside the buffered region are written to
+    RAM and the area they cover is recorded as dirty, and lcdfbFlush then
+    sends each dirty rectangle to the controller with a single window
+    (lcdSetWindow) and a burst of pixel data.  Pixels outside the region
+    are sent straight to the controller, also through a window.
+
+    The region can be the whole screen if there is enough RAM, but on the
+    LPC11U/LPC13U it will normally be the part of the UI that changes
+    often (a value, a chart, a status bar, etc.), sized with
+    CFG_TFTLCD_FRAMEBUFFER_SIZE:
+
+    @code
+    lcdInit();
+    drawFill(COLOR_WHITE);
+    lcdfbSetRegion(20, 100, 136, 24);
+
+    while (1)
+    {
+      // Only the pixels that change are sent to the LCD
+      drawRectangleFilled(20, 100, 155, 123, COLOR_WHITE);
+      fontsDrawString(24, 104, COLOR_BLACK, &dejaVuSans9ptFontInfo, value);
+      lcdfbFlush();
+    }
+    @endcode
+
+    Nothing drawn inside the region reaches the LCD until lcdfbFlush is
+    called.
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include "projectconfig.h"
+
+#ifdef CFG_TFTLCD_FRAMEBUFFER
+
+#include <string.h>
+
+#include "lcdfb.h"
+
+/* The cost of a window setup, in pixels (11 bytes of commands and
+   coordinates on the HX8340B, 8 register writes on the HX8347G).  Two
+   dirty rectangles are merged when flushing the extra pixels in their
+   union costs less than a second window. */
+#define LCDFB_WINDOWCOST  (16)
+
+static uint16_t     _lcdfbBuffer[CFG_TFTLCD_FRAMEBUFFER_SIZE];
+static lcdfbRect_t  _lcdfbRegion;
+static uint16_t     _lcdfbWidth;      /* Region width, 0 if there is no region */
+static lcdfbRect_t  _lcdfbDirty[CFG_TFTLCD_FRAMEBUFFER_DIRTYRECTS];
+static uint8_t      _lcdfbDirtyCount;
+static lcdfbStats_t _lcdfbStats;
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Private Methods ------------------------------ */
+/*                                                                        */
+/**************************************************************************/
+
+static uint32_t _lcdfbArea(const lcdfbRect_t *r)
+{
+  return (uint32_t)(r->x1 - r->x0 + 1) * (r->y1 - r->y0 + 1);
+}
+
+static void _lcdfbUnion(lcdfbRect_t *u, const lcdfbRect_t *a, const lcdfbRect_t *b)
+{
+  u->x0 = a->x0 < b->x0 ? a->x0 : b->x0;
+  u->y0 = a->y0 < b->y0 ? a->y0 : b->y0;
+  u->x1 = a->x1 > b->x1 ? a->x1 : b->x1;
+  u->y1 = a->y1 > b->y1 ? a->y1 : b->y1;
+}
+
+static bool _lcdfbContains(const lcdfbRect_t *outer, const lcdfbRect_t *inner)
+{
+  return (inner->x0 >= outer->x0) && (inner->x1 <= outer->x1) &&
+         (inner->y0 >= outer->y0) && (inner->y1 <= outer->y1);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Clips a rectangle to the buffered region
+
+    @return false if the rectangle is entirely outside the region
+*/
+/**************************************************************************/
+static bool _lcdfbClip(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, lcdfbRect_t *clipped)
+{
+  if ((_lcdfbWidth == 0) ||
+      (x1 < _lcdfbRegion.x0) || (x0 > _lcdfbRegion.x1) ||
+      (y1 < _lcdfbRegion.y0) || (y0 > _lcdfbRegion.y1))
+  {
+    return false;
+  }
+
+  clipped->x0 = x0 > _lcdfbRegion.x0 ? x0 : _lcdfbRegion.x0;
+  clipped->y0 = y0 > _lcdfbRegion.y0 ? y0 : _lcdfbRegion.y0;
+  clipped->x1 = x1 < _lcdfbRegion.x1 ? x1 : _lcdfbRegion.x1;
+  clipped->y1 = y1 < _lcdfbRegion.y1 ? y1 : _lcdfbRegion.y1;
+
+  return true;
+}
+
+static uint16_t *_lcdfbPixel(uint16_t x, uint16_t y)
+{
+  return &_lcdfbBuffer[(uint32_t)(y - _lcdfbRegion.y0) * _lcdfbWidth + (x - _lcdfbRegion.x0)];
+}
+
+/**************************************************************************/
+/*!
+    @brief  Adds a rectangle (inside the region) to the dirty list
+
+    The new rectangle is merged with any dirty rectangle where the union
+    is cheaper to flush than the two separately.  When the list is full,
+    it is merged with the rectangle that grows the least.
+*/
+/**************************************************************************/
+static void _lcdfbAddDirty(lcdfbRect_t r)
+{
+  lcdfbRect_t u;
+  uint32_t growth, bestGrowth;
+  uint8_t i, best;
+
+  // Most pixels and lines land in an area that's already dirty
+  for (i = 0; i < _lcdfbDirtyCount; i++)
+  {
+    if (_lcdfbContains(&_lcdfbDirty[i], &r))
+    {
+      return;
+    }
+  }
+
+  // Every merge can make the union overlap another rectangle, so the
+  // search starts again until nothing else is worth merging
+  i = 0;
+  while (i < _lcdfbDirtyCount)
+  {
+    _lcdfbUnion(&u, &r, &_lcdfbDirty[i]);
+    if (_lcdfbArea(&u) <= _lcdfbArea(&r) + _lcdfbArea(&_lcdfbDirty[i]) + LCDFB_WINDOWCOST)
+    {
+      r = u;
+      _lcdfbDirty[i] = _lcdfbDirty[--_lcdfbDirtyCount];
+      i = 0;
+    }
+    else
+    {
+      i++;
+    }
+  }
+
+  while (_lcdfbDirtyCount == CFG_TFTLCD_FRAMEBUFFER_DIRTYRECTS)
+  {
+    best = 0;
+    bestGrowth = 0xFFFFFFFF;
+    for (i = 0; i < _lcdfbDirtyCount; i++)
+    {
+      _lcdfbUnion(&u, &r, &_lcdfbDirty[i]);
+      growth = _lcdfbArea(&u) - _lcdfbArea(&_lcdfbDirty[i]);
+      if (growth < bestGrowth)
+      {
+        bestGrowth = growth;
+        best = i;
+      }
+    }
+    _lcdfbUnion(&r, &r, &_lcdfbDirty[best]);
+    _lcdfbDirty[best] = _lcdfbDirty[--_lcdfbDirtyCount];
+  }
+
+  _lcdfbDirty[_lcdfbDirtyCount++] = r;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Fills a rectangle on the LCD, bypassing the framebuffer
+*/
+/**************************************************************************/
+static void _lcdfbDirectFill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+{
+  uint32_t pixels = (uint32_t)(x1 - x0 + 1) * (y1 - y0 + 1);
+
+  lcdSetWindow(x0, y0, x1, y1);
+  lcdStreamColor(color, pixels);
+
+  _lcdfbStats.directRects++;
+  _lcdfbStats.directPixels += pixels;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Fills a rectangle (already clipped to the screen), buffering
+            the part inside the region and sending the rest directly
+*/
+/**************************************************************************/
+static void _lcdfbFillRect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+{
+  lcdfbRect_t in;
+  uint16_t x, y, *p;
+
+  if (!_lcdfbClip(x0, y0, x1, y1, &in))
+  {
+    _lcdfbDirectFill(x0, y0, x1, y1, color);
+    return;
+  }
+
+  // Parts above, below, left and right of the region
+  if (y0 < in.y0) _lcdfbDirectFill(x0, y0, x1, in.y0 - 1, color);
+  if (y1 > in.y1) _lcdfbDirectFill(x0, in.y1 + 1, x1, y1, color);
+  if (x0 < in.x0) _lcdfbDirectFill(x0, in.y0, in.x0 - 1, in.y1, color);
+  if (x1 > in.x1) _lcdfbDirectFill(in.x1 + 1, in.y0, x1, in.y1, color);
+
+  for (y = in.y0; y <= in.y1; y++)
+  {
+    p = _lcdfbPixel(in.x0, y);
+    for (x = in.x0; x <= in.x1; x++)
+    {
+      *p++ = color;
+    }
+  }
+
+  _lcdfbAddDirty(in);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Sends part of a row of pixels directly to the LCD
+*/
+/**************************************************************************/
+static void _lcdfbDirectPixels(uint16_t x, uint16_t y, const uint16_t *data, uint32_t len)
+{
+  lcdSetWindow(x, y, x + len - 1, y);
+  lcdStreamPixels(data, len);
+
+  _lcdfbStats.directRects++;
+  _lcdfbStats.directPixels += len;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a row of pixels (already clipped to the screen),
+            buffering the part inside the region
+*/
+/**************************************************************************/
+static void _lcdfbDrawRow(uint16_t x, uint16_t y, const uint16_t *data, uint32_t len)
+{
+  lcdfbRect_t in;
+  uint32_t n;
+
+  if (!_lcdfbClip(x, y, x + len - 1, y, &in))
+  {
+    _lcdfbDirectPixels(x, y, data, len);
+    return;
+  }
+
+  // Left of the region
+  if (x < in.x0)
+  {
+    n = in.x0 - x;
+    _lcdfbDirectPixels(x, y, data, n);
+    x += n;
+    data += n;
+    len -= n;
+  }
+
+  // Inside the region
+  n = in.x1 - in.x0 + 1;
+  memcpy(_lcdfbPixel(in.x0, y), data, n * sizeof(uint16_t));
+  _lcdfbAddDirty(in);
+
+  // Right of the region
+  if (len > n)
+  {
+    _lcdfbDirectPixels(in.x1 + 1, y, data + n, len - n);
+  }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------- Public Methods ------------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Selects the area of the screen that is kept in RAM
+
+    Anything pending is flushed first.  The region starts out black and
+    entirely dirty, so it should be redrawn before the next flush.  A
+    width or height of 0 removes the region, and everything is then
+    drawn directly.
+
+    @param[in]  x, y
+                Top-left corner of the region
+    @param[in]  width, height
+                Size of the region in pixels, with width * height no
+                larger than CFG_TFTLCD_FRAMEBUFFER_SIZE
+
+    @return ERROR_INVALIDPARAMETER if the region doesn't fit in the
+            buffer or on the screen
+*/
+/**************************************************************************/
+err_t lcdfbSetRegion(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+  if ((width != 0) && (height != 0))
+  {
+    ASSERT((uint32_t) width * height <= CFG_TFTLCD_FRAMEBUFFER_SIZE, ERROR_INVALIDPARAMETER);
+    ASSERT((uint32_t) x + width <= lcdGetWidth(), ERROR_INVALIDPARAMETER);
+    ASSERT((uint32_t) y + height <= lcdGetHeight(), ERROR_INVALIDPARAMETER);
+  }
+
+  lcdfbFlush();
+
+  if ((width == 0) || (height == 0))
+  {
+    _lcdfbWidth = 0;
+    return ERROR_NONE;
+  }
+
+  _lcdfbRegion.x0 = x;
+  _lcdfbRegion.y0 = y;
+  _lcdfbRegion.x1 = x + width - 1;
+  _lcdfbRegion.y1 = y + height - 1;
+  _lcdfbWidth = width;
+
+  memset(_lcdfbBuffer, 0, (uint32_t) width * height * sizeof(uint16_t));
+  _lcdfbAddDirty(_lcdfbRegion);
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Gets the buffered region (x1 < x0 if there is none)
+*/
+/**************************************************************************/
+void lcdfbGetRegion(lcdfbRect_t *region)
+{
+  if (_lcdfbWidth == 0)
+  {
+    region->x0 = region->y0 = 1;
+    region->x1 = region->y1 = 0;
+    return;
+  }
+
+  *region = _lcdfbRegion;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Marks part of the region as dirty, ex. if the LCD contents
+            were changed behind the framebuffer's back
+*/
+/**************************************************************************/
+void lcdfbInvalidate(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+  lcdfbRect_t in;
+
+  if (_lcdfbClip(x0, y0, x1, y1, &in))
+  {
+    _lcdfbAddDirty(in);
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Copies the current dirty rectangles
+
+    @return The number of dirty rectangles (which can be more than max)
+*/
+/**************************************************************************/
+uint8_t lcdfbGetDirtyRects(lcdfbRect_t *rects, uint8_t max)
+{
+  uint8_t i;
+
+  for (i = 0; (i < _lcdfbDirtyCount) && (i < max); i++)
+  {
+    rects[i] = _lcdfbDirty[i];
+  }
+
+  return _lcdfbDirtyCount;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Sends every dirty rectangle to the LCD, with one window each
+*/
+/**************************************************************************/
+void lcdfbFlush(void)
+{
+  lcdfbRect_t *r;
+  uint16_t y, w;
+  uint8_t i;
+
+  for (i = 0; i < _lcdfbDirtyCount; i++)
+  {
+    r = &_lcdfbDirty[i];
+    w = r->x1 - r->x0 + 1;
+
+    // The rows aren't contiguous in the buffer unless the rectangle is as
+    // wide as the region, but they all go into the same window
+    lcdSetWindow(r->x0, r->y0, r->x1, r->y1);
+    for (y = r->y0; y <= r->y1; y++)
+    {
+      lcdStreamPixels(_lcdfbPixel(r->x0, y), w);
+    }
+
+    _lcdfbStats.rects++;
+    _lcdfbStats.pixels += _lcdfbArea(r);
+  }
+
+  _lcdfbDirtyCount = 0;
+  _lcdfbStats.flushes++;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Gets the traffic counters
+*/
+/**************************************************************************/
+void lcdfbGetStats(lcdfbStats_t *stats)
+{
+  *stats = _lcdfbStats;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Resets the traffic counters
+*/
+/**************************************************************************/
+void lcdfbResetStats(void)
+{
+  memset(&_lcdfbStats, 0, sizeof(_lcdfbStats));
+}
+
+/**************************************************************************/
+/*                                                                        */
+/* ------------------------ lcd.h Methods ------------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Fills the whole LCD (directly) and the region (in RAM)
+*/
+/**************************************************************************/
+void lcdFillRGB(uint16_t color)
+{
+  uint32_t i;
+
+  if (_lcdfbWidth)
+  {
+    for (i = 0; i < _lcdfbArea(&_lcdfbRegion); i++)
+    {
+      _lcdfbBuffer[i] = color;
+    }
+  }
+
+  // The LCD and the buffer are now identical
+  _lcdfbDirtyCount = 0;
+  _lcdfbDirectFill(0, 0, lcdGetWidth() - 1, lcdGetHeight() - 1, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a single pixel at the specified X/Y location
+*/
+/**************************************************************************/
+void lcdDrawPixel(uint16_t x, uint16_t y, uint16_t color)
+{
+  lcdfbRect_t r;
+
+  if ((x >= lcdGetWidth()) || (y >= lcdGetHeight())) return;
+
+  if (_lcdfbClip(x, y, x, y, &r))
+  {
+    *_lcdfbPixel(x, y) = color;
+    _lcdfbAddDirty(r);
+  }
+  else
+  {
+    _lcdfbDirectFill(x, y, x, y, color);
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws an array of consecutive RGB565 pixels, from left to
+            right starting at x,y
+*/
+/**************************************************************************/
+void lcdDrawPixels(uint16_t x, uint16_t y, uint16_t *data, uint32_t len)
+{
+  if ((x >= lcdGetWidth()) || (y >= lcdGetHeight()) || (len == 0)) return;
+  if (x + len > lcdGetWidth())
+  {
+    len = lcdGetWidth() - x;
+  }
+
+  _lcdfbDrawRow(x, y, data, len);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a horizontal line
+*/
+/**************************************************************************/
+void lcdDrawHLine(uint16_t x0, uint16_t x1, uint16_t y, uint16_t color)
+{
+  uint16_t x;
+
+  if (x1 < x0)
+  {
+    x = x1;
+    x1 = x0;
+    x0 = x;
+  }
+
+  if ((x0 >= lcdGetWidth()) || (y >= lcdGetHeight())) return;
+  if (x1 >= lcdGetWidth())
+  {
+    x1 = lcdGetWidth() - 1;
+  }
+
+  _lcdfbFillRect(x0, y, x1, y, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Draws a vertical line
+*/
+/**************************************************************************/
+void lcdDrawVLine(uint16_t x, uint16_t y0, uint16_t y1, uint16_t color)
+{
+  uint16_t y;
+
+  if (y1 < y0)
+  {
+    y = y1;
+    y1 = y0;
+    y0 = y;
+  }
+
+  if ((x >= lcdGetWidth()) || (y0 >= lcdGetHeight())) return;
+  if (y1 >= lcdGetHeight())
+  {
+    y1 = lcdGetHeight() - 1;
+  }
+
+  _lcdfbFillRect(x, y0, x, y1, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Fills a rectangle (inclusive coordinates)
+*/
+/**************************************************************************/
+void lcdDrawRect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+{
+  uint16_t t;
+
+  if (x1 < x0)
+  {
+    t = x1;
+    x1 = x0;
+    x0 = t;
+  }
+  if (y1 < y0)
+  {
+    t = y1;
+    y1 = y0;
+    y0 = t;
+  }
+
+  if ((x0 >= lcdGetWidth()) || (y0 >= lcdGetHeight())) return;
+  if (x1 >= lcdGetWidth())
+  {
+    x1 = lcdGetWidth() - 1;
+  }
+  if (y1 >= lcdGetHeight())
+  {
+    y1 = lcdGetHeight() - 1;
+  }
+
+  _lcdfbFillRect(x0, y0, x1, y1, color);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Copies a width x height block of RGB565 pixels, clipped to
+            the screen
+*/
+/**************************************************************************/
+void lcdBlit(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t *data)
+{
+  lcdfbRect_t in;
+  uint16_t w, h, row;
+
+  if ((x >= lcdGetWidth()) || (y >= lcdGetHeight()) || (width == 0) || (height == 0)) return;
+
+  w = (x + width > lcdGetWidth()) ? lcdGetWidth() - x : width;
+  h = (y + height > lcdGetHeight()) ? lcdGetHeight() - y : height;
+
+  if (!_lcdfbClip(x, y, x + w - 1, y + h - 1, &in))
+  {
+    // Entirely outside the region, so a single window will do
+    lcdSetWindow(x, y, x + w - 1, y + h - 1);
+    for (row = 0; row < h; row++)
+    {
+      lcdStreamPixels(data + (uint32_t) row * width, w);
+    }
+    _lcdfbStats.directRects++;
+    _lcdfbStats.directPixels += (uint32_t) w * h;
+    return;
+  }
+
+  for (row = 0; row < h; row++)
+  {
+    _lcdfbDrawRow(x, y + row, data + (uint32_t) row * width, w);
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Gets the 16-bit color of the pixel at the specified location
+            (only known inside the region, 0 elsewhere)
+*/
+/**************************************************************************/
+uint16_t lcdGetPixel(uint16_t x, uint16_t y)
+{
+  lcdfbRect_t r;
+
+  if (!_lcdfbClip(x, y, x, y, &r))
+  {
+    return 0;
+  }
+
+  return *_lcdfbPixel(x, y);
+}
+
+#endif
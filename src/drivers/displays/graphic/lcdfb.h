@@ -0,0 +1,86 @@
+/**************************************************************************/
+/*!
+    @file     lcdfb.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+#ifndef __LCDFB_H__
+#define __LCDFB_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "projectconfig.h"
+#include "lcd.h"
+
+/**************************************************************************/
+/*!
+    @brief  An area of the screen, with inclusive coordinates
+*/
+/**************************************************************************/
+typedef struct
+{
+  uint16_t x0;
+  uint16_t y0;
+  uint16_t x1;
+  uint16_t y1;
+} lcdfbRect_t;
+
+/**************************************************************************/
+/*!
+    @brief  Traffic counters, to measure what the framebuffer saves
+*/
+/**************************************************************************/
+typedef struct
+{
+  uint32_t flushes;       /**< Calls to lcdfbFlush */
+  uint32_t rects;         /**< Windows written by lcdfbFlush */
+  uint32_t pixels;        /**< Pixels written by lcdfbFlush */
+  uint32_t directRects;   /**< Windows written outside the buffered region */
+  uint32_t directPixels;  /**< Pixels written outside the buffered region */
+} lcdfbStats_t;
+
+err_t    lcdfbSetRegion     ( uint16_t x, uint16_t y, uint16_t width, uint16_t height );
+void     lcdfbGetRegion     ( lcdfbRect_t *region );
+void     lcdfbInvalidate    ( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1 );
+uint8_t  lcdfbGetDirtyRects ( lcdfbRect_t *rects, uint8_t max );
+void     lcdfbFlush         ( void );
+void     lcdfbGetStats      ( lcdfbStats_t *stats );
+void     lcdfbResetStats    ( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -41,6 +41,7 @@
 #include "chb_buf.h"
 #include "chb_spi.h"
 #include "chb_eeprom.h"
+#include "core/isrtrace/isrtrace.h"
 
 // #if defined CFG_MCU_LPC1347FBD48
 //   #include "core/dwt/dwt.h"           // Cortex M3 only!
@@ -825,6 +826,8 @@ void PIN_INT0_IRQHandler(void)
   #error "chb_drvr.c: No MCU defined"
 #endif
 {
+    ISRTRACE_ENTER();
+
     if ( LPC_GPIO_PIN_INT->IST & (0x1<<0) )
     {
         U8 state, intp_src = 0;
@@ -903,6 +906,7 @@ void PIN_INT0_IRQHandler(void)
         // Clear the interrupt
         LPC_GPIO_PIN_INT->IST = 0x1<<0;
     }
+    ISRTRACE_EXIT();
     return;
 }
 
@@ -47,6 +47,29 @@
 /* Memory pool for dynamic memory allocator */
 static uint32_t _pn532_mem_pool[CFG_PN532_MEM_POOL_SIZE_BYTES/4];
 static bool     _pn532_mem_initialised = FALSE;
+static uint32_t _pn532_mem_size;
+static uint32_t _pn532_mem_peak;
+
+/**************************************************************************/
+/*!
+    Reads the bget statistics and updates the peak usage
+
+    @return   The number of bytes currently allocated
+*/
+/**************************************************************************/
+static uint32_t _pn532_mem_bstats(bufsize *totfree, bufsize *maxfree)
+{
+  bufsize curalloc;
+  int32_t nget, nrel;
+
+  bstats(&curalloc, totfree, maxfree, &nget, &nrel);
+  if ((uint32_t) curalloc > _pn532_mem_peak)
+  {
+    _pn532_mem_peak = (uint32_t) curalloc;
+  }
+
+  return (uint32_t) curalloc;
+}
 
 /**************************************************************************/
 /*!
@@ -62,6 +85,7 @@ static bool     _pn532_mem_initialised = FALSE;
 pn532_error_t pn532_mem_initLocal(void)
 {
   bpool((void*)_pn532_mem_pool, (bufsize)(sizeof(_pn532_mem_pool)));
+  _pn532_mem_size += sizeof(_pn532_mem_pool);
   _pn532_mem_initialised = TRUE;
 
   return PN532_ERROR_NONE;
@@ -91,6 +115,7 @@ pn532_error_t pn532_mem_init(uint32_t * mem_pool, uint16_t pool_size)
 
   bpool((void*)mem_pool, (bufsize)pool_size);
 
+  _pn532_mem_size += pool_size;
   _pn532_mem_initialised = TRUE;
 
   return PN532_ERROR_NONE;
@@ -117,6 +142,13 @@ void * pn532_mem_alloc(uint16_t size)
 
   alloc_mem = bget(size);
 
+  /* Keep track of the peak usage for pn532_mem_getStats */
+  if (alloc_mem)
+  {
+    bufsize totfree, maxfree;
+    _pn532_mem_bstats(&totfree, &maxfree);
+  }
+
   /* Debugging: Enable this to troubleshoot if mem_pool is overrun
    * during debugging.  This while() loop should be removed in
    * release builds! */
@@ -145,4 +177,37 @@ void pn532_mem_free(void* mem)
   return;
 }
 
+/**************************************************************************/
+/*!
+    Returns the usage of the memory pool (used, peak, free, largest free
+    block and fragmentation)
+
+    @param  stats   Filled with the pool statistics (all 0 if the pool
+                    hasn't been created yet)
+*/
+/**************************************************************************/
+void pn532_mem_getStats(pn532_mem_stats_t *stats)
+{
+  bufsize totfree, maxfree;
+
+  memset(stats, 0, sizeof(pn532_mem_stats_t));
+  if (!_pn532_mem_initialised)
+  {
+    return;
+  }
+
+  stats->used        = _pn532_mem_bstats(&totfree, &maxfree);
+  stats->size        = _pn532_mem_size;
+  stats->peak        = _pn532_mem_peak;
+  stats->free        = (uint32_t) totfree;
+  /* Free block sizes include the bget header */
+  stats->largestFree = (maxfree > (bufsize) sizeof(struct bhead)) ? (uint32_t) (maxfree - sizeof(struct bhead)) : 0;
+
+  /* Share of the free space that isn't in the largest block */
+  if (totfree > 0 && maxfree < totfree)
+  {
+    stats->fragmentation = (uint8_t) (100 - (maxfree * 100) / totfree);
+  }
+}
+
 // #endif  // #ifdef CFG_PN532
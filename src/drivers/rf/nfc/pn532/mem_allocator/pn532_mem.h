@@ -38,9 +38,25 @@
 #include "projectconfig.h"
 #include "bget.h"
 
+/**************************************************************************/
+/*!
+    Memory pool usage, in bytes (see pn532_mem_getStats)
+*/
+/**************************************************************************/
+typedef struct
+{
+  uint32_t size;          /**< Pool size */
+  uint32_t used;          /**< Currently allocated, including the bget headers */
+  uint32_t peak;          /**< Highest 'used' value since the pool was created */
+  uint32_t free;          /**< Total free space */
+  uint32_t largestFree;   /**< Largest block that can be allocated */
+  uint8_t  fragmentation; /**< 0 if all the free space is in one block, up to 100% */
+} pn532_mem_stats_t;
+
 pn532_error_t pn532_mem_initLocal(void);
 pn532_error_t pn532_mem_init(uint32_t * mem_pool, uint16_t pool_size);
 void *        pn532_mem_alloc(uint16_t size);
 void          pn532_mem_free(void* mem);
+void          pn532_mem_getStats(pn532_mem_stats_t *stats);
 
 #endif
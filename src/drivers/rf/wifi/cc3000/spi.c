@@ -41,6 +41,7 @@
 #include "hostdriver/evnt_handler.h"
 #include "core/gpio/gpio.h"
 #include "core/delay/delay.h"
+#include "core/isrtrace/isrtrace.h"
 
 #if CFG_CC3000_SPI_PORT == 1
   #include "core/ssp1/ssp1.h"
@@ -101,6 +102,10 @@ void SSIContReadOperation(void);
 char          wlan_rx_buffer[CC3000_RX_BUFFER_SIZE];
 unsigned char wlan_tx_buffer[CC3000_TX_BUFFER_SIZE];
 
+/* Largest packets seen, to size the buffers (see SpiGetBufferUsage) */
+static unsigned short usTxPeak;
+static unsigned short usRxPeak;
+
 /**************************************************************************/
 /*!
 
@@ -222,6 +227,11 @@ long SpiWrite(unsigned char *pUserBuffer, unsigned short usLength)
 
   usLength += (SPI_HEADER_SIZE + ucPad);
 
+  if (usLength > usTxPeak)
+  {
+    usTxPeak = usLength;
+  }
+
 /* The magic number that resides at the end of the TX/RX buffer (1 byte after
  * the allocated size) for the purpose of detection of the overrun. The
  * location of the memory where the magic number resides shall never be
@@ -411,9 +421,28 @@ long SpiReadDataCont(void)
       }
   }
 
+  /* 10 bytes (SPI and HCI headers) were read by SpiReadHeader */
+  if (10 + data_to_recv > usRxPeak)
+  {
+    usRxPeak = 10 + data_to_recv;
+  }
+
   return (0);
 }
 
+/**************************************************************************/
+/*!
+    @brief  Returns the largest TX and RX packets (including the SPI
+            header and padding) since startup, to compare with
+            CC3000_TX_BUFFER_SIZE and CC3000_RX_BUFFER_SIZE
+*/
+/**************************************************************************/
+void SpiGetBufferUsage(unsigned short *txPeak, unsigned short *rxPeak)
+{
+  *txPeak = usTxPeak;
+  *rxPeak = usRxPeak;
+}
+
 /**************************************************************************/
 /*!
 
@@ -494,6 +523,8 @@ void PIN_INT2_IRQHandler(void)
   #error "CC3000 spi.c: No MCU defined"
 #endif
 {
+  ISRTRACE_ENTER();
+
   /* Make sure the right flag is set in the int status register */
   if ( LPC_GPIO_PIN_INT->IST & (0x1 << 2) )
   {
@@ -532,6 +563,7 @@ void PIN_INT2_IRQHandler(void)
     /* Clear the FLEX/PIN interrupt */
     LPC_GPIO_PIN_INT->IST = 0x1 << 2;
   }
+  ISRTRACE_EXIT();
   return;
 }
 
@@ -56,6 +56,7 @@ extern void SpiCleanGPIOISR(void);
 extern int  init_spi(void);
 extern long TXBufferIsEmpty(void);
 extern long RXBufferIsEmpty(void);
+extern void SpiGetBufferUsage(unsigned short *txPeak, unsigned short *rxPeak);
 
 #ifdef  __cplusplus
 }
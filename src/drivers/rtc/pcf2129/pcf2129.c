@@ -49,6 +49,7 @@
 #include <string.h>
 #include "pcf2129.h"
 #include "core/gpio/gpio.h"
+#include "core/isrtrace/isrtrace.h"
 
 extern volatile uint8_t   I2CMasterBuffer[I2C_BUFSIZE];
 extern volatile uint8_t   I2CSlaveBuffer[I2C_BUFSIZE];
@@ -518,6 +519,8 @@ void PIN_INT1_IRQHandler(void)
   #error "pcf2129.c: No MCU defined"
 #endif
 {
+  ISRTRACE_ENTER();
+
   /* Make sure the right flag is set in the int status register */
   if ( LPC_GPIO_PIN_INT->IST & (0x1<<1) )
   {
@@ -534,6 +537,7 @@ void PIN_INT1_IRQHandler(void)
     /* Clear the FLEX/PIN interrupt */
     LPC_GPIO_PIN_INT->IST = 0x1<<1;
   }
+  ISRTRACE_EXIT();
   return;
 }
 
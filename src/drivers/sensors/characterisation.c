@@ -0,0 +1,276 @@
+/**************************************************************************/
+/*!
+    @file     characterisation.c
+    @author   K. Townsend (microBuilder.eu)
+    @ingroup  Sensors
+
+    @brief    Streaming noise characterisation (mean, variance and Allan
+              deviation) for sensor data
+
+    @details
+
+    Characterising sensor noise normally means logging a very long run of
+    raw samples and post-processing them on a PC.  This module computes
+    the same statistics on the fly, one sample at a time, so that a board
+    can be left running for hours (or days) without storing any raw data.
+
+    The Allan deviation is calculated at octave-spaced averaging times
+    (tau = 2^k * tau0) using a pyramid of pair averages, so memory use is
+    one characterisation_octave_t per octave (O(log T) for a run of length
+    T) and the average cost per sample is constant:
+
+    - Octave 0 (tau = tau0) and octave 1 (tau = 2 * tau0) use every
+      sample and are fully overlapping.
+    - Octave k > 1 uses averages of length m = 2^k taken every m/2
+      samples (half-overlapping). The fully overlapping estimator needs a
+      2m sample delay line per octave, which doesn't fit on the 8KB parts,
+      while half overlap recovers most of its confidence over the
+      non-overlapping estimator.
+
+    Octave k needs at least 2^(k+1) samples before it returns a value.
+
+    @code
+
+    // Characterise the Z axis of the accelerometer, sampling at 100Hz
+    characterisation_octave_t octaves[12];
+    characterisation_t noise = { .tau0    = 0.01F,
+                                 .octaves = 12,
+                                 .octave  = octaves };
+    sensors_event_t event;
+    uint8_t i;
+    float tau, adev;
+
+    characterisationInit(&noise);
+
+    while (noise.k < 100000)
+    {
+      if (!lsm303accelGetSensorEvent(&event))
+      {
+        characterisationAddSensorEvent(&noise, &event, SENSOR_AXIS_Z - 1);
+      }
+      delay(10);
+    }
+
+    printf("Mean     : %f%s", characterisationGetMean(&noise), CFG_PRINTF_NEWLINE);
+    printf("Variance : %f%s", characterisationGetVariance(&noise), CFG_PRINTF_NEWLINE);
+    for (i = 0; i < noise.octaves; i++)
+    {
+      if (!characterisationGetAllanDev(&noise, i, &tau, &adev))
+      {
+        printf("%f,%f%s", tau, adev, CFG_PRINTF_NEWLINE);
+      }
+    }
+
+    @endcode
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+#include <math.h>
+
+#include "characterisation.h"
+
+/**************************************************************************/
+/*!
+    @brief Initialises the characterisation_t instance
+
+    @param[in]  ch
+                Pointer to the characterisation_t instance, with .tau0,
+                .octaves and .octave already set
+*/
+/**************************************************************************/
+err_t characterisationInit(characterisation_t *ch)
+{
+  ASSERT(ch->octave != NULL, ERROR_INVALIDPARAMETER);
+  ASSERT(ch->octaves > 0 && ch->octaves <= 32, ERROR_INVALIDPARAMETER);
+  ASSERT(ch->tau0 > 0.0F, ERROR_INVALIDPARAMETER);
+
+  ch->k    = 0;
+  ch->mean = 0;
+  ch->m2   = 0;
+  ch->min  = 0;
+  ch->max  = 0;
+
+  memset(ch->octave, 0, ch->octaves * sizeof(characterisation_octave_t));
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief Adds a new sample to the characterisation_t instance
+
+    @param[in]  ch
+                Pointer to the characterisation_t instance
+    @param[in]  x
+                Sample value (samples are expected every .tau0 seconds)
+*/
+/**************************************************************************/
+void characterisationAdd(characterisation_t *ch, float x)
+{
+  characterisation_octave_t *oct;
+  double  delta;
+  float   value, d;
+  uint8_t i, idx;
+
+  /* Mean and variance (Welford's algorithm, stable over long runs) */
+  ch->k++;
+  delta = x - ch->mean;
+  ch->mean += delta / ch->k;
+  ch->m2 += delta * (x - ch->mean);
+
+  if ((ch->k == 1) || (x < ch->min)) ch->min = x;
+  if ((ch->k == 1) || (x > ch->max)) ch->max = x;
+
+  /* Octave 0: difference between consecutive samples */
+  oct = &ch->octave[0];
+  if (oct->histCount)
+  {
+    d = x - oct->hist[0];
+    oct->sumSq += d * d;
+    oct->count++;
+  }
+  oct->hist[0] = x;
+  oct->histCount = 1;
+
+  /* Octave 1..n: inputs are averages of length m/2 every m/2 samples.
+     Two consecutive inputs form one average of length m, and the
+     Allan difference is taken between averages m samples apart */
+  value = x;
+  for (i = 1; i < ch->octaves; i++)
+  {
+    oct = &ch->octave[i];
+
+    oct->hist[oct->histIndex] = value;
+    oct->histIndex = (oct->histIndex + 1) & 0x03;
+    if (oct->histCount < 4)
+    {
+      oct->histCount++;
+    }
+
+    if (oct->histCount == 4)
+    {
+      /* histIndex points at the oldest entry again */
+      idx = oct->histIndex;
+      d = ((oct->hist[(idx + 2) & 0x03] + oct->hist[(idx + 3) & 0x03]) -
+           (oct->hist[idx] + oct->hist[(idx + 1) & 0x03])) * 0.5F;
+      oct->sumSq += d * d;
+      oct->count++;
+    }
+
+    /* Non-overlapping pair averages feed the next octave */
+    if (!oct->hasPending)
+    {
+      oct->pending = value;
+      oct->hasPending = true;
+      break;
+    }
+    oct->hasPending = false;
+    value = (oct->pending + value) * 0.5F;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief Adds one value of a sensor event to the characterisation_t
+           instance
+
+    @param[in]  ch
+                Pointer to the characterisation_t instance
+    @param[in]  event
+                The sensors_event_t returned by *GetSensorEvent
+    @param[in]  index
+                Index in event->data to use (0..3, ex. 2 for the Z axis)
+*/
+/**************************************************************************/
+err_t characterisationAddSensorEvent(characterisation_t *ch, const sensors_event_t *event, uint8_t index)
+{
+  ASSERT(index < 4, ERROR_INVALIDPARAMETER);
+
+  characterisationAdd(ch, event->data[index]);
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief Returns the mean of all samples so far
+*/
+/**************************************************************************/
+float characterisationGetMean(characterisation_t *ch)
+{
+  return (float)ch->mean;
+}
+
+/**************************************************************************/
+/*!
+    @brief Returns the (sample) variance of all samples so far
+*/
+/**************************************************************************/
+float characterisationGetVariance(characterisation_t *ch)
+{
+  if (ch->k < 2)
+  {
+    return 0.0F;
+  }
+
+  return (float)(ch->m2 / (ch->k - 1));
+}
+
+/**************************************************************************/
+/*!
+    @brief Returns the Allan deviation for the specified octave
+
+    @param[in]  ch
+                Pointer to the characterisation_t instance
+    @param[in]  octave
+                Octave index (tau = 2^octave * tau0)
+    @param[out] tau
+                Averaging time in seconds
+    @param[out] adev
+                Allan deviation (in the same unit as the samples)
+
+    @returns    ERROR_UNEXPECTEDVALUE if not enough samples were collected
+                for this octave yet
+*/
+/**************************************************************************/
+err_t characterisationGetAllanDev(characterisation_t *ch, uint8_t octave, float *tau, float *adev)
+{
+  ASSERT(octave < ch->octaves, ERROR_INVALIDPARAMETER);
+
+  *tau = ch->tau0 * (float)(1UL << octave);
+
+  ASSERT(ch->octave[octave].count > 0, ERROR_UNEXPECTEDVALUE);
+
+  *adev = sqrtf((float)(ch->octave[octave].sumSq / (2.0 * ch->octave[octave].count)));
+
+  return ERROR_NONE;
+}
@@ -0,0 +1,83 @@
+/**************************************************************************/
+/*!
+    @file     characterisation.h
+    @author   K. Townsend (microBuilder.eu)
+    @ingroup  Sensors
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef _CHARACTERISATION_H_
+#define _CHARACTERISATION_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "projectconfig.h"
+#include "drivers/sensors/sensors.h"
+
+/** State for one octave (tau = 2^k * tau0) */
+typedef struct
+{
+  float    hist[4];           /**< Last four input averages (length = max(1, m/2)) */
+  uint8_t  histCount;         /**< Number of valid entries in .hist */
+  uint8_t  histIndex;         /**< Write index for .hist */
+  bool     hasPending;        /**< True if .pending holds the first half of a pair */
+  float    pending;           /**< First value of the next pair for the octave above */
+  double   sumSq;             /**< Sum of the squared Allan differences */
+  uint32_t count;             /**< Number of Allan differences accumulated */
+} characterisation_octave_t;
+
+/** Streaming noise statistics for a single sensor axis */
+typedef struct
+{
+  float                       tau0;       /**< Sample period in seconds */
+  uint8_t const               octaves;    /**< Number of entries in .octave */
+  characterisation_octave_t  *octave;     /**< Pointer to the octave buffer (size=octaves) */
+  uint32_t                    k;          /**< Total number of samples processed so far */
+  double                      mean;       /**< Running mean */
+  double                      m2;         /**< Running sum of squared deviations (Welford) */
+  float                       min;        /**< Smallest sample so far */
+  float                       max;        /**< Largest sample so far */
+} characterisation_t;
+
+err_t characterisationInit            ( characterisation_t *ch );
+void  characterisationAdd             ( characterisation_t *ch, float x );
+err_t characterisationAddSensorEvent  ( characterisation_t *ch, const sensors_event_t *event, uint8_t index );
+float characterisationGetMean         ( characterisation_t *ch );
+float characterisationGetVariance     ( characterisation_t *ch );
+err_t characterisationGetAllanDev     ( characterisation_t *ch, uint8_t octave, float *tau, float *adev );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
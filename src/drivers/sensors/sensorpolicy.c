@@ -0,0 +1,352 @@
+/**************************************************************************/
+/*!
+    @file     sensorpolicy.c
+    @author   K. Townsend (microBuilder.eu)
+    @ingroup  Sensors
+
+    @brief    Per-sensor reporting policy (deadband, min/max report
+              interval and threshold alerts)
+
+    @details
+
+    Most sensor readings are only interesting when they change, but the
+    sensor drivers return a fresh sensors_event_t every time they are
+    polled.  Sending every event over chibi, USB or to the SD card wastes
+    a lot of bandwidth (and power), so the policy engine below decides
+    if an event is worth reporting based on the following rules:
+
+    - Deadband: the event is only reported if at least one axis changed
+      by more than .deadbandAbs or by more than .deadbandRel times the
+      last reported value (if neither is set every change is reported)
+    - Minimum interval: changes are rate-limited to one report every
+      .minInterval milliseconds
+    - Maximum interval: a report is forced every .maxInterval
+      milliseconds even if nothing changed (heartbeat)
+    - Alerts: crossing .alertHigh or .alertLow (or returning inside the
+      limits minus .alertHysteresis) populates a msg_Alert_t and always
+      forces a report, bypassing the rate limit
+
+    The alert value is the scalar reading for single-value sensors, or
+    the vector magnitude for accelerometers, magnetometers, etc.
+
+    The number of sent and suppressed events is tracked in each
+    sensorpolicy_t instance to quantify the savings.
+
+    @code
+
+    sensorpolicy_t policy;
+    sensorpolicy_config_t config =
+    {
+      .deadbandAbs     = 0.2F,      // 0.2 m/s^2
+      .minInterval     = 100,       // Max 10 reports per second
+      .maxInterval     = 60000,     // At least one report per minute
+      .alertEnabled    = true,
+      .alertHigh       = 2.0F * SENSORS_GRAVITY_STANDARD,
+      .alertLow        = 0.0F,
+      .alertHysteresis = 1.0F
+    };
+
+    sensorpolicyInit(&policy, &config);
+
+    while(1)
+    {
+      sensors_event_t event;
+      msg_Alert_t alert;
+      uint8_t result;
+
+      if (!lsm303accelGetSensorEvent(&event))
+      {
+        result = sensorpolicyCheck(&policy, &event, &alert);
+        if (result & SENSORPOLICY_RESULT_ALERT)
+        {
+          msgSend(0xFFFF, MSG_MESSAGETYPE_ALERT, (uint8_t*)&alert, sizeof(alert));
+        }
+        if (result & SENSORPOLICY_RESULT_REPORT)
+        {
+          uint8_t msgbuf[sizeof(event)];
+          sensorsSerializeSensorsEvent(msgbuf, &event);
+          msgSend(0xFFFF, MSG_MESSAGETYPE_SENSOREVENT, msgbuf, sizeof(event));
+        }
+      }
+    }
+
+    @endcode
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+#include <math.h>
+
+#include "sensorpolicy.h"
+
+/**************************************************************************/
+/*!
+    @brief  Returns the number of meaningful values in event->data for
+            the specified sensor type
+*/
+/**************************************************************************/
+static uint8_t sensorpolicyValueCount(int32_t type)
+{
+  switch (type)
+  {
+    case SENSOR_TYPE_ACCELEROMETER:
+    case SENSOR_TYPE_MAGNETIC_FIELD:
+    case SENSOR_TYPE_ORIENTATION:
+    case SENSOR_TYPE_GYROSCOPE:
+    case SENSOR_TYPE_GRAVITY:
+    case SENSOR_TYPE_LINEAR_ACCELERATION:
+    case SENSOR_TYPE_ROTATION_VECTOR:
+    case SENSOR_TYPE_COLOR:
+      return 3;
+    default:
+      return 1;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the value that alert thresholds are compared against
+            (the reading itself or the magnitude of a vector)
+*/
+/**************************************************************************/
+static float sensorpolicyAlertValue(const sensors_event_t *event)
+{
+  if (sensorpolicyValueCount(event->type) == 1)
+  {
+    return event->data[0];
+  }
+
+  return sqrtf(event->data[0] * event->data[0] +
+               event->data[1] * event->data[1] +
+               event->data[2] * event->data[2]);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Checks if any value moved outside the configured deadband
+*/
+/**************************************************************************/
+static bool sensorpolicyChanged(const sensorpolicy_t *policy, const sensors_event_t *event)
+{
+  uint8_t i;
+  uint8_t count = sensorpolicyValueCount(event->type);
+  float delta;
+
+  for (i = 0; i < count; i++)
+  {
+    delta = fabsf(event->data[i] - policy->lastValue[i]);
+
+    if ((policy->config.deadbandAbs <= 0.0F) && (policy->config.deadbandRel <= 0.0F))
+    {
+      /* No deadband defined, any change is meaningful */
+      if (delta > 0.0F) return true;
+    }
+    else
+    {
+      if ((policy->config.deadbandAbs > 0.0F) && (delta >= policy->config.deadbandAbs))
+        return true;
+      /* The relative band is empty around 0, where only a change counts */
+      if ((policy->config.deadbandRel > 0.0F) && (delta > 0.0F) &&
+          (delta >= policy->config.deadbandRel * fabsf(policy->lastValue[i])))
+        return true;
+    }
+  }
+
+  return false;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Updates the alert state machine, returning the new alert
+            condition if a threshold was crossed or SENSORPOLICY_ALERT_NONE
+*/
+/**************************************************************************/
+static uint8_t sensorpolicyUpdateAlert(sensorpolicy_t *policy, float value)
+{
+  uint8_t state;
+  sensorpolicy_config_t const *cfg = &policy->config;
+
+  if (value > cfg->alertHigh)
+  {
+    state = SENSORPOLICY_ALERT_ABOVEHIGH;
+  }
+  else if (value < cfg->alertLow)
+  {
+    state = SENSORPOLICY_ALERT_BELOWLOW;
+  }
+  else
+  {
+    state = SENSORPOLICY_ALERT_INRANGE;
+  }
+
+  /* Apply hysteresis before leaving an alarm condition */
+  if ((policy->alertState == SENSORPOLICY_ALERT_ABOVEHIGH) &&
+      (state == SENSORPOLICY_ALERT_INRANGE) &&
+      (value > cfg->alertHigh - cfg->alertHysteresis))
+  {
+    return SENSORPOLICY_ALERT_NONE;
+  }
+  if ((policy->alertState == SENSORPOLICY_ALERT_BELOWLOW) &&
+      (state == SENSORPOLICY_ALERT_INRANGE) &&
+      (value < cfg->alertLow + cfg->alertHysteresis))
+  {
+    return SENSORPOLICY_ALERT_NONE;
+  }
+
+  if (state == policy->alertState)
+  {
+    return SENSORPOLICY_ALERT_NONE;
+  }
+
+  /* The first in-range sample only arms the state machine */
+  if ((policy->alertState == SENSORPOLICY_ALERT_NONE) &&
+      (state == SENSORPOLICY_ALERT_INRANGE))
+  {
+    policy->alertState = state;
+    return SENSORPOLICY_ALERT_NONE;
+  }
+
+  policy->alertState = state;
+  return state;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Initialises a new policy instance with the supplied rules
+
+    @param[in]  policy
+                Pointer to the sensorpolicy_t instance
+    @param[in]  config
+                The reporting rules to apply to this sensor
+*/
+/**************************************************************************/
+err_t sensorpolicyInit(sensorpolicy_t *policy, const sensorpolicy_config_t *config)
+{
+  ASSERT(policy != NULL, ERROR_INVALIDPARAMETER);
+  ASSERT(config != NULL, ERROR_INVALIDPARAMETER);
+  ASSERT(config->deadbandAbs >= 0.0F, ERROR_INVALIDPARAMETER);
+  ASSERT(config->deadbandRel >= 0.0F, ERROR_INVALIDPARAMETER);
+  ASSERT((config->maxInterval == 0) || (config->maxInterval >= config->minInterval), ERROR_INVALIDPARAMETER);
+  ASSERT(!config->alertEnabled || (config->alertLow <= config->alertHigh), ERROR_INVALIDPARAMETER);
+
+  memset(policy, 0, sizeof(sensorpolicy_t));
+  policy->config = *config;
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Resets the last reported value, alert state and counters,
+            keeping the current rules
+*/
+/**************************************************************************/
+void sensorpolicyReset(sensorpolicy_t *policy)
+{
+  sensorpolicy_config_t config = policy->config;
+
+  memset(policy, 0, sizeof(sensorpolicy_t));
+  policy->config = config;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Applies the policy to a new sensor event
+
+    @param[in]  policy
+                Pointer to the sensorpolicy_t instance
+    @param[in]  event
+                The sensors_event_t returned by the sensor driver
+    @param[out] alert
+                Populated when SENSORPOLICY_RESULT_ALERT is set (can be
+                NULL if alerts are disabled)
+
+    @returns    A combination of sensorpolicy_result_t flags
+*/
+/**************************************************************************/
+uint8_t sensorpolicyCheck(sensorpolicy_t *policy, const sensors_event_t *event, msg_Alert_t *alert)
+{
+  uint8_t  result = SENSORPOLICY_RESULT_SUPPRESS;
+  uint8_t  condition;
+  uint32_t elapsed;
+  float    value;
+
+  /* Timestamps are in ms, unsigned math handles the 32-bit rollover */
+  elapsed = (uint32_t)(event->timestamp - policy->lastTimestamp);
+
+  if (!policy->hasReported)
+  {
+    result = SENSORPOLICY_RESULT_REPORT;
+  }
+  else if (policy->config.maxInterval && (elapsed >= policy->config.maxInterval))
+  {
+    result = SENSORPOLICY_RESULT_REPORT;
+  }
+  else if ((elapsed >= policy->config.minInterval) && sensorpolicyChanged(policy, event))
+  {
+    result = SENSORPOLICY_RESULT_REPORT;
+  }
+
+  if (policy->config.alertEnabled)
+  {
+    value = sensorpolicyAlertValue(event);
+    condition = sensorpolicyUpdateAlert(policy, value);
+    if (condition != SENSORPOLICY_ALERT_NONE)
+    {
+      result |= SENSORPOLICY_RESULT_REPORT | SENSORPOLICY_RESULT_ALERT;
+      policy->alerts++;
+      if (alert)
+      {
+        #ifdef CFG_CHIBI
+          msgCreateAlert(alert);
+        #else
+          memset(alert, 0, sizeof(msg_Alert_t));
+        #endif
+        alert->alertType = (uint16_t)(((event->type & 0xFF) << 8) | condition);
+        memcpy(alert->payload, &value, sizeof(float));
+      }
+    }
+  }
+
+  if (result & SENSORPOLICY_RESULT_REPORT)
+  {
+    memcpy(policy->lastValue, event->data, sizeof(policy->lastValue));
+    policy->lastTimestamp = event->timestamp;
+    policy->hasReported = true;
+    policy->sent++;
+  }
+  else
+  {
+    policy->suppressed++;
+  }
+
+  return result;
+}
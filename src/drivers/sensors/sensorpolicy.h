@@ -0,0 +1,100 @@
+/**************************************************************************/
+/*!
+    @file     sensorpolicy.h
+    @author   K. Townsend (microBuilder.eu)
+    @ingroup  Sensors
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef _SENSORPOLICY_H_
+#define _SENSORPOLICY_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "projectconfig.h"
+#include "drivers/sensors/sensors.h"
+#include "drivers/rf/802.15.4/chibi/messages.h"
+
+/** Alert conditions (placed in the low byte of msg_Alert_t.alertType,
+    the high byte contains the sensors_type_t of the source sensor) */
+typedef enum
+{
+  SENSORPOLICY_ALERT_NONE           = 0x00,
+  SENSORPOLICY_ALERT_ABOVEHIGH      = 0x01,  /**< Value rose above .alertHigh */
+  SENSORPOLICY_ALERT_BELOWLOW       = 0x02,  /**< Value fell below .alertLow */
+  SENSORPOLICY_ALERT_INRANGE        = 0x03   /**< Value returned inside the limits (minus hysteresis) */
+} sensorpolicy_alert_t;
+
+/** Bit mask returned by sensorpolicyCheck */
+typedef enum
+{
+  SENSORPOLICY_RESULT_SUPPRESS      = 0x00,  /**< Nothing meaningful changed, drop the event */
+  SENSORPOLICY_RESULT_REPORT        = 0x01,  /**< Event should be sent/logged */
+  SENSORPOLICY_RESULT_ALERT         = 0x02   /**< A threshold was crossed, alert is populated */
+} sensorpolicy_result_t;
+
+/** Reporting rules for a single sensor */
+typedef struct
+{
+  float    deadbandAbs;       /**< Min absolute change vs the last report in SI units (0 = disabled) */
+  float    deadbandRel;       /**< Min relative change vs the last report, 0.05 = 5% (0 = disabled) */
+  uint32_t minInterval;       /**< Min delay in ms between two reports (0 = no rate limit) */
+  uint32_t maxInterval;       /**< Max delay in ms without a report (0 = no heartbeat) */
+  bool     alertEnabled;      /**< Set to true to generate threshold-crossing alerts */
+  float    alertHigh;         /**< Upper alert limit in SI units */
+  float    alertLow;          /**< Lower alert limit in SI units */
+  float    alertHysteresis;   /**< Margin required to return inside the limits */
+} sensorpolicy_config_t;
+
+/** Policy instance, one per sensor */
+typedef struct
+{
+  sensorpolicy_config_t config;
+  float    lastValue[3];      /**< Data from the last reported event */
+  int32_t  lastTimestamp;     /**< Timestamp (ms) of the last reported event */
+  bool     hasReported;       /**< False until the first event was reported */
+  uint8_t  alertState;        /**< Current sensorpolicy_alert_t condition */
+  uint32_t sent;              /**< Number of events that passed the policy */
+  uint32_t suppressed;        /**< Number of events that were dropped */
+  uint32_t alerts;            /**< Number of alerts generated */
+} sensorpolicy_t;
+
+err_t   sensorpolicyInit  ( sensorpolicy_t *policy, const sensorpolicy_config_t *config );
+void    sensorpolicyReset ( sensorpolicy_t *policy );
+uint8_t sensorpolicyCheck ( sensorpolicy_t *policy, const sensors_event_t *event, msg_Alert_t *alert );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
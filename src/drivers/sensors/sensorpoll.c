@@ -34,6 +34,8 @@
 */
 /**************************************************************************/
 #include "sensorpoll.h"
+#include "core/probe/probe.h"
+#include "core/isrtrace/isrtrace.h"
 
 #if defined CFG_MCU_FAMILY_LPC13UXX
 #include "core/dwt/dwt.h"
@@ -116,11 +118,16 @@ void CT16B1_IRQHandler(void)
   #error "sensorpoll.c: No MCU defined"
 #endif
 {
+  ISRTRACE_ENTER();
+
   #if defined CFG_MCU_FAMILY_LPC13UXX
-    /* Use the DWT timer to make sure we don't exceed the 5ms delay */
-    DWT_RESET_CYCLECOUNTER;
+    /* Use the DWT timer to make sure we don't exceed the 5ms delay (the *
+     * counter isn't reset since it's shared with the profiling probes)  */
+    uint32_t start = DWT->CYCCNT;
   #endif
 
+  PROBE_BEGIN(sensorpoll);
+
   /* Handle MAT0 event (MAT0 controls the tick period) */
   if (LPC_CT16B1->IR & (0x01 << 0))
   {
@@ -140,9 +147,11 @@ void CT16B1_IRQHandler(void)
    * capture sensor data only when a specific CAP event/pin is      *
    * triggered                                                      */
 
+  PROBE_END(sensorpoll);
+
   #if defined CFG_MCU_FAMILY_LPC13UXX
     /* Check how many clock cycles the ISR actually took */
-    int count = DWT->CYCCNT;
+    uint32_t count = DWT->CYCCNT - start;
     if (count >= LPC_CT16B1->MR0 * 8)
     {
       /* We overran the timer delay ... increment the overrun counter! */
@@ -150,6 +159,7 @@ void CT16B1_IRQHandler(void)
     }
   #endif
 
+  ISRTRACE_EXIT();
   return;
 }
 
@@ -184,6 +194,11 @@ void sensorpollInit()
   /* Reset the counter variables */
   sensorpoll_counter = 0;
 
+  #if defined CFG_MCU_FAMILY_LPC13UXX
+    /* Start the cycle counter used to detect overruns */
+    DWT_ENABLE_CYCLECOUNTER;
+  #endif
+
   /* Configure the timer */
   LPC_CT16B1->TCR  = 0x02;            /* Reset the timer               */
   LPC_CT16B1->PR   = 0x07;            /* Set prescaler to eight        */
@@ -110,6 +110,8 @@ typedef enum
     ERROR_PROT_INVALIDMSGTYPE                   = 0x121,  /**< Unexpected msg type encountered */
     ERROR_PROT_INVALIDCOMMANDID                 = 0x122,  /**< Unknown or out of range command ID */
     ERROR_PROT_INVALIDPAYLOAD                   = 0x123,  /**< Message payload has a problem (invalid len, etc.) */
+    ERROR_PROT_BUSY                             = 0x124,  /**< Transport or bulk transfer engine busy, try again later */
+    ERROR_PROT_PENDING                          = 0x125,  /**< Command handler will send its response later via prot_cmd_complete */
   /*=======================================================================*/
 
 
@@ -145,6 +147,22 @@ typedef enum
   /*=======================================================================*/
 
 
+  /*=======================================================================
+    CLI ERRORS                                             0x0170 .. 0x017F
+    -----------------------------------------------------------------------
+    Errors relating to the command-line interface and CLI scripts
+    -----------------------------------------------------------------------*/
+    ERROR_CLI_UNKNOWNCOMMAND                    = 0x171,  /**< Command name not found in the command table */
+    ERROR_CLI_AMBIGUOUSCOMMAND                  = 0x172,  /**< Abbreviation matches more than one command */
+    ERROR_CLI_TOOFEWARGS                        = 0x173,  /**< Fewer arguments than the command requires */
+    ERROR_CLI_TOOMANYARGS                       = 0x174,  /**< More arguments than the command accepts */
+    ERROR_CLI_COMMANDFAILED                     = 0x175,  /**< The command handler reported an error via cliSetError */
+    ERROR_CLI_SCRIPTNOTFOUND                    = 0x176,  /**< No script was found at the specified location */
+    ERROR_CLI_SCRIPTRUNNING                     = 0x177,  /**< Scripts can't be started from inside another script */
+    ERROR_CLI_SCRIPTERRORS                      = 0x178,  /**< One or more lines in the script failed */
+  /*=======================================================================*/
+
+
   /*=======================================================================
     USB ERRORS                                             0x0200 .. 0x02FF
     -----------------------------------------------------------------------
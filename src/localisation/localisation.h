@@ -164,6 +164,12 @@ typedef enum
   LOCALISATION_TEXT_EEPROM_Size_COLON_SPACE,                 // "EEPROM Size: "
   LOCALISATION_TEXT_Serial_Number,                           // "Serial Number: "
   LOCALISATION_TEXT_Code_Base_COLON_SPACE,                   // "Code Base: "
+  LOCALISATION_TEXT_Ambiguous_Command,                       // "Ambiguous Command"
+  LOCALISATION_TEXT_Stack_Size,                              // "Stack Size"
+  LOCALISATION_TEXT_Stack_Used,                              // "Stack Used (Max)"
+  LOCALISATION_TEXT_PN532_Memory_Pool,                       // "PN532 Memory Pool"
+  LOCALISATION_TEXT_CC3000_TX_Buffer,                        // "CC3000 TX Buffer"
+  LOCALISATION_TEXT_CC3000_RX_Buffer,                        // "CC3000 RX Buffer"
   LOCALISATION_FINAL
 } localisedTextKeys_t;
 
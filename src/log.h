@@ -48,7 +48,9 @@
 /*! Compiler specific macro returning a string containing the current function */
 #define LOG_FUNC __func__
 
-#ifdef LOG_ENABLE
+#if defined LOG_ENABLE && defined CFG_BINLOG
+  #define LOG_PRINTF(...)      BINLOG(__VA_ARGS__)
+#elif defined LOG_ENABLE
   #define LOG_PRINTF(...)      printf(__VA_ARGS__)
 #else
   #define LOG_PRINTF(...)
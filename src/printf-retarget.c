@@ -34,8 +34,10 @@
 */
 /**************************************************************************/
 #include <stdarg.h>
+#include <string.h>
 
 #include "projectconfig.h"
+#include "printf-retarget.h"
 
 #ifdef __CROSSWORKS_ARM
   #if defined(CFG_PRINTF_DEBUG) || defined(CFG_PRINTF_USBCDC)
@@ -51,28 +53,46 @@
   #include "core/uart/uart.h"
 #endif
 
+#if CFG_PRINTF_BUFFERSIZE > 0
+static char     printf_buffer[CFG_PRINTF_BUFFERSIZE];
+static uint16_t printf_count = 0;
+#endif
+
+static volatile uint32_t printf_dropped = 0;
+
 /**************************************************************************/
 /*!
-    @brief  Sends a single byte to a pre-determined peripheral (UART, etc.).
+    @brief  Sends a block of data to the pre-determined peripheral(s)
+            (UART, etc.) in one go.
 
-    @param  c
-            Byte value to send
+    @param  data
+            Pointer to the data to send
+    @param  len
+            Number of bytes to send
 */
 /**************************************************************************/
-void __putchar(const char c)
+static void printfWrite(const char *data, uint16_t len)
 {
+  if (len == 0)
+  {
+    return;
+  }
+
   #if defined(CFG_USB) && defined(CFG_PRINTF_USBCDC)
-    if (usb_isConfigured())
+    if (usb_isConfigured() && usb_cdc_isConnected())
     {
-      while(usb_cdc_isConnected() && !usb_cdc_putc(c) ) // blocking
-      {
-        ASM("nop");
-      }
+      #if CFG_PRINTF_NONBLOCKING == 1
+        // Only send what fits in the CDC buffer right now
+        printf_dropped += len - usb_cdc_trySend((uint8_t *) data, len);
+      #else
+        // Blocks until everything is queued (or the host times out)
+        printf_dropped += len - usb_cdc_send((uint8_t *) data, len);
+      #endif
     }
   #endif
 
   #ifdef CFG_PRINTF_UART
-    uartSendByte(c);
+    uartSend((uint8_t *) data, len);
   #endif
 
   /* Handle PRINTF_DEBUG redirection for Crossworks for ARM */
@@ -82,12 +102,14 @@ void __putchar(const char c)
         /* On the M3 we can check if a debugger is connected */
         if ((CoreDebug->DHCSR & CoreDebug_DHCSR_C_DEBUGEN_Msk)==CoreDebug_DHCSR_C_DEBUGEN_Msk)
         {
-          debug_putchar(c);
+          uint16_t i;
+          for (i = 0; i < len; i++) debug_putchar(data[i]);
         }
       #else
         /* On the M0 the processor doesn't have access to CoreDebug, so this
          * will cause problems if no debugger is connected! */
-        debug_putchar(c);
+        uint16_t i;
+        for (i = 0; i < len; i++) debug_putchar(data[i]);
       #endif
     #endif
   #endif
@@ -95,16 +117,167 @@ void __putchar(const char c)
 
 /**************************************************************************/
 /*!
-    @brief  Sends a string to a pre-determined peripheral (UART, etc.).
-            This function is called by core/libc/stdio.c
+    @brief  Sends a block of data of any size, without buffering it
+*/
+/**************************************************************************/
+static void printfWriteAll(const char *data, size_t len)
+{
+  while (len)
+  {
+    uint16_t n = (len > 0xFFFF) ? 0xFFFF : len;
+    printfWrite(data, n);
+    data += n;
+    len  -= n;
+  }
+}
+
+#if CFG_PRINTF_BUFFERSIZE > 0
+/**************************************************************************/
+/*!
+    @brief  Checks if we're running in an interrupt handler.  The stdout
+            buffer is only used from the main loop, since masking the
+            interrupts while it's sent would stall the USB transfers that
+            printfWrite may be waiting on.
+*/
+/**************************************************************************/
+static inline bool printfInInterrupt(void)
+{
+  #ifdef _TEST_
+  return false;
+  #else
+  return (__get_IPSR() != 0);
+  #endif
+}
+#endif
+
+/**************************************************************************/
+/*!
+    @brief  Adds a block of data to the stdout buffer, sending the buffer
+            contents whenever it fills up, and at the end of each line if
+            CFG_PRINTF_LINEBUFFERED is enabled.  Output from interrupt
+            handlers bypasses the buffer (and may be sent ahead of the
+            output buffered by the main loop).
+
+    @param  data
+            Pointer to the data to add
+    @param  len
+            Number of bytes to add
+*/
+/**************************************************************************/
+static void printfAppend(const char *data, size_t len)
+{
+  #if CFG_PRINTF_BUFFERSIZE > 0
+    #if CFG_PRINTF_LINEBUFFERED == 1
+    bool newline;
+    #endif
+
+    if (printfInInterrupt())
+    {
+      printfWriteAll(data, len);
+      return;
+    }
+
+    #if CFG_PRINTF_LINEBUFFERED == 1
+    newline = (memchr(data, '\n', len) != NULL);
+    #endif
+
+    while (len)
+    {
+      size_t n = CFG_PRINTF_BUFFERSIZE - printf_count;
+      if (n > len)
+      {
+        n = len;
+      }
+
+      memcpy(&printf_buffer[printf_count], data, n);
+      printf_count += n;
+      data += n;
+      len  -= n;
+
+      if (printf_count == CFG_PRINTF_BUFFERSIZE)
+      {
+        printfFlush();
+      }
+    }
+
+    #if CFG_PRINTF_LINEBUFFERED == 1
+    if (newline)
+    {
+      printfFlush();
+    }
+    #endif
+  #else
+    // No buffering, but still hand the whole block over at once
+    printfWriteAll(data, len);
+  #endif
+}
+
+/**************************************************************************/
+/*!
+    @brief  Sends any buffered output to the pre-determined peripheral(s).
+            This should be called before waiting for input (ex. after
+            displaying a prompt) when CFG_PRINTF_LINEBUFFERED is enabled,
+            or after any output that needs to be seen right away when it
+            isn't.  Does nothing in interrupt handlers, which don't use
+            the buffer.
+*/
+/**************************************************************************/
+void printfFlush(void)
+{
+  #if CFG_PRINTF_BUFFERSIZE > 0
+    uint16_t count;
+
+    if (printfInInterrupt())
+    {
+      return;
+    }
+
+    count = printf_count;
+
+    // Reset the buffer first in case the transport prints anything itself
+    printf_count = 0;
+    printfWrite(printf_buffer, count);
+  #endif
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the number of bytes that couldn't be sent since
+            startup, either because the USB CDC buffer was full in
+            non-blocking mode (CFG_PRINTF_NONBLOCKING) or because the
+            host stopped reading.
+*/
+/**************************************************************************/
+uint32_t printfGetDropped(void)
+{
+  return printf_dropped;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Sends a single byte to a pre-determined peripheral (UART, etc.).
 
     @param  c
             Byte value to send
 */
 /**************************************************************************/
+void __putchar(const char c)
+{
+  printfAppend(&c, 1);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Sends a string to a pre-determined peripheral (UART, etc.).
+            This function is called by core/libc/stdio.c
+
+    @param  str
+            The null-terminated string to send
+*/
+/**************************************************************************/
 int puts(const char * str)
 {
-  while(*str) __putchar(*str++);
+  printfAppend(str, strlen(str));
 
   return 0;
 }
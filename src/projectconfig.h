@@ -120,6 +120,12 @@ extern "C" {
     #endif
 /*=========================================================================*/
 
+/* Binary logging replaces the printf based LOG and ASSERT messages, and
+   depends on the board config, so it is included last */
+#ifdef CFG_BINLOG
+  #include "core/binlog/binlog.h"
+#endif
+
 #ifdef __cplusplus
 }
 #endif
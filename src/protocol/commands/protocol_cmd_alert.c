@@ -0,0 +1,108 @@
+/**************************************************************************/
+/*!
+    @file     protocol_cmd_alert.c
+    @author   K. Townsend (microBuilder.eu)
+
+    Commands to control the alert streamer (see prot_alert.c): the host
+    subscribes to the topics it wants to receive, and can read back the
+    number of events that were published or dropped for each topic.
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+#include "projectconfig.h"
+
+#ifdef CFG_PROTOCOL
+
+#include "../protocol.h"
+#include "../prot_alert.h"
+
+// topic 0x0010 every 100ms: 10 04 00 05 10 00 64 00 00
+/**************************************************************************/
+/*!
+    Starts streaming a topic via alert messages
+
+    Payload: U16 topic, U16 interval (ms, 0 = every prot_task call),
+             U8 flags (0x01 = only send the value when it changes)
+*/
+/**************************************************************************/
+err_t protcmd_subscribe(uint8_t length, uint8_t const payload[], protMsgResponse_t* mess_response)
+{
+  uint16_t topic, interval;
+
+  ASSERT( 5 == length, ERROR_PROT_INVALIDPAYLOAD);
+
+  topic    = (payload[1] << 8) + payload[0];
+  interval = (payload[3] << 8) + payload[2];
+
+  return prot_alert_subscribe(topic, interval, payload[4]);
+}
+
+// all topics: 10 05 00 02 FF FF
+/**************************************************************************/
+/*!
+    Stops streaming a topic
+
+    Payload: U16 topic (0xFFFF = all topics)
+*/
+/**************************************************************************/
+err_t protcmd_unsubscribe(uint8_t length, uint8_t const payload[], protMsgResponse_t* mess_response)
+{
+  ASSERT( 2 == length, ERROR_PROT_INVALIDPAYLOAD);
+
+  return prot_alert_unsubscribe( (payload[1] << 8) + payload[0] );
+}
+
+// totals: 10 06 00 02 FF FF
+/**************************************************************************/
+/*!
+    Gets the event counters for a topic
+
+    Payload:  U16 topic (0xFFFF = totals for every topic)
+    Response: U32 events published, U32 events dropped (queue full)
+*/
+/**************************************************************************/
+err_t protcmd_alertstats(uint8_t length, uint8_t const payload[], protMsgResponse_t* mess_response)
+{
+  uint32_t published, dropped;
+
+  ASSERT( 2 == length, ERROR_PROT_INVALIDPAYLOAD);
+
+  ASSERT_STATUS( prot_alert_get_stats( (payload[1] << 8) + payload[0], &published, &dropped) );
+
+  mess_response->length = 8;
+  memcpy(&mess_response->payload[0], &published, 4);
+  memcpy(&mess_response->payload[4], &dropped, 4);
+
+  return ERROR_NONE;
+}
+
+#endif
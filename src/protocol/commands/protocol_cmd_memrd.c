@@ -0,0 +1,118 @@
+/**************************************************************************/
+/*!
+    @file     protocol_cmd_memrd.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+#include "projectconfig.h"
+
+#ifdef CFG_PROTOCOL
+
+#include "../protocol.h"
+
+static uint32_t memrd_address;
+
+/**************************************************************************/
+/*!
+    Reads one chunk of the requested memory block for the bulk transfer
+*/
+/**************************************************************************/
+static err_t protcmd_memrd_read(uint32_t offset, uint8_t * buffer, uint8_t length)
+{
+  memcpy(buffer, (uint8_t const *) (uintptr_t) (memrd_address + offset), length);
+
+  return ERROR_NONE;
+}
+
+// read 64 bytes at 0x10000000: 10 03 00 08 00 00 00 10 40 00 00 00
+/**************************************************************************/
+/*!
+    Streams a block of memory to the host using a bulk transfer
+
+    Payload:  U32 address, U32 size in bytes
+    Response: U16 transfer ID, U16 number of chunks, U8 chunk size
+
+    @warning  Reading from an invalid or reserved memory address will
+              cause a HardFault, use with caution!
+*/
+/**************************************************************************/
+err_t protcmd_memrd(uint8_t length, uint8_t const payload[], protMsgResponse_t* mess_response)
+{
+  uint32_t address, size, chunks;
+  uint16_t xfer_id;
+
+  ASSERT( 8 == length, ERROR_PROT_INVALIDPAYLOAD);
+
+  memcpy(&address, &payload[0], 4);
+  memcpy(&size,    &payload[4], 4);
+
+  ASSERT( size > 0, ERROR_INVALIDPARAMETER);
+
+  /* The address is only replaced once the transfer is ours: a MEMRD
+     rejected with ERROR_PROT_BUSY mustn't redirect the active one */
+  ASSERT_STATUS( prot_xfer_start(size, protcmd_memrd_read, &xfer_id) );
+  memrd_address = address;
+
+  chunks = (size + PROT_XFER_CHUNK_SIZE - 1) / PROT_XFER_CHUNK_SIZE;
+
+  mess_response->length     = 5;
+  mess_response->payload[0] = (uint8_t) (xfer_id);
+  mess_response->payload[1] = (uint8_t) (xfer_id >> 8);
+  mess_response->payload[2] = (uint8_t) (chunks);
+  mess_response->payload[3] = (uint8_t) (chunks >> 8);
+  mess_response->payload[4] = PROT_XFER_CHUNK_SIZE;
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    Cancels the active bulk transfer (MEMRD or any other), for example
+    when the host gave up on it
+
+    Payload:  U16 transfer ID
+    Response: None
+*/
+/**************************************************************************/
+err_t protcmd_xferabort(uint8_t length, uint8_t const payload[], protMsgResponse_t* mess_response)
+{
+  uint16_t xfer_id;
+
+  ASSERT( 2 == length, ERROR_PROT_INVALIDPAYLOAD);
+
+  xfer_id = (uint16_t) (payload[0] | (payload[1] << 8));
+
+  return prot_xfer_abort(xfer_id);
+}
+
+#endif
@@ -0,0 +1,109 @@
+/**************************************************************************/
+/*!
+    @file     protocol_cmd_probe.c
+    @author   K. Townsend (microBuilder.eu)
+
+    Command to read the profiling probe statistics (see core/probe/probe.c)
+    one probe at a time, using the index in the probe table.
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+#include "projectconfig.h"
+
+#if defined(CFG_PROTOCOL) && defined(CFG_PROBE)
+
+#include "../protocol.h"
+#include "core/probe/probe.h"
+
+#define PROBE_RESPONSE_BINS     (12)
+#define PROBE_RESPONSE_NAMELEN  (16)
+
+// probe 0: 10 07 00 01 00
+/**************************************************************************/
+/*!
+    Gets the statistics of a profiling probe (core/probe)
+
+    Payload:  U8 probe index
+    Response: U8 number of probes, U8 first histogram bin (n),
+              U32 count, U32 min, U32 mean, U32 max (ticks),
+              U16 x 12 histogram bins n..n+11 (the last one also counts
+              anything above it), then the probe name (up to 16 chars,
+              not NULL terminated)
+*/
+/**************************************************************************/
+err_t protcmd_probe(uint8_t length, uint8_t const payload[], protMsgResponse_t* mess_response)
+{
+  const probe_t *probe;
+  uint32_t values[4];
+  uint16_t bins[PROBE_RESPONSE_BINS];
+  uint8_t  first = 0, i, namelen;
+
+  ASSERT( 1 == length, ERROR_PROT_INVALIDPAYLOAD);
+
+  probe = probeGet(payload[0]);
+  ASSERT( probe != NULL, ERROR_INVALIDPARAMETER);
+
+  // Start at the lowest bin in use, so that 12 bins cover most probes
+  while (first < PROBE_HISTOGRAM_BINS - PROBE_RESPONSE_BINS && !probe->histogram[first])
+  {
+    first++;
+  }
+  memset(bins, 0, sizeof(bins));
+  for (i = first; i < PROBE_HISTOGRAM_BINS; i++)
+  {
+    uint8_t  bin = (i - first < PROBE_RESPONSE_BINS) ? i - first : PROBE_RESPONSE_BINS - 1;
+    uint32_t sum = bins[bin] + probe->histogram[i];
+    bins[bin] = (sum > 0xFFFF) ? 0xFFFF : sum;
+  }
+
+  values[0] = probe->count;
+  values[1] = probe->count ? probe->min : 0;
+  values[2] = probeGetMean(probe);
+  values[3] = probe->max;
+
+  namelen = strlen(probe->name);
+  if (namelen > PROBE_RESPONSE_NAMELEN)
+  {
+    namelen = PROBE_RESPONSE_NAMELEN;
+  }
+
+  mess_response->length = 2 + sizeof(values) + sizeof(bins) + namelen;
+  mess_response->payload[0] = probeCount();
+  mess_response->payload[1] = first;
+  memcpy(&mess_response->payload[2], values, sizeof(values));
+  memcpy(&mess_response->payload[2 + sizeof(values)], bins, sizeof(bins));
+  memcpy(&mess_response->payload[2 + sizeof(values) + sizeof(bins)], probe->name, namelen);
+
+  return ERROR_NONE;
+}
+
+#endif
@@ -49,6 +49,20 @@
 #include "protocol_cmd_sysinfo.h"
 #include "core/iap/iap.h"
 
+#ifdef CFG_MEMINFO
+  #include "core/meminfo/meminfo.h"
+#endif
+
+#ifdef CFG_PN532
+  #include "drivers/rf/nfc/pn532/pn532.h"
+  #include "drivers/rf/nfc/pn532/mem_allocator/pn532_mem.h"
+#endif
+
+#ifdef CFG_CC3000
+  #include "drivers/rf/wifi/cc3000/spi.h"
+  #include "drivers/rf/wifi/cc3000/hostdriver/cc3000_common.h"
+#endif
+
 /**************************************************************************/
 /*!
     Returns system information for this board based on a 16-bit key
@@ -187,6 +201,83 @@ err_t protcmd_sysinfo(uint8_t length, uint8_t const payload[], protMsgResponse_t
       memcpy(&mess_response->payload[0], &eepromSize, sizeof(uint32_t));
       break;
 
+    case (PROT_CMD_SYSINFO_KEY_STACK):
+    /* ====================================================================
+        PROT_CMD_SYSINFO_KEY_STACK                              Key: 0x0007
+        -------------------------------------------------------------------
+        Returns the RAM left for the stack and the deepest stack use
+        since reset (requires CFG_MEMINFO)
+
+        PAYLOAD:  [07 00]
+                  Optional Args       None
+        RESPONSE: Payload Length      8 bytes
+                  mess_response[4]    Stack size in bytes (uint32_t)
+                  mess_response[8]    Stack high-water mark in bytes (uint32_t)
+       ====================================================================*/
+      ASSERT(length == 2, ERROR_PROT_INVALIDPAYLOAD);
+      #ifdef CFG_MEMINFO
+        mess_response->length = 8;
+        uint32_t stack[2] = { meminfoGetStackSize(), meminfoGetStackUsed() };
+        memcpy(&mess_response->payload[0], stack, sizeof(stack));
+      #else
+        return ERROR_INVALIDPARAMETER;
+      #endif
+      break;
+
+    case (PROT_CMD_SYSINFO_KEY_PN532_POOL):
+    /* ====================================================================
+        PROT_CMD_SYSINFO_KEY_PN532_POOL                         Key: 0x0008
+        -------------------------------------------------------------------
+        Returns the usage of the PN532 memory pool (requires CFG_PN532)
+
+        PAYLOAD:  [08 00]
+                  Optional Args       None
+        RESPONSE: Payload Length      21 bytes
+                  mess_response[4]    Pool size in bytes (uint32_t)
+                  mess_response[8]    Bytes allocated (uint32_t)
+                  mess_response[12]   Peak bytes allocated (uint32_t)
+                  mess_response[16]   Free bytes (uint32_t)
+                  mess_response[20]   Largest free block (uint32_t)
+                  mess_response[24]   Fragmentation in percent (uint8_t)
+       ====================================================================*/
+      ASSERT(length == 2, ERROR_PROT_INVALIDPAYLOAD);
+      #ifdef CFG_PN532
+        mess_response->length = 21;
+        pn532_mem_stats_t pool;
+        pn532_mem_getStats(&pool);
+        memcpy(&mess_response->payload[0], &pool, 20);
+        mess_response->payload[20] = pool.fragmentation;
+      #else
+        return ERROR_INVALIDPARAMETER;
+      #endif
+      break;
+
+    case (PROT_CMD_SYSINFO_KEY_CC3000_BUFFERS):
+    /* ====================================================================
+        PROT_CMD_SYSINFO_KEY_CC3000_BUFFERS                     Key: 0x0009
+        -------------------------------------------------------------------
+        Returns the size of the CC3000 SPI buffers, and the largest
+        packets sent and received since startup (requires CFG_CC3000)
+
+        PAYLOAD:  [09 00]
+                  Optional Args       None
+        RESPONSE: Payload Length      8 bytes
+                  mess_response[4]    TX buffer size (uint16_t)
+                  mess_response[6]    Largest TX packet (uint16_t)
+                  mess_response[8]    RX buffer size (uint16_t)
+                  mess_response[10]   Largest RX packet (uint16_t)
+       ====================================================================*/
+      ASSERT(length == 2, ERROR_PROT_INVALIDPAYLOAD);
+      #ifdef CFG_CC3000
+        mess_response->length = 8;
+        unsigned short buffers[4] = { CC3000_TX_BUFFER_SIZE, 0, CC3000_RX_BUFFER_SIZE, 0 };
+        SpiGetBufferUsage(&buffers[1], &buffers[3]);
+        memcpy(&mess_response->payload[0], buffers, sizeof(buffers));
+      #else
+        return ERROR_INVALIDPARAMETER;
+      #endif
+      break;
+
     default:
       return ERROR_INVALIDPARAMETER;
   }
@@ -55,6 +55,9 @@ typedef enum
   PROT_CMD_SYSINFO_KEY_SERIAL_NUMBER        = 0x0004,   /**< Unique on-chip serial number (4*U32) */
   PROT_CMD_SYSINFO_KEY_CLOCKSPEED           = 0x0005,   /**< Core clock speed in Hz (U32) */
   PROT_CMD_SYSINFO_KEY_EEPROMSIZE           = 0x0006,   /**< EEPROM size in bytes (U32) */
+  PROT_CMD_SYSINFO_KEY_STACK                = 0x0007,   /**< Stack size and high-water mark in bytes (2*U32) */
+  PROT_CMD_SYSINFO_KEY_PN532_POOL           = 0x0008,   /**< PN532 memory pool usage (5*U32, U8) */
+  PROT_CMD_SYSINFO_KEY_CC3000_BUFFERS       = 0x0009,   /**< CC3000 buffer sizes and peak usage (4*U16) */
   PROT_CMD_SYSINFO_KEY_LAST
 } prot_cmd_sysinfo_key_t;
 
@@ -0,0 +1,430 @@
+/**************************************************************************/
+/*!
+    @file     prot_alert.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Publish/subscribe event streaming over the simple binary
+              protocol
+
+    Rather than polling values with repeated commands, the host can
+    subscribe to a topic (a U16 ID registered by the firmware) and the
+    device will push new values as Alert messages, either at a fixed
+    interval, on change, or both.  Firmware can also push events for a
+    topic directly with prot_alert_publish (when a button is pressed,
+    when sensorpolicyCheck raises an alert, etc.).
+
+    Events are queued and packed into as few 64-byte Alert messages as
+    possible (Alert ID = PROT_ALERT_ID_EVENTS), with the following
+    records back to back in the payload:
+
+    |-------------------+----------+-----------------------------------------|
+    | Name              | Type     | Meaning                                 |
+    |-------------------+----------+-----------------------------------------|
+    | Topic             | U16      | Topic ID the event belongs to           |
+    | Length            | U8       | Event data length (0..12)               |
+    | Data              | ...      | Event data                              |
+    |-------------------+----------+-----------------------------------------|
+
+    If the host doesn't read the alerts fast enough the queue fills up,
+    new events are dropped and counted, and the counters can be read back
+    with the ALERTSTATS command.
+
+    @code
+
+    // Expose the die temperature as topic 0x0010
+    uint8_t sampleTemp(uint8_t data[])
+    {
+      float temp = readTemperature();
+      memcpy(data, &temp, sizeof(float));
+      return sizeof(float);
+    }
+
+    // prot_init clears every topic, so register after it
+    prot_init();
+    prot_alert_register(0x0010, sampleTemp);
+
+    @endcode
+
+    prot_init also registers a couple of built-in topics that every
+    board exposes: PROT_ALERT_TOPIC_UPTIME (sampled) and
+    PROT_ALERT_TOPIC_SENSORALERT (push-only, for sensorpolicy alerts).
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include "projectconfig.h"
+
+#ifdef CFG_PROTOCOL
+
+#include <string.h>
+#include "protocol.h"
+#include "prot_alert.h"
+#include "core/fifo/fifo.h"
+
+/* Queued event */
+typedef struct
+{
+  uint16_t topic;
+  uint8_t  length;
+  uint8_t  data[PROT_ALERT_MAX_DATA];
+} protAlertEvent_t;
+
+static protAlertTopic_t prot_alert_topics[PROT_ALERT_MAX_TOPICS];
+static uint8_t          prot_alert_topic_count;
+static uint8_t          prot_alert_subscriptions;
+
+/* The queue doesn't use an IRQ mutex: prot_alert_publish must be called
+   from the same context as prot_task (the main loop, etc.)             */
+FIFO_DEF(ff_prot_alert, PROT_ALERT_QUEUE_DEPTH, protAlertEvent_t, false, (IRQn_Type) -1);
+
+/**************************************************************************/
+/*!
+    @brief  Finds the topic with the specified ID, or NULL
+*/
+/**************************************************************************/
+static protAlertTopic_t * prot_alert_find(uint16_t topic)
+{
+  uint8_t i;
+
+  for (i = 0; i < prot_alert_topic_count; i++)
+  {
+    if (prot_alert_topics[i].topic == topic)
+    {
+      return &prot_alert_topics[i];
+    }
+  }
+
+  return NULL;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Adds an event to the queue, updating the topic counters
+*/
+/**************************************************************************/
+static err_t prot_alert_enqueue(protAlertTopic_t *p_topic, uint8_t const data[], uint8_t length)
+{
+  protAlertEvent_t event;
+
+  event.topic  = p_topic->topic;
+  event.length = length;
+  memcpy(event.data, data, length);
+
+  if ( !fifo_write(&ff_prot_alert, &event) )
+  {
+    p_topic->dropped++;
+    return ERROR_BUFFEROVERFLOW;
+  }
+
+  p_topic->published++;
+  p_topic->last_len = length;
+  memcpy(p_topic->last, data, length);
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Clears every topic, subscription and queued event
+
+    @note   This is called by prot_init, which then registers the
+            built-in topics, so firmware topics must be registered
+            after prot_init
+*/
+/**************************************************************************/
+void prot_alert_init(void)
+{
+  memset(prot_alert_topics, 0, sizeof(prot_alert_topics));
+  prot_alert_topic_count   = 0;
+  prot_alert_subscriptions = 0;
+  fifo_clear(&ff_prot_alert);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Makes a topic available to the host
+
+    @param[in]  topic
+                Unique topic ID (0xFFFF is reserved)
+    @param[in]  sample
+                Function used to sample the topic at the requested
+                interval, or NULL if the firmware only pushes events
+                with prot_alert_publish
+*/
+/**************************************************************************/
+err_t prot_alert_register(uint16_t topic, protAlertSample_t sample)
+{
+  protAlertTopic_t *p_topic;
+
+  ASSERT(topic != PROT_ALERT_TOPIC_ALL, ERROR_INVALIDPARAMETER);
+
+  p_topic = prot_alert_find(topic);
+  if (p_topic == NULL)
+  {
+    ASSERT(prot_alert_topic_count < PROT_ALERT_MAX_TOPICS, ERROR_BUFFEROVERFLOW);
+    p_topic = &prot_alert_topics[prot_alert_topic_count++];
+    memset(p_topic, 0, sizeof(protAlertTopic_t));
+    p_topic->topic = topic;
+  }
+
+  p_topic->sample = sample;
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Starts streaming a topic to the host
+
+    @param[in]  topic
+                Topic ID
+    @param[in]  interval
+                Sampling interval in delay ticks (normally ms), or 0 to
+                sample on every prot_task call (only useful with
+                PROT_ALERT_FLAG_ONCHANGE)
+    @param[in]  flags
+                A combination of protAlertFlag_t values
+*/
+/**************************************************************************/
+err_t prot_alert_subscribe(uint16_t topic, uint16_t interval, uint8_t flags)
+{
+  protAlertTopic_t *p_topic = prot_alert_find(topic);
+
+  ASSERT(p_topic != NULL, ERROR_INVALIDPARAMETER);
+
+  if (!p_topic->subscribed)
+  {
+    prot_alert_subscriptions++;
+  }
+
+  p_topic->subscribed = true;
+  p_topic->interval   = interval;
+  p_topic->flags      = flags;
+  p_topic->last_len   = 0;
+
+  /* Forces an initial sample on the next task call */
+  p_topic->sampled    = false;
+  p_topic->last_tick  = 0;
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Stops streaming a topic (or every topic with
+            PROT_ALERT_TOPIC_ALL).  Events already queued are still sent.
+*/
+/**************************************************************************/
+err_t prot_alert_unsubscribe(uint16_t topic)
+{
+  uint8_t i;
+
+  if (topic == PROT_ALERT_TOPIC_ALL)
+  {
+    for (i = 0; i < prot_alert_topic_count; i++)
+    {
+      prot_alert_topics[i].subscribed = false;
+    }
+    prot_alert_subscriptions = 0;
+    return ERROR_NONE;
+  }
+
+  protAlertTopic_t *p_topic = prot_alert_find(topic);
+  ASSERT(p_topic != NULL, ERROR_INVALIDPARAMETER);
+
+  if (p_topic->subscribed)
+  {
+    p_topic->subscribed = false;
+    prot_alert_subscriptions--;
+  }
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Pushes an event for a topic (ignored if the host isn't
+            subscribed to it)
+
+    @returns    ERROR_BUFFEROVERFLOW if the event was dropped because the
+                queue is full
+*/
+/**************************************************************************/
+err_t prot_alert_publish(uint16_t topic, uint8_t const data[], uint8_t length)
+{
+  protAlertTopic_t *p_topic = prot_alert_find(topic);
+
+  ASSERT(p_topic != NULL, ERROR_INVALIDPARAMETER);
+  ASSERT(length <= PROT_ALERT_MAX_DATA, ERROR_INVALIDPARAMETER);
+
+  if (!p_topic->subscribed)
+  {
+    return ERROR_NONE;
+  }
+
+  return prot_alert_enqueue(p_topic, data, length);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Reads the event counters for a topic, or the totals for
+            every topic with PROT_ALERT_TOPIC_ALL
+*/
+/**************************************************************************/
+err_t prot_alert_get_stats(uint16_t topic, uint32_t *published, uint32_t *dropped)
+{
+  uint8_t i;
+
+  *published = *dropped = 0;
+
+  for (i = 0; i < prot_alert_topic_count; i++)
+  {
+    if (topic == PROT_ALERT_TOPIC_ALL || prot_alert_topics[i].topic == topic)
+    {
+      *published += prot_alert_topics[i].published;
+      *dropped   += prot_alert_topics[i].dropped;
+      if (topic != PROT_ALERT_TOPIC_ALL)
+      {
+        return ERROR_NONE;
+      }
+    }
+  }
+
+  ASSERT(topic == PROT_ALERT_TOPIC_ALL, ERROR_INVALIDPARAMETER);
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns true if there's anything for prot_alert_task to do
+*/
+/**************************************************************************/
+bool prot_alert_is_active(void)
+{
+  return prot_alert_subscriptions || !fifo_isEmpty(&ff_prot_alert);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Samples the subscribed topics that are due, then sends as many
+            queued events as fit in a single Alert message
+
+    @param[in]  now
+                Current time in delay ticks
+    @param[in]  send
+                Transport, which should return an error (rather than
+                block) when busy, in which case the events stay queued
+
+    @returns    The number of events that were sent
+*/
+/**************************************************************************/
+uint8_t prot_alert_task(uint32_t now, protXferSend_t send)
+{
+  protMsgAlert_t   message_alert = { 0 };
+  protAlertEvent_t event;
+  uint8_t          count = 0;
+  uint8_t          i;
+
+  /* SAMPLING PHASE */
+  for (i = 0; i < prot_alert_topic_count; i++)
+  {
+    protAlertTopic_t *p_topic = &prot_alert_topics[i];
+    uint8_t data[PROT_ALERT_MAX_DATA];
+    uint8_t length;
+
+    if ( !p_topic->subscribed || p_topic->sample == NULL )
+    {
+      continue;
+    }
+
+    /* Sample right away after subscribing, then at the requested rate */
+    if ( p_topic->sampled && (now - p_topic->last_tick < p_topic->interval) )
+    {
+      continue;
+    }
+
+    p_topic->sampled   = true;
+    p_topic->last_tick = now;
+    length = p_topic->sample(data);
+    if (length == 0 || length > PROT_ALERT_MAX_DATA)
+    {
+      continue;
+    }
+
+    if ( (p_topic->flags & PROT_ALERT_FLAG_ONCHANGE) && length == p_topic->last_len &&
+         memcmp(data, p_topic->last, length) == 0 )
+    {
+      continue;
+    }
+
+    prot_alert_enqueue(p_topic, data, length);
+  }
+
+  /* BATCHING PHASE: pack as many events as will fit */
+  while ( fifo_peek(&ff_prot_alert, count, &event) )
+  {
+    if (message_alert.length + PROT_ALERT_RECORD_HEADER + event.length > PROT_MAX_MSG_SIZE-4)
+    {
+      break;
+    }
+
+    message_alert.payload[message_alert.length++] = (uint8_t) (event.topic);
+    message_alert.payload[message_alert.length++] = (uint8_t) (event.topic >> 8);
+    message_alert.payload[message_alert.length++] = event.length;
+    memcpy(&message_alert.payload[message_alert.length], event.data, event.length);
+    message_alert.length += event.length;
+    count++;
+  }
+
+  if (count == 0)
+  {
+    return 0;
+  }
+
+  message_alert.msg_type    = PROT_MSGTYPE_ALERT;
+  message_alert.cmd_id_low  = (uint8_t) (PROT_ALERT_ID_EVENTS);
+  message_alert.cmd_id_high = (uint8_t) (PROT_ALERT_ID_EVENTS >> 8);
+
+  if ( send((uint8_t const *) &message_alert, sizeof(protMsgAlert_t)) != ERROR_NONE )
+  {
+    /* Transport busy, try again on the next call */
+    return 0;
+  }
+
+  for (i = 0; i < count; i++)
+  {
+    fifo_read(&ff_prot_alert, &event);
+  }
+
+  return count;
+}
+
+#endif
@@ -0,0 +1,112 @@
+/**************************************************************************/
+/*!
+    @file     prot_alert.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef _PROT_ALERT_H_
+#define _PROT_ALERT_H_
+
+#include "projectconfig.h"
+#include "prot_xfer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PROT_ALERT_MAX_TOPICS     (8)   /**< Max number of registered topics */
+#define PROT_ALERT_MAX_DATA       (12)  /**< Max event size (ex. 3 floats) */
+#define PROT_ALERT_QUEUE_DEPTH    (16)  /**< Events waiting to be sent */
+#define PROT_ALERT_TOPIC_ALL      (0xFFFF)
+
+/* Alert ID used for batched event reports (each alert message contains
+   one or more records: U16 topic, U8 length, data[length])             */
+#define PROT_ALERT_ID_EVENTS      (0x0001)
+#define PROT_ALERT_RECORD_HEADER  (3)
+
+/* Topics registered by prot_init (firmware topics should start at 0x0010) */
+#define PROT_ALERT_TOPIC_UPTIME       (0x0001)  /**< U32 delay ticks since reset */
+#define PROT_ALERT_TOPIC_SENSORALERT  (0x0002)  /**< Push-only sensorpolicy alerts */
+
+/**************************************************************************/
+/*!
+    Subscription flags
+*/
+/**************************************************************************/
+typedef enum
+{
+  PROT_ALERT_FLAG_ONCHANGE      = 0x01  /**< Only report samples that differ from the last one sent */
+} protAlertFlag_t;
+
+/**************************************************************************/
+/*!
+    @brief  Samples the current value of a topic into 'data' (max
+            PROT_ALERT_MAX_DATA bytes) and returns the number of bytes
+            written, or 0 if no value is available right now
+*/
+/**************************************************************************/
+typedef uint8_t (*protAlertSample_t)(uint8_t data[]);
+
+/**************************************************************************/
+/*!
+    Topic state
+*/
+/**************************************************************************/
+typedef struct
+{
+  uint16_t          topic;        /**< Topic ID used by the host */
+  protAlertSample_t sample;       /**< Sampling function (NULL for push-only topics) */
+  bool              subscribed;
+  uint8_t           flags;        /**< protAlertFlag_t */
+  uint16_t          interval;     /**< Sampling interval in delay ticks (0 = every task call) */
+  bool              sampled;      /**< Sampled at least once since subscribing */
+  uint32_t          last_tick;    /**< Last time the topic was sampled */
+  uint8_t           last_len;     /**< Size of the last value queued */
+  uint8_t           last[PROT_ALERT_MAX_DATA];
+  uint32_t          published;    /**< Events queued for the host */
+  uint32_t          dropped;      /**< Events lost because the queue was full */
+} protAlertTopic_t;
+
+void    prot_alert_init        ( void );
+err_t   prot_alert_register    ( uint16_t topic, protAlertSample_t sample );
+err_t   prot_alert_subscribe   ( uint16_t topic, uint16_t interval, uint8_t flags );
+err_t   prot_alert_unsubscribe ( uint16_t topic );
+err_t   prot_alert_publish     ( uint16_t topic, uint8_t const data[], uint8_t length );
+err_t   prot_alert_get_stats   ( uint16_t topic, uint32_t *published, uint32_t *dropped );
+bool    prot_alert_is_active   ( void );
+uint8_t prot_alert_task        ( uint32_t now, protXferSend_t send );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -44,25 +44,54 @@
 /**************************************************************************/
 /*!
     This enumeration is used to make sure that each command has a unique
-    ID, and is used to create the command lookup table enum further down
+    ID, and is used to create the command lookup table enum further down.
+
+    IDs don't need to be contiguous, so ranges can be reserved for each
+    subsystem (ex. 0x01xx for sensors, 0x02xx for storage, etc.)
 */
 /**************************************************************************/
 typedef enum {
-  PROT_CMDTYPE_LED      = 0x0001, /**< Enables/disables the on board LED */
-  PROT_CMDTYPE_SYSINFO  = 0x0002, /**< Gets system properties */
-  PROT_CMDTYPE_COUNT              /**< Total number of commands */
+  PROT_CMDTYPE_LED         = 0x0001, /**< Enables/disables the on board LED */
+  PROT_CMDTYPE_SYSINFO     = 0x0002, /**< Gets system properties */
+  PROT_CMDTYPE_MEMRD       = 0x0003, /**< Streams a block of memory via a bulk transfer */
+  PROT_CMDTYPE_SUBSCRIBE   = 0x0004, /**< Starts streaming a topic via alert messages */
+  PROT_CMDTYPE_UNSUBSCRIBE = 0x0005, /**< Stops streaming a topic */
+  PROT_CMDTYPE_ALERTSTATS  = 0x0006, /**< Gets the published/dropped event counters */
+  PROT_CMDTYPE_PROBE       = 0x0007, /**< Gets the statistics of a profiling probe (CFG_PROBE) */
+  PROT_CMDTYPE_XFERABORT   = 0x0008  /**< Cancels the active bulk transfer */
 } protCmdType_t;
 
 /**************************************************************************/
 /*
     The command lookup table is constructed based on this macro containing
-    the command ID (as defined in protCmdType_t) and the actual callback
-    function to associate with it (in the format defined by protCmdFunc_t)
+    the command ID (as defined in protCmdType_t), the actual callback
+    function to associate with it (in the format defined by protCmdFunc_t),
+    and the min/max payload length accepted by the command.  Commands with
+    any other payload length are rejected with ERROR_PROT_INVALIDPAYLOAD
+    before the callback function is called.
+
+    The entries MUST be listed in ascending command ID order, since the
+    lookup table is searched with a binary search.
 */
 /**************************************************************************/
-#define PROTOCOL_COMMAND_TABLE(ENTRY)            \
-    ENTRY(PROT_CMDTYPE_LED, protcmd_led)         \
-    ENTRY(PROT_CMDTYPE_SYSINFO, protcmd_sysinfo) \
+/* Commands that depend on an optional module are only added to the table
+   when the module is enabled */
+#ifdef CFG_PROBE
+  #define PROTOCOL_COMMAND_PROBE(ENTRY)                                 \
+    ENTRY(PROT_CMDTYPE_PROBE,       protcmd_probe,       1, 1)
+#else
+  #define PROTOCOL_COMMAND_PROBE(ENTRY)
+#endif
+
+#define PROTOCOL_COMMAND_TABLE(ENTRY)                                   \
+    ENTRY(PROT_CMDTYPE_LED,         protcmd_led,         1, 1)          \
+    ENTRY(PROT_CMDTYPE_SYSINFO,     protcmd_sysinfo,     2, 2)          \
+    ENTRY(PROT_CMDTYPE_MEMRD,       protcmd_memrd,       8, 8)          \
+    ENTRY(PROT_CMDTYPE_SUBSCRIBE,   protcmd_subscribe,   5, 5)          \
+    ENTRY(PROT_CMDTYPE_UNSUBSCRIBE, protcmd_unsubscribe, 2, 2)          \
+    ENTRY(PROT_CMDTYPE_ALERTSTATS,  protcmd_alertstats,  2, 2)          \
+    PROTOCOL_COMMAND_PROBE(ENTRY)                                       \
+    ENTRY(PROT_CMDTYPE_XFERABORT,   protcmd_xferabort,   2, 2)          \
 
 #ifdef __cplusplus
  }
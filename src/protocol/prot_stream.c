@@ -0,0 +1,281 @@
+/**************************************************************************/
+/*!
+    @file     prot_stream.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    COBS/CRC16 framing to run the simple binary protocol over a
+              byte stream (UART, USB CDC, etc.)
+
+    USB HID and the custom bulk class deliver complete 64 byte messages,
+    but a UART or CDC link is just a stream of bytes.  Each message is
+    sent as a frame instead:
+
+    1. Only the used part of the message is sent (header + payload)
+    2. A CRC16 (CCITT, poly 0x1021, init 0xFFFF) is appended, MSB first
+    3. The result is encoded with COBS (Consistent Overhead Byte
+       Stuffing), which removes every 0x00 byte at the cost of a single
+       extra byte for frames shorter than 254 bytes
+    4. A 0x00 delimiter marks the end of the frame
+
+    Since 0x00 never appears inside a frame, the receiver can always
+    resynchronise on the next delimiter after a lost or corrupted byte.
+    Frames are decoded one byte at a time as they arrive, so no second
+    pass or extra buffer is needed, and a frame with a bad CRC or bad
+    COBS data is dropped and counted.
+
+    A sample LED command ([10] [01 00] [01] [01], CRC = 0x40F2) is
+    sent as:
+
+    Byte   0    1    2    3    4    5    6    7    8
+          [03] [10] [01] [05] [01] [01] [40] [F2] [00]
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include "projectconfig.h"
+
+#ifdef CFG_PROTOCOL
+
+#include <string.h>
+#include "prot_stream.h"
+
+/* Nibble lookup table for CRC-16/CCITT (poly 0x1021), which keeps the
+   flash footprint small while being ~4x faster than a bitwise CRC      */
+static const uint16_t prot_stream_crc_table[16] =
+{
+  0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+  0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+/**************************************************************************/
+/*!
+    @brief  Updates a CRC-16/CCITT with one byte
+*/
+/**************************************************************************/
+static inline uint16_t prot_stream_crc_update(uint16_t crc, uint8_t c)
+{
+  crc = (crc << 4) ^ prot_stream_crc_table[(crc >> 12) ^ (c >> 4)];
+  crc = (crc << 4) ^ prot_stream_crc_table[(crc >> 12) ^ (c & 0x0F)];
+
+  return crc;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Calculates a CRC-16/CCITT (start with crc = 0xFFFF)
+
+    Running the CRC over a message followed by its own CRC (MSB first)
+    always gives 0, which is how received frames are checked.
+*/
+/**************************************************************************/
+uint16_t prot_stream_crc16(uint16_t crc, uint8_t const * p_data, uint16_t length)
+{
+  while (length--)
+  {
+    crc = prot_stream_crc_update(crc, *p_data++);
+  }
+
+  return crc;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Encodes a message into a complete frame
+
+    @param[in]  p_msg
+                Message to send (normally the used part of a
+                protMsgCommand_t or protMsgError_t)
+    @param[in]  length
+                Message length (1..PROT_STREAM_MAX_MSG)
+    @param[out] frame
+                Buffer for the frame (at least PROT_STREAM_MAX_ENCODED
+                bytes)
+
+    @returns    The number of bytes to send, including the 0x00
+                delimiter, or 0 if the message length is invalid
+*/
+/**************************************************************************/
+uint8_t prot_stream_encode(uint8_t const * p_msg, uint8_t length, uint8_t frame[])
+{
+  uint8_t  crc_bytes[PROT_STREAM_CRC_SIZE];
+  uint16_t crc;
+  uint8_t  code_idx = 0;
+  uint8_t  out      = 1;
+  uint8_t  i;
+
+  ASSERT(length > 0 && length <= PROT_STREAM_MAX_MSG, 0);
+
+  crc = prot_stream_crc16(0xFFFF, p_msg, length);
+  crc_bytes[0] = (uint8_t) (crc >> 8);
+  crc_bytes[1] = (uint8_t) (crc);
+
+  /* Frames are always < 254 bytes, so a block can't reach 0xFF */
+  for (i = 0; i < length + PROT_STREAM_CRC_SIZE; i++)
+  {
+    uint8_t c = (i < length) ? p_msg[i] : crc_bytes[i - length];
+
+    if (c == 0)
+    {
+      frame[code_idx] = out - code_idx;
+      code_idx = out++;
+    }
+    else
+    {
+      frame[out++] = c;
+    }
+  }
+
+  frame[code_idx] = out - code_idx;
+  frame[out++]    = PROT_STREAM_DELIMITER;
+
+  return out;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Resets the parser (counters included)
+*/
+/**************************************************************************/
+void prot_stream_parser_init(protStreamParser_t *parser)
+{
+  memset(parser, 0, sizeof(protStreamParser_t));
+  parser->crc = 0xFFFF;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Appends one decoded byte to the current frame
+*/
+/**************************************************************************/
+static inline void prot_stream_emit(protStreamParser_t *parser, uint8_t c)
+{
+  if (parser->index >= PROT_STREAM_MAX_DECODED)
+  {
+    parser->discard = true;
+    return;
+  }
+
+  parser->buffer[parser->index++] = c;
+  parser->crc = prot_stream_crc_update(parser->crc, c);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Feeds one received byte to the parser
+
+    @param[in]  parser
+                Parser state
+    @param[in]  c
+                Byte received from the UART, CDC, etc.
+
+    @returns    The message length when 'c' completed a valid frame (the
+                message is then available in parser->buffer until the
+                next call), otherwise 0
+
+    @code
+
+    while (uartRxBufferDataPending())
+    {
+      uint8_t len = prot_stream_parse(&parser, uartRxBufferRead());
+      if (len)
+      {
+        handleMessage(parser.buffer, len);
+      }
+    }
+
+    @endcode
+*/
+/**************************************************************************/
+uint8_t prot_stream_parse(protStreamParser_t *parser, uint8_t c)
+{
+  if (c == PROT_STREAM_DELIMITER)
+  {
+    uint8_t length = 0;
+
+    /* Empty frames (back to back delimiters) are simply ignored */
+    if (parser->index || parser->remaining || parser->discard)
+    {
+      if (parser->discard || parser->remaining || parser->index <= PROT_STREAM_CRC_SIZE)
+      {
+        parser->framing_errors++;
+      }
+      else if (parser->crc != 0)
+      {
+        parser->crc_errors++;
+      }
+      else
+      {
+        parser->frames++;
+        length = parser->index - PROT_STREAM_CRC_SIZE;
+      }
+    }
+
+    /* Start a new frame (the trailing implicit zero is dropped) */
+    parser->index        = 0;
+    parser->remaining    = 0;
+    parser->pending_zero = false;
+    parser->discard      = false;
+    parser->crc          = 0xFFFF;
+
+    return length;
+  }
+
+  if (parser->discard)
+  {
+    return 0;
+  }
+
+  if (parser->remaining == 0)
+  {
+    /* Start of a new COBS block */
+    if (parser->pending_zero)
+    {
+      prot_stream_emit(parser, 0);
+    }
+    parser->code      = c;
+    parser->remaining = c - 1;
+  }
+  else
+  {
+    prot_stream_emit(parser, c);
+    parser->remaining--;
+  }
+
+  /* Every block except 0xFF ones is followed by a zero (unless it's the
+     last one, which is only known when the delimiter arrives)          */
+  if (parser->remaining == 0)
+  {
+    parser->pending_zero = (parser->code != 0xFF);
+  }
+
+  return 0;
+}
+
+#endif
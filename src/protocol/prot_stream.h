@@ -0,0 +1,82 @@
+/**************************************************************************/
+/*!
+    @file     prot_stream.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef _PROT_STREAM_H_
+#define _PROT_STREAM_H_
+
+#include "projectconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A frame holds one message (max 64 bytes) followed by a CRC16, encoded
+   with COBS (one overhead byte for frames < 254 bytes) and terminated
+   with a 0x00 delimiter                                                */
+#define PROT_STREAM_MAX_MSG       (64)
+#define PROT_STREAM_CRC_SIZE      (2)
+#define PROT_STREAM_MAX_DECODED   (PROT_STREAM_MAX_MSG + PROT_STREAM_CRC_SIZE)
+#define PROT_STREAM_MAX_ENCODED   (PROT_STREAM_MAX_DECODED + 2)
+#define PROT_STREAM_DELIMITER     (0x00)
+
+/**************************************************************************/
+/*!
+    Incremental frame parser state (one per byte stream)
+*/
+/**************************************************************************/
+typedef struct
+{
+  uint8_t  buffer[PROT_STREAM_MAX_DECODED]; /**< Decoded message + CRC */
+  uint8_t  index;           /**< Number of decoded bytes */
+  uint8_t  code;            /**< COBS code of the current block */
+  uint8_t  remaining;       /**< Bytes left in the current block */
+  bool     pending_zero;    /**< A zero must be inserted before the next block */
+  bool     discard;         /**< Skip everything until the next delimiter */
+  uint16_t crc;             /**< Running CRC of the decoded bytes */
+  uint32_t frames;          /**< Valid frames received */
+  uint32_t crc_errors;      /**< Frames dropped because of a bad CRC */
+  uint32_t framing_errors;  /**< Frames dropped because of bad COBS data or overflow */
+} protStreamParser_t;
+
+uint16_t prot_stream_crc16       ( uint16_t crc, uint8_t const * p_data, uint16_t length );
+uint8_t  prot_stream_encode      ( uint8_t const * p_msg, uint8_t length, uint8_t frame[] );
+void     prot_stream_parser_init ( protStreamParser_t *parser );
+uint8_t  prot_stream_parse       ( protStreamParser_t *parser, uint8_t c );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,517 @@
+/**************************************************************************/
+/*!
+    @file     prot_xfer.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Multi-packet (bulk) transfers over the simple binary protocol
+
+    Commands and responses are limited to a single 64 byte message, which
+    means that reading a large block of data (sensor logs, memory, files)
+    would take one full host round trip per 60 bytes.  Bulk transfers
+    stream the data instead, using DATA messages with a sequence number,
+    and let the receiver control the flow with DATA_ACK messages.
+
+    DATA MESSAGES
+    =============
+
+    |-------------------+----------+-----------------------------------------|
+    | Name              | Type     | Meaning                                 |
+    |-------------------+----------+-----------------------------------------|
+    | Message Type      | U8       | Always '0x30'                           |
+    | Transfer ID       | U16      | ID returned by the command that started |
+    |                   |          | the transfer                            |
+    | Payload Length    | U8       | 2 + number of data bytes (3..60)        |
+    | Sequence Number   | U16      | Chunk index, starting at 0              |
+    | Data              | ...      | Chunk data (58 bytes, except for the    |
+    |                   |          | last chunk)                             |
+    |-------------------+----------+-----------------------------------------|
+
+    Chunk 'n' always contains the data at offset n*58, so the receiver can
+    write chunks straight to their final location, in any order.
+
+    DATA_ACK MESSAGES
+    =================
+
+    |-------------------+----------+-----------------------------------------|
+    | Name              | Type     | Meaning                                 |
+    |-------------------+----------+-----------------------------------------|
+    | Message Type      | U8       | Always '0x31'                           |
+    | Transfer ID       | U16      | Transfer being acknowledged             |
+    | Payload Length    | U8       | Always '7'                              |
+    | Next Sequence     | U16      | All chunks before this one were received|
+    | Window            | U8       | Number of chunks the sender may have in |
+    |                   |          | flight past 'Next Sequence' (1..32)     |
+    | SACK Bitmap       | U32      | Bit 'i' set = chunk Next+1+i received   |
+    |-------------------+----------+-----------------------------------------|
+
+    The receiver sends an ack every few in-order chunks, and immediately
+    whenever it sees a gap or a duplicate.  Any hole below the highest
+    chunk marked in the SACK bitmap is retransmitted once, so a lost
+    frame only costs a single extra frame rather than resending the whole
+    window.  If nothing is acknowledged for a while (the ack itself was
+    lost, etc.), prot_xfer_tx_timeout resends every unacknowledged chunk,
+    and after PROT_XFER_MAX_RETRIES timeouts in a row without a valid ack
+    the host is assumed to be gone and the transfer is abandoned.
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include "projectconfig.h"
+
+#ifdef CFG_PROTOCOL
+
+#include <string.h>
+#include "protocol.h"
+#include "prot_xfer.h"
+
+/* Default credit used until the first ack arrives */
+#define PROT_XFER_INITIAL_WINDOW  (8)
+
+#define U16_HIGH_U8(u16)  ((uint8_t) (((u16) >> 8) & 0x00FF))
+#define U16_LOW_U8(u16)   ((uint8_t) ((u16) & 0x00FF))
+
+/**************************************************************************/
+/*!
+    @brief  Returns a mask with the 'count' lowest bits set
+*/
+/**************************************************************************/
+static inline uint32_t prot_xfer_mask(uint16_t count)
+{
+  return (count >= 32) ? 0xFFFFFFFF : ((1UL << count) - 1);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Shifts a window bitmap so that bit 0 matches the new base
+*/
+/**************************************************************************/
+static inline uint32_t prot_xfer_shift(uint32_t bitmap, uint16_t count)
+{
+  return (count >= 32) ? 0 : (bitmap >> count);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the number of data bytes in the specified chunk
+*/
+/**************************************************************************/
+static uint8_t prot_xfer_chunk_length(uint32_t size, uint16_t chunks, uint16_t seq)
+{
+  if (seq + 1 < chunks)
+  {
+    return PROT_XFER_CHUNK_SIZE;
+  }
+
+  return (uint8_t) (size - ((uint32_t) seq * PROT_XFER_CHUNK_SIZE));
+}
+
+/**************************************************************************/
+/*!
+    @brief  Builds and sends a DATA frame for the specified chunk
+*/
+/**************************************************************************/
+static err_t prot_xfer_tx_send_chunk(protXferTx_t *tx, uint16_t seq)
+{
+  protMsgCommand_t frame = { 0 };
+  uint8_t len = prot_xfer_chunk_length(tx->size, tx->chunks, seq);
+
+  frame.msg_type    = PROT_MSGTYPE_DATA;
+  frame.cmd_id_low  = U16_LOW_U8 (tx->xfer_id);
+  frame.cmd_id_high = U16_HIGH_U8(tx->xfer_id);
+  frame.length      = 2 + len;
+  frame.payload[0]  = U16_LOW_U8 (seq);
+  frame.payload[1]  = U16_HIGH_U8(seq);
+
+  ASSERT_STATUS( tx->read((uint32_t) seq * PROT_XFER_CHUNK_SIZE, &frame.payload[2], len) );
+  ASSERT_STATUS( tx->send((uint8_t const *) &frame, sizeof(protMsgCommand_t)) );
+
+  tx->frames++;
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Prepares a new outgoing transfer
+
+    @param[in]  tx
+                Sender state
+    @param[in]  xfer_id
+                ID placed in every DATA frame (normally returned to the
+                host in the response to the command that started it)
+    @param[in]  size
+                Total number of bytes to send (1..PROT_XFER_CHUNK_SIZE*65535)
+    @param[in]  read
+                Callback used to fetch each chunk of data
+    @param[in]  send
+                Callback used to send the DATA frames
+*/
+/**************************************************************************/
+err_t prot_xfer_tx_start(protXferTx_t *tx, uint16_t xfer_id, uint32_t size, protXferRead_t read, protXferSend_t send)
+{
+  ASSERT(tx != NULL && read != NULL && send != NULL, ERROR_INVALIDPARAMETER);
+  ASSERT(size > 0 && size <= (uint32_t) PROT_XFER_CHUNK_SIZE * 0xFFFF, ERROR_INVALIDPARAMETER);
+
+  memset(tx, 0, sizeof(protXferTx_t));
+  tx->xfer_id = xfer_id;
+  tx->size    = size;
+  tx->chunks  = (uint16_t) ((size + PROT_XFER_CHUNK_SIZE - 1) / PROT_XFER_CHUNK_SIZE);
+  tx->read    = read;
+  tx->send    = send;
+  tx->window  = PROT_XFER_INITIAL_WINDOW;
+  tx->active  = true;
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Sends pending retransmits first, then as many new chunks as
+            the current window allows
+
+    @param[in]  tx
+                Sender state
+    @param[in]  max_frames
+                Max number of frames to send in this call, to keep the
+                time spent in the protocol task bounded
+
+    @returns    The number of frames that were sent.  Sending stops
+                early (without losing the frame) if the transport is busy.
+*/
+/**************************************************************************/
+uint8_t prot_xfer_tx_poll(protXferTx_t *tx, uint8_t max_frames)
+{
+  uint8_t sent = 0;
+  uint8_t i;
+
+  if (!tx->active)
+  {
+    return 0;
+  }
+
+  /* Selective retransmits have priority over new data */
+  for (i = 0; tx->resend && sent < max_frames && i < 32; i++)
+  {
+    uint32_t bit = 1UL << i;
+    if (tx->resend & bit)
+    {
+      if (prot_xfer_tx_send_chunk(tx, tx->base + i) != ERROR_NONE)
+      {
+        return sent;
+      }
+      tx->resend &= ~bit;
+      tx->resent |= bit;
+      tx->retransmits++;
+      sent++;
+    }
+  }
+
+  /* New chunks, limited by the credit granted by the receiver */
+  while ( sent < max_frames && tx->next < tx->chunks &&
+          (uint16_t) (tx->next - tx->base) < tx->window )
+  {
+    if (prot_xfer_tx_send_chunk(tx, tx->next) != ERROR_NONE)
+    {
+      return sent;
+    }
+    tx->next++;
+    sent++;
+  }
+
+  return sent;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Processes an incoming DATA_ACK frame
+
+    @param[in]  tx
+                Sender state
+    @param[in]  p_frame
+                Complete 64-byte DATA_ACK message
+
+    @returns    ERROR_PROT_INVALIDPAYLOAD if the ack doesn't belong to
+                the current transfer or doesn't make sense
+*/
+/**************************************************************************/
+err_t prot_xfer_tx_ack(protXferTx_t *tx, uint8_t const * p_frame)
+{
+  protMsgCommand_t const * p_ack = (protMsgCommand_t const *) p_frame;
+  uint16_t xfer_id = (p_ack->cmd_id_high << 8) + p_ack->cmd_id_low;
+  uint16_t cum;
+  uint8_t  credit;
+  uint32_t sack;
+
+  ASSERT(tx->active, ERROR_PROT_INVALIDPAYLOAD);
+  ASSERT(PROT_MSGTYPE_DATA_ACK == p_ack->msg_type, ERROR_PROT_INVALIDMSGTYPE);
+  ASSERT(xfer_id == tx->xfer_id && PROT_XFER_ACK_LENGTH == p_ack->length, ERROR_PROT_INVALIDPAYLOAD);
+
+  cum    = (p_ack->payload[1] << 8) + p_ack->payload[0];
+  credit = p_ack->payload[2];
+  sack   = ((uint32_t) p_ack->payload[6] << 24) | ((uint32_t) p_ack->payload[5] << 16) |
+           ((uint32_t) p_ack->payload[4] << 8)  | p_ack->payload[3];
+
+  /* Acks can arrive late, but never for data that wasn't sent yet */
+  ASSERT(cum <= tx->next, ERROR_PROT_INVALIDPAYLOAD);
+
+  /* Even a stale ack shows that the host is still there */
+  tx->timeouts = 0;
+
+  if (cum > tx->base)
+  {
+    uint16_t delta = cum - tx->base;
+    tx->resend = prot_xfer_shift(tx->resend, delta);
+    tx->resent = prot_xfer_shift(tx->resent, delta);
+    tx->base   = cum;
+  }
+  else if (cum < tx->base)
+  {
+    /* Stale ack, older information than what we already have */
+    return ERROR_NONE;
+  }
+
+  /* Only keep SACK bits for chunks that are actually in flight */
+  tx->acked = (sack << 1) & prot_xfer_mask(tx->next - tx->base);
+  tx->resend &= ~tx->acked;
+
+  /* Any hole below the highest SACK'ed chunk was lost */
+  if (tx->acked)
+  {
+    uint32_t holes = ~tx->acked & prot_xfer_mask(32 - __builtin_clz(tx->acked));
+    tx->resend |= holes & ~tx->resent;
+  }
+
+  tx->window = (credit == 0) ? 1 : ((credit > PROT_XFER_MAX_WINDOW) ? PROT_XFER_MAX_WINDOW : credit);
+
+  if (tx->base >= tx->chunks)
+  {
+    tx->active = false;
+  }
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Schedules every unacknowledged chunk for retransmission.
+            Call this when no ack was received for a while.
+
+    @returns    ERROR_OPERATIONTIMEDOUT if there was no valid ack for
+                PROT_XFER_MAX_RETRIES timeouts in a row, in which case
+                the transfer is abandoned (and is no longer active)
+*/
+/**************************************************************************/
+err_t prot_xfer_tx_timeout(protXferTx_t *tx)
+{
+  if (!tx->active)
+  {
+    return ERROR_NONE;
+  }
+
+  if (++tx->timeouts > PROT_XFER_MAX_RETRIES)
+  {
+    tx->active = false;
+    return ERROR_OPERATIONTIMEDOUT;
+  }
+
+  tx->resend = prot_xfer_mask(tx->next - tx->base) & ~tx->acked;
+  tx->resent = 0;
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Stops the transfer without sending anything else.  Acks that
+            arrive later are rejected as they would be for a completed
+            transfer.
+*/
+/**************************************************************************/
+void prot_xfer_tx_abort(protXferTx_t *tx)
+{
+  tx->active = false;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns true once every chunk has been acknowledged
+*/
+/**************************************************************************/
+bool prot_xfer_tx_done(protXferTx_t const *tx)
+{
+  return (tx->chunks > 0) && (tx->base >= tx->chunks);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Prepares the receiving end of a transfer
+
+    @param[in]  rx
+                Receiver state
+    @param[in]  xfer_id
+                ID of the transfer to accept DATA frames for
+    @param[in]  size
+                Total number of bytes expected
+    @param[in]  window
+                Credit granted to the sender (1..PROT_XFER_MAX_WINDOW)
+    @param[in]  write
+                Callback used to store each chunk
+    @param[in]  send
+                Callback used to send the DATA_ACK frames
+*/
+/**************************************************************************/
+err_t prot_xfer_rx_start(protXferRx_t *rx, uint16_t xfer_id, uint32_t size, uint8_t window, protXferWrite_t write, protXferSend_t send)
+{
+  ASSERT(rx != NULL && write != NULL && send != NULL, ERROR_INVALIDPARAMETER);
+  ASSERT(size > 0 && size <= (uint32_t) PROT_XFER_CHUNK_SIZE * 0xFFFF, ERROR_INVALIDPARAMETER);
+  ASSERT(window > 0 && window <= PROT_XFER_MAX_WINDOW, ERROR_INVALIDPARAMETER);
+
+  memset(rx, 0, sizeof(protXferRx_t));
+  rx->xfer_id   = xfer_id;
+  rx->size      = size;
+  rx->chunks    = (uint16_t) ((size + PROT_XFER_CHUNK_SIZE - 1) / PROT_XFER_CHUNK_SIZE);
+  rx->write     = write;
+  rx->send      = send;
+  rx->window    = window;
+  rx->ack_every = (window > 1) ? window / 2 : 1;
+  rx->active    = true;
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Processes an incoming DATA frame, and sends a DATA_ACK when
+            required
+
+    @param[in]  rx
+                Receiver state
+    @param[in]  p_frame
+                Complete 64-byte DATA message
+*/
+/**************************************************************************/
+err_t prot_xfer_rx_data(protXferRx_t *rx, uint8_t const * p_frame)
+{
+  protMsgCommand_t const * p_data = (protMsgCommand_t const *) p_frame;
+  uint16_t xfer_id = (p_data->cmd_id_high << 8) + p_data->cmd_id_low;
+  uint16_t seq;
+  uint16_t offset;
+  uint32_t bit;
+
+  ASSERT(PROT_MSGTYPE_DATA == p_data->msg_type, ERROR_PROT_INVALIDMSGTYPE);
+  ASSERT(xfer_id == rx->xfer_id && p_data->length >= 3, ERROR_PROT_INVALIDPAYLOAD);
+
+  seq = (p_data->payload[1] << 8) + p_data->payload[0];
+
+  /* Already received, or a late frame from a retransmit: let the sender
+     know where we are right away */
+  if ( !rx->active || seq < rx->base || seq >= rx->base + 32 ||
+       (rx->received & (1UL << (seq - rx->base))) )
+  {
+    rx->duplicates++;
+    return prot_xfer_rx_ack(rx);
+  }
+
+  ASSERT(seq < rx->chunks, ERROR_PROT_INVALIDPAYLOAD);
+  ASSERT(p_data->length - 2 == prot_xfer_chunk_length(rx->size, rx->chunks, seq), ERROR_PROT_INVALIDPAYLOAD);
+
+  ASSERT_STATUS( rx->write((uint32_t) seq * PROT_XFER_CHUNK_SIZE, &p_data->payload[2], p_data->length - 2) );
+
+  offset = seq - rx->base;
+  bit    = 1UL << offset;
+  rx->received |= bit;
+
+  if (offset == 0)
+  {
+    /* Slide the window past every contiguous chunk */
+    while (rx->received & 1)
+    {
+      rx->received >>= 1;
+      rx->base++;
+    }
+    rx->since_ack++;
+  }
+
+  if (rx->base >= rx->chunks)
+  {
+    rx->active = false;
+  }
+
+  /* Ack right away on a gap (so the sender can retransmit selectively),
+     on the first chunk (to replace the sender's initial credit with our
+     own window), at the end of the transfer, or every few chunks */
+  if ( offset != 0 || rx->received || !rx->active || rx->base == 1 ||
+       rx->since_ack >= rx->ack_every )
+  {
+    return prot_xfer_rx_ack(rx);
+  }
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Sends a DATA_ACK frame with the current receiver state (can
+            also be called when the sender appears to have stalled)
+*/
+/**************************************************************************/
+err_t prot_xfer_rx_ack(protXferRx_t *rx)
+{
+  protMsgCommand_t frame = { 0 };
+  uint32_t sack = rx->received >> 1;
+
+  frame.msg_type    = PROT_MSGTYPE_DATA_ACK;
+  frame.cmd_id_low  = U16_LOW_U8 (rx->xfer_id);
+  frame.cmd_id_high = U16_HIGH_U8(rx->xfer_id);
+  frame.length      = PROT_XFER_ACK_LENGTH;
+  frame.payload[0]  = U16_LOW_U8 (rx->base);
+  frame.payload[1]  = U16_HIGH_U8(rx->base);
+  frame.payload[2]  = rx->window;
+  frame.payload[3]  = (uint8_t) (sack);
+  frame.payload[4]  = (uint8_t) (sack >> 8);
+  frame.payload[5]  = (uint8_t) (sack >> 16);
+  frame.payload[6]  = (uint8_t) (sack >> 24);
+
+  rx->since_ack = 0;
+
+  return rx->send((uint8_t const *) &frame, sizeof(protMsgCommand_t));
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns true once every chunk has been received
+*/
+/**************************************************************************/
+bool prot_xfer_rx_done(protXferRx_t const *rx)
+{
+  return (rx->chunks > 0) && (rx->base >= rx->chunks);
+}
+
+#endif
@@ -0,0 +1,146 @@
+/**************************************************************************/
+/*!
+    @file     prot_xfer.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef _PROT_XFER_H_
+#define _PROT_XFER_H_
+
+#include "projectconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Data frames use the regular 64 byte message layout: 4 byte header,
+   2 byte sequence number and up to 58 bytes of data                   */
+#define PROT_XFER_HEADER_SIZE     (4)
+#define PROT_XFER_CHUNK_SIZE      (64-PROT_XFER_HEADER_SIZE-2)
+
+/* Max number of unacknowledged chunks (limited by the SACK bitmap) */
+#define PROT_XFER_MAX_WINDOW      (32)
+
+/* Ack payload: next expected seq (U16), credit (U8), SACK bitmap (U32) */
+#define PROT_XFER_ACK_LENGTH      (7)
+
+/* Timeouts in a row without a valid ack before the sender gives up */
+#define PROT_XFER_MAX_RETRIES     (10)
+
+/**************************************************************************/
+/*!
+    @brief  Reads 'length' bytes at 'offset' of the transfer source into
+            'buffer' (chunks may be requested more than once, and out of
+            order, when retransmitting)
+*/
+/**************************************************************************/
+typedef err_t (*protXferRead_t)(uint32_t offset, uint8_t * buffer, uint8_t length);
+
+/**************************************************************************/
+/*!
+    @brief  Writes a received chunk to the transfer destination (chunks
+            arrive out of order if frames were lost)
+*/
+/**************************************************************************/
+typedef err_t (*protXferWrite_t)(uint32_t offset, uint8_t const * buffer, uint8_t length);
+
+/**************************************************************************/
+/*!
+    @brief  Sends a complete frame over the transport, returning an error
+            if the transport isn't ready (the frame will be sent again
+            on the next poll)
+*/
+/**************************************************************************/
+typedef err_t (*protXferSend_t)(uint8_t const * p_data, uint32_t length);
+
+/**************************************************************************/
+/*!
+    Sender state
+*/
+/**************************************************************************/
+typedef struct
+{
+  uint16_t        xfer_id;        /**< ID placed in the cmd_id field of every frame */
+  uint32_t        size;           /**< Total number of bytes to send */
+  uint16_t        chunks;         /**< Total number of chunks */
+  protXferRead_t  read;           /**< Data source */
+  protXferSend_t  send;           /**< Transport */
+  uint16_t        base;           /**< Oldest unacknowledged chunk */
+  uint16_t        next;           /**< Next chunk that was never sent */
+  uint8_t         window;         /**< Credit granted by the receiver */
+  uint32_t        acked;          /**< Chunks acknowledged past base (bit 0 = base) */
+  uint32_t        resend;         /**< Chunks waiting for a retransmit (bit 0 = base) */
+  uint32_t        resent;         /**< Chunks already retransmitted since the last timeout */
+  uint32_t        frames;         /**< Number of data frames sent */
+  uint32_t        retransmits;    /**< Number of data frames sent more than once */
+  uint8_t         timeouts;       /**< Timeouts in a row without a valid ack */
+  bool            active;
+} protXferTx_t;
+
+/**************************************************************************/
+/*!
+    Receiver state
+*/
+/**************************************************************************/
+typedef struct
+{
+  uint16_t        xfer_id;        /**< Expected transfer ID */
+  uint32_t        size;           /**< Total number of bytes expected */
+  uint16_t        chunks;         /**< Total number of chunks */
+  protXferWrite_t write;          /**< Data destination */
+  protXferSend_t  send;           /**< Transport (for acks) */
+  uint16_t        base;           /**< Next in-order chunk expected */
+  uint32_t        received;       /**< Chunks received past base (bit 0 = base) */
+  uint8_t         window;         /**< Credit granted to the sender */
+  uint8_t         ack_every;      /**< Ack after this many in-order chunks */
+  uint8_t         since_ack;      /**< In-order chunks received since the last ack */
+  uint32_t        duplicates;     /**< Number of duplicate or out of window frames */
+  bool            active;
+} protXferRx_t;
+
+err_t prot_xfer_tx_start   ( protXferTx_t *tx, uint16_t xfer_id, uint32_t size, protXferRead_t read, protXferSend_t send );
+uint8_t prot_xfer_tx_poll  ( protXferTx_t *tx, uint8_t max_frames );
+err_t prot_xfer_tx_ack     ( protXferTx_t *tx, uint8_t const * p_frame );
+err_t prot_xfer_tx_timeout ( protXferTx_t *tx );
+void  prot_xfer_tx_abort   ( protXferTx_t *tx );
+bool  prot_xfer_tx_done    ( protXferTx_t const *tx );
+
+err_t prot_xfer_rx_start   ( protXferRx_t *rx, uint16_t xfer_id, uint32_t size, uint8_t window, protXferWrite_t write, protXferSend_t send );
+err_t prot_xfer_rx_data    ( protXferRx_t *rx, uint8_t const * p_frame );
+err_t prot_xfer_rx_ack     ( protXferRx_t *rx );
+bool  prot_xfer_rx_done    ( protXferRx_t const *rx );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
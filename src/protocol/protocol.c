@@ -73,6 +73,8 @@
     |-----------------------+---------+--------------------------------------|
     | Command               | 0x10    |                                      |
     | Response              | 0x20    |                                      |
+    | Data                  | 0x30    | Bulk transfer chunk (see prot_xfer.c)|
+    | Data Ack              | 0x31    | Bulk transfer flow control           |
     | Alert                 | 0x40    |                                      |
     | Error                 | 0x80    |                                      |
     |-----------------------+---------+--------------------------------------|
@@ -213,14 +215,71 @@
     - The second and third bytes are 0x0100 (00 01 in little-endian notation),
       which is the error code corresponding to PROT_ERROR_INVALID_PARAM.
 
+    REQUEST TAGS
+    ============
+
+    The low nibble of the Command message type can hold a request tag
+    (0x11..0x1F, 0x10 = untagged).  The tag is copied into the Response
+    (0x21..0x2F) or Error (0x81..0x8F) message for that command, so the
+    host can keep several commands in flight and match the replies, which
+    may arrive out of order when a handler completes asynchronously.  If
+    the command FIFO is full, the command is rejected with an
+    ERROR_PROT_BUSY error carrying the same tag and should be resent.
+
+    BATCH MESSAGES
+    ==============
+
+    Several small commands can be packed into one Batch message (0x50):
+    the 'cmd_id' field holds the number of messages, and the payload holds
+    complete commands back to back (4 header bytes + payload each).
+    prot_task runs them back to back, and packs the responses and 3 byte
+    error messages into Batch messages the same way.
+
+    STREAMING ALERTS
+    ================
+
+    Instead of polling with repeated commands, the host can subscribe to
+    topics registered by the firmware (SUBSCRIBE/UNSUBSCRIBE commands),
+    and the device will push batched Alert messages at the requested rate
+    or on change.  See prot_alert.c for details.
+
+    BULK TRANSFERS
+    ==============
+
+    Commands that need to return more than 60 bytes (memory dumps, sensor
+    logs, etc.) can start a bulk transfer via prot_xfer_start, and return
+    the transfer ID in their response payload.  The data is then streamed
+    by prot_task using Data messages (0x30), while the host controls the
+    flow and requests selective retransmits with Data Ack messages (0x31).
+    See prot_xfer.c for the exact message layout.
+
+    Only one transfer can be active at a time.  The host can cancel it
+    with the XFERABORT command, and the device abandons it by itself
+    after PROT_XFER_MAX_RETRIES retransmit timeouts in a row without an
+    ack (the host went away mid-transfer), so that the next transfer
+    isn't rejected with ERROR_PROT_BUSY forever.
+
+    BYTE STREAM TRANSPORTS
+    ======================
+
+    With CFG_PROTOCOL_VIA_UART or CFG_PROTOCOL_VIA_CDC, the same messages
+    are sent over a byte stream.  Each message is trimmed to its real size
+    (4 header bytes + payload), followed by a CRC16, COBS encoded and
+    terminated with a 0x00 delimiter, so the receiver can resynchronise
+    on the next delimiter after any lost or corrupted byte.  See
+    prot_stream.c for details.
+
 */
 
 #include "projectconfig.h"
 
 #ifdef CFG_PROTOCOL
 
+#include <string.h>
 #include "protocol.h"
+#include "prot_alert.h"
 #include "core/fifo/fifo.h"
+#include "core/delay/delay.h"
 
 /* Callback functions to let us know when new data arrives via USB, etc. */
 #if defined(CFG_PROTOCOL_VIA_HID)
@@ -229,6 +288,18 @@
 #elif defined(CFG_PROTOCOL_VIA_BULK)
   #define command_received_isr  usb_custom_received_isr
   #define command_send          usb_custom_send
+#elif defined(CFG_PROTOCOL_VIA_UART) || defined(CFG_PROTOCOL_VIA_CDC)
+  /* Byte stream transports: messages are COBS/CRC16 framed and parsed
+     in prot_task rather than delivered as complete reports            */
+  #define PROT_VIA_STREAM
+  #define command_send          prot_stream_send
+  #include "prot_stream.h"
+  #if defined(CFG_PROTOCOL_VIA_UART)
+    #include "core/uart/uart.h"
+  #else
+    #include "core/usb/usb_cdc.h"
+    #include "core/usb/usbd.h"
+  #endif
 #endif
 
 #define U16_HIGH_U8(u16)  ((uint8_t) (((u16) >> 8) & 0x00FF))
@@ -255,11 +326,24 @@ typedef err_t (* const protCmdFunc_t)(uint8_t, uint8_t const [], protMsgResponse
     Expands the function to have the standard function signature
 */
 /**************************************************************************/
-#define CMD_PROTOTYPE_EXPAND(command, function) \
+#define CMD_PROTOTYPE_EXPAND(command, function, min_length, max_length) \
   err_t function(uint8_t length, uint8_t const payload[], protMsgResponse_t* mess_response);\
 
 PROTOCOL_COMMAND_TABLE(CMD_PROTOTYPE_EXPAND);
 
+/**************************************************************************/
+/*!
+    Command lookup table entry
+*/
+/**************************************************************************/
+typedef struct
+{
+  uint16_t      cmd_id;
+  uint8_t       min_length;   /**< Min payload length accepted by the handler */
+  uint8_t       max_length;   /**< Max payload length accepted by the handler */
+  protCmdFunc_t function;
+} protCmdEntry_t;
+
 /**************************************************************************/
 /*
     Expands the command/function combination to something that we can
@@ -267,8 +351,8 @@ PROTOCOL_COMMAND_TABLE(CMD_PROTOTYPE_EXPAND);
     the full function signature)
 */
 /**************************************************************************/
-#define CMD_LOOKUP_EXPAND(command, function)\
-  [command] = function,\
+#define CMD_LOOKUP_EXPAND(command, function, min_length, max_length)\
+  { command, min_length, max_length, function },\
 
 /**************************************************************************/
 /*!
@@ -279,32 +363,553 @@ PROTOCOL_COMMAND_TABLE(CMD_PROTOTYPE_EXPAND);
     header file so that you can more easily change the support command
     list from project to project without changing the underlying
     protocol code and files.
+
+    Entries are sorted by command ID (see prot_cmdtable.h), so the IDs
+    can be sparse and the table only takes one entry per command.
 */
 /**************************************************************************/
-static protCmdFunc_t protocol_cmd_tbl[] =
+static const protCmdEntry_t protocol_cmd_tbl[] =
 {
   PROTOCOL_COMMAND_TABLE(CMD_LOOKUP_EXPAND)
 };
 
-/* FIFO buffer for incoming commands (Note: 64 bytes per command) */
-#define CMD_FIFO_DEPTH 4
+#define PROT_CMD_COUNT  (sizeof(protocol_cmd_tbl) / sizeof(protCmdEntry_t))
+
+/**************************************************************************/
+/*!
+    @brief      Finds a command in the lookup table (binary search)
+
+    @returns    The table entry, or NULL for an unknown command ID
+*/
+/**************************************************************************/
+static protCmdEntry_t const * prot_cmd_lookup(uint16_t command_id)
+{
+  uint16_t low  = 0;
+  uint16_t high = PROT_CMD_COUNT;
+
+  while (low < high)
+  {
+    uint16_t mid = (low + high) / 2;
+
+    if (protocol_cmd_tbl[mid].cmd_id == command_id)
+    {
+      return &protocol_cmd_tbl[mid];
+    }
+    else if (protocol_cmd_tbl[mid].cmd_id < command_id)
+    {
+      low = mid + 1;
+    }
+    else
+    {
+      high = mid;
+    }
+  }
+
+  return NULL;
+}
 
+/* Bulk transfer settings: max frames sent per prot_task call, and the
+   delay (in delayGetTicks units) without an ack before retransmitting */
+#define PROT_XFER_FRAMES_PER_TASK   (4)
+#define PROT_XFER_TIMEOUT           (100)
+
+static protXferTx_t prot_xfer_tx;
+static uint16_t     prot_xfer_id;
+static uint32_t     prot_xfer_last_tick;
+
+/* Batch being run: its commands are run in prot_task until a reply
+   message has to be sent, and the rest of the batch waits for the
+   transport to be ready again                                       */
+static protMsgCommand_t prot_batch;
+static protMsgCommand_t prot_batch_reply;   /* Replies packed so far */
+static uint8_t          prot_batch_offset;  /* Next command in prot_batch */
+static uint16_t         prot_batch_count;   /* Replies in prot_batch_reply */
+static bool             prot_batch_active;
+static bool             prot_batch_single;  /* prot_batch_reply is a full response to send as is */
+
+/* FIFO buffer for incoming commands (Note: 64 bytes per command), with
+   room for a command per request tag so that a host using every tag
+   doesn't get ERROR_PROT_BUSY replies                                 */
+#define CMD_FIFO_DEPTH PROT_CMD_QUEUE_DEPTH
+
+/* Rejected commands only need one byte each, so keep enough of them for
+   every request tag (1..15) plus untagged commands to get a BUSY reply */
+#define BUSY_FIFO_DEPTH 16
+
+/* The command FIFO isn't overwritable: when it's full, new commands are
+   rejected and their message type (with the request tag) is kept in
+   ff_prot_busy so that prot_task can return ERROR_PROT_BUSY for them   */
 #if defined CFG_MCU_FAMILY_LPC11UXX
-  FIFO_DEF(ff_prot_cmd, CMD_FIFO_DEPTH, protMsgCommand_t, true , USB_IRQn);
+  FIFO_DEF(ff_prot_cmd, CMD_FIFO_DEPTH, protMsgCommand_t, false, USB_IRQn);
+  FIFO_DEF(ff_prot_busy, BUSY_FIFO_DEPTH, uint8_t, true , USB_IRQn);
 #elif defined CFG_MCU_FAMILY_LPC13UXX
-  FIFO_DEF(ff_prot_cmd, CMD_FIFO_DEPTH, protMsgCommand_t, true , USB_IRQ_IRQn);
+  FIFO_DEF(ff_prot_cmd, CMD_FIFO_DEPTH, protMsgCommand_t, false, USB_IRQ_IRQn);
+  FIFO_DEF(ff_prot_busy, BUSY_FIFO_DEPTH, uint8_t, true , USB_IRQ_IRQn);
 #else
   #error __FILE__ No MCU defined
 #endif
 
+#if defined(PROT_VIA_STREAM)
+static protStreamParser_t prot_stream_parser;
+static ErrorCode_t prot_stream_send(uint8_t const * p_data, uint32_t length);
+static void prot_stream_poll(void);
+#endif
+
+/**************************************************************************/
+/*!
+    @brief      Samples the built-in uptime topic
+*/
+/**************************************************************************/
+static uint8_t prot_alert_sample_uptime(uint8_t data[])
+{
+  uint32_t ticks = delayGetTicks();
+
+  memcpy(data, &ticks, sizeof(uint32_t));
+
+  return sizeof(uint32_t);
+}
+
 /**************************************************************************/
 /*!
     @brief      Initialises the simple binary protocol (FIFO init, etc.)
+
+    @note       This clears every alert topic and registers the built-in
+                ones, so firmware topics must be registered afterwards
 */
 /**************************************************************************/
 void prot_init(void)
 {
   fifo_clear(&ff_prot_cmd);
+  fifo_clear(&ff_prot_busy);
+  prot_batch_active = false;
+  prot_xfer_tx.active = false;
+  prot_alert_init();
+  prot_alert_register(PROT_ALERT_TOPIC_UPTIME, prot_alert_sample_uptime);
+  prot_alert_register(PROT_ALERT_TOPIC_SENSORALERT, NULL);
+
+#if defined(PROT_VIA_STREAM)
+  prot_stream_parser_init(&prot_stream_parser);
+#endif
+}
+
+/**************************************************************************/
+/*!
+    @brief      Checks if the transport can take another message right now.
+                Bulk transfers use a single IN endpoint for responses, data
+                and alert frames, and usb_custom_send fails if the previous
+                message hasn't been collected by the host yet (the other
+                transports block or buffer in command_send).
+*/
+/**************************************************************************/
+static bool prot_can_send(void)
+{
+#if defined(CFG_PROTOCOL_VIA_BULK)
+  return usb_custom_is_ready_to_send();
+#else
+  return true;
+#endif
+}
+
+/**************************************************************************/
+/*!
+    @brief      Sends a bulk transfer or alert frame, without blocking if
+                the transport is still busy with the previous one
+*/
+/**************************************************************************/
+static err_t prot_send_frame(uint8_t const * p_data, uint32_t length)
+{
+  if ( !prot_can_send() )
+  {
+    return ERROR_PROT_BUSY;
+  }
+
+  return (LPC_OK == command_send(p_data, length)) ? ERROR_NONE : ERROR_PROT_BUSY;
+}
+
+/**************************************************************************/
+/*!
+    @brief      Starts streaming a block of data to the host.  This is
+                normally called from a command handler, which then returns
+                the transfer ID to the host in its response payload.
+
+    @param[in]  size
+                Total number of bytes to send
+    @param[in]  read
+                Callback used to fetch each chunk (chunks may be read
+                more than once if they need to be retransmitted)
+    @param[out] p_xfer_id
+                ID placed in the header of every Data message
+
+    @returns    ERROR_PROT_BUSY if another transfer is still in progress
+*/
+/**************************************************************************/
+err_t prot_xfer_start(uint32_t size, protXferRead_t read, uint16_t * p_xfer_id)
+{
+  ASSERT( !prot_xfer_tx.active, ERROR_PROT_BUSY);
+
+  prot_xfer_id++;
+  ASSERT_STATUS( prot_xfer_tx_start(&prot_xfer_tx, prot_xfer_id, size, read, prot_send_frame) );
+
+  prot_xfer_last_tick = delayGetTicks();
+  *p_xfer_id = prot_xfer_id;
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief      Cancels the active bulk transfer
+
+    @param[in]  xfer_id
+                ID of the transfer, as returned by prot_xfer_start
+
+    @returns    ERROR_INVALIDPARAMETER if no transfer with this ID is
+                in progress (it may have completed or timed out already)
+*/
+/**************************************************************************/
+err_t prot_xfer_abort(uint16_t xfer_id)
+{
+  ASSERT( prot_xfer_tx.active && xfer_id == prot_xfer_tx.xfer_id, ERROR_INVALIDPARAMETER);
+
+  prot_xfer_tx_abort(&prot_xfer_tx);
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief      Streams the next few frames of the active bulk transfer,
+                and retransmits anything not acknowledged in time
+*/
+/**************************************************************************/
+static void prot_xfer_task(void)
+{
+  if ( !prot_xfer_tx.active )
+  {
+    return;
+  }
+
+  if ( delayGetTicks() - prot_xfer_last_tick > PROT_XFER_TIMEOUT )
+  {
+    prot_xfer_last_tick = delayGetTicks();
+    if ( ERROR_NONE != prot_xfer_tx_timeout(&prot_xfer_tx) )
+    {
+      /* No ack for too long, the transfer was abandoned */
+      return;
+    }
+  }
+
+  prot_xfer_tx_poll(&prot_xfer_tx, PROT_XFER_FRAMES_PER_TASK);
+}
+
+/**************************************************************************/
+/*!
+    @brief      Builds the response (or error message) for a command,
+                keeping the request tag of the original command, and
+                invokes the 'cmd_executed' or 'cmd_error' callback
+
+    @returns    The number of bytes used in 'reply'
+*/
+/**************************************************************************/
+static uint8_t prot_cmd_reply(protMsgResponse_t * p_response, err_t error, uint8_t reply[])
+{
+  if (error == ERROR_NONE)
+  {
+    /* Invoke the 'cmd_executed' callback */
+    if (prot_cmd_executed_cb)
+    {
+      prot_cmd_executed_cb(p_response);
+    }
+
+    if (p_response->length > PROT_MAX_MSG_SIZE-4)
+    {
+      p_response->length = PROT_MAX_MSG_SIZE-4;
+    }
+
+    memcpy(reply, p_response, 4 + p_response->length);
+    return 4 + p_response->length;
+  }
+  else
+  {
+    /* Something went wrong ... parse the error ID */
+    protMsgError_t message_error =
+    {
+      .msg_type      = PROT_MSGTYPE_ERROR | PROT_MSGTAG(p_response->msg_type),
+    };
+    message_error.error_id_high = U16_HIGH_U8(error);
+    message_error.error_id_low  = U16_LOW_U8 (error);
+
+    /* Invoke the 'cmd_error' callback */
+    if (prot_cmd_error_cb)
+    {
+      prot_cmd_error_cb(&message_error);
+    }
+
+    memcpy(reply, &message_error, sizeof(protMsgError_t));
+    return sizeof(protMsgError_t);
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief      Sends the response (or error message) for a command,
+                keeping the request tag of the original command
+*/
+/**************************************************************************/
+static void prot_cmd_respond(protMsgResponse_t * p_response, err_t error)
+{
+  uint8_t reply[PROT_MAX_MSG_SIZE] = { 0 };
+  uint8_t size;
+
+  size = prot_cmd_reply(p_response, error, reply);
+
+  /* Responses are always sent as a full message, errors are 3 bytes.
+     Callers check prot_can_send first, so this can't fail            */
+  command_send(reply, (error == ERROR_NONE) ? sizeof(protMsgResponse_t) : size);
+}
+
+/**************************************************************************/
+/*!
+    @brief      Completes a command whose handler returned
+                ERROR_PROT_PENDING, sending the response (or the error
+                message if 'error' isn't ERROR_NONE) to the host
+
+    @param[in]  p_response
+                Copy of the response message the handler received, with
+                the payload and length filled in.  The message type and
+                command ID must be left untouched so that the host can
+                match the response to its command using the request tag.
+    @param[in]  error
+                Final status of the command
+
+    @returns    ERROR_PROT_BUSY if the transport is still busy with the
+                previous message, in which case nothing was sent and the
+                caller should try again later (from the main loop)
+
+    @code
+
+    static protMsgResponse_t pending_response;
+
+    err_t protcmd_slow(uint8_t length, uint8_t const payload[], protMsgResponse_t* mess_response)
+    {
+      // Keep the header (msg type + tag, cmd id) for later
+      pending_response = *mess_response;
+      startSlowOperation();
+
+      return ERROR_PROT_PENDING;
+    }
+
+    void slowOperationDone(uint8_t result)
+    {
+      pending_response.length     = 1;
+      pending_response.payload[0] = result;
+      while ( ERROR_PROT_BUSY == prot_cmd_complete(&pending_response, ERROR_NONE) )
+      {
+        prot_task(NULL);
+      }
+    }
+
+    @endcode
+*/
+/**************************************************************************/
+err_t prot_cmd_complete(protMsgResponse_t * p_response, err_t error)
+{
+  ASSERT( PROT_MSGTYPE_RESPONSE == (p_response->msg_type & PROT_MSGTYPE_MASK), ERROR_PROT_INVALIDMSGTYPE);
+  ASSERT( error != ERROR_PROT_PENDING, ERROR_INVALIDPARAMETER);
+  ASSERT( prot_can_send(), ERROR_PROT_BUSY);
+
+  prot_cmd_respond(p_response, error);
+
+  return ERROR_NONE;
+}
+
+/**************************************************************************/
+/*!
+    @brief      Validates a command and fires its handler, after filling
+                in the response header (msg type + request tag, cmd id)
+
+    @returns    The handler's error code (ERROR_PROT_PENDING if the
+                handler will complete the command later)
+*/
+/**************************************************************************/
+static err_t prot_cmd_execute(protMsgCommand_t const * p_cmd, protMsgResponse_t * p_response)
+{
+  /* Command_id is at an odd address ... directly using the value in *
+   * the message can lead to alignment issues on the M0              */
+  uint16_t command_id = (p_cmd->cmd_id_high << 8) + p_cmd->cmd_id_low;
+  protCmdEntry_t const * p_entry;
+
+  /* Keep track of the command ID and request tag for the response */
+  p_response->msg_type    = PROT_MSGTYPE_RESPONSE;
+  p_response->cmd_id_high = p_cmd->cmd_id_high;
+  p_response->cmd_id_low  = p_cmd->cmd_id_low;
+  if ( PROT_MSGTYPE_COMMAND == (p_cmd->msg_type & PROT_MSGTYPE_MASK) )
+  {
+    p_response->msg_type |= PROT_MSGTAG(p_cmd->msg_type);
+  }
+
+  /* Make sure we have a command with a valid ID */
+  if ( !(PROT_MSGTYPE_COMMAND == (p_cmd->msg_type & PROT_MSGTYPE_MASK)) )
+  {
+    return ERROR_PROT_INVALIDMSGTYPE;
+  }
+  else if ( NULL == (p_entry = prot_cmd_lookup(command_id)) )
+  {
+    return ERROR_PROT_INVALIDCOMMANDID;
+  }
+  else if (p_cmd->length > (PROT_MAX_MSG_SIZE-4))
+  {
+    return ERROR_INVALIDPARAMETER;
+  }
+  else if (p_cmd->length < p_entry->min_length || p_cmd->length > p_entry->max_length)
+  {
+    return ERROR_PROT_INVALIDPAYLOAD;
+  }
+
+  /* Invoke 'cmd_received' callback before executing command */
+  if (prot_cmd_received_cb)
+  {
+    prot_cmd_received_cb(p_cmd);
+  }
+
+  /* Fire the appropriate handler based on the command ID */
+  return p_entry->function ( p_cmd->length, p_cmd->payload, p_response );
+}
+
+/**************************************************************************/
+/*!
+    @brief      Sends the batch message with the replies packed so far
+*/
+/**************************************************************************/
+static void prot_batch_send(void)
+{
+  prot_batch_reply.cmd_id_high = U16_HIGH_U8(prot_batch_count);
+  prot_batch_reply.cmd_id_low  = U16_LOW_U8 (prot_batch_count);
+  command_send( (uint8_t*) &prot_batch_reply, sizeof(protMsgCommand_t));
+
+  memset(prot_batch_reply.payload, 0, sizeof(prot_batch_reply.payload));
+  prot_batch_reply.length = 0;
+  prot_batch_count = 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief      Starts running the commands packed in a batch message
+*/
+/**************************************************************************/
+static void prot_batch_start(protMsgCommand_t const * p_batch)
+{
+  if ( p_batch->length == 0 || p_batch->length > (PROT_MAX_MSG_SIZE-4) )
+  {
+    protMsgResponse_t message_invalid = { .msg_type = PROT_MSGTYPE_RESPONSE | PROT_MSGTAG(p_batch->msg_type) };
+    prot_cmd_respond(&message_invalid, ERROR_PROT_INVALIDPAYLOAD);
+    return;
+  }
+
+  memcpy(&prot_batch, p_batch, sizeof(protMsgCommand_t));
+  memset(&prot_batch_reply, 0, sizeof(protMsgCommand_t));
+  prot_batch_reply.msg_type = PROT_MSGTYPE_BATCH | PROT_MSGTAG(p_batch->msg_type);
+  prot_batch_offset = 0;
+  prot_batch_count  = 0;
+  prot_batch_single = false;
+  prot_batch_active = true;
+}
+
+/**************************************************************************/
+/*!
+    @brief      Runs the next commands of the active batch back to back,
+                and packs their responses and error messages into batch
+                messages the same way (using as few messages as possible).
+                Returns after each message sent, and must only be called
+                when prot_can_send is true.
+*/
+/**************************************************************************/
+static void prot_batch_task(void)
+{
+  protMsgCommand_t  message_cmd;
+  protMsgResponse_t message_response;
+  uint8_t           reply[PROT_MAX_MSG_SIZE];
+  uint8_t           size;
+  err_t             error;
+
+  /* A response with a full 60 byte payload is sent on its own, after the
+     replies packed before it                                            */
+  if (prot_batch_single)
+  {
+    command_send( (uint8_t*) &prot_batch_reply, sizeof(protMsgResponse_t));
+    memset(&prot_batch_reply, 0, sizeof(protMsgCommand_t));
+    prot_batch_reply.msg_type = PROT_MSGTYPE_BATCH | PROT_MSGTAG(prot_batch.msg_type);
+    prot_batch_single = false;
+    return;
+  }
+
+  while (prot_batch_offset < prot_batch.length)
+  {
+    uint8_t remaining = prot_batch.length - prot_batch_offset;
+
+    memset(&message_cmd, 0, sizeof(protMsgCommand_t));
+    memset(&message_response, 0, sizeof(protMsgResponse_t));
+
+    /* Every command needs its header and full payload in the batch,
+       otherwise the rest of the batch is rejected with the batch tag */
+    if ( remaining < 4 || remaining < 4 + prot_batch.payload[prot_batch_offset+3] )
+    {
+      message_response.msg_type = PROT_MSGTYPE_RESPONSE | PROT_MSGTAG(prot_batch.msg_type);
+      error = ERROR_PROT_INVALIDPAYLOAD;
+      prot_batch_offset = prot_batch.length;
+    }
+    else
+    {
+      memcpy(&message_cmd, &prot_batch.payload[prot_batch_offset], 4 + prot_batch.payload[prot_batch_offset+3]);
+      prot_batch_offset += 4 + message_cmd.length;
+
+      error = prot_cmd_execute(&message_cmd, &message_response);
+      if (error == ERROR_PROT_PENDING)
+      {
+        continue;
+      }
+    }
+
+    size = prot_cmd_reply(&message_response, error, reply);
+
+    /* Send what we have so far if this reply doesn't fit */
+    if (prot_batch_reply.length + size > PROT_MAX_MSG_SIZE-4)
+    {
+      if (prot_batch_count == 0)
+      {
+        /* Nothing packed yet, so this is a full response */
+        command_send(reply, sizeof(protMsgResponse_t));
+        return;
+      }
+
+      prot_batch_send();
+
+      /* The transport is busy until the next call now */
+      if (size > PROT_MAX_MSG_SIZE-4)
+      {
+        memcpy(&prot_batch_reply, reply, sizeof(protMsgResponse_t));
+        prot_batch_single = true;
+      }
+      else
+      {
+        memcpy(prot_batch_reply.payload, reply, size);
+        prot_batch_reply.length = size;
+        prot_batch_count = 1;
+      }
+      return;
+    }
+
+    memcpy(&prot_batch_reply.payload[prot_batch_reply.length], reply, size);
+    prot_batch_reply.length += size;
+    prot_batch_count++;
+  }
+
+  if (prot_batch_count)
+  {
+    prot_batch_send();
+  }
+
+  prot_batch_active = false;
 }
 
 /**************************************************************************/
@@ -313,6 +918,12 @@ void prot_init(void)
                 protocol to process in the FIFO, and hands them off to the
                 command parser if anything was found
 
+    Commands can be pipelined by the host: each command may carry a
+    request tag (1..15) in the low nibble of its message type, which is
+    copied into the matching response or error message.  Handlers that
+    return ERROR_PROT_PENDING complete later via prot_cmd_complete, so
+    their responses can arrive after those of later commands.
+
     @code
 
     // Note: Assumes CFG_PROTOCOL is defined in the board config file!
@@ -334,89 +945,174 @@ void prot_init(void)
 /**************************************************************************/
 void prot_task(void * p_para)
 {
-  if ( !fifo_isEmpty(&ff_prot_cmd) )
+  uint8_t busy_msg_type;
+
+#if defined(PROT_VIA_STREAM)
+  /* Parse any bytes received since the last call */
+  prot_stream_poll();
+#endif
+
+  /* Every command gets a reply message, so commands are only taken
+     from the FIFO when the transport is ready to send it.  A batch
+     that is still running goes first, to keep the replies in order.  */
+  while ( prot_batch_active && prot_can_send() )
+  {
+    prot_batch_task();
+  }
+
+  /* Commands that didn't fit in the FIFO are rejected (rather than
+     silently overwriting older ones) so the host can send them again */
+  if ( !prot_batch_active && prot_can_send() && fifo_read(&ff_prot_busy, &busy_msg_type) )
+  {
+    protMsgResponse_t message_busy = { .msg_type = PROT_MSGTYPE_RESPONSE | PROT_MSGTAG(busy_msg_type) };
+    prot_cmd_respond(&message_busy, ERROR_PROT_BUSY);
+  }
+
+  if ( !prot_batch_active && prot_can_send() && !fifo_isEmpty(&ff_prot_cmd) )
   {
     /* If we get here, it means a command was received */
     protMsgCommand_t  message_cmd     = { 0 };
     protMsgResponse_t message_reponse = { 0 };
-    uint16_t          command_id;
-    err_t           error;
+    err_t             error;
 
     /* COMMAND PHASE */
     fifo_read(&ff_prot_cmd, &message_cmd);
 
-    /* Command_id is at an odd address ... directly using the value in *
-     * message_cmd can lead to alignment issues on the M0              */
-    command_id = (message_cmd.cmd_id_high << 8) + message_cmd.cmd_id_low;
-
-    /* Make sure we have a command with a valid ID */
-    if ( !(PROT_MSGTYPE_COMMAND == message_cmd.msg_type) )
+    /* Flow control for the active bulk transfer (no response required,
+       and stale acks from an earlier transfer are silently dropped) */
+    if (PROT_MSGTYPE_DATA_ACK == message_cmd.msg_type)
     {
-      error = ERROR_PROT_INVALIDMSGTYPE;
-    }
-    else if ( !(0 < command_id && command_id < PROT_CMDTYPE_COUNT) )
-    {
-      error = ERROR_PROT_INVALIDCOMMANDID;
+      if ( ERROR_NONE == prot_xfer_tx_ack(&prot_xfer_tx, (uint8_t const *) &message_cmd) )
+      {
+        prot_xfer_last_tick = delayGetTicks();
+      }
+      prot_xfer_task();
+      return;
     }
-    else if (message_cmd.length > (PROT_MAX_MSG_SIZE-4))
+
+    if ( PROT_MSGTYPE_BATCH == (message_cmd.msg_type & PROT_MSGTYPE_MASK) )
     {
-      error = ERROR_INVALIDPARAMETER;
+      /* Several commands packed in one message */
+      prot_batch_start(&message_cmd);
+      while ( prot_batch_active && prot_can_send() )
+      {
+        prot_batch_task();
+      }
     }
     else
     {
-      /* Keep track of the command ID for the response message */
-      message_reponse.msg_type    = PROT_MSGTYPE_RESPONSE;
-      message_reponse.cmd_id_high = message_cmd.cmd_id_high;
-      message_reponse.cmd_id_low  = message_cmd.cmd_id_low;
+      error = prot_cmd_execute(&message_cmd, &message_reponse);
 
-      /* Invoke 'cmd_received' callback before executing command */
-      if (prot_cmd_received_cb)
+      /* RESPONSE PHASE (unless the handler will complete it later) */
+      if (error != ERROR_PROT_PENDING)
       {
-        prot_cmd_received_cb(&message_cmd);
+        prot_cmd_respond(&message_reponse, error);
       }
-
-      /* Fire the appropriate handler based on the command ID */
-      error = protocol_cmd_tbl[command_id] ( message_cmd.length, message_cmd.payload, &message_reponse );
     }
+  }
 
-    /* RESPONSE PHASE */
+  /* DATA PHASE */
+  prot_xfer_task();
 
-    // TODO:  Make sure the usb command is ready to send
-    // in case there are a bunch of cmds queued in FIFO
+  /* ALERT PHASE (subscribed topics and queued events) */
+  if ( prot_alert_is_active() )
+  {
+    prot_alert_task(delayGetTicks(), prot_send_frame);
+  }
+}
 
-    if (error == ERROR_NONE)
+/**************************************************************************/
+/*!
+    Queues an incoming message for processing by prot_task.  If the FIFO
+    is full the command is dropped, and prot_task replies with
+    ERROR_PROT_BUSY (using the same request tag).
+*/
+/**************************************************************************/
+static void prot_cmd_enqueue(uint8_t const * p_data)
+{
+  if ( !fifo_write(&ff_prot_cmd, p_data) )
+  {
+    if ( PROT_MSGTYPE_COMMAND == (p_data[0] & PROT_MSGTYPE_MASK) ||
+         PROT_MSGTYPE_BATCH   == (p_data[0] & PROT_MSGTYPE_MASK) )
     {
-      /* Invoke the 'cmd_executed' callback */
-      if (prot_cmd_executed_cb)
-      {
-        prot_cmd_executed_cb(&message_reponse);
-      }
+      fifo_write(&ff_prot_busy, &p_data[0]);
+    }
+  }
+}
+
+#if defined(PROT_VIA_STREAM)
+
+/**************************************************************************/
+/*!
+    Sends a message as a COBS/CRC16 frame over the UART or CDC link
+    (only the used part of the message is sent, the receiver pads it
+    back to PROT_MAX_MSG_SIZE bytes)
+*/
+/**************************************************************************/
+static ErrorCode_t prot_stream_send(uint8_t const * p_data, uint32_t length)
+{
+  uint8_t frame[PROT_STREAM_MAX_ENCODED];
+  uint8_t size;
+
+  if (length == PROT_MAX_MSG_SIZE && p_data[3] <= PROT_MAX_MSG_SIZE-4)
+  {
+    length = 4 + p_data[3];
+  }
+
+  size = prot_stream_encode(p_data, (uint8_t) length, frame);
+  if (size == 0)
+  {
+    return ERR_FAILED;
+  }
+
+#if defined(CFG_PROTOCOL_VIA_UART)
+  uartSend(frame, size);
+  return LPC_OK;
+#else
+  return (usb_cdc_send(frame, size) == size) ? LPC_OK : ERR_FAILED;
+#endif
+}
 
-      /* Send the response message (cmd successfully executed) */
-      command_send( (uint8_t*) &message_reponse, sizeof(protMsgResponse_t));
+/**************************************************************************/
+/*!
+    Reads any pending bytes from the UART or CDC buffer and hands them to
+    the incremental frame parser.  Reading stops while the command FIFO
+    is full, so that the remaining bytes wait in the UART/CDC buffer
+    rather than being dropped.
+*/
+/**************************************************************************/
+static void prot_stream_poll(void)
+{
+  uint8_t c;
+  uint8_t length;
+
+  while ( !fifo_isFull(&ff_prot_cmd) )
+  {
+#if defined(CFG_PROTOCOL_VIA_UART)
+    if ( !uartRxBufferDataPending() )
+    {
+      break;
     }
-    else
+    c = uartRxBufferRead();
+#else
+    if ( !usb_isConfigured() || !usb_cdc_getc(&c) )
     {
-      /* Something went wrong ... parse the error ID */
-      protMsgError_t message_error =
-      {
-        .msg_type      = PROT_MSGTYPE_ERROR,
-      };
-      message_error.error_id_high = U16_HIGH_U8(error);
-      message_error.error_id_low  = U16_LOW_U8 (error);
-
-      /* Invoke the 'cmd_error' callback */
-      if (prot_cmd_error_cb)
-      {
-        prot_cmd_error_cb(&message_error);
-      }
+      break;
+    }
+#endif
 
-      /* Send back a mandatory error message */
-      command_send( (uint8_t*)  &message_error, sizeof(protMsgError_t));
+    length = prot_stream_parse(&prot_stream_parser, c);
+    if (length)
+    {
+      protMsgCommand_t message = { 0 };
+      memcpy(&message, prot_stream_parser.buffer, length);
+      prot_cmd_enqueue( (uint8_t const *) &message);
     }
   }
 }
 
+#else
+
 /**************************************************************************/
 /*!
     USB callback for incoming commands (the exact callback function
@@ -430,7 +1126,9 @@ void prot_task(void * p_para)
 /**************************************************************************/
 void command_received_isr(uint8_t * p_data, uint32_t length)
 {
-  fifo_write(&ff_prot_cmd, p_data);
+  prot_cmd_enqueue(p_data);
 }
 
 #endif
+
+#endif
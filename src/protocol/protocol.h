@@ -38,6 +38,7 @@
 
 #include "projectconfig.h"
 #include "prot_cmdtable.h"
+#include "prot_xfer.h"
 #include "core/usb/usb_hid.h"
 #include "core/usb/usb_custom_class.h"
 
@@ -59,10 +60,25 @@ typedef enum
 {
   PROT_MSGTYPE_COMMAND          = 0x10,
   PROT_MSGTYPE_RESPONSE         = 0x20,
+  PROT_MSGTYPE_DATA             = 0x30,
+  PROT_MSGTYPE_DATA_ACK         = 0x31,
   PROT_MSGTYPE_ALERT            = 0x40,
+  PROT_MSGTYPE_BATCH            = 0x50,
   PROT_MSGTYPE_ERROR            = 0x80
 } protMsgType_t;
 
+/* Commands can carry a request tag (1..15, 0 = untagged) in the low
+   nibble of the message type, which is copied into the response or error
+   message so that the host can keep several commands in flight         */
+#define PROT_MSGTYPE_MASK     (0xF0)
+#define PROT_MSGTAG_MASK      (0x0F)
+#define PROT_MSGTAG(msg_type) ((msg_type) & PROT_MSGTAG_MASK)
+
+/* Commands the device queues before replying ERROR_PROT_BUSY (one per
+   request tag), which is also the most commands a host should keep in
+   flight                                                               */
+#define PROT_CMD_QUEUE_DEPTH  (15)
+
 /**************************************************************************/
 /*!
     Command message struct
@@ -97,6 +113,15 @@ typedef protMsgCommand_t protMsgResponse_t;
 /**************************************************************************/
 typedef protMsgCommand_t protMsgAlert_t;
 
+/**************************************************************************/
+/*!
+    Batch message struct: the 'cmd_id' field holds the number of packed
+    messages, and the payload holds the messages back to back (commands
+    from the host, responses and 3 byte error messages from the device)
+*/
+/**************************************************************************/
+typedef protMsgCommand_t protMsgBatch_t;
+
 /**************************************************************************/
 /*!
     Error message struct
@@ -120,6 +145,9 @@ STATIC_ASSERT(sizeof(protMsgError_t) == 3);
 //--------------------------------------------------------------------+
 void prot_task(void * p_para);
 void prot_init(void);
+err_t prot_xfer_start(uint32_t size, protXferRead_t read, uint16_t * p_xfer_id);
+err_t prot_xfer_abort(uint16_t xfer_id);
+err_t prot_cmd_complete(protMsgResponse_t * p_response, err_t error);
 
 //--------------------------------------------------------------------+
 // Callback API
@@ -0,0 +1,758 @@
+/**************************************************************************/
+/*!
+    @file     hostbench.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Host micro-benchmarks for the core data structures and
+              algorithms
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+/*  The firmware sources are built for the simulator board with _TEST_
+    defined (see the Makefile), and each benchmark runs one hot path a
+    fixed number of times.  core/libc/stdio.c is built with its public
+    functions renamed to fw_*, so that it can be linked next to the host
+    C library.
+
+    Usage: hostbench [-l] [-j] [-s <scale>] [-c <baseline.csv>]
+                     [-t <percent>] [-p <dir>] [<name prefix> ...]
+
+      -l   Lists the benchmarks and exits
+      -j   Writes JSON (one object per line) instead of CSV
+      -s   Multiplies the number of iterations of every benchmark
+      -c   Compares the results with a previous CSV run, and reports every
+           benchmark that is slower than the baseline by more than the
+           tolerance, or whose checksum differs (a change in behaviour)
+      -t   Tolerance for -c in percent (default 25)
+      -p   Writes the last frame of each draw/ benchmark to <dir>/<name>.ppm
+
+    Only the benchmarks starting with one of the name prefixes are run, if
+    any are given.  The results are written to stdout as:
+
+      name,iterations,ns_per_op,checksum
+
+    The time is the best of several runs, since the host is rarely idle,
+    and the checksum is derived from the results of the code under test
+    so that the work can't be optimised away.  The exit code is the number
+    of regressions found with -c.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "projectconfig.h"
+#include "fixed.h"
+#include "core/fifo/fifo.h"
+#include "drivers/filters/ringbuffer.h"
+#include "drivers/filters/iir/iir_f.h"
+#include "drivers/filters/iir/iir_i.h"
+#include "drivers/filters/iir/iir_u16.h"
+#include "drivers/filters/ma/sma_f.h"
+#include "drivers/filters/ma/sma_i.h"
+#include "drivers/filters/ma/sma_u16.h"
+#include "drivers/filters/ma/wma_f.h"
+#include "drivers/filters/ma/wma_i.h"
+#include "drivers/filters/ma/wma_u16.h"
+#include "drivers/rtc/rtc.h"
+#include "drivers/rf/nfc/pn532/helpers/pn532_ndef.h"
+#include "drivers/displays/graphic/drawing.h"
+#include "drivers/displays/graphic/aafonts.h"
+#include "drivers/displays/graphic/aafonts/aa2/DejaVuSansCondensed14_AA2.h"
+#include "drivers/displays/graphic/hw/simlcd.h"
+
+signed int fw_snprintf(char *pString, size_t length, const char *pFormat, ...);
+
+/* vprintf isn't benchmarked, but stdio.c needs an output */
+signed int fw_puts(const char *str) { return 0; }
+
+#define RUNS          (5)
+#define MAXBENCHMARKS (64)
+
+typedef uint32_t (*benchFn_t)(uint32_t iterations);
+
+typedef struct
+{
+  const char *name;
+  uint32_t    iterations;   /**< Iterations at scale 1 */
+  benchFn_t   fn;           /**< Runs the hot path, returns a checksum */
+} benchmark_t;
+
+typedef struct
+{
+  char     name[48];
+  uint32_t iterations;
+  double   nsPerOp;
+  uint32_t checksum;
+} baseline_t;
+
+/* Input data shared by the benchmarks, filled in main() */
+#define SAMPLES (256)
+static int32_t  samples[SAMPLES];
+static float    samplesf[SAMPLES];
+
+static uint32_t floatBits(float value)
+{
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+/**************************************************************************/
+/*!
+    @brief  FIFO and ring buffer
+*/
+/**************************************************************************/
+FIFO_DEF(ffWords, 64, uint32_t, false, 0);
+FIFO_DEF(ffBytes, 256, uint8_t, true, 0);
+RINGBUFFER_DEF(rbWords, 64, uint32_t);
+
+static uint32_t benchFifoWriteRead(uint32_t iterations)
+{
+  uint32_t i, value, sum = 0;
+
+  fifo_clear(&ffWords);
+  for (i = 0; i < iterations; i++)
+  {
+    // Keep the FIFO half full, so that the indices wrap around
+    fifo_write(&ffWords, &i);
+    if (fifo_getLength(&ffWords) > 32)
+    {
+      fifo_read(&ffWords, &value);
+      sum += value;
+    }
+  }
+
+  return sum;
+}
+
+static uint32_t benchFifoArray(uint32_t iterations)
+{
+  uint8_t data[48], out[48];
+  uint32_t i, sum = 0;
+
+  memset(data, 0x5A, sizeof(data));
+  fifo_clear(&ffBytes);
+  for (i = 0; i < iterations; i++)
+  {
+    data[0] = (uint8_t) i;
+    fifo_writeArray(&ffBytes, data, sizeof(data));
+    sum += fifo_readArray(&ffBytes, out, 40);
+    sum += out[0];
+  }
+
+  return sum;
+}
+
+static uint32_t benchRingbufferWritePeek(uint32_t iterations)
+{
+  uint32_t i, value, sum = 0;
+
+  rbWords.wr_idx = 0;
+  for (i = 0; i < iterations; i++)
+  {
+    ringbuffer_write(&rbWords, &i);
+    ringbuffer_peek(&rbWords, (uint16_t) (i * 7 % 64), &value);
+    sum += value;
+  }
+
+  return sum;
+}
+
+/**************************************************************************/
+/*!
+    @brief  IIR filters
+*/
+/**************************************************************************/
+static uint32_t benchIirF(uint32_t iterations)
+{
+  iir_f_t iir;
+  uint32_t i;
+
+  iir_f_init(&iir, 0.1F);
+  for (i = 0; i < iterations; i++)
+  {
+    iir_f_add(&iir, samplesf[i % SAMPLES]);
+  }
+
+  return floatBits(iir.avg);
+}
+
+static uint32_t benchIirI(uint32_t iterations)
+{
+  iir_i_t iir;
+  uint32_t i;
+
+  iir_i_init(&iir, 25);
+  for (i = 0; i < iterations; i++)
+  {
+    iir_i_add(&iir, samples[i % SAMPLES]);
+  }
+
+  return (uint32_t) iir.avg;
+}
+
+static uint32_t benchIirU16(uint32_t iterations)
+{
+  iir_u16_t iir;
+  uint32_t i;
+
+  iir_u16_init(&iir, 25);
+  for (i = 0; i < iterations; i++)
+  {
+    iir_u16_add(&iir, (uint16_t) samples[i % SAMPLES]);
+  }
+
+  return (uint32_t) iir.avg;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Simple and weighted moving averages (16 sample window, with
+            linearly increasing weights for the WMA)
+*/
+/**************************************************************************/
+static float   wmaWeightsF[16] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+static uint8_t wmaWeights[16]  = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+#define MA_BENCH(fnName, type, init, add, buftype, sample, result, weights) \
+  static uint32_t fnName(uint32_t iterations)                         \
+  {                                                                   \
+    buftype buffer[16];                                               \
+    type ma = { .k = 0, .size = 16, .buffer = buffer, weights };      \
+    uint32_t i;                                                       \
+                                                                      \
+    init(&ma);                                                        \
+    for (i = 0; i < iterations; i++)                                  \
+    {                                                                 \
+      add(&ma, sample);                                               \
+    }                                                                 \
+                                                                      \
+    return result;                                                    \
+  }
+
+MA_BENCH(benchSmaF,   sma_f_t,   sma_f_init,   sma_f_add,   float,    samplesf[i % SAMPLES],           floatBits(ma.avg), )
+MA_BENCH(benchSmaI,   sma_i_t,   sma_i_init,   sma_i_add,   int32_t,  samples[i % SAMPLES],            (uint32_t) ma.avg, )
+MA_BENCH(benchSmaU16, sma_u16_t, sma_u16_init, sma_u16_add, uint16_t, (uint16_t) samples[i % SAMPLES], (uint32_t) ma.avg, )
+MA_BENCH(benchWmaF,   wma_f_t,   wma_f_init,   wma_f_add,   float,    samplesf[i % SAMPLES],           floatBits(ma.avg), .weight = wmaWeightsF)
+MA_BENCH(benchWmaI,   wma_i_t,   wma_i_init,   wma_i_add,   int32_t,  samples[i % SAMPLES],            (uint32_t) ma.avg, .weight = wmaWeights)
+MA_BENCH(benchWmaU16, wma_u16_t, wma_u16_init, wma_u16_add, uint16_t, (uint16_t) samples[i % SAMPLES], (uint32_t) ma.avg, .weight = wmaWeights)
+
+/**************************************************************************/
+/*!
+    @brief  Fixed point arithmetic
+*/
+/**************************************************************************/
+static uint32_t benchFixedMul(uint32_t iterations)
+{
+  fixed_t acc = 0;
+  uint32_t i;
+
+  for (i = 0; i < iterations; i++)
+  {
+    // Multiply-accumulate, as in a FIR filter or a calibration matrix
+    acc = fixed_add(acc, fixed_mul(fixed_make(samplesf[i % SAMPLES]), 0x00008000));
+  }
+
+  return (uint32_t) acc;
+}
+
+static uint32_t benchFixedDiv(uint32_t iterations)
+{
+  fixed_t acc = 0, x;
+  uint32_t i;
+
+  for (i = 0; i < iterations; i++)
+  {
+    // The fixed_* macros don't parenthesise their arguments
+    x = fixed_make(samplesf[i % SAMPLES]);
+    acc = fixed_add(acc, fixed_div(x, fixed_make(3.5)));
+  }
+
+  return (uint32_t) acc;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Formatting (core/libc/stdio.c)
+*/
+/**************************************************************************/
+static uint32_t benchSnprintfInt(uint32_t iterations)
+{
+  char buffer[64];
+  uint32_t i, sum = 0;
+
+  for (i = 0; i < iterations; i++)
+  {
+    int k = i % (SAMPLES - 2);
+    sum += fw_snprintf(buffer, sizeof(buffer), "%d,%d,%d,%08X", samples[k],
+                       samples[k+1], samples[k+2], i);
+  }
+
+  return sum;
+}
+
+static uint32_t benchSnprintfFloat(uint32_t iterations)
+{
+  char buffer[64];
+  uint32_t i, sum = 0;
+
+  for (i = 0; i < iterations; i++)
+  {
+    int k = i % (SAMPLES - 2);
+    sum += fw_snprintf(buffer, sizeof(buffer), "%f,%f,%f", samplesf[k],
+                       samplesf[k+1], samplesf[k+2]);
+  }
+
+  return sum;
+}
+
+/**************************************************************************/
+/*!
+    @brief  RTC conversions
+*/
+/**************************************************************************/
+static uint32_t benchRtcFromEpoch(uint32_t iterations)
+{
+  rtcTime_t time;
+  uint32_t i, sum = 0;
+
+  for (i = 0; i < iterations; i++)
+  {
+    // Spread over 1970..2106, in steps of a bit more than a day
+    rtcCreateTimeFromEpoch(i * 90001u, &time);
+    sum += time.years + time.months + time.days + time.seconds;
+  }
+
+  return sum;
+}
+
+static uint32_t benchRtcToEpoch(uint32_t iterations)
+{
+  rtcTime_t time;
+  uint32_t i, sum = 0;
+
+  rtcCreateTime(2013, RTC_MONTHS_JANUARY, 1, 12, 0, 0, 0, &time);
+  for (i = 0; i < iterations; i++)
+  {
+    time.days = 1 + i % 28;
+    time.months = 1 + i % 12;
+    sum += rtcToEpochTime(&time);
+  }
+
+  return sum;
+}
+
+/**************************************************************************/
+/*!
+    @brief  NDEF records (pool allocated)
+*/
+/**************************************************************************/
+static uint8_t ndefType[] = { 'U' };
+static uint8_t ndefPayload[] = "\x01" "microbuilder.eu/projects/LPC11U_LPC13U_CodeBase";
+
+static uint32_t benchNdefSerialise(uint32_t iterations)
+{
+  pn532_ndef_record_t record;
+  uint32_t i, sum = 0;
+
+  for (i = 0; i < iterations; i++)
+  {
+    if (pn532_ndef_createFromValue(&record, 0x01, ndefType, sizeof(ndefType),
+                                   NULL, 0, ndefPayload, sizeof(ndefPayload) - 1))
+    {
+      return 0;
+    }
+    pn532_ndef_setMB(record);
+    pn532_ndef_setME(record);
+    sum += pn532_ndef_getLength(record) + pn532_ndef_getAll(record)[0];
+    pn532_ndef_destroy(record);
+  }
+
+  return sum;
+}
+
+static uint32_t benchNdefParse(uint32_t iterations)
+{
+  pn532_ndef_record_t record;
+  uint8_t raw[128];
+  uint32_t i, length, sum = 0;
+
+  // Serialise one record, then parse it back from the raw buffer
+  if (pn532_ndef_createFromValue(&record, 0x01, ndefType, sizeof(ndefType),
+                                 NULL, 0, ndefPayload, sizeof(ndefPayload) - 1))
+  {
+    return 0;
+  }
+  length = pn532_ndef_getLength(record);
+  memcpy(raw, pn532_ndef_getAll(record), length);
+  pn532_ndef_destroy(record);
+
+  for (i = 0; i < iterations; i++)
+  {
+    if (pn532_ndef_createFromRaw(&record, raw, length))
+    {
+      return 0;
+    }
+    sum += pn532_ndef_getTNF(record) + pn532_ndef_getPayloadLength(record) +
+           pn532_ndef_getPayload(record)[i % 8];
+    pn532_ndef_destroy(record);
+  }
+
+  return sum;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Drawing (rendered into the GRAM of hw/simlcd.c)
+*/
+/**************************************************************************/
+static uint32_t benchDrawLine(uint32_t iterations)
+{
+  uint32_t i;
+
+  lcdInit();
+  for (i = 0; i < iterations; i++)
+  {
+    // Diagonal lines of every slope
+    drawLine(i % SIMLCD_WIDTH, 0, SIMLCD_WIDTH - 1 - (i * 3) % SIMLCD_WIDTH,
+             SIMLCD_HEIGHT - 1, (uint16_t) i);
+  }
+
+  return simlcdChecksum();
+}
+
+static uint32_t benchDrawCircleFilled(uint32_t iterations)
+{
+  uint32_t i;
+
+  lcdInit();
+  for (i = 0; i < iterations; i++)
+  {
+    drawCircleFilled(120, 160, 10 + i % 100, (uint16_t) i);
+  }
+
+  return simlcdChecksum();
+}
+
+static uint32_t benchDrawTriangleFilled(uint32_t iterations)
+{
+  uint32_t i;
+
+  lcdInit();
+  for (i = 0; i < iterations; i++)
+  {
+    drawTriangleFilled(i % 200, 10, 230, 40 + i % 250, 10, 300, (uint16_t) i);
+  }
+
+  return simlcdChecksum();
+}
+
+static uint32_t benchDrawRoundedRectangle(uint32_t iterations)
+{
+  uint32_t i;
+
+  lcdInit();
+  for (i = 0; i < iterations; i++)
+  {
+    drawRoundedRectangleFilled(10 + i % 50, 10, 200, 100 + i % 200,
+                               (uint16_t) i, 8, DRAW_CORNERS_ALL);
+  }
+
+  return simlcdChecksum();
+}
+
+static uint32_t benchDrawGradient(uint32_t iterations)
+{
+  uint32_t i;
+
+  lcdInit();
+  for (i = 0; i < iterations; i++)
+  {
+    drawGradient(0, 0, SIMLCD_WIDTH - 1, 63, COLOR_BLACK, (uint16_t) i);
+  }
+
+  return simlcdChecksum();
+}
+
+static uint32_t benchDrawAafontsString(uint32_t iterations)
+{
+  static const uint16_t bgColors[3] = { COLOR_BLACK, COLOR_BLUE, COLOR_WHITE };
+  uint32_t i;
+
+  lcdInit();
+  for (i = 0; i < iterations; i++)
+  {
+    // A few color combinations, as on a typical screen, so that most of
+    // the color tables come from the cache
+    aafontsDrawStringColor(i % 64, (i * 14) % (SIMLCD_HEIGHT - 14), bgColors[i % 3],
+                           COLOR_YELLOW, &DejaVuSansCondensed14_AA2, "Temp 23.5 C");
+  }
+
+  return simlcdChecksum();
+}
+
+static const benchmark_t benchmarks[] =
+{
+  { "fifo/write_read",          2000000, benchFifoWriteRead        },
+  { "fifo/array",                200000, benchFifoArray            },
+  { "ringbuffer/write_peek",    2000000, benchRingbufferWritePeek  },
+  { "iir/f",                    2000000, benchIirF                 },
+  { "iir/i",                    2000000, benchIirI                 },
+  { "iir/u16",                  2000000, benchIirU16               },
+  { "sma/f",                    2000000, benchSmaF                 },
+  { "sma/i",                    2000000, benchSmaI                 },
+  { "sma/u16",                  2000000, benchSmaU16               },
+  { "wma/f",                     500000, benchWmaF                 },
+  { "wma/i",                     500000, benchWmaI                 },
+  { "wma/u16",                   500000, benchWmaU16               },
+  { "fixed/mul",                2000000, benchFixedMul             },
+  { "fixed/div",                2000000, benchFixedDiv             },
+  { "stdio/snprintf_int",        200000, benchSnprintfInt          },
+  { "stdio/snprintf_float",      200000, benchSnprintfFloat        },
+  { "rtc/from_epoch",           1000000, benchRtcFromEpoch         },
+  { "rtc/to_epoch",             1000000, benchRtcToEpoch           },
+  { "ndef/serialise",            200000, benchNdefSerialise        },
+  { "ndef/parse",                200000, benchNdefParse            },
+  { "draw/line",                  20000, benchDrawLine             },
+  { "draw/circle_filled",          2000, benchDrawCircleFilled     },
+  { "draw/triangle_filled",        2000, benchDrawTriangleFilled   },
+  { "draw/rounded_rect_filled",    2000, benchDrawRoundedRectangle },
+  { "draw/gradient",               2000, benchDrawGradient         },
+  { "draw/aafonts_string",        20000, benchDrawAafontsString    },
+};
+
+#define BENCHMARKCOUNT (sizeof(benchmarks) / sizeof(benchmarks[0]))
+
+static double now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Reads a CSV file written by a previous run
+*/
+/**************************************************************************/
+static int readBaseline(const char *path, baseline_t *baseline, int max)
+{
+  char line[128];
+  int count = 0;
+  FILE *f = fopen(path, "r");
+
+  if (f == NULL)
+  {
+    perror(path);
+    exit(1);
+  }
+
+  while ((count < max) && fgets(line, sizeof(line), f))
+  {
+    if (sscanf(line, "%47[^,],%u,%lf,%x", baseline[count].name,
+               &baseline[count].iterations,
+               &baseline[count].nsPerOp, &baseline[count].checksum) == 4)
+    {
+      count++;
+    }
+  }
+
+  fclose(f);
+  return count;
+}
+
+static const baseline_t *findBaseline(const baseline_t *baseline, int count,
+                                      const char *name)
+{
+  int i;
+
+  for (i = 0; i < count; i++)
+  {
+    if (!strcmp(baseline[i].name, name))
+    {
+      return &baseline[i];
+    }
+  }
+
+  return NULL;
+}
+
+static int selected(const char *name, int argc, char *argv[])
+{
+  int i;
+
+  if (argc == 0)
+  {
+    return 1;
+  }
+
+  for (i = 0; i < argc; i++)
+  {
+    if (!strncmp(name, argv[i], strlen(argv[i])))
+    {
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+int main(int argc, char *argv[])
+{
+  static baseline_t baseline[MAXBENCHMARKS];
+  int baselineCount = 0;
+  double scale = 1.0, tolerance = 25.0;
+  const char *ppmDir = NULL;
+  int json = 0, list = 0, regressions = 0;
+  unsigned int i;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "ljs:c:t:p:")) != -1)
+  {
+    switch (opt)
+    {
+      case 'l': list = 1; break;
+      case 'j': json = 1; break;
+      case 's': scale = atof(optarg); break;
+      case 'c': baselineCount = readBaseline(optarg, baseline, MAXBENCHMARKS); break;
+      case 't': tolerance = atof(optarg); break;
+      case 'p': ppmDir = optarg; break;
+      default:
+        fprintf(stderr, "Usage: %s [-l] [-j] [-s <scale>] [-c <baseline.csv>] "
+                        "[-t <percent>] [-p <dir>] [<name prefix> ...]\n", argv[0]);
+        return 1;
+    }
+  }
+
+  if (list)
+  {
+    for (i = 0; i < BENCHMARKCOUNT; i++)
+    {
+      printf("%s\n", benchmarks[i].name);
+    }
+    return 0;
+  }
+
+  // Sensor-like input: a slow ramp with some noise
+  srand(1);
+  for (i = 0; i < SAMPLES; i++)
+  {
+    samples[i] = 1000 + i * 16 + rand() % 64;
+    samplesf[i] = samples[i] / 100.0F;
+  }
+
+  if (!json)
+  {
+    printf("name,iterations,ns_per_op,checksum\n");
+  }
+
+  for (i = 0; i < BENCHMARKCOUNT; i++)
+  {
+    const benchmark_t *b = &benchmarks[i];
+    const baseline_t *base;
+    uint32_t iterations, checksum = 0;
+    double best = 0;
+    int run;
+
+    if (!selected(b->name, argc - optind, argv + optind))
+    {
+      continue;
+    }
+
+    iterations = (uint32_t) (b->iterations * scale);
+    if (iterations == 0)
+    {
+      iterations = 1;
+    }
+
+    // The first run only warms up the caches
+    checksum = b->fn(iterations);
+    for (run = 0; run < RUNS; run++)
+    {
+      double start = now();
+      checksum = b->fn(iterations);
+      double t = (now() - start) / iterations;
+      if ((run == 0) || (t < best))
+      {
+        best = t;
+      }
+    }
+
+    if (json)
+    {
+      printf("{\"name\": \"%s\", \"iterations\": %u, \"ns_per_op\": %.2f, "
+             "\"checksum\": \"%08X\"}\n", b->name, iterations, best, checksum);
+    }
+    else
+    {
+      printf("%s,%u,%.2f,%08X\n", b->name, iterations, best, checksum);
+    }
+    fflush(stdout);
+
+    // The last frame drawn, to look at or diff against a previous run
+    if ((ppmDir != NULL) && !strncmp(b->name, "draw/", 5))
+    {
+      char path[256];
+      snprintf(path, sizeof(path), "%s/%s.ppm", ppmDir, b->name + 5);
+      if (simlcdWritePPM(path) != ERROR_NONE)
+      {
+        fprintf(stderr, "Can't write %s\n", path);
+      }
+    }
+
+    // Regressions go to stderr, so the results stay machine-readable
+    base = findBaseline(baseline, baselineCount, b->name);
+    if (base == NULL)
+    {
+      continue;
+    }
+    if (best > base->nsPerOp * (1.0 + tolerance / 100.0))
+    {
+      fprintf(stderr, "REGRESSION %s: %.2f ns/op, baseline %.2f ns/op (+%.0f%%)\n",
+              b->name, best, base->nsPerOp, (best / base->nsPerOp - 1.0) * 100.0);
+      regressions++;
+    }
+    // The checksum depends on the number of iterations
+    if ((base->iterations == iterations) && (base->checksum != checksum))
+    {
+      fprintf(stderr, "CHANGED %s: checksum %08X, baseline %08X\n",
+              b->name, checksum, base->checksum);
+      regressions++;
+    }
+  }
+
+  return regressions;
+}
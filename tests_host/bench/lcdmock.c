@@ -0,0 +1,289 @@
+/**************************************************************************/
+/*!
+    @file     lcdmock.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Counts the bytes that the graphic LCD drivers send to the
+              controller for the lcd.h drawing primitives
+
+    Each scenario draws the same pixels twice on a mock controller
+    (lcdmock_<controller>.c): first a pixel or a line at a time, as the
+    callers had to before the windowed primitives, then with a single
+    primitive (lcdDrawPixels, lcdDrawVLine, lcdDrawRect, lcdBlit).  The
+    GRAM contents must be identical, and the windowed version must send
+    fewer bytes.
+
+    The draw_* scenarios compare the filled shapes of drawing.c with the
+    previous implementation (drawref.c).  The span engine can round the
+    edges slightly differently, so only the pixel writes, windows and
+    bytes are compared.
+
+    The results are written as CSV, and the exit code is the number of
+    scenarios that failed.
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+/**************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "projectconfig.h"
+#include "drivers/displays/graphic/lcd.h"
+#include "drivers/displays/graphic/drawing.h"
+#include "drivers/displays/graphic/aafonts.h"
+#include "drivers/displays/graphic/aafonts/aa2/DejaVuSansCondensed14_AA2.h"
+#include "drawref.h"
+#include "lcdmock.h"
+
+#define BLIT_W  (32)
+#define BLIT_H  (24)
+
+// aafontsGetStringWidth(&DejaVuSansCondensed14_AA2, text) * fontHeight
+#define TEXT_PIXELS (119 * 14)
+
+typedef struct
+{
+  const char *name;
+  uint32_t    pixels;         // Pixels that must be written, 0 if the
+                              // result differs from the reference
+  void      (*before)(void);  // A pixel or a line at a time
+  void      (*after)(void);   // Windowed primitive
+} scenario_t;
+
+static uint16_t image[BLIT_W * BLIT_H];
+
+static void pixelsBefore(void)
+{
+  uint16_t i;
+  for (i = 0; i < 120; i++) lcdDrawPixel(20 + i, 30, image[i]);
+}
+
+static void pixelsAfter(void)
+{
+  lcdDrawPixels(20, 30, image, 120);
+}
+
+static void hlineBefore(void)
+{
+  uint16_t x;
+  for (x = 10; x <= 129; x++) lcdDrawPixel(x, 50, COLOR_RED);
+}
+
+static void hlineAfter(void)
+{
+  lcdDrawHLine(10, 129, 50, COLOR_RED);
+}
+
+static void vlineBefore(void)
+{
+  uint16_t y;
+  for (y = 10; y <= 159; y++) lcdDrawPixel(40, y, COLOR_GREEN);
+}
+
+static void vlineAfter(void)
+{
+  lcdDrawVLine(40, 159, 10, COLOR_GREEN);
+}
+
+static void rectBefore(void)
+{
+  uint16_t y;
+  for (y = 60; y <= 99; y++) lcdDrawHLine(20, 79, y, COLOR_BLUE);
+}
+
+static void rectAfter(void)
+{
+  lcdDrawRect(79, 99, 20, 60, COLOR_BLUE);
+}
+
+static void blitBefore(void)
+{
+  uint16_t x, y;
+  for (y = 0; y < BLIT_H; y++)
+  {
+    for (x = 0; x < BLIT_W; x++)
+    {
+      lcdDrawPixel(100 + x, 120 + y, image[y * BLIT_W + x]);
+    }
+  }
+}
+
+static void blitAfter(void)
+{
+  lcdBlit(100, 120, BLIT_W, BLIT_H, image);
+}
+
+static void blitClippedBefore(void)
+{
+  uint16_t x, y;
+  for (y = 0; y < BLIT_H; y++)
+  {
+    for (x = 0; x < BLIT_W; x++)
+    {
+      // lcdDrawPixel ignores the pixels past the right edge
+      lcdDrawPixel(lcdGetWidth() - 10 + x, 8 + y, image[y * BLIT_W + x]);
+    }
+  }
+}
+
+static void blitClippedAfter(void)
+{
+  lcdBlit(lcdGetWidth() - 10, 8, BLIT_W, BLIT_H, image);
+}
+
+static void circleBefore(void)
+{
+  refCircleFilled(88, 110, 60, COLOR_WHITE);
+}
+
+static void circleAfter(void)
+{
+  drawCircleFilled(88, 110, 60, COLOR_WHITE);
+}
+
+static void cornerBefore(void)
+{
+  refCornerFilled(60, 60, 40, DRAW_CORNERS_TOP, COLOR_WHITE);
+}
+
+static void cornerAfter(void)
+{
+  drawCornerFilled(60, 60, 40, DRAW_CORNERS_TOP, COLOR_WHITE);
+}
+
+static void roundedRectBefore(void)
+{
+  refRoundedRectangleFilled(10, 20, 160, 120, COLOR_WHITE, 12, DRAW_CORNERS_ALL);
+}
+
+static void roundedRectAfter(void)
+{
+  drawRoundedRectangleFilled(10, 20, 160, 120, COLOR_WHITE, 12, DRAW_CORNERS_ALL);
+}
+
+static void triangleBefore(void)
+{
+  // Already sorted by y: the reference can't reorder them
+  refTriangleFilled(100, 10, 20, 120, 160, 200, COLOR_WHITE);
+}
+
+static void triangleAfter(void)
+{
+  drawTriangleFilled(100, 10, 20, 120, 160, 200, COLOR_WHITE);
+}
+
+// Anti-aliased text needs a solid background of a known color: the
+// reference has to fill the text box first, since it skips the bg pixels
+static char text[] = "Quick brown fox 0123";
+
+static void textBefore(void)
+{
+  uint16_t width = aafontsGetStringWidth(&DejaVuSansCondensed14_AA2, text);
+  lcdDrawRect(4, 200, 4 + width - 1, 200 + 13, COLOR_BLUE);
+  refAafontsDrawString(4, 200, aafontsGetColorTable(COLOR_BLUE, COLOR_YELLOW, AAFONTS_FONTTYPE_AA2),
+                       &DejaVuSansCondensed14_AA2, text);
+}
+
+static void textAfter(void)
+{
+  aafontsDrawStringColor(4, 200, COLOR_BLUE, COLOR_YELLOW, &DejaVuSansCondensed14_AA2, text);
+}
+
+static const scenario_t scenarios[] =
+{
+  { "pixels_120",        120,             pixelsBefore,      pixelsAfter      },
+  { "hline_120",         120,             hlineBefore,       hlineAfter       },
+  { "vline_150",         150,             vlineBefore,       vlineAfter       },
+  { "rect_60x40",        60 * 40,         rectBefore,        rectAfter        },
+  { "blit_32x24",        BLIT_W * BLIT_H, blitBefore,        blitAfter        },
+  { "blit_clipped",      10 * BLIT_H,     blitClippedBefore, blitClippedAfter },
+  { "draw_circle",       0,               circleBefore,      circleAfter      },
+  { "draw_corner",       0,               cornerBefore,      cornerAfter      },
+  { "draw_rounded_rect", 0,               roundedRectBefore, roundedRectAfter },
+  { "draw_triangle",     0,               triangleBefore,    triangleAfter    },
+  { "text_aa2",          TEXT_PIXELS,     textBefore,        textAfter        },
+};
+
+int main(int argc, char *argv[])
+{
+  uint16_t *expected;
+  uint16_t *actual;
+  lcdmockStats_t before, after;
+  uint32_t i, failures = 0;
+  int ok;
+
+  for (i = 0; i < BLIT_W * BLIT_H; i++)
+  {
+    image[i] = (uint16_t)(i * 2654435761u >> 16) | 1;
+  }
+
+  expected = malloc(lcdmockGramSize());
+  actual = malloc(lcdmockGramSize());
+
+  printf("controller,name,before_pixels,before_windows,before_cmd,before_data,"
+         "after_pixels,after_windows,after_cmd,after_data,reduction_pct,result\n");
+
+  for (i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++)
+  {
+    lcdmockReset();
+    scenarios[i].before();
+    before = lcdmockStats;
+    lcdmockCopyGram(expected);
+
+    lcdmockReset();
+    scenarios[i].after();
+    after = lcdmockStats;
+    lcdmockCopyGram(actual);
+
+    ok = (after.cmdBytes + after.dataBytes <= before.cmdBytes + before.dataBytes);
+    if (scenarios[i].pixels)
+    {
+      ok = ok && (after.pixels == scenarios[i].pixels) &&
+           (memcmp(expected, actual, lcdmockGramSize()) == 0);
+    }
+    if (!ok) failures++;
+
+    printf("%s,%s,%u,%u,%u,%u,%u,%u,%u,%u,%.1f,%s\n",
+           lcdmockController, scenarios[i].name,
+           before.pixels, before.windows, before.cmdBytes, before.dataBytes,
+           after.pixels, after.windows, after.cmdBytes, after.dataBytes,
+           100.0 * (1.0 - (double)(after.cmdBytes + after.dataBytes) /
+                          (before.cmdBytes + before.dataBytes)),
+           ok ? "ok" : "FAIL");
+  }
+
+  free(expected);
+  free(actual);
+
+  return failures;
+}
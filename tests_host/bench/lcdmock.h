@@ -0,0 +1,69 @@
+/**************************************************************************/
+/*!
+    @file     lcdmock.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+/**************************************************************************/
+
+#ifndef __LCDMOCK_H__
+#define __LCDMOCK_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+// Bus traffic seen by the mock controller
+typedef struct
+{
+  uint32_t cmdBytes;      // Command (register index) bytes
+  uint32_t dataBytes;     // Parameter and pixel data bytes
+  uint32_t windows;       // Address setups (RAMWR/SRAMWRITECONTROL)
+  uint32_t pixels;        // Pixels written to GRAM
+} lcdmockStats_t;
+
+extern lcdmockStats_t lcdmockStats;
+
+// Implemented by the controller specific file (lcdmock_hx8340b.c, etc.)
+extern const char *lcdmockController;
+void     lcdmockReset(void);
+uint16_t lcdmockGetPixel(uint16_t x, uint16_t y);
+uint32_t lcdmockGramSize(void);
+void     lcdmockCopyGram(uint16_t *dest);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,170 @@
+/**************************************************************************/
+/*!
+    @file     lcdmock_hx8340b.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Mock HX8340B controller: replaces the bit-banged SPI
+              functions of hw/hx8340b.c, decodes CASET, PASET and RAMWR
+              into a GRAM array and counts the bytes on the bus
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+/**************************************************************************/
+
+#include <string.h>
+
+#include "projectconfig.h"
+#include "drivers/displays/graphic/hw/hx8340b.h"
+#include "lcdmock.h"
+
+#define WIDTH   (176)
+#define HEIGHT  (220)
+
+const char     *lcdmockController = "hx8340b";
+lcdmockStats_t  lcdmockStats;
+
+static uint16_t gram[HEIGHT][WIDTH];
+static uint8_t  command;
+static uint8_t  params[4];
+static uint8_t  paramCount;
+static uint16_t colStart, colEnd, rowStart, rowEnd, curX, curY;
+static uint8_t  pixelHigh;
+static bool     pixelHalf;
+
+void lcdmockReset(void)
+{
+  memset(gram, 0, sizeof(gram));
+  memset(&lcdmockStats, 0, sizeof(lcdmockStats));
+  command = HX8340B_N_NOP;
+  paramCount = 0;
+  pixelHalf = false;
+}
+
+uint16_t lcdmockGetPixel(uint16_t x, uint16_t y)
+{
+  return gram[y][x];
+}
+
+uint32_t lcdmockGramSize(void)
+{
+  return sizeof(gram);
+}
+
+void lcdmockCopyGram(uint16_t *dest)
+{
+  memcpy(dest, gram, sizeof(gram));
+}
+
+/**************************************************************************/
+/*!
+    @brief  Writes one pixel at the address counter, which moves right
+            and wraps to the next row (then the top) of the window
+*/
+/**************************************************************************/
+static void writePixel(uint16_t color)
+{
+  if ((curX < WIDTH) && (curY < HEIGHT))
+  {
+    gram[curY][curX] = color;
+  }
+  lcdmockStats.pixels++;
+
+  if (++curX > colEnd)
+  {
+    curX = colStart;
+    if (++curY > rowEnd)
+    {
+      curY = rowStart;
+    }
+  }
+}
+
+void hx8340bWriteCmd(uint8_t c)
+{
+  lcdmockStats.cmdBytes++;
+  command = c;
+  paramCount = 0;
+  pixelHalf = false;
+
+  if (c == HX8340B_N_RAMWR)
+  {
+    curX = colStart;
+    curY = rowStart;
+    lcdmockStats.windows++;
+  }
+}
+
+void hx8340bWriteData(uint8_t data)
+{
+  lcdmockStats.dataBytes++;
+
+  switch (command)
+  {
+    case HX8340B_N_CASET:
+    case HX8340B_N_PASET:
+      if (paramCount < 4)
+      {
+        params[paramCount++] = data;
+      }
+      if (paramCount == 4)
+      {
+        if (command == HX8340B_N_CASET)
+        {
+          colStart = (params[0] << 8) | params[1];
+          colEnd   = (params[2] << 8) | params[3];
+        }
+        else
+        {
+          rowStart = (params[0] << 8) | params[1];
+          rowEnd   = (params[2] << 8) | params[3];
+        }
+      }
+      break;
+    case HX8340B_N_RAMWR:
+      // 16bpp (COLMOD 0x05): high byte first
+      if (pixelHalf)
+      {
+        writePixel((pixelHigh << 8) | data);
+      }
+      else
+      {
+        pixelHigh = data;
+      }
+      pixelHalf = !pixelHalf;
+      break;
+    default:
+      break;
+  }
+}
+
+void delay(uint32_t ms)
+{
+}
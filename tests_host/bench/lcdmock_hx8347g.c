@@ -0,0 +1,147 @@
+/**************************************************************************/
+/*!
+    @file     lcdmock_hx8347g.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Mock HX8347G controller: replaces the 8-bit parallel bus
+              functions of hw/hx8347g.c, decodes the window registers and
+              SRAM writes into a GRAM array and counts the bytes on the bus
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+/**************************************************************************/
+
+#include <string.h>
+
+#include "projectconfig.h"
+#include "drivers/displays/graphic/hw/hx8347g.h"
+#include "lcdmock.h"
+
+#define WIDTH   (240)
+#define HEIGHT  (320)
+
+const char     *lcdmockController = "hx8347g";
+lcdmockStats_t  lcdmockStats;
+
+static uint16_t gram[HEIGHT][WIDTH];
+static uint8_t  registers[256];
+static uint16_t colStart, colEnd, rowStart, rowEnd, curX, curY;
+
+void lcdmockReset(void)
+{
+  memset(gram, 0, sizeof(gram));
+  memset(&lcdmockStats, 0, sizeof(lcdmockStats));
+
+  // Full screen window, as after hx8347gInitDisplay
+  memset(registers, 0, sizeof(registers));
+  registers[HX8347G_CMD_COLADDREND1] = (WIDTH - 1) & 0xFF;
+  registers[HX8347G_CMD_ROWADDREND2] = (HEIGHT - 1) >> 8;
+  registers[HX8347G_CMD_ROWADDREND1] = (HEIGHT - 1) & 0xFF;
+}
+
+uint16_t lcdmockGetPixel(uint16_t x, uint16_t y)
+{
+  return gram[y][x];
+}
+
+uint32_t lcdmockGramSize(void)
+{
+  return sizeof(gram);
+}
+
+void lcdmockCopyGram(uint16_t *dest)
+{
+  memcpy(dest, gram, sizeof(gram));
+}
+
+void hx8347gWriteRegister(uint8_t command, uint8_t data)
+{
+  lcdmockStats.cmdBytes++;
+  lcdmockStats.dataBytes++;
+  registers[command] = data;
+}
+
+void hx8347gWriteCommand(const uint8_t command)
+{
+  lcdmockStats.cmdBytes++;
+
+  if (command == HX8347G_CMD_SRAMWRITECONTROL)
+  {
+    colStart = (registers[HX8347G_CMD_COLADDRSTART2] << 8) | registers[HX8347G_CMD_COLADDRSTART1];
+    colEnd   = (registers[HX8347G_CMD_COLADDREND2] << 8)   | registers[HX8347G_CMD_COLADDREND1];
+    rowStart = (registers[HX8347G_CMD_ROWADDRSTART2] << 8) | registers[HX8347G_CMD_ROWADDRSTART1];
+    rowEnd   = (registers[HX8347G_CMD_ROWADDREND2] << 8)   | registers[HX8347G_CMD_ROWADDREND1];
+    curX = colStart;
+    curY = rowStart;
+    lcdmockStats.windows++;
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Writes one pixel at the address counter, which moves right
+            and wraps to the start column of the next row of the window
+*/
+/**************************************************************************/
+void hx8347gWriteData(const uint16_t data)
+{
+  lcdmockStats.dataBytes += 2;
+  lcdmockStats.pixels++;
+
+  if ((curX < WIDTH) && (curY < HEIGHT))
+  {
+    gram[curY][curX] = data;
+  }
+
+  if (++curX > colEnd)
+  {
+    curX = colStart;
+    if (++curY > rowEnd)
+    {
+      curY = rowStart;
+    }
+  }
+}
+
+uint16_t hx8347gReadRegister(uint8_t command)
+{
+  lcdmockStats.cmdBytes++;
+  return registers[command];
+}
+
+uint16_t hx8347gReadData(void)
+{
+  return 0;
+}
+
+void delay(uint32_t ms)
+{
+}
@@ -2,3 +2,16 @@ PROJECT_CEEDLING_ROOT = "vendor/ceedling"
 load "#{PROJECT_CEEDLING_ROOT}/lib/rakefile.rb"
 
 task :default => %w[ test:all release ]
+
+# Host micro-benchmarks (see bench/Makefile)
+namespace :bench do
+  %w[ run frames baseline check test lcdmock clean ].each do |target|
+    desc "Host benchmarks: make #{target}"
+    task target.to_sym do
+      sh "make -C bench #{target}"
+    end
+  end
+end
+
+desc "Runs the host benchmarks"
+task :bench => 'bench:run'
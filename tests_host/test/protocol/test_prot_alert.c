@@ -0,0 +1,241 @@
+/**************************************************************************/
+/*!
+    @file     test_prot_alert.c
+    @ingroup  Unit Tests
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+#include "unity.h"
+#include "fifo.h"
+#include "prot_alert.h"
+
+/* Wire format values (see protocol.h) */
+#define MSGTYPE_ALERT     0x40
+
+static uint8_t  frames[8][64];
+static uint8_t  frame_count;
+static bool     link_busy;
+static uint32_t sample_value;
+
+static err_t send_frame(uint8_t const * p_data, uint32_t length)
+{
+  TEST_ASSERT_EQUAL(64, length);
+
+  if (link_busy)
+  {
+    return ERROR_PROT_BUSY;
+  }
+
+  TEST_ASSERT_TRUE(frame_count < 8);
+  memcpy(frames[frame_count++], p_data, 64);
+
+  return ERROR_NONE;
+}
+
+static uint8_t sample_u32(uint8_t data[])
+{
+  memcpy(data, &sample_value, 4);
+  return 4;
+}
+
+static uint8_t sample_count;
+
+static uint8_t sample_nothing(uint8_t data[])
+{
+  (void) data;
+  sample_count++;
+  return 0;
+}
+
+void setUp(void)
+{
+  prot_alert_init();
+  memset(frames, 0, sizeof(frames));
+  frame_count  = 0;
+  link_busy    = false;
+  sample_value = 0x11223344;
+  sample_count = 0;
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_alert_subscribe_unknown_topic(void)
+{
+  TEST_ASSERT_EQUAL(ERROR_INVALIDPARAMETER, prot_alert_subscribe(0x0010, 100, 0));
+  TEST_ASSERT_EQUAL(ERROR_INVALIDPARAMETER, prot_alert_register(PROT_ALERT_TOPIC_ALL, sample_u32));
+  TEST_ASSERT_FALSE(prot_alert_is_active());
+}
+
+void test_alert_sampled_at_interval(void)
+{
+  prot_alert_register(0x0010, sample_u32);
+  prot_alert_subscribe(0x0010, 100, 0);
+  TEST_ASSERT_TRUE(prot_alert_is_active());
+
+  /* First sample is sent right away */
+  TEST_ASSERT_EQUAL(1, prot_alert_task(1000, send_frame));
+  TEST_ASSERT_EQUAL_HEX8(MSGTYPE_ALERT, frames[0][0]);
+  TEST_ASSERT_EQUAL(PROT_ALERT_ID_EVENTS, frames[0][1] + (frames[0][2] << 8));
+  TEST_ASSERT_EQUAL(PROT_ALERT_RECORD_HEADER + 4, frames[0][3]);
+  TEST_ASSERT_EQUAL(0x0010, frames[0][4] + (frames[0][5] << 8));
+  TEST_ASSERT_EQUAL(4, frames[0][6]);
+  TEST_ASSERT_EQUAL_MEMORY(&sample_value, &frames[0][7], 4);
+
+  /* Not due yet */
+  TEST_ASSERT_EQUAL(0, prot_alert_task(1099, send_frame));
+  TEST_ASSERT_EQUAL(1, prot_alert_task(1100, send_frame));
+  TEST_ASSERT_EQUAL(2, frame_count);
+}
+
+void test_alert_empty_sample_is_throttled(void)
+{
+  prot_alert_register(0x0010, sample_nothing);
+  prot_alert_subscribe(0x0010, 100, 0);
+
+  /* Nothing to report, but the interval still applies */
+  TEST_ASSERT_EQUAL(0, prot_alert_task(1000, send_frame));
+  TEST_ASSERT_EQUAL(0, prot_alert_task(1001, send_frame));
+  TEST_ASSERT_EQUAL(0, prot_alert_task(1099, send_frame));
+  TEST_ASSERT_EQUAL(1, sample_count);
+
+  TEST_ASSERT_EQUAL(0, prot_alert_task(1100, send_frame));
+  TEST_ASSERT_EQUAL(2, sample_count);
+  TEST_ASSERT_EQUAL(0, frame_count);
+}
+
+void test_alert_on_change(void)
+{
+  prot_alert_register(0x0010, sample_u32);
+  prot_alert_subscribe(0x0010, 0, PROT_ALERT_FLAG_ONCHANGE);
+
+  TEST_ASSERT_EQUAL(1, prot_alert_task(0, send_frame));
+  TEST_ASSERT_EQUAL(0, prot_alert_task(1, send_frame));
+  TEST_ASSERT_EQUAL(0, prot_alert_task(2, send_frame));
+
+  sample_value++;
+  TEST_ASSERT_EQUAL(1, prot_alert_task(3, send_frame));
+  TEST_ASSERT_EQUAL(2, frame_count);
+}
+
+void test_alert_events_are_batched(void)
+{
+  uint8_t data[PROT_ALERT_MAX_DATA] = { 0 };
+  uint8_t i;
+
+  prot_alert_register(0x0020, NULL);
+  prot_alert_subscribe(0x0020, 0, 0);
+
+  /* 15 bytes per record: 4 records fit in the 60 byte payload */
+  for (i = 0; i < 6; i++)
+  {
+    data[0] = i;
+    TEST_ASSERT_EQUAL(ERROR_NONE, prot_alert_publish(0x0020, data, PROT_ALERT_MAX_DATA));
+  }
+
+  TEST_ASSERT_EQUAL(4, prot_alert_task(0, send_frame));
+  TEST_ASSERT_EQUAL(60, frames[0][3]);
+  TEST_ASSERT_EQUAL(3, frames[0][4 + 3*15 + 3]);
+
+  TEST_ASSERT_EQUAL(2, prot_alert_task(0, send_frame));
+  TEST_ASSERT_EQUAL(30, frames[1][3]);
+  TEST_ASSERT_EQUAL(4, frames[1][4 + 3]);
+
+  TEST_ASSERT_EQUAL(0, prot_alert_task(0, send_frame));
+  TEST_ASSERT_EQUAL(2, frame_count);
+}
+
+void test_alert_busy_transport_keeps_events(void)
+{
+  uint8_t data = 0x5A;
+
+  prot_alert_register(0x0020, NULL);
+  prot_alert_subscribe(0x0020, 0, 0);
+  prot_alert_publish(0x0020, &data, 1);
+
+  link_busy = true;
+  TEST_ASSERT_EQUAL(0, prot_alert_task(0, send_frame));
+
+  link_busy = false;
+  TEST_ASSERT_EQUAL(1, prot_alert_task(0, send_frame));
+  TEST_ASSERT_EQUAL_HEX8(0x5A, frames[0][7]);
+}
+
+void test_alert_dropped_counters(void)
+{
+  uint32_t published, dropped;
+  uint8_t  data = 0;
+  uint8_t  i;
+
+  prot_alert_register(0x0020, NULL);
+  prot_alert_register(0x0030, NULL);
+  prot_alert_subscribe(0x0020, 0, 0);
+  prot_alert_subscribe(0x0030, 0, 0);
+
+  for (i = 0; i < PROT_ALERT_QUEUE_DEPTH + 3; i++)
+  {
+    prot_alert_publish(0x0020, &data, 1);
+  }
+  TEST_ASSERT_EQUAL(ERROR_BUFFEROVERFLOW, prot_alert_publish(0x0030, &data, 1));
+
+  prot_alert_get_stats(0x0020, &published, &dropped);
+  TEST_ASSERT_EQUAL(PROT_ALERT_QUEUE_DEPTH, published);
+  TEST_ASSERT_EQUAL(3, dropped);
+
+  prot_alert_get_stats(PROT_ALERT_TOPIC_ALL, &published, &dropped);
+  TEST_ASSERT_EQUAL(PROT_ALERT_QUEUE_DEPTH, published);
+  TEST_ASSERT_EQUAL(4, dropped);
+
+  TEST_ASSERT_EQUAL(ERROR_INVALIDPARAMETER, prot_alert_get_stats(0x0040, &published, &dropped));
+}
+
+void test_alert_unsubscribe(void)
+{
+  uint8_t data = 0;
+
+  prot_alert_register(0x0010, sample_u32);
+  prot_alert_register(0x0020, NULL);
+  prot_alert_subscribe(0x0010, 10, 0);
+  prot_alert_subscribe(0x0020, 0, 0);
+
+  TEST_ASSERT_EQUAL(ERROR_NONE, prot_alert_unsubscribe(0x0010));
+  TEST_ASSERT_TRUE(prot_alert_is_active());
+
+  TEST_ASSERT_EQUAL(ERROR_NONE, prot_alert_unsubscribe(PROT_ALERT_TOPIC_ALL));
+  TEST_ASSERT_FALSE(prot_alert_is_active());
+
+  /* Events for topics nobody subscribed to are ignored */
+  TEST_ASSERT_EQUAL(ERROR_NONE, prot_alert_publish(0x0020, &data, 1));
+  TEST_ASSERT_FALSE(prot_alert_is_active());
+}
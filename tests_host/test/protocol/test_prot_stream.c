@@ -0,0 +1,269 @@
+/**************************************************************************/
+/*!
+    @file     test_prot_stream.c
+    @ingroup  Unit Tests
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "unity.h"
+#include "prot_stream.h"
+
+static protStreamParser_t parser;
+static uint8_t            frame[PROT_STREAM_MAX_ENCODED];
+
+/* Feeds a buffer to the parser, returns the length of the last message */
+static uint8_t parse_all(uint8_t const * p_data, uint16_t length)
+{
+  uint8_t result = 0;
+  uint8_t len;
+
+  while (length--)
+  {
+    len = prot_stream_parse(&parser, *p_data++);
+    if (len)
+    {
+      result = len;
+    }
+  }
+
+  return result;
+}
+
+/* Deterministic test message, 'seed' selects the content and length */
+static uint8_t make_message(uint8_t msg[], uint32_t seed)
+{
+  uint8_t length = 1 + (seed * 7) % PROT_STREAM_MAX_MSG;
+  uint8_t i;
+
+  for (i = 0; i < length; i++)
+  {
+    /* Plenty of zeros to exercise the COBS blocks */
+    msg[i] = ((seed + i) % 5 == 0) ? 0 : (uint8_t) (seed * 31 + i);
+  }
+
+  return length;
+}
+
+void setUp(void)
+{
+  prot_stream_parser_init(&parser);
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_stream_crc16(void)
+{
+  /* CRC-16/CCITT-FALSE check value */
+  TEST_ASSERT_EQUAL_HEX16(0x29B1, prot_stream_crc16(0xFFFF, (uint8_t const *) "123456789", 9));
+}
+
+void test_stream_encode_led_command(void)
+{
+  uint8_t const msg[]      = { 0x10, 0x01, 0x00, 0x01, 0x01 };
+  uint8_t const expected[] = { 0x03, 0x10, 0x01, 0x05, 0x01, 0x01, 0x40, 0xF2, 0x00 };
+
+  TEST_ASSERT_EQUAL(sizeof(expected), prot_stream_encode(msg, sizeof(msg), frame));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, frame, sizeof(expected));
+
+  TEST_ASSERT_EQUAL(0, prot_stream_encode(msg, 0, frame));
+}
+
+void test_stream_roundtrip(void)
+{
+  uint8_t  msg[PROT_STREAM_MAX_MSG];
+  uint8_t  length, size, i;
+  uint32_t seed;
+
+  for (seed = 0; seed < 500; seed++)
+  {
+    length = make_message(msg, seed);
+    size   = prot_stream_encode(msg, length, frame);
+
+    TEST_ASSERT_TRUE(size <= PROT_STREAM_MAX_ENCODED);
+    for (i = 0; i < size - 1; i++)
+    {
+      TEST_ASSERT_NOT_EQUAL(0, frame[i]);
+    }
+
+    TEST_ASSERT_EQUAL(length, parse_all(frame, size));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(msg, parser.buffer, length);
+  }
+
+  /* All zeros and no zeros at all */
+  memset(msg, 0, sizeof(msg));
+  size = prot_stream_encode(msg, sizeof(msg), frame);
+  TEST_ASSERT_EQUAL(sizeof(msg), parse_all(frame, size));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(msg, parser.buffer, sizeof(msg));
+
+  memset(msg, 0xFF, sizeof(msg));
+  size = prot_stream_encode(msg, sizeof(msg), frame);
+  TEST_ASSERT_EQUAL(sizeof(msg), parse_all(frame, size));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(msg, parser.buffer, sizeof(msg));
+
+  TEST_ASSERT_EQUAL(502, parser.frames);
+  TEST_ASSERT_EQUAL(0, parser.crc_errors + parser.framing_errors);
+}
+
+void test_stream_bad_crc_then_resync(void)
+{
+  uint8_t msg[] = { 0x10, 0x02, 0x00, 0x02, 0x01, 0x00 };
+  uint8_t size  = prot_stream_encode(msg, sizeof(msg), frame);
+
+  /* Corrupt one data byte */
+  frame[2] ^= 0x40;
+  TEST_ASSERT_EQUAL(0, parse_all(frame, size));
+  TEST_ASSERT_EQUAL(1, parser.crc_errors);
+
+  /* The next frame is received normally */
+  size = prot_stream_encode(msg, sizeof(msg), frame);
+  TEST_ASSERT_EQUAL(sizeof(msg), parse_all(frame, size));
+  TEST_ASSERT_EQUAL(1, parser.frames);
+}
+
+void test_stream_lost_bytes_then_resync(void)
+{
+  uint8_t msg[] = { 0x10, 0x02, 0x00, 0x02, 0x01, 0x00 };
+  uint8_t size  = prot_stream_encode(msg, sizeof(msg), frame);
+  uint8_t const noise[] = { 0x00, 0x00, 0x55, 0x00 };
+
+  /* Truncated frame (a COBS block is cut short) */
+  TEST_ASSERT_EQUAL(0, parse_all(frame, 2));
+  TEST_ASSERT_EQUAL(0, prot_stream_parse(&parser, 0x00));
+  TEST_ASSERT_EQUAL(1, parser.framing_errors);
+
+  /* Empty frames are ignored, runt frames are counted */
+  TEST_ASSERT_EQUAL(0, parse_all(noise, sizeof(noise)));
+  TEST_ASSERT_EQUAL(2, parser.framing_errors);
+
+  TEST_ASSERT_EQUAL(sizeof(msg), parse_all(frame, size));
+}
+
+void test_stream_overflow(void)
+{
+  uint8_t msg[] = { 0x10, 0x01, 0x00, 0x00 };
+  uint8_t size;
+  uint16_t i;
+
+  /* Garbage without a delimiter can't overrun the buffer */
+  for (i = 0; i < 300; i++)
+  {
+    TEST_ASSERT_EQUAL(0, prot_stream_parse(&parser, 0x01 + (i % 200)));
+  }
+  TEST_ASSERT_EQUAL(0, prot_stream_parse(&parser, 0x00));
+  TEST_ASSERT_EQUAL(1, parser.framing_errors);
+
+  size = prot_stream_encode(msg, sizeof(msg), frame);
+  TEST_ASSERT_EQUAL(sizeof(msg), parse_all(frame, size));
+}
+
+void test_stream_pipe_full_rate(void)
+{
+  enum { FRAME_COUNT = 100000 };
+  int      fds[2];
+  pid_t    pid;
+  uint8_t  rx[4096];
+  uint8_t  msg[PROT_STREAM_MAX_MSG];
+  uint32_t received = 0, payload = 0, errors = 0;
+  ssize_t  count;
+  clock_t  start;
+  double   seconds;
+
+  TEST_ASSERT_EQUAL(0, pipe(fds));
+
+  pid = fork();
+  TEST_ASSERT_TRUE(pid >= 0);
+
+  if (pid == 0)
+  {
+    /* Writer: pushes frames as fast as the pipe accepts them, in large
+       writes that split frames at arbitrary points                     */
+    static uint8_t tx[8192];
+    uint16_t used = 0;
+    uint32_t seed;
+
+    close(fds[0]);
+    for (seed = 0; seed < FRAME_COUNT; seed++)
+    {
+      uint8_t length = make_message(msg, seed);
+      used += prot_stream_encode(msg, length, &tx[used]);
+      if (used > sizeof(tx) - PROT_STREAM_MAX_ENCODED)
+      {
+        if (write(fds[1], tx, used) != used) _exit(1);
+        used = 0;
+      }
+    }
+    if (used && write(fds[1], tx, used) != used) _exit(1);
+    close(fds[1]);
+    _exit(0);
+  }
+
+  /* Reader: incremental parsing straight from the pipe */
+  close(fds[1]);
+  start = clock();
+  while ( (count = read(fds[0], rx, sizeof(rx))) > 0 )
+  {
+    ssize_t i;
+    for (i = 0; i < count; i++)
+    {
+      uint8_t len = prot_stream_parse(&parser, rx[i]);
+      if (len)
+      {
+        uint8_t expected = make_message(msg, received);
+        if (len != expected || memcmp(msg, parser.buffer, len) != 0)
+        {
+          errors++;
+        }
+        received++;
+        payload += len;
+      }
+    }
+  }
+  seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+  close(fds[0]);
+  waitpid(pid, NULL, 0);
+
+  TEST_ASSERT_EQUAL(FRAME_COUNT, received);
+  TEST_ASSERT_EQUAL(0, errors);
+  TEST_ASSERT_EQUAL(0, parser.crc_errors + parser.framing_errors);
+
+  printf("prot_stream pipe: %u frames, %u KB payload in %.3f s (%.1f MB/s parse rate)\n",
+         (unsigned) received, (unsigned) (payload / 1024), seconds,
+         seconds > 0 ? payload / seconds / 1e6 : 0.0);
+}
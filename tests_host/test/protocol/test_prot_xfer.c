@@ -0,0 +1,387 @@
+/**************************************************************************/
+/*!
+    @file     test_prot_xfer.c
+    @ingroup  Unit Tests
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+#include "unity.h"
+#include "prot_xfer.h"
+
+/* Wire format values (see protocol.h) */
+#define MSGTYPE_DATA      0x30
+#define MSGTYPE_DATA_ACK  0x31
+
+#define XFER_ID           0x1234
+#define XFER_SIZE         (64*1024)
+#define LINK_DEPTH        64
+
+/* One direction of the loopback link, with deterministic frame loss */
+typedef struct
+{
+  uint8_t  frames[LINK_DEPTH][64];
+  uint16_t wr, rd;
+  uint32_t count;     /* Frames offered to the link */
+  uint32_t drop_every;/* Drop every Nth frame (0 = lossless) */
+  uint32_t dropped;
+  bool     busy;      /* Simulate a transport that isn't ready */
+} link_t;
+
+static link_t       link_data, link_ack;
+static protXferTx_t tx;
+static protXferRx_t rx;
+static uint8_t      src[XFER_SIZE];
+static uint8_t      dst[XFER_SIZE];
+
+static err_t link_push(link_t *link, uint8_t const * p_data, uint32_t length)
+{
+  TEST_ASSERT_EQUAL(64, length);
+
+  if (link->busy || (uint16_t) (link->wr - link->rd) >= LINK_DEPTH)
+  {
+    return ERROR_PROT_BUSY;
+  }
+
+  link->count++;
+  if (link->drop_every && (link->count % link->drop_every) == 0)
+  {
+    link->dropped++;
+    return ERROR_NONE;
+  }
+
+  memcpy(link->frames[link->wr % LINK_DEPTH], p_data, 64);
+  link->wr++;
+
+  return ERROR_NONE;
+}
+
+static uint8_t const * link_pop(link_t *link)
+{
+  if (link->rd == link->wr)
+  {
+    return NULL;
+  }
+
+  return link->frames[link->rd++ % LINK_DEPTH];
+}
+
+static err_t send_data(uint8_t const * p_data, uint32_t length)
+{
+  return link_push(&link_data, p_data, length);
+}
+
+static err_t send_ack(uint8_t const * p_data, uint32_t length)
+{
+  return link_push(&link_ack, p_data, length);
+}
+
+static err_t read_src(uint32_t offset, uint8_t * buffer, uint8_t length)
+{
+  TEST_ASSERT_TRUE(offset + length <= XFER_SIZE);
+  memcpy(buffer, &src[offset], length);
+  return ERROR_NONE;
+}
+
+static err_t write_dst(uint32_t offset, uint8_t const * buffer, uint8_t length)
+{
+  TEST_ASSERT_TRUE(offset + length <= XFER_SIZE);
+  memcpy(&dst[offset], buffer, length);
+  return ERROR_NONE;
+}
+
+/* Runs both ends until the transfer completes, and returns the number of
+   timeouts that were required */
+static uint32_t run_loopback(uint32_t size, uint8_t window)
+{
+  uint32_t timeouts = 0;
+  uint32_t rounds   = 0;
+  uint8_t const * p_frame;
+
+  TEST_ASSERT_EQUAL(ERROR_NONE, prot_xfer_tx_start(&tx, XFER_ID, size, read_src, send_data));
+  TEST_ASSERT_EQUAL(ERROR_NONE, prot_xfer_rx_start(&rx, XFER_ID, size, window, write_dst, send_ack));
+
+  while ( !prot_xfer_tx_done(&tx) )
+  {
+    bool progress = false;
+
+    if (prot_xfer_tx_poll(&tx, 8))
+    {
+      progress = true;
+    }
+
+    while ( (p_frame = link_pop(&link_data)) != NULL )
+    {
+      TEST_ASSERT_EQUAL(ERROR_NONE, prot_xfer_rx_data(&rx, p_frame));
+      progress = true;
+    }
+
+    while ( (p_frame = link_pop(&link_ack)) != NULL )
+    {
+      TEST_ASSERT_EQUAL(ERROR_NONE, prot_xfer_tx_ack(&tx, p_frame));
+      progress = true;
+    }
+
+    /* Nothing left in flight: the equivalent of the ack timeout */
+    if (!progress)
+    {
+      prot_xfer_tx_timeout(&tx);
+      timeouts++;
+    }
+
+    TEST_ASSERT_TRUE_MESSAGE(++rounds < 100000, "Transfer stalled");
+  }
+
+  return timeouts;
+}
+
+void setUp(void)
+{
+  uint32_t i;
+
+  memset(&link_data, 0, sizeof(link_t));
+  memset(&link_ack, 0, sizeof(link_t));
+  memset(dst, 0, sizeof(dst));
+  for (i = 0; i < XFER_SIZE; i++)
+  {
+    src[i] = (uint8_t) (i * 7 + (i >> 8));
+  }
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_xfer_start_invalid(void)
+{
+  TEST_ASSERT_EQUAL(ERROR_INVALIDPARAMETER, prot_xfer_tx_start(&tx, XFER_ID, 0, read_src, send_data));
+  TEST_ASSERT_EQUAL(ERROR_INVALIDPARAMETER, prot_xfer_tx_start(&tx, XFER_ID, 100, NULL, send_data));
+  TEST_ASSERT_EQUAL(ERROR_INVALIDPARAMETER, prot_xfer_rx_start(&rx, XFER_ID, 100, 0, write_dst, send_ack));
+  TEST_ASSERT_EQUAL(ERROR_INVALIDPARAMETER, prot_xfer_rx_start(&rx, XFER_ID, 100, PROT_XFER_MAX_WINDOW+1, write_dst, send_ack));
+}
+
+void test_xfer_frame_layout(void)
+{
+  uint8_t const * p_frame;
+
+  prot_xfer_tx_start(&tx, XFER_ID, PROT_XFER_CHUNK_SIZE + 10, read_src, send_data);
+  TEST_ASSERT_EQUAL(2, tx.chunks);
+  TEST_ASSERT_EQUAL(2, prot_xfer_tx_poll(&tx, 8));
+
+  p_frame = link_pop(&link_data);
+  TEST_ASSERT_EQUAL_HEX8(MSGTYPE_DATA, p_frame[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x34, p_frame[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x12, p_frame[2]);
+  TEST_ASSERT_EQUAL(2 + PROT_XFER_CHUNK_SIZE, p_frame[3]);
+  TEST_ASSERT_EQUAL(0, p_frame[4] + (p_frame[5] << 8));
+  TEST_ASSERT_EQUAL_MEMORY(&src[0], &p_frame[6], PROT_XFER_CHUNK_SIZE);
+
+  /* Last chunk is shorter */
+  p_frame = link_pop(&link_data);
+  TEST_ASSERT_EQUAL(2 + 10, p_frame[3]);
+  TEST_ASSERT_EQUAL(1, p_frame[4] + (p_frame[5] << 8));
+  TEST_ASSERT_EQUAL_MEMORY(&src[PROT_XFER_CHUNK_SIZE], &p_frame[6], 10);
+
+  /* Receiver acks the first chunk (to grant its own window) and the end
+     of the transfer */
+  prot_xfer_rx_start(&rx, XFER_ID, PROT_XFER_CHUNK_SIZE + 10, 16, write_dst, send_ack);
+  link_data.rd = 0;
+  prot_xfer_rx_data(&rx, link_pop(&link_data));
+  prot_xfer_rx_data(&rx, link_pop(&link_data));
+  TEST_ASSERT_TRUE(prot_xfer_rx_done(&rx));
+
+  p_frame = link_pop(&link_ack);
+  TEST_ASSERT_NOT_NULL(p_frame);
+  TEST_ASSERT_EQUAL(1, p_frame[4] + (p_frame[5] << 8));
+
+  p_frame = link_pop(&link_ack);
+  TEST_ASSERT_NOT_NULL(p_frame);
+  TEST_ASSERT_EQUAL_HEX8(MSGTYPE_DATA_ACK, p_frame[0]);
+  TEST_ASSERT_EQUAL(PROT_XFER_ACK_LENGTH, p_frame[3]);
+  TEST_ASSERT_EQUAL(2, p_frame[4] + (p_frame[5] << 8));
+  TEST_ASSERT_EQUAL(16, p_frame[6]);
+}
+
+void test_xfer_window_limits_frames_in_flight(void)
+{
+  prot_xfer_tx_start(&tx, XFER_ID, XFER_SIZE, read_src, send_data);
+
+  /* Initial credit, then nothing more until an ack arrives */
+  TEST_ASSERT_EQUAL(8, prot_xfer_tx_poll(&tx, 32));
+  TEST_ASSERT_EQUAL(0, prot_xfer_tx_poll(&tx, 32));
+}
+
+void test_xfer_busy_transport_keeps_frame(void)
+{
+  prot_xfer_tx_start(&tx, XFER_ID, XFER_SIZE, read_src, send_data);
+
+  link_data.busy = true;
+  TEST_ASSERT_EQUAL(0, prot_xfer_tx_poll(&tx, 8));
+  TEST_ASSERT_EQUAL(0, tx.next);
+
+  link_data.busy = false;
+  TEST_ASSERT_EQUAL(8, prot_xfer_tx_poll(&tx, 8));
+  TEST_ASSERT_EQUAL(0, link_data.frames[0][4]);
+}
+
+void test_xfer_lossless(void)
+{
+  TEST_ASSERT_EQUAL(0, run_loopback(XFER_SIZE, PROT_XFER_MAX_WINDOW));
+
+  TEST_ASSERT_EQUAL_MEMORY(src, dst, XFER_SIZE);
+  TEST_ASSERT_EQUAL(tx.chunks, tx.frames);
+  TEST_ASSERT_EQUAL(0, tx.retransmits);
+  TEST_ASSERT_EQUAL(0, rx.duplicates);
+
+  /* Acks are batched rather than one per frame */
+  TEST_ASSERT_TRUE(link_ack.count < tx.chunks / 4);
+}
+
+void test_xfer_selective_retransmit(void)
+{
+  link_data.drop_every = 17;
+
+  run_loopback(XFER_SIZE, PROT_XFER_MAX_WINDOW);
+
+  TEST_ASSERT_EQUAL_MEMORY(src, dst, XFER_SIZE);
+  TEST_ASSERT_TRUE(link_data.dropped > 0);
+
+  /* Only lost frames are sent again (plus the occasional retransmit that
+     was itself lost), rather than the rest of the window */
+  TEST_ASSERT_TRUE(tx.retransmits >= link_data.dropped);
+  TEST_ASSERT_TRUE(tx.retransmits <= link_data.dropped * 2);
+}
+
+void test_xfer_lost_acks(void)
+{
+  link_data.drop_every = 23;
+  link_ack.drop_every  = 3;
+
+  run_loopback(XFER_SIZE, 16);
+
+  TEST_ASSERT_EQUAL_MEMORY(src, dst, XFER_SIZE);
+  TEST_ASSERT_TRUE(prot_xfer_rx_done(&rx));
+}
+
+void test_xfer_stale_and_foreign_acks(void)
+{
+  uint8_t ack[64] = { MSGTYPE_DATA_ACK, 0x34, 0x12, PROT_XFER_ACK_LENGTH, 0, 0, 8 };
+
+  prot_xfer_tx_start(&tx, XFER_ID, XFER_SIZE, read_src, send_data);
+  prot_xfer_tx_poll(&tx, 4);
+
+  /* Acking data that was never sent */
+  ack[4] = 5;
+  TEST_ASSERT_EQUAL(ERROR_PROT_INVALIDPAYLOAD, prot_xfer_tx_ack(&tx, ack));
+
+  /* Wrong transfer ID */
+  ack[4] = 2;
+  ack[1] = 0x35;
+  TEST_ASSERT_EQUAL(ERROR_PROT_INVALIDPAYLOAD, prot_xfer_tx_ack(&tx, ack));
+
+  ack[1] = 0x34;
+  TEST_ASSERT_EQUAL(ERROR_NONE, prot_xfer_tx_ack(&tx, ack));
+  TEST_ASSERT_EQUAL(2, tx.base);
+
+  /* An older ack doesn't move the window back */
+  ack[4] = 1;
+  TEST_ASSERT_EQUAL(ERROR_NONE, prot_xfer_tx_ack(&tx, ack));
+  TEST_ASSERT_EQUAL(2, tx.base);
+}
+
+void test_xfer_gives_up_without_acks(void)
+{
+  uint8_t ack[64] = { MSGTYPE_DATA_ACK, 0x34, 0x12, PROT_XFER_ACK_LENGTH, 0, 0, 8 };
+  uint8_t i;
+
+  prot_xfer_tx_start(&tx, XFER_ID, XFER_SIZE, read_src, send_data);
+  prot_xfer_tx_poll(&tx, 4);
+
+  /* Any valid ack restarts the count */
+  for (i = 0; i < PROT_XFER_MAX_RETRIES; i++)
+  {
+    TEST_ASSERT_EQUAL(ERROR_NONE, prot_xfer_tx_timeout(&tx));
+  }
+  TEST_ASSERT_EQUAL(ERROR_NONE, prot_xfer_tx_ack(&tx, ack));
+
+  for (i = 0; i < PROT_XFER_MAX_RETRIES; i++)
+  {
+    TEST_ASSERT_EQUAL(ERROR_NONE, prot_xfer_tx_timeout(&tx));
+  }
+  TEST_ASSERT_TRUE(tx.active);
+
+  /* The host is gone: the transfer is abandoned */
+  TEST_ASSERT_EQUAL(ERROR_OPERATIONTIMEDOUT, prot_xfer_tx_timeout(&tx));
+  TEST_ASSERT_FALSE(tx.active);
+  TEST_ASSERT_EQUAL(0, prot_xfer_tx_poll(&tx, 4));
+  TEST_ASSERT_FALSE(prot_xfer_tx_done(&tx));
+}
+
+void test_xfer_abort(void)
+{
+  uint8_t ack[64] = { MSGTYPE_DATA_ACK, 0x34, 0x12, PROT_XFER_ACK_LENGTH, 2, 0, 8 };
+
+  prot_xfer_tx_start(&tx, XFER_ID, XFER_SIZE, read_src, send_data);
+  prot_xfer_tx_poll(&tx, 4);
+
+  prot_xfer_tx_abort(&tx);
+  TEST_ASSERT_FALSE(tx.active);
+  TEST_ASSERT_EQUAL(0, prot_xfer_tx_poll(&tx, 4));
+  TEST_ASSERT_EQUAL(ERROR_PROT_INVALIDPAYLOAD, prot_xfer_tx_ack(&tx, ack));
+}
+
+void test_xfer_throughput(void)
+{
+  uint32_t i, loops = 256;
+  clock_t start = clock();
+  double seconds;
+
+  link_data.drop_every = 50;
+
+  for (i = 0; i < loops; i++)
+  {
+    memset(&link_data.frames, 0, sizeof(link_data.frames));
+    link_data.rd = link_data.wr = 0;
+    link_ack.rd  = link_ack.wr  = 0;
+    run_loopback(XFER_SIZE, PROT_XFER_MAX_WINDOW);
+  }
+
+  seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+  TEST_ASSERT_EQUAL_MEMORY(src, dst, XFER_SIZE);
+
+  printf("prot_xfer loopback: %u KB in %.3f s (%.1f MB/s), 2%% loss, %u retransmits/transfer\n",
+         (unsigned) (loops * XFER_SIZE / 1024), seconds,
+         seconds > 0 ? (loops * XFER_SIZE) / seconds / 1e6 : 0.0,
+         (unsigned) tx.retransmits);
+}
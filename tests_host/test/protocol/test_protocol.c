@@ -41,11 +41,19 @@
 #include "protocol_support.h"
 #include "protocol_cmd_led.h"
 #include "protocol_cmd_sysinfo.h"
+#include "protocol_cmd_memrd.h"
+#include "prot_xfer.h"
+#include "protocol_cmd_alert.h"
+#include "prot_alert.h"
+#include "protocol_cmd_probe.h"
+#include "probe.h"
+#include "meminfo.h"
 
 #include "mock_iap.h"
 #include "mock_usb_hid.h"
 #include "mock_usb_custom_class.h"
 #include "mock_board.h"
+#include "mock_delay.h"
 #include "mock_protocol_callback.h"
 
 uint32_t SystemCoreClock = 12000000; // overshadow the variable used to determine core lock
@@ -151,4 +159,504 @@ void test_invalid_command(void)
 
 }
 
+//--------------------------------------------------------------------+
+// COMMAND TABLE
+//--------------------------------------------------------------------+
+#define CMD_ID_EXPAND(command, function, min_length, max_length)   command,
+#define CMD_MIN_EXPAND(command, function, min_length, max_length)  min_length,
+#define CMD_MAX_EXPAND(command, function, min_length, max_length)  max_length,
+
+static uint16_t const cmd_ids[]        = { PROTOCOL_COMMAND_TABLE(CMD_ID_EXPAND) };
+static uint8_t  const cmd_min_length[] = { PROTOCOL_COMMAND_TABLE(CMD_MIN_EXPAND) };
+static uint8_t  const cmd_max_length[] = { PROTOCOL_COMMAND_TABLE(CMD_MAX_EXPAND) };
+
+void test_command_table_sorted(void)
+{
+  uint8_t i;
+
+  // The lookup is a binary search, so IDs must be unique and ascending
+  for (i = 1; i < sizeof(cmd_ids)/sizeof(cmd_ids[0]); i++)
+  {
+    TEST_ASSERT_TRUE(cmd_ids[i-1] < cmd_ids[i]);
+  }
+
+  for (i = 0; i < sizeof(cmd_ids)/sizeof(cmd_ids[0]); i++)
+  {
+    TEST_ASSERT_TRUE(cmd_min_length[i] <= cmd_max_length[i]);
+    TEST_ASSERT_TRUE(cmd_max_length[i] <= PROT_MAX_MSG_SIZE-4);
+  }
+}
+
+void test_command_table_payload_length(void)
+{
+  uint8_t i;
+
+  protMsgError_t invalid_payload_error =
+  {
+    .msg_type = PROT_MSGTYPE_ERROR,
+    .error_id = ERROR_PROT_INVALIDPAYLOAD
+  };
+
+  // Every command is found, and rejected before its handler is called
+  // when the payload length is out of range
+  for (i = 0; i < sizeof(cmd_ids)/sizeof(cmd_ids[0]); i++)
+  {
+    message_cmd.msg_type = PROT_MSGTYPE_COMMAND;
+    message_cmd.cmd_id   = cmd_ids[i];
+    message_cmd.length   = cmd_min_length[i] ? cmd_min_length[i] - 1 : cmd_max_length[i] + 1;
+
+    fifo_write(&ff_prot_cmd, &message_cmd);
+
+    prot_cmd_error_cb_Expect(&invalid_payload_error);
+    MOCK_PROT(command_send, _ExpectWithArrayAndReturn) (
+        (uint8_t *) &invalid_payload_error, sizeof(protMsgError_t),
+        sizeof(protMsgError_t), LPC_OK);
+
+    //------------- Code Under Test -------------//
+    prot_task(NULL);
+  }
+}
+
+void test_command_table_sparse_ids(void)
+{
+  // IDs that fall between or after the table entries are unknown
+  message_cmd.msg_type = PROT_MSGTYPE_COMMAND;
+  message_cmd.cmd_id   = 0x0100;
+
+  fifo_write(&ff_prot_cmd, &message_cmd);
+
+  protMsgError_t invalid_command_error =
+  {
+    .msg_type = PROT_MSGTYPE_ERROR,
+    .error_id = ERROR_PROT_INVALIDCOMMANDID
+  };
+
+  prot_cmd_error_cb_Expect(&invalid_command_error);
+  MOCK_PROT(command_send, _ExpectWithArrayAndReturn) (
+      (uint8_t *) &invalid_command_error, sizeof(protMsgError_t),
+      sizeof(protMsgError_t), LPC_OK);
+
+  //------------- Code Under Test -------------//
+  prot_task(NULL);
+}
+
+//--------------------------------------------------------------------+
+// REQUEST TAGS / PIPELINING
+//--------------------------------------------------------------------+
+void test_tagged_command_response(void)
+{
+  message_cmd.msg_type   = PROT_MSGTYPE_COMMAND | 0x05;
+  message_cmd.cmd_id     = PROT_CMDTYPE_LED;
+  message_cmd.length     = 1;
+  message_cmd.payload[0] = 1;
+
+  fifo_write(&ff_prot_cmd, &message_cmd);
+
+  protMsgResponse_t expected_response =
+  {
+    .msg_type = PROT_MSGTYPE_RESPONSE | 0x05,
+    .cmd_id   = PROT_CMDTYPE_LED
+  };
+
+  prot_cmd_received_cb_Expect(&message_cmd);
+  boardLED_Expect(CFG_LED_ON);
+  prot_cmd_executed_cb_Expect(&expected_response);
+  MOCK_PROT(command_send, _ExpectWithArrayAndReturn) (
+      (uint8_t *) &expected_response, sizeof(protMsgResponse_t),
+      sizeof(protMsgResponse_t), LPC_OK);
+
+  //------------- Code Under Test -------------//
+  prot_task(NULL);
+}
+
+void test_tagged_command_error(void)
+{
+  message_cmd.msg_type = PROT_MSGTYPE_COMMAND | 0x0A;
+  message_cmd.cmd_id   = 0;
+
+  fifo_write(&ff_prot_cmd, &message_cmd);
+
+  protMsgError_t expected_error =
+  {
+    .msg_type = PROT_MSGTYPE_ERROR | 0x0A,
+    .error_id = ERROR_PROT_INVALIDCOMMANDID
+  };
+
+  prot_cmd_error_cb_Expect(&expected_error);
+  MOCK_PROT(command_send, _ExpectWithArrayAndReturn) (
+      (uint8_t *) &expected_error, sizeof(protMsgError_t),
+      sizeof(protMsgError_t), LPC_OK);
+
+  //------------- Code Under Test -------------//
+  prot_task(NULL);
+}
+
+void test_command_fifo_not_overwritten(void)
+{
+  uint8_t i;
+
+  // There's room for a command per request tag
+  for (i = 0; i < PROT_CMD_QUEUE_DEPTH; i++)
+  {
+    message_cmd.msg_type = PROT_MSGTYPE_COMMAND | (i+1);
+    TEST_ASSERT_TRUE( fifo_write(&ff_prot_cmd, &message_cmd) );
+  }
+
+  // A full FIFO rejects new commands instead of dropping the oldest one
+  message_cmd.msg_type = PROT_MSGTYPE_COMMAND;
+  TEST_ASSERT_FALSE( fifo_write(&ff_prot_cmd, &message_cmd) );
+
+  fifo_read(&ff_prot_cmd, &message_cmd);
+  TEST_ASSERT_EQUAL_HEX8(PROT_MSGTYPE_COMMAND | 1, message_cmd.msg_type);
+}
+
+void test_busy_error_for_rejected_command(void)
+{
+  // Command rejected by command_received_isr because the FIFO was full
+  uint8_t rejected_msg_type = PROT_MSGTYPE_COMMAND | 0x03;
+  fifo_write(&ff_prot_busy, &rejected_msg_type);
+
+  protMsgError_t expected_error =
+  {
+    .msg_type = PROT_MSGTYPE_ERROR | 0x03,
+    .error_id = ERROR_PROT_BUSY
+  };
+
+  prot_cmd_error_cb_Expect(&expected_error);
+  MOCK_PROT(command_send, _ExpectWithArrayAndReturn) (
+      (uint8_t *) &expected_error, sizeof(protMsgError_t),
+      sizeof(protMsgError_t), LPC_OK);
+
+  //------------- Code Under Test -------------//
+  prot_task(NULL);
+}
+
+void test_deferred_completion(void)
+{
+  // Response header as saved by a handler that returned ERROR_PROT_PENDING
+  protMsgResponse_t pending_response =
+  {
+    .msg_type   = PROT_MSGTYPE_RESPONSE | 0x0F,
+    .cmd_id     = PROT_CMDTYPE_SYSINFO,
+    .length     = 1,
+    .payload[0] = 0x42
+  };
+
+  prot_cmd_executed_cb_Expect(&pending_response);
+  MOCK_PROT(command_send, _ExpectWithArrayAndReturn) (
+      (uint8_t *) &pending_response, sizeof(protMsgResponse_t),
+      sizeof(protMsgResponse_t), LPC_OK);
+
+  TEST_ASSERT_EQUAL(ERROR_NONE, prot_cmd_complete(&pending_response, ERROR_NONE));
+  TEST_ASSERT_EQUAL(ERROR_INVALIDPARAMETER, prot_cmd_complete(&pending_response, ERROR_PROT_PENDING));
+
+  pending_response.msg_type = PROT_MSGTYPE_COMMAND;
+  TEST_ASSERT_EQUAL(ERROR_PROT_INVALIDMSGTYPE, prot_cmd_complete(&pending_response, ERROR_NONE));
+}
+
+//--------------------------------------------------------------------+
+// STREAMING ALERTS
+//--------------------------------------------------------------------+
+static uint8_t sample_topic(uint8_t data[])
+{
+  data[0] = 0xA5;
+  return 1;
+}
+
+void test_builtin_alert_topics(void)
+{
+  uint8_t data = 0;
+
+  /* Registered by prot_init, so the host can subscribe straight away */
+  TEST_ASSERT_EQUAL(ERROR_NONE, prot_alert_subscribe(PROT_ALERT_TOPIC_UPTIME, 1000, 0));
+  TEST_ASSERT_EQUAL(ERROR_NONE, prot_alert_subscribe(PROT_ALERT_TOPIC_SENSORALERT, 0, 0));
+  TEST_ASSERT_EQUAL(ERROR_NONE, prot_alert_publish(PROT_ALERT_TOPIC_SENSORALERT, &data, 1));
+}
+
+void test_subscribe_streams_alerts(void)
+{
+  prot_alert_register(0x0010, sample_topic);
+
+  message_cmd.msg_type   = PROT_MSGTYPE_COMMAND;
+  message_cmd.cmd_id     = PROT_CMDTYPE_SUBSCRIBE;
+  message_cmd.length     = 5;
+  message_cmd.payload[0] = 0x10;  // topic
+  message_cmd.payload[2] = 100;   // interval
+
+  fifo_write(&ff_prot_cmd, &message_cmd);
+
+  protMsgResponse_t expected_response =
+  {
+    .msg_type = PROT_MSGTYPE_RESPONSE,
+    .cmd_id   = PROT_CMDTYPE_SUBSCRIBE
+  };
+
+  protMsgAlert_t expected_alert =
+  {
+    .msg_type   = PROT_MSGTYPE_ALERT,
+    .cmd_id     = PROT_ALERT_ID_EVENTS,
+    .length     = 4,
+    .payload    = { 0x10, 0x00, 0x01, 0xA5 }
+  };
+
+  prot_cmd_received_cb_Expect(&message_cmd);
+  prot_cmd_executed_cb_Expect(&expected_response);
+  MOCK_PROT(command_send, _ExpectWithArrayAndReturn) (
+      (uint8_t *) &expected_response, sizeof(protMsgResponse_t),
+      sizeof(protMsgResponse_t), LPC_OK);
+
+  // First sample is streamed right after subscribing
+  delayGetTicks_ExpectAndReturn(1000);
+  MOCK_PROT(command_send, _ExpectWithArrayAndReturn) (
+      (uint8_t *) &expected_alert, sizeof(protMsgAlert_t),
+      sizeof(protMsgAlert_t), LPC_OK);
+
+  //------------- Code Under Test -------------//
+  prot_task(NULL);
+
+  // Nothing new until the interval expires
+  delayGetTicks_ExpectAndReturn(1050);
+  prot_task(NULL);
+}
+
+//--------------------------------------------------------------------+
+// BULK TRANSFERS
+//--------------------------------------------------------------------+
+void test_data_ack_without_transfer(void)
+{
+  message_cmd.msg_type = PROT_MSGTYPE_DATA_ACK;
+  message_cmd.cmd_id   = 1;
+  message_cmd.length   = PROT_XFER_ACK_LENGTH;
+
+  fifo_write(&ff_prot_cmd, &message_cmd);
+
+  // Stale acks are dropped silently: no callback, no error message
+
+  //------------- Code Under Test -------------//
+  prot_task(NULL);
+}
+
+static err_t xfer_read(uint32_t offset, uint8_t * buffer, uint8_t length)
+{
+  memset(buffer, 0x5A, length);
+  return ERROR_NONE;
+}
+
+void test_xfer_abandoned_without_acks(void)
+{
+  uint16_t xfer_id;
+  uint32_t tick = 1000;
+  uint8_t i;
+
+  // 100 bytes = 2 chunks
+  delayGetTicks_ExpectAndReturn(tick);
+  TEST_ASSERT_EQUAL(ERROR_NONE, prot_xfer_start(100, xfer_read, &xfer_id));
+  TEST_ASSERT_EQUAL(ERROR_PROT_BUSY, prot_xfer_start(100, xfer_read, &xfer_id));
+
+  // Retransmit timeouts with no ack in between, until the device gives up
+  for (i = 0; i <= PROT_XFER_MAX_RETRIES; i++)
+  {
+    tick += 1000;
+    delayGetTicks_ExpectAndReturn(tick);
+    delayGetTicks_ExpectAndReturn(tick);
+    if (i < PROT_XFER_MAX_RETRIES)
+    {
+      MOCK_PROT(command_send, _IgnoreAndReturn) (LPC_OK);
+      MOCK_PROT(command_send, _IgnoreAndReturn) (LPC_OK);
+    }
+
+    //------------- Code Under Test -------------//
+    prot_task(NULL);
+  }
+
+  // Nothing is sent anymore, and a new transfer can start
+  prot_task(NULL);
+  delayGetTicks_ExpectAndReturn(tick);
+  TEST_ASSERT_EQUAL(ERROR_NONE, prot_xfer_start(100, xfer_read, &xfer_id));
+}
+
+void test_xfer_abort_command(void)
+{
+  uint16_t xfer_id;
+
+  protMsgError_t invalid_parameter_error =
+  {
+    .msg_type = PROT_MSGTYPE_ERROR,
+    .error_id = ERROR_INVALIDPARAMETER
+  };
+
+  protMsgResponse_t expected_response =
+  {
+    .msg_type = PROT_MSGTYPE_RESPONSE,
+    .cmd_id   = PROT_CMDTYPE_XFERABORT
+  };
+
+  delayGetTicks_ExpectAndReturn(1000);
+  TEST_ASSERT_EQUAL(ERROR_NONE, prot_xfer_start(100, xfer_read, &xfer_id));
+
+  message_cmd.msg_type   = PROT_MSGTYPE_COMMAND;
+  message_cmd.cmd_id     = PROT_CMDTYPE_XFERABORT;
+  message_cmd.length     = 2;
+
+  // Another transfer ID is rejected, and the transfer keeps going
+  message_cmd.payload[0] = (uint8_t) (xfer_id + 1);
+  message_cmd.payload[1] = (uint8_t) ((xfer_id + 1) >> 8);
+  fifo_write(&ff_prot_cmd, &message_cmd);
+
+  prot_cmd_received_cb_Expect(&message_cmd);
+  prot_cmd_error_cb_Expect(&invalid_parameter_error);
+  MOCK_PROT(command_send, _ExpectWithArrayAndReturn) (
+      (uint8_t *) &invalid_parameter_error, sizeof(protMsgError_t),
+      sizeof(protMsgError_t), LPC_OK);
+  delayGetTicks_ExpectAndReturn(1000);
+  MOCK_PROT(command_send, _IgnoreAndReturn) (LPC_OK);
+  MOCK_PROT(command_send, _IgnoreAndReturn) (LPC_OK);
+
+  //------------- Code Under Test -------------//
+  prot_task(NULL);
+  TEST_ASSERT_EQUAL(ERROR_PROT_BUSY, prot_xfer_start(100, xfer_read, &xfer_id));
+
+  message_cmd.payload[0] = (uint8_t) (xfer_id);
+  message_cmd.payload[1] = (uint8_t) (xfer_id >> 8);
+  fifo_write(&ff_prot_cmd, &message_cmd);
+
+  prot_cmd_received_cb_Expect(&message_cmd);
+  prot_cmd_executed_cb_Expect(&expected_response);
+  MOCK_PROT(command_send, _ExpectWithArrayAndReturn) (
+      (uint8_t *) &expected_response, sizeof(protMsgResponse_t),
+      sizeof(protMsgResponse_t), LPC_OK);
+
+  //------------- Code Under Test -------------//
+  prot_task(NULL);
+
+  // The data phase stopped, and a new transfer can start
+  delayGetTicks_ExpectAndReturn(1000);
+  TEST_ASSERT_EQUAL(ERROR_NONE, prot_xfer_start(100, xfer_read, &xfer_id));
+}
+
+//--------------------------------------------------------------------+
+// BATCH MESSAGES
+//--------------------------------------------------------------------+
+void test_batch_runs_commands_back_to_back(void)
+{
+  // LED on (tag 1) and an unknown command (tag 2) in one message
+  uint8_t const packed[] =
+  {
+    PROT_MSGTYPE_COMMAND | 0x01, 0x01, 0x00, 0x01, 0x01,
+    PROT_MSGTYPE_COMMAND | 0x02, 0xFF, 0x00, 0x00
+  };
+  message_cmd.msg_type = PROT_MSGTYPE_BATCH | 0x03;
+  message_cmd.cmd_id   = 2;
+  message_cmd.length   = sizeof(packed);
+  memcpy(message_cmd.payload, packed, sizeof(packed));
+
+  fifo_write(&ff_prot_cmd, &message_cmd);
+
+  // Both replies come back packed in a single batch message
+  protMsgBatch_t expected_batch =
+  {
+    .msg_type = PROT_MSGTYPE_BATCH | 0x03,
+    .cmd_id   = 2,
+    .length   = 7,
+    .payload  =
+    {
+      PROT_MSGTYPE_RESPONSE | 0x01, 0x01, 0x00, 0x00,
+      PROT_MSGTYPE_ERROR | 0x02, (uint8_t) ERROR_PROT_INVALIDCOMMANDID, ERROR_PROT_INVALIDCOMMANDID >> 8
+    }
+  };
+
+  prot_cmd_received_cb_Ignore();
+  boardLED_Expect(CFG_LED_ON);
+  prot_cmd_executed_cb_Ignore();
+  prot_cmd_error_cb_Ignore();
+  MOCK_PROT(command_send, _ExpectWithArrayAndReturn) (
+      (uint8_t *) &expected_batch, sizeof(protMsgBatch_t),
+      sizeof(protMsgBatch_t), LPC_OK);
+
+  //------------- Code Under Test -------------//
+  prot_task(NULL);
+}
+
+void test_batch_truncated_command(void)
+{
+  // LED command claims a 1 byte payload, but the batch ends first
+  uint8_t const packed[] = { PROT_MSGTYPE_COMMAND | 0x01, 0x01, 0x00, 0x01 };
+  message_cmd.msg_type = PROT_MSGTYPE_BATCH | 0x04;
+  message_cmd.cmd_id   = 1;
+  message_cmd.length   = sizeof(packed);
+  memcpy(message_cmd.payload, packed, sizeof(packed));
+
+  fifo_write(&ff_prot_cmd, &message_cmd);
+
+  protMsgBatch_t expected_batch =
+  {
+    .msg_type = PROT_MSGTYPE_BATCH | 0x04,
+    .cmd_id   = 1,
+    .length   = 3,
+    .payload  =
+    {
+      PROT_MSGTYPE_ERROR | 0x04, (uint8_t) ERROR_PROT_INVALIDPAYLOAD, ERROR_PROT_INVALIDPAYLOAD >> 8
+    }
+  };
+
+  prot_cmd_error_cb_Ignore();
+  MOCK_PROT(command_send, _ExpectWithArrayAndReturn) (
+      (uint8_t *) &expected_batch, sizeof(protMsgBatch_t),
+      sizeof(protMsgBatch_t), LPC_OK);
+
+  //------------- Code Under Test -------------//
+  prot_task(NULL);
+}
+
+void test_batch_replies_split_when_full(void)
+{
+  // 10 SYSINFO commands fit in one batch, but their 10 responses don't
+  uint8_t const sysinfo[] = { PROT_MSGTYPE_COMMAND | 0x01, 0x02, 0x00, 0x02,
+                              (uint8_t) PROT_CMD_SYSINFO_KEY_CODEBASE_VERSION, 0x00 };
+  uint8_t const version[] = { PROT_MSGTYPE_RESPONSE | 0x01, 0x02, 0x00, 0x03,
+                              CFG_CODEBASE_VERSION_MAJOR, CFG_CODEBASE_VERSION_MINOR, CFG_CODEBASE_VERSION_REVISION };
+  uint8_t i;
+
+  message_cmd.msg_type = PROT_MSGTYPE_BATCH;
+  message_cmd.cmd_id   = 10;
+  for (i = 0; i < 10; i++)
+  {
+    memcpy(&message_cmd.payload[message_cmd.length], sysinfo, sizeof(sysinfo));
+    message_cmd.length += sizeof(sysinfo);
+  }
+
+  fifo_write(&ff_prot_cmd, &message_cmd);
+
+  protMsgBatch_t expected_first  = { .msg_type = PROT_MSGTYPE_BATCH, .cmd_id = 8, .length = 8*sizeof(version) };
+  protMsgBatch_t expected_second = { .msg_type = PROT_MSGTYPE_BATCH, .cmd_id = 2, .length = 2*sizeof(version) };
+  for (i = 0; i < 8; i++)
+  {
+    memcpy(&expected_first.payload[i*sizeof(version)], version, sizeof(version));
+  }
+  for (i = 0; i < 2; i++)
+  {
+    memcpy(&expected_second.payload[i*sizeof(version)], version, sizeof(version));
+  }
+
+  for (i = 0; i < 10; i++)
+  {
+    prot_cmd_received_cb_Ignore();
+    prot_cmd_executed_cb_Ignore();
+
+    // The first batch is sent when the 9th response doesn't fit
+    if (i == 8)
+    {
+      MOCK_PROT(command_send, _ExpectWithArrayAndReturn) (
+          (uint8_t *) &expected_first, sizeof(protMsgBatch_t),
+          sizeof(protMsgBatch_t), LPC_OK);
+    }
+  }
+  MOCK_PROT(command_send, _ExpectWithArrayAndReturn) (
+      (uint8_t *) &expected_second, sizeof(protMsgBatch_t),
+      sizeof(protMsgBatch_t), LPC_OK);
+
+  //------------- Code Under Test -------------//
+  prot_task(NULL);
+}
+
 #endif
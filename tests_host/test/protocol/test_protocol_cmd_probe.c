@@ -0,0 +1,166 @@
+/**************************************************************************/
+/*!
+    @file     test_protocol_cmd_probe.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+#include <string.h>
+#include "unity.h"
+#include "fifo.h"
+#include "protocol.h"
+#include "protocol_cmd_led.h"
+#include "protocol_cmd_sysinfo.h"
+#include "protocol_cmd_memrd.h"
+#include "prot_xfer.h"
+#include "protocol_cmd_alert.h"
+#include "prot_alert.h"
+#include "protocol_cmd_probe.h"
+#include "probe.h"
+#include "meminfo.h"
+#include "protocol_support.h"
+
+#include "mock_iap.h"
+#include "mock_usb_hid.h"
+#include "mock_usb_custom_class.h"
+#include "mock_board.h"
+#include "mock_delay.h"
+#include "mock_protocol_callback.h"
+
+uint32_t SystemCoreClock = 12000000; // overshadow the variable used to determine core lock
+
+static protMsgCommand_t  message_cmd;
+static protMsgError_t    message_error;
+static protMsgResponse_t message_response;
+
+void setUp(void)
+{
+  prot_init();
+  probeInit();
+  memset(&message_cmd, 0, sizeof(protMsgCommand_t) );
+  memset(&message_response, 0, sizeof(protMsgResponse_t) );
+}
+
+void tearDown(void)
+{
+
+}
+
+static void cmd_executed_stub(protMsgResponse_t const * p_response, int num_call)
+{
+  message_response = *p_response;
+}
+
+static uint32_t response_u32(uint8_t offset)
+{
+  uint32_t value;
+  memcpy(&value, &message_response.payload[offset], 4);
+  return value;
+}
+
+static uint16_t response_u16(uint8_t offset)
+{
+  return message_response.payload[offset] | (message_response.payload[offset + 1] << 8);
+}
+
+//--------------------------------------------------------------------+
+// PROBE COMMAND
+//--------------------------------------------------------------------+
+void test_cmd_probe_stats(void)
+{
+  probe_t *other = probeRegister("other");
+  probe_t *probe = probeRegister("i2c_read_accel_xyz");
+
+  probeRecord(other, 1);
+  probeRecord(probe, 100);      // bin 6
+  probeRecord(probe, 120);      // bin 6
+  probeRecord(probe, 300);      // bin 8
+  probeRecord(probe, 0x40000);  // bin 18, added to the last bin (6 + 11)
+
+  message_cmd = (protMsgCommand_t)
+  {
+    .msg_type    = PROT_MSGTYPE_COMMAND,
+    .cmd_id      = PROT_CMDTYPE_PROBE,
+    .length      = 1,
+    .payload[0]  = 1
+  };
+  fifo_write(&ff_prot_cmd, &message_cmd);
+
+  prot_cmd_received_cb_Ignore();
+  prot_cmd_executed_cb_StubWithCallback(cmd_executed_stub);
+  MOCK_PROT(command_send, _IgnoreAndReturn)(LPC_OK);
+
+  //------------- CUT -------------//
+  prot_task(NULL);
+
+  TEST_ASSERT_EQUAL(PROT_CMDTYPE_PROBE, message_response.cmd_id);
+  TEST_ASSERT_EQUAL(2 + 16 + 24 + 16, message_response.length);
+  TEST_ASSERT_EQUAL(2, message_response.payload[0]);
+  TEST_ASSERT_EQUAL(6, message_response.payload[1]);
+  TEST_ASSERT_EQUAL(4, response_u32(2));
+  TEST_ASSERT_EQUAL(100, response_u32(6));
+  TEST_ASSERT_EQUAL((100 + 120 + 300 + 0x40000) / 4, response_u32(10));
+  TEST_ASSERT_EQUAL(0x40000, response_u32(14));
+  TEST_ASSERT_EQUAL(2, response_u16(18));
+  TEST_ASSERT_EQUAL(0, response_u16(20));
+  TEST_ASSERT_EQUAL(1, response_u16(22));
+  TEST_ASSERT_EQUAL(1, response_u16(18 + 2 * 11));
+  TEST_ASSERT_EQUAL_MEMORY("i2c_read_accel_x", &message_response.payload[42], 16);
+}
+
+void test_cmd_probe_invalid_index(void)
+{
+  probeRegister("only");
+
+  message_cmd = (protMsgCommand_t)
+  {
+    .msg_type    = PROT_MSGTYPE_COMMAND,
+    .cmd_id      = PROT_CMDTYPE_PROBE,
+    .length      = 1,
+    .payload[0]  = 1
+  };
+
+  message_error = (protMsgError_t)
+  {
+    .msg_type = PROT_MSGTYPE_ERROR,
+    .error_id = ERROR_INVALIDPARAMETER
+  };
+
+  fifo_write(&ff_prot_cmd, &message_cmd);
+
+  prot_cmd_received_cb_Ignore();
+  prot_cmd_error_cb_Expect(&message_error);
+  MOCK_PROT(command_send, _IgnoreAndReturn)(LPC_OK);
+
+  //------------- CUT -------------//
+  prot_task(NULL);
+}
@@ -40,12 +40,20 @@
 #include "protocol.h"
 #include "protocol_cmd_led.h"
 #include "protocol_cmd_sysinfo.h"
+#include "protocol_cmd_memrd.h"
+#include "prot_xfer.h"
+#include "protocol_cmd_alert.h"
+#include "prot_alert.h"
+#include "protocol_cmd_probe.h"
+#include "probe.h"
+#include "meminfo.h"
 #include "protocol_support.h"
 
 #include "mock_iap.h"
 #include "mock_usb_hid.h"
 #include "mock_usb_custom_class.h"
 #include "mock_board.h"
+#include "mock_delay.h"
 #include "mock_protocol_callback.h"
 
 uint32_t SystemCoreClock = 12000000; // overshadow the variable used to determine core lock
@@ -94,7 +102,7 @@ void test_sysinfo_invalid_length_zero(void)
 
   fifo_write(&ff_prot_cmd, &message_cmd);
 
-  prot_cmd_received_cb_Expect(&message_cmd);
+  // Rejected by the command table before the handler is called
   prot_cmd_error_cb_Expect(&message_error);
   MOCK_PROT(command_send, _IgnoreAndReturn)(LPC_OK);
 
@@ -127,7 +135,7 @@ void test_sysinfo_invalid_length_too_long(void)
 
   fifo_write(&ff_prot_cmd, &message_cmd);
 
-  prot_cmd_received_cb_Expect(&message_cmd);
+  // Rejected by the command table before the handler is called
   prot_cmd_error_cb_Expect(&message_error);
   MOCK_PROT(command_send, _IgnoreAndReturn)(LPC_OK);
 
@@ -146,7 +154,7 @@ void test_sysinfo_invalid_key(void)
   {
     .msg_type    = PROT_MSGTYPE_COMMAND,
     .cmd_id      = PROT_CMDTYPE_SYSINFO,
-    .length      = 40,
+    .length      = 2,
     .payload     = { U16_LOW_U8(PROT_CMD_SYSINFO_KEY_LAST),  U16_HIGH_U8(PROT_CMD_SYSINFO_KEY_LAST) }
   };
 
@@ -260,3 +268,75 @@ void test_sysinfo_uid(void)
   /* ------------- Code Under Test ------------- */
   prot_task(NULL);
 }
+
+/**************************************************************************/
+/*!
+    PROT_CMD_SYSINFO_KEY_STACK returns the stack size and high-water mark
+*/
+/**************************************************************************/
+void test_sysinfo_stack(void)
+{
+  static uint32_t stack[32];
+  uint32_t expected[2] = { sizeof(stack), 12 };
+
+  meminfoInitRegion(stack, &stack[32]);
+  stack[29] = 0;
+
+  message_cmd = (protMsgCommand_t)
+  {
+    .msg_type    = PROT_MSGTYPE_COMMAND,
+    .cmd_id      = PROT_CMDTYPE_SYSINFO,
+    .length      = 2,
+    .payload     = { U16_LOW_U8 (PROT_CMD_SYSINFO_KEY_STACK),
+                     U16_HIGH_U8(PROT_CMD_SYSINFO_KEY_STACK) }
+  };
+
+  message_response = (protMsgResponse_t)
+  {
+    .msg_type    = PROT_MSGTYPE_RESPONSE,
+    .cmd_id      = PROT_CMDTYPE_SYSINFO,
+    .length      = 8,
+  };
+  memcpy(message_response.payload, expected, 8);
+
+  fifo_write(&ff_prot_cmd, &message_cmd);
+
+  prot_cmd_received_cb_Expect(&message_cmd);
+  prot_cmd_executed_cb_Expect(&message_response);
+  MOCK_PROT(command_send, _IgnoreAndReturn)(LPC_OK);
+
+  /* ------------- Code Under Test ------------- */
+  prot_task(NULL);
+}
+
+/**************************************************************************/
+/*!
+    Keys for drivers that aren't enabled (CFG_PN532 here) are rejected
+*/
+/**************************************************************************/
+void test_sysinfo_pn532_pool_disabled(void)
+{
+  message_cmd = (protMsgCommand_t)
+  {
+    .msg_type    = PROT_MSGTYPE_COMMAND,
+    .cmd_id      = PROT_CMDTYPE_SYSINFO,
+    .length      = 2,
+    .payload     = { U16_LOW_U8 (PROT_CMD_SYSINFO_KEY_PN532_POOL),
+                     U16_HIGH_U8(PROT_CMD_SYSINFO_KEY_PN532_POOL) }
+  };
+
+  message_error = (protMsgError_t)
+  {
+    .msg_type = PROT_MSGTYPE_ERROR,
+    .error_id = ERROR_INVALIDPARAMETER
+  };
+
+  fifo_write(&ff_prot_cmd, &message_cmd);
+
+  prot_cmd_received_cb_Expect(&message_cmd);
+  prot_cmd_error_cb_Expect(&message_error);
+  MOCK_PROT(command_send, _IgnoreAndReturn)(LPC_OK);
+
+  /* ------------- Code Under Test ------------- */
+  prot_task(NULL);
+}
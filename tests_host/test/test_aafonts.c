@@ -0,0 +1,345 @@
+/**************************************************************************/
+/*!
+    @file     test_aafonts.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+#include <string.h>
+#include "unity.h"
+#include "colors.h"
+#include "aafonts.h"
+
+#define WIDTH   (176)
+#define HEIGHT  (220)
+
+//--------------------------------------------------------------------+
+// LCD stub: lcdBlit (used when CFG_TFTLCD_FRAMEBUFFER is defined) draws
+// into a screen buffer and counts the calls
+//--------------------------------------------------------------------+
+static uint16_t screen[HEIGHT][WIDTH];
+static uint16_t rawScreen[HEIGHT][WIDTH];
+static uint32_t blits, pixels;
+
+uint16_t lcdGetWidth(void)  { return WIDTH; }
+uint16_t lcdGetHeight(void) { return HEIGHT; }
+
+void lcdBlit(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t *data)
+{
+  uint16_t row, col;
+
+  TEST_ASSERT_TRUE(x + width <= WIDTH);
+  TEST_ASSERT_TRUE(y + height <= HEIGHT);
+  for (row = 0; row < height; row++)
+  {
+    for (col = 0; col < width; col++)
+    {
+      screen[y + row][x + col] = *data++;
+    }
+  }
+  blits++;
+  pixels += width * height;
+}
+
+//--------------------------------------------------------------------+
+// Test fonts: 'A' in AA2, 'B' 40 pixels wide (more than one row buffer)
+// and 'A' in AA4
+//--------------------------------------------------------------------+
+static const uint8_t glyphAA2[] = { 0x1B, 0x20,     // 0 1 2 3 | 0 2
+                                    0xE4, 0x10,     // 3 2 1 0 | 0 1
+                                    0xFF, 0xF0 };   // 3 3 3 3 | 3 3
+static const uint8_t glyphWide[20] = { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xFF,
+                                       0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00 };
+static const uint8_t glyphAA4[] = { 0x0F, 0x80,     // 0 15 8
+                                    0x12, 0x30,     // 1 2 3
+                                    0xED, 0xC0 };   // 14 13 12
+
+static const aafontsCharInfo_t charsAA2[] = { { 6, 2, glyphAA2 }, { 40, 10, glyphWide } };
+static const aafontsCharInfo_t charsAA4[] = { { 3, 2, glyphAA4 } };
+
+static const aafontsFont_t fontAA2 = { AAFONTS_FONTTYPE_AA2, 3, 4, 3, 2, 2, 'A', 'B', charsAA2 };
+static const aafontsFont_t fontWide = { AAFONTS_FONTTYPE_AA2, 2, 4, 2, 2, 2, 'A', 'B', charsAA2 };
+static const aafontsFont_t fontAA4 = { AAFONTS_FONTTYPE_AA4, 3, 4, 3, 2, 2, 'A', 'A', charsAA4 };
+
+// The same glyphs, run-length encoded (AAFONTS_ENCODING_RLE)
+static const uint8_t rleAA2[] = { 0x0B, 0x1B, 0x2E, 0x41,         // 12 pixel literal
+                                  0xC5 };                         // 6 x 3
+static const uint8_t rleWide[] = { 0x23, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+                                   0xC3,                          // 4 x 3
+                                   0x23, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+                                   0x83 };                        // 4 x 0
+static const uint8_t rleAA4[] = { 0x02, 0x0F, 0x80,               // 3 pixel literal
+                                  0x05, 0x12, 0x3E, 0xDC };       // 6 pixel literal
+
+static const aafontsCharInfo_t rleCharsAA2[] = { { 6, 0, rleAA2 }, { 40, 0, rleWide } };
+static const aafontsCharInfo_t rleCharsAA4[] = { { 3, 0, rleAA4 } };
+
+static const aafontsFont_t rleFontAA2 = { AAFONTS_FONTTYPE_AA2, 3, 4, 3, 2, 2, 'A', 'B', rleCharsAA2, AAFONTS_ENCODING_RLE };
+static const aafontsFont_t rleFontWide = { AAFONTS_FONTTYPE_AA2, 2, 4, 2, 2, 2, 'A', 'B', rleCharsAA2, AAFONTS_ENCODING_RLE };
+static const aafontsFont_t rleFontAA4 = { AAFONTS_FONTTYPE_AA4, 3, 4, 3, 2, 2, 'A', 'A', rleCharsAA4, AAFONTS_ENCODING_RLE };
+
+static const uint16_t tableAA2[4] = { 0x1000, 0x1001, 0x1002, 0x1003 };
+static uint16_t tableAA4[16];
+
+void setUp(void)
+{
+  uint8_t i;
+
+  memset(screen, 0xEE, sizeof(screen));
+  blits = pixels = 0;
+  for (i = 0; i < 16; i++) tableAA4[i] = 0x4000 + i;
+}
+
+void tearDown(void)
+{
+}
+
+//--------------------------------------------------------------------+
+// Rendering
+//--------------------------------------------------------------------+
+void test_aa2_glyph_is_decoded_row_by_row(void)
+{
+  static const uint8_t expected[3][6] = { { 0, 1, 2, 3, 0, 2 },
+                                          { 3, 2, 1, 0, 0, 1 },
+                                          { 3, 3, 3, 3, 3, 3 } };
+  uint8_t x, y;
+
+  aafontsDrawString(10, 20, tableAA2, &fontAA2, "A");
+
+  for (y = 0; y < 3; y++)
+  {
+    for (x = 0; x < 6; x++)
+    {
+      // Pixel value 0 is drawn as the bg color rather than skipped
+      TEST_ASSERT_EQUAL_HEX16(tableAA2[expected[y][x]], screen[20 + y][10 + x]);
+    }
+  }
+  TEST_ASSERT_EQUAL_HEX16(0xEEEE, screen[20][16]);
+  TEST_ASSERT_EQUAL_HEX16(0xEEEE, screen[23][10]);
+  TEST_ASSERT_EQUAL(3, blits);
+  TEST_ASSERT_EQUAL(18, pixels);
+}
+
+void test_aa4_glyph_is_decoded_row_by_row(void)
+{
+  static const uint8_t expected[3][3] = { { 0, 15, 8 }, { 1, 2, 3 }, { 14, 13, 12 } };
+  uint8_t x, y;
+
+  aafontsDrawString(0, 0, tableAA4, &fontAA4, "A");
+
+  for (y = 0; y < 3; y++)
+  {
+    for (x = 0; x < 3; x++)
+    {
+      TEST_ASSERT_EQUAL_HEX16(tableAA4[expected[y][x]], screen[y][x]);
+    }
+  }
+  TEST_ASSERT_EQUAL(9, pixels);
+}
+
+void test_wide_glyph_rows_are_sent_in_chunks(void)
+{
+  uint8_t x;
+
+  aafontsDrawString(0, 50, tableAA2, &fontWide, "B");
+
+  for (x = 0; x < 36; x++)
+  {
+    TEST_ASSERT_EQUAL_HEX16(tableAA2[1], screen[50][x]);
+    TEST_ASSERT_EQUAL_HEX16(tableAA2[2], screen[51][x]);
+  }
+  for (x = 36; x < 40; x++)
+  {
+    TEST_ASSERT_EQUAL_HEX16(tableAA2[3], screen[50][x]);
+    TEST_ASSERT_EQUAL_HEX16(tableAA2[0], screen[51][x]);
+  }
+  TEST_ASSERT_EQUAL(80, pixels);
+  TEST_ASSERT_EQUAL(4, blits);
+}
+
+void test_string_advances_and_skips_unknown_chars(void)
+{
+  aafontsDrawString(0, 0, tableAA2, &fontAA2, "AzA");
+
+  // 'z' is outside the font: unknownCharWidth (4) pixels are left alone
+  TEST_ASSERT_EQUAL_HEX16(tableAA2[2], screen[0][5]);
+  TEST_ASSERT_EQUAL_HEX16(0xEEEE, screen[0][6]);
+  TEST_ASSERT_EQUAL_HEX16(0xEEEE, screen[0][9]);
+  TEST_ASSERT_EQUAL_HEX16(tableAA2[0], screen[0][10]);
+  TEST_ASSERT_EQUAL(36, pixels);
+}
+
+void test_glyph_is_clipped_to_the_screen(void)
+{
+  aafontsDrawString(WIDTH - 4, HEIGHT - 2, tableAA2, &fontAA2, "AA");
+
+  // Four columns and two rows of the first glyph, nothing of the second
+  TEST_ASSERT_EQUAL(8, pixels);
+  TEST_ASSERT_EQUAL_HEX16(tableAA2[0], screen[HEIGHT - 1][WIDTH - 1]);
+  TEST_ASSERT_EQUAL_HEX16(tableAA2[3], screen[HEIGHT - 2][WIDTH - 1]);
+}
+
+void test_transparent_glyph_skips_bg_pixels(void)
+{
+  static const uint8_t expected[3][6] = { { 0, 1, 2, 3, 0, 2 },
+                                          { 3, 2, 1, 0, 0, 1 },
+                                          { 3, 3, 3, 3, 3, 3 } };
+  uint8_t x, y;
+
+  aafontsDrawStringTransparent(10, 20, tableAA2, &fontAA2, "A");
+
+  for (y = 0; y < 3; y++)
+  {
+    for (x = 0; x < 6; x++)
+    {
+      TEST_ASSERT_EQUAL_HEX16(expected[y][x] ? tableAA2[expected[y][x]] : 0xEEEE, screen[20 + y][10 + x]);
+    }
+  }
+
+  // One blit per run of visible pixels
+  TEST_ASSERT_EQUAL(5, blits);
+  TEST_ASSERT_EQUAL(14, pixels);
+}
+
+void test_transparent_rle_glyph_matches_raw_glyph(void)
+{
+  aafontsDrawStringTransparent(0, 50, tableAA2, &fontWide, "B");
+  memcpy(rawScreen, screen, sizeof(screen));
+
+  setUp();
+  aafontsDrawStringTransparent(0, 50, tableAA2, &rleFontWide, "B");
+  TEST_ASSERT_EQUAL_MEMORY(rawScreen, screen, sizeof(screen));
+
+  // The second row ends with 4 bg pixels
+  TEST_ASSERT_EQUAL(76, pixels);
+  TEST_ASSERT_EQUAL_HEX16(0xEEEE, screen[51][39]);
+}
+
+//--------------------------------------------------------------------+
+// RLE fonts
+//--------------------------------------------------------------------+
+// Draws the same string with the raw and the RLE font
+static void checkRle(uint16_t x, uint16_t y, const uint16_t *table,
+                     const aafontsFont_t *raw, const aafontsFont_t *rle, char *str)
+{
+  uint32_t rawPixels;
+
+  aafontsDrawString(x, y, table, raw, str);
+  memcpy(rawScreen, screen, sizeof(screen));
+  rawPixels = pixels;
+
+  setUp();
+  aafontsDrawString(x, y, table, rle, str);
+  TEST_ASSERT_EQUAL(rawPixels, pixels);
+  TEST_ASSERT_EQUAL_MEMORY(rawScreen, screen, sizeof(screen));
+}
+
+void test_rle_glyphs_match_raw_glyphs(void)
+{
+  checkRle(10, 20, tableAA2, &fontAA2, &rleFontAA2, "AzA");
+  setUp();
+  checkRle(0, 0, tableAA4, &fontAA4, &rleFontAA4, "A");
+}
+
+void test_rle_runs_and_literals_span_row_buffers(void)
+{
+  checkRle(0, 50, tableAA2, &fontWide, &rleFontWide, "B");
+  TEST_ASSERT_EQUAL(4, blits);
+}
+
+void test_rle_glyph_is_clipped_to_the_screen(void)
+{
+  // The clipped part of each row is still decoded, so the next rows
+  // start at the right place
+  checkRle(WIDTH - 20, HEIGHT - 2, tableAA2, &fontWide, &rleFontWide, "B");
+  TEST_ASSERT_EQUAL(40, pixels);
+  TEST_ASSERT_EQUAL_HEX16(tableAA2[2], screen[HEIGHT - 1][WIDTH - 1]);
+
+  setUp();
+  checkRle(WIDTH - 4, HEIGHT - 2, tableAA2, &fontAA2, &rleFontAA2, "A");
+  TEST_ASSERT_EQUAL(8, pixels);
+}
+
+//--------------------------------------------------------------------+
+// Color table cache
+//--------------------------------------------------------------------+
+void test_color_table_matches_calculated_table(void)
+{
+  uint16_t table[16];
+
+  aafontsCalculateColorTable(COLOR_RED, COLOR_YELLOW, table, 16);
+  TEST_ASSERT_EQUAL_HEX16_ARRAY(table, aafontsGetColorTable(COLOR_RED, COLOR_YELLOW, AAFONTS_FONTTYPE_AA4), 16);
+
+  aafontsCalculateColorTable(COLOR_RED, COLOR_YELLOW, table, 4);
+  TEST_ASSERT_EQUAL_HEX16_ARRAY(table, aafontsGetColorTable(COLOR_RED, COLOR_YELLOW, AAFONTS_FONTTYPE_AA2), 4);
+}
+
+void test_color_table_cache_hits_and_evicts_lru(void)
+{
+  const uint16_t *tables[AAFONTS_COLORCACHE_SIZE];
+  const uint16_t *table;
+  uint8_t i;
+
+  for (i = 0; i < AAFONTS_COLORCACHE_SIZE; i++)
+  {
+    tables[i] = aafontsGetColorTable(0x0100 + i, 0xFFFF, AAFONTS_FONTTYPE_AA2);
+  }
+
+  // Every combination is still cached, and the first is now the most
+  // recently used
+  for (i = 0; i < AAFONTS_COLORCACHE_SIZE; i++)
+  {
+    TEST_ASSERT_EQUAL_PTR(tables[i], aafontsGetColorTable(0x0100 + i, 0xFFFF, AAFONTS_FONTTYPE_AA2));
+  }
+  TEST_ASSERT_EQUAL_PTR(tables[0], aafontsGetColorTable(0x0100, 0xFFFF, AAFONTS_FONTTYPE_AA2));
+
+  // A new combination replaces the least recently used entry (the second)
+  table = aafontsGetColorTable(0x0200, 0xFFFF, AAFONTS_FONTTYPE_AA2);
+  TEST_ASSERT_EQUAL_PTR(tables[1], table);
+  TEST_ASSERT_EQUAL_HEX16(0x0200, table[0]);
+  TEST_ASSERT_EQUAL_PTR(tables[0], aafontsGetColorTable(0x0100, 0xFFFF, AAFONTS_FONTTYPE_AA2));
+
+  // The type is part of the key
+  TEST_ASSERT_TRUE(tables[0] != aafontsGetColorTable(0x0100, 0xFFFF, AAFONTS_FONTTYPE_AA4));
+}
+
+void test_draw_string_color_uses_cached_table(void)
+{
+  const uint16_t *table;
+
+  aafontsDrawStringColor(0, 0, COLOR_BLUE, COLOR_WHITE, &fontAA2, "A");
+  table = aafontsGetColorTable(COLOR_BLUE, COLOR_WHITE, AAFONTS_FONTTYPE_AA2);
+
+  TEST_ASSERT_EQUAL_HEX16(COLOR_BLUE, screen[0][0]);
+  TEST_ASSERT_EQUAL_HEX16(table[1], screen[0][1]);
+  TEST_ASSERT_EQUAL_HEX16(COLOR_WHITE, screen[2][0]);
+}
@@ -0,0 +1,187 @@
+/**************************************************************************/
+/*!
+    @file     test_binlog.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+#include "unity.h"
+#include "projectconfig.h"
+#include "binlog.h"
+
+#define BUFFER_WORDS  (CFG_BINLOG_BUFFERSIZE / 4)
+
+static uint32_t ticks;
+static uint32_t words[BUFFER_WORDS];
+
+uint32_t delayGetTicks(void) { return ticks; }
+
+/* Reads the pending records back as 32-bit words */
+static uint16_t readWords(uint16_t maxWords)
+{
+  uint8_t  bytes[CFG_BINLOG_BUFFERSIZE];
+  uint16_t len = binlogRead(bytes, maxWords * 4);
+
+  memcpy(words, bytes, len);
+  return len / 4;
+}
+
+void setUp(void)
+{
+  ticks = 0;
+  binlogInit();
+  memset(words, 0, sizeof(words));
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_record_encoding(void)
+{
+  const uint32_t args[] = { 1, 0xDEADBEEF };
+
+  ticks = 1234;
+  binlogWrite(0x123456, 2, args);
+
+  TEST_ASSERT_EQUAL(16, binlogPending());
+  TEST_ASSERT_EQUAL(4, readWords(BUFFER_WORDS));
+  TEST_ASSERT_EQUAL_HEX32(BINLOG_MARKER | (2 << BINLOG_COUNT_SHIFT) | 0x123456, words[0]);
+  TEST_ASSERT_EQUAL(1234, words[1]);
+  TEST_ASSERT_EQUAL_HEX32(1, words[2]);
+  TEST_ASSERT_EQUAL_HEX32(0xDEADBEEF, words[3]);
+  TEST_ASSERT_EQUAL(0, binlogPending());
+}
+
+void test_macro_arguments(void)
+{
+  const char *str = "abc";
+  int8_t negative = -3;
+
+  BINLOG("%d %d %f %f %s", 5, negative, 1.5F, 2.25, str);
+
+  TEST_ASSERT_EQUAL(7, readWords(BUFFER_WORDS));
+  TEST_ASSERT_EQUAL(5, (words[0] >> BINLOG_COUNT_SHIFT) & BINLOG_COUNT_MASK);
+  TEST_ASSERT_EQUAL(5, words[2]);
+  TEST_ASSERT_EQUAL_HEX32(0xFFFFFFFD, words[3]);
+  TEST_ASSERT_EQUAL_HEX32(0x3FC00000, words[4]);    // 1.5F
+  TEST_ASSERT_EQUAL_HEX32(0x40100000, words[5]);    // 2.25 as a float
+  TEST_ASSERT_EQUAL_HEX32((uint32_t)(uintptr_t) str, words[6]);
+}
+
+void test_macro_no_arguments(void)
+{
+  BINLOG("Hello");
+
+  TEST_ASSERT_EQUAL(2, readWords(BUFFER_WORDS));
+  TEST_ASSERT_EQUAL_HEX32(BINLOG_MARKER, words[0] & (BINLOG_MARKER_MASK | (BINLOG_COUNT_MASK << BINLOG_COUNT_SHIFT)));
+}
+
+void test_call_sites_have_different_ids(void)
+{
+  uint32_t i;
+
+  for (i = 0; i < 2; i++)
+  {
+    BINLOG("First %d", i);
+    BINLOG("Second %d", i);
+  }
+
+  TEST_ASSERT_EQUAL(12, readWords(BUFFER_WORDS));
+  TEST_ASSERT_EQUAL_HEX32(words[0], words[6]);
+  TEST_ASSERT_EQUAL_HEX32(words[3], words[9]);
+  TEST_ASSERT_NOT_EQUAL(words[0], words[3]);
+}
+
+void test_read_whole_records_only(void)
+{
+  const uint32_t args[] = { 1, 2 };
+
+  binlogWrite(1, 2, args);
+  binlogWrite(2, 2, args);
+
+  // Room for one and a half records
+  TEST_ASSERT_EQUAL(4, readWords(6));
+  TEST_ASSERT_EQUAL(16, binlogPending());
+  TEST_ASSERT_EQUAL(0, readWords(3));
+  TEST_ASSERT_EQUAL(4, readWords(4));
+  TEST_ASSERT_EQUAL(2, words[0] & BINLOG_ID_MASK);
+}
+
+void test_full_buffer_drops_records(void)
+{
+  uint32_t args[BINLOG_MAXARGS] = { 0 };
+  uint32_t records = BUFFER_WORDS / (BINLOG_HEADERWORDS + BINLOG_MAXARGS);
+  uint32_t i;
+
+  for (i = 0; i < records + 1; i++)
+  {
+    binlogWrite(i, BINLOG_MAXARGS, args);
+  }
+
+  TEST_ASSERT_EQUAL(1, binlogGetDropped());
+  TEST_ASSERT_EQUAL(records * (BINLOG_HEADERWORDS + BINLOG_MAXARGS) * 4, binlogPending());
+
+  // The oldest record is kept
+  TEST_ASSERT_EQUAL(BINLOG_HEADERWORDS + BINLOG_MAXARGS, readWords(BINLOG_HEADERWORDS + BINLOG_MAXARGS));
+  TEST_ASSERT_EQUAL(0, words[0] & BINLOG_ID_MASK);
+}
+
+void test_wrap_around(void)
+{
+  uint32_t args[3];
+  uint32_t i;
+
+  // Records of 5 words don't divide the buffer evenly, so they end up
+  // split across the end of the buffer
+  for (i = 0; i < 100; i++)
+  {
+    args[0] = i;
+    args[1] = ~i;
+    args[2] = i * 3;
+    ticks = i;
+    binlogWrite(i, 3, args);
+    binlogWrite(i + 1000, 3, args);
+
+    TEST_ASSERT_EQUAL(10, readWords(BUFFER_WORDS));
+    TEST_ASSERT_EQUAL(i, words[0] & BINLOG_ID_MASK);
+    TEST_ASSERT_EQUAL(i, words[1]);
+    TEST_ASSERT_EQUAL(i, words[2]);
+    TEST_ASSERT_EQUAL(~i, words[3]);
+    TEST_ASSERT_EQUAL(i * 3, words[4]);
+    TEST_ASSERT_EQUAL(i + 1000, words[5] & BINLOG_ID_MASK);
+    TEST_ASSERT_EQUAL(i * 3, words[9]);
+  }
+
+  TEST_ASSERT_EQUAL(0, binlogGetDropped());
+}
@@ -0,0 +1,171 @@
+/**************************************************************************/
+/*!
+    @file     test_characterisation.c
+    @ingroup  Unit Tests
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+#include <math.h>
+#include "unity.h"
+#include "characterisation.h"
+
+#define OCTAVES (8)
+
+static characterisation_octave_t octaves[OCTAVES];
+static uint32_t seed;
+
+/* Uniform white noise in [-1, 1] (variance = 1/3) */
+static float noise(void)
+{
+  seed = seed * 1664525UL + 1013904223UL;
+  return ((float)(seed >> 8) / (float)(1UL << 23)) - 1.0F;
+}
+
+void setUp(void)
+{
+  seed = 1;
+}
+
+void tearDown(void)
+{
+}
+
+void test_characterisation_init(void)
+{
+  characterisation_t ch = { .tau0 = 0.01F, .octaves = OCTAVES, .octave = octaves };
+  characterisation_t bad = { .tau0 = 0.0F, .octaves = OCTAVES, .octave = octaves };
+
+  TEST_ASSERT_EQUAL(ERROR_NONE, characterisationInit(&ch));
+  TEST_ASSERT_EQUAL(ERROR_INVALIDPARAMETER, characterisationInit(&bad));
+  TEST_ASSERT_EQUAL(0, ch.k);
+}
+
+void test_characterisation_mean_variance(void)
+{
+  characterisation_t ch = { .tau0 = 1.0F, .octaves = OCTAVES, .octave = octaves };
+  characterisationInit(&ch);
+
+  characterisationAdd(&ch, 2.0F);
+  characterisationAdd(&ch, 4.0F);
+  characterisationAdd(&ch, 4.0F);
+  characterisationAdd(&ch, 4.0F);
+  characterisationAdd(&ch, 5.0F);
+  characterisationAdd(&ch, 5.0F);
+  characterisationAdd(&ch, 7.0F);
+  characterisationAdd(&ch, 9.0F);
+
+  TEST_ASSERT_EQUAL(8, ch.k);
+  TEST_ASSERT_EQUAL_FLOAT(5.0F, characterisationGetMean(&ch));
+  TEST_ASSERT_EQUAL_FLOAT(32.0F / 7.0F, characterisationGetVariance(&ch));
+  TEST_ASSERT_EQUAL_FLOAT(2.0F, ch.min);
+  TEST_ASSERT_EQUAL_FLOAT(9.0F, ch.max);
+}
+
+void test_characterisation_octave_needs_2m_samples(void)
+{
+  characterisation_t ch = { .tau0 = 0.5F, .octaves = OCTAVES, .octave = octaves };
+  float tau, adev;
+  uint32_t i;
+
+  characterisationInit(&ch);
+
+  for (i = 0; i < 15; i++)
+  {
+    characterisationAdd(&ch, noise());
+  }
+  TEST_ASSERT_EQUAL(ERROR_UNEXPECTEDVALUE, characterisationGetAllanDev(&ch, 3, &tau, &adev));
+  TEST_ASSERT_EQUAL_FLOAT(4.0F, tau);
+
+  characterisationAdd(&ch, noise());
+  TEST_ASSERT_EQUAL(ERROR_NONE, characterisationGetAllanDev(&ch, 3, &tau, &adev));
+  TEST_ASSERT_EQUAL(ERROR_INVALIDPARAMETER, characterisationGetAllanDev(&ch, OCTAVES, &tau, &adev));
+}
+
+void test_characterisation_constant_input(void)
+{
+  characterisation_t ch = { .tau0 = 1.0F, .octaves = OCTAVES, .octave = octaves };
+  float tau, adev;
+  uint32_t i;
+  uint8_t o;
+
+  characterisationInit(&ch);
+  for (i = 0; i < 1024; i++)
+  {
+    characterisationAdd(&ch, 9.80665F);
+  }
+
+  for (o = 0; o < OCTAVES; o++)
+  {
+    TEST_ASSERT_EQUAL(ERROR_NONE, characterisationGetAllanDev(&ch, o, &tau, &adev));
+    TEST_ASSERT_EQUAL_FLOAT(0.0F, adev);
+  }
+  TEST_ASSERT_EQUAL_FLOAT(0.0F, characterisationGetVariance(&ch));
+}
+
+void test_characterisation_white_noise(void)
+{
+  characterisation_t ch = { .tau0 = 1.0F, .octaves = OCTAVES, .octave = octaves };
+  float tau, adev, expected;
+  uint32_t i;
+  uint8_t o;
+
+  characterisationInit(&ch);
+  for (i = 0; i < 65536; i++)
+  {
+    characterisationAdd(&ch, noise());
+  }
+
+  TEST_ASSERT_FLOAT_WITHIN(0.01F, 0.0F, characterisationGetMean(&ch));
+  TEST_ASSERT_FLOAT_WITHIN(0.01F, 1.0F / 3.0F, characterisationGetVariance(&ch));
+
+  /* White noise: adev(tau) = sigma / sqrt(tau / tau0) */
+  for (o = 0; o < OCTAVES; o++)
+  {
+    TEST_ASSERT_EQUAL(ERROR_NONE, characterisationGetAllanDev(&ch, o, &tau, &adev));
+    expected = sqrtf(1.0F / 3.0F) / sqrtf(tau);
+    TEST_ASSERT_FLOAT_WITHIN(expected * 0.1F, expected, adev);
+  }
+}
+
+void test_characterisation_sensor_event(void)
+{
+  characterisation_t ch = { .tau0 = 1.0F, .octaves = OCTAVES, .octave = octaves };
+  sensors_event_t event;
+
+  memset(&event, 0, sizeof(event));
+  event.acceleration.z = 9.0F;
+
+  characterisationInit(&ch);
+  TEST_ASSERT_EQUAL(ERROR_INVALIDPARAMETER, characterisationAddSensorEvent(&ch, &event, 4));
+  TEST_ASSERT_EQUAL(ERROR_NONE, characterisationAddSensorEvent(&ch, &event, SENSOR_AXIS_Z - 1));
+  TEST_ASSERT_EQUAL_FLOAT(9.0F, characterisationGetMean(&ch));
+}
@@ -0,0 +1,299 @@
+/**************************************************************************/
+/*!
+    @file     test_cli.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+#include "unity.h"
+#include "localisation.h"
+#include "cli.h"
+
+uint32_t SystemCoreClock = 12000000;
+
+/* Records the last command dispatched by cliParse */
+static void (*last_func)(uint8_t argc, char **argv);
+static uint8_t last_argc;
+static char   *last_argv[CLI_MAXARGS];
+
+static void record(void (*func)(uint8_t, char **), uint8_t argc, char **argv)
+{
+  last_func = func;
+  last_argc = argc;
+  memcpy(last_argv, argv, argc * sizeof(char*));
+}
+
+//--------------------------------------------------------------------+
+// Stubs for the commands and HAL functions referenced by cli.c
+//--------------------------------------------------------------------+
+void cmd_sysinfo(uint8_t argc, char **argv)      { record(cmd_sysinfo, argc, argv); }
+void cmd_dbg_memrd(uint8_t argc, char **argv)    { record(cmd_dbg_memrd, argc, argv); }
+void cmd_eeprom_read(uint8_t argc, char **argv)  { record(cmd_eeprom_read, argc, argv); }
+void cmd_eeprom_write(uint8_t argc, char **argv) { record(cmd_eeprom_write, argc, argv); }
+void cmd_script_run(uint8_t argc, char **argv)   { record(cmd_script_run, argc, argv); }
+void cmd_binlog_dump(uint8_t argc, char **argv)  { record(cmd_binlog_dump, argc, argv); }
+void cmd_probe(uint8_t argc, char **argv)        { record(cmd_probe, argc, argv); }
+void cmd_isrtrace(uint8_t argc, char **argv)     { record(cmd_isrtrace, argc, argv); }
+
+bool usb_isConfigured(void)  { return false; }
+bool usb_cdc_getc(uint8_t *c) { return false; }
+void printfFlush(void)        { fflush(stdout); }
+
+void setUp(void)
+{
+  last_func = NULL;
+  last_argc = 0;
+  memset(last_argv, 0, sizeof(last_argv));
+}
+
+void tearDown(void)
+{
+
+}
+
+//--------------------------------------------------------------------+
+// TOKENISER
+//--------------------------------------------------------------------+
+void test_cli_tokenise_spaces(void)
+{
+  char line[] = "  ew   0x10  42 ";
+  char *argv[CLI_MAXARGS];
+
+  TEST_ASSERT_EQUAL(3, cliTokenise(line, argv, CLI_MAXARGS));
+  TEST_ASSERT_EQUAL_STRING("ew", argv[0]);
+  TEST_ASSERT_EQUAL_STRING("0x10", argv[1]);
+  TEST_ASSERT_EQUAL_STRING("42", argv[2]);
+
+  // Tokens point into the original buffer, nothing is copied
+  TEST_ASSERT_EQUAL_PTR(&line[2], argv[0]);
+}
+
+void test_cli_tokenise_empty(void)
+{
+  char line[] = "    ";
+  char *argv[CLI_MAXARGS];
+
+  TEST_ASSERT_EQUAL(0, cliTokenise(line, argv, CLI_MAXARGS));
+}
+
+void test_cli_tokenise_quoted(void)
+{
+  char line[] = "wc 3 \"My Network\" \"\" \"unterminated key";
+  char *argv[CLI_MAXARGS];
+
+  TEST_ASSERT_EQUAL(5, cliTokenise(line, argv, CLI_MAXARGS));
+  TEST_ASSERT_EQUAL_STRING("wc", argv[0]);
+  TEST_ASSERT_EQUAL_STRING("3", argv[1]);
+  TEST_ASSERT_EQUAL_STRING("My Network", argv[2]);
+  TEST_ASSERT_EQUAL_STRING("", argv[3]);
+  TEST_ASSERT_EQUAL_STRING("unterminated key", argv[4]);
+}
+
+void test_cli_tokenise_overflow(void)
+{
+  char line[] = "a b c d e f";
+  char *argv[5];
+
+  argv[4] = NULL;
+
+  // All tokens are counted, but only the first four are stored
+  TEST_ASSERT_EQUAL(6, cliTokenise(line, argv, 4));
+  TEST_ASSERT_EQUAL_STRING("d", argv[3]);
+  TEST_ASSERT_NULL(argv[4]);
+}
+
+//--------------------------------------------------------------------+
+// COMMAND LOOKUP
+//--------------------------------------------------------------------+
+void test_cli_find_exact(void)
+{
+  const char *names[] = { "?", "V", "mr", "er", "ew" };
+  uint8_t i, matches;
+
+  for (i = 0; i < sizeof(names)/sizeof(names[0]); i++)
+  {
+    cli_t const *p_cmd = cliFind(names[i], &matches);
+    TEST_ASSERT_NOT_NULL(p_cmd);
+    TEST_ASSERT_EQUAL_STRING(names[i], p_cmd->command);
+    TEST_ASSERT_EQUAL(1, matches);
+  }
+}
+
+void test_cli_find_abbreviation(void)
+{
+  uint8_t matches;
+  cli_t const *p_cmd;
+
+  p_cmd = cliFind("m", &matches);
+  TEST_ASSERT_NOT_NULL(p_cmd);
+  TEST_ASSERT_EQUAL_STRING("mr", p_cmd->command);
+
+  // 'e' matches both 'er' and 'ew'
+  TEST_ASSERT_NULL(cliFind("e", &matches));
+  TEST_ASSERT_EQUAL(2, matches);
+
+  TEST_ASSERT_NULL(cliFind("mrx", &matches));
+  TEST_ASSERT_EQUAL(0, matches);
+  TEST_ASSERT_NULL(cliFind("x", NULL));
+  TEST_ASSERT_NULL(cliFind("", &matches));
+  TEST_ASSERT_EQUAL(0, matches);
+}
+
+//--------------------------------------------------------------------+
+// DISPATCH
+//--------------------------------------------------------------------+
+void test_cli_parse_dispatch(void)
+{
+  char line[] = "m 0x10000000 \"4\" 1";
+
+  cliParse(line);
+
+  TEST_ASSERT_EQUAL_PTR(cmd_dbg_memrd, last_func);
+  TEST_ASSERT_EQUAL(3, last_argc);
+  TEST_ASSERT_EQUAL_STRING("0x10000000", last_argv[0]);
+  TEST_ASSERT_EQUAL_STRING("4", last_argv[1]);
+  TEST_ASSERT_EQUAL_STRING("1", last_argv[2]);
+}
+
+void test_cli_parse_rejected(void)
+{
+  char empty[]     = "";
+  char unknown[]   = "zz 1";
+  char ambiguous[] = "e 1";
+  char toomany[]   = "er 1 2";
+  char toofew[]    = "ew 1";
+
+  cliParse(empty);
+  cliParse(unknown);
+  cliParse(ambiguous);
+  cliParse(toomany);
+  cliParse(toofew);
+
+  TEST_ASSERT_NULL(last_func);
+}
+
+void test_cli_parse_too_many_tokens(void)
+{
+  char line[CFG_INTERFACE_MAXMSGSIZE];
+  uint8_t i;
+
+  // More tokens than argv can hold must be rejected, not overflow argv
+  strcpy(line, "mr");
+  for (i = 0; i < CLI_MAXARGS + 10; i++)
+  {
+    strcat(line, " 1");
+  }
+
+  cliParse(line);
+
+  TEST_ASSERT_NULL(last_func);
+}
+
+//--------------------------------------------------------------------+
+// PARSE RATE
+//--------------------------------------------------------------------+
+#define BENCH_ITERATIONS  200000
+
+static const char * const bench_lines[] =
+{
+  "V",
+  "mr 0x10000000 64 4",
+  "er 0x0010",
+  "ew 0x0010 0xAA",
+  "?",
+};
+
+#define BENCH_LINES   (sizeof(bench_lines)/sizeof(bench_lines[0]))
+
+/* The previous strtok + linear strcmp implementation, for comparison */
+static cli_t const * reference_parse(char *cmd, char *argv[], uint16_t *argc)
+{
+  static const char * const names[] = { "?", "V", "mr", "er", "ew" };
+  static cli_t entries[sizeof(names)/sizeof(names[0])];
+  uint16_t i = 0;
+
+  argv[i] = strtok(cmd, " ");
+  do
+  {
+    argv[++i] = strtok(NULL, " ");
+  } while ((i < CLI_MAXARGS - 1) && (argv[i] != NULL));
+  *argc = i;
+
+  for (i = 0; i < sizeof(names)/sizeof(names[0]); i++)
+  {
+    if (!strcmp(argv[0], names[i]))
+    {
+      entries[i].command = (char *) names[i];
+      return &entries[i];
+    }
+  }
+  return NULL;
+}
+
+void test_cli_parse_rate(void)
+{
+  char     line[CFG_INTERFACE_MAXMSGSIZE];
+  char    *argv[CLI_MAXARGS];
+  uint16_t argc;
+  uint32_t i, found;
+  clock_t  start;
+  double   ref_seconds, seconds;
+
+  found = 0;
+  start = clock();
+  for (i = 0; i < BENCH_ITERATIONS; i++)
+  {
+    strcpy(line, bench_lines[i % BENCH_LINES]);
+    if (reference_parse(line, argv, &argc) != NULL) found++;
+  }
+  ref_seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+  TEST_ASSERT_EQUAL(BENCH_ITERATIONS, found);
+
+  found = 0;
+  start = clock();
+  for (i = 0; i < BENCH_ITERATIONS; i++)
+  {
+    strcpy(line, bench_lines[i % BENCH_LINES]);
+    argc = cliTokenise(line, argv, CLI_MAXARGS);
+    if (cliFind(argv[0], NULL) != NULL) found++;
+  }
+  seconds = (double) (clock() - start) / CLOCKS_PER_SEC;
+  TEST_ASSERT_EQUAL(BENCH_ITERATIONS, found);
+
+  printf("cli parse: %u lines, strtok/linear %.0f lines/s, cliTokenise/cliFind %.0f lines/s\n",
+         BENCH_ITERATIONS,
+         BENCH_ITERATIONS / (ref_seconds > 0 ? ref_seconds : 1e-9),
+         BENCH_ITERATIONS / (seconds > 0 ? seconds : 1e-9));
+}
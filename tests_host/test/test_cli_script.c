@@ -0,0 +1,197 @@
+/**************************************************************************/
+/*!
+    @file     test_cli_script.c
+    @author   K. Townsend (microBuilder.eu)
+
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+#include <stdint.h>
+#include "unity.h"
+#include "localisation.h"
+#include "cli.h"
+#include "cli_script.h"
+
+uint32_t SystemCoreClock = 12000000;
+
+static uint8_t  eeprom[CFG_EEPROM_SIZE];
+static uint32_t ticks;
+static uint8_t  eeprom_writes;
+static err_t    nested_error;
+
+//--------------------------------------------------------------------+
+// Stubs for the commands and HAL functions referenced by the CLI
+//--------------------------------------------------------------------+
+void cmd_sysinfo(uint8_t argc, char **argv)      { ticks += 5; }
+void cmd_dbg_memrd(uint8_t argc, char **argv)    { }
+void cmd_eeprom_read(uint8_t argc, char **argv)  { }
+
+void cmd_eeprom_write(uint8_t argc, char **argv)
+{
+  if (!strcmp(argv[0], "bad"))
+  {
+    cliSetError(ERROR_ADDRESSOUTOFRANGE);
+    return;
+  }
+  eeprom_writes++;
+}
+
+void cmd_script_run(uint8_t argc, char **argv)
+{
+  nested_error = cliScriptRunBuffer("V", NULL);
+  cliSetError(nested_error);
+}
+
+void cmd_binlog_dump(uint8_t argc, char **argv)  { }
+void cmd_probe(uint8_t argc, char **argv)        { }
+void cmd_isrtrace(uint8_t argc, char **argv)     { }
+
+bool usb_isConfigured(void)   { return false; }
+bool usb_cdc_getc(uint8_t *c)  { return false; }
+void printfFlush(void)         { }
+uint32_t delayGetTicks(void)   { return ticks; }
+
+err_t readEEPROM(uint8_t* eeAddress, uint8_t* buffAddress, uint32_t byteCount)
+{
+  memcpy(buffAddress, &eeprom[(uintptr_t) eeAddress], byteCount);
+  return ERROR_NONE;
+}
+
+err_t writeEEPROM(uint8_t* eeAddress, uint8_t* buffAddress, uint32_t byteCount)
+{
+  memcpy(&eeprom[(uintptr_t) eeAddress], buffAddress, byteCount);
+  return ERROR_NONE;
+}
+
+void setUp(void)
+{
+  memset(eeprom, 0xFF, sizeof(eeprom));
+  ticks         = 0;
+  eeprom_writes = 0;
+  nested_error  = ERROR_NONE;
+}
+
+void tearDown(void)
+{
+
+}
+
+//--------------------------------------------------------------------+
+// SCRIPT PARSING
+//--------------------------------------------------------------------+
+void test_cli_script_lines(void)
+{
+  cli_script_stats_t stats;
+
+  // Comments, blank lines, CRLF and a last line without a newline
+  TEST_ASSERT_EQUAL(ERROR_NONE, cliScriptRunBuffer("# Provisioning\r\n\r\n"
+                                                   "ew 0x100 1\r\n"
+                                                   "  ew 0x101 2\n"
+                                                   "V", &stats));
+  TEST_ASSERT_EQUAL(3, stats.lines);
+  TEST_ASSERT_EQUAL(0, stats.errors);
+  TEST_ASSERT_EQUAL(0, stats.firstErrorLine);
+  TEST_ASSERT_EQUAL(2, eeprom_writes);
+  TEST_ASSERT_EQUAL(5, stats.ms);
+}
+
+void test_cli_script_errors(void)
+{
+  cli_script_stats_t stats;
+
+  TEST_ASSERT_EQUAL(ERROR_CLI_SCRIPTERRORS, cliScriptRunBuffer("V\n"
+                                                               "ew bad 1\n"
+                                                               "zz\n"
+                                                               "e 1\n"
+                                                               "ew 1\n"
+                                                               "ew 0x100 1\n", &stats));
+  TEST_ASSERT_EQUAL(6, stats.lines);
+  TEST_ASSERT_EQUAL(4, stats.errors);
+  TEST_ASSERT_EQUAL(2, stats.firstErrorLine);
+  TEST_ASSERT_EQUAL(ERROR_ADDRESSOUTOFRANGE, stats.firstError);
+
+  // Errors don't stop the script
+  TEST_ASSERT_EQUAL(1, eeprom_writes);
+}
+
+void test_cli_script_long_line(void)
+{
+  char script[CFG_INTERFACE_MAXMSGSIZE + 32];
+  cli_script_stats_t stats;
+
+  memset(script, 'x', CFG_INTERFACE_MAXMSGSIZE + 8);
+  strcpy(&script[CFG_INTERFACE_MAXMSGSIZE + 8], "\nV\n");
+
+  TEST_ASSERT_EQUAL(ERROR_CLI_SCRIPTERRORS, cliScriptRunBuffer(script, &stats));
+  TEST_ASSERT_EQUAL(2, stats.lines);
+  TEST_ASSERT_EQUAL(1, stats.errors);
+  TEST_ASSERT_EQUAL(ERROR_BUFFEROVERFLOW, stats.firstError);
+}
+
+void test_cli_script_nested(void)
+{
+  cli_script_stats_t stats;
+
+  TEST_ASSERT_EQUAL(ERROR_CLI_SCRIPTERRORS, cliScriptRunBuffer("run\n", &stats));
+  TEST_ASSERT_EQUAL(ERROR_CLI_SCRIPTRUNNING, nested_error);
+  TEST_ASSERT_EQUAL(ERROR_CLI_SCRIPTRUNNING, stats.firstError);
+}
+
+//--------------------------------------------------------------------+
+// EEPROM SCRIPTS
+//--------------------------------------------------------------------+
+void test_cli_script_eeprom(void)
+{
+  cli_script_stats_t stats;
+
+  // Nothing stored yet (erased EEPROM)
+  TEST_ASSERT_EQUAL(ERROR_CLI_SCRIPTNOTFOUND, cliScriptRunEEPROM(0x100, 256, &stats));
+
+  TEST_ASSERT_EQUAL(ERROR_NONE, cliScriptWriteEEPROM(0x100, 256, "ew 0x200 1\nV\n"));
+  TEST_ASSERT_EQUAL(ERROR_NONE, cliScriptRunEEPROM(0x100, 256, &stats));
+  TEST_ASSERT_EQUAL(2, stats.lines);
+  TEST_ASSERT_EQUAL(1, eeprom_writes);
+}
+
+void test_cli_script_eeprom_limits(void)
+{
+  TEST_ASSERT_EQUAL(ERROR_ADDRESSOUTOFRANGE, cliScriptWriteEEPROM(0x00, 256, "V"));
+  TEST_ASSERT_EQUAL(ERROR_ADDRESSOUTOFRANGE, cliScriptWriteEEPROM(0x100, CFG_EEPROM_SIZE, "V"));
+  TEST_ASSERT_EQUAL(ERROR_BUFFEROVERFLOW, cliScriptWriteEEPROM(0x100, 4, "ew 0x200 1"));
+  TEST_ASSERT_EQUAL(ERROR_ADDRESSOUTOFRANGE, cliScriptRunEEPROM(CFG_EEPROM_SIZE - 4, 8, NULL));
+
+  // A script without a terminator stops at maxSize
+  memcpy(&eeprom[0x100], "V\nV\nV\n", 6);
+  cli_script_stats_t stats;
+  TEST_ASSERT_EQUAL(ERROR_NONE, cliScriptRunEEPROM(0x100, 4, &stats));
+  TEST_ASSERT_EQUAL(2, stats.lines);
+}
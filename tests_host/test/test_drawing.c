@@ -0,0 +1,255 @@
+/**************************************************************************/
+/*!
+    @file     test_drawing.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+#include <string.h>
+#include "unity.h"
+#include "drawing.h"
+
+#define WIDTH   (176)
+#define HEIGHT  (220)
+
+//--------------------------------------------------------------------+
+// LCD stub: counts the writes to every pixel and the calls to the
+// driver (each one is a window on the real controllers)
+//--------------------------------------------------------------------+
+static uint8_t  writes[HEIGHT][WIDTH];
+static uint32_t calls, hlines, rects;
+
+static void writeRect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+  uint16_t x, y;
+
+  TEST_ASSERT_TRUE(x0 <= x1 && x1 < WIDTH);
+  TEST_ASSERT_TRUE(y0 <= y1 && y1 < HEIGHT);
+  for (y = y0; y <= y1; y++)
+  {
+    for (x = x0; x <= x1; x++)
+    {
+      writes[y][x]++;
+    }
+  }
+  calls++;
+}
+
+uint16_t lcdGetWidth(void)  { return WIDTH; }
+uint16_t lcdGetHeight(void) { return HEIGHT; }
+
+lcdProperties_t lcdGetProperties(void)
+{
+  lcdProperties_t properties = { WIDTH, HEIGHT, false, false, false, true, true };
+  return properties;
+}
+
+void lcdDrawPixel(uint16_t x, uint16_t y, uint16_t color)
+{
+  writeRect(x, y, x, y);
+}
+
+void lcdDrawHLine(uint16_t x0, uint16_t x1, uint16_t y, uint16_t color)
+{
+  writeRect(x0, y, x1, y);
+  hlines++;
+}
+
+void lcdDrawVLine(uint16_t x, uint16_t y0, uint16_t y1, uint16_t color)
+{
+  writeRect(x, y0, x, y1);
+}
+
+void lcdDrawRect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+{
+  writeRect(x0, y0, x1, y1);
+  rects++;
+}
+
+void lcdFillRGB(uint16_t color) { }
+void lcdTest(void) { }
+
+// Every pixel was written at most once, and each row is one span
+static uint32_t checkSpans(void)
+{
+  uint32_t total = 0;
+  uint16_t x, y, runs;
+
+  for (y = 0; y < HEIGHT; y++)
+  {
+    runs = 0;
+    for (x = 0; x < WIDTH; x++)
+    {
+      TEST_ASSERT_TRUE_MESSAGE(writes[y][x] <= 1, "Pixel written twice");
+      total += writes[y][x];
+      if (writes[y][x] && ((x == 0) || !writes[y][x - 1])) runs++;
+    }
+    TEST_ASSERT_TRUE_MESSAGE(runs <= 1, "Row is not a single span");
+  }
+
+  return total;
+}
+
+void setUp(void)
+{
+  memset(writes, 0, sizeof(writes));
+  calls = hlines = rects = 0;
+}
+
+void tearDown(void)
+{
+
+}
+
+//--------------------------------------------------------------------+
+// Tests
+//--------------------------------------------------------------------+
+void test_circle_filled_is_one_span_per_row(void)
+{
+  int32_t x, y, r = 30;
+  uint32_t expected = 0;
+
+  drawCircleFilled(80, 100, r, COLOR_WHITE);
+
+  // Same pixels as the midpoint circle: x*x + y*y <= r*r + r
+  for (y = -r; y <= r; y++)
+  {
+    for (x = -r; x <= r; x++)
+    {
+      if (x * x + y * y <= r * r + r)
+      {
+        expected++;
+        TEST_ASSERT_EQUAL(1, writes[100 + y][80 + x]);
+      }
+    }
+  }
+
+  TEST_ASSERT_EQUAL(expected, checkSpans());
+  TEST_ASSERT_EQUAL(2 * r + 1, calls);
+}
+
+void test_circle_filled_is_clipped(void)
+{
+  uint16_t y;
+
+  drawCircleFilled(5, 3, 20, COLOR_WHITE);
+  checkSpans();
+
+  // Rows 0..23 are drawn, and all but the last one start at the left edge
+  for (y = 0; y <= 22; y++)
+  {
+    TEST_ASSERT_EQUAL(1, writes[y][0]);
+  }
+  TEST_ASSERT_EQUAL(0, writes[23][0]);
+  TEST_ASSERT_EQUAL(1, writes[23][5]);
+  TEST_ASSERT_EQUAL(0, writes[24][5]);
+}
+
+void test_corner_filled_only_covers_its_quadrant(void)
+{
+  uint16_t x, y;
+
+  drawCornerFilled(50, 50, 10, DRAW_CORNERS_TOPLEFT, COLOR_WHITE);
+  checkSpans();
+
+  for (y = 0; y < HEIGHT; y++)
+  {
+    for (x = 0; x < WIDTH; x++)
+    {
+      if (writes[y][x])
+      {
+        TEST_ASSERT_TRUE((x <= 50) && (y <= 50) && (x >= 40) && (y >= 40));
+      }
+    }
+  }
+  TEST_ASSERT_EQUAL(1, writes[50][40]);
+  TEST_ASSERT_EQUAL(1, writes[40][50]);
+  TEST_ASSERT_EQUAL(0, writes[40][40]);
+}
+
+void test_rounded_rectangle_filled(void)
+{
+  uint32_t total;
+
+  drawRoundedRectangleFilled(10, 20, 109, 79, COLOR_WHITE, 8, DRAW_CORNERS_TOP);
+  total = checkSpans();
+
+  // Square bottom corners, rounded top corners
+  TEST_ASSERT_EQUAL(1, writes[79][10]);
+  TEST_ASSERT_EQUAL(1, writes[79][109]);
+  TEST_ASSERT_EQUAL(0, writes[20][10]);
+  TEST_ASSERT_EQUAL(0, writes[20][109]);
+  TEST_ASSERT_EQUAL(1, writes[20][59]);
+  TEST_ASSERT_EQUAL(1, writes[50][10]);
+  TEST_ASSERT_TRUE(total < 100 * 60);
+  TEST_ASSERT_TRUE(total > 100 * 60 - 4 * 8 * 8);
+
+  // The straight part is a single block
+  TEST_ASSERT_EQUAL(1, rects);
+}
+
+void test_triangle_filled_vertex_order(void)
+{
+  static uint8_t first[HEIGHT][WIDTH];
+  uint32_t total;
+  uint16_t y;
+
+  drawTriangleFilled(100, 10, 20, 120, 160, 200, COLOR_WHITE);
+  total = checkSpans();
+  memcpy(first, writes, sizeof(writes));
+
+  // One span per row, from the top vertex to the bottom one
+  TEST_ASSERT_EQUAL(191, calls);
+  for (y = 10; y <= 200; y++)
+  {
+    TEST_ASSERT_NOT_EQUAL(0, memchr(writes[y], 1, WIDTH) != NULL);
+  }
+
+  // The same pixels whatever the order of the vertices
+  setUp();
+  drawTriangleFilled(160, 200, 100, 10, 20, 120, COLOR_WHITE);
+  TEST_ASSERT_EQUAL(total, checkSpans());
+  TEST_ASSERT_EQUAL_MEMORY(first, writes, sizeof(writes));
+}
+
+void test_triangle_filled_flat(void)
+{
+  drawTriangleFilled(30, 40, 10, 40, 50, 40, COLOR_WHITE);
+  TEST_ASSERT_EQUAL(41, checkSpans());
+  TEST_ASSERT_EQUAL(1, hlines);
+
+  // Flat top and flat bottom don't repeat the shared row
+  setUp();
+  drawTriangleFilled(10, 50, 60, 50, 35, 90, COLOR_WHITE);
+  checkSpans();
+  TEST_ASSERT_EQUAL(41, calls);
+}
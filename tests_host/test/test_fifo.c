@@ -123,3 +123,53 @@ void test_is_full(void)
   TEST_ASSERT_TRUE(fifo_isFull(&ff_non_overwritable));
 }
 
+
+void test_write_array(void)
+{
+  uint32_t data[FIFO_SIZE + 4];
+  uint32_t c;
+
+  for(uint32_t i=0; i < FIFO_SIZE + 4; i++)
+  {
+    data[i] = i;
+  }
+
+  // Only the items that fit are written to a non-overwritable FIFO
+  TEST_ASSERT_EQUAL(FIFO_SIZE, fifo_writeArray(&ff_non_overwritable, data, FIFO_SIZE + 4));
+  TEST_ASSERT_TRUE(fifo_isFull(&ff_non_overwritable));
+  TEST_ASSERT_EQUAL(0, fifo_writeArray(&ff_non_overwritable, data, 1));
+
+  for(uint32_t i=0; i < FIFO_SIZE; i++)
+  {
+    fifo_read(&ff_non_overwritable, &c);
+    TEST_ASSERT_EQUAL(i, c);
+  }
+}
+
+void test_write_array_wrap_around(void)
+{
+  uint32_t data[FIFO_SIZE];
+  uint32_t c;
+
+  for(uint32_t i=0; i < FIFO_SIZE; i++)
+  {
+    data[i] = 100 + i;
+  }
+
+  // Move the read/write pointers near the end of the buffer
+  for(uint32_t i=0; i < FIFO_SIZE - 3; i++)
+  {
+    fifo_write(&ff_non_overwritable, &i);
+    fifo_read(&ff_non_overwritable, &c);
+  }
+
+  TEST_ASSERT_EQUAL(6, fifo_writeArray(&ff_non_overwritable, data, 6));
+  TEST_ASSERT_EQUAL(6, fifo_getLength(&ff_non_overwritable));
+
+  for(uint32_t i=0; i < 6; i++)
+  {
+    TEST_ASSERT_TRUE(fifo_read(&ff_non_overwritable, &c));
+    TEST_ASSERT_EQUAL(100 + i, c);
+  }
+  TEST_ASSERT_TRUE(fifo_isEmpty(&ff_non_overwritable));
+}
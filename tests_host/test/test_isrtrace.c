@@ -0,0 +1,208 @@
+/**************************************************************************/
+/*!
+    @file     test_isrtrace.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include "unity.h"
+#include "isrtrace.h"
+#include "mock_probe.h"
+
+#define EXC_TIMER   (16 + 18)   // CT32B0
+#define EXC_UART    (16 + 21)
+
+void setUp(void)
+{
+  probeTicksInit_Expect();
+  isrtraceInit();
+}
+
+void tearDown(void)
+{
+
+}
+
+static void enter(uint8_t exception, uint32_t ticks)
+{
+  probeGetTicks_ExpectAndReturn(ticks);
+  isrtraceEnter(exception);
+}
+
+static void leave(uint8_t exception, uint32_t ticks)
+{
+  probeGetTicks_ExpectAndReturn(ticks);
+  isrtraceExit(exception);
+}
+
+void test_single_handler(void)
+{
+  isrtraceEvent_t event;
+  const isrtraceStats_t *stats;
+
+  enter(EXC_TIMER, 100);
+  leave(EXC_TIMER, 150);
+
+  TEST_ASSERT_EQUAL(2, isrtraceGetEventCount());
+  TEST_ASSERT_TRUE(isrtraceGetEvent(0, &event));
+  TEST_ASSERT_EQUAL(100, event.timestamp);
+  TEST_ASSERT_EQUAL(EXC_TIMER, event.exception);
+  TEST_ASSERT_EQUAL_HEX8(ISRTRACE_FLAG_ENTER | 1, event.flags);
+  TEST_ASSERT_TRUE(isrtraceGetEvent(1, &event));
+  TEST_ASSERT_EQUAL(150, event.timestamp);
+  TEST_ASSERT_EQUAL_HEX8(1, event.flags);
+  TEST_ASSERT_FALSE(isrtraceGetEvent(2, &event));
+
+  TEST_ASSERT_EQUAL(1, isrtraceGetIrqCount());
+  stats = isrtraceGetStats(0);
+  TEST_ASSERT_EQUAL(EXC_TIMER, stats->exception);
+  TEST_ASSERT_EQUAL(1, stats->count);
+  TEST_ASSERT_EQUAL(50, stats->worst);
+  TEST_ASSERT_EQUAL(1, stats->maxDepth);
+  TEST_ASSERT_EQUAL(0, stats->preempted);
+  TEST_ASSERT_NULL(isrtraceGetStats(1));
+}
+
+void test_worst_and_total(void)
+{
+  const isrtraceStats_t *stats;
+
+  enter(EXC_TIMER, 0);
+  leave(EXC_TIMER, 10);
+  enter(EXC_TIMER, 100);
+  leave(EXC_TIMER, 130);
+  // Tick counter wraps
+  enter(EXC_TIMER, 0xFFFFFFF0);
+  leave(EXC_TIMER, 0x00000004);
+
+  stats = isrtraceGetStats(0);
+  TEST_ASSERT_EQUAL(3, stats->count);
+  TEST_ASSERT_EQUAL(30, stats->worst);
+  TEST_ASSERT_EQUAL(60, stats->total);
+}
+
+void test_nested_handler_time_is_excluded(void)
+{
+  const isrtraceStats_t *timer, *uart;
+  isrtraceEvent_t event;
+
+  enter(EXC_TIMER, 100);
+  enter(EXC_UART,  120);
+  leave(EXC_UART,   150);
+  leave(EXC_TIMER,  200);
+
+  TEST_ASSERT_EQUAL(2, isrtraceGetMaxDepth());
+  TEST_ASSERT_TRUE(isrtraceGetEvent(1, &event));
+  TEST_ASSERT_EQUAL_HEX8(ISRTRACE_FLAG_ENTER | 2, event.flags);
+
+  // The UART handler finished first, so it has the first slot
+  uart  = isrtraceGetStats(0);
+  timer = isrtraceGetStats(1);
+  TEST_ASSERT_EQUAL(EXC_UART, uart->exception);
+  TEST_ASSERT_EQUAL(30, uart->worst);
+  TEST_ASSERT_EQUAL(2, uart->maxDepth);
+  TEST_ASSERT_EQUAL(0, uart->preempted);
+  TEST_ASSERT_EQUAL(EXC_TIMER, timer->exception);
+  TEST_ASSERT_EQUAL(70, timer->worst);
+  TEST_ASSERT_EQUAL(1, timer->maxDepth);
+  TEST_ASSERT_EQUAL(1, timer->preempted);
+}
+
+void test_unmatched_exit_is_ignored(void)
+{
+  leave(EXC_TIMER, 10);
+
+  enter(EXC_TIMER, 20);
+  leave(EXC_UART, 30);
+  leave(EXC_TIMER, 40);
+
+  TEST_ASSERT_EQUAL(2, isrtraceGetEventCount());
+  TEST_ASSERT_EQUAL(1, isrtraceGetIrqCount());
+  TEST_ASSERT_EQUAL(20, isrtraceGetStats(0)->worst);
+}
+
+void test_missing_exit_is_dropped(void)
+{
+  isrtraceEvent_t event;
+
+  // The UART handler returns without calling ISRTRACE_EXIT
+  enter(EXC_TIMER, 100);
+  enter(EXC_UART,  120);
+  leave(EXC_TIMER, 200);
+
+  TEST_ASSERT_EQUAL(1, isrtraceGetIrqCount());
+  TEST_ASSERT_EQUAL(EXC_TIMER, isrtraceGetStats(0)->exception);
+  TEST_ASSERT_EQUAL(100, isrtraceGetStats(0)->worst);
+  TEST_ASSERT_TRUE(isrtraceGetEvent(2, &event));
+  TEST_ASSERT_EQUAL_HEX8(1, event.flags);
+
+  // Back at the bottom of the stack
+  enter(EXC_TIMER, 300);
+  TEST_ASSERT_TRUE(isrtraceGetEvent(3, &event));
+  TEST_ASSERT_EQUAL_HEX8(ISRTRACE_FLAG_ENTER | 1, event.flags);
+  leave(EXC_TIMER, 310);
+  TEST_ASSERT_EQUAL(2, isrtraceGetStats(0)->count);
+}
+
+void test_ring_overwrites_oldest(void)
+{
+  isrtraceEvent_t event;
+  uint32_t i;
+
+  for (i = 0; i < CFG_ISRTRACE_EVENTS / 2 + 1; i++)
+  {
+    enter(EXC_TIMER, i * 10);
+    leave(EXC_TIMER, i * 10 + 5);
+  }
+
+  TEST_ASSERT_EQUAL(CFG_ISRTRACE_EVENTS, isrtraceGetEventCount());
+  TEST_ASSERT_EQUAL(2, isrtraceGetOverwritten());
+  TEST_ASSERT_TRUE(isrtraceGetEvent(0, &event));
+  TEST_ASSERT_EQUAL(10, event.timestamp);
+  TEST_ASSERT_TRUE(isrtraceGetEvent(CFG_ISRTRACE_EVENTS - 1, &event));
+  TEST_ASSERT_EQUAL(i * 10 - 5, event.timestamp);
+  TEST_ASSERT_EQUAL(CFG_ISRTRACE_EVENTS / 2 + 1, isrtraceGetStats(0)->count);
+}
+
+void test_stop_freezes_the_ring_only(void)
+{
+  isrtraceStop();
+  enter(EXC_TIMER, 0);
+  leave(EXC_TIMER, 10);
+
+  TEST_ASSERT_EQUAL(0, isrtraceGetEventCount());
+  TEST_ASSERT_EQUAL(1, isrtraceGetStats(0)->count);
+
+  isrtraceStart();
+  isrtraceReset();
+  TEST_ASSERT_EQUAL(0, isrtraceGetIrqCount());
+  TEST_ASSERT_EQUAL(0, isrtraceGetMaxDepth());
+}
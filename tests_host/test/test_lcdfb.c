@@ -0,0 +1,374 @@
+/**************************************************************************/
+/*!
+    @file     test_lcdfb.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+#include <string.h>
+#include <stdlib.h>
+#include "unity.h"
+#include "lcdfb.h"
+
+#define WIDTH   (176)
+#define HEIGHT  (220)
+
+//--------------------------------------------------------------------+
+// Simulated controller: a GRAM with a write window, plus the expected
+// screen contents (everything drawn directly, without the framebuffer)
+//--------------------------------------------------------------------+
+static uint16_t gram[HEIGHT][WIDTH];
+static uint16_t expected[HEIGHT][WIDTH];
+static uint16_t winX0, winY0, winX1, winY1, curX, curY;
+static uint32_t windows, pixels;
+
+uint16_t lcdGetWidth(void)  { return WIDTH; }
+uint16_t lcdGetHeight(void) { return HEIGHT; }
+
+void lcdSetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+  TEST_ASSERT_TRUE(x0 <= x1 && x1 < WIDTH);
+  TEST_ASSERT_TRUE(y0 <= y1 && y1 < HEIGHT);
+  winX0 = curX = x0;
+  winY0 = curY = y0;
+  winX1 = x1;
+  winY1 = y1;
+  windows++;
+}
+
+static void stream(uint16_t color)
+{
+  TEST_ASSERT_TRUE_MESSAGE(curY <= winY1, "Write past the end of the window");
+  gram[curY][curX] = color;
+  pixels++;
+  if (++curX > winX1)
+  {
+    curX = winX0;
+    curY++;
+  }
+}
+
+void lcdStreamPixels(const uint16_t *data, uint32_t len)
+{
+  while (len--) stream(*data++);
+}
+
+void lcdStreamColor(uint16_t color, uint32_t len)
+{
+  while (len--) stream(color);
+}
+
+static void expectHLine(uint16_t x0, uint16_t x1, uint16_t y, uint16_t color)
+{
+  uint16_t x;
+  for (x = x0; x <= x1; x++) expected[y][x] = color;
+}
+
+static void assertScreen(void)
+{
+  TEST_ASSERT_EQUAL_MEMORY(expected, gram, sizeof(gram));
+}
+
+static void resetCounters(void)
+{
+  windows = pixels = 0;
+  lcdfbResetStats();
+}
+
+void setUp(void)
+{
+  lcdfbSetRegion(0, 0, 0, 0);
+  memset(gram, 0, sizeof(gram));
+  memset(expected, 0, sizeof(expected));
+  resetCounters();
+}
+
+void tearDown(void)
+{
+
+}
+
+//--------------------------------------------------------------------+
+// Tests
+//--------------------------------------------------------------------+
+void test_no_region_draws_directly(void)
+{
+  lcdDrawHLine(10, 29, 5, 0x1234);
+  expectHLine(10, 29, 5, 0x1234);
+
+  TEST_ASSERT_EQUAL(1, windows);
+  TEST_ASSERT_EQUAL(20, pixels);
+  assertScreen();
+}
+
+void test_region_is_only_sent_on_flush(void)
+{
+  TEST_ASSERT_EQUAL(ERROR_NONE, lcdfbSetRegion(16, 32, 64, 16));
+  lcdfbFlush();
+  resetCounters();
+
+  lcdDrawPixel(20, 40, 0xF800);
+  TEST_ASSERT_EQUAL(0, windows);
+  TEST_ASSERT_EQUAL_HEX16(0xF800, lcdGetPixel(20, 40));
+  TEST_ASSERT_EQUAL_HEX16(0, gram[40][20]);
+
+  lcdfbFlush();
+  TEST_ASSERT_EQUAL(1, windows);
+  TEST_ASSERT_EQUAL(1, pixels);
+  TEST_ASSERT_EQUAL_HEX16(0xF800, gram[40][20]);
+
+  // Nothing left to send
+  lcdfbFlush();
+  TEST_ASSERT_EQUAL(1, windows);
+}
+
+void test_nearby_rects_are_merged(void)
+{
+  lcdfbRect_t rects[8];
+
+  lcdfbSetRegion(0, 0, 88, 16);
+  lcdfbFlush();
+
+  // Two short lines on consecutive rows become one rectangle
+  lcdDrawHLine(10, 20, 3, 0xFFFF);
+  lcdDrawHLine(10, 20, 4, 0xFFFF);
+  TEST_ASSERT_EQUAL(1, lcdfbGetDirtyRects(rects, 8));
+  TEST_ASSERT_EQUAL(10, rects[0].x0);
+  TEST_ASSERT_EQUAL(3,  rects[0].y0);
+  TEST_ASSERT_EQUAL(20, rects[0].x1);
+  TEST_ASSERT_EQUAL(4,  rects[0].y1);
+
+  // A pixel inside it doesn't add anything
+  lcdDrawPixel(15, 4, 0x0000);
+  TEST_ASSERT_EQUAL(1, lcdfbGetDirtyRects(rects, 8));
+
+  // Far away pixels get their own rectangle
+  lcdDrawPixel(80, 14, 0x07E0);
+  TEST_ASSERT_EQUAL(2, lcdfbGetDirtyRects(rects, 8));
+}
+
+void test_full_dirty_list_is_merged(void)
+{
+  lcdfbRect_t rects[CFG_TFTLCD_FRAMEBUFFER_DIRTYRECTS + 1];
+  uint16_t i;
+
+  lcdfbSetRegion(0, 0, 88, 16);
+  lcdfbFlush();
+  memset(gram, 0, sizeof(gram));
+  resetCounters();
+
+  for (i = 0; i < CFG_TFTLCD_FRAMEBUFFER_DIRTYRECTS + 4; i++)
+  {
+    lcdDrawPixel(i * 7, (i * 5) % 16, 0x001F);
+    expected[(i * 5) % 16][i * 7] = 0x001F;
+  }
+
+  TEST_ASSERT_TRUE(lcdfbGetDirtyRects(rects, CFG_TFTLCD_FRAMEBUFFER_DIRTYRECTS + 1) <= CFG_TFTLCD_FRAMEBUFFER_DIRTYRECTS);
+  lcdfbFlush();
+  TEST_ASSERT_TRUE(windows <= CFG_TFTLCD_FRAMEBUFFER_DIRTYRECTS);
+  assertScreen();
+}
+
+void test_lines_are_split_at_the_region(void)
+{
+  lcdfbStats_t stats;
+
+  lcdfbSetRegion(40, 10, 40, 20);
+  lcdfbFlush();
+  memset(gram, 0, sizeof(gram));
+  resetCounters();
+
+  // Left and right of the region are drawn straight away
+  lcdDrawHLine(0, 175, 15, 0xAAAA);
+  expectHLine(0, 175, 15, 0xAAAA);
+  TEST_ASSERT_EQUAL(2, windows);
+  TEST_ASSERT_EQUAL_HEX16(0xAAAA, gram[15][39]);
+  TEST_ASSERT_EQUAL_HEX16(0, gram[15][40]);
+
+  // Above and below too
+  lcdDrawVLine(50, 0, 219, 0x5555);
+  for (uint16_t y = 0; y < HEIGHT; y++) expected[y][50] = 0x5555;
+
+  lcdfbFlush();
+  assertScreen();
+
+  lcdfbGetStats(&stats);
+  TEST_ASSERT_EQUAL(4, stats.directRects);
+  TEST_ASSERT_EQUAL(136 + 200, stats.directPixels);
+
+  // The two parts inside the region cross, but aren't worth merging
+  TEST_ASSERT_EQUAL(2, stats.rects);
+  TEST_ASSERT_EQUAL(40 + 20, stats.pixels);
+}
+
+void test_pixels_are_split_at_the_region(void)
+{
+  uint16_t data[100], i;
+
+  for (i = 0; i < 100; i++)
+  {
+    data[i] = i + 1;
+    expected[12][i + 20] = i + 1;
+  }
+
+  lcdfbSetRegion(40, 10, 40, 20);
+  lcdfbFlush();
+  memset(gram, 0, sizeof(gram));
+
+  lcdDrawPixels(20, 12, data, 100);
+  lcdfbFlush();
+  assertScreen();
+}
+
+void test_rect_is_one_dirty_rect(void)
+{
+  lcdfbRect_t rects[2];
+  uint16_t y;
+
+  lcdfbSetRegion(0, 0, 88, 16);
+  lcdfbFlush();
+  memset(gram, 0, sizeof(gram));
+  resetCounters();
+
+  // Swapped corners, and the bottom rows are outside the region
+  lcdDrawRect(60, 19, 10, 5, 0x4321);
+  for (y = 5; y <= 19; y++) expectHLine(10, 60, y, 0x4321);
+
+  TEST_ASSERT_EQUAL(1, lcdfbGetDirtyRects(rects, 2));
+  TEST_ASSERT_EQUAL(10, rects[0].x0);
+  TEST_ASSERT_EQUAL(5,  rects[0].y0);
+  TEST_ASSERT_EQUAL(60, rects[0].x1);
+  TEST_ASSERT_EQUAL(15, rects[0].y1);
+  TEST_ASSERT_EQUAL(1, windows);
+
+  lcdfbFlush();
+  TEST_ASSERT_EQUAL(2, windows);
+  assertScreen();
+}
+
+void test_blit_is_clipped_and_split(void)
+{
+  uint16_t data[20 * 12], x, y;
+
+  for (y = 0; y < 12; y++)
+  {
+    for (x = 0; x < 20; x++)
+    {
+      data[y * 20 + x] = (y << 8) | x | 0x8000;
+      if (WIDTH - 8 + x < WIDTH) expected[100 + y][WIDTH - 8 + x] = data[y * 20 + x];
+      expected[30 + y][20 + x] = data[y * 20 + x];
+    }
+  }
+
+  lcdfbSetRegion(30, 34, 40, 20);
+  lcdfbFlush();
+  memset(gram, 0, sizeof(gram));
+  resetCounters();
+
+  // Outside the region and past the right edge: a single window
+  lcdBlit(WIDTH - 8, 100, 20, 12, data);
+  TEST_ASSERT_EQUAL(1, windows);
+  TEST_ASSERT_EQUAL(8 * 12, pixels);
+
+  // Across the region's top-left corner
+  lcdBlit(20, 30, 20, 12, data);
+  lcdfbFlush();
+  assertScreen();
+}
+
+void test_fill_clears_dirty_rects(void)
+{
+  lcdfbRect_t rects[1];
+  uint16_t y;
+
+  lcdfbSetRegion(0, 0, 64, 16);
+  lcdDrawPixel(3, 3, 0x1111);
+  lcdFillRGB(0x2222);
+  TEST_ASSERT_EQUAL(0, lcdfbGetDirtyRects(rects, 1));
+
+  for (y = 0; y < HEIGHT; y++) expectHLine(0, WIDTH - 1, y, 0x2222);
+  assertScreen();
+  TEST_ASSERT_EQUAL_HEX16(0x2222, lcdGetPixel(3, 3));
+}
+
+void test_invalid_region(void)
+{
+  TEST_ASSERT_EQUAL(ERROR_INVALIDPARAMETER, lcdfbSetRegion(0, 0, WIDTH, HEIGHT));
+  TEST_ASSERT_EQUAL(ERROR_INVALIDPARAMETER, lcdfbSetRegion(170, 0, 8, 8));
+  TEST_ASSERT_EQUAL(ERROR_INVALIDPARAMETER, lcdfbSetRegion(0, 215, 8, 8));
+  TEST_ASSERT_EQUAL(ERROR_NONE, lcdfbSetRegion(168, 212, 8, 8));
+}
+
+void test_random_drawing_matches_direct_drawing(void)
+{
+  uint16_t i, x0, x1, y, y0, y1, color;
+
+  srand(1);
+  lcdfbSetRegion(30, 60, 88, 16);
+
+  for (i = 0; i < 500; i++)
+  {
+    x0 = rand() % WIDTH;
+    x1 = rand() % WIDTH;
+    y = rand() % HEIGHT;
+    color = rand();
+
+    switch (i % 3)
+    {
+      case 0:
+        lcdDrawPixel(x0, y, color);
+        expected[y][x0] = color;
+        break;
+      case 1:
+        lcdDrawHLine(x0, x1, y, color);
+        expectHLine(x0 < x1 ? x0 : x1, x0 < x1 ? x1 : x0, y, color);
+        break;
+      case 2:
+        // Mostly inside the region
+        x0 = 30 + x0 % 88;
+        y0 = 55 + y % 26;
+        y1 = 55 + (y * 7) % 26;
+        lcdDrawVLine(x0, y0, y1, color);
+        for (y = (y0 < y1 ? y0 : y1); y <= (y0 < y1 ? y1 : y0); y++)
+        {
+          expected[y][x0] = color;
+        }
+        break;
+    }
+
+    if (i % 50 == 49)
+    {
+      lcdfbFlush();
+      assertScreen();
+    }
+  }
+}
@@ -0,0 +1,89 @@
+/**************************************************************************/
+/*!
+    @file     test_meminfo.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+#include "unity.h"
+#include "meminfo.h"
+
+#define STACK_WORDS   (64)
+
+static uint32_t stack[STACK_WORDS];
+
+void setUp(void)
+{
+  memset(stack, 0, sizeof(stack));
+  meminfoInitRegion(stack, &stack[STACK_WORDS]);
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_region_is_painted(void)
+{
+  uint32_t i;
+
+  for (i = 0; i < STACK_WORDS; i++)
+  {
+    TEST_ASSERT_EQUAL_HEX32(MEMINFO_STACK_PATTERN, stack[i]);
+  }
+  TEST_ASSERT_EQUAL(STACK_WORDS * 4, meminfoGetStackSize());
+  TEST_ASSERT_EQUAL(0, meminfoGetStackUsed());
+}
+
+void test_high_water_mark(void)
+{
+  // The stack grows down from the top
+  stack[STACK_WORDS - 1] = 0;
+  TEST_ASSERT_EQUAL(4, meminfoGetStackUsed());
+
+  stack[STACK_WORDS - 10] = 0x12345678;
+  TEST_ASSERT_EQUAL(40, meminfoGetStackUsed());
+
+  // Words that still hold the pattern further up don't matter
+  stack[STACK_WORDS - 5] = MEMINFO_STACK_PATTERN;
+  TEST_ASSERT_EQUAL(40, meminfoGetStackUsed());
+
+  // Deeper use moves the mark down
+  stack[STACK_WORDS - 20] = 1;
+  TEST_ASSERT_EQUAL(80, meminfoGetStackUsed());
+}
+
+void test_overflow(void)
+{
+  stack[0] = 0;
+  TEST_ASSERT_EQUAL(meminfoGetStackSize(), meminfoGetStackUsed());
+}
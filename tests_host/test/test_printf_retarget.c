@@ -0,0 +1,138 @@
+/**************************************************************************/
+/*!
+    @file     test_printf_retarget.c
+    @author   K. Townsend (microBuilder.eu)
+
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+#include <string.h>
+#include "unity.h"
+#include "printf-retarget.h"
+
+/* Blocks handed to the USB CDC driver */
+static char     sent[512];
+static uint16_t sent_len;
+static uint8_t  sent_blocks;
+static uint16_t send_limit;
+
+//--------------------------------------------------------------------+
+// USB CDC stubs
+//--------------------------------------------------------------------+
+bool usb_isConfigured(void)    { return true; }
+bool usb_cdc_isConnected(void) { return true; }
+
+uint16_t usb_cdc_send(uint8_t* buffer, uint16_t count)
+{
+  if (count > send_limit)
+  {
+    count = send_limit;
+  }
+  memcpy(&sent[sent_len], buffer, count);
+  sent_len += count;
+  sent_blocks++;
+  return count;
+}
+
+uint16_t usb_cdc_trySend(uint8_t* buffer, uint16_t count)
+{
+  return usb_cdc_send(buffer, count);
+}
+
+void setUp(void)
+{
+  printfFlush();
+  memset(sent, 0, sizeof(sent));
+  sent_len    = 0;
+  sent_blocks = 0;
+  send_limit  = 0xFFFF;
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_printf_line_buffered(void)
+{
+  puts("abc");
+  puts("def");
+  TEST_ASSERT_EQUAL(0, sent_blocks);
+
+  // A newline sends everything buffered so far as a single block
+  puts("ghi\n");
+  TEST_ASSERT_EQUAL(1, sent_blocks);
+  TEST_ASSERT_EQUAL_STRING("abcdefghi\n", sent);
+}
+
+void test_printf_putchar_and_flush(void)
+{
+  __putchar('>');
+  __putchar(' ');
+  TEST_ASSERT_EQUAL(0, sent_blocks);
+
+  printfFlush();
+  TEST_ASSERT_EQUAL(1, sent_blocks);
+  TEST_ASSERT_EQUAL_STRING("> ", sent);
+
+  // Nothing left to send
+  printfFlush();
+  TEST_ASSERT_EQUAL(1, sent_blocks);
+}
+
+void test_printf_buffer_full(void)
+{
+  char str[CFG_PRINTF_BUFFERSIZE * 2 + 10 + 1];
+
+  memset(str, 'x', sizeof(str) - 1);
+  str[sizeof(str) - 1] = 0;
+
+  // Full buffers are sent as they fill up, the remainder stays buffered
+  puts(str);
+  TEST_ASSERT_EQUAL(2, sent_blocks);
+  TEST_ASSERT_EQUAL(CFG_PRINTF_BUFFERSIZE * 2, sent_len);
+
+  printfFlush();
+  TEST_ASSERT_EQUAL(3, sent_blocks);
+  TEST_ASSERT_EQUAL_STRING(str, sent);
+}
+
+void test_printf_dropped(void)
+{
+  uint32_t dropped = printfGetDropped();
+
+  send_limit = 4;
+  puts("0123456789\n");
+
+  TEST_ASSERT_EQUAL_STRING("0123", sent);
+  TEST_ASSERT_EQUAL(dropped + 7, printfGetDropped());
+}
@@ -0,0 +1,170 @@
+/**************************************************************************/
+/*!
+    @file     test_probe.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+#include <unistd.h>
+#include "unity.h"
+#include "probe.h"
+
+void setUp(void)
+{
+  probeInit();
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_empty_probe(void)
+{
+  probe_t *probe = probeRegister("empty");
+
+  TEST_ASSERT_NOT_NULL(probe);
+  TEST_ASSERT_EQUAL(1, probeCount());
+  TEST_ASSERT_EQUAL(0, probe->count);
+  TEST_ASSERT_EQUAL(0, probeGetMean(probe));
+  TEST_ASSERT_EQUAL_STRING("empty", probeGet(0)->name);
+  TEST_ASSERT_NULL(probeGet(1));
+}
+
+void test_statistics(void)
+{
+  probe_t *probe = probeRegister("stats");
+
+  probeRecord(probe, 10);
+  probeRecord(probe, 30);
+  probeRecord(probe, 20);
+
+  TEST_ASSERT_EQUAL(3, probe->count);
+  TEST_ASSERT_EQUAL(10, probe->min);
+  TEST_ASSERT_EQUAL(30, probe->max);
+  TEST_ASSERT_EQUAL(20, probeGetMean(probe));
+}
+
+void test_histogram_bins(void)
+{
+  probe_t *probe = probeRegister("bins");
+
+  probeRecord(probe, 0);
+  probeRecord(probe, 1);
+  probeRecord(probe, 2);
+  probeRecord(probe, 3);
+  probeRecord(probe, 1024);
+  probeRecord(probe, 2047);
+  probeRecord(probe, 0xFFFFFFFF);
+
+  TEST_ASSERT_EQUAL(2, probe->histogram[0]);
+  TEST_ASSERT_EQUAL(2, probe->histogram[1]);
+  TEST_ASSERT_EQUAL(2, probe->histogram[10]);
+  TEST_ASSERT_EQUAL(1, probe->histogram[31]);
+}
+
+void test_histogram_saturates(void)
+{
+  probe_t *probe = probeRegister("saturate");
+  uint32_t i;
+
+  for (i = 0; i < 0x10005; i++)
+  {
+    probeRecord(probe, 5);
+  }
+
+  TEST_ASSERT_EQUAL_HEX16(0xFFFF, probe->histogram[2]);
+  TEST_ASSERT_EQUAL(0x10005, probe->count);
+}
+
+void test_same_name_shares_probe(void)
+{
+  char name[] = "shared";
+
+  // Compared by value, not by pointer
+  TEST_ASSERT_EQUAL_PTR(probeRegister("shared"), probeRegister(name));
+  TEST_ASSERT_EQUAL(1, probeCount());
+}
+
+void test_table_full(void)
+{
+  static const char *names[] = { "p0", "p1", "p2", "p3", "p4", "p5", "p6", "p7", "p8", "p9" };
+  uint8_t i;
+
+  TEST_ASSERT_TRUE(CFG_PROBE_MAXPROBES < sizeof(names) / sizeof(names[0]));
+  for (i = 0; i < CFG_PROBE_MAXPROBES; i++)
+  {
+    TEST_ASSERT_NOT_NULL(probeRegister(names[i]));
+  }
+  TEST_ASSERT_NULL(probeRegister(names[CFG_PROBE_MAXPROBES]));
+
+  // Recording into a missing probe is ignored
+  probeRecord(NULL, 10);
+  TEST_ASSERT_EQUAL(CFG_PROBE_MAXPROBES, probeCount());
+}
+
+void test_reset_keeps_names(void)
+{
+  probe_t *probe = probeRegister("reset");
+
+  probeRecord(probe, 100);
+  probeReset();
+
+  TEST_ASSERT_EQUAL(1, probeCount());
+  TEST_ASSERT_EQUAL_STRING("reset", probe->name);
+  TEST_ASSERT_EQUAL(0, probe->count);
+  TEST_ASSERT_EQUAL(0, probe->histogram[6]);
+
+  probeRecord(probe, 7);
+  TEST_ASSERT_EQUAL(7, probe->min);
+  TEST_ASSERT_EQUAL(7, probe->max);
+}
+
+void test_macros(void)
+{
+  const probe_t *probe;
+  uint8_t i;
+
+  for (i = 0; i < 3; i++)
+  {
+    PROBE_BEGIN(loop);
+    usleep(1000);
+    PROBE_END(loop);
+  }
+
+  probe = probeGet(0);
+  TEST_ASSERT_NOT_NULL(probe);
+  TEST_ASSERT_EQUAL_STRING("loop", probe->name);
+  TEST_ASSERT_EQUAL(3, probe->count);
+  // Host builds count nanoseconds
+  TEST_ASSERT_TRUE(probe->min >= 1000000);
+}
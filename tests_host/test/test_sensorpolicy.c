@@ -0,0 +1,244 @@
+/**************************************************************************/
+/*!
+    @file     test_sensorpolicy.c
+    @ingroup  Unit Tests
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#include <string.h>
+#include "unity.h"
+#include "sensorpolicy.h"
+
+static sensorpolicy_t        policy;
+static sensorpolicy_config_t config;
+static sensors_event_t       event;
+
+void setUp(void)
+{
+  memset(&policy, 0, sizeof(policy));
+  memset(&config, 0, sizeof(config));
+  memset(&event, 0, sizeof(event));
+  event.version = sizeof(sensors_event_t);
+  event.type = SENSOR_TYPE_AMBIENT_TEMPERATURE;
+}
+
+void tearDown(void)
+{
+}
+
+void test_sensorpolicy_init_invalid(void)
+{
+  config.deadbandAbs = -1.0F;
+  TEST_ASSERT_EQUAL(ERROR_INVALIDPARAMETER, sensorpolicyInit(&policy, &config));
+
+  config.deadbandAbs = 0.0F;
+  config.minInterval = 1000;
+  config.maxInterval = 500;
+  TEST_ASSERT_EQUAL(ERROR_INVALIDPARAMETER, sensorpolicyInit(&policy, &config));
+
+  config.maxInterval = 0;
+  config.alertEnabled = true;
+  config.alertLow = 10.0F;
+  config.alertHigh = 5.0F;
+  TEST_ASSERT_EQUAL(ERROR_INVALIDPARAMETER, sensorpolicyInit(&policy, &config));
+}
+
+void test_sensorpolicy_first_event_is_reported(void)
+{
+  config.deadbandAbs = 1.0F;
+  TEST_ASSERT_EQUAL(ERROR_NONE, sensorpolicyInit(&policy, &config));
+
+  event.temperature = 21.0F;
+  TEST_ASSERT_EQUAL(SENSORPOLICY_RESULT_REPORT, sensorpolicyCheck(&policy, &event, NULL));
+  TEST_ASSERT_EQUAL(1, policy.sent);
+  TEST_ASSERT_EQUAL(0, policy.suppressed);
+}
+
+void test_sensorpolicy_absolute_deadband(void)
+{
+  config.deadbandAbs = 0.5F;
+  sensorpolicyInit(&policy, &config);
+
+  event.temperature = 20.0F;
+  sensorpolicyCheck(&policy, &event, NULL);
+
+  /* Small changes are suppressed, measured against the last report */
+  event.temperature = 20.3F;
+  TEST_ASSERT_EQUAL(SENSORPOLICY_RESULT_SUPPRESS, sensorpolicyCheck(&policy, &event, NULL));
+  event.temperature = 19.6F;
+  TEST_ASSERT_EQUAL(SENSORPOLICY_RESULT_SUPPRESS, sensorpolicyCheck(&policy, &event, NULL));
+  event.temperature = 20.6F;
+  TEST_ASSERT_EQUAL(SENSORPOLICY_RESULT_REPORT, sensorpolicyCheck(&policy, &event, NULL));
+
+  TEST_ASSERT_EQUAL(2, policy.sent);
+  TEST_ASSERT_EQUAL(2, policy.suppressed);
+}
+
+void test_sensorpolicy_relative_deadband(void)
+{
+  config.deadbandRel = 0.1F;
+  sensorpolicyInit(&policy, &config);
+
+  event.pressure = 1000.0F;
+  sensorpolicyCheck(&policy, &event, NULL);
+
+  event.pressure = 1050.0F;
+  TEST_ASSERT_EQUAL(SENSORPOLICY_RESULT_SUPPRESS, sensorpolicyCheck(&policy, &event, NULL));
+  event.pressure = 1100.0F;
+  TEST_ASSERT_EQUAL(SENSORPOLICY_RESULT_REPORT, sensorpolicyCheck(&policy, &event, NULL));
+}
+
+void test_sensorpolicy_relative_deadband_at_zero(void)
+{
+  config.deadbandRel = 0.1F;
+  sensorpolicyInit(&policy, &config);
+
+  event.light = 0.0F;
+  sensorpolicyCheck(&policy, &event, NULL);
+
+  /* A sensor sitting at 0 must not report on every poll */
+  TEST_ASSERT_EQUAL(SENSORPOLICY_RESULT_SUPPRESS, sensorpolicyCheck(&policy, &event, NULL));
+  TEST_ASSERT_EQUAL(SENSORPOLICY_RESULT_SUPPRESS, sensorpolicyCheck(&policy, &event, NULL));
+  event.light = 0.5F;
+  TEST_ASSERT_EQUAL(SENSORPOLICY_RESULT_REPORT, sensorpolicyCheck(&policy, &event, NULL));
+}
+
+void test_sensorpolicy_vector_any_axis(void)
+{
+  config.deadbandAbs = 1.0F;
+  sensorpolicyInit(&policy, &config);
+
+  event.type = SENSOR_TYPE_ACCELEROMETER;
+  event.acceleration.z = SENSORS_GRAVITY_STANDARD;
+  sensorpolicyCheck(&policy, &event, NULL);
+
+  event.acceleration.y = 0.5F;
+  TEST_ASSERT_EQUAL(SENSORPOLICY_RESULT_SUPPRESS, sensorpolicyCheck(&policy, &event, NULL));
+  event.acceleration.y = 1.5F;
+  TEST_ASSERT_EQUAL(SENSORPOLICY_RESULT_REPORT, sensorpolicyCheck(&policy, &event, NULL));
+}
+
+void test_sensorpolicy_min_interval(void)
+{
+  config.minInterval = 100;
+  sensorpolicyInit(&policy, &config);
+
+  event.timestamp = 1000;
+  event.light = 10.0F;
+  sensorpolicyCheck(&policy, &event, NULL);
+
+  /* Changed, but too soon */
+  event.timestamp = 1050;
+  event.light = 20.0F;
+  TEST_ASSERT_EQUAL(SENSORPOLICY_RESULT_SUPPRESS, sensorpolicyCheck(&policy, &event, NULL));
+
+  event.timestamp = 1100;
+  TEST_ASSERT_EQUAL(SENSORPOLICY_RESULT_REPORT, sensorpolicyCheck(&policy, &event, NULL));
+}
+
+void test_sensorpolicy_max_interval(void)
+{
+  config.deadbandAbs = 5.0F;
+  config.maxInterval = 1000;
+  sensorpolicyInit(&policy, &config);
+
+  event.timestamp = 0;
+  sensorpolicyCheck(&policy, &event, NULL);
+
+  event.timestamp = 999;
+  TEST_ASSERT_EQUAL(SENSORPOLICY_RESULT_SUPPRESS, sensorpolicyCheck(&policy, &event, NULL));
+  event.timestamp = 1000;
+  TEST_ASSERT_EQUAL(SENSORPOLICY_RESULT_REPORT, sensorpolicyCheck(&policy, &event, NULL));
+}
+
+void test_sensorpolicy_alerts(void)
+{
+  msg_Alert_t alert;
+  float value;
+
+  config.deadbandAbs = 100.0F;
+  config.minInterval = 1000;
+  config.alertEnabled = true;
+  config.alertHigh = 30.0F;
+  config.alertLow = 0.0F;
+  config.alertHysteresis = 2.0F;
+  sensorpolicyInit(&policy, &config);
+
+  /* First in-range sample doesn't raise an alert */
+  event.temperature = 20.0F;
+  TEST_ASSERT_EQUAL(SENSORPOLICY_RESULT_REPORT, sensorpolicyCheck(&policy, &event, &alert));
+
+  /* Crossing the upper limit bypasses the deadband and rate limit */
+  event.timestamp = 10;
+  event.temperature = 31.0F;
+  TEST_ASSERT_EQUAL(SENSORPOLICY_RESULT_REPORT | SENSORPOLICY_RESULT_ALERT,
+                    sensorpolicyCheck(&policy, &event, &alert));
+  TEST_ASSERT_EQUAL_HEX16((SENSOR_TYPE_AMBIENT_TEMPERATURE << 8) | SENSORPOLICY_ALERT_ABOVEHIGH, alert.alertType);
+  memcpy(&value, alert.payload, sizeof(float));
+  TEST_ASSERT_EQUAL_FLOAT(31.0F, value);
+
+  /* Still above the limit, or inside the hysteresis band */
+  event.timestamp = 20;
+  event.temperature = 35.0F;
+  TEST_ASSERT_EQUAL(SENSORPOLICY_RESULT_SUPPRESS, sensorpolicyCheck(&policy, &event, &alert));
+  event.temperature = 29.0F;
+  TEST_ASSERT_EQUAL(SENSORPOLICY_RESULT_SUPPRESS, sensorpolicyCheck(&policy, &event, &alert));
+
+  /* Back in range */
+  event.temperature = 27.0F;
+  TEST_ASSERT_EQUAL(SENSORPOLICY_RESULT_REPORT | SENSORPOLICY_RESULT_ALERT,
+                    sensorpolicyCheck(&policy, &event, &alert));
+  TEST_ASSERT_EQUAL_HEX16((SENSOR_TYPE_AMBIENT_TEMPERATURE << 8) | SENSORPOLICY_ALERT_INRANGE, alert.alertType);
+
+  /* Straight to the lower limit */
+  event.temperature = -1.0F;
+  TEST_ASSERT_EQUAL(SENSORPOLICY_RESULT_REPORT | SENSORPOLICY_RESULT_ALERT,
+                    sensorpolicyCheck(&policy, &event, &alert));
+  TEST_ASSERT_EQUAL_HEX16((SENSOR_TYPE_AMBIENT_TEMPERATURE << 8) | SENSORPOLICY_ALERT_BELOWLOW, alert.alertType);
+
+  TEST_ASSERT_EQUAL(3, policy.alerts);
+  TEST_ASSERT_EQUAL(4, policy.sent);
+  TEST_ASSERT_EQUAL(2, policy.suppressed);
+}
+
+void test_sensorpolicy_reset(void)
+{
+  config.deadbandAbs = 1.0F;
+  sensorpolicyInit(&policy, &config);
+  sensorpolicyCheck(&policy, &event, NULL);
+  sensorpolicyCheck(&policy, &event, NULL);
+
+  sensorpolicyReset(&policy);
+  TEST_ASSERT_EQUAL(0, policy.sent);
+  TEST_ASSERT_EQUAL(0, policy.suppressed);
+  TEST_ASSERT_EQUAL_FLOAT(1.0F, policy.config.deadbandAbs);
+  TEST_ASSERT_EQUAL(SENSORPOLICY_RESULT_REPORT, sensorpolicyCheck(&policy, &event, NULL));
+}
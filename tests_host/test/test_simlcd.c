@@ -0,0 +1,244 @@
+/**************************************************************************/
+/*!
+    @file     test_simlcd.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+#include "lcdfb.h"
+#include "simlcd.h"
+
+// CFG_TFTLCD_FRAMEBUFFER is defined for the tests, so the drawing
+// functions come from lcdfb.c and reach simlcd.c through the windows
+
+#define PPMFILE   "build/test/test_simlcd.ppm"
+#define FRAMEFILE "build/test/test_simlcd_%u.ppm"
+
+static simlcdStats_t stats;
+
+static void drawScene(void)
+{
+  static const uint16_t data[4 * 3] =
+  {
+    COLOR_RED, COLOR_GREEN, COLOR_BLUE, COLOR_WHITE,
+    COLOR_WHITE, COLOR_BLUE, COLOR_GREEN, COLOR_RED,
+    COLOR_RED, COLOR_GREEN, COLOR_BLUE, COLOR_WHITE
+  };
+
+  lcdFillRGB(COLOR_BLACK);
+  lcdDrawRect(10, 10, 50, 30, COLOR_YELLOW);
+  lcdDrawHLine(0, 239, 100, COLOR_WHITE);
+  lcdDrawVLine(120, 0, 319, COLOR_WHITE);
+  lcdDrawPixel(5, 5, COLOR_RED);
+  lcdBlit(200, 300, 4, 3, data);
+}
+
+void setUp(void)
+{
+  lcdfbSetRegion(0, 0, 0, 0);
+  lcdInit();
+  simlcdSetFrameDump(NULL);
+}
+
+void tearDown(void)
+{
+}
+
+void test_stream_wraps_inside_window(void)
+{
+  lcdSetWindow(10, 20, 12, 21);
+  lcdStreamColor(COLOR_RED, 6);
+  lcdStreamColor(COLOR_BLUE, 2);
+
+  // The address goes back to the top of the window after 6 pixels
+  TEST_ASSERT_EQUAL_HEX16(COLOR_BLUE, simlcdReadPixel(10, 20));
+  TEST_ASSERT_EQUAL_HEX16(COLOR_BLUE, simlcdReadPixel(11, 20));
+  TEST_ASSERT_EQUAL_HEX16(COLOR_RED, simlcdReadPixel(12, 20));
+  TEST_ASSERT_EQUAL_HEX16(COLOR_RED, simlcdReadPixel(12, 21));
+  TEST_ASSERT_EQUAL_HEX16(COLOR_BLACK, simlcdReadPixel(13, 20));
+  TEST_ASSERT_EQUAL_HEX16(COLOR_BLACK, simlcdReadPixel(10, 22));
+
+  simlcdGetStats(&stats);
+  TEST_ASSERT_EQUAL(1, stats.windows);
+  TEST_ASSERT_EQUAL(8, stats.pixels);
+}
+
+void test_pixels_outside_panel_are_counted_but_dropped(void)
+{
+  lcdSetWindow(SIMLCD_WIDTH - 2, 0, SIMLCD_WIDTH + 1, 0);
+  lcdStreamColor(COLOR_GREEN, 4);
+
+  TEST_ASSERT_EQUAL_HEX16(COLOR_GREEN, simlcdReadPixel(SIMLCD_WIDTH - 1, 0));
+  TEST_ASSERT_EQUAL_HEX16(COLOR_BLACK, simlcdReadPixel(0, 1));
+
+  simlcdGetStats(&stats);
+  TEST_ASSERT_EQUAL(4, stats.pixels);
+}
+
+void test_primitives_use_one_window(void)
+{
+  lcdDrawRect(10, 10, 19, 14, COLOR_YELLOW);
+  simlcdGetStats(&stats);
+  TEST_ASSERT_EQUAL(1, stats.windows);
+  TEST_ASSERT_EQUAL(50, stats.pixels);
+  TEST_ASSERT_EQUAL_HEX16(COLOR_YELLOW, simlcdReadPixel(19, 14));
+  TEST_ASSERT_EQUAL_HEX16(COLOR_BLACK, simlcdReadPixel(20, 14));
+
+  simlcdResetStats();
+  lcdFillRGB(COLOR_WHITE);
+  simlcdGetStats(&stats);
+  TEST_ASSERT_EQUAL(1, stats.windows);
+  TEST_ASSERT_EQUAL(SIMLCD_WIDTH * SIMLCD_HEIGHT, stats.pixels);
+}
+
+void test_framebuffer_matches_direct_drawing(void)
+{
+  uint32_t direct;
+
+  drawScene();
+  direct = simlcdChecksum();
+
+  // The same scene through a framebuffer strip must give the same pixels
+  lcdInit();
+  TEST_ASSERT_EQUAL(ERROR_NONE, lcdfbSetRegion(0, 0, SIMLCD_WIDTH, 4));
+  drawScene();
+  lcdfbFlush();
+  TEST_ASSERT_EQUAL_HEX32(direct, simlcdChecksum());
+  TEST_ASSERT_EQUAL_HEX16(COLOR_RED, simlcdReadPixel(5, 5));
+}
+
+void test_landscape_swaps_dimensions(void)
+{
+  lcdProperties_t properties = lcdGetProperties();
+
+  TEST_ASSERT_TRUE(properties.orientation);
+  TEST_ASSERT_EQUAL(SIMLCD_WIDTH, lcdGetWidth());
+
+  lcdSetOrientation(LCD_ORIENTATION_LANDSCAPE);
+  TEST_ASSERT_EQUAL(LCD_ORIENTATION_LANDSCAPE, lcdGetOrientation());
+  TEST_ASSERT_EQUAL(SIMLCD_HEIGHT, lcdGetWidth());
+  TEST_ASSERT_EQUAL(SIMLCD_WIDTH, lcdGetHeight());
+
+  // (0, 0) in landscape is the top right corner of the portrait panel
+  lcdSetWindow(0, 0, 0, 0);
+  lcdStreamColor(COLOR_RED, 1);
+  TEST_ASSERT_EQUAL_HEX16(COLOR_RED, simlcdReadPixel(0, 0));
+  TEST_ASSERT_EQUAL_HEX16(COLOR_RED, simlcdGetFramebuffer()[SIMLCD_WIDTH - 1]);
+
+  lcdSetOrientation(LCD_ORIENTATION_PORTRAIT);
+  TEST_ASSERT_EQUAL_HEX16(COLOR_RED, simlcdReadPixel(SIMLCD_WIDTH - 1, 0));
+}
+
+void test_scroll_moves_rows_and_fills(void)
+{
+  lcdSetWindow(0, 10, SIMLCD_WIDTH - 1, 10);
+  lcdStreamColor(COLOR_RED, SIMLCD_WIDTH);
+
+  lcdScroll(4, COLOR_BLUE);
+  TEST_ASSERT_EQUAL_HEX16(COLOR_RED, simlcdReadPixel(7, 6));
+  TEST_ASSERT_EQUAL_HEX16(COLOR_BLACK, simlcdReadPixel(7, 10));
+  TEST_ASSERT_EQUAL_HEX16(COLOR_BLUE, simlcdReadPixel(7, SIMLCD_HEIGHT - 4));
+  TEST_ASSERT_EQUAL_HEX16(COLOR_BLACK, simlcdReadPixel(7, SIMLCD_HEIGHT - 5));
+
+  lcdScroll(-6, COLOR_GREEN);
+  TEST_ASSERT_EQUAL_HEX16(COLOR_RED, simlcdReadPixel(7, 12));
+  TEST_ASSERT_EQUAL_HEX16(COLOR_GREEN, simlcdReadPixel(7, 5));
+  TEST_ASSERT_EQUAL_HEX16(COLOR_BLACK, simlcdReadPixel(7, 6));
+}
+
+void test_write_ppm(void)
+{
+  uint8_t rgb[3];
+  char header[32];
+  FILE *f;
+
+  lcdDrawPixel(0, 0, COLOR_WHITE);
+  lcdDrawPixel(1, 0, COLOR_RED);
+  TEST_ASSERT_EQUAL(ERROR_NONE, simlcdWritePPM(PPMFILE));
+
+  f = fopen(PPMFILE, "rb");
+  TEST_ASSERT_NOT_NULL(f);
+  TEST_ASSERT_NOT_NULL(fgets(header, sizeof(header), f));
+  TEST_ASSERT_EQUAL_STRING("P6\n", header);
+  TEST_ASSERT_NOT_NULL(fgets(header, sizeof(header), f));
+  TEST_ASSERT_EQUAL_STRING("240 320\n", header);
+  TEST_ASSERT_NOT_NULL(fgets(header, sizeof(header), f));
+  TEST_ASSERT_EQUAL_STRING("255\n", header);
+
+  TEST_ASSERT_EQUAL(3, fread(rgb, 1, 3, f));
+  TEST_ASSERT_EQUAL_HEX8(0xFF, rgb[0]);
+  TEST_ASSERT_EQUAL_HEX8(0xFF, rgb[1]);
+  TEST_ASSERT_EQUAL_HEX8(0xFF, rgb[2]);
+  TEST_ASSERT_EQUAL(3, fread(rgb, 1, 3, f));
+  TEST_ASSERT_EQUAL_HEX8(0xFF, rgb[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x00, rgb[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x00, rgb[2]);
+
+  // Every pixel is there, and nothing more
+  fseek(f, 0, SEEK_END);
+  TEST_ASSERT_EQUAL(15 + SIMLCD_WIDTH * SIMLCD_HEIGHT * 3, ftell(f));
+  fclose(f);
+  remove(PPMFILE);
+
+  TEST_ASSERT_EQUAL(ERROR_INVALIDPARAMETER, simlcdWritePPM("no/such/dir/frame.ppm"));
+}
+
+void test_flush_counts_and_dumps_frames(void)
+{
+  char name[64];
+  FILE *f;
+  uint32_t i;
+
+  TEST_ASSERT_EQUAL(ERROR_NONE, simlcdFlush());
+
+  simlcdSetFrameDump(FRAMEFILE);
+  TEST_ASSERT_EQUAL(ERROR_NONE, simlcdFlush());
+  TEST_ASSERT_EQUAL(ERROR_NONE, simlcdFlush());
+
+  simlcdGetStats(&stats);
+  TEST_ASSERT_EQUAL(3, stats.flushes);
+
+  // The frame number counts every flush, dumped or not
+  for (i = 1; i <= 2; i++)
+  {
+    snprintf(name, sizeof(name), FRAMEFILE, (unsigned int) i);
+    f = fopen(name, "rb");
+    TEST_ASSERT_NOT_NULL(f);
+    fclose(f);
+    remove(name);
+  }
+  snprintf(name, sizeof(name), FRAMEFILE, 0u);
+  TEST_ASSERT_NULL(fopen(name, "rb"));
+}
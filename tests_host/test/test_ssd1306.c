@@ -0,0 +1,225 @@
+/**************************************************************************/
+/*!
+    @file     test_ssd1306.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+#include <string.h>
+#include "unity.h"
+#include "smallfonts.h"
+#include "ssd1306_i2c.h"
+
+extern uint8_t _ssd1306buffer[SSD1306_LCDWIDTH * SSD1306_LCDHEIGHT / 8];
+
+//--------------------------------------------------------------------+
+// I2C stub: decodes the transactions like the controller would, in
+// horizontal addressing mode, into a copy of the display RAM
+//--------------------------------------------------------------------+
+// From core/i2c/i2c.h, which isn't included so that i2c.c isn't linked
+#define I2CSTATE_ACK        0x101
+#define I2CSTATE_NACK       0x102
+
+volatile uint8_t  I2CMasterBuffer[64];
+volatile uint8_t  I2CSlaveBuffer[64];
+volatile uint32_t I2CReadLength, I2CWriteLength;
+
+static uint8_t  gram[SSD1306_PAGES][SSD1306_LCDWIDTH];
+static uint8_t  colStart, colEnd, pageStart, pageEnd, col, page;
+static uint32_t transactions, dataBytes;
+static uint32_t failAfter;       // Transactions before a NACK, 0 to never fail
+
+uint32_t i2cInit(uint32_t I2cMode)
+{
+  return 1;
+}
+
+uint32_t i2cEngine(void)
+{
+  uint32_t i;
+
+  TEST_ASSERT_TRUE(I2CWriteLength <= sizeof(I2CMasterBuffer));
+  TEST_ASSERT_EQUAL_HEX8(SSD1306_I2C_ADDRESS, I2CMasterBuffer[0]);
+
+  if (failAfter && (--failAfter == 0)) return I2CSTATE_NACK;
+  transactions++;
+
+  if (I2CMasterBuffer[1] == 0x40)
+  {
+    for (i = 2; i < I2CWriteLength; i++)
+    {
+      gram[page][col] = I2CMasterBuffer[i];
+      dataBytes++;
+      if (col++ == colEnd)
+      {
+        col = colStart;
+        page = (page == pageEnd) ? pageStart : page + 1;
+      }
+    }
+  }
+  else if ((I2CMasterBuffer[1] == 0x00) && (I2CWriteLength == 8))
+  {
+    // Column and page address (single byte init commands are ignored)
+    TEST_ASSERT_EQUAL_HEX8(SSD1306_COLUMNADDR, I2CMasterBuffer[2]);
+    TEST_ASSERT_EQUAL_HEX8(SSD1306_PAGEADDR, I2CMasterBuffer[5]);
+    col = colStart = I2CMasterBuffer[3];
+    colEnd = I2CMasterBuffer[4];
+    page = pageStart = I2CMasterBuffer[6];
+    pageEnd = I2CMasterBuffer[7];
+  }
+
+  return I2CSTATE_ACK;
+}
+
+static void resetCounters(void)
+{
+  transactions = dataBytes = 0;
+}
+
+void setUp(void)
+{
+  memset(gram, 0xAA, sizeof(gram));
+  failAfter = 0;
+  ssd1306Init(SSD1306_INTERNALVCC);
+  ssd1306ClearScreen();
+  resetCounters();
+}
+
+void tearDown(void)
+{
+}
+
+//--------------------------------------------------------------------+
+// Tests
+//--------------------------------------------------------------------+
+void test_first_refresh_sends_whole_buffer_in_bursts(void)
+{
+  TEST_ASSERT_EQUAL(ERROR_NONE, ssd1306Refresh());
+
+  // One address and three data transactions (62 + 62 + 4) per page,
+  // instead of one transaction per byte
+  TEST_ASSERT_EQUAL(SSD1306_PAGES * 4, transactions);
+  TEST_ASSERT_EQUAL(sizeof(_ssd1306buffer), dataBytes);
+  TEST_ASSERT_EQUAL_MEMORY(_ssd1306buffer, gram, sizeof(gram));
+}
+
+void test_refresh_without_changes_sends_nothing(void)
+{
+  ssd1306Refresh();
+  resetCounters();
+
+  ssd1306Refresh();
+  TEST_ASSERT_EQUAL(0, transactions);
+
+  // Setting a pixel that is already set isn't a change either
+  ssd1306DrawPixel(10, 10);
+  ssd1306Refresh();
+  resetCounters();
+  ssd1306DrawPixel(10, 10);
+  ssd1306ClearPixel(11, 10);
+  ssd1306Refresh();
+  TEST_ASSERT_EQUAL(0, transactions);
+}
+
+void test_refresh_sends_only_changed_columns(void)
+{
+  ssd1306Refresh();
+  resetCounters();
+
+  ssd1306DrawPixel(20, 3);
+  ssd1306DrawPixel(25, 5);
+  ssd1306DrawPixel(100, 63);
+  TEST_ASSERT_EQUAL(ERROR_NONE, ssd1306Refresh());
+
+  // Columns 20..25 of page 0 and column 100 of the last page
+  TEST_ASSERT_EQUAL(4, transactions);
+  TEST_ASSERT_EQUAL(7, dataBytes);
+  TEST_ASSERT_EQUAL_MEMORY(_ssd1306buffer, gram, sizeof(gram));
+
+  ssd1306ClearPixel(25, 5);
+  resetCounters();
+  ssd1306Refresh();
+  TEST_ASSERT_EQUAL(1, dataBytes);
+  TEST_ASSERT_EQUAL_HEX8(0x00, gram[0][25]);
+}
+
+void test_draw_string_across_pages(void)
+{
+  uint8_t x, y, c;
+
+  ssd1306Refresh();
+  resetCounters();
+
+  // 5x8 characters starting 4 rows into page 1
+  ssd1306DrawString(2, 12, "Hi", Font_System5x8);
+  ssd1306Refresh();
+
+  // Pages 1 and 2, columns 2..13 (the characters are 6 pixels apart)
+  TEST_ASSERT_EQUAL(4, transactions);
+  TEST_ASSERT_EQUAL(2 * 11, dataBytes);
+  TEST_ASSERT_EQUAL_MEMORY(_ssd1306buffer, gram, sizeof(gram));
+
+  // Every pixel matches the font data
+  for (c = 0; c < 2; c++)
+  {
+    for (x = 0; x < 5; x++)
+    {
+      for (y = 0; y < 8; y++)
+      {
+        uint8_t column = Font_System5x8.au8FontTable[("Hi"[c] - Font_System5x8.u8FirstChar) * 5 + x];
+        TEST_ASSERT_EQUAL((column >> y) & 1, ssd1306GetPixel(2 + c * 6 + x, 12 + y));
+      }
+    }
+  }
+}
+
+void test_draw_string_is_clipped(void)
+{
+  ssd1306DrawString(SSD1306_LCDWIDTH - 3, SSD1306_LCDHEIGHT - 4, "WW", Font_System5x8);
+  TEST_ASSERT_EQUAL(ERROR_NONE, ssd1306Refresh());
+  TEST_ASSERT_EQUAL_MEMORY(_ssd1306buffer, gram, sizeof(gram));
+}
+
+void test_failed_page_is_sent_again(void)
+{
+  ssd1306Refresh();
+  resetCounters();
+
+  ssd1306DrawPixel(5, 40);
+  failAfter = 2;      // The data transaction fails
+  TEST_ASSERT_EQUAL(ERROR_I2C_NOACK, ssd1306Refresh());
+
+  resetCounters();
+  TEST_ASSERT_EQUAL(ERROR_NONE, ssd1306Refresh());
+  TEST_ASSERT_EQUAL(2, transactions);
+  TEST_ASSERT_EQUAL_MEMORY(_ssd1306buffer, gram, sizeof(gram));
+}
@@ -0,0 +1,518 @@
+/**************************************************************************/
+/*!
+    @file     binlogdec.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Decodes binary log records (core/binlog) on the host
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+/*  The firmware only stores an ID for each format string (its offset in
+    the .logstr section of the ELF file) and the raw argument words, so
+    the records are formatted here, with the format strings read from
+    the ELF file that was flashed.
+
+    Usage: binlogdec [-n] <firmware.elf> [<capture>]
+
+      -n           Don't print the timestamps
+
+    The capture (stdin by default) can be the raw records, as returned by
+    binlogRead, or the output of the 'lg' CLI command, where each line
+    holding records starts with '~' and all other lines are ignored.  If
+    bytes are lost, the decoder resyncs on the next valid record header.
+
+    '%s' arguments are read from the ELF file as well, so they must point
+    to constant strings in flash.  Floats were converted to single
+    precision on the device, and '%E' is the firmware's engineering
+    notation (see core/libc/stdio.c).
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <math.h>
+#include <elf.h>
+
+#include "core/binlog/binlog.h"
+
+typedef struct
+{
+  uint64_t addr;
+  uint64_t size;
+  uint64_t offset;
+  int      loaded;                    // Contents are in the file
+} section_t;
+
+static uint8_t   *elf;
+static size_t     elfSize;
+static section_t  logstr;
+static section_t *sections;
+static int        sectionCount;
+static int        showTime = 1;
+static int        lineStart = 1;
+
+/**************************************************************************/
+/*!
+    @brief  Reads a whole file into a malloc'ed buffer
+*/
+/**************************************************************************/
+static uint8_t *readFile(FILE *file, size_t *size)
+{
+  uint8_t *data = NULL;
+  size_t   len = 0, max = 0, n;
+
+  do
+  {
+    if (len == max)
+    {
+      max = max ? max * 2 : 65536;
+      data = realloc(data, max);
+      if (!data) return NULL;
+    }
+    n = fread(data + len, 1, max - len, file);
+    len += n;
+  } while (n);
+
+  *size = len;
+  return data;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Loads the section table of a 32 or 64-bit little-endian ELF
+            file, and finds the .logstr section
+*/
+/**************************************************************************/
+static int elfLoad(void)
+{
+  uint64_t shoff, nameoff;
+  int      is64, shentsize, shstrndx, i;
+
+  if (elfSize < sizeof(Elf32_Ehdr) || memcmp(elf, ELFMAG, SELFMAG) ||
+      elf[EI_DATA] != ELFDATA2LSB)
+  {
+    return -1;
+  }
+
+  is64 = (elf[EI_CLASS] == ELFCLASS64);
+  if (is64)
+  {
+    Elf64_Ehdr *eh = (Elf64_Ehdr *) elf;
+    shoff = eh->e_shoff;
+    shentsize = eh->e_shentsize;
+    sectionCount = eh->e_shnum;
+    shstrndx = eh->e_shstrndx;
+  }
+  else
+  {
+    Elf32_Ehdr *eh = (Elf32_Ehdr *) elf;
+    shoff = eh->e_shoff;
+    shentsize = eh->e_shentsize;
+    sectionCount = eh->e_shnum;
+    shstrndx = eh->e_shstrndx;
+  }
+
+  if (shstrndx >= sectionCount || shoff + (uint64_t) sectionCount * shentsize > elfSize)
+  {
+    return -1;
+  }
+
+  sections = calloc(sectionCount, sizeof(section_t));
+  if (!sections) return -1;
+
+  // Section names are only needed to find .logstr
+  nameoff = is64 ? ((Elf64_Shdr *) (elf + shoff + shstrndx * shentsize))->sh_offset
+                 : ((Elf32_Shdr *) (elf + shoff + shstrndx * shentsize))->sh_offset;
+
+  for (i = 0; i < sectionCount; i++)
+  {
+    uint64_t flags, type, name;
+    uint8_t *sh = elf + shoff + i * shentsize;
+
+    if (is64)
+    {
+      Elf64_Shdr *s = (Elf64_Shdr *) sh;
+      sections[i].addr = s->sh_addr;
+      sections[i].size = s->sh_size;
+      sections[i].offset = s->sh_offset;
+      flags = s->sh_flags; type = s->sh_type; name = s->sh_name;
+    }
+    else
+    {
+      Elf32_Shdr *s = (Elf32_Shdr *) sh;
+      sections[i].addr = s->sh_addr;
+      sections[i].size = s->sh_size;
+      sections[i].offset = s->sh_offset;
+      flags = s->sh_flags; type = s->sh_type; name = s->sh_name;
+    }
+
+    sections[i].loaded = (type != SHT_NOBITS) &&
+                         (sections[i].offset + sections[i].size <= elfSize);
+
+    // .logstr isn't allocated in firmware builds (INFO section), but is
+    // in host builds, which don't use the firmware linker scripts
+    if (sections[i].loaded && nameoff + name < elfSize &&
+        !strcmp((char *) elf + nameoff + name, BINLOG_SECTION))
+    {
+      logstr = sections[i];
+    }
+
+    // Only the sections that are in memory can hold '%s' strings
+    if (!(flags & SHF_ALLOC))
+    {
+      sections[i].loaded = 0;
+    }
+  }
+
+  return logstr.size ? 0 : -1;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the format string with the specified ID, or NULL
+*/
+/**************************************************************************/
+static const char *formatLookup(uint32_t id)
+{
+  // IDs are the low 24 bits of the address of the string
+  uint64_t off = (id - logstr.addr) & BINLOG_ID_MASK;
+
+  if (off >= logstr.size || (off && elf[logstr.offset + off - 1]))
+  {
+    // Not the start of a string
+    return NULL;
+  }
+  return (const char *) elf + logstr.offset + off;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the string at the specified address on the device,
+            if it is in the ELF file
+*/
+/**************************************************************************/
+static const char *stringLookup(uint32_t addr)
+{
+  int i;
+
+  for (i = 0; i < sectionCount; i++)
+  {
+    section_t *s = &sections[i];
+    uint64_t   off = (uint32_t) (addr - (uint32_t) s->addr);
+
+    if (s->loaded && off < s->size && memchr(elf + s->offset + off, 0, s->size - off))
+    {
+      return (const char *) elf + s->offset + off;
+    }
+  }
+  return NULL;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Sends text to stdout, with a timestamp at the start of each
+            line
+*/
+/**************************************************************************/
+static void output(const char *text, uint32_t timestamp)
+{
+  for (; *text; text++)
+  {
+    if (lineStart && showTime)
+    {
+      printf("[%6u.%03u] ", timestamp / 1000, timestamp % 1000);
+    }
+    putchar(*text);
+    lineStart = (*text == '\n');
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief  Formats a float in engineering notation, as '%E' does in the
+            firmware
+*/
+/**************************************************************************/
+static void formatEngineering(char *out, size_t len, const char *spec, double value)
+{
+  char     mantissa[64];
+  int      exponent = 0;
+  char     format[32];
+  size_t   n = strlen(spec);
+  int      precision = 3;
+  const char *dot = strchr(spec, '.');
+
+  if (dot) precision = atoi(dot + 1);
+
+  if (value != 0 && isfinite(value))
+  {
+    exponent = (int) floor(log10(fabs(value)));
+    exponent -= ((exponent % 3) + 3) % 3;
+    value /= pow(10, exponent);
+    // Rounding can give 1000.0
+    snprintf(mantissa, sizeof(mantissa), "%.*f", precision, fabs(value));
+    if (atof(mantissa) >= 1000)
+    {
+      value /= 1000;
+      exponent += 3;
+    }
+  }
+
+  // Same flags and width, applied to the whole number
+  snprintf(mantissa, sizeof(mantissa), "%.*fE%+03d", precision, value, exponent);
+  snprintf(format, sizeof(format), "%.*ss", (int) (dot ? dot - spec : n - 1), spec);
+  snprintf(out, len, format, mantissa);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Formats one record
+*/
+/**************************************************************************/
+static void formatRecord(const char *format, uint32_t timestamp, const uint32_t *args, int count)
+{
+  char text[1024], spec[32], *t = text;
+  const char *f = format;
+  size_t room;
+  int arg = 0;
+
+  while (*f && t < text + sizeof(text) - 1)
+  {
+    room = text + sizeof(text) - t;
+    if (*f != '%')
+    {
+      *t++ = *f++;
+      continue;
+    }
+    if (f[1] == '%')
+    {
+      *t++ = '%';
+      f += 2;
+      continue;
+    }
+
+    // Flags, width and precision are kept, length modifiers are removed
+    // since every argument is a 32-bit word
+    size_t n = 0;
+    spec[n++] = *f++;
+    while (*f && strchr("-+ #0123456789.*", *f) && n < sizeof(spec) - 3)
+    {
+      if (*f == '*')
+      {
+        n += snprintf(spec + n, sizeof(spec) - n, "%d", (arg < count) ? (int32_t) args[arg++] : 0);
+        f++;
+      }
+      else
+      {
+        spec[n++] = *f++;
+      }
+    }
+    while (*f && strchr("hlLqjzt", *f)) f++;
+    if (!*f) break;
+    spec[n++] = *f;
+    spec[n] = 0;
+
+    if (arg >= count)
+    {
+      t += snprintf(t, room, "<?>");
+    }
+    else
+    {
+      uint32_t value = args[arg++];
+      union { uint32_t u; float f; } bits = { value };
+      const char *str;
+
+      switch (*f)
+      {
+        case 'd': case 'i':
+          t += snprintf(t, room, spec, (int32_t) value);
+          break;
+        case 'u': case 'x': case 'X': case 'o': case 'c':
+          t += snprintf(t, room, spec, value);
+          break;
+        case 'p':
+          t += snprintf(t, room, "0x%08X", value);
+          break;
+        case 's':
+          str = stringLookup(value);
+          if (str) t += snprintf(t, room, spec, str);
+          else     t += snprintf(t, room, "<0x%08X>", value);
+          break;
+        case 'e':
+          // The firmware writes the exponent with an uppercase 'E'
+          spec[n - 1] = 'E';
+          t += snprintf(t, room, spec, (double) bits.f);
+          break;
+        case 'E':
+          formatEngineering(t, room, spec, (double) bits.f);
+          t += strlen(t);
+          break;
+        case 'f': case 'F': case 'g': case 'G':
+          t += snprintf(t, room, spec, (double) bits.f);
+          break;
+        default:
+          t += snprintf(t, room, "%s", spec);
+          arg--;
+          break;
+      }
+    }
+    f++;
+    if (t > text + sizeof(text) - 1) t = text + sizeof(text) - 1;
+  }
+  *t = 0;
+
+  output(text, timestamp);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Converts the '~' lines of a CLI capture to raw bytes, in
+            place, and returns the new length
+*/
+/**************************************************************************/
+static size_t hexDecode(uint8_t *data, size_t len)
+{
+  size_t i = 0, out = 0;
+
+  while (i < len)
+  {
+    int record = (data[i] == '~');
+
+    for (i++; i < len && data[i] != '\n'; i++)
+    {
+      if (record && i + 1 < len && isxdigit(data[i]) && isxdigit(data[i + 1]))
+      {
+        char hex[3] = { data[i], data[i + 1], 0 };
+        data[out++] = (uint8_t) strtoul(hex, NULL, 16);
+        i++;
+      }
+    }
+    i++;
+  }
+
+  return out;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns 1 if the capture is text (the 'lg' command output)
+*/
+/**************************************************************************/
+static int isText(const uint8_t *data, size_t len)
+{
+  size_t i;
+
+  for (i = 0; i < len; i++)
+  {
+    if (!isprint(data[i]) && !isspace(data[i])) return 0;
+  }
+  return memchr(data, '~', len) != NULL;
+}
+
+static uint32_t readWord(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+int main(int argc, char **argv)
+{
+  FILE    *file;
+  uint8_t *data;
+  size_t   len, pos = 0;
+  uint32_t args[BINLOG_MAXARGS];
+  int      i, skipped = 0;
+
+  if (argc > 1 && !strcmp(argv[1], "-n"))
+  {
+    showTime = 0;
+    argc--;
+    argv++;
+  }
+  if (argc < 2 || argc > 3)
+  {
+    fprintf(stderr, "Usage: binlogdec [-n] <firmware.elf> [<capture>]\n");
+    return 1;
+  }
+
+  file = fopen(argv[1], "rb");
+  if (!file || !(elf = readFile(file, &elfSize)) || elfLoad())
+  {
+    fprintf(stderr, "%s: not an ELF file with a " BINLOG_SECTION " section\n", argv[1]);
+    return 1;
+  }
+  fclose(file);
+
+  file = (argc == 3) ? fopen(argv[2], "rb") : stdin;
+  if (!file || !(data = readFile(file, &len)))
+  {
+    fprintf(stderr, "%s: can't read the capture\n", argv[2]);
+    return 1;
+  }
+
+  if (isText(data, len))
+  {
+    len = hexDecode(data, len);
+  }
+
+  while (pos + 4 * BINLOG_HEADERWORDS <= len)
+  {
+    uint32_t    header = readWord(data + pos);
+    int         count = (header >> BINLOG_COUNT_SHIFT) & BINLOG_COUNT_MASK;
+    const char *format = formatLookup(header & BINLOG_ID_MASK);
+
+    if ((header & BINLOG_MARKER_MASK) != BINLOG_MARKER || count > BINLOG_MAXARGS ||
+        !format || pos + 4 * (BINLOG_HEADERWORDS + count) > len)
+    {
+      // Lost or corrupted bytes, look for the next record header
+      pos++;
+      skipped++;
+      continue;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+      args[i] = readWord(data + pos + 4 * (BINLOG_HEADERWORDS + i));
+    }
+    formatRecord(format, readWord(data + pos + 4), args, count);
+    pos += 4 * (BINLOG_HEADERWORDS + count);
+  }
+
+  if (skipped || pos != len)
+  {
+    fprintf(stderr, "binlogdec: %d bytes skipped, %u bytes left over\n",
+            skipped, (unsigned int) (len - pos));
+  }
+
+  return 0;
+}
@@ -0,0 +1,129 @@
+/**************************************************************************/
+/*!
+    @file     binlogdemo.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Writes sample binary log records for the decoder test
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+/*  Built with the firmware's binlog.c and the simulator board settings
+    (see the Makefile).  Each message is logged with BINLOG or LOG, and
+    also formatted with the host printf, so 'make test' can check that
+    the decoder gives the same text.  Only conversions that both printf
+    implementations handle the same way are used.
+
+    Writes binlogdemo.bin (raw records), binlogdemo.hex (the same records
+    as the 'lg' CLI command sends them) and binlogdemo.txt (expected
+    output).
+*/
+
+#include <stdio.h>
+
+#define LOG_ENABLE
+#include "projectconfig.h"
+#include "log.h"
+
+static FILE     *expected;
+static uint32_t  ticks;
+
+uint32_t delayGetTicks(void) { return ticks += 7; }
+
+/* Logs a message on the device side and writes the expected text */
+#define DEMO(format, ...) \
+        do{\
+          BINLOG(format, ##__VA_ARGS__);\
+          fprintf(expected, format, ##__VA_ARGS__);\
+        } while(0)
+
+/* Same for LOG, both on the same line so __LINE__ matches */
+#define DEMO_LOG(format, ...) \
+        do{ LOG(format, __VA_ARGS__) fprintf(expected, LOG_MESSAGE format "%s", LOG_FUNC, LOG_LINE, __VA_ARGS__, CFG_PRINTF_NEWLINE); } while(0)
+
+static const char *names[] = { "accel", "gyro", "mag" };
+
+static void sample(uint32_t i)
+{
+  DEMO_LOG("%s sample %u", names[i % 3], i);
+}
+
+int main(void)
+{
+  uint8_t  block[4 * (BINLOG_HEADERWORDS + BINLOG_MAXARGS)];
+  uint16_t len, i;
+  FILE    *bin, *hex;
+  int8_t   temperature = -12;
+  float    volts = 3.25F;
+
+  expected = fopen("binlogdemo.txt", "w");
+  bin = fopen("binlogdemo.bin", "wb");
+  hex = fopen("binlogdemo.hex", "w");
+  if (!expected || !bin || !hex)
+  {
+    return 1;
+  }
+
+  binlogInit();
+
+  DEMO("Booting%s", CFG_PRINTF_NEWLINE);
+  DEMO("Temperature: %d C, supply: %f V%s", temperature, volts, CFG_PRINTF_NEWLINE);
+  DEMO("Status 0x%08X, flags %x, mode '%c'%s", 0xC0FFEEu, 0x1Fu, 'A', CFG_PRINTF_NEWLINE);
+  DEMO("%5d|%-5d|%05u%s", -42, 42, 42u, CFG_PRINTF_NEWLINE);
+  DEMO("Split ");
+  DEMO("line %d%s", 2, CFG_PRINTF_NEWLINE);
+  for (i = 0; i < 4; i++)
+  {
+    sample(i);
+  }
+  DEMO("%d %d %d %d %d %d %d %d %d %d %d%s", 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, CFG_PRINTF_NEWLINE);
+  DEMO("Gain %.2f, offset %.3f%s", 1.5F, -0.125F, CFG_PRINTF_NEWLINE);
+
+  // The 'lg' command output, with a prompt and some other lines around it
+  fprintf(hex, "CMD > lg%s", CFG_PRINTF_NEWLINE);
+  while ((len = binlogRead(block, sizeof(block))))
+  {
+    fwrite(block, 1, len, bin);
+    fprintf(hex, "~");
+    for (i = 0; i < len; i++)
+    {
+      fprintf(hex, "%02X", block[i]);
+    }
+    fprintf(hex, "%s", CFG_PRINTF_NEWLINE);
+  }
+  fprintf(hex, "CMD > %s", CFG_PRINTF_NEWLINE);
+
+  fclose(expected);
+  fclose(bin);
+  fclose(hex);
+
+  return 0;
+}
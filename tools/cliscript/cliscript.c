@@ -0,0 +1,244 @@
+/**************************************************************************/
+/*!
+    @file     cliscript.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Runs CLI scripts on the host against the simulator board
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+/*  The CLI, the script runner and the eeprom commands are compiled from
+    the firmware sources with the simulator board settings (see the
+    Makefile).  EEPROM is simulated in RAM and can be loaded from and
+    saved to an image file, so a provisioning script can be stored with
+    '-s', run as the boot script with '-b', and checked by a second run
+    that reads the values back.
+
+    Usage: cliscript [-e <image>] [-s <script>] [-b] [<script> ...]
+
+      -e <image>   Load/save the simulated EEPROM from/to this file
+      -s <script>  Store a script at CFG_INTERFACE_SCRIPT_EEADDR
+      -b           Run the script stored in EEPROM, as cliScriptRunBoot does
+
+    The exit code is the number of failed lines in the last script that
+    was run, or 255 if a script couldn't be opened or stored.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "projectconfig.h"
+#include "cli/cli.h"
+#include "cli/cli_script.h"
+
+static uint8_t eeprom[CFG_EEPROM_SIZE];
+
+/**************************************************************************/
+/*!
+    @brief  cli_script_read_t callback for host files
+*/
+/**************************************************************************/
+static uint16_t readHostFile(void *source, uint32_t offset, char *buffer, uint16_t len)
+{
+  FILE *f = (FILE *) source;
+
+  if (fseek(f, offset, SEEK_SET))
+  {
+    return 0;
+  }
+
+  return (uint16_t) fread(buffer, 1, len, f);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Reads a whole script file into a NULL-terminated buffer
+*/
+/**************************************************************************/
+static char * loadScript(const char *path)
+{
+  FILE *f = fopen(path, "rb");
+  if (f == NULL)
+  {
+    return NULL;
+  }
+
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+
+  char *script = malloc(size + 1);
+  if (script != NULL)
+  {
+    script[fread(script, 1, size, f)] = 0;
+  }
+  fclose(f);
+
+  return script;
+}
+
+int main(int argc, char *argv[])
+{
+  const char *image = NULL;
+  const char *store = NULL;
+  int boot = 0;
+  int opt;
+  int result = 0;
+
+  while ((opt = getopt(argc, argv, "e:s:b")) != -1)
+  {
+    switch (opt)
+    {
+      case 'e': image = optarg; break;
+      case 's': store = optarg; break;
+      case 'b': boot = 1;       break;
+      default:
+        fprintf(stderr, "Usage: %s [-e <image>] [-s <script>] [-b] [<script> ...]\n", argv[0]);
+        return 255;
+    }
+  }
+
+  /* Erased EEPROM, unless an image was saved by a previous run */
+  memset(eeprom, 0xFF, sizeof(eeprom));
+  if (image != NULL)
+  {
+    FILE *f = fopen(image, "rb");
+    if (f != NULL)
+    {
+      fread(eeprom, 1, sizeof(eeprom), f);
+      fclose(f);
+    }
+  }
+
+  cliInit();
+
+  if (store != NULL)
+  {
+    char *script = loadScript(store);
+    err_t error = script ? cliScriptWriteEEPROM(CFG_INTERFACE_SCRIPT_EEADDR,
+                                                CFG_INTERFACE_SCRIPT_EESIZE, script)
+                         : ERROR_CLI_SCRIPTNOTFOUND;
+    free(script);
+    if (error)
+    {
+      fprintf(stderr, "Unable to store '%s' (error 0x%04X)\n", store, error);
+      return 255;
+    }
+  }
+
+  if (boot)
+  {
+    cli_script_stats_t stats;
+    printf("== Boot script ==%s", CFG_PRINTF_NEWLINE);
+    memset(&stats, 0, sizeof(stats));
+    cliScriptRunEEPROM(CFG_INTERFACE_SCRIPT_EEADDR, CFG_INTERFACE_SCRIPT_EESIZE, &stats);
+    result = stats.errors;
+  }
+
+  for ( ; optind < argc; optind++)
+  {
+    cli_script_stats_t stats;
+    FILE *f = fopen(argv[optind], "rb");
+    if (f == NULL)
+    {
+      fprintf(stderr, "Unable to open '%s'\n", argv[optind]);
+      return 255;
+    }
+
+    printf("== %s ==%s", argv[optind], CFG_PRINTF_NEWLINE);
+    memset(&stats, 0, sizeof(stats));
+    cliScriptRun(readHostFile, f, &stats);
+    fclose(f);
+    result = stats.errors;
+  }
+
+  if (image != NULL)
+  {
+    FILE *f = fopen(image, "wb");
+    if (f != NULL)
+    {
+      fwrite(eeprom, 1, sizeof(eeprom), f);
+      fclose(f);
+    }
+  }
+
+  return result;
+}
+
+/**************************************************************************/
+/*
+    Simulator board stubs for the HAL functions used by the CLI
+*/
+/**************************************************************************/
+err_t readEEPROM(uint8_t* eeAddress, uint8_t* buffAddress, uint32_t byteCount)
+{
+  uintptr_t addr = (uintptr_t) eeAddress;
+  ASSERT(addr + byteCount <= CFG_EEPROM_SIZE, ERROR_ADDRESSOUTOFRANGE);
+  memcpy(buffAddress, &eeprom[addr], byteCount);
+  return ERROR_NONE;
+}
+
+err_t writeEEPROM(uint8_t* eeAddress, uint8_t* buffAddress, uint32_t byteCount)
+{
+  uintptr_t addr = (uintptr_t) eeAddress;
+  ASSERT(addr + byteCount <= CFG_EEPROM_SIZE, ERROR_ADDRESSOUTOFRANGE);
+  memcpy(&eeprom[addr], buffAddress, byteCount);
+  return ERROR_NONE;
+}
+
+uint32_t delayGetTicks(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t) (ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+void printfFlush(void)
+{
+  fflush(stdout);
+}
+
+void cmd_sysinfo(uint8_t argc, char **argv)
+{
+  printf("%-25s : %s%s", "Board", "Simulator", CFG_PRINTF_NEWLINE);
+  printf("%-25s : %d bytes%s", "EEPROM", CFG_EEPROM_SIZE, CFG_PRINTF_NEWLINE);
+}
+
+void cmd_dbg_memrd(uint8_t argc, char **argv)
+{
+  printf("Memory reads aren't supported by the simulator%s", CFG_PRINTF_NEWLINE);
+  cliSetError(ERROR_UNEXPECTEDVALUE);
+}
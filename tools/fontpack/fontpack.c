@@ -0,0 +1,536 @@
+/**************************************************************************/
+/*!
+    @file     fontpack.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Generates run-length encoded (AAFONTS_ENCODING_RLE) copies
+              of the anti-aliased fonts, and reports their size and
+              decode speed
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+*/
+/**************************************************************************/
+
+/*  Every raw AA2/AA4 font is linked in (see the Makefile) and encoded
+    glyph by glyph, using the format described in aafonts.c.  Each glyph
+    is then drawn with aafontsDrawString from both the raw and the RLE
+    font, into a host implementation of the lcd.h window functions, to
+    check that the pixels are identical and to time the decoders.
+
+    Usage: fontpack [-o <dir>] [-n <iterations>]
+
+      -o   Writes <font>_RLE.c and <font>_RLE.h for every font into the
+           aa2 or aa4 subdirectory of <dir> (normally
+           src/drivers/displays/graphic/aafonts)
+      -n   Number of times every glyph is drawn for the timings
+           (default 1000)
+
+    The report (CSV) lists the glyph data size of the raw and the RLE
+    font, and the time to draw one glyph with each.  The character table
+    and the aafontsFont_t are the same size in both.  The exit code is
+    the number of fonts whose RLE glyphs differ from the raw ones.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "projectconfig.h"
+#include "drivers/displays/graphic/lcd.h"
+#include "drivers/displays/graphic/aafonts.h"
+#include "drivers/displays/graphic/aafonts/aa2/DejaVuSansCondensed14_AA2.h"
+#include "drivers/displays/graphic/aafonts/aa2/DejaVuSansCondensedBold14_AA2.h"
+#include "drivers/displays/graphic/aafonts/aa2/DejaVuSansMono10_AA2.h"
+#include "drivers/displays/graphic/aafonts/aa2/DejaVuSansMono13_AA2.h"
+#include "drivers/displays/graphic/aafonts/aa2/DejaVuSansMono14_AA2.h"
+#include "drivers/displays/graphic/aafonts/aa2/FontCalibri18_AA2.h"
+#include "drivers/displays/graphic/aafonts/aa2/FontCalibriBold18_AA2.h"
+#include "drivers/displays/graphic/aafonts/aa2/FontCalibriItalic18_AA2.h"
+#include "drivers/displays/graphic/aafonts/aa2/FontFranklinGothicBold99_Numbers_AA2.h"
+#include "drivers/displays/graphic/aafonts/aa4/FontCalibri18_AA4.h"
+
+typedef struct
+{
+  const char          *name;
+  const aafontsFont_t *font;
+} fontpackFont_t;
+
+#define FONT(f)   { #f, &f }
+
+static const fontpackFont_t fonts[] =
+{
+  FONT(DejaVuSansCondensed14_AA2),
+  FONT(DejaVuSansCondensedBold14_AA2),
+  FONT(DejaVuSansMono10_AA2),
+  FONT(DejaVuSansMono13_AA2),
+  FONT(DejaVuSansMono14_AA2),
+  FONT(FontCalibri18_AA2),
+  FONT(FontCalibriBold18_AA2),
+  FONT(FontCalibriItalic18_AA2),
+  FONT(FontFranklinGothicBold99_Numbers_AA2),
+  FONT(FontCalibri18_AA4),
+};
+
+/**************************************************************************/
+/*                                                                        */
+/* ------- lcd.h window functions, recording the streamed pixels -------- */
+/*                                                                        */
+/**************************************************************************/
+
+#define CAPTURE_SIZE  (256 * 256)
+
+static uint16_t *capture;       // Pixels streamed since the last reset,
+static uint32_t  captured;      // or NULL to only count them
+
+uint16_t lcdGetWidth(void)  { return 0xFFFF; }
+uint16_t lcdGetHeight(void) { return 0xFFFF; }
+
+void lcdSetWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+}
+
+void lcdStreamPixels(const uint16_t *data, uint32_t len)
+{
+  if (capture && (captured + len <= CAPTURE_SIZE))
+  {
+    memcpy(&capture[captured], data, len * sizeof(uint16_t));
+  }
+  captured += len;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/* ----------------------------- Encoder -------------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Returns pixel i of a raw glyph, counting left to right and
+            top to bottom
+*/
+/**************************************************************************/
+static uint8_t rawPixel(const aafontsFont_t *font, const aafontsCharInfo_t *c, uint32_t i)
+{
+  uint32_t row = i / c->width;
+  uint32_t col = i % c->width;
+  uint8_t  bits = font->fontType;
+  uint8_t  perByte = 8 / bits;
+  uint8_t  byte = c->charData[row * c->bytesPerRow + col / perByte];
+
+  return (byte >> (8 - bits - (col % perByte) * bits)) & ((1 << bits) - 1);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Encodes one glyph, with runs of at least minRun pixels of the
+            bg or fore color, and literals for everything else
+
+    @return The number of bytes written to out
+*/
+/**************************************************************************/
+static uint32_t encodeGlyphRun(const aafontsFont_t *font, const aafontsCharInfo_t *c,
+                               uint32_t minRun, uint8_t *out)
+{
+  uint32_t total = c->width * font->fontHeight;
+  uint8_t  bits = font->fontType;
+  uint8_t  max = (1 << bits) - 1;
+  uint32_t i = 0, len = 0, run, litStart = 0, litCount = 0, k;
+  uint8_t  value = 0;
+
+  while ((i < total) || litCount)
+  {
+    run = 0;
+    if (i < total)
+    {
+      value = rawPixel(font, c, i);
+      if ((value == 0) || (value == max))
+      {
+        while ((i + run < total) && (run < 64) && (rawPixel(font, c, i + run) == value)) run++;
+      }
+    }
+
+    // Close the literal before a run, at the end and when it is full
+    if (litCount && ((run >= minRun) || (i == total) || (litCount == 128)))
+    {
+      out[len++] = litCount - 1;
+      for (k = 0; k < litCount; k++)
+      {
+        if ((k * bits) % 8 == 0) out[len++] = 0;
+        out[len - 1] |= rawPixel(font, c, litStart + k) << (8 - bits - (k * bits) % 8);
+      }
+      litCount = 0;
+    }
+
+    if (i == total) break;
+
+    if (run >= minRun)
+    {
+      out[len++] = (value ? 0xC0 : 0x80) | (run - 1);
+      i += run;
+    }
+    else
+    {
+      if (litCount == 0) litStart = i;
+      litCount++;
+      i++;
+    }
+  }
+
+  return len;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Encodes one glyph with the shortest of the minimum run lengths
+*/
+/**************************************************************************/
+static uint32_t encodeGlyph(const aafontsFont_t *font, const aafontsCharInfo_t *c, uint8_t *out)
+{
+  static uint8_t trial[CAPTURE_SIZE];
+  uint32_t minRun, len, best = 0xFFFFFFFF;
+
+  for (minRun = 1; minRun <= 8; minRun++)
+  {
+    len = encodeGlyphRun(font, c, minRun, trial);
+    if (len < best)
+    {
+      best = len;
+      memcpy(out, trial, len);
+    }
+  }
+
+  return best;
+}
+
+/**************************************************************************/
+/*!
+    @brief  An RLE copy of a font, built in memory
+*/
+/**************************************************************************/
+typedef struct
+{
+  aafontsFont_t      font;
+  aafontsCharInfo_t *charTable;
+  uint32_t          *offsets;       // Offset of each glyph in data
+  uint8_t           *data;
+  uint32_t           dataSize;
+  uint32_t           rawSize;       // Glyph data size of the raw font
+} packedFont_t;
+
+static void packFont(const aafontsFont_t *raw, packedFont_t *packed)
+{
+  uint32_t glyphs = raw->lastChar - raw->firstChar + 1;
+  uint32_t i;
+
+  packed->charTable = calloc(glyphs, sizeof(aafontsCharInfo_t));
+  packed->offsets = calloc(glyphs, sizeof(uint32_t));
+  packed->data = malloc(CAPTURE_SIZE * glyphs);
+  packed->dataSize = 0;
+  packed->rawSize = 0;
+
+  for (i = 0; i < glyphs; i++)
+  {
+    const aafontsCharInfo_t *c = &raw->charTable[i];
+
+    packed->offsets[i] = packed->dataSize;
+    packed->dataSize += encodeGlyph(raw, c, &packed->data[packed->dataSize]);
+    packed->rawSize += c->bytesPerRow * raw->fontHeight;
+    packed->charTable[i].width = c->width;
+    packed->charTable[i].bytesPerRow = 0;
+  }
+
+  // Only set the pointers once the data has stopped moving
+  for (i = 0; i < glyphs; i++)
+  {
+    packed->charTable[i].charData = &packed->data[packed->offsets[i]];
+  }
+
+  packed->font = *raw;
+  packed->font.charTable = packed->charTable;
+  packed->font.encoding = AAFONTS_ENCODING_RLE;
+}
+
+static void freeFont(packedFont_t *packed)
+{
+  free(packed->charTable);
+  free(packed->offsets);
+  free(packed->data);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/* -------------------------- Checks and timing ------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+/**************************************************************************/
+/*!
+    @brief  Draws every glyph of both fonts and compares the pixels
+
+    @return The number of glyphs that differ
+*/
+/**************************************************************************/
+static uint32_t compareFonts(const aafontsFont_t *raw, const aafontsFont_t *rle)
+{
+  static uint16_t expected[CAPTURE_SIZE], actual[CAPTURE_SIZE];
+  uint32_t expectedCount, errors = 0;
+  uint16_t ch;
+  char str[2] = { 0, 0 };
+
+  for (ch = raw->firstChar; ch <= raw->lastChar; ch++)
+  {
+    str[0] = (char) ch;
+
+    capture = expected;
+    captured = 0;
+    aafontsDrawString(0, 0, COLORTABLE_AA4_WHITEONBLACK, raw, str);
+    expectedCount = captured;
+
+    capture = actual;
+    captured = 0;
+    aafontsDrawString(0, 0, COLORTABLE_AA4_WHITEONBLACK, rle, str);
+
+    if ((captured != expectedCount) ||
+        memcmp(expected, actual, captured * sizeof(uint16_t)))
+    {
+      errors++;
+    }
+  }
+
+  capture = NULL;
+  return errors;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Returns the time in ns to draw one glyph of the font
+*/
+/**************************************************************************/
+static double timeFont(const aafontsFont_t *font, uint32_t iterations)
+{
+  struct timespec start, end;
+  uint32_t i, glyphs = font->lastChar - font->firstChar + 1;
+  uint16_t ch;
+  char str[2] = { 0, 0 };
+
+  capture = NULL;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (i = 0; i < iterations; i++)
+  {
+    for (ch = font->firstChar; ch <= font->lastChar; ch++)
+    {
+      str[0] = (char) ch;
+      aafontsDrawString(0, 0, COLORTABLE_AA4_WHITEONBLACK, font, str);
+    }
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  return ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) /
+         ((double) iterations * glyphs);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/* ------------------------------ Output -------------------------------- */
+/*                                                                        */
+/**************************************************************************/
+
+static const char *license =
+  "    @section LICENSE\n"
+  "\n"
+  "    Software License Agreement (BSD License)\n"
+  "\n"
+  "    Copyright (c) 2013, K. Townsend (microBuilder.eu)\n"
+  "    All rights reserved.\n"
+  "\n"
+  "    Redistribution and use in source and binary forms, with or without\n"
+  "    modification, are permitted provided that the following conditions are met:\n"
+  "    1. Redistributions of source code must retain the above copyright\n"
+  "    notice, this list of conditions and the following disclaimer.\n"
+  "    2. Redistributions in binary form must reproduce the above copyright\n"
+  "    notice, this list of conditions and the following disclaimer in the\n"
+  "    documentation and/or other materials provided with the distribution.\n"
+  "    3. Neither the name of the copyright holders nor the\n"
+  "    names of its contributors may be used to endorse or promote products\n"
+  "    derived from this software without specific prior written permission.\n"
+  "\n"
+  "    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY\n"
+  "    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED\n"
+  "    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE\n"
+  "    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY\n"
+  "    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES\n"
+  "    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;\n"
+  "    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND\n"
+  "    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT\n"
+  "    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS\n"
+  "    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.\n";
+
+static void writeHeader(FILE *f, const char *name, const char *ext)
+{
+  fprintf(f, "/**************************************************************************/\n"
+             "/*!\n"
+             "    @file     %s_RLE.%s\n"
+             "    @author   K. Townsend (microBuilder.eu)\n"
+             "\n"
+             "    @brief    Run-length encoded copy of %s, generated\n"
+             "              by tools/fontpack (do not edit)\n"
+             "\n"
+             "%s"
+             "*/\n"
+             "/**************************************************************************/\n",
+          name, ext, name, license);
+}
+
+// One line of the aafontsFont_t initialiser, with the comments aligned
+#define writeField(f, fmt, value, comment)                        \
+  do {                                                            \
+    char _field[128];                                             \
+    snprintf(_field, sizeof(_field), fmt ",", value);             \
+    fprintf(f, "  %-37s /* %s */\n", _field, comment);            \
+  } while (0)
+
+static int writeFont(const char *dir, const char *name, const aafontsFont_t *raw,
+                     const packedFont_t *packed)
+{
+  char path[512];
+  const char *subdir = (raw->fontType == AAFONTS_FONTTYPE_AA4) ? "aa4" : "aa2";
+  uint32_t glyphs = raw->lastChar - raw->firstChar + 1;
+  uint32_t i, j, end;
+  FILE *f;
+
+  // Header
+  snprintf(path, sizeof(path), "%s/%s/%s_RLE.h", dir, subdir, name);
+  f = fopen(path, "w");
+  if (!f) return -1;
+  writeHeader(f, name, "h");
+  fprintf(f, "#ifndef __%s_RLE_H__\n"
+             "#define __%s_RLE_H__\n"
+             "\n"
+             "#ifdef __cplusplus\n"
+             "extern \"C\" {\n"
+             "#endif\n"
+             "\n"
+             "#include \"projectconfig.h\"\n"
+             "#include \"drivers/displays/graphic/aafonts.h\"\n"
+             "\n"
+             "extern aafontsFont_t %s_RLE;\n"
+             "\n"
+             "#ifdef __cplusplus\n"
+             "}\n"
+             "#endif \n"
+             "\n"
+             "#endif\n",
+          name, name, name);
+  fclose(f);
+
+  // Glyph data, character table and font
+  snprintf(path, sizeof(path), "%s/%s/%s_RLE.c", dir, subdir, name);
+  f = fopen(path, "w");
+  if (!f) return -1;
+  writeHeader(f, name, "c");
+  fprintf(f, "#include \"%s_RLE.h\"\n\n", name);
+  fprintf(f, "/* %u bytes of glyph data, against %u for %s */\n",
+          packed->dataSize, packed->rawSize, name);
+  fprintf(f, "const uint8_t Font%s_RLE[%u] = {\n", name, packed->dataSize);
+  for (i = 0; i < glyphs; i++)
+  {
+    end = (i + 1 < glyphs) ? packed->offsets[i + 1] : packed->dataSize;
+    fprintf(f, "  /* code %04X */", raw->firstChar + i);
+    for (j = packed->offsets[i]; j < end; j++)
+    {
+      if ((j - packed->offsets[i]) % 12 == 0) fprintf(f, "\n ");
+      fprintf(f, " 0x%02X%s", packed->data[j], (j + 1 < packed->dataSize) ? "," : "");
+    }
+    fprintf(f, "\n");
+  }
+  fprintf(f, "};\n\n");
+
+  fprintf(f, "const aafontsCharInfo_t charTable_%s_RLE[%u] = {\n", name, glyphs);
+  for (i = 0; i < glyphs; i++)
+  {
+    fprintf(f, "  { %3u,   0, &Font%s_RLE[%5u] }%s /* code %04X */\n",
+            packed->charTable[i].width, name, packed->offsets[i],
+            (i + 1 < glyphs) ? "," : " ", raw->firstChar + i);
+  }
+  fprintf(f, "};\n\n");
+
+  fprintf(f, "aafontsFont_t %s_RLE = \n{\n", name);
+  writeField(f, "%s", (raw->fontType == AAFONTS_FONTTYPE_AA4) ? "AAFONTS_FONTTYPE_AA4" : "AAFONTS_FONTTYPE_AA2",
+             "Font type (anti-aliasing level)");
+  writeField(f, "%u", raw->fontHeight, "Font height in pixels");
+  writeField(f, "%u", raw->unknownCharWidth, "Width to insert for unknown characters");
+  writeField(f, "%u", raw->heightUpperCase, "Height of upper-case characters");
+  writeField(f, "%u", raw->heightLowerCase, "Height of lower-case characters");
+  writeField(f, "%u", raw->baseline, "Font baseline");
+  writeField(f, "0x%04X", raw->firstChar, "Unicode address of first character");
+  writeField(f, "0x%04X", raw->lastChar, "Unicode address of last character");
+  writeField(f, "&charTable_%s_RLE[0]", name, "Font char data");
+  fprintf(f, "  %-37s /* Glyph data encoding */\n};\n", "AAFONTS_ENCODING_RLE");
+  fclose(f);
+
+  return 0;
+}
+
+int main(int argc, char *argv[])
+{
+  const char *outdir = NULL;
+  uint32_t iterations = 1000;
+  uint32_t i, errors, failures = 0;
+  packedFont_t packed;
+  double rawNs, rleNs;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "o:n:")) != -1)
+  {
+    switch (opt)
+    {
+      case 'o':
+        outdir = optarg;
+        break;
+      case 'n':
+        iterations = strtoul(optarg, NULL, 0);
+        break;
+      default:
+        fprintf(stderr, "Usage: %s [-o <dir>] [-n <iterations>]\n", argv[0]);
+        return -1;
+    }
+  }
+
+  printf("font,type,glyphs,raw_bytes,rle_bytes,saving_pct,raw_ns_per_glyph,rle_ns_per_glyph,result\n");
+
+  for (i = 0; i < sizeof(fonts) / sizeof(fonts[0]); i++)
+  {
+    packFont(fonts[i].font, &packed);
+
+    errors = compareFonts(fonts[i].font, &packed.font);
+    if (errors) failures++;
+
+    rawNs = timeFont(fonts[i].font, iterations);
+    rleNs = timeFont(&packed.font, iterations);
+
+    printf("%s,AA%u,%u,%u,%u,%.1f,%.0f,%.0f,%s\n",
+           fonts[i].name, fonts[i].font->fontType,
+           fonts[i].font->lastChar - fonts[i].font->firstChar + 1,
+           packed.rawSize, packed.dataSize,
+           100.0 * (1.0 - (double) packed.dataSize / packed.rawSize),
+           rawNs, rleNs, errors ? "FAIL" : "ok");
+
+    if (outdir && !errors && writeFont(outdir, fonts[i].name, fonts[i].font, &packed))
+    {
+      fprintf(stderr, "Can't write %s to %s\n", fonts[i].name, outdir);
+      failures++;
+    }
+
+    freeFont(&packed);
+  }
+
+  return failures;
+}
@@ -0,0 +1,215 @@
+/**************************************************************************/
+/*!
+    @file     isrtrace2json.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Converts the output of the 'it dump' CLI command (see
+              core/isrtrace) to a Chrome trace
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+/*  Usage: isrtrace2json [-c <clock>] [<capture>] > trace.json
+
+      -c <clock>   Tick frequency in Hz, if the capture doesn't start with
+                   the 'T clock' line
+
+    The capture (stdin by default) is the output of one 'it dump' command.
+    Lines that don't start with 'T ' (the command echo, the prompt, other
+    output) are ignored.  Each handler entry/exit becomes a 'B'/'E' event,
+    so nested handlers are drawn on top of the one they preempted.  Open
+    the output in chrome://tracing (or ui.perfetto.dev).
+
+    Exits without a matching entry (the ring had already overwritten it)
+    are skipped, and the 32-bit tick counter is unwrapped, so captures can
+    be longer than one counter period as long as there are no gaps of more
+    than 2^32 ticks between events.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define MAXDEPTH  (32)
+
+/* Exception names, with the LPC13U IRQ names (the LPC11U numbering is
+   the same, ex. PIN_INT0 is FLEX_INT0 and CT16B0 is TIMER16_0) */
+static const char *exceptionNames[48] =
+{
+  [2]  = "NMI",
+  [3]  = "HardFault",
+  [11] = "SVCall",
+  [14] = "PendSV",
+  [15] = "SysTick",
+  [16] = "PIN_INT0",
+  [17] = "PIN_INT1",
+  [18] = "PIN_INT2",
+  [19] = "PIN_INT3",
+  [20] = "PIN_INT4",
+  [21] = "PIN_INT5",
+  [22] = "PIN_INT6",
+  [23] = "PIN_INT7",
+  [24] = "GINT0",
+  [25] = "GINT1",
+  [28] = "RIT",
+  [30] = "SSP1",
+  [31] = "I2C",
+  [32] = "CT16B0",
+  [33] = "CT16B1",
+  [34] = "CT32B0",
+  [35] = "CT32B1",
+  [36] = "SSP0",
+  [37] = "USART",
+  [38] = "USB_IRQ",
+  [39] = "USB_FIQ",
+  [40] = "ADC",
+  [41] = "WDT",
+  [42] = "BOD",
+  [43] = "FLASH",
+  [46] = "USBWAKEUP",
+};
+
+static void printName(unsigned int exception)
+{
+  if (exception < 48 && exceptionNames[exception])
+  {
+    printf("%s", exceptionNames[exception]);
+  }
+  else
+  {
+    printf("IRQ%d", (int) exception - 16);
+  }
+}
+
+static void printEvent(unsigned int exception, char phase, uint64_t ticks,
+                       uint32_t clock, int *first)
+{
+  printf("%s\n{\"name\":\"", *first ? "" : ",");
+  printName(exception);
+  printf("\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":1}",
+         phase, (double) ticks * 1000000.0 / clock);
+  *first = 0;
+}
+
+int main(int argc, char **argv)
+{
+  FILE         *in = stdin;
+  char          line[128];
+  uint32_t      clock = 0;
+  uint32_t      last = 0;
+  uint64_t      ticks = 0;
+  unsigned int  stack[MAXDEPTH];
+  int           depth = 0;
+  int           started = 0;
+  int           first = 1;
+  int           i;
+
+  for (i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-c") && i + 1 < argc)
+    {
+      clock = strtoul(argv[++i], NULL, 0);
+    }
+    else if (argv[i][0] == '-')
+    {
+      fprintf(stderr, "Usage: isrtrace2json [-c <clock>] [<capture>]\n");
+      return 1;
+    }
+    else if ((in = fopen(argv[i], "r")) == NULL)
+    {
+      fprintf(stderr, "Can't open %s\n", argv[i]);
+      return 1;
+    }
+  }
+
+  printf("{\"traceEvents\":[");
+
+  while (fgets(line, sizeof(line), in))
+  {
+    unsigned long  timestamp;
+    unsigned int   exception;
+    char           type;
+
+    if (!strncmp(line, "T clock ", 8))
+    {
+      clock = strtoul(line + 8, NULL, 10);
+      continue;
+    }
+    if (sscanf(line, "T %lu %c %u", &timestamp, &type, &exception) != 3)
+    {
+      continue;
+    }
+    if (!clock)
+    {
+      fprintf(stderr, "No 'T clock' line in the capture, use -c\n");
+      return 1;
+    }
+
+    // Unwrap the 32-bit counter, and start the timeline at 0
+    if (!started)
+    {
+      started = 1;
+      last = (uint32_t) timestamp;
+    }
+    ticks += (uint32_t) ((uint32_t) timestamp - last);
+    last = (uint32_t) timestamp;
+
+    if (type == 'E')
+    {
+      if (depth < MAXDEPTH)
+      {
+        stack[depth] = exception;
+      }
+      depth++;
+      printEvent(exception, 'B', ticks, clock, &first);
+    }
+    else if (type == 'X')
+    {
+      // Skip the exits of handlers that were entered before the capture
+      if (depth == 0 || (depth <= MAXDEPTH && stack[depth - 1] != exception))
+      {
+        continue;
+      }
+      depth--;
+      printEvent(exception, 'E', ticks, clock, &first);
+    }
+  }
+
+  printf("\n]}\n");
+
+  if (in != stdin)
+  {
+    fclose(in);
+  }
+
+  return 0;
+}
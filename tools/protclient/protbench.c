@@ -0,0 +1,291 @@
+/**************************************************************************/
+/*!
+    @file     protbench.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Protocol latency/throughput benchmark and regression tests
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+/*  Usage: protbench [-n iterations] [--usb]
+
+    By default the commands are executed by the simulated device (the
+    firmware protocol code linked into this program), and the result of
+    each command is checked, so 'make test' can be used as a regression
+    test on any host.  With --usb (build with 'make usb') the same
+    benchmarks run against a real board.
+
+    The program returns the number of failed checks.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "protclient.h"
+#include "protclient_sim.h"
+#ifdef PROTBENCH_USB
+  #include "protclient_usb.h"
+#endif
+
+/* Command IDs and error codes from the firmware (prot_cmdtable.h, errors.h) */
+#define CMD_LED                       (0x0001)
+#define CMD_SYSINFO                   (0x0002)
+#define SYSINFO_KEY_CODEBASE_VERSION  (0x0001)
+#define ERROR_INVALIDPARAMETER        (0x0004)
+#define ERROR_PROT_INVALIDCOMMANDID   (0x0122)
+#define ERROR_PROT_INVALIDPAYLOAD     (0x0123)
+
+static protclient_t client;
+static bool         simulated = true;
+static int          failures;
+
+#define CHECK(cond, msg) \
+  do { if (!(cond)) { printf("FAIL: %s (line %d)\n", msg, __LINE__); failures++; } } while(0)
+
+/* Async completion callback, counts successful replies */
+static void count_done(void * ctx, protclient_result_t const * p_result)
+{
+  if (PROTCLIENT_OK == p_result->status)
+  {
+    (*(uint32_t *) ctx)++;
+  }
+}
+
+/**************************************************************************/
+/*!
+    Functional checks (the LED state can only be checked when simulated)
+*/
+/**************************************************************************/
+static void run_checks(void)
+{
+  protclient_result_t result;
+  uint8_t             payload[4];
+
+  payload[0] = 1;
+  CHECK(PROTCLIENT_OK == protclient_call(&client, CMD_LED, payload, 1, &result), "LED on");
+  CHECK(!simulated || protsim_led(), "LED state on");
+
+  payload[0] = 0;
+  CHECK(PROTCLIENT_OK == protclient_call(&client, CMD_LED, payload, 1, &result), "LED off");
+  CHECK(!simulated || !protsim_led(), "LED state off");
+
+  /* Payload lengths outside the command table limits are rejected before the handler runs */
+  CHECK(PROTCLIENT_ERR_DEVICE == protclient_call(&client, CMD_LED, payload, 2, &result), "LED invalid length");
+  CHECK(ERROR_PROT_INVALIDPAYLOAD == result.error_id, "LED invalid length error");
+
+  payload[0] = SYSINFO_KEY_CODEBASE_VERSION & 0xFF;
+  payload[1] = SYSINFO_KEY_CODEBASE_VERSION >> 8;
+  CHECK(PROTCLIENT_OK == protclient_call(&client, CMD_SYSINFO, payload, 2, &result), "SYSINFO version");
+  CHECK(3 == result.length && CMD_SYSINFO == result.cmd_id, "SYSINFO version length");
+
+  payload[0] = 0xFF;
+  payload[1] = 0xFF;
+  CHECK(PROTCLIENT_ERR_DEVICE == protclient_call(&client, CMD_SYSINFO, payload, 2, &result), "SYSINFO invalid key");
+  CHECK(ERROR_INVALIDPARAMETER == result.error_id, "SYSINFO invalid key error");
+
+  CHECK(PROTCLIENT_ERR_DEVICE == protclient_call(&client, 0x00FF, NULL, 0, &result), "Unknown command");
+  CHECK(ERROR_PROT_INVALIDCOMMANDID == result.error_id, "Unknown command error");
+
+  CHECK(PROTCLIENT_ERR_PARAM == protclient_call(&client, CMD_LED, payload, PROTCLIENT_MAX_PAYLOAD+1, &result),
+        "Payload too large");
+
+  /* Several commands in one batch, the last one is invalid */
+  {
+    uint32_t ok = 0;
+    uint8_t  led_on[1] = { 1 };
+
+    protclient_set_batching(&client, true);
+    protclient_submit(&client, CMD_LED, led_on, 1, count_done, &ok);
+    protclient_submit(&client, CMD_LED, led_on, 1, count_done, &ok);
+    protclient_submit(&client, 0x00FF, NULL, 0, NULL, NULL);
+    protclient_flush(&client);
+    protclient_set_batching(&client, false);
+
+    CHECK(2 == ok, "Batched LED commands");
+    CHECK(!simulated || protsim_led(), "Batched LED state");
+  }
+}
+
+/**************************************************************************/
+/*!
+    Blocking calls, one command in flight at a time
+*/
+/**************************************************************************/
+static void bench_sync(uint32_t iterations)
+{
+  protclient_result_t result;
+  uint8_t             payload[1];
+  uint32_t            start, elapsed, i, ok = 0;
+
+  start = protclient_millis();
+  for (i = 0; i < iterations; i++)
+  {
+    payload[0] = i & 1;
+    if (PROTCLIENT_OK == protclient_call(&client, CMD_LED, payload, 1, &result))
+    {
+      ok++;
+    }
+  }
+  elapsed = protclient_millis() - start;
+
+  CHECK(ok == iterations, "Sync calls");
+  printf("sync  : %u LED commands in %u ms (%.2f us/command, %.0f commands/s)\n",
+         iterations, elapsed, elapsed * 1000.0 / iterations,
+         elapsed ? iterations * 1000.0 / elapsed : 0.0);
+}
+
+/**************************************************************************/
+/*!
+    Pipelined calls, keeping no more commands in flight than the device
+    can queue (PROTCLIENT_DEVICE_QUEUE_DEPTH), either one command per
+    message or packed into batch messages.  A real board
+    handles at most one message per 1ms USB frame, so the number of
+    commands per message is what limits the command rate on hardware.
+*/
+/**************************************************************************/
+static void bench_async(uint32_t iterations, bool batched)
+{
+  uint8_t  payload[1];
+  uint32_t start, elapsed, submitted = 0, ok = 0;
+  uint32_t resent = client.resent;
+  uint32_t frames = client.frames;
+  int      tag;
+
+  protclient_set_batching(&client, batched);
+
+  start = protclient_millis();
+  while (submitted < iterations)
+  {
+    /* More commands would only be rejected with ERROR_PROT_BUSY and resent */
+    if (client.in_flight >= PROTCLIENT_DEVICE_QUEUE_DEPTH)
+    {
+      protclient_poll(&client, 1);
+      continue;
+    }
+
+    payload[0] = submitted & 1;
+    tag = protclient_submit(&client, CMD_LED, payload, 1, count_done, &ok);
+    if (tag > 0)
+    {
+      submitted++;
+    }
+    else if (PROTCLIENT_ERR_NOTAG == tag)
+    {
+      protclient_poll(&client, 1);
+    }
+    else
+    {
+      break;
+    }
+  }
+  protclient_flush(&client);
+  elapsed = protclient_millis() - start;
+  frames  = client.frames - frames;
+
+  protclient_set_batching(&client, false);
+
+  CHECK(ok == iterations, batched ? "Batched calls" : "Async calls");
+  printf("%s: %u LED commands in %u ms (%.2f us/command), %.2f commands/message, %u resent on BUSY\n",
+         batched ? "batch " : "async ", iterations, elapsed, elapsed * 1000.0 / iterations,
+         frames ? (double) iterations / frames : 0.0, client.resent - resent);
+}
+
+int main(int argc, char * argv[])
+{
+  protclient_transport_t transport;
+  uint32_t               iterations = 100000;
+  int                    i;
+
+  for (i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-n") && i + 1 < argc)
+    {
+      iterations = (uint32_t) strtoul(argv[++i], NULL, 0);
+    }
+    else if (!strcmp(argv[i], "--usb"))
+    {
+      simulated = false;
+    }
+  }
+
+  if (simulated)
+  {
+    protsim_init(&transport);
+    printf("Simulated device\n");
+  }
+  else
+  {
+#ifdef PROTBENCH_USB
+    protusb_config_t config =
+    {
+      .vid       = PROTUSB_DEFAULT_VID,
+      .pid       = PROTUSB_DEFAULT_PID,
+      .interface = PROTUSB_DEFAULT_INTERFACE,
+      .ep_out    = PROTUSB_DEFAULT_EP_OUT,
+      .ep_in     = PROTUSB_DEFAULT_EP_IN
+    };
+    if ( protusb_open(&transport, &config) )
+    {
+      return -1;
+    }
+    printf("USB device %04X:%04X\n", config.vid, config.pid);
+#else
+    printf("USB support not built, use 'make usb'\n");
+    return -1;
+#endif
+  }
+
+  protclient_init(&client, &transport);
+
+  run_checks();
+  bench_sync(iterations);
+  bench_async(iterations, false);
+  bench_async(iterations, true);
+
+  if (simulated)
+  {
+    protsim_stats_t stats;
+    protsim_get_stats(&stats);
+    CHECK(0 == stats.dropped, "Device replies dropped");
+    printf("device: %u messages in, %u messages out, %u prot_task calls\n",
+           stats.commands, stats.replies, stats.task_calls);
+  }
+#ifdef PROTBENCH_USB
+  else
+  {
+    protusb_close();
+  }
+#endif
+
+  printf("%s (%d failures)\n", failures ? "FAILED" : "OK", failures);
+
+  return failures;
+}
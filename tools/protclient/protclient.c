@@ -0,0 +1,530 @@
+/**************************************************************************/
+/*!
+    @file     protclient.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Host-side client for the simple binary protocol
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+/*  Every command is sent with a request tag (1..15) in the low nibble of
+    the message type, and the device copies the tag into the response or
+    error message.  This lets protclient_submit keep up to 15 commands in
+    flight and match the replies, even if they arrive out of order, while
+    protclient_call is a simple blocking wrapper around submit + poll.
+
+    With protclient_set_batching, commands submitted back to back are
+    packed into batch messages (up to 60 bytes of commands per 64 byte
+    frame) which are sent by the next protclient_poll, and the device
+    packs the replies the same way.  This is much faster for small
+    commands, since each frame normally costs a full USB frame (1ms).
+
+    The client doesn't know anything about the physical link: messages
+    are exchanged through a protclient_transport_t, which can be a real
+    board (see protclient_usb.c) or the simulated device running the
+    firmware protocol code in the same process (see protclient_sim.c).
+
+    Ex.
+    ---
+
+    protclient_t        client;
+    protclient_result_t result;
+    uint8_t             led_on[] = { 0x01 };
+
+    protclient_init(&client, &transport);
+    if ( PROTCLIENT_OK == protclient_call(&client, 0x0001, led_on, 1, &result) )
+    {
+      // LED is on
+    }
+*/
+
+#include <string.h>
+#include "protclient.h"
+
+#ifdef _WIN32
+  #include <windows.h>
+#else
+  #include <time.h>
+#endif
+
+/**************************************************************************/
+/*!
+    @brief      Returns a monotonic millisecond counter
+*/
+/**************************************************************************/
+uint32_t protclient_millis(void)
+{
+#ifdef _WIN32
+  return (uint32_t) GetTickCount();
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t) (ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+#endif
+}
+
+/**************************************************************************/
+/*!
+    @brief      Releases a request slot and calls its completion callback
+*/
+/**************************************************************************/
+static void protclient_complete(protclient_t * p_client, uint8_t tag, protclient_result_t * p_result)
+{
+  protclient_request_t * p_req = &p_client->pending[tag];
+  protclient_done_t      done  = p_req->done;
+  void *                 ctx   = p_req->ctx;
+
+  p_result->cmd_id = (uint16_t) (p_req->msg[1] | (p_req->msg[2] << 8));
+
+  /* Free the slot first, so that the callback can submit a new request */
+  p_req->busy = false;
+  p_client->in_flight--;
+  p_client->completed++;
+
+  if (done)
+  {
+    done(ctx, p_result);
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief      Sends the pending batch message (a batch holding a single
+                command is sent as a normal command message)
+*/
+/**************************************************************************/
+static int protclient_send_batch(protclient_t * p_client)
+{
+  uint8_t const * p_msg = p_client->batch;
+  int             result;
+
+  if (p_client->batch_count == 0)
+  {
+    return PROTCLIENT_OK;
+  }
+
+  if (p_client->batch_count == 1)
+  {
+    p_msg = p_client->pending[p_client->batch[0] & PROTCLIENT_MSGTAG_MASK].msg;
+  }
+
+  result = p_client->transport.send(p_client->transport.ctx, p_msg);
+  p_client->frames++;
+
+  memset(p_client->batch, 0, PROTCLIENT_MSG_SIZE);
+  p_client->batch_count = 0;
+
+  return result ? PROTCLIENT_ERR_TRANSPORT : PROTCLIENT_OK;
+}
+
+/**************************************************************************/
+/*!
+    @brief      Sends a command, or adds it to the pending batch message
+*/
+/**************************************************************************/
+static int protclient_transmit(protclient_t * p_client, uint8_t tag)
+{
+  protclient_request_t * p_req = &p_client->pending[tag];
+  uint8_t                size  = 4 + p_req->msg[3];
+
+  p_client->sent++;
+
+  if ( !p_client->batching )
+  {
+    p_req->batch = tag;
+    p_client->frames++;
+    return p_client->transport.send(p_client->transport.ctx, p_req->msg) ? PROTCLIENT_ERR_TRANSPORT : PROTCLIENT_OK;
+  }
+
+  /* The batch payload starts at byte 4, after the batch header */
+  if ( 4 + p_client->batch[3] + size > PROTCLIENT_MSG_SIZE )
+  {
+    if ( protclient_send_batch(p_client) )
+    {
+      return PROTCLIENT_ERR_TRANSPORT;
+    }
+  }
+
+  /* The batch takes the tag of its first command */
+  if (p_client->batch_count == 0)
+  {
+    p_client->batch[0] = PROTCLIENT_MSGTYPE_BATCH | tag;
+  }
+
+  memcpy(&p_client->batch[4 + p_client->batch[3]], p_req->msg, size);
+  p_client->batch[3] += size;
+  p_client->batch_count++;
+  p_client->batch[1] = p_client->batch_count;
+  p_req->batch = p_client->batch[0] & PROTCLIENT_MSGTAG_MASK;
+
+  return PROTCLIENT_OK;
+}
+
+/**************************************************************************/
+/*!
+    @brief      Handles one message received from the device
+
+    @param[in]  batched
+                True if the message was packed in a batch message
+*/
+/**************************************************************************/
+static void protclient_dispatch(protclient_t * p_client, uint8_t const msg[PROTCLIENT_MSG_SIZE], bool batched)
+{
+  uint8_t             type = msg[0] & PROTCLIENT_MSGTYPE_MASK;
+  uint8_t             tag  = msg[0] & PROTCLIENT_MSGTAG_MASK;
+  protclient_result_t result;
+
+  /* Unpack the replies to a batch message */
+  if (PROTCLIENT_MSGTYPE_BATCH == type && !batched)
+  {
+    uint8_t reply[PROTCLIENT_MSG_SIZE];
+    uint8_t offset = 0;
+    uint8_t length = msg[3] > PROTCLIENT_MAX_PAYLOAD ? PROTCLIENT_MAX_PAYLOAD : msg[3];
+    uint8_t size;
+
+    while (offset < length)
+    {
+      type = msg[4+offset] & PROTCLIENT_MSGTYPE_MASK;
+      size = (PROTCLIENT_MSGTYPE_ERROR == type) ? 3 : 4 + msg[4+offset+3];
+      if ( (PROTCLIENT_MSGTYPE_ERROR != type && PROTCLIENT_MSGTYPE_RESPONSE != type) ||
+           offset + size > length )
+      {
+        break;
+      }
+
+      memset(reply, 0, PROTCLIENT_MSG_SIZE);
+      memcpy(reply, &msg[4+offset], size);
+      protclient_dispatch(p_client, reply, true);
+      offset += size;
+    }
+    return;
+  }
+
+  if ( tag && p_client->pending[tag].busy &&
+       (PROTCLIENT_MSGTYPE_RESPONSE == type || PROTCLIENT_MSGTYPE_ERROR == type) )
+  {
+    memset(&result, 0, sizeof(result));
+
+    if (PROTCLIENT_MSGTYPE_ERROR == type)
+    {
+      result.status   = PROTCLIENT_ERR_DEVICE;
+      result.error_id = (uint16_t) (msg[1] | (msg[2] << 8));
+
+      /* Device FIFO was full, keep the request and send it again.  If
+         a whole batch was rejected (it uses the tag of its first
+         command), every command in the batch is sent again          */
+      if (PROTCLIENT_ERROR_PROT_BUSY == result.error_id)
+      {
+        uint8_t i;
+
+        p_client->pending[tag].resend = true;
+        for (i = 1; !batched && i <= PROTCLIENT_MAX_PENDING; i++)
+        {
+          if ( p_client->pending[i].busy && p_client->pending[i].batch == tag )
+          {
+            p_client->pending[i].resend = true;
+          }
+        }
+        return;
+      }
+    }
+    else
+    {
+      result.status = PROTCLIENT_OK;
+      result.length = msg[3] > PROTCLIENT_MAX_PAYLOAD ? PROTCLIENT_MAX_PAYLOAD : msg[3];
+      memcpy(result.payload, &msg[4], result.length);
+    }
+
+    protclient_complete(p_client, tag, &result);
+  }
+  else if (p_client->unsolicited)
+  {
+    p_client->unsolicited(p_client->unsolicited_ctx, msg);
+  }
+}
+
+/**************************************************************************/
+/*!
+    @brief      Sends rejected commands again, and times out stale requests
+*/
+/**************************************************************************/
+static int protclient_service(protclient_t * p_client)
+{
+  uint32_t            now = protclient_millis();
+  protclient_result_t result;
+  uint8_t             tag;
+
+  for (tag = 1; tag <= PROTCLIENT_MAX_PENDING; tag++)
+  {
+    protclient_request_t * p_req = &p_client->pending[tag];
+
+    if ( !p_req->busy )
+    {
+      continue;
+    }
+
+    if ( (int32_t) (now - p_req->deadline) >= 0 )
+    {
+      memset(&result, 0, sizeof(result));
+      result.status = PROTCLIENT_ERR_TIMEOUT;
+      p_client->timeouts++;
+      protclient_complete(p_client, tag, &result);
+    }
+    else if (p_req->resend)
+    {
+      p_req->resend = false;
+      p_client->resent++;
+      if ( protclient_transmit(p_client, tag) )
+      {
+        return PROTCLIENT_ERR_TRANSPORT;
+      }
+    }
+  }
+
+  return protclient_send_batch(p_client);
+}
+
+/**************************************************************************/
+/*!
+    @brief      Initialises a client instance
+
+    @param[in]  p_client
+                Client instance
+    @param[in]  p_transport
+                Transport used to talk to the device (copied)
+*/
+/**************************************************************************/
+void protclient_init(protclient_t * p_client, protclient_transport_t const * p_transport)
+{
+  memset(p_client, 0, sizeof(protclient_t));
+  p_client->transport  = *p_transport;
+  p_client->timeout_ms = PROTCLIENT_DEFAULT_TIMEOUT;
+}
+
+/**************************************************************************/
+/*!
+    @brief      Sets the handler for messages that don't complete a request
+                (alerts, bulk transfer data, untagged replies, etc.)
+*/
+/**************************************************************************/
+void protclient_set_unsolicited(protclient_t * p_client, protclient_unsolicited_t handler, void * ctx)
+{
+  p_client->unsolicited     = handler;
+  p_client->unsolicited_ctx = ctx;
+}
+
+/**************************************************************************/
+/*!
+    @brief      Enables or disables packing several commands per message
+                (the device must support batch messages)
+*/
+/**************************************************************************/
+void protclient_set_batching(protclient_t * p_client, bool enable)
+{
+  p_client->batching = enable;
+}
+
+/**************************************************************************/
+/*!
+    @brief      Sends a command without waiting for the reply
+
+    @param[in]  cmd_id
+                Command ID (see src/protocol/prot_cmdtable.h)
+    @param[in]  payload
+                Command payload (can be NULL if length is 0)
+    @param[in]  length
+                Payload length (0..60)
+    @param[in]  done
+                Called from protclient_poll when the request completes,
+                fails or times out (can be NULL)
+
+    @returns    The request tag (1..15), or a negative protclient_status_t
+                (PROTCLIENT_ERR_NOTAG if too many requests are in flight)
+*/
+/**************************************************************************/
+int protclient_submit(protclient_t * p_client, uint16_t cmd_id, uint8_t const payload[], uint8_t length,
+                      protclient_done_t done, void * ctx)
+{
+  protclient_request_t * p_req;
+  uint8_t                tag;
+  uint8_t                i;
+
+  if ( length > PROTCLIENT_MAX_PAYLOAD || (length && !payload) )
+  {
+    return PROTCLIENT_ERR_PARAM;
+  }
+
+  if (p_client->in_flight >= PROTCLIENT_MAX_PENDING)
+  {
+    return PROTCLIENT_ERR_NOTAG;
+  }
+
+  /* Round robin, so that a late reply can't be mistaken for a new request */
+  tag = p_client->last_tag;
+  for (i = 0; i < PROTCLIENT_MAX_PENDING; i++)
+  {
+    tag = (tag % PROTCLIENT_MAX_PENDING) + 1;
+    if ( !p_client->pending[tag].busy )
+    {
+      break;
+    }
+  }
+
+  p_req = &p_client->pending[tag];
+  memset(p_req->msg, 0, PROTCLIENT_MSG_SIZE);
+  p_req->msg[0] = PROTCLIENT_MSGTYPE_COMMAND | tag;
+  p_req->msg[1] = (uint8_t) (cmd_id & 0xFF);
+  p_req->msg[2] = (uint8_t) (cmd_id >> 8);
+  p_req->msg[3] = length;
+  if (length)
+  {
+    memcpy(&p_req->msg[4], payload, length);
+  }
+
+  if ( protclient_transmit(p_client, tag) )
+  {
+    return PROTCLIENT_ERR_TRANSPORT;
+  }
+
+  p_req->busy      = true;
+  p_req->resend    = false;
+  p_req->deadline  = protclient_millis() + p_client->timeout_ms;
+  p_req->done      = done;
+  p_req->ctx       = ctx;
+  p_client->last_tag = tag;
+  p_client->in_flight++;
+
+  return tag;
+}
+
+/**************************************************************************/
+/*!
+    @brief      Waits up to timeout_ms for a message, then handles every
+                message that is already available, sends rejected commands
+                again and times out stale requests (the pending batch
+                message is sent first)
+
+    @returns    The number of requests completed, or PROTCLIENT_ERR_TRANSPORT
+*/
+/**************************************************************************/
+int protclient_poll(protclient_t * p_client, uint32_t timeout_ms)
+{
+  uint8_t  msg[PROTCLIENT_MSG_SIZE];
+  uint32_t completed = p_client->completed;
+  int      result;
+
+  /* Commands submitted since the last poll */
+  if ( protclient_send_batch(p_client) )
+  {
+    return PROTCLIENT_ERR_TRANSPORT;
+  }
+
+  result = p_client->transport.recv(p_client->transport.ctx, msg, timeout_ms);
+  while (result > 0)
+  {
+    protclient_dispatch(p_client, msg, false);
+    result = p_client->transport.recv(p_client->transport.ctx, msg, 0);
+  }
+
+  if ( result < 0 || protclient_service(p_client) )
+  {
+    return PROTCLIENT_ERR_TRANSPORT;
+  }
+
+  return (int) (p_client->completed - completed);
+}
+
+/**************************************************************************/
+/*!
+    @brief      Waits until every request in flight has completed
+
+    @returns    PROTCLIENT_OK or PROTCLIENT_ERR_TRANSPORT
+*/
+/**************************************************************************/
+int protclient_flush(protclient_t * p_client)
+{
+  while (p_client->in_flight)
+  {
+    if ( protclient_poll(p_client, 1) < 0 )
+    {
+      return PROTCLIENT_ERR_TRANSPORT;
+    }
+  }
+
+  return PROTCLIENT_OK;
+}
+
+/* Completion callback for protclient_call */
+static void protclient_call_done(void * ctx, protclient_result_t const * p_result)
+{
+  protclient_result_t * p_dest = (protclient_result_t *) ctx;
+  *p_dest = *p_result;
+}
+
+/**************************************************************************/
+/*!
+    @brief      Sends a command and blocks until the reply arrives (other
+                requests in flight keep being processed in the meantime)
+
+    @param[out] p_result
+                Response payload, or the device error code
+
+    @returns    PROTCLIENT_OK, or a negative protclient_status_t
+*/
+/**************************************************************************/
+int protclient_call(protclient_t * p_client, uint16_t cmd_id, uint8_t const payload[], uint8_t length,
+                    protclient_result_t * p_result)
+{
+  int tag;
+
+  /* Status is set to a non-error value until the request completes */
+  p_result->status = 1;
+
+  tag = protclient_submit(p_client, cmd_id, payload, length, protclient_call_done, p_result);
+  if (tag < 0)
+  {
+    p_result->status = tag;
+    return tag;
+  }
+
+  while (p_result->status > 0)
+  {
+    if ( protclient_poll(p_client, 1) < 0 )
+    {
+      /* Drop the request so its slot can be reused */
+      p_client->pending[tag].busy = false;
+      p_client->in_flight--;
+      p_result->status = PROTCLIENT_ERR_TRANSPORT;
+    }
+  }
+
+  return p_result->status;
+}
@@ -0,0 +1,157 @@
+/**************************************************************************/
+/*!
+    @file     protclient.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Host-side client for the simple binary protocol
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef _PROTCLIENT_H_
+#define _PROTCLIENT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Message layout (see src/protocol/protocol.txt) */
+#define PROTCLIENT_MSG_SIZE           (64)
+#define PROTCLIENT_MAX_PAYLOAD        (PROTCLIENT_MSG_SIZE-4)
+
+#define PROTCLIENT_MSGTYPE_COMMAND    (0x10)
+#define PROTCLIENT_MSGTYPE_RESPONSE   (0x20)
+#define PROTCLIENT_MSGTYPE_BATCH      (0x50)
+#define PROTCLIENT_MSGTYPE_ERROR      (0x80)
+#define PROTCLIENT_MSGTYPE_MASK       (0xF0)
+#define PROTCLIENT_MSGTAG_MASK        (0x0F)
+
+/* Device error code returned when its command FIFO is full (the request
+   is sent again automatically until it times out)                      */
+#define PROTCLIENT_ERROR_PROT_BUSY    (0x0124)
+
+/* Request tags 1..15 are used, so up to 15 commands can be in flight */
+#define PROTCLIENT_MAX_PENDING        (15)
+
+/* Commands the device queues before replying ERROR_PROT_BUSY (see
+   PROT_CMD_QUEUE_DEPTH in src/protocol/protocol.h)                 */
+#define PROTCLIENT_DEVICE_QUEUE_DEPTH (15)
+
+/* Default timeout for each request in ms */
+#define PROTCLIENT_DEFAULT_TIMEOUT    (1000)
+
+typedef enum
+{
+  PROTCLIENT_OK                 = 0,
+  PROTCLIENT_ERR_DEVICE         = -1,   /**< Device replied with an error message (see error_id) */
+  PROTCLIENT_ERR_TIMEOUT        = -2,   /**< No reply before the request timed out */
+  PROTCLIENT_ERR_TRANSPORT      = -3,   /**< The transport failed to send or receive */
+  PROTCLIENT_ERR_NOTAG          = -4,   /**< All request tags are in use, poll and try again */
+  PROTCLIENT_ERR_PARAM          = -5    /**< Invalid parameter (payload too large, etc.) */
+} protclient_status_t;
+
+/**************************************************************************/
+/*!
+    Transport used by the client to exchange 64 byte messages with the
+    device (USB, simulated device, etc.)
+*/
+/**************************************************************************/
+typedef struct
+{
+  /** Sends one message, returns 0 on success */
+  int  (*send) (void * ctx, uint8_t const msg[PROTCLIENT_MSG_SIZE]);
+  /** Waits up to timeout_ms for one message: returns 1 if a message was
+      received, 0 on timeout, or a negative value on error              */
+  int  (*recv) (void * ctx, uint8_t msg[PROTCLIENT_MSG_SIZE], uint32_t timeout_ms);
+  void * ctx;
+} protclient_transport_t;
+
+/** Outcome of a request, passed to the completion callback */
+typedef struct
+{
+  int      status;                            /**< protclient_status_t */
+  uint16_t cmd_id;
+  uint16_t error_id;                          /**< Device error code if status = PROTCLIENT_ERR_DEVICE */
+  uint8_t  length;                            /**< Response payload length */
+  uint8_t  payload[PROTCLIENT_MAX_PAYLOAD];
+} protclient_result_t;
+
+typedef void (*protclient_done_t)        (void * ctx, protclient_result_t const * p_result);
+typedef void (*protclient_unsolicited_t) (void * ctx, uint8_t const msg[PROTCLIENT_MSG_SIZE]);
+
+typedef struct
+{
+  bool              busy;
+  bool              resend;                   /**< Rejected with ERROR_PROT_BUSY, send it again */
+  uint8_t           batch;                    /**< Tag of the batch message it was sent in */
+  uint32_t          deadline;
+  protclient_done_t done;
+  void *            ctx;
+  uint8_t           msg[PROTCLIENT_MSG_SIZE];
+} protclient_request_t;
+
+typedef struct
+{
+  protclient_transport_t   transport;
+  protclient_request_t     pending[PROTCLIENT_MAX_PENDING+1];   /**< Indexed by request tag */
+  uint8_t                  last_tag;
+  uint8_t                  in_flight;
+  uint32_t                 timeout_ms;
+  bool                     batching;          /**< Pack commands into batch messages */
+  uint8_t                  batch[PROTCLIENT_MSG_SIZE];
+  uint8_t                  batch_count;
+  protclient_unsolicited_t unsolicited;       /**< Alerts, bulk data and unmatched messages */
+  void *                   unsolicited_ctx;
+
+  uint32_t                 frames;            /**< Messages passed to the transport */
+  uint32_t                 sent;              /**< Commands sent, including resends */
+  uint32_t                 completed;         /**< Requests completed (any status) */
+  uint32_t                 resent;            /**< Commands sent again after ERROR_PROT_BUSY */
+  uint32_t                 timeouts;          /**< Requests that timed out */
+} protclient_t;
+
+void protclient_init             ( protclient_t * p_client, protclient_transport_t const * p_transport );
+void protclient_set_unsolicited  ( protclient_t * p_client, protclient_unsolicited_t handler, void * ctx );
+void protclient_set_batching     ( protclient_t * p_client, bool enable );
+int  protclient_submit           ( protclient_t * p_client, uint16_t cmd_id, uint8_t const payload[], uint8_t length,
+                                   protclient_done_t done, void * ctx );
+int  protclient_poll             ( protclient_t * p_client, uint32_t timeout_ms );
+int  protclient_flush            ( protclient_t * p_client );
+int  protclient_call             ( protclient_t * p_client, uint16_t cmd_id, uint8_t const payload[], uint8_t length,
+                                   protclient_result_t * p_result );
+uint32_t protclient_millis       ( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
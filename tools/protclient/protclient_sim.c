@@ -0,0 +1,202 @@
+/**************************************************************************/
+/*!
+    @file     protclient_sim.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Simulated device for the protocol client, running the
+              firmware protocol code in the same process
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+/*  This file is compiled with the firmware headers and linked against
+    src/protocol/protocol.c, the command handlers in prot_cmdtable.h and
+    core/fifo/fifo.c (see the Makefile), using the same host settings as
+    tests_host (_TEST_ and CFG_BRD_LPCXPRESSO_LPC1347, with the protocol
+    running over USB HID).
+
+    Commands from the client go through the real receive path
+    (usb_hid_generic_recv_isr), and the device 'main loop' (prot_task) is
+    executed from the transport's recv function until the firmware sends
+    a message.  The few HAL functions used by the protocol code are
+    replaced by the stubs at the end of this file.
+
+    This makes it possible to measure the cost of the protocol layer and
+    command handlers themselves, and to regression test the client and
+    firmware together without a board.
+*/
+
+#include <string.h>
+#include "projectconfig.h"
+#include "protocol/protocol.h"
+#include "protclient_sim.h"
+
+#if !defined(CFG_PROTOCOL) || !defined(CFG_PROTOCOL_VIA_HID)
+  #error The simulated device requires CFG_PROTOCOL and CFG_PROTOCOL_VIA_HID
+#endif
+
+#if PROT_CMD_QUEUE_DEPTH != PROTCLIENT_DEVICE_QUEUE_DEPTH
+  #error PROTCLIENT_DEVICE_QUEUE_DEPTH must match PROT_CMD_QUEUE_DEPTH
+#endif
+
+/* Depth of the device to host message queue (the HID IN endpoint) */
+#define PROTSIM_QUEUE_DEPTH   (16)
+
+static uint8_t         protsim_queue[PROTSIM_QUEUE_DEPTH][PROTCLIENT_MSG_SIZE];
+static uint32_t        protsim_head;
+static uint32_t        protsim_tail;
+static bool            protsim_led_state;
+static protsim_stats_t protsim_stats;
+
+/**************************************************************************/
+/*!
+    @brief      Transport send: the message arrives as a HID OUT report
+*/
+/**************************************************************************/
+static int protsim_send(void * ctx, uint8_t const msg[PROTCLIENT_MSG_SIZE])
+{
+  uint8_t report[PROTCLIENT_MSG_SIZE];
+
+  (void) ctx;
+  memcpy(report, msg, PROTCLIENT_MSG_SIZE);
+  usb_hid_generic_recv_isr(report, PROTCLIENT_MSG_SIZE);
+  protsim_stats.commands++;
+
+  return 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief      Transport recv: runs the device until it sends a message
+*/
+/**************************************************************************/
+static int protsim_recv(void * ctx, uint8_t msg[PROTCLIENT_MSG_SIZE], uint32_t timeout_ms)
+{
+  uint32_t start = protclient_millis();
+
+  (void) ctx;
+
+  while (protsim_head == protsim_tail)
+  {
+    prot_task(NULL);
+    protsim_stats.task_calls++;
+
+    if ( protsim_head == protsim_tail && (protclient_millis() - start) >= timeout_ms )
+    {
+      return 0;
+    }
+  }
+
+  memcpy(msg, protsim_queue[protsim_tail % PROTSIM_QUEUE_DEPTH], PROTCLIENT_MSG_SIZE);
+  protsim_tail++;
+
+  return 1;
+}
+
+/**************************************************************************/
+/*!
+    @brief      Resets the simulated device and returns its transport
+*/
+/**************************************************************************/
+void protsim_init(protclient_transport_t * p_transport)
+{
+  protsim_head      = 0;
+  protsim_tail      = 0;
+  protsim_led_state = false;
+  memset(&protsim_stats, 0, sizeof(protsim_stats_t));
+
+  prot_init();
+
+  p_transport->send = protsim_send;
+  p_transport->recv = protsim_recv;
+  p_transport->ctx  = NULL;
+}
+
+/**************************************************************************/
+/*!
+    @brief      Returns the state of the simulated LED
+*/
+/**************************************************************************/
+bool protsim_led(void)
+{
+  return protsim_led_state;
+}
+
+/**************************************************************************/
+/*!
+    @brief      Returns the simulated device counters
+*/
+/**************************************************************************/
+void protsim_get_stats(protsim_stats_t * p_stats)
+{
+  *p_stats = protsim_stats;
+}
+
+//--------------------------------------------------------------------+
+// HAL STUBS
+//--------------------------------------------------------------------+
+uint32_t SystemCoreClock = 72000000;
+
+ErrorCode_t usb_hid_generic_send(uint8_t const * p_report_in, uint32_t length)
+{
+  if (protsim_head - protsim_tail >= PROTSIM_QUEUE_DEPTH)
+  {
+    protsim_stats.dropped++;
+    return ERR_FAILED;
+  }
+
+  memset(protsim_queue[protsim_head % PROTSIM_QUEUE_DEPTH], 0, PROTCLIENT_MSG_SIZE);
+  memcpy(protsim_queue[protsim_head % PROTSIM_QUEUE_DEPTH], p_report_in,
+         length < PROTCLIENT_MSG_SIZE ? length : PROTCLIENT_MSG_SIZE);
+  protsim_head++;
+  protsim_stats.replies++;
+
+  return LPC_OK;
+}
+
+uint32_t delayGetTicks(void)
+{
+  return protclient_millis();
+}
+
+void boardLED(uint8_t state)
+{
+  protsim_led_state = (state == CFG_LED_ON);
+}
+
+err_t iapReadUID(uint32_t uid[])
+{
+  uid[0] = 0x50524F54;
+  uid[1] = 0x53494D00;
+  uid[2] = 0x00000000;
+  uid[3] = 0x00000001;
+
+  return ERROR_NONE;
+}
@@ -0,0 +1,64 @@
+/**************************************************************************/
+/*!
+    @file     protclient_sim.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Simulated device for the protocol client, running the
+              firmware protocol code in the same process
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef _PROTCLIENT_SIM_H_
+#define _PROTCLIENT_SIM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "protclient.h"
+
+/** Counters for the simulated device */
+typedef struct
+{
+  uint32_t commands;      /**< Messages passed to the firmware receive ISR */
+  uint32_t replies;       /**< Messages sent by the firmware */
+  uint32_t dropped;       /**< Messages the firmware couldn't send (IN queue full) */
+  uint32_t task_calls;    /**< Number of prot_task iterations */
+} protsim_stats_t;
+
+void     protsim_init      ( protclient_transport_t * p_transport );
+bool     protsim_led       ( void );
+void     protsim_get_stats ( protsim_stats_t * p_stats );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,154 @@
+/**************************************************************************/
+/*!
+    @file     protclient_usb.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    libusb transport for the protocol client
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+/*  Talks to a real board over USB using libusb 1.0 (or libusbx, see
+    tools/libs/libusbx).  Use bulk transfers with CFG_PROTOCOL_VIA_BULK,
+    or set .interrupt and the HID generic endpoints with
+    CFG_PROTOCOL_VIA_HID (the interface must not be claimed by the OS
+    HID driver).  Only one device can be open at a time.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "libusb.h"
+#include "protclient_usb.h"
+
+static libusb_device_handle * protusb_handle;
+static protusb_config_t       protusb_config;
+
+/**************************************************************************/
+/*!
+    @brief      Runs a single 64 byte transfer on the configured endpoint
+*/
+/**************************************************************************/
+static int protusb_transfer(uint8_t endpoint, uint8_t msg[PROTCLIENT_MSG_SIZE], uint32_t timeout_ms)
+{
+  int transferred = 0;
+  int result;
+
+  if (protusb_config.interrupt)
+  {
+    result = libusb_interrupt_transfer(protusb_handle, endpoint, msg, PROTCLIENT_MSG_SIZE, &transferred, timeout_ms);
+  }
+  else
+  {
+    result = libusb_bulk_transfer(protusb_handle, endpoint, msg, PROTCLIENT_MSG_SIZE, &transferred, timeout_ms);
+  }
+
+  if (LIBUSB_ERROR_TIMEOUT == result)
+  {
+    return 0;
+  }
+
+  return (result || transferred == 0) ? -1 : 1;
+}
+
+static int protusb_send(void * ctx, uint8_t const msg[PROTCLIENT_MSG_SIZE])
+{
+  uint8_t buffer[PROTCLIENT_MSG_SIZE];
+
+  (void) ctx;
+  memcpy(buffer, msg, PROTCLIENT_MSG_SIZE);
+
+  /* No timeout (0) in libusb means wait forever, use 1s instead */
+  return (protusb_transfer(protusb_config.ep_out, buffer, 1000) == 1) ? 0 : -1;
+}
+
+static int protusb_recv(void * ctx, uint8_t msg[PROTCLIENT_MSG_SIZE], uint32_t timeout_ms)
+{
+  (void) ctx;
+
+  /* libusb can't poll without a timeout, 1ms is the shortest wait */
+  return protusb_transfer(protusb_config.ep_in, msg, timeout_ms ? timeout_ms : 1);
+}
+
+/**************************************************************************/
+/*!
+    @brief      Opens the USB device and returns its transport
+
+    @returns    0 on success, -1 if the device can't be opened
+*/
+/**************************************************************************/
+int protusb_open(protclient_transport_t * p_transport, protusb_config_t const * p_config)
+{
+  if ( libusb_init(NULL) )
+  {
+    printf("Failed to initialise libusb\n");
+    return -1;
+  }
+
+  protusb_handle = libusb_open_device_with_vid_pid(NULL, p_config->vid, p_config->pid);
+  if (NULL == protusb_handle)
+  {
+    printf("Unable to open VID:0x%04X PID:0x%04X\n", p_config->vid, p_config->pid);
+    libusb_exit(NULL);
+    return -1;
+  }
+
+  /* We need to claim the interface before we can do any IO */
+  if ( libusb_claim_interface(protusb_handle, p_config->interface) )
+  {
+    printf("Unable to claim interface %d for VID:0x%04X PID:0x%04X\n",
+           p_config->interface, p_config->vid, p_config->pid);
+    libusb_close(protusb_handle);
+    libusb_exit(NULL);
+    return -1;
+  }
+
+  protusb_config    = *p_config;
+  p_transport->send = protusb_send;
+  p_transport->recv = protusb_recv;
+  p_transport->ctx  = NULL;
+
+  return 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief      Releases the USB device
+*/
+/**************************************************************************/
+void protusb_close(void)
+{
+  if (protusb_handle)
+  {
+    libusb_release_interface(protusb_handle, protusb_config.interface);
+    libusb_close(protusb_handle);
+    libusb_exit(NULL);
+    protusb_handle = NULL;
+  }
+}
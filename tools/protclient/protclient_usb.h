@@ -0,0 +1,71 @@
+/**************************************************************************/
+/*!
+    @file     protclient_usb.h
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    libusb transport for the protocol client
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+#ifndef _PROTCLIENT_USB_H_
+#define _PROTCLIENT_USB_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "protclient.h"
+
+/* Defaults for a board using CFG_PROTOCOL_VIA_BULK (USB custom class) */
+#define PROTUSB_DEFAULT_VID         (0x1FC9)
+#define PROTUSB_DEFAULT_PID         (0x2020)
+#define PROTUSB_DEFAULT_INTERFACE   (0)
+#define PROTUSB_DEFAULT_EP_OUT      (0x04)
+#define PROTUSB_DEFAULT_EP_IN       (0x81)
+
+/** USB device settings */
+typedef struct
+{
+  uint16_t vid;
+  uint16_t pid;
+  uint8_t  interface;
+  uint8_t  ep_out;
+  uint8_t  ep_in;
+  bool     interrupt;     /**< Use interrupt transfers (HID) instead of bulk */
+} protusb_config_t;
+
+int  protusb_open  ( protclient_transport_t * p_transport, protusb_config_t const * p_config );
+void protusb_close ( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,337 @@
+/**************************************************************************/
+/*!
+    @file     stdiobench.c
+    @author   K. Townsend (microBuilder.eu)
+
+    @brief    Benchmark and regression checks for core/libc/stdio.c
+
+    @section LICENSE
+
+    Software License Agreement (BSD License)
+
+    Copyright (c) 2013, K. Townsend (microBuilder.eu)
+    All rights reserved.
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+    1. Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+    2. Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+    3. Neither the name of the copyright holders nor the
+    names of its contributors may be used to endorse or promote products
+    derived from this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ''AS IS'' AND ANY
+    EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+/**************************************************************************/
+
+/*  core/libc/stdio.c is built with its public functions renamed to fw_*,
+    and the previous implementation (stdio_ref.c) to ref_* (see the
+    Makefile), so both can run next to the host C library.
+
+    Usage: stdiobench [-t] [-b] [-n <iterations>]
+
+      -t   Compares fw_snprintf with the host snprintf for integers, %f
+           and %e (the firmware writes %e with an upper case 'E', so it is
+           checked against the host's %E), and checks %E (engineering
+           notation) against known results
+      -b   Measures the time per call of fw_snprintf and ref_snprintf for
+           the format strings used to log sensor data
+      -n   Number of calls per format string (default 1000000)
+
+    The exit code is the number of failed checks.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+
+signed int fw_snprintf(char *pString, size_t length, const char *pFormat, ...);
+signed int ref_snprintf(char *pString, size_t length, const char *pFormat, ...);
+
+/* vprintf isn't used here, but both implementations need an output */
+signed int fw_puts(const char *str)  { return 0; }
+signed int ref_puts(const char *str) { return 0; }
+
+static int failures;
+static int checks;
+
+/**************************************************************************/
+/*!
+    @brief  Compares two strings, printing the first few mismatches
+*/
+/**************************************************************************/
+static void compare(const char *fmt, const char *actual, const char *expected)
+{
+  checks++;
+  if (strcmp(actual, expected))
+  {
+    if (failures++ < 20)
+    {
+      printf("FAIL '%s': got '%s', expected '%s'\n", fmt, actual, expected);
+    }
+  }
+}
+
+#define CHECK_HOST(fmt, hostfmt, value)                          \
+  do {                                                           \
+    char _fw[128], _host[128];                                   \
+    fw_snprintf(_fw, sizeof(_fw), fmt, value);                   \
+    snprintf(_host, sizeof(_host), hostfmt, value);              \
+    compare(fmt, _fw, _host);                                    \
+  } while (0)
+
+#define CHECK_FIXED(fmt, value, expected)                        \
+  do {                                                           \
+    char _fw[128];                                               \
+    fw_snprintf(_fw, sizeof(_fw), fmt, value);                   \
+    compare(fmt, _fw, expected);                                 \
+  } while (0)
+
+/**************************************************************************/
+/*!
+    @brief  Random double with a random mantissa, sign and decimal
+            exponent between minExp and maxExp
+*/
+/**************************************************************************/
+static double randomDouble(int minExp, int maxExp)
+{
+  double value = (double) rand() / RAND_MAX + (double) rand() / RAND_MAX / RAND_MAX;
+  value *= pow(10.0, minExp + rand() % (maxExp - minExp + 1));
+  return (rand() & 1) ? -value : value;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Regression checks against the host C library
+*/
+/**************************************************************************/
+static void runTests(void)
+{
+  static const int ints[] = { 0, 1, 9, 10, 99, 100, 101, 999, 1000, 43698,
+                              43699, 65535, 65536, 99999, 100000, 4294967,
+                              123456789, INT_MAX, -1, -9, -10, -43699,
+                              -100000, INT_MIN };
+  static const char *intFormats[] = { "%d", "%i", "%5d", "%05d", "%12d",
+                                      "%1d", "%u", "%3u", "%x", "%X",
+                                      "%02x", "%04X", "%08X" };
+  static const char *floatFormats[] = { "%f", "%.0f", "%.1f", "%.2f", "%.3f",
+                                        "%.4f", "%.5f", "%.7f", "%.8f",
+                                        "%.9f", "%10.3f", "%010.3f" };
+  static const char *expFormats[][2] = { { "%e", "%E" }, { "%.0e", "%.0E" },
+                                         { "%.1e", "%.1E" }, { "%.3e", "%.3E" },
+                                         { "%.8e", "%.8E" }, { "%.9e", "%.9E" },
+                                         { "%14.4e", "%14.4E" } };
+  unsigned int i, j;
+
+  // Integers: edge cases, then random values of all magnitudes
+  for (i = 0; i < sizeof(ints) / sizeof(ints[0]); i++)
+  {
+    for (j = 0; j < sizeof(intFormats) / sizeof(intFormats[0]); j++)
+    {
+      CHECK_HOST(intFormats[j], intFormats[j], ints[i]);
+    }
+  }
+  for (i = 0; i < 100000; i++)
+  {
+    int value = (int) ((unsigned int) rand() * 2654435761u) >> (rand() % 32);
+    CHECK_HOST(intFormats[i % 13], intFormats[i % 13], value);
+  }
+
+  // %f, for values up to 2^64 (larger values are written as %e)
+  CHECK_HOST("%f", "%f", 0.0);
+  CHECK_HOST("%f", "%f", -0.0);
+  CHECK_HOST("%f", "%f", 1.0);
+  CHECK_HOST("%f", "%f", 0.1);
+  CHECK_HOST("%f", "%f", 9.9999996);
+  CHECK_HOST("%f", "%f", -273.15);
+  CHECK_HOST("%.2f", "%.2f", 1013.2549);
+  CHECK_HOST("%.9f", "%.9f", 1e-10);
+  CHECK_HOST("%f", "%f", 4294967296.0);
+  CHECK_HOST("%f", "%f", 18446744073709549568.0);
+  CHECK_HOST("%f", "%f", 5e-324);
+  for (i = 0; i < 200000; i++)
+  {
+    double value = randomDouble(-8, 18);
+    CHECK_HOST(floatFormats[i % 12], floatFormats[i % 12], value);
+  }
+
+  // %e, over the full range of doubles
+  CHECK_HOST("%e", "%E", 0.0);
+  CHECK_HOST("%e", "%E", 1.0);
+  CHECK_HOST("%e", "%E", 9.9999996);
+  CHECK_HOST("%e", "%E", 1e100);
+  CHECK_HOST("%e", "%E", -1.5e-300);
+  CHECK_HOST("%e", "%E", 1.7976931348623157e308);
+  CHECK_HOST("%e", "%E", 2.2250738585072014e-308);
+  CHECK_HOST("%e", "%E", 5e-324);
+  for (i = 0; i < 200000; i++)
+  {
+    double value = randomDouble(-307, 307);
+    CHECK_HOST(expFormats[i % 7][0], expFormats[i % 7][1], value);
+  }
+
+  // %E (engineering notation) and special values
+  CHECK_FIXED("%E", 0.0, "0.000E+00");
+  CHECK_FIXED("%E", 1.0, "1.000E+00");
+  CHECK_FIXED("%E", -1.5, "-1.500E+00");
+  CHECK_FIXED("%E", 12345.678, "12.346E+03");
+  CHECK_FIXED("%E", 0.00012345, "123.450E-06");
+  CHECK_FIXED("%E", 999.9996, "1.000E+03");
+  CHECK_FIXED("%E", 1e-9, "1.000E-09");
+  CHECK_FIXED("%.1E", 4.7e-7, "470.0E-09");
+  CHECK_FIXED("%E", 1e300, "1.000E+300");
+  CHECK_FIXED("%f", 1e20, "1.000000E+20");
+  CHECK_FIXED("%f", INFINITY, "inf");
+  CHECK_FIXED("%f", -INFINITY, "-inf");
+  CHECK_FIXED("%e", NAN, "nan");
+  CHECK_FIXED("%6E", INFINITY, "   inf");
+
+  // Precision is limited to 9 digits
+  CHECK_FIXED("%.12f", 0.5, "0.500000000");
+}
+
+/**************************************************************************/
+/*!
+    @brief  Time per call for one format string, in ns
+*/
+/**************************************************************************/
+typedef signed int (*snprintf_t)(char *, size_t, const char *, ...);
+
+static double now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+#define SAMPLES (256)
+#define RUNS    (100)
+
+static double timeFormat(snprintf_t fn, int format, int iterations,
+                         const int *ints, const double *floats)
+{
+  char buffer[128];
+  double start = now();
+  int i, k;
+
+  for (i = 0; i < iterations; i++)
+  {
+    k = i % (SAMPLES - 4);
+    switch (format)
+    {
+      case 0:
+        fn(buffer, sizeof(buffer), "%d,%s,%d,%d,%f,%f,%f%s", ints[k], "LSM303",
+           ints[k+1] & 0xF, ints[k+2], floats[k], floats[k+1], floats[k+2], "\r\n");
+        break;
+      case 1:
+        fn(buffer, sizeof(buffer), "%d,%d,%d,%f,%f,%f,%f%s", ints[k], ints[k+1],
+           ints[k+2], floats[k], floats[k+1], floats[k+2], floats[k+3], "\r\n");
+        break;
+      case 2:
+        fn(buffer, sizeof(buffer), "X: %f, Y: %f, Z: %f, Pitch: %d, Roll: %d\r\n",
+           floats[k], floats[k+1], floats[k+2], ints[k] % 90, ints[k+1] % 180);
+        break;
+      case 3:
+        fn(buffer, sizeof(buffer), "%08X: %02X %02X %02X %02X", ints[k] * 16,
+           ints[k] & 0xFF, ints[k+1] & 0xFF, ints[k+2] & 0xFF, ints[k+3] & 0xFF);
+        break;
+      case 4:
+        fn(buffer, sizeof(buffer), "%f,%e%s", floats[k], floats[k+1], "\r\n");
+        break;
+    }
+  }
+
+  return (now() - start) / iterations;
+}
+
+static void runBenchmark(int iterations)
+{
+  static const char *names[] = { "sensors_t CSV (sensorsLogSensor)",
+                                 "sensors_event_t CSV (sensorsLogEvent)",
+                                 "Accelerometer X/Y/Z, pitch, roll",
+                                 "Memory dump (%08X, %02X)",
+                                 "Allan deviation (%f, %e)" };
+  int ints[SAMPLES];
+  double floats[SAMPLES];
+  int i;
+
+  // Typical sensor readings: timestamps, ids and SI values
+  for (i = 0; i < SAMPLES; i++)
+  {
+    ints[i] = rand() % 100000;
+    floats[i] = randomDouble(-2, 3);
+  }
+
+  // Best of several interleaved runs, since the host is rarely idle
+  printf("%-38s %10s %10s %8s\n", "Format", "ref ns", "fw ns", "speedup");
+  for (i = 0; i < 5; i++)
+  {
+    double ref = 1e9, fw = 1e9, t;
+    int run;
+    for (run = 0; run < RUNS; run++)
+    {
+      t = timeFormat(ref_snprintf, i, iterations / RUNS, ints, floats);
+      if (t < ref) ref = t;
+      t = timeFormat(fw_snprintf, i, iterations / RUNS, ints, floats);
+      if (t < fw) fw = t;
+    }
+    printf("%-38s %10.1f %10.1f %7.2fx\n", names[i], ref, fw, ref / fw);
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  int iterations = 1000000;
+  int tests = 0, bench = 0;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "tbn:")) != -1)
+  {
+    switch (opt)
+    {
+      case 't': tests = 1; break;
+      case 'b': bench = 1; break;
+      case 'n': iterations = atoi(optarg); break;
+      default:
+        fprintf(stderr, "Usage: %s [-t] [-b] [-n <iterations>]\n", argv[0]);
+        return 1;
+    }
+  }
+
+  if (!tests && !bench)
+  {
+    tests = bench = 1;
+  }
+
+  srand(1);
+
+  if (tests)
+  {
+    runTests();
+    printf("%d checks, %d failures\n", checks, failures);
+  }
+
+  if (bench)
+  {
+    runBenchmark(iterations);
+  }
+
+  return failures;
+}